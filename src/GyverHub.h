@@ -7,17 +7,21 @@
 #include "ui/color.h"
 #include "ui/flags.h"
 #include "ui/log.h"
+#include "ui/layout.h"
 #include "utils/strings.h"
 #include "utils/base64.h"
 #include "utils/timer.h"
 #include "utils/json.h"
+#include "utils/cbor.h"
 #include "utils/files.h"
 #include "hub/info.h"
 #include "hub/fs.h"
+#include "hub/upload.h"
 #include "impl/impl_select.h"
 
 #if GHI_ESP_BUILD
 #include "hub/fetch.h"
+#include "hub/tsdb.h"
 #endif
 
 #ifdef ESP8266
@@ -210,6 +214,16 @@ public:
         data_cb = handler;
     }
 
+#if GHC_FS != GHC_FS_NONE
+
+    /// файлы изменены скетчем: path - файл или папка, nullptr - вся ФС (для списка файлов fsbr)
+    void fsChanged(const char* path = nullptr) {
+        if (path) gyverhub::fsIndex().update(path);
+        else gyverhub::fsIndex().clear();
+    }
+
+#endif
+
 #if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_FETCH)
 
     /// подключить обработчик скачивания
@@ -332,6 +346,7 @@ public:
         _updateBegin(answ);
         answ.key(name.c_str());
         answ += '[';
+        cv.flush();
         answ += cv.buf;
         answ += F("]}");
         answ.end();
@@ -342,7 +357,9 @@ public:
     // начать отправку холста
     void sendCanvasBegin(const String& name, gyverhub::Canvas& cv) {
         if (!running_f) return;
-        cv.buf.clear();
+        // холст из билдера мог остаться на чужом буфере
+        cv.extBuffer(&cv.buf);
+        cv.clearBuffer();
         _updateBegin(cv.buf);
         cv.buf.key(name.c_str());
         cv.buf += '[';
@@ -350,6 +367,7 @@ public:
 
     // закончить отправку холста
     void sendCanvasEnd(gyverhub::Canvas& cv) {
+        cv.flush();
         cv.buf += F("]}");
         cv.buf.end();
         _send(cv.buf);
@@ -372,26 +390,40 @@ public:
         _send(answ);
     }
 
-    // отправить update по имени компонента (значение будет прочитано в build). Нельзя вызывать из build. Имена можно передать списком через запятую
+    // отправить update по имени компонента (значение будет прочитано в build). Нельзя вызывать из build. Имена можно передать списком через запятую.
+    // Для Log и Plot отправляется только дописанное с прошлой отправки (tail)
     void sendUpdate(const String& name) {
         if (!running_f || !build_cb || !focused()) return;
 
         gyverhub::Json answ;
         _updateBegin(answ);
+        size_t empty = answ.length();
 
         for (gyverhub::Splitter s{(char*)name.c_str()}; s.next(); ) {
+            size_t keyPos = answ.length();
             answ.key(s.get());
             answ += '\"';
             answ.reserve(answ.length() + 64);
-            gyverhub::Builder::buildRead(build_cb, &answ, s.get());
+            size_t valPos = answ.length();
+            gyverhub::Tail tail;
+            if (gyverhub::Builder::buildTail(build_cb, &answ, s.get(), gyverhub::Builder::TAIL_SENT, tail)) {
+                _send(_tail(s.get(), answ.c_str() + valPos, answ.length() - valPos, tail));
+                answ.remove(keyPos);
+                continue;
+            }
             answ += F("\",");
         }
+        if (answ.length() == empty) return;
         answ[answ.length() - 1] = '}';
         answ.end();
         _send(answ);
     }
 
 private:
+    static bool _setAccepted(gyverhub::ParseStatus status) {
+        return status == gyverhub::ParseStatus::OK || status == gyverhub::ParseStatus::CLAMPED;
+    }
+
     void _updateBegin(gyverhub::Json& answ) {
         answ.begin();
         answ.appendId(id);
@@ -453,6 +485,10 @@ public:
             GHclient client(from, value);
             client_ptr = &client;
             answerDiscover();
+#if GHC_MQTT_CBOR
+            // discover отвечаем в JSON, формат меняется для следующих сообщений
+            if (from == gyverhub::ConnectionType::MQTT) _setCbor(client.id, strstr(value, ":cbor") != nullptr);
+#endif
             return;
         }
 
@@ -465,6 +501,10 @@ public:
             GHclient client(from, value);
             client_ptr = &client;
             answerDiscover();
+#if GHC_MQTT_CBOR
+            // discover отвечаем в JSON, формат меняется для следующих сообщений
+            if (from == gyverhub::ConnectionType::MQTT) _setCbor(client.id, strstr(value, ":cbor") != nullptr);
+#endif
             return;
         }
 
@@ -503,9 +543,14 @@ public:
 #if GHI_MOD_ENABLED(GH_MOD_SET)
             if (cmdn == gyverhub::Command::SET) {
                 GHI_DEBUG_LOG("Event: SET_HOOK from %d", from);
-                gyverhub::Builder::buildSet(build_cb, name, value, client);
+                gyverhub::ParseStatus status;
+                gyverhub::Builder::buildSet(build_cb, name, value, client, &status);
+                if (!_setAccepted(status)) return;
+
+                gyverhub::Json actual;
+                if (status == gyverhub::ParseStatus::CLAMPED && gyverhub::Builder::buildRead(build_cb, &actual, name)) value = actual.c_str();
                 if (autoGet_f) sendGet(name, value);
-                if (autoUpd_f) sendUpdate(name, value);
+                if (autoUpd_f || status == gyverhub::ParseStatus::CLAMPED) sendUpdate(name, value);
                 return;
             }
 #endif
@@ -517,7 +562,7 @@ public:
             switch (cmdn) {
                 case gyverhub::Command::FOCUS:
                     GHI_DEBUG_LOG("Event: FOCUS from %d", from);
-                    answerUI();
+                    answerUI(value);
                     return;
 
                 case gyverhub::Command::PING:
@@ -549,7 +594,8 @@ public:
                     GHI_FS.format();
                     GHI_FS.end();
                     fs_mounted = GHI_FS.begin();
-                    answerFsbr();
+                    gyverhub::fsIndex().clear();
+                    _answerFsbrPage();
                     return;
 #endif
 #if GHI_ESP_BUILD && GHI_MOD_ENABLED(GH_MOD_REBOOT)
@@ -569,6 +615,28 @@ public:
         // p.size == 5
 
         switch (cmdn) {
+            case gyverhub::Command::PAGE: {
+                GHI_DEBUG_LOG("Event: PAGE from %d", from);
+                uint32_t page;
+                if (gyverhub::parseUnsigned(name, page) != gyverhub::ParseStatus::OK || page > 0xff) {
+                    answerErr(F("Invalid value"));
+                    return;
+                }
+                answerUI(value, page);
+                return;
+            }
+            case gyverhub::Command::ROWS:
+                GHI_DEBUG_LOG("Event: ROWS from %d", from);
+                answerRows(name, value);
+                return;
+            case gyverhub::Command::TAIL:
+                GHI_DEBUG_LOG("Event: TAIL from %d", from);
+                answerTail(name, value);
+                return;
+            case gyverhub::Command::PLOT:
+                GHI_DEBUG_LOG("Event: PLOT from %d", from);
+                answerPlot(name, value);
+                return;
             case gyverhub::Command::DATA:
                 GHI_DEBUG_LOG("Event: DATA from %d", from);
                 if (data_cb) data_cb(name, value);
@@ -582,13 +650,24 @@ public:
                     return;
                 }
                 
-                bool mustRefresh = gyverhub::Builder::buildSet(build_cb, name, value, client);
+                gyverhub::ParseStatus status;
+                bool mustRefresh = gyverhub::Builder::buildSet(build_cb, name, value, client, &status);
+                if (!_setAccepted(status)) {
+                    if (status == gyverhub::ParseStatus::OUT_OF_RANGE) answerErr(F("Value out of range"));
+                    else answerErr(F("Invalid value"));
+                    return;
+                }
+
+                // значение изменено под min/max/step - клиенту нужно новое
+                gyverhub::Json actual;
+                bool clamped = status == gyverhub::ParseStatus::CLAMPED;
+                if (clamped && gyverhub::Builder::buildRead(build_cb, &actual, name)) value = actual.c_str();
 #if GHC_MQTT_IMPL != GHC_IMPL_NONE
                 if (autoGet_f) sendGet(name, value);
 #endif
-                if (autoUpd_f) sendUpdate(name, value);
-                if (mustRefresh) answerUI();
-                else if (!autoUpd_f) answerType();
+                if (autoUpd_f || clamped) sendUpdate(name, value);
+                if (mustRefresh) answerUI(nullptr, gyverhub::Builder::pageOf(name));
+                else if (!autoUpd_f && !clamped) answerType();
                 return;
             }
 #endif
@@ -600,20 +679,30 @@ public:
                     cli_cb(str);
                 }
                 return;
+#if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_FSBR)
+            case gyverhub::Command::FSBR:
+                GHI_DEBUG_LOG("Event: FSBR from %d", from);
+                if (fs_mounted) _fsbr(name, value);
+                else answerType(F("fs_error"));
+                return;
+#endif
 #if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_DELETE)
             case gyverhub::Command::DELETE:
                 GHI_DEBUG_LOG("Event: DELETE from %d", from);
                 GHI_FS.remove(name);
                 gyverhub::rmdirRecursive(name);
-                answerFsbr();
+                gyverhub::fsIndex().update(name);
+                _answerFsbrPage();
                 return;
 #endif
 #if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_RENAME)
             case gyverhub::Command::RENAME:
                 GHI_DEBUG_LOG("Event: RENAME from %d", from);
-                if (GHI_FS.rename(name, value))
-                    answerFsbr();
-                else answerErr(F("Rename failed"));
+                if (GHI_FS.rename(name, value)) {
+                    gyverhub::fsIndex().update(name);
+                    gyverhub::fsIndex().update(value);
+                    _answerFsbrPage();
+                } else answerErr(F("Rename failed"));
                 return;
 #endif
 #if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_FETCH)
@@ -624,7 +713,8 @@ public:
                     return;
                 }
 
-                if (!fetch.open(name)) {
+                // value "gzip" - клиент распакует сжатое
+                if (!fetch.open(name, value && !strcmp_P(value, PSTR("gzip")))) {
                     GHI_DEBUG_LOG("Event: FETCH_ERROR from %d (not found)", from);
                     answerType(F("fetch_err"));
                     return;
@@ -633,7 +723,18 @@ public:
                 GHI_DEBUG_LOG("Event: FETCH from %d", from);
                 fs_client = client;
                 fs_tmr.reset();
-                answerType(F("fetch_start"));
+                if (fetch.isGzip()) {
+                    gyverhub::Json answ;
+                    answ.reserve(60);
+                    answ.begin();
+                    answ.appendId(id);
+                    answ.itemString(F("type"), F("fetch_start"));
+                    answ.itemInteger(F("gzip"), 1);
+                    answ.end();
+                    _answer(answ);
+                } else {
+                    answerType(F("fetch_start"));
+                }
                 return;
             }
 
@@ -647,9 +748,32 @@ public:
                 GHI_DEBUG_LOG("Event: FETCH_CHUNK from %d", from);
                 fs_tmr.reset();
                 answerChunk();
-                GHI_DEBUG_LOG("Event: FETCH_FINISH from %d", from);
-                fetch.close();
+                if (fetch.isDone()) {
+                    GHI_DEBUG_LOG("Event: FETCH_FINISH from %d", from);
+                    fetch.close();
+                }
+                return;
+
+            case gyverhub::Command::QUERY: {
+                if (fetch.isActive()) {
+                    GHI_DEBUG_LOG("Event: FETCH_ERROR from %d (busy)", from);
+                    answerType(F("fetch_err"));
+                    return;
+                }
+
+                GHtsdb* db = GHtsdb::find(name);
+                if (!db || !_query(db, value) || !fetch.open(db)) {
+                    GHI_DEBUG_LOG("Event: FETCH_ERROR from %d (bad query)", from);
+                    answerType(F("fetch_err"));
+                    return;
+                }
+
+                GHI_DEBUG_LOG("Event: QUERY from %d", from);
+                fs_client = client;
+                fs_tmr.reset();
+                answerType(F("fetch_start"));
                 return;
+            }
 
             case gyverhub::Command::FETCH_STOP:
                 if (!fetch.isActive() || fs_client != client) {
@@ -664,15 +788,13 @@ public:
 #endif
 #if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_UPLOAD)
             case gyverhub::Command::UPLOAD:
-                if (fs_upload_file) {
+                if (fs_upload) {
                     GHI_DEBUG_LOG("Event: UPLOAD_ERROR from %d (busy)", from);
                     answerType(F("upload_err"));
                     return;
                 }
 
-                gyverhub::mkdirRecursive(name);
-                fs_upload_file = GHI_FS.open(name, "w");
-                if (!fs_upload_file) {
+                if (!fs_upload.open(name, value)) {
                     GHI_DEBUG_LOG("Event: UPLOAD_ERROR from %d (not found)", from);
                     answerType(F("upload_err"));
                     return;
@@ -686,7 +808,7 @@ public:
                 return;
 
             case gyverhub::Command::UPLOAD_CHUNK: {
-                if (!fs_upload_file || fs_upload_client != client) {
+                if (!fs_upload || fs_upload_client != client) {
                     GHI_DEBUG_LOG("Event: UPLOAD_ERROR from %d (closed or wrong clid)", from);
                     answerType(F("upload_err"));
                     return;
@@ -702,17 +824,21 @@ public:
                 GHI_DEBUG_LOG("Event: UPLOAD_CHUNK from %d", from);
                 size_t len;
                 uint8_t *data = gyverhub::base64Decode(value, strlen(value), len);
-
-                if (fs_upload_file.write(data, len) != len) {
-                    GHI_DEBUG_LOG("Event: UPLOAD_ERROR from %d (write failed)", from);
-                    fs_upload_file.close();
+                // пустой чанк - не ошибка, malloc(0) может вернуть nullptr
+                bool ok = (data || !len) && fs_upload.write(data, len);
+                free(data);
+                // последний чанк - дописать буфер, проверить CRC и заменить файл
+                if (ok && isLast) ok = fs_upload.close();
+
+                if (!ok) {
+                    GHI_DEBUG_LOG("Event: UPLOAD_ERROR from %d (write or crc failed)", from);
+                    fs_upload.abort();
                     answerType(F("upload_err"));
                     return;
                 }
 
                 if (isLast) {
                     GHI_DEBUG_LOG("Event: UPLOAD_FINISH from %d", from);
-                    fs_upload_file.close();
                     answerType(F("upload_end"));
                 } else {
                     fs_upload_tmr.reset();
@@ -934,10 +1060,14 @@ public:
             ota_f = false;
         }
 #endif
+#if GHC_FS != GHC_FS_NONE
+        gyverhub::fsIndex().apply();
+        GHlog::tickAll();
+#endif
 #if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_UPLOAD)
-        if (fs_upload_file && fs_upload_tmr.isTimedOut(GHC_CONN_TOUT * 1000ul)) {
+        if (fs_upload && fs_upload_tmr.isTimedOut(GHC_CONN_TOUT * 1000ul)) {
             GHI_DEBUG_LOG("Event: UPLOAD_ABORTED from %d", fs_upload_client.from);
-            fs_upload_file.close();
+            fs_upload.abort();
         }
 #endif
 #if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_FETCH)
@@ -1000,7 +1130,8 @@ public:
     }
 
     // ======================= UI ========================
-    void answerUI() {
+    // cached - хеш разметки, которая уже есть у клиента, page - страница меню
+    void answerUI(const char* cached = nullptr, uint8_t page = 0) {
         // TODO переделать
         // Хак для локальной функции
         static GyverHub *self;
@@ -1019,20 +1150,155 @@ public:
 #endif
 
         gyverhub::Json answ;
-        answ.reserve((chunked ? buf_size : gyverhub::Builder::buildCount(build_cb, *client_ptr)) + 100);
+        answ.reserve((chunked ? buf_size : gyverhub::Builder::buildCount(build_cb, *client_ptr, page)) + 100);
         answ.begin();
         answ.key(F("controls"));
         answ += '[';
-        gyverhub::Builder::buildUi(build_cb, &answ, *client_ptr, chunked ? buf_size : 0, L::_send1);
+        gyverhub::Builder::buildUi(build_cb, &answ, *client_ptr, chunked ? buf_size : 0, chunked ? L::_send1 : nullptr, page);
         if (answ[answ.length() - 1] == ',') answ[answ.length() - 1] = ']';  // ',' = ']'
         else answ += ']';
         answ += ',';
+        if (!chunked) {
+            uint32_t hash, cachedHash;
+            if (cached && gyverhub::parseUnsigned(cached, cachedHash) == gyverhub::ParseStatus::OK) {
+                // разметка у клиента та же - отправляем только значения
+                gyverhub::Json values;
+                values.reserve(answ.length() / 4);
+                values.begin();
+                values.key(F("values"));
+                values += '{';
+                gyverhub::Json windows;
+                hash = gyverhub::layoutHash(answ.c_str(), answ.length(), &values, &windows);
+                if (hash == cachedHash) {
+                    if (values[values.length() - 1] == ',') values[values.length() - 1] = '}';
+                    else values += '}';
+                    values += ',';
+                    if (windows.length()) {
+                        // окна строк TableView/LogView: "имя":{"total","offset","window"}
+                        values.key(F("windows"));
+                        values += '{';
+                        windows[windows.length() - 1] = '}';
+                        values += windows;
+                        values += ',';
+                    }
+                    values.itemInteger(F("hash"), hash);
+                    values.itemInteger(F("page"), page);
+                    values.appendId(id);
+                    values.itemString(F("type"), F("ui"));
+                    values.end();
+                    _answer(values);
+                    return;
+                }
+            } else {
+                hash = gyverhub::layoutHash(answ.c_str(), answ.length());
+            }
+            answ.itemInteger(F("hash"), hash);
+        }
+        answ.itemInteger(F("page"), page);
         answ.appendId(id);
         answ.itemString(F("type"), F("ui"));
         answ.end();
         _answer(answ);
     }
 
+    // ======================= ROWS ========================
+    // окно строк TableView/LogView, value - "offset,count"
+    void answerRows(const char* name, const char* value) {
+        const char* div = strchr(value, ',');
+        char buf[GHI_NUM_BUF];
+        uint32_t offset, count;
+        if (!build_cb || !div || (size_t) (div - value) >= sizeof(buf)) {
+            answerErr(F("Invalid value"));
+            return;
+        }
+        memcpy(buf, value, div - value);
+        buf[div - value] = '\0';
+        if (gyverhub::parseUnsigned(buf, offset) != gyverhub::ParseStatus::OK || offset > 0xffff ||
+            gyverhub::parseUnsigned(div + 1, count) != gyverhub::ParseStatus::OK || count > 0xffff) {
+            answerErr(F("Invalid value"));
+            return;
+        }
+
+        gyverhub::Json answ;
+        answ.reserve((count < GHC_WINDOW_MAX ? count : GHC_WINDOW_MAX) * 32 + 100);
+        answ.begin();
+        answ.appendId(id);
+        answ.itemString(F("type"), F("rows"));
+        answ.itemString(F("name"), name);
+        answ.key(F("value"));
+        answ += '\"';
+        uint16_t first = offset, total;
+        if (!gyverhub::Builder::buildWindow(build_cb, &answ, name, first, count, total)) {
+            answerErr(F("Not found"));
+            return;
+        }
+        answ += F("\",");
+        answ.itemInteger(F("offset"), first);
+        answ.itemInteger(F("total"), total);
+        answ.end();
+        _answer(answ);
+    }
+
+    // ======================= TAIL ========================
+    // дописанное в Log/Plot после seq из value (его знает клиент)
+    void answerTail(const char* name, const char* value) {
+        uint32_t since;
+        if (!build_cb || gyverhub::parseUnsigned(value, since) != gyverhub::ParseStatus::OK) {
+            answerErr(F("Invalid value"));
+            return;
+        }
+        // 0xffffffff - клиент не знает seq, отдаём всё (а не с прошлой рассылки)
+        if (since == gyverhub::Builder::TAIL_SENT) since--;
+        gyverhub::Json text;
+        gyverhub::Tail tail;
+        if (!gyverhub::Builder::buildTail(build_cb, &text, name, since, tail)) {
+            answerErr(F("Not found"));
+            return;
+        }
+        _answer(_tail(name, text.c_str(), text.length(), tail));
+    }
+
+    // ======================= PLOT ========================
+    // весь график, прорежённый до ширины из value (точек)
+    void answerPlot(const char* name, const char* value) {
+        uint32_t width;
+        if (!build_cb || gyverhub::parseUnsigned(value, width) != gyverhub::ParseStatus::OK || width < 3) {
+            answerErr(F("Invalid value"));
+            return;
+        }
+        if (width > GHC_PLOT_MAX) width = GHC_PLOT_MAX;
+        gyverhub::Json points;
+        gyverhub::Tail tail;
+        if (!gyverhub::Builder::buildPlot(build_cb, &points, name, width, tail)) {
+            answerErr(F("Not found"));
+            return;
+        }
+        _answer(_tail(name, points.c_str(), points.length(), tail));
+    }
+
+private:
+    // Log - строка в кавычках (type tail), Plot - массив отсчётов (type plot)
+    gyverhub::Json _tail(const char* name, const char* text, size_t len, const gyverhub::Tail& tail) {
+        gyverhub::Json answ;
+        answ.reserve(len + 100);
+        answ.begin();
+        answ.appendId(id);
+        answ.itemString(F("type"), tail.plot ? F("plot") : F("tail"));
+        answ.itemString(F("name"), name);
+        answ.key(F("value"));
+        if (!tail.plot) answ += '\"';
+        answ.appendRaw(text, len);
+        if (!tail.plot) answ += '\"';
+        answ += ',';
+        answ.itemInteger(F("from"), tail.from);
+        answ.itemInteger(F("seq"), tail.seq);
+        if (tail.plot) answ.itemInteger(F("min"), tail.min);
+        if (tail.reset) answ.itemInteger(F("reset"), 1);
+        answ.end();
+        return answ;
+    }
+public:
+
     // ======================= TYPE ========================
     void answerType(FSTR type = nullptr) {
         if (!type) type = F("OK");
@@ -1061,25 +1327,37 @@ public:
 #if GHC_FS != GHC_FS_NONE && (GHI_MOD_ENABLED(GH_MOD_FSBR) || GHI_MOD_ENABLED(GH_MOD_FORMAT) || GHI_MOD_ENABLED(GH_MOD_DELETE) || GHI_MOD_ENABLED(GH_MOD_RENAME))
 
     // ======================= FSBR ========================
-    void answerFsbr() {
+    // список файлов: без параметров весь, с параметрами - страница не больше q.limit записей,
+    // остальное по курсору next
+    void answerFsbr(const gyverhub::FsQuery& q = gyverhub::FsQuery()) {
+        gyverhub::FsIndex& index = gyverhub::fsIndex();
+        index.apply();
+        if (!index.built()) index.build();
+
+        // страница - по средней длине записи, весь список - по длине индекса
+        size_t size = index.jsonLength();
+        if (q.limit && index.count() > q.limit) size = (size / index.count() + 1) * q.limit;
         gyverhub::Json answ;
-        answ.reserve(100);
-        
-        uint16_t count = 0;
-        GH_showFiles(answ, &count);
-
-        answ.clear();
-        answ.reserve(count + 50);
+        answ.reserve(size + 200);
         answ.begin();
         answ.key(F("fs"));
         answ += '{';
-        answ.itemInteger(F("/"), 0);
-        GH_showFiles(answ);
-        answ[answ.length() - 1] = '}';  // ',' = '}'
+        // сама папка - только на первой странице
+        if (!q.offset && !(q.cursor && *q.cursor) && !(q.glob && *q.glob)) {
+            answ += '"';
+            answ.appendEscaped(q.dir);
+            answ += F("\":0,");
+        }
+        String next;
+        uint32_t count = index.write(answ, q, next);
+        if (answ[answ.length() - 1] == ',') answ[answ.length() - 1] = '}';
+        else answ += '}';
         answ += ',';
 
         answ.appendId(id);
         answ.itemString(F("type"), F("fsbr"));
+        answ.itemInteger(F("count"), count);
+        if (next.length()) answ.itemString(F("next"), next);
 
 #ifdef ESP8266
         FSInfo fs_info;
@@ -1094,6 +1372,63 @@ public:
         _answer(answ);
     }
 
+private:
+    // ответ на изменение ФС - первая страница списка, остальные клиент возьмёт по next
+    void _answerFsbrPage() {
+        gyverhub::FsQuery q;
+        q.limit = GHC_FSBR_LIMIT;
+        answerFsbr(q);
+    }
+
+#if GHI_MOD_ENABLED(GH_MOD_FSBR)
+    // fsbr с параметрами: name - папка, value - "сортировка,с,сколько,маска", любые можно опустить.
+    // "с" - число записей для пропуска или курсор next из прошлого ответа
+    void _fsbr(const char* name, const char* value) {
+        gyverhub::FsQuery q;
+        char* args = strdup(value ? value : "");
+        if (!args) {
+            answerErr(F("No memory"));
+            return;
+        }
+        char* part[4] = {args, nullptr, nullptr, nullptr};
+        for (uint8_t i = 1; i < 4; i++) {
+            char* div = strchr(part[i - 1], ',');
+            if (!div) break;
+            *div = '\0';
+            part[i] = div + 1;  // маска - до конца строки, может содержать запятые
+        }
+
+        bool ok = true;
+        if (*part[0]) {
+            q.sort = part[0][0];
+            ok = !part[0][1] && strchr("nNsS", q.sort);
+        }
+        // страницами - только если запрошены "с" или "сколько", иначе весь список
+        if ((part[1] && *part[1]) || (part[2] && *part[2])) q.limit = GHC_FSBR_LIMIT;
+        if (ok && part[1] && *part[1]) {
+            if (gyverhub::parseUnsigned(part[1], q.offset) != gyverhub::ParseStatus::OK) {
+                q.offset = 0;
+                q.cursor = part[1];
+            }
+        }
+        if (ok && part[2] && *part[2]) {
+            uint32_t limit;
+            ok = gyverhub::parseUnsigned(part[2], limit) == gyverhub::ParseStatus::OK && limit;
+            if (ok && limit < q.limit) q.limit = limit;
+        }
+        if (part[3] && *part[3]) q.glob = part[3];
+        // папка в индексе - с '/' на конце
+        String dir(name && *name ? name : "/");
+        if (dir[dir.length() - 1] != '/') dir += '/';
+        q.dir = dir.c_str();
+
+        if (ok) answerFsbr(q);
+        else answerErr(F("Invalid value"));
+        free(args);
+    }
+#endif
+
+public:
 #endif
 
     // ======================= DISCOVER ========================
@@ -1108,12 +1443,21 @@ public:
         answ.itemInteger(F("PIN"), pinHash);
         answ.itemString(F("version"), version);
         answ.itemInteger(F("max_upl"), GHC_UPLOAD_CHUNK_SIZE);
+#if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_UPLOAD)
+        answ.itemString(F("digest"), F("crc32"));
+#endif
+#if GHC_FS != GHC_FS_NONE && GHI_MOD_ENABLED(GH_MOD_FSBR)
+        answ.itemInteger(F("fsbr_limit"), GHC_FSBR_LIMIT);
+#endif
 #ifdef ATOMIC_FS_UPDATE
         answ.itemString(F("ota_t"), F("gz"));
 #else
         answ.itemString(F("ota_t"), F("bin"));
 #endif
         answ.itemInteger(F("modules"), GHC_MODS_DISABLED);
+#if GHC_MQTT_CBOR
+        answ.itemInteger(F("cbor"), 1);
+#endif
         answ.end();
         _answer(answ);
     }
@@ -1123,7 +1467,7 @@ public:
     // ======================= CHUNK ========================
     void answerChunk() {
         gyverhub::Json answ;
-        answ.reserve(GHC_FETCH_CHUNK_SIZE + 100);
+        answ.reserve(GHI_FETCH_CHUNK / 3 * 4 + 100);
         answ.begin();
         answ.appendId(id);
         fetch.nextChunk(answ);
@@ -1131,6 +1475,26 @@ public:
         _answer(answ);
     }
 
+    // value запроса query: "from,to[,points]"
+    static bool _query(GHtsdb* db, const char* value) {
+        uint32_t arg[3] = {0, 0, GHC_PLOT_WIDTH};
+        char buf[GHI_NUM_BUF];
+        for (uint8_t i = 0; i < 3; i++) {
+            const char* div = strchr(value, ',');
+            size_t len = div ? (size_t)(div - value) : strlen(value);
+            if (len >= sizeof(buf)) return false;
+            memcpy(buf, value, len);
+            buf[len] = '\0';
+            if (gyverhub::parseUnsigned(buf, arg[i]) != gyverhub::ParseStatus::OK) return false;
+            if (!div) {
+                if (!i) return false;
+                break;
+            }
+            value = div + 1;
+        }
+        return db->query(arg[0], arg[1], arg[2]);
+    }
+
 #endif
 
     // ======================= ANSWER ========================
@@ -1144,6 +1508,9 @@ public:
 #endif
 #if GHC_MQTT_IMPL != GHC_IMPL_NONE
             case gyverhub::ConnectionType::MQTT:
+#if GHC_MQTT_CBOR
+                if (_sendCborMQTT(answ, client_ptr->id)) break;
+#endif
                 answerMQTT(answ, client_ptr->id);
                 break;
 #endif
@@ -1179,10 +1546,42 @@ public:
         if (focused(gyverhub::ConnectionType::WEBSOCKET)) sendWS(answ);
 #endif
 #if GHC_MQTT_IMPL != GHC_IMPL_NONE
+        // общий топик читают все клиенты, поэтому всегда JSON
         if (focused(gyverhub::ConnectionType::MQTT) || broadcast) sendMQTT(answ);
 #endif
     }
 
+#if GHC_MQTT_CBOR
+    // отправить клиенту в CBOR, если он его запросил
+    bool _sendCborMQTT(const String& answ, const char* hubID) {
+        if (!_findCbor(hubID)) return false;
+        gyverhub::Cbor cbor;
+        if (!cbor.fromJson(answ.c_str(), answ.length())) return false;  // отправится JSON
+        answerMQTT(cbor, hubID);
+        return true;
+    }
+
+    char* _findCbor(const char* hubID) {
+        if (!*hubID) return nullptr;
+        for (uint8_t i = 0; i < GHC_MQTT_CBOR_CLIENTS; i++) {
+            if (!strcmp(cbor_ids[i], hubID)) return cbor_ids[i];
+        }
+        return nullptr;
+    }
+
+    // запомнить выбор клиента из discover. Список полон - вытесняется самый старый
+    void _setCbor(const char* hubID, bool cbor) {
+        char* slot = _findCbor(hubID);
+        if (!cbor) {
+            if (slot) *slot = '\0';
+            return;
+        }
+        if (slot || !*hubID) return;
+        strcpy(cbor_ids[cbor_next], hubID);
+        if (++cbor_next >= GHC_MQTT_CBOR_CLIENTS) cbor_next = 0;
+    }
+#endif
+
     // ========================== MISC ==========================
     void setFocus(gyverhub::ConnectionType from) {
         focus_arr[static_cast<size_t>(from)] = GHC_CONN_TOUT;
@@ -1215,6 +1614,10 @@ public:
     uint16_t focus_tmr = 0;
     int8_t focus_arr[gyverhub::ConnectionTypeCount] = {};
     bool autoUpd_f = true;
+#if GHC_MQTT_CBOR
+    char cbor_ids[GHC_MQTT_CBOR_CLIENTS][9] = {};  // id клиентов, запросивших CBOR
+    uint8_t cbor_next = 0;
+#endif
 
 #if GHI_ESP_BUILD
     void (*reboot_cb)(gyverhub::RebootReason r) = nullptr;
@@ -1237,7 +1640,7 @@ public:
     // upload
     GHclient fs_upload_client;
     gyverhub::Timer fs_upload_tmr {};
-    File fs_upload_file;
+    gyverhub::Upload fs_upload;
     // fetch
     GHclient fs_client;
     gyverhub::Timer fs_tmr {};
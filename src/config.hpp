@@ -25,21 +25,89 @@
 // период переподключения MQTT
 #define GHC_MQTT_RECONNECT 10000
 
+/**
+ * Бинарный формат (CBOR) для MQTT-клиентов, запросивших его в discover.
+ * Ответы собираются в JSON и перекодируются перед отправкой.
+ */
+#define GHC_MQTT_CBOR 1
+
+// сколько MQTT-клиентов с CBOR помнить, 9 байт на клиента. Общий топик (broadcast) - всегда JSON
+#define GHC_MQTT_CBOR_CLIENTS 4
+
+/**
+ * Бинарные команды холста (Canvas): байт команды и аргументы varint вместо текста.
+ * В JSON передаются строками base64, для CBOR-клиентов - байтовыми строками.
+ */
+#define GHC_CANVAS_BINARY 1
+
+// сколько слоёв холста (Canvas::beginLayer) помнить на устройстве, 8 байт на слой
+#define GHC_CANVAS_LAYERS 4
+
+// максимум строк Table/Log в одном окне (TableView, LogView)
+#define GHC_WINDOW_MAX 50
+
+// точек графика Plot, пока клиент не сообщил свою ширину, и максимум точек в ответе
+#define GHC_PLOT_WIDTH 300
+#define GHC_PLOT_MAX 1000
+
+// размер блока записи лога в файл (GHlog::spill), байт. Кратно странице флеш
+#define GHC_LOG_BLOCK 256
+
+// период сброса файла лога на флеш, мс. Ещё сбрасывается при ротации и в GHlog::flush()
+#define GHC_LOG_SYNC_MS 5000
+
+// хранилище временных рядов GHtsdb: буфер записи (страница флеш) и размер файла-сегмента, байт
+#define GHC_TS_PAGE 256
+#define GHC_TS_SEGMENT 4096
+
 // размер чанка при скачивании с платы
 #define GHC_FETCH_CHUNK_SIZE 512
 
 // размер чанка при загрузке на плату
 #define GHC_UPLOAD_CHUNK_SIZE 200
 
+// буфер записи загружаемых файлов, байт: кратно странице флеша (4096), 0 - писать сразу
+#define GHC_UPLOAD_BUFFER 4096
+
+// окно сжатия gzip при отдаче текстовых файлов, байт: степень двойки 512..16384,
+// памяти на время отдачи - около 5 окон. 0 - не сжимать
+#define GHC_GZIP_WINDOW 1024
+
+// скачивание (fetch) сжимается, только если файл не больше, байт: число чанков нужно заранее,
+// и файл сжимается вхолостую целиком прямо в обработчике запроса. 0 - не сжимать fetch
+#define GHC_GZIP_FETCH_MAX 16384
+
+// максимум записей в странице fsbr с параметрами, дальше - по курсору next. fsbr без параметров - весь список
+#define GHC_FSBR_LIMIT 64
+
 // глубина сканирования файловой системы (esp32)
 #define GHC_FS_MAX_DEPTH 5
 
 // период кеширования файлов для портала
 #define GHC_PORTAL_CACHE "max-age=604800"
 
+// встроенный портал ещё и в brotli (+~42 кБ флеша, на 12% меньше gzip), отдаётся клиентам
+// с br в Accept-Encoding. Браузеры просят br только по HTTPS. 0 - только gzip
+#define GHC_PORTAL_BROTLI 1
+
 // http порт
 #define GHC_HTTP_PORT 80
 
+// синхронный HTTP сервер: одновременных отдач файлов в фоне, больше - отдаются сразу целиком
+#define GHC_HTTP_STREAMS 4
+
+// за один tick() отдачи в фоне отправляют не больше байт и мс (на все вместе)
+#define GHC_HTTP_TICK_BYTES 4096
+#define GHC_HTTP_TICK_MS 5
+
+// клиент не принимает данные дольше, мс - отдача прерывается
+#define GHC_HTTP_STALL_MS 10000
+
+// нативный HTTP сервер: буферов для отдачи и приёма файлов и их размер, байт. Столько
+// запросов с файлами обрабатывается одновременно, остальные получают 503
+#define GHC_HTTP_BUFFERS 2
+#define GHC_HTTP_BUFFER_SIZE 4096
+
 // websocket порт
 #define GHC_WS_PORT 81
 
@@ -1,42 +1,52 @@
 /*****************************************************************************
  ***                        DO NOT EDIT THIS FILE !                        ***
  *****************************************************************************
- * This file is generated by build.py for version 0.50b at 08.09.2023 20:02:36
+ * This file is generated by build.py for version 0.54b at 19.10.2026 12:54:01
  */
 #include "hub/portal.h"
 
-const size_t gyverhub::portal::index_size = 375;
+const size_t gyverhub::portal::index_size = 372;
+const char gyverhub::portal::index_etag[] = "\"1aad2f23\"";
+const char gyverhub::portal::index_head[] PROGMEM =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/html\r\n"
+        "Content-Encoding: gzip\r\n"
+        "Content-Length: 372\r\n"
+        "Vary: Accept-Encoding\r\n"
+        "ETag: \"1aad2f23\"\r\n"
+        "Cache-Control: " GHC_PORTAL_CACHE "\r\n"
+        GHI_HTTP_CORS
+        "\r\n";
 const uint8_t gyverhub::portal::index[] PROGMEM = {
-        0x1F, 0x8B, 0x08, 0x08, 0xAC, 0x53, 0xFB, 0x64, 0x02, 0xFF, 0x69, 0x6E,
+        0x1F, 0x8B, 0x08, 0x08, 0xE9, 0x12, 0xD6, 0x6A, 0x02, 0xFF, 0x69, 0x6E,
         0x64, 0x65, 0x78, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x00, 0x7D, 0x92, 0x4D,
-        0x4F, 0xC3, 0x30, 0x0C, 0x86, 0xEF, 0x48, 0xFC, 0x07, 0x93, 0x13, 0x48,
-        0x6C, 0xE5, 0x43, 0xA0, 0x1D, 0xDA, 0x21, 0x34, 0x06, 0xDC, 0x98, 0xC4,
-        0x10, 0xE2, 0x84, 0xB2, 0xD4, 0x50, 0x8F, 0x34, 0x99, 0x12, 0xAF, 0x63,
-        0xFC, 0x7A, 0x92, 0xA6, 0x30, 0x04, 0x62, 0x27, 0xBF, 0x76, 0x1E, 0xBF,
-        0xB2, 0xAD, 0xE4, 0x7B, 0x57, 0x77, 0xA3, 0xE9, 0xD3, 0x64, 0x0C, 0x15,
-        0xD7, 0x7A, 0xB8, 0xBB, 0x93, 0xC7, 0x08, 0x5A, 0x9A, 0xD7, 0x42, 0xA0,
-        0x11, 0x6D, 0x05, 0x65, 0x19, 0x22, 0x40, 0x5E, 0x23, 0x4B, 0x50, 0x95,
-        0x74, 0x1E, 0xB9, 0x10, 0x0F, 0xD3, 0xEB, 0xDE, 0x40, 0xA4, 0x17, 0x26,
-        0xD6, 0x38, 0xBC, 0x59, 0x37, 0xE8, 0x6E, 0x97, 0x33, 0x68, 0x8E, 0xFA,
-        0x67, 0x47, 0xB3, 0x3C, 0x4B, 0xE5, 0x4D, 0xAF, 0x91, 0x35, 0x16, 0xA2,
-        0x44, 0xAF, 0x1C, 0x2D, 0x98, 0xAC, 0x11, 0xA0, 0xAC, 0x61, 0x34, 0xC1,
-        0xEE, 0xD2, 0x95, 0x4B, 0x32, 0x36, 0x1B, 0xDF, 0x4F, 0x06, 0x27, 0xE7,
-        0xE7, 0x31, 0x9E, 0x9E, 0xC0, 0x23, 0xCE, 0x60, 0x14, 0x10, 0x67, 0x35,
-        0x4C, 0xA4, 0x41, 0x2D, 0xFE, 0xD8, 0x35, 0x84, 0xAB, 0x85, 0x75, 0xFC,
-        0xC3, 0x6B, 0x45, 0x25, 0x57, 0x45, 0x89, 0x0D, 0x29, 0xEC, 0xB5, 0xC9,
-        0x21, 0x90, 0x21, 0x26, 0xA9, 0x7B, 0x5E, 0x49, 0x8D, 0xC5, 0xF1, 0x21,
-        0xD4, 0xF2, 0x9D, 0xEA, 0x65, 0xFD, 0x55, 0xE8, 0x8C, 0xD3, 0x68, 0xE0,
-        0x9D, 0x2A, 0x44, 0xD2, 0xFD, 0xB9, 0xBF, 0x68, 0xF7, 0x29, 0xC4, 0x30,
-        0xCF, 0x52, 0x2D, 0xB1, 0x9A, 0xCC, 0x1B, 0x54, 0x0E, 0x5F, 0x02, 0xCA,
-        0x6B, 0x8D, 0x7D, 0xE5, 0xBF, 0x51, 0x70, 0xA8, 0xBB, 0xB2, 0xAF, 0x10,
-        0xB9, 0x3D, 0x65, 0xD6, 0xDD, 0x32, 0x9F, 0xD9, 0x72, 0x0D, 0xD6, 0x38,
-        0xF4, 0xF4, 0x11, 0x56, 0x48, 0xF1, 0xB9, 0xDA, 0x3F, 0xE8, 0xA6, 0x28,
-        0xA9, 0x01, 0x2A, 0x0B, 0x61, 0x2C, 0x87, 0x15, 0xC2, 0x66, 0x5A, 0x7A,
-        0xFF, 0x9D, 0x86, 0x31, 0x02, 0xB0, 0x21, 0xBB, 0xD7, 0x68, 0x2E, 0xDA,
-        0xB6, 0xA8, 0x9E, 0xE3, 0x35, 0xFE, 0x43, 0x19, 0x3D, 0x27, 0x34, 0xAA,
-        0xAD, 0xE8, 0xC2, 0xD9, 0x39, 0x2A, 0xF6, 0x09, 0xFF, 0xCA, 0xB6, 0xB6,
-        0xD4, 0x92, 0x4C, 0xC2, 0xA3, 0xDA, 0x8A, 0x2A, 0x4D, 0x89, 0x0C, 0x62,
-        0x2B, 0xF8, 0x62, 0x2D, 0xA3, 0x4B, 0x6C, 0xD2, 0xBF, 0xF0, 0x3C, 0x8B,
-        0x47, 0x4D, 0x57, 0x8E, 0x7F, 0xF9, 0x13, 0x72, 0x25, 0xAA, 0x01, 0xDB,
-        0x02, 0x00, 0x00
+        0x4F, 0x02, 0x31, 0x10, 0x86, 0xEF, 0xFC, 0x8A, 0xB1, 0x27, 0x4D, 0x80,
+        0xF5, 0x93, 0x70, 0xD8, 0xC5, 0x18, 0x44, 0xBD, 0x49, 0x22, 0xC6, 0x78,
+        0x32, 0xA5, 0x3B, 0xB8, 0x83, 0xDD, 0x96, 0xB4, 0xC3, 0x2A, 0xFE, 0x7A,
+        0xDB, 0x2D, 0x12, 0x35, 0x91, 0xD3, 0xBC, 0x33, 0x7D, 0xE6, 0xCD, 0xCC,
+        0xA4, 0xF9, 0xC1, 0xF5, 0xFD, 0x78, 0xF6, 0x3C, 0x9D, 0x40, 0xC5, 0xB5,
+        0x1E, 0x75, 0xF2, 0x18, 0x40, 0x4B, 0xF3, 0x5A, 0x08, 0x34, 0x22, 0x16,
+        0x50, 0x96, 0xA3, 0x0E, 0x40, 0x5E, 0x23, 0x4B, 0x50, 0x95, 0x74, 0x1E,
+        0xB9, 0x10, 0x8F, 0xB3, 0x9B, 0xDE, 0x50, 0xB4, 0x0F, 0x4C, 0xAC, 0x71,
+        0x74, 0xBB, 0x69, 0xD0, 0xDD, 0xAD, 0xE7, 0xD0, 0x1C, 0xF7, 0x2F, 0xCE,
+        0xE7, 0x79, 0x96, 0xCA, 0xBB, 0x4E, 0x23, 0x6B, 0x2C, 0x44, 0x89, 0x5E,
+        0x39, 0x5A, 0x31, 0x59, 0x23, 0x40, 0x59, 0xC3, 0x68, 0x82, 0xD9, 0x95,
+        0x2B, 0xD7, 0x64, 0x6C, 0x36, 0x79, 0x98, 0x0E, 0x4F, 0x07, 0x83, 0x18,
+        0xCF, 0x4E, 0xE1, 0x09, 0xE7, 0x30, 0x0E, 0x88, 0xB3, 0x1A, 0xA6, 0xD2,
+        0xA0, 0x16, 0x7F, 0xDD, 0x1A, 0xC2, 0xF7, 0x95, 0x75, 0xFC, 0xC3, 0xEA,
+        0x9D, 0x4A, 0xAE, 0x8A, 0x12, 0x1B, 0x52, 0xD8, 0x6B, 0x93, 0x2E, 0x90,
+        0x21, 0x26, 0xA9, 0x7B, 0x5E, 0x49, 0x8D, 0xC5, 0x49, 0x17, 0x6A, 0xF9,
+        0x41, 0xF5, 0xBA, 0xFE, 0x2E, 0x24, 0xDF, 0x34, 0x18, 0x78, 0xA7, 0x0A,
+        0x91, 0x74, 0x7F, 0xE9, 0x2F, 0xDB, 0x65, 0x0A, 0x31, 0xCA, 0xB3, 0x54,
+        0x6B, 0x51, 0x4D, 0xE6, 0x0D, 0x2A, 0x87, 0x8B, 0x40, 0xF2, 0x46, 0x63,
+        0x5F, 0xF9, 0x1D, 0x09, 0x0E, 0xF5, 0xB6, 0xEC, 0x2B, 0x44, 0x8E, 0x37,
+        0xCC, 0xD2, 0x11, 0xF3, 0xB9, 0x2D, 0x37, 0x60, 0x8D, 0x43, 0x4F, 0x9F,
+        0x61, 0xFC, 0x14, 0x5F, 0xAA, 0xC3, 0xA3, 0x34, 0x41, 0x49, 0x0D, 0x50,
+        0x59, 0x08, 0x63, 0x39, 0x4C, 0x1F, 0x96, 0xD2, 0xD2, 0xFB, 0x5D, 0x1A,
+        0x46, 0x08, 0xC0, 0x0E, 0xDC, 0x3E, 0x46, 0x67, 0xD1, 0x76, 0x45, 0xF5,
+        0x12, 0xEF, 0xF0, 0x0F, 0xC9, 0xE8, 0x39, 0x91, 0x51, 0xED, 0x23, 0x57,
+        0xCE, 0x2E, 0x51, 0xB1, 0x4F, 0xF4, 0x77, 0xB6, 0xAF, 0xA3, 0x96, 0x64,
+        0x12, 0x1D, 0xD5, 0x3E, 0x52, 0x69, 0x4A, 0x60, 0x10, 0xFB, 0xB8, 0x85,
+        0xB5, 0x8C, 0x2E, 0xA1, 0x49, 0xFF, 0xA6, 0xF3, 0x2C, 0x1E, 0xB3, 0xBD,
+        0x6D, 0xFC, 0xB8, 0x5F, 0xD2, 0xBB, 0x80, 0x37, 0xC8, 0x02, 0x00, 0x00,
 };
@@ -0,0 +1,42 @@
+/*****************************************************************************
+ ***                        DO NOT EDIT THIS FILE !                        ***
+ *****************************************************************************
+ * This file is generated by build.py for version 0.54b at 19.10.2026 12:54:01
+ */
+#include "hub/portal.h"
+
+const size_t gyverhub::portal::index_br_size = 247;
+const char gyverhub::portal::index_br_etag[] = "\"c026bd36\"";
+const char gyverhub::portal::index_br_head[] PROGMEM =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/html\r\n"
+        "Content-Encoding: br\r\n"
+        "Content-Length: 247\r\n"
+        "Vary: Accept-Encoding\r\n"
+        "ETag: \"c026bd36\"\r\n"
+        "Cache-Control: " GHC_PORTAL_CACHE "\r\n"
+        GHI_HTTP_CORS
+        "\r\n";
+const uint8_t gyverhub::portal::index_br[] PROGMEM = {
+        0x1B, 0xC7, 0x02, 0x20, 0xAC, 0x0E, 0x6C, 0x37, 0x9C, 0x0D, 0x2C, 0xDC,
+        0x21, 0x7A, 0x36, 0x90, 0x75, 0x25, 0xF9, 0xD4, 0x77, 0x50, 0x6F, 0xDB,
+        0xBA, 0xF2, 0x85, 0x40, 0xC2, 0xE7, 0xE8, 0x75, 0x5E, 0x90, 0x39, 0x3C,
+        0x05, 0x66, 0xE9, 0xC9, 0x52, 0x7D, 0x55, 0x8C, 0x20, 0x44, 0x53, 0xFA,
+        0x93, 0x44, 0x22, 0x7D, 0xAE, 0xF2, 0x6A, 0x4A, 0x2E, 0xCB, 0x50, 0xD8,
+        0x72, 0x06, 0x07, 0x0A, 0xFE, 0xFD, 0xBF, 0x91, 0x07, 0x84, 0xAF, 0xBB,
+        0x65, 0x01, 0x75, 0xA2, 0x0F, 0x9A, 0xAF, 0x6D, 0x54, 0x01, 0x86, 0x94,
+        0x64, 0x73, 0x6D, 0x3A, 0x1E, 0xBD, 0x13, 0x02, 0x4A, 0xBD, 0xD9, 0xCC,
+        0xB0, 0x71, 0x0A, 0xF1, 0x0B, 0xAB, 0x37, 0xCF, 0x03, 0xCC, 0x18, 0xE8,
+        0x5B, 0x5D, 0x33, 0x8F, 0x7F, 0xF5, 0xB7, 0xE8, 0x47, 0x78, 0xD3, 0xA8,
+        0xB3, 0x8A, 0x49, 0xD3, 0x35, 0xEE, 0xF9, 0xD5, 0xAE, 0xE7, 0xFB, 0x94,
+        0x74, 0xC4, 0x5C, 0x3C, 0x20, 0x08, 0x3F, 0xBA, 0xD8, 0xDE, 0x79, 0x99,
+        0x43, 0xC7, 0x65, 0x3C, 0x80, 0xF5, 0x29, 0xCA, 0xD1, 0xDA, 0x16, 0x2C,
+        0xED, 0xE2, 0x08, 0x35, 0x97, 0xE1, 0xBA, 0x5A, 0x24, 0x81, 0x15, 0xC4,
+        0xE6, 0xFA, 0xDC, 0xCA, 0x8F, 0x16, 0xD2, 0x2E, 0x42, 0x2A, 0x42, 0x10,
+        0x8A, 0x51, 0x39, 0xCD, 0xBD, 0x30, 0x46, 0x8D, 0x9D, 0x30, 0xA8, 0x53,
+        0x1C, 0xA3, 0x93, 0x87, 0x70, 0xD4, 0xD3, 0xEB, 0x4B, 0x8F, 0x99, 0x24,
+        0x0C, 0x57, 0xC5, 0x9A, 0x27, 0x18, 0x13, 0xE3, 0x5B, 0xE7, 0x77, 0x94,
+        0xA7, 0x74, 0x93, 0xD4, 0x4E, 0x8E, 0x3F, 0x0C, 0x5C, 0xD0, 0x36, 0x12,
+        0x1C, 0x95, 0x61, 0xDA, 0xCA, 0x9B, 0xEE, 0xF4, 0x5A, 0x77, 0x62, 0xDC,
+        0x41, 0x1B, 0x36, 0x31, 0xC8, 0x60, 0x0E
+};
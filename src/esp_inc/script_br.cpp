@@ -0,0 +1,2886 @@
+/*****************************************************************************
+ ***                        DO NOT EDIT THIS FILE !                        ***
+ *****************************************************************************
+ * This file is generated by build.py for version 0.54b at 19.10.2026 12:54:01
+ */
+#include "hub/portal.h"
+
+const size_t gyverhub::portal::script_br_size = 34379;
+const char gyverhub::portal::script_br_etag[] = "\"c52312e0\"";
+const char gyverhub::portal::script_br_head[] PROGMEM =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/javascript\r\n"
+        "Content-Encoding: br\r\n"
+        "Content-Length: 34379\r\n"
+        "Vary: Accept-Encoding\r\n"
+        "ETag: \"c52312e0\"\r\n"
+        "Cache-Control: " GHC_PORTAL_CACHE "\r\n"
+        GHI_HTTP_CORS
+        "\r\n";
+const uint8_t gyverhub::portal::script_br[] PROGMEM = {
+        0x5B, 0xE0, 0x34, 0x32, 0x1A, 0x19, 0xC3, 0xC6, 0x01, 0x30, 0xC8, 0x7A,
+        0x31, 0x47, 0x91, 0xC7, 0x81, 0x50, 0x70, 0x5F, 0xA4, 0x66, 0x07, 0x6A,
+        0xD8, 0x38, 0x00, 0x83, 0xE7, 0x72, 0x01, 0x40, 0xBD, 0x0E, 0x37, 0xC6,
+        0x20, 0x10, 0xB3, 0xFB, 0x49, 0xA4, 0x95, 0xCB, 0x46, 0x7A, 0xAB, 0x6B,
+        0x70, 0x86, 0x8B, 0x62, 0x7E, 0x5A, 0x55, 0x94, 0x50, 0x63, 0x6F, 0xE3,
+        0xCA, 0xFC, 0xE2, 0x66, 0x15, 0x1E, 0xD4, 0x62, 0x72, 0x3F, 0xAE, 0xDB,
+        0xBC, 0xD9, 0xA6, 0x82, 0xE8, 0x91, 0x49, 0xF0, 0xD5, 0x61, 0xE1, 0xD7,
+        0x8B, 0xCE, 0x2A, 0x34, 0xA4, 0x2B, 0x44, 0x29, 0xFA, 0x1E, 0x0A, 0x17,
+        0x8D, 0xB9, 0x77, 0xA1, 0x22, 0x51, 0x4F, 0xEF, 0xD3, 0xC6, 0x67, 0x24,
+        0x46, 0xB0, 0x08, 0x6C, 0xDC, 0xC4, 0x58, 0x72, 0xF2, 0x52, 0xFF, 0x33,
+        0x9B, 0x75, 0x9F, 0xCB, 0xC9, 0x56, 0xB9, 0x78, 0x52, 0x36, 0x7F, 0xC9,
+        0x90, 0xDD, 0x74, 0xEF, 0xB7, 0xD9, 0x56, 0x93, 0x1E, 0x81, 0x10, 0xF0,
+        0x59, 0x4C, 0xCA, 0x36, 0x76, 0x52, 0x8A, 0x7A, 0x70, 0x5E, 0xC8, 0x75,
+        0xBE, 0x15, 0x21, 0xDE, 0x2F, 0x35, 0xFF, 0x74, 0xED, 0x03, 0x8E, 0x57,
+        0x1B, 0x06, 0x69, 0xDB, 0x61, 0xF2, 0x4B, 0x2B, 0xA9, 0x80, 0x40, 0xE2,
+        0x47, 0x96, 0x78, 0xC5, 0x36, 0xCA, 0xB2, 0x87, 0xCB, 0xE1, 0x27, 0xC8,
+        0xCE, 0x9E, 0xFD, 0xAB, 0xAA, 0x3B, 0x96, 0x89, 0xA6, 0x6C, 0xC3, 0x07,
+        0x7C, 0x41, 0x2E, 0x95, 0x67, 0x08, 0x29, 0xAD, 0x31, 0x8F, 0xA9, 0x75,
+        0x4A, 0xDE, 0xE9, 0x0F, 0xE3, 0x6C, 0xEB, 0xD5, 0xE5, 0xF7, 0x69, 0x2A,
+        0x1D, 0xEA, 0x26, 0x3B, 0x21, 0x5A, 0xBD, 0x28, 0x80, 0x6C, 0x1F, 0xB1,
+        0x9C, 0x7C, 0x74, 0x51, 0xD6, 0x86, 0xFF, 0x2C, 0xD3, 0x3C, 0x5D, 0x2D,
+        0x62, 0xAC, 0xE9, 0x4F, 0x3E, 0x36, 0xED, 0x0C, 0x64, 0x04, 0x45, 0x95,
+        0x1A, 0x73, 0x0F, 0x72, 0xB8, 0x30, 0x3D, 0x3B, 0x9D, 0x91, 0x37, 0x19,
+        0xA6, 0xB2, 0x8A, 0x65, 0x35, 0x5F, 0xDF, 0xAA, 0xFD, 0x8E, 0x78, 0xA5,
+        0x15, 0x5A, 0x0E, 0x0E, 0x78, 0x0F, 0x3B, 0x17, 0xAD, 0x3B, 0x0F, 0x9E,
+        0x51, 0xAC, 0xED, 0xFC, 0xA3, 0x25, 0x73, 0x3A, 0x59, 0x3B, 0x22, 0x59,
+        0xE2, 0xFB, 0xA4, 0x72, 0xF9, 0xA5, 0x2F, 0x4A, 0xBB, 0x01, 0xFA, 0xE5,
+        0xAB, 0xDA, 0xD7, 0x2F, 0xAD, 0x14, 0x12, 0x11, 0xC5, 0x5C, 0xA9, 0xF4,
+        0xC1, 0x4A, 0xA9, 0x5F, 0xAD, 0x79, 0x3C, 0x3C, 0x81, 0x2B, 0x32, 0x1C,
+        0x2F, 0x9E, 0x36, 0x8B, 0xA5, 0x04, 0x17, 0x5D, 0xBE, 0xCD, 0xFA, 0xAF,
+        0x5F, 0x5B, 0xA9, 0xB2, 0xBA, 0x51, 0xDB, 0x64, 0x66, 0xF6, 0x94, 0xD3,
+        0xB8, 0x48, 0x26, 0x99, 0x2B, 0x07, 0x95, 0x30, 0xA7, 0xD7, 0xAB, 0x88,
+        0x58, 0x18, 0x67, 0x3C, 0x88, 0x42, 0x86, 0xB7, 0x29, 0xF0, 0xF3, 0x7B,
+        0xD3, 0xD9, 0xE9, 0x9A, 0xEE, 0x95, 0x29, 0x5B, 0x3A, 0x30, 0x69, 0x97,
+        0x6B, 0x1F, 0xE0, 0xB3, 0x9A, 0xF7, 0x4C, 0x3E, 0xD1, 0x48, 0xB6, 0x9C,
+        0x64, 0x83, 0xC5, 0xAC, 0x4C, 0xED, 0x9F, 0xCF, 0xCB, 0x44, 0x54, 0xC9,
+        0x30, 0x87, 0xCC, 0xA1, 0xB2, 0x7B, 0x33, 0xC7, 0xF5, 0xDA, 0xBD, 0x7F,
+        0x4B, 0x5F, 0x63, 0x0A, 0x96, 0xA6, 0x32, 0x06, 0x58, 0x40, 0x53, 0x2E,
+        0xD5, 0x58, 0xEB, 0x7F, 0xDF, 0x5B, 0x6A, 0xCD, 0xF8, 0x2C, 0x90, 0x20,
+        0x45, 0x75, 0x37, 0x5B, 0x6C, 0x69, 0x8C, 0x31, 0x3B, 0x67, 0x41, 0x10,
+        0x14, 0x35, 0xC6, 0xB8, 0xDD, 0x2C, 0x96, 0xF8, 0xF7, 0x9E, 0xFB, 0x2E,
+        0xEB, 0xFF, 0x9F, 0x99, 0x42, 0x66, 0x56, 0x56, 0x20, 0x4D, 0x41, 0x2C,
+        0x03, 0x8E, 0x0A, 0x00, 0xD9, 0x82, 0x60, 0x68, 0x64, 0xDE, 0x7D, 0xEF,
+        0xA5, 0xAD, 0x02, 0x94, 0x55, 0x00, 0xD5, 0x85, 0x02, 0x19, 0x0D, 0x23,
+        0x43, 0x41, 0xEA, 0x08, 0x8A, 0xED, 0xD9, 0xED, 0x29, 0xB5, 0x75, 0xAB,
+        0x9E, 0xD5, 0xAC, 0x36, 0xCE, 0xAD, 0x8C, 0xDF, 0xAD, 0x0A, 0x68, 0x6B,
+        0x56, 0x63, 0xFC, 0x6A, 0xFC, 0xFE, 0x97, 0xBE, 0x52, 0xA7, 0x15, 0x0A,
+        0x7C, 0x0C, 0x68, 0x68, 0x23, 0x34, 0x9A, 0xB9, 0xF3, 0xE6, 0x58, 0xD2,
+        0xEA, 0xBB, 0x48, 0xE9, 0x1D, 0x25, 0xB4, 0xCD, 0x9D, 0x79, 0x2B, 0x6B,
+        0xE5, 0xAE, 0xFF, 0x5D, 0x1A, 0x4A, 0x05, 0x24, 0x00, 0x07, 0x50, 0xEA,
+        0xA8, 0x3F, 0x96, 0xFF, 0x3A, 0x01, 0x1D, 0xE0, 0x1C, 0x6D, 0x9A, 0xFC,
+        0xEB, 0xB8, 0x1F, 0xD3, 0xBE, 0x97, 0xB6, 0x35, 0xF9, 0x7B, 0x27, 0x30,
+        0xC0, 0xD0, 0x86, 0x2A, 0x2A, 0x98, 0x65, 0xF8, 0xEE, 0xFF, 0xEF, 0xB4,
+        0x9B, 0xBA, 0x8F, 0x3B, 0xCF, 0x16, 0x08, 0x10, 0x42, 0x08, 0xFF, 0x76,
+        0xFA, 0xEE, 0xC7, 0x5E, 0xFF, 0xFF, 0x97, 0xD9, 0x49, 0xDB, 0x13, 0x63,
+        0xF3, 0x5E, 0xE5, 0x33, 0x7C, 0x45, 0x44, 0x18, 0x86, 0x31, 0xF7, 0x31,
+        0xB4, 0xFE, 0xAB, 0xED, 0xDF, 0x9B, 0xC4, 0x52, 0x41, 0x11, 0x9C, 0xC8,
+        0x64, 0x4F, 0x35, 0x9C, 0x3E, 0xC0, 0x6E, 0x34, 0xFD, 0x1C, 0x6F, 0xB8,
+        0x75, 0xA5, 0x3D, 0xAC, 0xE6, 0x41, 0x76, 0xD8, 0xDF, 0xED, 0x96, 0x28,
+        0xDD, 0x9E, 0xED, 0x3D, 0x0D, 0xFE, 0xAF, 0xC8, 0x83, 0x9C, 0xF9, 0x63,
+        0x3E, 0xAA, 0x5E, 0x25, 0xE7, 0x01, 0xD8, 0x97, 0x85, 0xE1, 0x7B, 0x8D,
+        0xE9, 0xD6, 0xFD, 0x93, 0xE7, 0xC4, 0x13, 0x2A, 0x33, 0xDF, 0xE5, 0xC7,
+        0xA3, 0x93, 0x5B, 0xE7, 0x8B, 0xA3, 0x16, 0x08, 0x83, 0x15, 0x9B, 0x05,
+        0xA9, 0x73, 0x3E, 0xCA, 0x9E, 0xDE, 0x99, 0x7D, 0x74, 0x23, 0x32, 0xB6,
+        0x0E, 0xE5, 0xFA, 0x47, 0xA2, 0x0F, 0x27, 0x6E, 0x17, 0x2C, 0xB2, 0x2D,
+        0x9F, 0xC2, 0xAD, 0x50, 0x00, 0xE9, 0x99, 0x4D, 0xEC, 0x1F, 0xA3, 0x0E,
+        0x9A, 0x48, 0xBE, 0x98, 0xDA, 0x43, 0x19, 0x9C, 0x92, 0x07, 0xE5, 0xF8,
+        0x03, 0x64, 0x56, 0x11, 0x4C, 0x43, 0xD0, 0xE4, 0x24, 0xE9, 0xA9, 0x5C,
+        0xE3, 0x10, 0xFD, 0xD1, 0xA1, 0x1F, 0xFC, 0x8A, 0xD1, 0x6D, 0xA7, 0x81,
+        0x2B, 0x1F, 0x04, 0x90, 0x46, 0x52, 0xCF, 0x2A, 0x69, 0x56, 0x29, 0xD7,
+        0x4E, 0x9D, 0x3E, 0x4E, 0x30, 0xFF, 0x68, 0x22, 0x9B, 0xE1, 0x2E, 0x36,
+        0x84, 0xCF, 0xB5, 0x8F, 0x8D, 0xB3, 0xF3, 0x45, 0x63, 0x76, 0x71, 0x02,
+        0xF2, 0x75, 0x7C, 0xF5, 0x3F, 0x38, 0x7D, 0xFF, 0x0E, 0x07, 0xB7, 0x6B,
+        0x38, 0x50, 0xF1, 0x9A, 0xC6, 0xD9, 0xFF, 0x0F, 0x55, 0xAA, 0x24, 0x39,
+        0xDE, 0xD4, 0x78, 0xD2, 0x61, 0xED, 0x5E, 0xED, 0x8F, 0xAE, 0xAE, 0x78,
+        0xAD, 0x42, 0x3E, 0xCE, 0xE5, 0x2D, 0xEC, 0x94, 0x5C, 0x77, 0xF4, 0x38,
+        0x4C, 0x1C, 0x27, 0x46, 0xEE, 0x2E, 0x75, 0x5C, 0x64, 0x9A, 0xFA, 0x96,
+        0x19, 0x2F, 0x1A, 0x73, 0x8B, 0xC5, 0x54, 0x7B, 0x4C, 0x31, 0x05, 0x6A,
+        0x98, 0x95, 0x77, 0xB5, 0x29, 0x66, 0x66, 0x75, 0x06, 0x70, 0x56, 0x82,
+        0xB6, 0x1B, 0xDE, 0x98, 0x01, 0xAF, 0x6A, 0xB4, 0xCE, 0xA4, 0x75, 0x72,
+        0x93, 0x34, 0x2D, 0xED, 0x5E, 0x7B, 0x33, 0x87, 0xC3, 0xDC, 0x1C, 0x12,
+        0x4F, 0x8E, 0x8E, 0x3A, 0x2B, 0x91, 0x3B, 0xE5, 0x34, 0x7A, 0xBF, 0x57,
+        0x55, 0x04, 0xF0, 0x40, 0xA0, 0xAE, 0xAC, 0xAA, 0xA7, 0x4D, 0x7C, 0xBC,
+        0x3C, 0x05, 0x3E, 0x29, 0x90, 0x11, 0x73, 0x25, 0x72, 0x91, 0x43, 0x86,
+        0xC8, 0xC9, 0xAB, 0x99, 0xDF, 0xD9, 0x0A, 0x14, 0x5B, 0xE8, 0xF6, 0xE2,
+        0x37, 0xF7, 0x2C, 0x82, 0xC2, 0x22, 0x36, 0xF6, 0x0F, 0x47, 0x44, 0x86,
+        0xBC, 0x0A, 0x12, 0x1F, 0xCB, 0x29, 0x86, 0x23, 0xBC, 0x38, 0xC0, 0x2A,
+        0xC7, 0x13, 0x39, 0x73, 0x74, 0x6A, 0x81, 0x3F, 0x23, 0x2A, 0xB1, 0x2A,
+        0x1F, 0x5D, 0xA7, 0x93, 0x3E, 0x38, 0x28, 0x89, 0xCC, 0x74, 0xF2, 0x18,
+        0x30, 0xCF, 0x99, 0xA2, 0xE6, 0x39, 0x27, 0x78, 0x76, 0x79, 0xCA, 0x69,
+        0xA1, 0xC4, 0x62, 0x09, 0x98, 0xC7, 0x32, 0x28, 0xCD, 0xC9, 0x12, 0xA0,
+        0x88, 0xED, 0x35, 0x4E, 0x1C, 0xC0, 0xF5, 0xB3, 0x25, 0x6B, 0xF1, 0x22,
+        0x37, 0x90, 0x4C, 0x4E, 0xCB, 0x2F, 0xE0, 0x9E, 0x47, 0x85, 0xD4, 0x8E,
+        0x89, 0xCD, 0xEE, 0x43, 0x6C, 0x9F, 0xCF, 0x48, 0xFF, 0x88, 0x34, 0xCE,
+        0x40, 0xB1, 0x4B, 0x2F, 0x07, 0x98, 0xC2, 0x38, 0x48, 0xDD, 0xAC, 0xB0,
+        0x8B, 0xD4, 0xD3, 0xE4, 0x1F, 0x96, 0x1C, 0x23, 0x87, 0x2D, 0xF4, 0xED,
+        0xF0, 0xD3, 0xC2, 0x0B, 0x66, 0x6F, 0x59, 0x75, 0xC8, 0xDE, 0x34, 0x23,
+        0x80, 0xFA, 0xA1, 0x87, 0xC7, 0xF9, 0xB8, 0x44, 0xC9, 0x5B, 0x70, 0x8C,
+        0x53, 0xD4, 0xB9, 0x6F, 0x0B, 0xFD, 0x5E, 0x21, 0x2D, 0xA9, 0xA8, 0x1B,
+        0x43, 0x78, 0x45, 0x8D, 0xE7, 0x8C, 0xE1, 0x30, 0xB1, 0x46, 0x81, 0x9D,
+        0xF5, 0xEB, 0x2D, 0xDD, 0x09, 0xCD, 0x9F, 0x08, 0xBD, 0x2A, 0x7C, 0xC8,
+        0x81, 0xCC, 0x20, 0x28, 0x84, 0xC2, 0x46, 0x55, 0xA4, 0x91, 0x16, 0xC9,
+        0x83, 0x31, 0xA9, 0x59, 0x68, 0xDE, 0x32, 0xAA, 0x83, 0x61, 0x47, 0x69,
+        0x05, 0x0F, 0x1D, 0xD5, 0x33, 0x47, 0x26, 0x24, 0x22, 0x2E, 0xE8, 0x15,
+        0x82, 0x89, 0xE8, 0x21, 0x73, 0x60, 0xCC, 0x3E, 0x09, 0x50, 0x00, 0x23,
+        0x5B, 0x98, 0xB9, 0x0F, 0x08, 0x2D, 0x84, 0x91, 0xE2, 0xF0, 0xCA, 0xAF,
+        0x51, 0xA4, 0x54, 0x3D, 0xE2, 0xC5, 0xB7, 0x81, 0x7F, 0x04, 0x3A, 0x08,
+        0xAA, 0x70, 0x69, 0x92, 0xA0, 0x92, 0x42, 0x06, 0x47, 0x22, 0x6A, 0x3B,
+        0xBA, 0xF2, 0xD6, 0x7A, 0x6F, 0x69, 0xB3, 0xD0, 0x5A, 0x51, 0x81, 0x56,
+        0x5F, 0xD9, 0xD8, 0xF4, 0x5E, 0x60, 0x24, 0x94, 0x6A, 0x4C, 0xD2, 0x36,
+        0x38, 0x38, 0x4D, 0x12, 0x52, 0x1A, 0xB2, 0xBF, 0xA9, 0x0A, 0xC1, 0x1A,
+        0x49, 0xC4, 0x02, 0xB7, 0x09, 0x1E, 0xB8, 0x28, 0xD1, 0x05, 0x45, 0xB8,
+        0x9A, 0x68, 0xC9, 0x1B, 0xFD, 0x28, 0xEB, 0x68, 0x16, 0x96, 0x08, 0xBD,
+        0xAA, 0xB9, 0x09, 0x74, 0xB4, 0x39, 0xD6, 0xD0, 0xCB, 0x03, 0x05, 0x87,
+        0x0E, 0x22, 0x96, 0x62, 0x61, 0x24, 0x32, 0xAA, 0x75, 0x30, 0xC2, 0x9B,
+        0x30, 0x9A, 0x47, 0xE8, 0x34, 0x2D, 0x02, 0x44, 0x9F, 0x9F, 0x74, 0x09,
+        0x09, 0x3D, 0x96, 0x53, 0x0C, 0xF5, 0x10, 0xA7, 0x3B, 0x15, 0x5F, 0x35,
+        0x28, 0x66, 0xA1, 0x9F, 0x5F, 0xD9, 0x14, 0x01, 0x5E, 0x66, 0x3F, 0xB3,
+        0x93, 0x97, 0x15, 0x7B, 0xA5, 0xB4, 0x29, 0xF4, 0x86, 0x02, 0x67, 0x18,
+        0xD8, 0xAE, 0x39, 0xF7, 0x55, 0x16, 0x5D, 0x3F, 0x88, 0xB4, 0xD9, 0x26,
+        0x10, 0x6E, 0xD0, 0x1D, 0x34, 0xD7, 0x65, 0xB1, 0x10, 0x89, 0x21, 0x0D,
+        0x57, 0xD9, 0x68, 0xE8, 0x84, 0xBC, 0xE4, 0x07, 0xDA, 0xD6, 0xCE, 0x19,
+        0x34, 0xAA, 0x22, 0xE6, 0xFC, 0xC3, 0xFE, 0x34, 0x4F, 0xC4, 0x74, 0xFB,
+        0xA5, 0x7F, 0x39, 0x7B, 0xF7, 0xF4, 0xEC, 0x9F, 0x63, 0xC1, 0x0F, 0x43,
+        0x4C, 0xEE, 0x78, 0xD6, 0x25, 0x21, 0xAA, 0xE4, 0x65, 0x83, 0xCD, 0x3B,
+        0x0D, 0xF0, 0x0B, 0x5D, 0x36, 0x40, 0x38, 0x31, 0xAF, 0xC9, 0x08, 0x90,
+        0x0A, 0x74, 0x00, 0xAD, 0xC6, 0x86, 0xF7, 0x76, 0x0C, 0xA9, 0x57, 0x38,
+        0xC1, 0x9A, 0x00, 0x8C, 0x32, 0x60, 0x00, 0x31, 0x24, 0x59, 0xED, 0xBC,
+        0xD8, 0x9A, 0x53, 0xC0, 0x08, 0x98, 0xA3, 0x51, 0x71, 0xB9, 0x5E, 0xAA,
+        0x3A, 0x65, 0x6D, 0x0B, 0x28, 0x84, 0x21, 0x6A, 0x63, 0x9D, 0x43, 0x48,
+        0x2B, 0xE7, 0x40, 0x01, 0xA7, 0x68, 0xA4, 0xA6, 0xEB, 0x31, 0x9B, 0x98,
+        0x3D, 0x45, 0xC3, 0x0D, 0x50, 0x82, 0x2A, 0x52, 0xE2, 0xC1, 0x59, 0x06,
+        0x8C, 0x27, 0x7A, 0x03, 0xA7, 0x00, 0x7D, 0xCC, 0xBD, 0xE4, 0x05, 0xB8,
+        0xBA, 0x58, 0x0C, 0xAF, 0xCD, 0x22, 0xCD, 0xDD, 0x20, 0x06, 0x1E, 0x1C,
+        0x1F, 0x62, 0x50, 0x46, 0xDD, 0x19, 0x63, 0xBE, 0x80, 0x60, 0xD4, 0x53,
+        0xD0, 0xAB, 0x36, 0x4C, 0x34, 0x92, 0xF5, 0xCE, 0x59, 0x80, 0xEB, 0x94,
+        0xA0, 0x22, 0x8D, 0x25, 0x05, 0x55, 0x61, 0x01, 0xBF, 0x99, 0x89, 0x3B,
+        0xFC, 0x0C, 0x7E, 0x5C, 0x6B, 0x66, 0x5D, 0x06, 0xA8, 0x75, 0xFE, 0x8F,
+        0x55, 0x6C, 0xF9, 0x05, 0xD6, 0xB1, 0xAF, 0x40, 0xD9, 0x57, 0x32, 0x76,
+        0x42, 0xB2, 0xCC, 0x10, 0xB6, 0xF9, 0xC8, 0x5B, 0x3C, 0xA8, 0x0A, 0x72,
+        0x10, 0x45, 0x93, 0x46, 0x4E, 0x9E, 0xD3, 0x50, 0xB4, 0x0F, 0x67, 0x91,
+        0xFC, 0xEC, 0x11, 0x19, 0x11, 0x3B, 0xF9, 0xD3, 0xF2, 0xAB, 0xCA, 0x5C,
+        0x74, 0xB5, 0x9E, 0xA3, 0x32, 0x63, 0x24, 0x22, 0x70, 0x9A, 0x50, 0x87,
+        0xB6, 0xD6, 0xE1, 0x36, 0xAC, 0x1E, 0x09, 0x9E, 0x74, 0x24, 0x41, 0xA8,
+        0x2C, 0x2D, 0x8E, 0xC4, 0xAF, 0x15, 0x86, 0xD3, 0xC5, 0xA5, 0x2E, 0x46,
+        0x00, 0x7C, 0x56, 0xC6, 0x21, 0xDE, 0x8B, 0x5F, 0x33, 0xEB, 0xAC, 0x61,
+        0x39, 0x5F, 0x1B, 0x07, 0x95, 0x64, 0x26, 0xD6, 0x1B, 0x68, 0xAF, 0x6F,
+        0x8E, 0xB6, 0xB0, 0x42, 0xF5, 0x5B, 0x84, 0x07, 0x2F, 0x7E, 0x94, 0x94,
+        0x2E, 0x1C, 0x91, 0x01, 0x4B, 0x79, 0x81, 0xD8, 0x23, 0x28, 0x2E, 0x9B,
+        0x45, 0x75, 0x96, 0x83, 0xFD, 0x22, 0x1B, 0x2A, 0x0F, 0x17, 0x70, 0x55,
+        0xE5, 0x61, 0x67, 0x42, 0xA2, 0xBD, 0xB3, 0x16, 0x97, 0xEE, 0x63, 0xF4,
+        0x1D, 0x68, 0x42, 0x98, 0x84, 0x31, 0x85, 0x12, 0x40, 0xA9, 0x42, 0x63,
+        0x71, 0xD1, 0xF4, 0x6B, 0x99, 0x1A, 0x74, 0x3B, 0x2C, 0x17, 0xD2, 0xFF,
+        0x99, 0x38, 0x10, 0xF0, 0x50, 0xD2, 0xDC, 0xBA, 0x7A, 0x15, 0xC1, 0x2D,
+        0x1A, 0x8A, 0x88, 0xAC, 0x38, 0x43, 0x82, 0x53, 0x11, 0x49, 0x65, 0x5D,
+        0xCA, 0xB5, 0xF0, 0x91, 0xC0, 0x75, 0x56, 0x1B, 0x6A, 0x7D, 0x9E, 0xDC,
+        0x92, 0xD9, 0x05, 0x30, 0x85, 0x81, 0x58, 0x2A, 0xB0, 0x49, 0x99, 0x7A,
+        0x66, 0xDC, 0x5A, 0x2C, 0x1A, 0x14, 0x3C, 0xC8, 0x36, 0x2D, 0xA0, 0x24,
+        0xB4, 0x7D, 0x79, 0xB8, 0x16, 0xB4, 0x39, 0xA1, 0x5F, 0xB4, 0x97, 0xA1,
+        0x90, 0x60, 0x2D, 0xE8, 0x2A, 0x24, 0x9F, 0x59, 0x18, 0x4E, 0x4E, 0x6F,
+        0x5D, 0xF9, 0x68, 0x31, 0xF4, 0x27, 0xC5, 0xE5, 0xF0, 0xA3, 0xE5, 0x7C,
+        0xE1, 0xC2, 0xEA, 0x51, 0xA1, 0x2A, 0x16, 0x51, 0x10, 0x8E, 0x03, 0x53,
+        0x9F, 0x09, 0xD6, 0x38, 0xBE, 0x2F, 0x99, 0x40, 0x2C, 0x57, 0x54, 0x06,
+        0x63, 0x4B, 0xD4, 0x80, 0x1F, 0xD1, 0x63, 0xD6, 0xD4, 0x00, 0x81, 0xF0,
+        0x3F, 0x5D, 0xC4, 0x00, 0x36, 0x52, 0x52, 0x4D, 0xC6, 0x80, 0x96, 0x5F,
+        0xE3, 0x6C, 0x38, 0x20, 0x16, 0x91, 0x17, 0x51, 0x31, 0xA0, 0xB0, 0x95,
+        0x7E, 0x07, 0xE5, 0x5F, 0x06, 0x64, 0x34, 0x36, 0xC6, 0x53, 0xDB, 0x29,
+        0xFC, 0xAD, 0xC1, 0x12, 0xD3, 0x8E, 0xE0, 0x19, 0x34, 0x3A, 0x3B, 0x2F,
+        0x84, 0xD2, 0xF5, 0x98, 0x61, 0x5F, 0x00, 0x99, 0x22, 0x13, 0xA0, 0xB4,
+        0xBD, 0x27, 0x02, 0xA8, 0x5F, 0xDE, 0xEB, 0x5E, 0x16, 0x35, 0x1B, 0xBF,
+        0xDE, 0x36, 0xB2, 0x0C, 0x9E, 0x51, 0x49, 0xB6, 0x01, 0x5E, 0x57, 0xC9,
+        0x3E, 0x0A, 0xF9, 0x16, 0x7E, 0x3B, 0x5E, 0x49, 0x94, 0x60, 0xBE, 0x6B,
+        0xA8, 0x3C, 0x7F, 0xB4, 0x8B, 0xC1, 0x9B, 0x95, 0x3D, 0xDB, 0x8C, 0x1F,
+        0xCF, 0x43, 0x7A, 0xF7, 0x31, 0x98, 0xA8, 0x1D, 0x40, 0x01, 0x23, 0x39,
+        0x31, 0x17, 0x6C, 0x50, 0xB3, 0x89, 0x2C, 0x4B, 0x0C, 0x15, 0xD2, 0x3D,
+        0x41, 0x9A, 0x08, 0xC9, 0x11, 0x10, 0x07, 0x13, 0x28, 0x88, 0x81, 0xB0,
+        0x7B, 0xA7, 0x57, 0x59, 0x3F, 0x97, 0x67, 0x63, 0x18, 0xA4, 0x25, 0x2A,
+        0x95, 0x43, 0x42, 0x1F, 0x0A, 0xC2, 0x9B, 0xB4, 0xDF, 0xA2, 0x76, 0x41,
+        0x45, 0x2A, 0x2C, 0x48, 0x79, 0xFC, 0xF1, 0x21, 0x7E, 0x9D, 0xA8, 0x5C,
+        0xDD, 0x56, 0xB3, 0xE6, 0x7E, 0x7E, 0x80, 0x34, 0x21, 0x46, 0x9F, 0xAD,
+        0x58, 0x1A, 0x89, 0x46, 0x83, 0x22, 0x1D, 0x2E, 0x15, 0x6D, 0x94, 0x70,
+        0xD7, 0xB2, 0xC9, 0x63, 0xA0, 0x58, 0xB6, 0x8C, 0x12, 0xEB, 0xDC, 0x1C,
+        0xB0, 0xFA, 0xE9, 0x7D, 0xD0, 0x06, 0x1B, 0xF2, 0x2F, 0xE3, 0xFD, 0xB0,
+        0x3F, 0x5B, 0xD9, 0x16, 0xF5, 0x4B, 0x6D, 0xE9, 0x02, 0xD3, 0x2A, 0x9B,
+        0x08, 0x15, 0x6E, 0x43, 0xB1, 0xEF, 0xB1, 0x5E, 0xFC, 0x37, 0x1E, 0x71,
+        0x08, 0x5A, 0xED, 0x56, 0x2D, 0x4E, 0xA7, 0x92, 0xEF, 0x65, 0x33, 0x7E,
+        0x52, 0xB2, 0x4D, 0xC9, 0x3C, 0xD5, 0xC5, 0x35, 0x7D, 0x57, 0x29, 0xC8,
+        0x1A, 0x7B, 0x3A, 0xAF, 0x9D, 0x42, 0x1B, 0xCB, 0x5A, 0x3A, 0x83, 0x56,
+        0x4D, 0x4B, 0xF1, 0xF8, 0x23, 0x2F, 0x9E, 0xED, 0xFE, 0x08, 0x45, 0xDD,
+        0xB6, 0x88, 0x12, 0x05, 0x0B, 0xBE, 0x5E, 0x51, 0x64, 0x62, 0x5F, 0x15,
+        0x2F, 0xD1, 0x1B, 0x41, 0xEA, 0x86, 0x5B, 0xF8, 0xF5, 0xD0, 0xFF, 0x1F,
+        0x1B, 0xC5, 0xD4, 0xCB, 0x38, 0xA8, 0xB9, 0xC1, 0x76, 0x53, 0xA1, 0xF6,
+        0xD6, 0x1D, 0x39, 0x81, 0xFA, 0x8B, 0xD4, 0xA6, 0x22, 0xD6, 0xF7, 0xC9,
+        0x2C, 0x97, 0xB2, 0x56, 0xCB, 0xCD, 0xE7, 0x62, 0x51, 0xD0, 0x35, 0xBB,
+        0xC6, 0x86, 0x27, 0x85, 0x3F, 0x43, 0x8D, 0x3B, 0x14, 0x2A, 0x8A, 0xD0,
+        0x46, 0xF4, 0xF8, 0xC3, 0x70, 0xD9, 0x7B, 0x2A, 0x72, 0xE7, 0x25, 0x81,
+        0x89, 0x2B, 0x3B, 0x04, 0x21, 0x39, 0xE3, 0xA6, 0x43, 0x60, 0x17, 0xC2,
+        0x1D, 0xC4, 0xDB, 0x35, 0x11, 0xFB, 0x81, 0xEA, 0x51, 0x8B, 0x9C, 0xF0,
+        0xEC, 0x9F, 0x49, 0xA3, 0x85, 0x83, 0x43, 0xBC, 0xBA, 0xD9, 0x35, 0x1E,
+        0xF3, 0x89, 0x11, 0x15, 0x4E, 0x62, 0xC3, 0x1F, 0x33, 0x60, 0x51, 0x7D,
+        0xD0, 0x40, 0x67, 0x82, 0x93, 0xFB, 0xFD, 0x58, 0x88, 0xD7, 0x04, 0x1D,
+        0xB1, 0xC9, 0x06, 0x88, 0x97, 0x04, 0x24, 0x55, 0xA7, 0x61, 0x35, 0xAA,
+        0x6F, 0x62, 0xF7, 0x11, 0x8F, 0x56, 0x8B, 0x86, 0x74, 0x72, 0x44, 0x8C,
+        0x7A, 0x90, 0xC4, 0x25, 0x48, 0xEF, 0x87, 0x76, 0xAC, 0xFE, 0x4A, 0xCC,
+        0x31, 0x05, 0x34, 0xB0, 0xF9, 0xA3, 0x65, 0xB5, 0xBB, 0xE8, 0x4C, 0x15,
+        0xA2, 0x2B, 0x15, 0x8D, 0x6C, 0x19, 0xD7, 0xA2, 0xF5, 0x2E, 0xD2, 0x0F,
+        0xD1, 0x1D, 0x15, 0x6A, 0x61, 0x6A, 0x5A, 0xD4, 0xD9, 0x19, 0x58, 0xE1,
+        0xAA, 0x3E, 0x1F, 0x95, 0x95, 0x90, 0xD7, 0x0A, 0xD1, 0xEF, 0x6B, 0xD4,
+        0x0F, 0xCF, 0x08, 0x1A, 0x89, 0xC6, 0xA5, 0xDC, 0x16, 0x3C, 0x85, 0x88,
+        0xD4, 0x00, 0x06, 0x03, 0x4A, 0x8E, 0xD6, 0x7C, 0x2B, 0x01, 0x7D, 0x6A,
+        0x50, 0x7D, 0x2F, 0x96, 0x34, 0x39, 0x52, 0x31, 0x48, 0x86, 0xE6, 0x10,
+        0x47, 0xC4, 0x76, 0xAA, 0x27, 0xB4, 0xB0, 0x83, 0x9A, 0x68, 0x53, 0x44,
+        0x01, 0x50, 0x3B, 0xCD, 0x45, 0x57, 0xD2, 0x15, 0xA4, 0x44, 0x15, 0xA5,
+        0xE6, 0x4D, 0xE1, 0xFC, 0x95, 0x3B, 0x5F, 0x6C, 0xE9, 0x86, 0x13, 0xB5,
+        0x92, 0xFE, 0xF0, 0xE0, 0x67, 0x99, 0x52, 0xA3, 0xB1, 0xC2, 0x78, 0x3D,
+        0xE4, 0x3D, 0xA9, 0x8F, 0x0D, 0xA3, 0x27, 0x82, 0x45, 0x57, 0x93, 0x1B,
+        0xD6, 0x1E, 0xEC, 0xC6, 0x5C, 0xCD, 0x35, 0xF4, 0xB7, 0x3C, 0x21, 0x38,
+        0x03, 0x03, 0x24, 0x44, 0x40, 0xE0, 0x69, 0x28, 0x33, 0xAE, 0x42, 0x5E,
+        0x9F, 0x69, 0x8D, 0x28, 0x12, 0x81, 0x70, 0x15, 0xAE, 0x26, 0x08, 0x71,
+        0xCE, 0xA6, 0xEC, 0xC0, 0x8D, 0xE4, 0xA0, 0xF5, 0xCE, 0xEA, 0xBC, 0xB0,
+        0x3D, 0x1E, 0x78, 0x99, 0x68, 0x47, 0xCD, 0x41, 0xC9, 0x19, 0xC1, 0xF1,
+        0x60, 0xD8, 0x48, 0xE6, 0xD5, 0x11, 0x3B, 0x3F, 0xE7, 0xDD, 0x73, 0x67,
+        0x1A, 0x44, 0x85, 0x36, 0x79, 0x54, 0x0A, 0x0B, 0x2C, 0xE1, 0xB0, 0x29,
+        0x4A, 0x48, 0x52, 0x45, 0x77, 0xB5, 0x0B, 0x92, 0x48, 0xB2, 0x8A, 0xEA,
+        0x7F, 0x4D, 0x1B, 0x87, 0xE7, 0x17, 0x6E, 0x19, 0x2F, 0xF3, 0x44, 0x8D,
+        0xD2, 0x47, 0x5C, 0x31, 0x10, 0x7A, 0x88, 0xC3, 0xC7, 0xCA, 0x69, 0xBF,
+        0x5B, 0x55, 0xD1, 0x28, 0x0D, 0x53, 0x26, 0xD8, 0xAB, 0x7B, 0x75, 0xA1,
+        0x96, 0xF8, 0x5C, 0x83, 0x3F, 0xCA, 0x4F, 0x86, 0x33, 0xD0, 0x89, 0xDC,
+        0x11, 0xBA, 0xF7, 0xB8, 0x1F, 0xC1, 0x2B, 0xD9, 0x91, 0x8D, 0x31, 0x5A,
+        0xCA, 0x40, 0xA4, 0x72, 0x9A, 0x99, 0xF9, 0x2E, 0xEB, 0xBC, 0x36, 0x9B,
+        0xB0, 0x53, 0x76, 0x21, 0xFA, 0xF1, 0x88, 0xC4, 0x14, 0x32, 0xAE, 0xDE,
+        0xF6, 0x1B, 0xC5, 0x03, 0x63, 0x09, 0xDC, 0x39, 0x1E, 0x55, 0x7D, 0xD4,
+        0xA1, 0xE9, 0xC6, 0x5E, 0x88, 0xBB, 0xFB, 0x1D, 0x1E, 0x5F, 0x26, 0x78,
+        0xC1, 0x8F, 0x7B, 0x95, 0x75, 0xD4, 0x88, 0x80, 0x25, 0x2D, 0x4C, 0xE2,
+        0x57, 0xF5, 0xBC, 0x1C, 0x24, 0xCA, 0xED, 0xE0, 0xC2, 0x4F, 0xE2, 0x6A,
+        0x69, 0x31, 0xF3, 0xFB, 0xF0, 0x5F, 0xC7, 0x0C, 0x73, 0xDD, 0x27, 0xC1,
+        0x07, 0x73, 0x7A, 0x0D, 0xB0, 0xA0, 0xDD, 0xCF, 0x6D, 0xF2, 0xB5, 0x3F,
+        0x44, 0xAB, 0xAD, 0xDF, 0x87, 0x22, 0xE9, 0x0B, 0x9F, 0xAC, 0x76, 0x49,
+        0x8F, 0xFF, 0xEF, 0xB1, 0xD4, 0x5A, 0xBA, 0xF6, 0x49, 0x90, 0x60, 0x16,
+        0xB4, 0xA1, 0x5D, 0xD8, 0xE5, 0x84, 0x74, 0x6E, 0x36, 0x81, 0x38, 0x44,
+        0x1E, 0xBB, 0xFC, 0xF4, 0xA1, 0x64, 0xB5, 0xE7, 0x11, 0x2D, 0x68, 0xB7,
+        0x55, 0x35, 0x47, 0x70, 0x67, 0x2E, 0x86, 0x89, 0x56, 0x0B, 0x7D, 0xB4,
+        0xE5, 0x55, 0x86, 0x4E, 0x65, 0x36, 0x52, 0x86, 0x93, 0x5D, 0xAC, 0xC8,
+        0x50, 0x9E, 0x87, 0xC4, 0xA0, 0x7F, 0xB7, 0x0D, 0xD5, 0x9F, 0x9F, 0xD6,
+        0xBD, 0xE7, 0xC4, 0xAE, 0x21, 0x9A, 0xEC, 0x02, 0xCB, 0x16, 0x23, 0x5F,
+        0x91, 0x58, 0x44, 0xB6, 0xA6, 0xF6, 0x35, 0xE3, 0x91, 0x63, 0x48, 0x57,
+        0x07, 0x69, 0x58, 0x7C, 0x5F, 0xEC, 0xA1, 0xD8, 0x45, 0x39, 0xBC, 0x55,
+        0xB9, 0xAC, 0x4A, 0x25, 0x08, 0xB9, 0x5F, 0x7B, 0xAE, 0x84, 0xD7, 0xBA,
+        0xC5, 0xE7, 0xED, 0x58, 0x09, 0x43, 0x44, 0xD5, 0x7B, 0xEA, 0xA3, 0xB8,
+        0xA8, 0xC9, 0x03, 0x36, 0x60, 0x24, 0xB9, 0x7D, 0xE2, 0x87, 0x32, 0xA1,
+        0x85, 0x2B, 0x18, 0x5D, 0x39, 0x2D, 0xB2, 0xF7, 0xEB, 0x6E, 0xF6, 0xE8,
+        0x3F, 0xE4, 0x6C, 0x4A, 0x27, 0x93, 0x48, 0x6A, 0x28, 0xE1, 0xA4, 0xC8,
+        0x74, 0x40, 0xD1, 0x78, 0xD0, 0x0F, 0x29, 0x6C, 0xBC, 0x5C, 0x33, 0x7E,
+        0x63, 0xC2, 0x41, 0x45, 0x6B, 0x10, 0x2C, 0x1A, 0x19, 0xFE, 0xCE, 0x78,
+        0xBF, 0xFC, 0x21, 0x3C, 0xCA, 0x07, 0x79, 0xEE, 0xC4, 0xC0, 0xDA, 0xFB,
+        0x7C, 0xB7, 0x86, 0x44, 0x70, 0x0C, 0xB6, 0x74, 0xC9, 0xCC, 0xB3, 0xFA,
+        0x96, 0x35, 0x86, 0x6C, 0x87, 0x82, 0xE0, 0x1D, 0xEC, 0x25, 0x18, 0xD7,
+        0xB2, 0xAD, 0x61, 0x8E, 0xA9, 0x22, 0x93, 0xD1, 0x05, 0xE0, 0xBE, 0xB1,
+        0xFB, 0x00, 0xD7, 0x73, 0x4D, 0x7A, 0xB7, 0xCE, 0x88, 0xCC, 0x31, 0x74,
+        0x87, 0xCD, 0x25, 0xB5, 0x5A, 0x36, 0xCC, 0x0B, 0x5A, 0xEB, 0x57, 0x4D,
+        0x8F, 0x48, 0x3E, 0xD5, 0xCF, 0x6E, 0x6B, 0x89, 0xED, 0x52, 0xA8, 0x19,
+        0x8A, 0xDD, 0x46, 0x27, 0x7B, 0x42, 0x02, 0xDA, 0xAA, 0x16, 0xD9, 0xE6,
+        0x70, 0x78, 0x67, 0x04, 0x39, 0x48, 0xA8, 0x40, 0x14, 0xBF, 0xAD, 0x42,
+        0xFA, 0x93, 0x68, 0xD4, 0xB9, 0x2B, 0xD3, 0xA1, 0xFB, 0x4F, 0x5E, 0x3E,
+        0xE2, 0xC5, 0xEC, 0x20, 0xE2, 0x55, 0x5A, 0xE0, 0x64, 0xEA, 0x21, 0x5E,
+        0x77, 0xBD, 0x33, 0xB5, 0x14, 0xD8, 0x13, 0x78, 0x13, 0x16, 0x82, 0x76,
+        0xB5, 0xC3, 0x5E, 0xE3, 0x31, 0x8C, 0x3A, 0x30, 0x11, 0xB6, 0xDF, 0x38,
+        0x82, 0xC3, 0xD8, 0x8A, 0xA2, 0x6C, 0x2A, 0x3E, 0x76, 0xA3, 0x17, 0xC6,
+        0xDD, 0xC0, 0x43, 0x12, 0x6A, 0xA8, 0x0D, 0xE8, 0xEF, 0x4F, 0x37, 0xE3,
+        0xFC, 0x6B, 0xF3, 0x7E, 0x82, 0x1D, 0x7B, 0xF6, 0xAD, 0xF0, 0x37, 0xE2,
+        0x14, 0x09, 0xCC, 0x92, 0xAB, 0xA3, 0xB5, 0x70, 0x1F, 0x03, 0x6A, 0xA7,
+        0xEE, 0xA1, 0x43, 0x3A, 0x5A, 0x2C, 0x5E, 0x77, 0xE9, 0xEC, 0xB6, 0xA2,
+        0x77, 0x29, 0xCE, 0xC5, 0xE9, 0x85, 0xFC, 0x59, 0x5F, 0x2F, 0xFF, 0xA5,
+        0xCC, 0xDA, 0xF1, 0x34, 0x04, 0xD9, 0x35, 0xDA, 0x19, 0x17, 0x9E, 0x46,
+        0xCD, 0xF2, 0x11, 0xBE, 0x53, 0xEF, 0x9A, 0x6A, 0x10, 0x7C, 0xA8, 0x5A,
+        0xD3, 0x61, 0x32, 0x4F, 0xB1, 0x04, 0x2A, 0xD7, 0x3D, 0xE7, 0x95, 0x8B,
+        0xEF, 0xE7, 0xBA, 0x9F, 0x2F, 0xC0, 0x3F, 0xA7, 0xE1, 0x73, 0x20, 0x91,
+        0x05, 0x87, 0x2D, 0x12, 0x78, 0x1F, 0xE1, 0xC9, 0x68, 0x02, 0x05, 0x0F,
+        0x92, 0xF9, 0xDD, 0x8F, 0xD0, 0xBF, 0xE2, 0x77, 0xC2, 0x92, 0x58, 0xFA,
+        0x7A, 0xAD, 0xC9, 0x1A, 0xF0, 0xE6, 0xBA, 0x55, 0x9C, 0x67, 0x14, 0x77,
+        0xA0, 0xBA, 0x2F, 0x50, 0x47, 0x06, 0x54, 0xC3, 0x24, 0xA5, 0x14, 0xA4,
+        0xEB, 0xF7, 0x2F, 0x35, 0xED, 0xE0, 0x15, 0x76, 0x0C, 0x35, 0x94, 0xF4,
+        0x5D, 0x86, 0x86, 0xF1, 0xCA, 0x6B, 0xD2, 0x10, 0x15, 0x02, 0xC2, 0x01,
+        0xB4, 0xF8, 0xCB, 0x91, 0x38, 0x78, 0x06, 0x79, 0xF1, 0x29, 0x10, 0x98,
+        0x9A, 0x2B, 0x81, 0xAB, 0x0C, 0x23, 0x85, 0x88, 0x45, 0x15, 0x0F, 0x68,
+        0x23, 0x98, 0xC0, 0x79, 0x2D, 0x86, 0xC4, 0x8D, 0x52, 0xB2, 0x1F, 0x37,
+        0x13, 0x47, 0x1A, 0x9C, 0x21, 0xC7, 0xF0, 0x7B, 0x9A, 0x59, 0xD0, 0xBD,
+        0x18, 0x56, 0x12, 0x08, 0xF6, 0x78, 0xA8, 0xAB, 0x4A, 0xC3, 0xFD, 0xDA,
+        0xD7, 0x13, 0x1E, 0x92, 0x42, 0xBA, 0xC0, 0xBB, 0x19, 0x2C, 0x9C, 0x7D,
+        0x24, 0x37, 0x14, 0xA9, 0xA2, 0xFD, 0x66, 0x2E, 0x49, 0x94, 0xF4, 0x78,
+        0x1F, 0x08, 0xC1, 0x95, 0x20, 0x99, 0xAC, 0x10, 0x45, 0xA7, 0x15, 0xB1,
+        0xB4, 0x67, 0xCE, 0x86, 0x6B, 0x35, 0x48, 0xEA, 0x43, 0x37, 0x8F, 0x7E,
+        0x1C, 0x15, 0xC9, 0x11, 0xE6, 0x43, 0x6F, 0xFF, 0x4F, 0xBE, 0x29, 0x63,
+        0x42, 0x88, 0xD5, 0x08, 0xF1, 0xE9, 0xFA, 0xFB, 0x64, 0x9C, 0x65, 0xB6,
+        0x14, 0xE1, 0x46, 0xAE, 0x3B, 0x46, 0x3A, 0x11, 0x84, 0xED, 0x26, 0x2B,
+        0x95, 0x00, 0x4F, 0x8F, 0x97, 0x61, 0xC1, 0xBD, 0xD3, 0x79, 0x79, 0x8C,
+        0xD3, 0x9A, 0xE3, 0x5F, 0x52, 0x80, 0x4B, 0xDA, 0x12, 0x15, 0x64, 0xF1,
+        0xF7, 0xC1, 0x73, 0xEA, 0xE5, 0x9D, 0x9E, 0x24, 0x7A, 0x77, 0xBD, 0xB6,
+        0x82, 0xF9, 0x53, 0x5A, 0x82, 0x3F, 0xBA, 0xD1, 0xFF, 0x70, 0xC3, 0x82,
+        0xB3, 0x78, 0x51, 0xF6, 0xC1, 0x0C, 0x80, 0x17, 0xED, 0x01, 0x05, 0x97,
+        0x0D, 0x37, 0x70, 0xFF, 0x3F, 0x3D, 0xDF, 0xF6, 0x91, 0x0E, 0x60, 0x91,
+        0xF5, 0xFD, 0x4E, 0x36, 0xCA, 0x49, 0xD0, 0xC5, 0x8D, 0x1C, 0x7E, 0xE4,
+        0x81, 0x2B, 0x10, 0x8F, 0x1C, 0xDD, 0x8C, 0x05, 0x48, 0xA7, 0xC8, 0x4D,
+        0xFF, 0xB8, 0xC1, 0x9C, 0x56, 0x77, 0xA6, 0xF5, 0x87, 0x46, 0x54, 0xF2,
+        0x22, 0x3D, 0x90, 0x92, 0x03, 0x75, 0x88, 0xA5, 0x24, 0xDC, 0x65, 0xB1,
+        0xFB, 0xA1, 0x9C, 0xF5, 0x4B, 0x34, 0x46, 0xD1, 0xC5, 0xCE, 0x61, 0xB1,
+        0x73, 0xA9, 0x4B, 0x24, 0xFC, 0xEC, 0x36, 0x79, 0x7C, 0x9F, 0xAD, 0x87,
+        0xFC, 0xF6, 0xAB, 0x83, 0xF2, 0x21, 0xCF, 0x57, 0x9D, 0x1D, 0xC3, 0xF8,
+        0x5C, 0x73, 0x2F, 0xF5, 0xE8, 0xAF, 0x57, 0x5D, 0x75, 0xC3, 0xAB, 0xAE,
+        0x7A, 0xD9, 0xD5, 0xD2, 0x0E, 0x91, 0xFD, 0xB3, 0xFC, 0xE4, 0x1A, 0x58,
+        0x5F, 0xE4, 0xE7, 0x38, 0x46, 0xF7, 0x7A, 0x82, 0x3D, 0xFA, 0x1A, 0xA6,
+        0xB8, 0x85, 0xD8, 0x85, 0x82, 0x3D, 0xCA, 0xF1, 0xD0, 0xC1, 0x2D, 0xFD,
+        0x2E, 0xCE, 0x1F, 0x89, 0x2F, 0x30, 0x74, 0xF3, 0x7B, 0xF9, 0x1B, 0xF7,
+        0x6B, 0x18, 0x8B, 0xF6, 0xC8, 0x4B, 0x7E, 0x92, 0x38, 0xBF, 0x66, 0xA3,
+        0xD2, 0x94, 0x1C, 0x51, 0x52, 0x5A, 0x48, 0xEF, 0x98, 0x1C, 0x63, 0xFB,
+        0x98, 0x5F, 0x95, 0x2E, 0x7C, 0x1F, 0x5C, 0xE2, 0xA5, 0xC6, 0x06, 0x8F,
+        0x73, 0x3F, 0x2A, 0x4E, 0x5C, 0xE0, 0x40, 0x59, 0xF6, 0xEE, 0x85, 0x3A,
+        0xBE, 0xE2, 0x71, 0xEF, 0x47, 0xE6, 0x58, 0x2A, 0xDB, 0x63, 0xA1, 0x64,
+        0x0F, 0x3B, 0x98, 0xB6, 0x3D, 0x30, 0x32, 0xA7, 0x52, 0xBE, 0x72, 0x0F,
+        0xBB, 0xB2, 0xF9, 0x38, 0xDA, 0xF5, 0xE8, 0x3D, 0x15, 0x89, 0xD1, 0xD5,
+        0x18, 0x1F, 0xDD, 0xEF, 0xA9, 0xAB, 0x65, 0x4F, 0x7D, 0xA8, 0x88, 0xC1,
+        0x54, 0x74, 0x11, 0x2B, 0x6A, 0x2E, 0x26, 0xE3, 0x3C, 0x00, 0xCA, 0x88,
+        0x2A, 0x53, 0xB1, 0x85, 0xCA, 0x2F, 0x47, 0x9D, 0xF0, 0x0C, 0x3F, 0x44,
+        0xC2, 0x7C, 0x39, 0x9E, 0xDE, 0xDB, 0x02, 0xF7, 0x41, 0x2A, 0x55, 0x61,
+        0x52, 0x76, 0xBF, 0x8F, 0x5E, 0xC5, 0xE5, 0x35, 0x4D, 0xDF, 0x87, 0x07,
+        0xE9, 0x7E, 0x1F, 0x8B, 0xEB, 0x6F, 0xB7, 0x51, 0x36, 0x6C, 0xF7, 0x60,
+        0x38, 0x23, 0x91, 0x58, 0x30, 0xA0, 0x70, 0x90, 0x6C, 0xD9, 0x40, 0x89,
+        0xE3, 0xFE, 0xF8, 0x85, 0xDF, 0x8B, 0xCE, 0x73, 0x62, 0x70, 0xD8, 0x68,
+        0x6F, 0xF0, 0x46, 0xF2, 0x6D, 0xA8, 0xA4, 0x04, 0x5F, 0xEC, 0x9D, 0xF4,
+        0xCC, 0x1B, 0x85, 0x40, 0xFE, 0xA2, 0xE1, 0x9E, 0xF5, 0x42, 0xBB, 0x87,
+        0x99, 0x84, 0x31, 0xDA, 0xFB, 0xE5, 0x29, 0xE2, 0xD3, 0x8E, 0xE2, 0xE4,
+        0x13, 0x8F, 0x10, 0x7E, 0xE2, 0x09, 0x98, 0xF6, 0xBF, 0xD7, 0x3C, 0x46,
+        0x3C, 0x4D, 0x44, 0xE4, 0x24, 0x6C, 0xE2, 0xA9, 0xFE, 0x70, 0xAA, 0xFD,
+        0x17, 0xBE, 0x84, 0xD9, 0xEE, 0x4D, 0x01, 0x6B, 0x7F, 0xF0, 0x5F, 0xCA,
+        0xF9, 0x5B, 0x88, 0xC7, 0xD4, 0xC0, 0x99, 0xE6, 0x9C, 0xCE, 0x1C, 0x2F,
+        0x2B, 0xF9, 0x0F, 0xBC, 0xD2, 0x86, 0xFC, 0x02, 0x12, 0x9F, 0xF5, 0x50,
+        0xC9, 0x26, 0x8C, 0x07, 0x76, 0xA0, 0x5E, 0x3C, 0x1A, 0x4D, 0x39, 0x22,
+        0x89, 0xBC, 0x69, 0x98, 0x5B, 0xCB, 0x9A, 0xE7, 0x52, 0x4E, 0x58, 0x46,
+        0xA7, 0xD0, 0x48, 0x3C, 0x22, 0xC7, 0xBC, 0xDD, 0xDA, 0x6C, 0xB5, 0x0B,
+        0xEE, 0x60, 0x4B, 0x9E, 0xB8, 0xEE, 0x42, 0x18, 0x5B, 0xB7, 0x3E, 0x8E,
+        0x7A, 0x18, 0xC7, 0xB6, 0x84, 0x9D, 0xAA, 0x2C, 0x67, 0x1B, 0xF9, 0x89,
+        0x08, 0x2D, 0x8F, 0x9E, 0x8D, 0xE0, 0x28, 0x9A, 0xFB, 0x9F, 0x88, 0x5D,
+        0x7B, 0x7C, 0xB2, 0xDD, 0x41, 0xFF, 0x30, 0xE4, 0x4B, 0xCC, 0xB5, 0x3C,
+        0xC7, 0xD2, 0xF2, 0xFF, 0x9C, 0x8C, 0xFB, 0x21, 0xD9, 0x60, 0x3B, 0x20,
+        0x46, 0x7E, 0x4F, 0x88, 0x7A, 0xFD, 0x48, 0x87, 0x44, 0x4D, 0x6C, 0x9F,
+        0xF2, 0x1C, 0xC6, 0x3F, 0x54, 0xF3, 0x79, 0xE6, 0x47, 0xDE, 0x44, 0x71,
+        0xB0, 0xC7, 0xBF, 0x41, 0x43, 0xF4, 0xBA, 0x6E, 0xFB, 0xD5, 0x38, 0x51,
+        0xFB, 0x34, 0xA8, 0xAD, 0x00, 0xAA, 0x7A, 0xCA, 0x93, 0x12, 0x0B, 0x67,
+        0xD8, 0x83, 0x4B, 0x3E, 0x12, 0xC5, 0xC2, 0xE1, 0xE7, 0x78, 0x31, 0x5F,
+        0x4B, 0xB1, 0xF8, 0xE6, 0x62, 0x27, 0xAB, 0xE4, 0xB6, 0xF7, 0x93, 0x0C,
+        0x9C, 0x12, 0xB1, 0x61, 0xEC, 0x0A, 0x04, 0xDC, 0xD2, 0x4B, 0x1D, 0x95,
+        0x1F, 0xA4, 0x57, 0x94, 0x42, 0x2F, 0xB3, 0x19, 0xD4, 0x4E, 0x26, 0x15,
+        0xBB, 0x42, 0x6B, 0x58, 0x7A, 0x18, 0x9C, 0xD9, 0xCC, 0x19, 0xB5, 0x4B,
+        0x99, 0x06, 0x36, 0xE3, 0x3A, 0x03, 0x7B, 0x89, 0xC7, 0x7B, 0xD6, 0x2E,
+        0xAE, 0x8C, 0xC7, 0x05, 0x5C, 0x4D, 0x26, 0xDA, 0xD8, 0x41, 0x09, 0xEF,
+        0xDA, 0x0E, 0x29, 0x0F, 0x1D, 0xC8, 0x9C, 0x79, 0xC4, 0x76, 0xE7, 0x8A,
+        0x7B, 0xF7, 0xF6, 0xAA, 0x77, 0xE7, 0xC6, 0x8F, 0xD8, 0xFE, 0xDC, 0xE4,
+        0x11, 0x3B, 0x98, 0xBB, 0xFE, 0x7E, 0x7F, 0xF8, 0xDF, 0xDC, 0xCD, 0x23,
+        0x76, 0x34, 0x77, 0xFB, 0x88, 0x1D, 0xCF, 0xDD, 0x7D, 0x7F, 0x3A, 0xF9,
+        0x8F, 0xA7, 0x34, 0xF8, 0xA0, 0x19, 0x7D, 0xE2, 0x5D, 0x37, 0x47, 0x17,
+        0x63, 0xFB, 0xED, 0xC6, 0x51, 0x04, 0x01, 0x43, 0x8C, 0x15, 0x79, 0x40,
+        0x37, 0x05, 0x32, 0xB4, 0x45, 0x72, 0xFE, 0x80, 0x6C, 0xEE, 0x73, 0xDE,
+        0x74, 0x03, 0xE3, 0x38, 0x55, 0xCD, 0xD8, 0x74, 0xDA, 0x34, 0xBB, 0x15,
+        0x43, 0x5F, 0x1E, 0x8A, 0xFE, 0xD9, 0xA7, 0x2F, 0x8A, 0x90, 0xEE, 0x0D,
+        0x4B, 0x27, 0xFD, 0xF9, 0xCD, 0x84, 0xB1, 0x69, 0xC3, 0x10, 0xBC, 0x4F,
+        0xC9, 0x99, 0x1F, 0xFF, 0x7F, 0x28, 0x67, 0xE6, 0xED, 0x2F, 0xE0, 0xC8,
+        0x87, 0x2B, 0xFF, 0xF1, 0xD9, 0xE8, 0xE5, 0xBE, 0x3A, 0x71, 0x34, 0x38,
+        0x9B, 0x04, 0x0F, 0x89, 0xCA, 0x48, 0xD1, 0x90, 0x20, 0x83, 0x80, 0x1C,
+        0xB0, 0x71, 0xB5, 0x38, 0x5C, 0x7E, 0xAA, 0x8F, 0xA1, 0x74, 0xDB, 0xFF,
+        0xEE, 0xD7, 0x56, 0xBC, 0x12, 0x54, 0xC4, 0xF7, 0x76, 0x7F, 0x2C, 0x67,
+        0xD9, 0x38, 0xBC, 0xF3, 0xAC, 0x7C, 0x59, 0x6D, 0xFB, 0xB4, 0x96, 0xBF,
+        0xD0, 0x8F, 0xD1, 0xF9, 0xBC, 0x7C, 0x79, 0xD2, 0x8F, 0xD8, 0xAF, 0x57,
+        0x1F, 0xAA, 0xCF, 0x5B, 0x3C, 0xA7, 0x1D, 0xD5, 0xAF, 0xA7, 0x9E, 0x0E,
+        0x2F, 0x9D, 0x78, 0x1E, 0x58, 0xDA, 0x71, 0xFD, 0xAF, 0xE8, 0xE2, 0xF4,
+        0x12, 0xFE, 0xD1, 0xFB, 0xBA, 0x7C, 0xD8, 0xFE, 0xCD, 0x83, 0x84, 0xCF,
+        0xEC, 0x9D, 0xCC, 0x5F, 0xDE, 0x97, 0x43, 0x1D, 0xAD, 0x42, 0xF1, 0xC6,
+        0xB3, 0x02, 0x57, 0xE8, 0x11, 0xDE, 0xEB, 0x7A, 0x25, 0x71, 0xB6, 0xF3,
+        0x68, 0xBA, 0x9F, 0xE2, 0xD3, 0xE2, 0xA2, 0xA1, 0xDD, 0x8B, 0x7C, 0x6B,
+        0xB7, 0x1E, 0x7E, 0xC3, 0x92, 0xB8, 0x37, 0xAD, 0x2D, 0x6C, 0x49, 0xDC,
+        0xEA, 0x0F, 0x1F, 0x7F, 0xBF, 0x9E, 0x87, 0x0D, 0xBB, 0x7E, 0xE5, 0x2C,
+        0xFA, 0x01, 0x12, 0x60, 0x17, 0xA3, 0xC7, 0xC7, 0x51, 0xB5, 0xD1, 0xA3,
+        0x96, 0x7C, 0x32, 0x13, 0xB8, 0xB7, 0x1A, 0x1C, 0x8E, 0x93, 0xBD, 0xAB,
+        0xCB, 0x08, 0x8E, 0x3F, 0xBD, 0xAD, 0xD1, 0x46, 0xD4, 0x43, 0x0A, 0x23,
+        0xF2, 0x7A, 0x3A, 0xBF, 0xEC, 0xBA, 0xC4, 0x87, 0xEA, 0x1C, 0xC5, 0xC5,
+        0xEA, 0x03, 0x6D, 0x2F, 0x8D, 0x9B, 0xC6, 0xFB, 0xE8, 0x1D, 0xA1, 0xD2,
+        0x05, 0x91, 0xD0, 0xB2, 0xCC, 0x2A, 0x8B, 0x0F, 0xB8, 0x44, 0x77, 0x92,
+        0x47, 0x17, 0x12, 0xC1, 0x62, 0x6D, 0x40, 0x31, 0xD5, 0xB7, 0x30, 0xF0,
+        0xCB, 0x97, 0xEC, 0x04, 0x8F, 0x68, 0xA4, 0x08, 0xE0, 0x44, 0x56, 0x6B,
+        0x76, 0x62, 0x75, 0xEC, 0x76, 0xFB, 0xD5, 0x34, 0x1B, 0x91, 0xD3, 0xB0,
+        0x24, 0x4F, 0xF5, 0xDA, 0xE9, 0x4A, 0xB9, 0x36, 0xC4, 0xE5, 0xBF, 0xD9,
+        0x8D, 0x3A, 0xFA, 0x62, 0xDD, 0x4D, 0x33, 0xB9, 0xF3, 0xA4, 0x50, 0xAD,
+        0x82, 0xF1, 0x7A, 0xB7, 0x5B, 0x36, 0x52, 0xFA, 0xFA, 0x94, 0x36, 0xE7,
+        0xA3, 0x16, 0xE9, 0x72, 0x5B, 0x6F, 0xD4, 0x39, 0xDA, 0x5C, 0x38, 0xB2,
+        0xD8, 0x3E, 0x13, 0x27, 0x23, 0xE1, 0xF2, 0x35, 0xC2, 0xDE, 0x2F, 0x3A,
+        0xFC, 0x1E, 0xEA, 0xD8, 0x8A, 0xEA, 0x49, 0x9F, 0x1E, 0x70, 0xDD, 0x8C,
+        0x57, 0x4E, 0x7B, 0x84, 0x51, 0x78, 0xB7, 0xB8, 0xFC, 0xC9, 0xF5, 0xBA,
+        0xE1, 0x3E, 0x00, 0xEE, 0x0E, 0x30, 0xF2, 0x6D, 0xCF, 0x9A, 0x00, 0x6F,
+        0x1A, 0xCD, 0x2C, 0x42, 0x8E, 0x23, 0x99, 0xEB, 0x62, 0xF5, 0x96, 0xF3,
+        0xEE, 0x7D, 0x78, 0x0B, 0x9A, 0xDE, 0x6A, 0xBC, 0x80, 0xCA, 0xF8, 0x22,
+        0xAD, 0x5A, 0x9E, 0x09, 0xA0, 0xDE, 0x9B, 0x42, 0xE6, 0x1E, 0x9B, 0x4A,
+        0xF8, 0xAA, 0xC6, 0xDB, 0x54, 0x40, 0xD5, 0xCF, 0x9B, 0x35, 0x53, 0x31,
+        0x06, 0x6D, 0xD0, 0xF8, 0xCA, 0x24, 0x2C, 0xA0, 0x72, 0x18, 0x94, 0xA7,
+        0xA3, 0x2C, 0xC3, 0xFD, 0xBD, 0x30, 0xEA, 0xB6, 0x9E, 0x8B, 0x50, 0xFC,
+        0x84, 0x4B, 0xB8, 0x7A, 0xD3, 0xEE, 0xE3, 0xF9, 0x51, 0xD5, 0x19, 0x45,
+        0xD1, 0xBD, 0x39, 0x6C, 0x6A, 0x8E, 0xD7, 0xB2, 0x55, 0xE0, 0x0F, 0x7C,
+        0x25, 0xA9, 0x92, 0x8D, 0xCE, 0x73, 0xC0, 0x8E, 0xBB, 0x5C, 0x7E, 0x98,
+        0xB9, 0xE2, 0x0F, 0x65, 0x13, 0xF7, 0x0B, 0x19, 0x6D, 0x5D, 0xDD, 0x8D,
+        0x9A, 0xE5, 0x41, 0x97, 0xD5, 0x69, 0xC7, 0x8A, 0x01, 0x7A, 0x3E, 0xF6,
+        0xE8, 0xC7, 0x65, 0x0B, 0x91, 0xCD, 0xDC, 0x8A, 0xE0, 0x18, 0x14, 0x33,
+        0x14, 0x25, 0x1B, 0x75, 0xD8, 0x75, 0xBC, 0xD6, 0xE8, 0x1A, 0x24, 0xCE,
+        0xEF, 0xC0, 0x66, 0x97, 0x93, 0x9A, 0x67, 0x05, 0x7C, 0xED, 0xDB, 0x52,
+        0x81, 0xC4, 0xED, 0xC4, 0xC3, 0x32, 0xDB, 0xF9, 0xDA, 0xDB, 0x94, 0x44,
+        0x64, 0xC8, 0x19, 0x74, 0x6F, 0x67, 0x2C, 0x7D, 0xEF, 0x2C, 0x45, 0x33,
+        0x47, 0x40, 0xF7, 0xED, 0x37, 0x8C, 0x35, 0x2E, 0x7F, 0xC8, 0x3E, 0x8C,
+        0x3E, 0x10, 0x7B, 0x58, 0x4F, 0x90, 0xFB, 0xF1, 0x0F, 0xFD, 0x1C, 0xB0,
+        0x9F, 0xDB, 0x6F, 0xD7, 0x78, 0x83, 0x7B, 0xD8, 0x1A, 0xAD, 0x88, 0x2D,
+        0xDA, 0x00, 0x8F, 0xD8, 0x0D, 0xA2, 0xE3, 0x40, 0x37, 0xF3, 0x74, 0x1E,
+        0xD1, 0x3E, 0xB8, 0x51, 0x25, 0xFD, 0xB2, 0x78, 0xE4, 0xAE, 0x16, 0xF1,
+        0x90, 0xD3, 0xB1, 0xD4, 0x54, 0xEF, 0x28, 0xFE, 0x77, 0x0D, 0x31, 0x7C,
+        0x81, 0x43, 0xEC, 0x6B, 0x88, 0xD0, 0x8B, 0x66, 0xD6, 0x54, 0xC5, 0x0E,
+        0x4B, 0x49, 0xED, 0xA1, 0x33, 0x6A, 0xC2, 0xAC, 0x3F, 0xF0, 0x4B, 0xF7,
+        0x8C, 0xB5, 0x2F, 0x7F, 0xC8, 0x6E, 0x10, 0xE0, 0x01, 0x93, 0x18, 0x40,
+        0x11, 0xB1, 0x5F, 0x64, 0x33, 0x67, 0xC7, 0x10, 0x9E, 0x9F, 0x9F, 0x39,
+        0x5D, 0xA2, 0x08, 0x05, 0x71, 0x52, 0x46, 0xD8, 0x19, 0x79, 0x04, 0x10,
+        0xDA, 0xEA, 0x1B, 0xD1, 0xF9, 0x73, 0x5E, 0x59, 0x61, 0xC4, 0x83, 0xBC,
+        0xB1, 0x91, 0x09, 0xF9, 0x27, 0xBF, 0x48, 0x81, 0x29, 0x5A, 0x25, 0xA1,
+        0x48, 0x24, 0x30, 0x5F, 0x23, 0xC5, 0x35, 0x82, 0x59, 0x88, 0xF0, 0x25,
+        0x56, 0x23, 0xF0, 0x92, 0xA2, 0x7A, 0x13, 0x5C, 0x57, 0xFE, 0x3E, 0xA9,
+        0x9B, 0x80, 0x54, 0xEB, 0x6F, 0x12, 0xEE, 0x0C, 0x3C, 0x05, 0x7F, 0xC8,
+        0x9B, 0x84, 0x81, 0x86, 0x18, 0x3E, 0xFE, 0x3A, 0x72, 0xC0, 0x52, 0x03,
+        0x7E, 0x02, 0x19, 0xE7, 0xB1, 0xDA, 0xCB, 0x58, 0xD6, 0x1D, 0x42, 0x7E,
+        0xC8, 0x49, 0x3B, 0x14, 0x39, 0x02, 0xC4, 0xB9, 0x40, 0xC0, 0xD4, 0x59,
+        0x07, 0x72, 0x43, 0xB3, 0xC5, 0xBD, 0x19, 0x7D, 0x3D, 0xF7, 0x29, 0x19,
+        0x7A, 0xE5, 0xFF, 0x56, 0x45, 0x41, 0x08, 0x2E, 0x46, 0x96, 0x09, 0x20,
+        0xB6, 0xEB, 0x8A, 0x12, 0x13, 0xD8, 0x3E, 0xFC, 0x35, 0x31, 0x1B, 0xE0,
+        0x5D, 0xE4, 0xE9, 0xE3, 0xE0, 0xB7, 0xAF, 0x33, 0xE4, 0x73, 0x5F, 0x23,
+        0x43, 0x9B, 0xB7, 0x13, 0x77, 0xAD, 0x25, 0x12, 0xFE, 0xC0, 0xCE, 0x1F,
+        0x03, 0x0D, 0xEB, 0x46, 0x3B, 0x3E, 0x34, 0x1A, 0xE7, 0x1F, 0x0C, 0x74,
+        0xD0, 0xFC, 0xED, 0xE3, 0x7B, 0xB4, 0x78, 0x1A, 0x1B, 0x49, 0xAE, 0xAE,
+        0x94, 0x29, 0x5E, 0xB1, 0x42, 0xE4, 0x83, 0x01, 0xC1, 0xD1, 0xCA, 0xC5,
+        0x82, 0xBE, 0x91, 0x56, 0x07, 0x2E, 0x4F, 0x3F, 0xFC, 0x19, 0x02, 0xE4,
+        0x34, 0xA2, 0x01, 0xD4, 0x51, 0x6C, 0x43, 0x0C, 0x30, 0x55, 0x2F, 0xF9,
+        0xC4, 0xB8, 0x73, 0xD2, 0xB0, 0x67, 0xF1, 0xED, 0xC1, 0xF8, 0x37, 0x5F,
+        0x3B, 0xEF, 0xF4, 0x60, 0x79, 0xCE, 0x5D, 0xA3, 0x36, 0x7B, 0x28, 0xDE,
+        0x03, 0xC1, 0xB5, 0x58, 0x19, 0xD8, 0x72, 0x5C, 0xD2, 0x43, 0x4F, 0xEB,
+        0x0F, 0xC7, 0x66, 0xDA, 0xB5, 0xB4, 0x68, 0x29, 0xB1, 0x21, 0x5D, 0x3E,
+        0x64, 0xD4, 0x3A, 0xD4, 0x46, 0xAB, 0x59, 0xCE, 0xCE, 0x01, 0x29, 0x97,
+        0x97, 0xFC, 0x2A, 0x8A, 0x55, 0x2F, 0x72, 0x17, 0x82, 0xE7, 0xB8, 0xD9,
+        0x91, 0xAE, 0xF4, 0x09, 0x5C, 0x94, 0xF7, 0x32, 0x2A, 0x17, 0x72, 0x9C,
+        0x92, 0xD8, 0x6A, 0x07, 0x33, 0xE4, 0xF1, 0xBD, 0x76, 0x10, 0xBA, 0xA9,
+        0x4B, 0xD2, 0xA1, 0xDC, 0x41, 0xDB, 0x9B, 0xF7, 0x5F, 0x11, 0x8B, 0x0D,
+        0x65, 0xF9, 0x5B, 0xDC, 0xE8, 0x60, 0xB5, 0x2D, 0xC2, 0x34, 0x94, 0x49,
+        0x50, 0xA5, 0x7A, 0x8F, 0xB2, 0x2E, 0xE8, 0xCD, 0x83, 0x3C, 0x68, 0x02,
+        0xC9, 0x72, 0x45, 0xC3, 0xDB, 0xA7, 0xE9, 0x4E, 0x2D, 0xBF, 0xF1, 0x23,
+        0x9C, 0x1F, 0x56, 0x33, 0x0E, 0x2B, 0x04, 0xBC, 0x88, 0x09, 0x56, 0x52,
+        0x9B, 0x04, 0x3A, 0xC2, 0x25, 0xF0, 0x11, 0x25, 0x3E, 0xA9, 0xF4, 0x07,
+        0x65, 0x5D, 0xC6, 0xCC, 0x4E, 0xBD, 0x9A, 0x96, 0xDF, 0xE8, 0x9F, 0xD3,
+        0x1D, 0x7C, 0x78, 0x57, 0xEA, 0x86, 0xC4, 0xD5, 0x90, 0x7C, 0x2B, 0xC7,
+        0x11, 0x28, 0x6F, 0x8C, 0xAF, 0xA4, 0x42, 0x8D, 0xD2, 0xAA, 0x12, 0xE2,
+        0x06, 0x53, 0x28, 0xA4, 0xD5, 0xC8, 0xB1, 0xEA, 0x5E, 0x27, 0xDB, 0x5F,
+        0x81, 0x8C, 0xAE, 0xDC, 0x6A, 0x71, 0x4F, 0x35, 0xC0, 0x6A, 0x95, 0xE6,
+        0xC8, 0xAB, 0x0F, 0x37, 0x8F, 0x94, 0xAB, 0xC9, 0xC3, 0xDF, 0xD4, 0x1A,
+        0xC3, 0xB6, 0x60, 0x9E, 0x8A, 0x76, 0x05, 0xF3, 0x41, 0x76, 0xC6, 0xBA,
+        0x45, 0x23, 0x11, 0x02, 0xE9, 0x4F, 0xB4, 0x5A, 0xB0, 0x6F, 0x9B, 0xD2,
+        0x64, 0x6E, 0x38, 0x33, 0x89, 0x9A, 0x59, 0xDC, 0xA7, 0x38, 0x77, 0x44,
+        0x6E, 0x74, 0x01, 0x39, 0x70, 0xDE, 0xA5, 0x94, 0x68, 0xFD, 0xB3, 0x9F,
+        0xFF, 0x4E, 0xE7, 0xB1, 0x07, 0x8A, 0x08, 0x6D, 0xF1, 0xA9, 0x76, 0x5B,
+        0x7F, 0xEE, 0xBC, 0x05, 0xD2, 0x9F, 0xEB, 0xCC, 0x75, 0x50, 0x37, 0xC1,
+        0xB4, 0xA1, 0x71, 0x6B, 0x3E, 0xF5, 0x55, 0xB7, 0x3E, 0x85, 0x8F, 0x96,
+        0x87, 0x31, 0x0B, 0x7B, 0x96, 0xF1, 0xB1, 0x43, 0xD1, 0xBD, 0xCF, 0x53,
+        0x9D, 0x88, 0x0F, 0x68, 0x62, 0x9C, 0x11, 0xF9, 0x5F, 0x1C, 0xAE, 0x04,
+        0xA3, 0x01, 0xCC, 0xBF, 0xBD, 0x4B, 0x1F, 0x1C, 0xAA, 0xA0, 0x79, 0x99,
+        0xF5, 0x53, 0x7C, 0xBA, 0x22, 0x3E, 0x5F, 0xCB, 0x48, 0xB1, 0xEE, 0x1E,
+        0xD6, 0xC3, 0x5F, 0x77, 0x3E, 0x7F, 0x87, 0x17, 0x19, 0x02, 0x77, 0x2D,
+        0xBC, 0xBC, 0x3C, 0x59, 0x03, 0xF7, 0x04, 0xCE, 0x7B, 0xC7, 0x82, 0x2E,
+        0xDE, 0xD7, 0xB3, 0x0A, 0x45, 0x3B, 0xFC, 0x9B, 0x4F, 0x2C, 0x5C, 0x05,
+        0xD2, 0x04, 0xD0, 0x2E, 0xAB, 0x44, 0x9D, 0x8A, 0x1E, 0x72, 0x51, 0x59,
+        0x90, 0x03, 0x83, 0x65, 0xF0, 0xE3, 0x68, 0x8B, 0x4C, 0x5A, 0x06, 0xE4,
+        0xF9, 0x54, 0x83, 0x37, 0x10, 0xB0, 0x82, 0x2D, 0x64, 0xD4, 0x85, 0x68,
+        0xC7, 0xE5, 0xF1, 0x85, 0x46, 0xEF, 0xB5, 0x8D, 0x57, 0x7F, 0x3D, 0x2C,
+        0xEA, 0x4A, 0x6E, 0xE5, 0x11, 0x89, 0xE2, 0xBF, 0x29, 0x12, 0x59, 0x0A,
+        0xC2, 0x79, 0x90, 0xE7, 0x8D, 0x40, 0xE0, 0x61, 0x3C, 0x2E, 0xDD, 0x02,
+        0x74, 0xC4, 0xA7, 0x67, 0xA7, 0x56, 0xB8, 0x04, 0x88, 0x87, 0xB2, 0xD8,
+        0xBF, 0x18, 0xD0, 0xAE, 0x99, 0x38, 0x34, 0x9F, 0x97, 0x5A, 0x21, 0x29,
+        0x7E, 0xD8, 0x80, 0xE3, 0xEE, 0xD4, 0x25, 0xAF, 0x15, 0x0A, 0xCD, 0x4F,
+        0x85, 0xC2, 0xFC, 0xDF, 0xDC, 0xDA, 0xF4, 0xA0, 0x3B, 0x13, 0x52, 0xC7,
+        0x17, 0x84, 0x90, 0x22, 0xBF, 0x88, 0x06, 0xC1, 0xD7, 0xD7, 0x5F, 0xB1,
+        0x1F, 0x55, 0xB8, 0xBC, 0xF4, 0xBA, 0xC5, 0xA8, 0x02, 0x4C, 0xE6, 0xCB,
+        0x24, 0x26, 0x92, 0xA6, 0x5A, 0x16, 0x47, 0x1A, 0x39, 0x58, 0x99, 0x82,
+        0x9B, 0x14, 0xB0, 0xF8, 0xC7, 0x6B, 0x06, 0x90, 0x3B, 0xB8, 0x5B, 0x64,
+        0x89, 0xF4, 0x6F, 0xFB, 0x29, 0x77, 0xEC, 0x36, 0x80, 0x05, 0x11, 0xC8,
+        0x97, 0x9A, 0x7F, 0x93, 0xD2, 0xF8, 0x37, 0xDA, 0xDD, 0xCC, 0x55, 0x90,
+        0x95, 0x4A, 0x37, 0xAF, 0x4B, 0xE5, 0xA1, 0x51, 0xE9, 0x7B, 0xA1, 0x04,
+        0xFE, 0x55, 0x62, 0x6B, 0x76, 0x55, 0xBD, 0x4B, 0x33, 0xB5, 0xCA, 0x14,
+        0x34, 0x7E, 0x5A, 0xCF, 0x95, 0x71, 0xBE, 0x2D, 0x80, 0x34, 0xFA, 0xD2,
+        0xC2, 0xC7, 0xA0, 0x92, 0xB7, 0xAE, 0xCC, 0x2C, 0xBD, 0x34, 0x53, 0xA4,
+        0xA2, 0xD4, 0xB5, 0x2A, 0xAC, 0x69, 0x6C, 0x9E, 0xB7, 0xBE, 0x88, 0x79,
+        0x78, 0xAB, 0xA1, 0xC3, 0xA6, 0xC3, 0x9C, 0xB1, 0x60, 0x5A, 0xD4, 0x5F,
+        0x38, 0x33, 0xEC, 0x83, 0xDB, 0x0E, 0x0A, 0xE4, 0x02, 0x7D, 0x8A, 0x1D,
+        0x9E, 0x4B, 0x31, 0x83, 0xF1, 0x82, 0xAE, 0x0F, 0xA0, 0x5F, 0x6C, 0x94,
+        0x67, 0x39, 0x18, 0xE0, 0x83, 0x84, 0x67, 0xA4, 0x12, 0x8D, 0x17, 0x96,
+        0x20, 0x8C, 0xDD, 0x79, 0xD5, 0x14, 0xAC, 0x44, 0xE6, 0xF4, 0xFD, 0xBA,
+        0xCE, 0x99, 0xEE, 0x2D, 0x56, 0x5F, 0xCD, 0x62, 0xEA, 0x3F, 0x65, 0x8C,
+        0xB6, 0x9C, 0xFF, 0xE4, 0x13, 0x03, 0xFD, 0x5D, 0x93, 0x55, 0x69, 0x83,
+        0x01, 0x51, 0x1C, 0xDA, 0x24, 0x11, 0x2A, 0x5C, 0x29, 0xD3, 0x22, 0x11,
+        0x53, 0x78, 0x16, 0x73, 0x2E, 0x9D, 0xD0, 0x3A, 0x41, 0xF4, 0xA8, 0x57,
+        0xC8, 0xF8, 0x6C, 0x1E, 0xE3, 0xEB, 0xAE, 0x49, 0x2F, 0xAC, 0x3F, 0x96,
+        0x03, 0x10, 0xC9, 0x5A, 0x0E, 0x46, 0x05, 0x01, 0x4C, 0x5F, 0x40, 0x0B,
+        0x1F, 0x78, 0xE5, 0x09, 0xBE, 0x11, 0x78, 0x5D, 0xC5, 0xBF, 0x3B, 0xC9,
+        0x58, 0xA3, 0x92, 0x92, 0x4C, 0x51, 0x18, 0x58, 0xC2, 0x6A, 0xB7, 0x57,
+        0xF8, 0x7D, 0x3C, 0xC5, 0x11, 0x43, 0xE9, 0x58, 0xE0, 0x0A, 0x53, 0xF5,
+        0x5C, 0xF1, 0xB1, 0x98, 0xB7, 0x85, 0xE1, 0xAD, 0xE7, 0x2C, 0x67, 0xA5,
+        0x4A, 0xBC, 0x4A, 0xBD, 0x0F, 0x66, 0x62, 0x1F, 0x25, 0xF9, 0xC6, 0xF2,
+        0xB3, 0xB1, 0xFC, 0x6C, 0x24, 0x3F, 0x1B, 0xC9, 0x0F, 0xE1, 0x27, 0x71,
+        0x49, 0xEA, 0x33, 0x5F, 0xCB, 0x21, 0x52, 0xA8, 0x6D, 0xF2, 0xB7, 0x43,
+        0x5E, 0xE0, 0x9E, 0xD2, 0x8E, 0x1B, 0xE9, 0x1B, 0x71, 0x72, 0xA9, 0x42,
+        0x93, 0x69, 0x9D, 0x31, 0xC3, 0x8F, 0x7F, 0x50, 0xD0, 0xEF, 0x8B, 0xB4,
+        0xF5, 0x2E, 0xAB, 0x78, 0x56, 0x0C, 0x7B, 0x5F, 0x35, 0xE0, 0x96, 0x8A,
+        0xBD, 0x4D, 0x62, 0x85, 0xC1, 0x4E, 0xAF, 0x12, 0xD8, 0x56, 0x55, 0xE8,
+        0xD8, 0xC4, 0xF1, 0x87, 0x22, 0x6D, 0x9D, 0xA9, 0x22, 0xCD, 0xD7, 0xBA,
+        0xE3, 0x3F, 0x5E, 0x49, 0xFF, 0xBA, 0xE4, 0xE3, 0xA6, 0x17, 0x94, 0xFA,
+        0xFA, 0x6E, 0x2E, 0xA8, 0xFD, 0xF2, 0x64, 0x19, 0x96, 0x4E, 0xDD, 0xDA,
+        0x32, 0xB6, 0x39, 0xAC, 0xC1, 0x35, 0xF6, 0x5B, 0xC6, 0x3B, 0xCF, 0x8A,
+        0x33, 0xB2, 0xFE, 0x3F, 0x98, 0x89, 0x12, 0x1C, 0xF2, 0xDC, 0x5D, 0xE7,
+        0xB5, 0x76, 0xF9, 0x67, 0xA7, 0xD5, 0xDE, 0x92, 0xC9, 0x7F, 0x2D, 0x18,
+        0x57, 0x50, 0x6B, 0xF3, 0x1D, 0x5D, 0xA7, 0x00, 0xB9, 0x31, 0x51, 0x9C,
+        0x3D, 0xC9, 0x89, 0xF3, 0x22, 0x17, 0x98, 0xA7, 0x5D, 0x62, 0x3A, 0xF1,
+        0x58, 0x4A, 0x0F, 0x18, 0xDD, 0xE8, 0x62, 0xB5, 0xAB, 0xD1, 0x47, 0x20,
+        0xFA, 0xCE, 0x46, 0x37, 0xE6, 0x1E, 0x62, 0x7A, 0x46, 0x39, 0xD2, 0x8A,
+        0xA4, 0x91, 0x85, 0xC5, 0xA5, 0xE3, 0xEF, 0x3A, 0x58, 0x9B, 0x0C, 0xCB,
+        0xC6, 0x94, 0x01, 0x17, 0x8E, 0xCB, 0xA7, 0x19, 0xF4, 0x34, 0x28, 0xFA,
+        0xD6, 0x3B, 0x78, 0xFF, 0xD9, 0x49, 0x1C, 0x46, 0x1C, 0xE4, 0x55, 0x55,
+        0xEA, 0xB7, 0x8F, 0x04, 0xFB, 0x8A, 0xF3, 0xFB, 0xF5, 0x8A, 0xC6, 0x85,
+        0x03, 0xE4, 0xEF, 0x8A, 0x71, 0xDC, 0x04, 0xE1, 0xEF, 0x4A, 0xB1, 0xF8,
+        0x67, 0x39, 0x55, 0xC6, 0xDD, 0x9F, 0x65, 0xFA, 0x73, 0xD7, 0x64, 0xE5,
+        0xE3, 0x8F, 0xFA, 0x7A, 0xAE, 0x5C, 0x37, 0x7E, 0xF3, 0x86, 0xC2, 0x84,
+        0x6F, 0x95, 0x9B, 0xD6, 0xEF, 0xDE, 0x2D, 0xBF, 0x15, 0x14, 0x10, 0x95,
+        0x3B, 0x5C, 0x3F, 0x41, 0x18, 0x9E, 0x4B, 0x98, 0xC6, 0x2E, 0x04, 0x42,
+        0x3B, 0x12, 0xDC, 0xE7, 0x03, 0x08, 0x09, 0x0A, 0x25, 0xE2, 0xF2, 0x11,
+        0xCA, 0xEE, 0x24, 0xD8, 0x24, 0xCC, 0x54, 0xA1, 0xA6, 0x21, 0xB9, 0xA7,
+        0xC8, 0x40, 0x61, 0xB5, 0xD6, 0x0E, 0x2F, 0x20, 0x17, 0xD8, 0x11, 0x71,
+        0xCB, 0x0F, 0x91, 0xC5, 0x9E, 0xD3, 0x02, 0x3E, 0xE7, 0x87, 0xA6, 0xBB,
+        0xC3, 0x4C, 0x44, 0x85, 0x07, 0x7F, 0x09, 0xD0, 0x96, 0xCA, 0x26, 0xF1,
+        0x91, 0x7D, 0x40, 0xFB, 0xD4, 0xD1, 0x4E, 0xA4, 0xB9, 0xFF, 0x78, 0x4D,
+        0x04, 0xC2, 0xA1, 0x59, 0x1D, 0xFE, 0xD4, 0x52, 0xC5, 0xE9, 0x1C, 0x41,
+        0x03, 0x14, 0xB5, 0x52, 0xF2, 0xB7, 0x75, 0x44, 0x5F, 0x51, 0x8D, 0xA0,
+        0xB1, 0xC5, 0xB4, 0x87, 0x23, 0x5F, 0xD0, 0x67, 0x99, 0xE6, 0x00, 0xDA,
+        0x9B, 0x23, 0x88, 0xCB, 0x4C, 0x55, 0x11, 0x77, 0x18, 0xCD, 0x2F, 0xD1,
+        0x6C, 0x9D, 0x05, 0x60, 0x11, 0x2A, 0x0C, 0xBF, 0x15, 0x84, 0xFF, 0x01,
+        0x9E, 0x5C, 0x04, 0xA6, 0xA1, 0xF7, 0xEB, 0x01, 0x96, 0xC3, 0x49, 0xD5,
+        0x9B, 0xEE, 0x91, 0xFD, 0x13, 0x45, 0x26, 0x8B, 0xB9, 0x55, 0x51, 0xCC,
+        0x87, 0xAA, 0x5F, 0xAF, 0x58, 0x86, 0x65, 0xD7, 0xC2, 0x20, 0x88, 0x63,
+        0xD1, 0xF3, 0x41, 0x22, 0x45, 0x59, 0x84, 0x02, 0xEF, 0xB1, 0xD8, 0xEE,
+        0x83, 0xC5, 0xB6, 0xE9, 0x2A, 0x4B, 0xA1, 0x3A, 0xE8, 0x76, 0xC3, 0x78,
+        0xAE, 0x19, 0xCA, 0xF4, 0x65, 0xA5, 0x81, 0xDB, 0xA7, 0x71, 0xF1, 0x22,
+        0x05, 0x42, 0xDE, 0xF8, 0x20, 0x53, 0x98, 0x11, 0x3E, 0xB3, 0xD3, 0xC5,
+        0xB9, 0xE1, 0xF3, 0x6C, 0x65, 0xB5, 0x4A, 0x88, 0x45, 0xFA, 0xA5, 0xF2,
+        0x9C, 0xCA, 0xC2, 0x8D, 0xC4, 0x4A, 0xF0, 0x48, 0x12, 0x1D, 0x3F, 0xE2,
+        0x06, 0x03, 0x04, 0xBC, 0xC9, 0x5F, 0x02, 0x06, 0xD0, 0x65, 0xBB, 0xA5,
+        0x78, 0x88, 0x35, 0x2C, 0x55, 0x4B, 0x7B, 0x5B, 0x94, 0x3F, 0xAC, 0x0B,
+        0xF7, 0x3F, 0xE0, 0x61, 0x3D, 0xA5, 0x46, 0x0B, 0x6E, 0xD9, 0x7F, 0x3B,
+        0x11, 0xC5, 0x16, 0xFB, 0xEA, 0xE1, 0x13, 0xBD, 0xA2, 0xD8, 0x70, 0xFD,
+        0x93, 0xD8, 0x19, 0x35, 0x8D, 0xD9, 0x50, 0x39, 0x7F, 0x37, 0x6D, 0x8A,
+        0xE6, 0xF8, 0x64, 0xB6, 0xF4, 0x5C, 0xDE, 0x1E, 0xE3, 0x72, 0x4E, 0xAD,
+        0xFB, 0xF6, 0x2D, 0xA2, 0x5A, 0xC8, 0xC8, 0x32, 0x40, 0x0D, 0x83, 0x37,
+        0x05, 0xA9, 0x74, 0x85, 0x26, 0x16, 0x12, 0x45, 0xB8, 0xF5, 0x4D, 0xCE,
+        0x20, 0xCD, 0xEC, 0xB0, 0x5E, 0x50, 0xA4, 0x59, 0x47, 0xC6, 0x4C, 0xC8,
+        0xF1, 0x55, 0xCD, 0xB4, 0x1B, 0x1D, 0xC2, 0xB2, 0x1B, 0x70, 0xDA, 0x98,
+        0x4F, 0x21, 0x43, 0xAC, 0x8B, 0xD2, 0xA1, 0xBE, 0xB4, 0xCD, 0x8A, 0x6F,
+        0x27, 0x32, 0x66, 0x0A, 0x6A, 0x81, 0x46, 0xA9, 0xBD, 0x6C, 0x68, 0x0C,
+        0x2B, 0x3A, 0x05, 0xE1, 0x05, 0x0F, 0x6F, 0xB5, 0x02, 0x48, 0x6B, 0x4C,
+        0xA5, 0x25, 0x8F, 0x89, 0xE7, 0x7B, 0x98, 0xE9, 0xA4, 0xA8, 0x33, 0xE6,
+        0x9C, 0x4C, 0x11, 0x63, 0x46, 0x52, 0x95, 0xEE, 0xD8, 0x44, 0x11, 0x43,
+        0xEB, 0x41, 0xFB, 0xCD, 0x89, 0x43, 0x49, 0x73, 0x32, 0xEC, 0x9C, 0x53,
+        0x8D, 0x95, 0x97, 0xCC, 0x4C, 0x83, 0x39, 0x02, 0x01, 0x16, 0xD8, 0x05,
+        0x55, 0x94, 0xAA, 0x28, 0x25, 0xEC, 0x25, 0x93, 0x05, 0xCE, 0x27, 0x63,
+        0x1C, 0x6C, 0xD1, 0xF8, 0xA0, 0xDE, 0xFB, 0x7C, 0x23, 0xF5, 0xE9, 0xD8,
+        0x82, 0x7A, 0x2A, 0xB3, 0xF2, 0x63, 0x29, 0xC1, 0xE9, 0x81, 0x4A, 0x35,
+        0xEC, 0xB9, 0x64, 0x4A, 0x9B, 0xEF, 0xFC, 0x92, 0x82, 0x7F, 0x2C, 0x73,
+        0x3A, 0xBC, 0xA5, 0xA0, 0xBC, 0x99, 0xA0, 0xB6, 0x7A, 0xA7, 0x64, 0xB2,
+        0x9D, 0xF7, 0xAF, 0x4F, 0xF1, 0x8D, 0x55, 0xB9, 0xF2, 0x04, 0xFF, 0x1F,
+        0xD6, 0xF9, 0xF4, 0x10, 0x69, 0xF7, 0xD3, 0xE0, 0x43, 0x4F, 0xBF, 0x4A,
+        0x5B, 0xFC, 0xCE, 0x0B, 0x28, 0x2C, 0x48, 0xDB, 0x7B, 0x82, 0xA4, 0x3C,
+        0xBB, 0x3C, 0xC2, 0x1A, 0xEE, 0xA5, 0x05, 0xFB, 0xD9, 0x22, 0x32, 0x33,
+        0x38, 0x69, 0x0D, 0x3F, 0xAC, 0xAC, 0x67, 0x42, 0x61, 0x86, 0x47, 0x7A,
+        0xC0, 0xF1, 0x33, 0x74, 0x0D, 0x38, 0x6D, 0x4C, 0x9F, 0x3D, 0x46, 0xA4,
+        0x42, 0x7C, 0x57, 0x9E, 0x30, 0x11, 0x1A, 0x27, 0xF3, 0x7B, 0x53, 0x6D,
+        0x93, 0x44, 0x27, 0xAA, 0xDB, 0x9B, 0x19, 0xFB, 0x6D, 0xBC, 0x68, 0x85,
+        0x27, 0xC4, 0x89, 0x51, 0x27, 0xE9, 0x3F, 0x6E, 0x66, 0x86, 0x75, 0x48,
+        0xA4, 0xB6, 0x19, 0x83, 0xBA, 0xDE, 0xD0, 0x01, 0x59, 0xB8, 0xB7, 0x6C,
+        0x93, 0x00, 0x86, 0x13, 0x66, 0xB7, 0xEC, 0x4F, 0x02, 0xE2, 0xC1, 0x47,
+        0xC4, 0xA5, 0x86, 0x42, 0xA5, 0xC1, 0xC2, 0x10, 0xE2, 0x8C, 0xCB, 0xEA,
+        0x45, 0xEB, 0x83, 0xD5, 0x6E, 0x2E, 0x06, 0xC9, 0xDB, 0x38, 0xDF, 0x86,
+        0x31, 0xFF, 0x7A, 0x6A, 0xF4, 0x57, 0x5A, 0xE3, 0xB3, 0x2A, 0x0E, 0x46,
+        0x0E, 0x40, 0x06, 0xD3, 0x25, 0x4E, 0x81, 0x0F, 0xF9, 0xDC, 0x55, 0x70,
+        0x74, 0x99, 0xA5, 0xB6, 0x22, 0x3E, 0xAF, 0x61, 0x93, 0xF2, 0x6B, 0xA1,
+        0x60, 0x52, 0xF3, 0x8D, 0xA0, 0x70, 0x3B, 0x4E, 0xB5, 0x04, 0xE4, 0xAA,
+        0x1F, 0x98, 0x6E, 0x20, 0x52, 0x35, 0x22, 0xB8, 0x9B, 0x2E, 0xBD, 0xDD,
+        0x42, 0x16, 0xD2, 0x6D, 0x27, 0x8E, 0x54, 0xC0, 0x2B, 0x97, 0x7B, 0x8C,
+        0xA2, 0x7A, 0x48, 0x46, 0xCF, 0x20, 0xE7, 0x3D, 0x23, 0xF2, 0x74, 0x03,
+        0xEC, 0x13, 0x96, 0xBC, 0x38, 0xD2, 0xA0, 0xFF, 0xD5, 0x8E, 0x51, 0x10,
+        0xE2, 0xBC, 0x5D, 0x81, 0xA6, 0xAC, 0x81, 0x03, 0xF4, 0xEC, 0x2C, 0x97,
+        0x85, 0x04, 0x72, 0x80, 0x31, 0x73, 0x07, 0x10, 0xCF, 0xA4, 0xC6, 0x5F,
+        0x62, 0xE4, 0xF0, 0x00, 0x8C, 0xF8, 0x7B, 0xCE, 0xAB, 0x57, 0x6F, 0xDD,
+        0x64, 0xB1, 0x7E, 0x55, 0xD6, 0xC3, 0x6D, 0xAA, 0xFF, 0xC3, 0x3A, 0xD4,
+        0x2C, 0x40, 0x12, 0x11, 0xE7, 0x10, 0xCE, 0x06, 0xD0, 0x1D, 0x16, 0x00,
+        0x68, 0xF7, 0x8F, 0x86, 0x7C, 0x09, 0xF2, 0x45, 0x9A, 0x44, 0xF6, 0x31,
+        0x9B, 0x8A, 0x95, 0xE1, 0x1C, 0xAA, 0x12, 0x75, 0x45, 0x38, 0x73, 0xD4,
+        0xF2, 0x81, 0x7E, 0xE1, 0x61, 0x0E, 0xA4, 0x76, 0x5F, 0x42, 0x8B, 0x3D,
+        0x10, 0xF4, 0x8E, 0x5B, 0x68, 0x08, 0x65, 0xA2, 0x89, 0xEB, 0xAA, 0xEF,
+        0x85, 0xF5, 0x49, 0xA4, 0x31, 0x25, 0x84, 0x2F, 0xB5, 0xB7, 0xF0, 0x66,
+        0x08, 0x82, 0x0D, 0x4A, 0x16, 0xD1, 0xFD, 0x5C, 0x93, 0xDD, 0x82, 0x07,
+        0xCC, 0xD0, 0x56, 0x03, 0xAA, 0xFE, 0xCA, 0x52, 0xF1, 0x29, 0xC4, 0xFA,
+        0x95, 0xDB, 0x87, 0x46, 0xE5, 0xEC, 0xF4, 0x75, 0x8F, 0x48, 0x27, 0x6B,
+        0xF8, 0x7D, 0xF3, 0x9B, 0x9D, 0x46, 0x36, 0x32, 0x5B, 0x87, 0x30, 0x2B,
+        0xDC, 0x26, 0x2C, 0x37, 0x6F, 0xC1, 0x7E, 0x6D, 0x74, 0x90, 0x0F, 0x06,
+        0xE3, 0x6D, 0xD6, 0x15, 0xE9, 0x2E, 0x08, 0xA7, 0x97, 0xB4, 0x23, 0x4B,
+        0xEC, 0x16, 0xE3, 0xB9, 0x3D, 0x1B, 0x66, 0xD4, 0x25, 0x25, 0xB9, 0x16,
+        0x2F, 0x6C, 0xA5, 0xCB, 0xB2, 0xD8, 0x71, 0x38, 0xF9, 0x45, 0x39, 0x25,
+        0x27, 0xDA, 0x00, 0xA3, 0x59, 0x4A, 0x90, 0x4D, 0xE9, 0xCF, 0x2A, 0xC7,
+        0x6A, 0x45, 0x12, 0x4F, 0x38, 0x88, 0xD9, 0x08, 0xA9, 0x30, 0xB1, 0xA2,
+        0x63, 0xBB, 0x02, 0xDF, 0x1D, 0x09, 0x96, 0xCD, 0x6C, 0x4E, 0x5D, 0x5A,
+        0x70, 0x72, 0x6C, 0x28, 0x25, 0x58, 0xE1, 0xCC, 0x5F, 0x97, 0x92, 0x48,
+        0x85, 0x6F, 0x51, 0xC8, 0x18, 0x56, 0x59, 0xAA, 0xAF, 0xA3, 0x79, 0xDA,
+        0x27, 0xAF, 0x99, 0x98, 0xE4, 0xF9, 0xE5, 0x43, 0xEA, 0x12, 0x51, 0xC3,
+        0x8B, 0xE6, 0xE4, 0x38, 0xF9, 0xCC, 0x36, 0x7D, 0xDF, 0x1C, 0x00, 0x93,
+        0x01, 0x2E, 0xC5, 0x84, 0x49, 0x44, 0x08, 0xB6, 0x34, 0x2A, 0x35, 0x58,
+        0x58, 0xB7, 0x16, 0x4E, 0x69, 0x66, 0x95, 0x6B, 0xD1, 0x9E, 0x0F, 0xA1,
+        0x54, 0xD7, 0x7D, 0x5D, 0x62, 0x3E, 0x20, 0xA9, 0x05, 0x2E, 0x35, 0x49,
+        0x5A, 0x12, 0x2B, 0x30, 0x7E, 0x6D, 0x4E, 0x34, 0x2D, 0x81, 0x78, 0x57,
+        0xDC, 0xC9, 0x3B, 0x24, 0xB5, 0x81, 0xB0, 0x58, 0x71, 0xF3, 0x19, 0x2A,
+        0x71, 0x34, 0x2C, 0x3F, 0xE8, 0x8B, 0xC8, 0x09, 0x39, 0xD9, 0x49, 0xCF,
+        0x55, 0xB1, 0x64, 0xF0, 0x9D, 0x7C, 0x89, 0xDD, 0xE8, 0x5E, 0x4A, 0x29,
+        0x52, 0xFF, 0xA5, 0x54, 0xC3, 0x27, 0x0D, 0x82, 0x5F, 0xE0, 0xB1, 0xF4,
+        0xE9, 0x46, 0xF4, 0xF2, 0x57, 0xE5, 0x7C, 0xB1, 0x0D, 0xC4, 0x0D, 0xDE,
+        0x59, 0xAB, 0x51, 0xF3, 0x40, 0x24, 0x8F, 0x2A, 0x03, 0x69, 0x1A, 0xB9,
+        0x86, 0x88, 0xF9, 0xCF, 0xAD, 0xE1, 0x53, 0x25, 0xF4, 0xBB, 0x44, 0x72,
+        0xFD, 0xA4, 0x48, 0x8C, 0xB3, 0xF4, 0x51, 0x8D, 0x23, 0x91, 0x4C, 0x64,
+        0x48, 0x83, 0x77, 0x2E, 0x01, 0x8F, 0x88, 0xDF, 0x9A, 0x91, 0xF9, 0x89,
+        0x95, 0x17, 0x4D, 0xEE, 0xFC, 0x22, 0xA9, 0x69, 0xB8, 0x6F, 0x34, 0xDE,
+        0x35, 0x76, 0xB7, 0x8E, 0x7D, 0x82, 0x6D, 0x78, 0xAC, 0x9B, 0xD8, 0xD3,
+        0x6E, 0x0F, 0x0F, 0x0A, 0xCC, 0xBB, 0xF2, 0x95, 0xD0, 0xCB, 0xA4, 0x7B,
+        0x6D, 0xB8, 0x54, 0x09, 0xCA, 0x8B, 0xA3, 0xE6, 0x01, 0x8D, 0xD1, 0x45,
+        0xE9, 0x2D, 0x8A, 0xD1, 0xED, 0xA3, 0xEF, 0x8C, 0xDD, 0x0F, 0x40, 0xF0,
+        0x07, 0x52, 0x0B, 0xEE, 0x56, 0x7F, 0x48, 0xDB, 0x85, 0x58, 0x09, 0x7D,
+        0xC4, 0xEC, 0x5D, 0xF4, 0x69, 0x5F, 0x18, 0x95, 0x87, 0x8C, 0x43, 0xAB,
+        0x7E, 0x4B, 0xD9, 0x27, 0xEF, 0x03, 0xF5, 0x3A, 0xFA, 0xEE, 0x06, 0x62,
+        0x88, 0xA7, 0xB4, 0x1E, 0x38, 0x52, 0xC6, 0xC5, 0x5B, 0xD4, 0x88, 0x75,
+        0x0B, 0x10, 0x05, 0x69, 0x17, 0x3B, 0x1B, 0x65, 0xBC, 0x7F, 0x6A, 0x88,
+        0x2D, 0xE4, 0xCE, 0xDC, 0xBF, 0x6C, 0x66, 0x02, 0xD6, 0xF6, 0xD9, 0x2D,
+        0x07, 0x2E, 0xCE, 0x54, 0xA6, 0x2A, 0xD2, 0xB2, 0xC0, 0x56, 0xA4, 0xBD,
+        0x41, 0x41, 0x50, 0x10, 0xDE, 0x1A, 0x9F, 0xF1, 0x3B, 0x8D, 0x6C, 0xCD,
+        0xB9, 0xCE, 0x44, 0x80, 0x22, 0xD9, 0xC7, 0x80, 0x04, 0xC0, 0x40, 0xA7,
+        0x67, 0x82, 0x50, 0x85, 0xBA, 0xBF, 0xF9, 0x33, 0xE5, 0x16, 0x04, 0xC5,
+        0x5A, 0xA1, 0xD1, 0x9C, 0x5E, 0x6C, 0x01, 0x06, 0x7A, 0x7A, 0xBB, 0x4B,
+        0x5C, 0x71, 0x09, 0xD5, 0x5C, 0x7E, 0x11, 0x88, 0x7A, 0x59, 0xD1, 0xC6,
+        0x2A, 0xC0, 0x12, 0xBC, 0x46, 0xA6, 0x56, 0x85, 0x7A, 0xED, 0x8E, 0xA9,
+        0x4E, 0xB6, 0xA1, 0x3D, 0x7D, 0xFB, 0xAE, 0x25, 0x0B, 0xD7, 0xDE, 0x42,
+        0xB7, 0x33, 0x1B, 0x4F, 0x66, 0xD7, 0x17, 0xE7, 0xF5, 0x19, 0x33, 0x34,
+        0x73, 0x60, 0x6F, 0x8F, 0xC2, 0xE3, 0x7E, 0xD8, 0x0D, 0x04, 0x33, 0x3D,
+        0x97, 0xC0, 0x11, 0x35, 0x60, 0x01, 0x30, 0xF6, 0x5D, 0x8E, 0x54, 0xE1,
+        0xBB, 0xC1, 0xE8, 0x2B, 0x9E, 0xD0, 0xF8, 0x11, 0xA2, 0xE4, 0x49, 0x7C,
+        0xD1, 0x7A, 0xB9, 0x28, 0xBF, 0x38, 0x57, 0xA2, 0xFE, 0x5B, 0x24, 0xB6,
+        0xD7, 0xC0, 0x10, 0xA4, 0x25, 0xA0, 0x51, 0x87, 0x91, 0x90, 0x58, 0x8C,
+        0x63, 0xC7, 0xD8, 0xA3, 0xE7, 0x4D, 0xD8, 0xBD, 0xF5, 0x90, 0x63, 0x32,
+        0x7C, 0x66, 0x3A, 0x24, 0x4B, 0xED, 0x16, 0x7D, 0x9E, 0x30, 0xC6, 0x5D,
+        0x9F, 0x8F, 0x5B, 0xA2, 0xD8, 0xC7, 0x74, 0x9F, 0x9F, 0xC5, 0x30, 0xAA,
+        0x2B, 0xBD, 0x23, 0x5E, 0xCB, 0xF8, 0x34, 0x31, 0x6D, 0x1E, 0x07, 0x94,
+        0xF2, 0xD7, 0x2C, 0xB1, 0x69, 0xE4, 0xD4, 0xE0, 0xBF, 0xA1, 0x02, 0x19,
+        0x5B, 0x6F, 0x3D, 0xC5, 0x14, 0xC1, 0x58, 0xF5, 0x6D, 0x68, 0x34, 0x39,
+        0x8C, 0xB2, 0xD8, 0x38, 0x27, 0x56, 0xC6, 0x4A, 0x59, 0x17, 0x04, 0x86,
+        0xF0, 0x5C, 0xE1, 0xEE, 0x3C, 0x2D, 0xBD, 0x3F, 0x94, 0x1D, 0x6F, 0x2B,
+        0xBF, 0xEC, 0xEE, 0x6F, 0x38, 0x4D, 0x48, 0x4A, 0x03, 0x8E, 0x1D, 0x0C,
+        0xDB, 0xB3, 0x98, 0x9E, 0x6F, 0xA2, 0xF9, 0x3E, 0xCD, 0x64, 0x4D, 0x7A,
+        0x23, 0x8E, 0x29, 0xC3, 0xB4, 0xF5, 0x4F, 0x0B, 0x5D, 0xFD, 0xF5, 0xBC,
+        0xCC, 0x76, 0x61, 0x4E, 0x7E, 0xF6, 0x53, 0x16, 0x9A, 0x27, 0xE7, 0xDF,
+        0x35, 0x5C, 0x32, 0x83, 0xF6, 0x1F, 0x70, 0x13, 0x16, 0x6A, 0xDD, 0x8F,
+        0x8A, 0xC4, 0x51, 0x70, 0x56, 0xFC, 0x5C, 0x0E, 0x55, 0x22, 0xAA, 0x34,
+        0x6C, 0x54, 0x20, 0x9E, 0xA7, 0xF2, 0xEA, 0x3B, 0x28, 0x2D, 0xDE, 0x16,
+        0x4B, 0xD1, 0xFD, 0x93, 0xCE, 0x2B, 0x3D, 0xB7, 0x53, 0xA9, 0x7D, 0x42,
+        0x69, 0xD1, 0x59, 0x53, 0x9E, 0x00, 0xD3, 0xEE, 0x6F, 0xD7, 0xC9, 0xDA,
+        0xCC, 0x17, 0xA7, 0x59, 0xEC, 0xB5, 0x2F, 0x32, 0x15, 0x1A, 0x16, 0x5E,
+        0xA6, 0xF5, 0x51, 0x15, 0x44, 0xED, 0x63, 0x01, 0xBB, 0xD2, 0xB6, 0xEA,
+        0x65, 0x03, 0x15, 0x22, 0xA1, 0x26, 0x50, 0xB6, 0x04, 0x6D, 0x69, 0xCE,
+        0x9A, 0x86, 0x71, 0x56, 0x53, 0xA0, 0x31, 0x36, 0x69, 0x45, 0xE9, 0xDF,
+        0x60, 0xD3, 0x45, 0xFE, 0x85, 0xE8, 0xA9, 0x64, 0x9C, 0xAF, 0x58, 0xB4,
+        0x76, 0xC2, 0x7A, 0xD2, 0xD2, 0x5E, 0x8C, 0x2C, 0x50, 0xEF, 0x9D, 0x8C,
+        0xD2, 0x0E, 0xB0, 0xA1, 0x31, 0xC1, 0xFA, 0x60, 0x36, 0x29, 0xC2, 0xBD,
+        0x89, 0x10, 0x44, 0x80, 0x5D, 0x2A, 0xE4, 0x7D, 0xB5, 0xDE, 0xD9, 0x67,
+        0x05, 0x52, 0x46, 0x92, 0x74, 0x6E, 0x17, 0x1C, 0x00, 0xCB, 0xC8, 0x3F,
+        0xC6, 0x63, 0xE1, 0xE2, 0xE1, 0x22, 0xA3, 0xBF, 0xF3, 0x35, 0x39, 0xA1,
+        0x91, 0x3D, 0xC7, 0x68, 0xCD, 0x5A, 0x0E, 0x32, 0x61, 0x68, 0x1C, 0x12,
+        0x74, 0x55, 0x83, 0x6B, 0xA9, 0x6B, 0xD2, 0x35, 0xFB, 0x23, 0x91, 0x92,
+        0xD6, 0xE8, 0xFE, 0x5B, 0x5C, 0xC0, 0x24, 0xE8, 0x83, 0xF4, 0xCD, 0x80,
+        0x29, 0x51, 0xA7, 0x5C, 0x78, 0x3F, 0x4C, 0x4E, 0x48, 0x67, 0x69, 0x86,
+        0xB7, 0x0A, 0x09, 0x15, 0x83, 0x48, 0xB8, 0x76, 0x02, 0x99, 0x67, 0x47,
+        0x1F, 0xD1, 0xDD, 0x3D, 0x42, 0x99, 0xF8, 0xFB, 0xEB, 0xE2, 0xB0, 0xBC,
+        0xEE, 0x45, 0x7E, 0x0D, 0x64, 0xED, 0x11, 0xA1, 0xF7, 0xBB, 0x0E, 0x58,
+        0x8F, 0x33, 0x37, 0x8D, 0x5E, 0xA8, 0xFB, 0xDE, 0xD3, 0x51, 0x8C, 0x12,
+        0x89, 0x5E, 0xED, 0x40, 0xBD, 0x58, 0xFB, 0x28, 0x1A, 0x19, 0xAE, 0x51,
+        0x95, 0xCE, 0xBA, 0x6F, 0x2C, 0x32, 0x60, 0x54, 0xA2, 0xEF, 0x8D, 0xA8,
+        0x8A, 0x20, 0xC9, 0x7D, 0x16, 0x79, 0xD0, 0x08, 0x2B, 0x95, 0x92, 0x68,
+        0x3C, 0x48, 0xF5, 0x87, 0x9F, 0x15, 0xC6, 0x63, 0x8F, 0xDE, 0xD9, 0x17,
+        0xB0, 0xC1, 0x66, 0xFD, 0xF9, 0x5F, 0x7A, 0x0D, 0x60, 0xD9, 0xE0, 0x7C,
+        0x63, 0x74, 0x8C, 0x02, 0x6E, 0xA4, 0x9D, 0xD2, 0xB1, 0x5B, 0x08, 0xED,
+        0x34, 0x7A, 0x1E, 0x3E, 0xAD, 0x0E, 0x1E, 0x0D, 0xE2, 0x6F, 0xE2, 0xB6,
+        0x89, 0x02, 0xA5, 0x94, 0x02, 0x22, 0x2F, 0xF2, 0x1E, 0x1E, 0xF8, 0xCA,
+        0x1A, 0x69, 0x13, 0x6F, 0xD9, 0x5B, 0xB4, 0x75, 0xB1, 0x6E, 0xC2, 0xF2,
+        0xCE, 0xC4, 0xD7, 0x84, 0x2C, 0xEE, 0x24, 0x24, 0xA1, 0x54, 0x30, 0x44,
+        0x3E, 0x47, 0x1B, 0x5B, 0xBD, 0x6D, 0x4F, 0xFF, 0x63, 0xF9, 0x22, 0x97,
+        0x0C, 0xCD, 0x6D, 0xD8, 0x99, 0x6B, 0x7F, 0xF9, 0x6E, 0x60, 0x56, 0xE7,
+        0x13, 0xC5, 0x70, 0xB9, 0x1E, 0xEF, 0x2F, 0xCE, 0x48, 0xF9, 0x1D, 0xEF,
+        0x3C, 0xCA, 0x5D, 0x0E, 0x30, 0x95, 0xF5, 0x51, 0xF6, 0xF0, 0x15, 0x0A,
+        0xC5, 0xF8, 0xFA, 0xC3, 0x5D, 0x0B, 0x8F, 0xF2, 0xB6, 0xCF, 0x57, 0x72,
+        0x9A, 0x9A, 0x9E, 0x3C, 0x72, 0xAA, 0x38, 0x58, 0x81, 0x5A, 0x0C, 0x9F,
+        0xA9, 0xC3, 0xB2, 0x9A, 0x75, 0x0A, 0x60, 0xEC, 0xB9, 0xB4, 0x4A, 0x0F,
+        0x02, 0xF0, 0x4B, 0x1A, 0x88, 0xCB, 0x34, 0x02, 0xE3, 0x94, 0x8D, 0xAB,
+        0xCB, 0xB8, 0xDF, 0xCC, 0x16, 0x50, 0x83, 0x24, 0xC6, 0x13, 0xC3, 0xCE,
+        0x1A, 0xB6, 0xDF, 0xE1, 0x28, 0xF8, 0xF8, 0x49, 0x0D, 0x7D, 0x69, 0xFF,
+        0xF0, 0xD1, 0x4C, 0xD6, 0xFA, 0x5F, 0x71, 0x1B, 0x1D, 0x76, 0x13, 0x23,
+        0xC5, 0x9F, 0xF7, 0x79, 0x17, 0xFF, 0xDC, 0x67, 0x8B, 0x6D, 0x3D, 0xB7,
+        0xFC, 0xA0, 0x37, 0x1D, 0x45, 0xFE, 0x0C, 0xB3, 0x45, 0x02, 0xF0, 0x4F,
+        0xC4, 0xB5, 0x77, 0x4E, 0x52, 0x52, 0xF7, 0x43, 0x97, 0xB9, 0xB8, 0x72,
+        0x47, 0x40, 0x73, 0x7A, 0x2A, 0x32, 0xFA, 0x88, 0x83, 0x94, 0x64, 0x78,
+        0x91, 0xE7, 0x4E, 0x19, 0x5D, 0xE0, 0xC1, 0xE4, 0xF0, 0x74, 0x9A, 0x8A,
+        0x55, 0xBF, 0xB3, 0x10, 0x07, 0xFC, 0xAE, 0x78, 0x04, 0xC2, 0x8F, 0x3F,
+        0x59, 0x75, 0xC7, 0x10, 0x88, 0xC7, 0x2D, 0x67, 0xE4, 0xAA, 0x73, 0x6D,
+        0x46, 0x0B, 0xD2, 0x32, 0xF0, 0xD6, 0xE3, 0xD4, 0x9B, 0xBC, 0x18, 0xC7,
+        0x90, 0x50, 0x81, 0x38, 0x0F, 0x9D, 0x3F, 0xEA, 0x2B, 0x3F, 0x27, 0x39,
+        0xF6, 0xC0, 0x05, 0x7E, 0xE7, 0x14, 0xD3, 0x11, 0x82, 0xCD, 0x70, 0x99,
+        0x80, 0x0D, 0x33, 0x45, 0xBE, 0xBF, 0x7B, 0x7A, 0xEE, 0x08, 0xA1, 0x01,
+        0x21, 0x1C, 0xCE, 0xA1, 0x29, 0x6E, 0xB5, 0xF9, 0xBE, 0x5A, 0xF5, 0x3C,
+        0x74, 0x5E, 0x2F, 0x66, 0x57, 0xD8, 0x76, 0x5E, 0x16, 0xEA, 0x60, 0xCB,
+        0x3F, 0xE3, 0x91, 0x3E, 0x4D, 0x15, 0x06, 0x41, 0x46, 0x30, 0xC7, 0x1A,
+        0x6B, 0xBD, 0x89, 0xFD, 0x4F, 0xB5, 0x2C, 0xE4, 0xCE, 0x15, 0xAB, 0x9A,
+        0xD9, 0xB0, 0xC7, 0x07, 0xFA, 0xAB, 0x86, 0xBE, 0xDD, 0xF5, 0x12, 0x44,
+        0xF3, 0xA2, 0xE2, 0xCA, 0xD0, 0x95, 0x8F, 0x12, 0x32, 0x27, 0xDC, 0xAB,
+        0xE1, 0x7D, 0x99, 0x4C, 0x3A, 0xA3, 0x00, 0x57, 0xCC, 0xAA, 0xDD, 0xD0,
+        0xEE, 0x3E, 0x6C, 0x17, 0x9B, 0x50, 0x75, 0xA6, 0x7B, 0x36, 0xC6, 0x5B,
+        0xFB, 0x91, 0xC7, 0x1A, 0xDA, 0x7E, 0x83, 0x4E, 0x5A, 0x90, 0xED, 0xE8,
+        0x5C, 0xDE, 0x09, 0xCF, 0xAC, 0x44, 0xB9, 0xFD, 0x7B, 0xA8, 0x5D, 0x0D,
+        0x9E, 0x75, 0xA3, 0x83, 0xC2, 0x5E, 0xCB, 0xE9, 0xB3, 0xD1, 0x57, 0xF8,
+        0x92, 0x7F, 0x03, 0x35, 0xCE, 0xBF, 0xF8, 0xB9, 0x56, 0xA9, 0x05, 0xF6,
+        0x96, 0xF7, 0xF3, 0xD0, 0x38, 0xF4, 0x1E, 0xA7, 0x96, 0x97, 0x5C, 0xBA,
+        0x15, 0x9E, 0x77, 0xB9, 0x0E, 0xFB, 0xC9, 0xD6, 0xDB, 0x94, 0xED, 0x8A,
+        0xFF, 0x4A, 0x50, 0xAF, 0x85, 0x0D, 0xF2, 0x8E, 0xAE, 0x31, 0xEB, 0x82,
+        0xAE, 0x5E, 0xAB, 0x7B, 0xFD, 0xCF, 0x3C, 0xBA, 0xA3, 0xEC, 0x00, 0xE0,
+        0x5D, 0x28, 0xD9, 0x41, 0x65, 0xB1, 0x4E, 0x4B, 0x16, 0x79, 0x63, 0x27,
+        0x33, 0xEA, 0xBF, 0xA5, 0xA2, 0x86, 0x75, 0x03, 0x6B, 0x81, 0xB3, 0x6B,
+        0x34, 0x16, 0x19, 0x29, 0x52, 0x62, 0x73, 0x64, 0x8D, 0x12, 0x08, 0x0B,
+        0x54, 0xE0, 0xB1, 0x02, 0x29, 0x4C, 0xDD, 0xE0, 0x84, 0xBC, 0x7E, 0xE3,
+        0x7A, 0x0C, 0xCF, 0x85, 0x60, 0xC5, 0x8D, 0x3A, 0x46, 0xF8, 0xBD, 0x77,
+        0x9A, 0x45, 0xD8, 0x4A, 0x74, 0xB8, 0x90, 0x60, 0x07, 0xD9, 0xCF, 0x07,
+        0x0A, 0xCE, 0xE7, 0xCD, 0xEC, 0x82, 0xD2, 0x17, 0x40, 0x88, 0x27, 0x99,
+        0x17, 0xF3, 0xD0, 0xB3, 0x17, 0x93, 0x8D, 0xB3, 0x72, 0xB6, 0x00, 0x3B,
+        0xB0, 0xE0, 0xA0, 0x1E, 0x46, 0xFB, 0xB6, 0x60, 0xAA, 0x25, 0x9E, 0xD2,
+        0xB6, 0x75, 0xA1, 0x71, 0xB1, 0xB5, 0x4E, 0x1C, 0x83, 0x2B, 0x19, 0xF7,
+        0x5F, 0x08, 0xB6, 0x95, 0xD3, 0x24, 0x4C, 0xC3, 0x22, 0x5A, 0xFB, 0xFD,
+        0xF0, 0x27, 0x46, 0x8F, 0xEE, 0x51, 0x2C, 0xF7, 0xE4, 0x77, 0xC2, 0x06,
+        0x70, 0xDF, 0xCD, 0x4C, 0xB3, 0x71, 0x19, 0xCF, 0xC4, 0x91, 0x33, 0x3C,
+        0xD3, 0xD2, 0x94, 0xF3, 0xBD, 0x75, 0x2E, 0x91, 0x25, 0x72, 0x2E, 0x97,
+        0x1A, 0xCD, 0xF3, 0x0B, 0x8A, 0x24, 0xC9, 0xEA, 0xBF, 0x88, 0x87, 0x2E,
+        0x74, 0x2D, 0x1A, 0xED, 0x39, 0x03, 0x72, 0xAF, 0x42, 0xA4, 0x97, 0xC2,
+        0xBE, 0x1B, 0x60, 0xA8, 0x5F, 0x97, 0xE8, 0xBA, 0xB1, 0xBC, 0x15, 0x4C,
+        0xB7, 0x9A, 0xAE, 0xA4, 0x77, 0x4E, 0x69, 0x94, 0xBE, 0x24, 0x22, 0x30,
+        0x06, 0xBA, 0xB9, 0x21, 0xC7, 0xBC, 0x11, 0x8C, 0xAE, 0x3F, 0xD8, 0xF0,
+        0x49, 0x9A, 0xD5, 0xBE, 0x00, 0xC7, 0xCF, 0xE0, 0x3A, 0x59, 0x3C, 0x4E,
+        0x4E, 0x06, 0x20, 0x56, 0x68, 0x0D, 0xE8, 0x98, 0xF7, 0xD7, 0x82, 0xE7,
+        0x94, 0x0C, 0xFB, 0xAE, 0xB9, 0xD5, 0x73, 0xA3, 0xF1, 0x8F, 0x4C, 0xB1,
+        0x38, 0x4A, 0x20, 0x6E, 0x6C, 0xA8, 0x6A, 0xDA, 0xB4, 0x49, 0x6E, 0x90,
+        0xB3, 0x20, 0xA6, 0x35, 0x2E, 0x09, 0xD0, 0x88, 0x36, 0xC7, 0x79, 0x8B,
+        0x6C, 0x0F, 0x78, 0xB7, 0xE0, 0x89, 0x3B, 0x28, 0x6E, 0xD3, 0x31, 0xA0,
+        0x3C, 0xD2, 0x21, 0x77, 0x6A, 0x1D, 0x63, 0x91, 0x0F, 0x4F, 0x2F, 0xCD,
+        0x1C, 0x7A, 0xC7, 0x39, 0xEC, 0x9E, 0x24, 0x6E, 0xF6, 0x21, 0x75, 0x54,
+        0x0D, 0x99, 0x3A, 0xD3, 0xBB, 0x25, 0x08, 0x34, 0x58, 0x7D, 0x92, 0xA3,
+        0xAF, 0x4F, 0x96, 0x55, 0x0F, 0x94, 0xD0, 0xDF, 0x71, 0x08, 0x15, 0x82,
+        0xED, 0x38, 0x26, 0x16, 0x65, 0x7C, 0x7D, 0x5F, 0xF1, 0x8C, 0xA6, 0x87,
+        0xC3, 0xAC, 0x27, 0xC4, 0x3E, 0x0F, 0x01, 0xD7, 0x01, 0x65, 0xAF, 0x8D,
+        0xC3, 0x44, 0x38, 0xAB, 0x83, 0x16, 0x4C, 0xFA, 0xD8, 0xD6, 0xA4, 0x7E,
+        0x7D, 0xB6, 0x9C, 0x9C, 0x52, 0xC2, 0x7B, 0xA2, 0x82, 0xD7, 0xB3, 0x7F,
+        0x8F, 0xB5, 0xF1, 0xB1, 0xC9, 0x95, 0xD8, 0x85, 0x2A, 0x7A, 0xB7, 0x45,
+        0x4F, 0xA0, 0xA9, 0x84, 0x5A, 0x05, 0xCA, 0x0A, 0xB0, 0x16, 0x39, 0xDD,
+        0x01, 0xDB, 0xDB, 0xA4, 0x62, 0x60, 0x70, 0xFF, 0xA6, 0x73, 0x66, 0x44,
+        0x75, 0xD0, 0x19, 0xB0, 0x0F, 0xE2, 0x49, 0x67, 0x20, 0x42, 0xEE, 0x88,
+        0xC3, 0x8E, 0xD8, 0xD2, 0x4D, 0x39, 0x8D, 0xD9, 0x89, 0x55, 0x8F, 0xE3,
+        0x1C, 0x77, 0x91, 0x38, 0x4B, 0xB0, 0x36, 0x01, 0xAC, 0x9D, 0xBC, 0xAC,
+        0x87, 0x59, 0xED, 0x40, 0x2A, 0x20, 0x08, 0xC0, 0x30, 0xCB, 0x79, 0x79,
+        0x9D, 0x54, 0x22, 0x3A, 0xD8, 0xA4, 0x81, 0x63, 0xB4, 0xD2, 0x9D, 0x35,
+        0x05, 0xDA, 0x16, 0x9A, 0xC8, 0xA6, 0xDD, 0x8A, 0xF8, 0x50, 0x1B, 0xD4,
+        0x67, 0x81, 0x9C, 0x1E, 0x7D, 0x41, 0xFB, 0x1C, 0x05, 0xC8, 0x0A, 0x31,
+        0x0D, 0x83, 0x9E, 0x07, 0xCB, 0x61, 0x21, 0x4F, 0xAE, 0xBB, 0x15, 0x23,
+        0x06, 0x1A, 0x47, 0x52, 0xD7, 0x3B, 0x14, 0xDE, 0x70, 0xE1, 0x02, 0x52,
+        0x9A, 0x13, 0xA3, 0x7A, 0x44, 0xD0, 0x27, 0x32, 0xC1, 0xE2, 0x0E, 0x46,
+        0x6B, 0x36, 0xC2, 0x39, 0xFD, 0x48, 0x04, 0x78, 0xD3, 0xBC, 0x74, 0x8A,
+        0xFF, 0x84, 0xC9, 0xC1, 0xD4, 0x0A, 0x44, 0x65, 0x69, 0xBA, 0x28, 0x0A,
+        0x84, 0x54, 0xDF, 0xDE, 0x47, 0x00, 0x8E, 0xDB, 0x86, 0x02, 0x37, 0x58,
+        0xB5, 0x13, 0xDD, 0x28, 0x57, 0x8C, 0xA5, 0x36, 0x5A, 0x50, 0xB2, 0xF7,
+        0x73, 0xBF, 0xB5, 0xBE, 0x55, 0xE3, 0xED, 0xEF, 0x6A, 0x53, 0x46, 0x01,
+        0xE1, 0x49, 0x37, 0xE7, 0x61, 0x71, 0xAC, 0xF5, 0x03, 0x8E, 0xDB, 0x10,
+        0xE3, 0xD5, 0x92, 0x28, 0xC4, 0xC5, 0x82, 0xB9, 0x20, 0xAE, 0xC8, 0xFB,
+        0x95, 0x82, 0x83, 0x78, 0x3C, 0xE1, 0x4C, 0x46, 0x1F, 0x16, 0xC0, 0x5D,
+        0xEB, 0x6C, 0xA1, 0x6F, 0x11, 0x75, 0x47, 0xF0, 0xB5, 0xBE, 0xDD, 0x1D,
+        0xA4, 0xD0, 0xB8, 0x0C, 0x48, 0x28, 0x8F, 0xF6, 0xC7, 0xEA, 0xF8, 0x63,
+        0xC4, 0xF7, 0x29, 0x16, 0x76, 0x31, 0x94, 0x14, 0x7A, 0x7E, 0x71, 0x60,
+        0xB5, 0xD5, 0x1C, 0x36, 0x13, 0xA7, 0xDB, 0xF7, 0xCD, 0xE0, 0x53, 0x70,
+        0x2E, 0x20, 0xCC, 0x46, 0x2E, 0x28, 0x14, 0x25, 0x70, 0xFB, 0xC4, 0x08,
+        0xC0, 0xF5, 0x8E, 0xAE, 0x4F, 0x0E, 0x9A, 0xCD, 0xD0, 0x06, 0x5D, 0xA5,
+        0x44, 0xE3, 0x12, 0x37, 0x71, 0x86, 0x62, 0x63, 0x44, 0xBF, 0x19, 0x46,
+        0x58, 0x82, 0x19, 0x24, 0x74, 0x59, 0x45, 0xF7, 0x46, 0x6B, 0xFD, 0x85,
+        0x07, 0x24, 0xB5, 0xC6, 0x65, 0xB2, 0x5E, 0x2E, 0x16, 0x0E, 0x62, 0xEB,
+        0x8D, 0x28, 0x62, 0xEF, 0x3E, 0x69, 0xF7, 0x26, 0x65, 0x64, 0x02, 0x89,
+        0x9E, 0xAF, 0x80, 0xFE, 0x79, 0x4C, 0x6F, 0x76, 0x2A, 0xD0, 0x4F, 0x37,
+        0x41, 0x7D, 0x4B, 0xD6, 0x71, 0x09, 0xCB, 0x57, 0x72, 0xB8, 0xAC, 0xF4,
+        0xE1, 0xB0, 0x90, 0x9B, 0x2B, 0xD7, 0xD4, 0xB4, 0xBB, 0xAF, 0xC0, 0x79,
+        0x6F, 0x2D, 0xD6, 0xEB, 0x21, 0x24, 0xB6, 0x10, 0x25, 0x0F, 0x91, 0x57,
+        0x77, 0xEC, 0x8F, 0xB0, 0xFF, 0xCD, 0x7E, 0x1C, 0x17, 0xF3, 0xE7, 0xB3,
+        0x76, 0x98, 0xAB, 0x66, 0x5F, 0x1B, 0x62, 0x7B, 0x69, 0xE3, 0x1B, 0x45,
+        0xC7, 0x86, 0xC0, 0x77, 0x21, 0x42, 0xDE, 0xFA, 0x4B, 0x27, 0x82, 0x7A,
+        0x80, 0x5C, 0x84, 0xAB, 0x37, 0x3A, 0x76, 0x2B, 0xBD, 0x03, 0xA9, 0xF5,
+        0xB4, 0x6F, 0xEF, 0xB9, 0xEF, 0xB4, 0x5E, 0x0B, 0xC7, 0x98, 0x2C, 0x3E,
+        0xD1, 0x33, 0x73, 0x7A, 0x1D, 0x63, 0x4B, 0xF6, 0x2F, 0xDA, 0x20, 0x90,
+        0xE2, 0xA1, 0x5D, 0xC9, 0x8D, 0x8E, 0x2A, 0x8A, 0xE4, 0x89, 0xF6, 0xFE,
+        0x53, 0x95, 0x35, 0x3A, 0x0C, 0xA9, 0xAC, 0x82, 0x80, 0x60, 0xC7, 0x89,
+        0xD9, 0x27, 0x7D, 0x6A, 0xCD, 0x8D, 0x2D, 0x4A, 0xA5, 0x79, 0x28, 0x56,
+        0x84, 0x4C, 0x73, 0x63, 0xED, 0x7F, 0x62, 0x4C, 0xB3, 0xB6, 0xD2, 0x40,
+        0xAF, 0x29, 0x99, 0x34, 0xBF, 0x67, 0xBA, 0xA7, 0x2C, 0x8C, 0xD5, 0x58,
+        0x9E, 0xD4, 0x9C, 0xBD, 0xF5, 0x91, 0x86, 0x63, 0x85, 0xF6, 0x62, 0x99,
+        0x34, 0x5B, 0xEB, 0x2F, 0xDE, 0x2A, 0xFF, 0x12, 0x11, 0xAE, 0xDB, 0xAD,
+        0x8A, 0x79, 0x63, 0x1E, 0xCC, 0xAC, 0xF3, 0xA5, 0x4F, 0xFC, 0xB4, 0x2C,
+        0xC6, 0xFE, 0x09, 0x73, 0xCB, 0x22, 0x40, 0x3E, 0x8A, 0xB9, 0x33, 0xD8,
+        0x24, 0x32, 0x65, 0x63, 0xF7, 0xD6, 0x54, 0xF5, 0x6C, 0xDA, 0x89, 0xB1,
+        0xC5, 0x4C, 0xFD, 0x91, 0x09, 0x9F, 0xD3, 0xF5, 0xBC, 0xB5, 0x21, 0x14,
+        0xDF, 0x55, 0x71, 0xE9, 0x4A, 0x5D, 0xAF, 0x33, 0xFC, 0x97, 0x0B, 0x5F,
+        0x4A, 0x9B, 0x38, 0x93, 0x32, 0x1F, 0xD4, 0x1D, 0x9B, 0xC7, 0x13, 0x11,
+        0xF6, 0x8E, 0xC3, 0x89, 0x2D, 0xD0, 0xB0, 0xFA, 0x57, 0xD4, 0xF4, 0xF4,
+        0x62, 0x40, 0xAA, 0xDB, 0xC5, 0x00, 0x4B, 0xFA, 0x8E, 0x31, 0x5C, 0xE9,
+        0x21, 0x4B, 0xC8, 0x89, 0x11, 0x55, 0x3C, 0x74, 0x5B, 0x34, 0xE0, 0x9A,
+        0x54, 0x07, 0xC3, 0x5A, 0x8B, 0xDC, 0x8E, 0xDE, 0xE8, 0xAC, 0xA1, 0xB7,
+        0xA4, 0x6C, 0x82, 0x2E, 0xE4, 0x62, 0xD5, 0xF1, 0x83, 0x8A, 0x94, 0x0A,
+        0x92, 0x4C, 0xB3, 0x1E, 0x6A, 0xF3, 0x59, 0x57, 0x9F, 0x9E, 0x64, 0xE8,
+        0xB6, 0xC2, 0x02, 0xC2, 0x4E, 0xDB, 0x78, 0x7C, 0x01, 0x18, 0xBA, 0xBF,
+        0x61, 0x18, 0x34, 0xBC, 0x86, 0xA7, 0x88, 0xDF, 0x54, 0x87, 0xA8, 0x3D,
+        0xF5, 0x69, 0x5D, 0x8B, 0x93, 0x7B, 0x4F, 0x6A, 0x03, 0x57, 0xAB, 0xB5,
+        0xF0, 0xF8, 0x7B, 0x9F, 0x34, 0xF5, 0x1C, 0x5E, 0x16, 0xC4, 0xD7, 0x05,
+        0xA1, 0x96, 0x3C, 0xD7, 0x75, 0xBB, 0xB4, 0x3A, 0xEF, 0x08, 0x3C, 0xCE,
+        0x64, 0x81, 0x67, 0x9E, 0x2B, 0x04, 0x1C, 0xB0, 0xDF, 0x06, 0x47, 0x3C,
+        0x59, 0x3B, 0xFF, 0x67, 0x97, 0x60, 0x61, 0x40, 0x30, 0x1A, 0xF2, 0x98,
+        0x8E, 0x22, 0xEB, 0x6B, 0xB2, 0xED, 0x37, 0xB4, 0xFA, 0x02, 0xAE, 0xD2,
+        0x4A, 0x28, 0xB3, 0x60, 0x1A, 0x00, 0xCF, 0x8C, 0x1A, 0xDA, 0x47, 0xE3,
+        0x32, 0x55, 0x62, 0x0F, 0xB9, 0xE1, 0xB5, 0x86, 0xB4, 0x0F, 0xCE, 0x06,
+        0x67, 0x90, 0x11, 0x57, 0xED, 0xF8, 0xAB, 0xE3, 0x25, 0xD3, 0x7A, 0x1F,
+        0x2F, 0x56, 0x6F, 0x52, 0xC3, 0x6A, 0x0D, 0x11, 0x6C, 0x7E, 0x06, 0xFD,
+        0x28, 0xA7, 0xE4, 0x29, 0x31, 0x5A, 0x12, 0x6F, 0x92, 0xDD, 0xA8, 0x0E,
+        0x8E, 0x6D, 0x2A, 0x7F, 0xF8, 0x7B, 0x22, 0xD6, 0x9C, 0x52, 0xDA, 0xF0,
+        0x72, 0x64, 0xB6, 0xB6, 0xC1, 0xCC, 0x11, 0xAB, 0xCB, 0x3B, 0x3D, 0xA7,
+        0x8C, 0x58, 0x2E, 0x4F, 0x1D, 0xD3, 0x09, 0x09, 0xEC, 0xD7, 0x33, 0xD7,
+        0x86, 0x3A, 0x5E, 0x3A, 0x04, 0x5D, 0x3D, 0xF9, 0x3B, 0x6B, 0xAD, 0xEC,
+        0x91, 0xED, 0x66, 0xF4, 0x12, 0x55, 0xB2, 0xA8, 0xCC, 0xDE, 0x64, 0xC2,
+        0x14, 0xF1, 0x0B, 0x89, 0xC9, 0x37, 0x6D, 0x03, 0xD4, 0x80, 0xF5, 0x8C,
+        0xB5, 0x07, 0xFA, 0xCE, 0xD8, 0x53, 0xD9, 0x65, 0x77, 0x3F, 0xD6, 0xDB,
+        0x9E, 0xA5, 0xDE, 0xAF, 0x75, 0xE0, 0x18, 0x40, 0xCC, 0x56, 0xD9, 0x32,
+        0x82, 0x82, 0xDF, 0x32, 0x4D, 0x57, 0x21, 0xC6, 0xF2, 0xE3, 0xF7, 0x66,
+        0x02, 0x67, 0x9E, 0x83, 0x74, 0x86, 0x4B, 0xBD, 0x47, 0x88, 0x7B, 0x0B,
+        0xA1, 0x01, 0x8E, 0xD1, 0x04, 0x9E, 0x37, 0xA1, 0x73, 0xB8, 0x62, 0x97,
+        0x8A, 0xF1, 0x75, 0xF2, 0x0B, 0x76, 0xE5, 0xDC, 0xB5, 0xD2, 0x9B, 0x04,
+        0x13, 0x2C, 0xD1, 0x1C, 0x79, 0x5E, 0x62, 0xA0, 0xAC, 0x52, 0x02, 0xB8,
+        0x3A, 0x25, 0x48, 0xB4, 0xFF, 0x77, 0x5F, 0xAE, 0x65, 0x81, 0x8B, 0x4B,
+        0xC6, 0x31, 0xA9, 0x41, 0x5F, 0x63, 0x13, 0x84, 0x37, 0xB9, 0x6D, 0x0D,
+        0x09, 0xB1, 0x8F, 0xB8, 0xFE, 0x95, 0x3C, 0xEF, 0x50, 0x04, 0x81, 0x66,
+        0x39, 0xEC, 0x5D, 0xCF, 0x3C, 0x23, 0xE5, 0x5B, 0xD8, 0x44, 0x04, 0xF8,
+        0x04, 0x64, 0xA1, 0xF9, 0x7F, 0x25, 0x35, 0xA1, 0xA6, 0x9C, 0x57, 0x35,
+        0x58, 0xD3, 0x0D, 0xFB, 0x00, 0x6E, 0xBD, 0x5A, 0x73, 0xF1, 0x0B, 0xA2,
+        0x50, 0x10, 0x45, 0xEA, 0xFF, 0x81, 0x1D, 0xDF, 0xB3, 0x0C, 0x1A, 0xB6,
+        0x20, 0xE1, 0x72, 0xD0, 0x93, 0x12, 0x82, 0xEA, 0x29, 0x38, 0xA6, 0x8C,
+        0x12, 0x33, 0x5B, 0x4B, 0xCF, 0x8C, 0x4E, 0x5E, 0x4F, 0x29, 0x48, 0x22,
+        0x73, 0xB9, 0x1C, 0xC6, 0xC6, 0x1D, 0x32, 0x50, 0x33, 0x69, 0xED, 0x86,
+        0xDD, 0xB6, 0x2E, 0xFE, 0x5A, 0x72, 0x0C, 0xBB, 0xAA, 0x57, 0x18, 0x41,
+        0xFB, 0x29, 0x44, 0x01, 0x3B, 0xB6, 0xA1, 0x9B, 0x3C, 0x65, 0x11, 0x57,
+        0x73, 0x1E, 0x30, 0x9A, 0x70, 0xC3, 0x9F, 0xAF, 0xCC, 0x07, 0x1D, 0xE0,
+        0xF0, 0x65, 0xC1, 0x9C, 0xBC, 0x78, 0x07, 0x48, 0xAD, 0x92, 0x99, 0x54,
+        0x24, 0x32, 0x5A, 0x37, 0xF8, 0x38, 0x74, 0xC4, 0x3E, 0xB5, 0xBF, 0xB0,
+        0xE4, 0x50, 0xE7, 0x99, 0x66, 0x56, 0xFB, 0x29, 0x4A, 0xB6, 0x7C, 0x1B,
+        0x9F, 0x6E, 0xED, 0x1F, 0x40, 0x38, 0x8A, 0x9B, 0xE0, 0xAD, 0x9C, 0x51,
+        0xDB, 0x10, 0x44, 0x2A, 0xAD, 0x10, 0x3E, 0xD6, 0x9F, 0x97, 0x24, 0x54,
+        0xA0, 0x34, 0xD9, 0x47, 0x91, 0x2A, 0x95, 0x8E, 0x04, 0x76, 0x3C, 0x9A,
+        0x65, 0xF0, 0x0C, 0xB1, 0x2E, 0x83, 0x33, 0xE7, 0x8F, 0x36, 0x53, 0x02,
+        0xCC, 0x7C, 0x19, 0xBC, 0x82, 0x2A, 0x33, 0x7E, 0xC5, 0xA4, 0x9A, 0x62,
+        0xE7, 0x89, 0xCC, 0xFE, 0x61, 0xF9, 0xFC, 0x13, 0x0E, 0xD6, 0xC3, 0xBA,
+        0x6B, 0x30, 0xA5, 0x40, 0x75, 0xC4, 0x43, 0x2F, 0x81, 0x0C, 0xE6, 0x39,
+        0x63, 0x76, 0x8F, 0x97, 0x0C, 0xCF, 0x97, 0xE3, 0xA1, 0xAB, 0xE7, 0x88,
+        0xE5, 0x9C, 0x59, 0xD4, 0x1D, 0x0F, 0xA7, 0x56, 0xC1, 0xF4, 0x74, 0x3C,
+        0x57, 0x24, 0x07, 0x04, 0x4B, 0xAE, 0x09, 0x6F, 0x76, 0xB0, 0x2B, 0x0E,
+        0x1A, 0x0E, 0xCE, 0x55, 0x7F, 0xB6, 0x8D, 0x18, 0xD5, 0x25, 0xE4, 0x2B,
+        0x3E, 0x1B, 0x29, 0xB4, 0x2C, 0x8B, 0x88, 0x49, 0xC1, 0xCF, 0x1D, 0x38,
+        0xB2, 0x4B, 0xEA, 0x52, 0x5A, 0x82, 0x8B, 0xC6, 0xE3, 0xB9, 0xC2, 0x95,
+        0xA6, 0x1A, 0x89, 0x96, 0x6C, 0xBD, 0x78, 0x74, 0xD3, 0x36, 0xBE, 0x65,
+        0xCF, 0x9C, 0xD8, 0x85, 0x60, 0x0A, 0x73, 0x78, 0x50, 0x5D, 0x4A, 0xDD,
+        0xB2, 0xA5, 0xD2, 0xBA, 0xCF, 0x03, 0xBA, 0xCA, 0xCD, 0x12, 0x68, 0xDD,
+        0xA5, 0x68, 0xBA, 0x90, 0xE5, 0x64, 0x1C, 0x14, 0xF9, 0x7C, 0x48, 0x3A,
+        0x40, 0xC7, 0xEC, 0xFD, 0xA0, 0x31, 0xB5, 0x0A, 0x9A, 0x52, 0x41, 0xB2,
+        0xE1, 0xD5, 0x79, 0xFC, 0xF4, 0x0C, 0x7B, 0xF9, 0x26, 0xBA, 0x92, 0xC3,
+        0x49, 0xDD, 0xF7, 0x46, 0x4A, 0x28, 0xEA, 0x2D, 0xBA, 0xE2, 0xDD, 0x91,
+        0x10, 0x4E, 0x26, 0x25, 0x61, 0x1D, 0x32, 0xB2, 0x75, 0x03, 0xC3, 0x5E,
+        0x20, 0xB6, 0xBB, 0x94, 0x01, 0x6A, 0xFA, 0x44, 0xE2, 0xD5, 0x1B, 0x7B,
+        0x26, 0x2A, 0xD7, 0xCC, 0x75, 0x3E, 0x30, 0xDF, 0x5D, 0x6F, 0xDC, 0x7D,
+        0x98, 0xA9, 0x54, 0x09, 0x38, 0xE3, 0xF3, 0xDD, 0x37, 0x95, 0xC9, 0x40,
+        0x2C, 0x6B, 0x02, 0x4C, 0x3A, 0xED, 0x79, 0x1F, 0xD8, 0xB3, 0x84, 0x9F,
+        0xCB, 0x33, 0x32, 0x21, 0x29, 0x41, 0x46, 0xE0, 0x15, 0x7F, 0x38, 0x4D,
+        0x7F, 0x3F, 0xE3, 0x5D, 0xEB, 0xB3, 0x6E, 0x44, 0x6A, 0xBB, 0xE6, 0xA5,
+        0x16, 0x30, 0x28, 0x2F, 0x0D, 0xCF, 0xC7, 0xAB, 0xF8, 0x3C, 0xD5, 0xA1,
+        0xBE, 0xF8, 0x39, 0xD1, 0xA0, 0xFA, 0x24, 0xB0, 0xAF, 0xC5, 0x8F, 0x33,
+        0xB1, 0xC0, 0xE2, 0x8A, 0x3E, 0x5A, 0x06, 0xD8, 0xDF, 0x31, 0xFC, 0x8B,
+        0x94, 0x25, 0x18, 0xE8, 0x69, 0x60, 0x42, 0x7B, 0x66, 0x52, 0x04, 0x40,
+        0x12, 0x11, 0xD2, 0xD8, 0x64, 0x50, 0x43, 0x32, 0x2B, 0x19, 0xA3, 0x24,
+        0xE9, 0x14, 0x82, 0xE9, 0x8F, 0x38, 0x53, 0x46, 0x14, 0x99, 0x78, 0xCE,
+        0x1C, 0xAD, 0x3F, 0xF1, 0x4B, 0xC1, 0xFF, 0xDE, 0x83, 0xA1, 0xF5, 0x79,
+        0x79, 0x56, 0xBB, 0xB7, 0x39, 0x79, 0xB4, 0xE3, 0xED, 0x59, 0xBB, 0x01,
+        0x43, 0x0D, 0x84, 0x5C, 0x03, 0xD6, 0xDC, 0xCE, 0x22, 0x13, 0xC7, 0xC3,
+        0x32, 0x9B, 0xF8, 0xA2, 0xA4, 0x0D, 0xB4, 0x84, 0x42, 0x1B, 0x6F, 0xA3,
+        0xEE, 0x7C, 0x35, 0x60, 0xDD, 0x64, 0x6F, 0xCB, 0xBF, 0xF6, 0x44, 0xD6,
+        0x70, 0x0C, 0x9D, 0x25, 0x68, 0x61, 0x0F, 0x32, 0xDE, 0xD7, 0x2A, 0x82,
+        0xBB, 0xC2, 0x8C, 0xD4, 0xCB, 0x9E, 0x37, 0x5A, 0xE0, 0xE7, 0x25, 0xE5,
+        0xF8, 0xCE, 0x6D, 0x5F, 0xB3, 0x9F, 0x10, 0xD7, 0x17, 0xE2, 0xF6, 0xCE,
+        0x6D, 0xD2, 0xAE, 0x70, 0xBE, 0x2B, 0x3C, 0x22, 0xB4, 0x3E, 0x9E, 0x76,
+        0x26, 0x9E, 0xC4, 0x17, 0xEF, 0x45, 0x41, 0xBB, 0x2D, 0xF5, 0x5A, 0xFC,
+        0xF0, 0x66, 0x0D, 0xE9, 0x28, 0xFA, 0x9E, 0x01, 0x87, 0x73, 0x43, 0x6B,
+        0x78, 0x6A, 0xF2, 0xA3, 0x2C, 0xE4, 0x7A, 0xF8, 0x2C, 0xCD, 0x1D, 0x75,
+        0xDF, 0x65, 0x65, 0xB6, 0x55, 0xED, 0x0C, 0x31, 0x82, 0xA8, 0x68, 0xEC,
+        0xAD, 0x57, 0xDD, 0xB2, 0x31, 0x4E, 0xD6, 0x5A, 0x69, 0x37, 0xA6, 0xB4,
+        0x31, 0xDE, 0x4F, 0x79, 0x6B, 0xE7, 0xDD, 0x33, 0x43, 0xDA, 0x3F, 0x33,
+        0x7A, 0x64, 0x97, 0x6C, 0x05, 0xC1, 0x2B, 0xA9, 0x04, 0xCB, 0x72, 0x49,
+        0xD1, 0x62, 0x66, 0x98, 0xF6, 0xF4, 0x8B, 0xCB, 0x08, 0xF3, 0x06, 0xEA,
+        0x10, 0x17, 0x8A, 0x79, 0x29, 0xDF, 0x08, 0xFA, 0x14, 0x23, 0x91, 0x89,
+        0x9F, 0x34, 0xBE, 0x67, 0x40, 0xC8, 0x83, 0x14, 0xFF, 0x4E, 0x9D, 0xD6,
+        0xCB, 0x74, 0x0D, 0xA2, 0xAA, 0x27, 0xB2, 0x22, 0x65, 0xBA, 0x72, 0x74,
+        0x95, 0x95, 0xCB, 0x18, 0x25, 0x64, 0xCA, 0x33, 0xF7, 0xB9, 0x9D, 0xAF,
+        0x75, 0x82, 0xBC, 0x0D, 0x98, 0x85, 0x3D, 0x2A, 0x47, 0x6D, 0x62, 0xE5,
+        0x89, 0xE0, 0x8A, 0xC4, 0x9E, 0xA9, 0x65, 0x26, 0xDA, 0x17, 0xB8, 0x05,
+        0xA1, 0x14, 0xE3, 0xB8, 0x2B, 0x19, 0x3D, 0x24, 0x7C, 0xAB, 0x69, 0x32,
+        0xDA, 0xB5, 0x29, 0x6D, 0x72, 0x3D, 0x7F, 0x02, 0xD3, 0x3D, 0x63, 0x3E,
+        0x2C, 0x77, 0xAB, 0x16, 0x5F, 0xBA, 0x26, 0xD5, 0xA6, 0x8C, 0x97, 0x19,
+        0x2C, 0x67, 0x0E, 0xFD, 0x90, 0x96, 0x39, 0x47, 0x31, 0x29, 0x50, 0x4C,
+        0x0B, 0x41, 0x7D, 0xFB, 0x2A, 0x0A, 0x10, 0x8B, 0x0A, 0x4E, 0x50, 0x8C,
+        0xEE, 0xE9, 0xB1, 0x26, 0xF6, 0xC7, 0x65, 0x7E, 0x0D, 0x92, 0xB5, 0xDA,
+        0x7D, 0xFA, 0xD6, 0x75, 0x8C, 0xB7, 0x23, 0x84, 0x63, 0xC6, 0x64, 0x18,
+        0x84, 0x64, 0x85, 0x9A, 0x45, 0x5C, 0x51, 0xBC, 0xFE, 0x38, 0xC6, 0x10,
+        0x55, 0x3C, 0x33, 0x21, 0xBC, 0xAE, 0x4C, 0x05, 0x31, 0x6E, 0xBA, 0x4E,
+        0x11, 0x12, 0x34, 0x28, 0x6A, 0xA5, 0x8C, 0xD0, 0xE6, 0xA3, 0xBF, 0x5C,
+        0xA5, 0x4F, 0xA0, 0xCE, 0xC5, 0xB4, 0xF9, 0x39, 0x2E, 0x54, 0x24, 0xFB,
+        0x43, 0x6E, 0x5B, 0xD2, 0xD3, 0xB0, 0x8F, 0x4A, 0xBF, 0xDA, 0x29, 0x14,
+        0x61, 0xA1, 0x56, 0x94, 0x72, 0x3D, 0x3F, 0xA2, 0x8C, 0x4A, 0x2A, 0xCF,
+        0xD7, 0x24, 0x67, 0x8C, 0x6C, 0x5E, 0x1B, 0xDA, 0xB4, 0xF1, 0x78, 0x8A,
+        0xB6, 0x24, 0x11, 0xB8, 0xEB, 0x63, 0xC3, 0x70, 0xB8, 0x7C, 0x94, 0xB4,
+        0x6A, 0xC6, 0xE6, 0x00, 0x42, 0x42, 0xEE, 0xA1, 0x00, 0x09, 0x0D, 0xF2,
+        0x97, 0x4C, 0x79, 0xDE, 0xA6, 0xBE, 0x78, 0x57, 0xB3, 0xA2, 0xD5, 0xF9,
+        0xAA, 0x7F, 0x44, 0x74, 0x1D, 0xE3, 0x41, 0x9E, 0x95, 0x48, 0xAD, 0x50,
+        0xCB, 0x6E, 0x7D, 0x4A, 0x8C, 0x9A, 0xF7, 0x76, 0x77, 0xFF, 0x15, 0xFA,
+        0x65, 0x6C, 0x6B, 0xD9, 0x6D, 0x0E, 0x9A, 0xCD, 0xD4, 0x51, 0x2E, 0x7B,
+        0xB9, 0x1F, 0xE2, 0x9D, 0x98, 0x43, 0x83, 0xE1, 0xB1, 0x96, 0xD0, 0x83,
+        0xB4, 0xB9, 0x6D, 0x27, 0xA7, 0x59, 0x12, 0x61, 0x3B, 0x51, 0x3C, 0x1D,
+        0x23, 0x0C, 0xDF, 0xD1, 0xF7, 0x62, 0x5F, 0x65, 0x02, 0xA4, 0x3E, 0x39,
+        0xFF, 0x69, 0x27, 0x03, 0xF3, 0x29, 0x9F, 0x06, 0xA7, 0x44, 0xE7, 0x3D,
+        0x94, 0xCD, 0x8B, 0x63, 0x5C, 0xD8, 0x7D, 0xE8, 0xC2, 0x15, 0xBE, 0x87,
+        0x1F, 0x58, 0xF9, 0xB9, 0x48, 0xC1, 0xEE, 0x09, 0xB9, 0xA1, 0x96, 0xA2,
+        0x0C, 0x38, 0x5D, 0x39, 0xB1, 0x01, 0x5B, 0x2A, 0xAB, 0x8D, 0x40, 0xC9,
+        0x5E, 0xD5, 0x9B, 0x14, 0x29, 0xF9, 0xEC, 0xD4, 0x54, 0x2A, 0xF6, 0x3D,
+        0xD1, 0x4E, 0x97, 0x67, 0x21, 0xE5, 0xB6, 0xB4, 0xC2, 0xCD, 0xD6, 0x90,
+        0xF5, 0xD0, 0xF7, 0xF5, 0x3D, 0xDA, 0xDE, 0x98, 0x0F, 0xD7, 0xB6, 0xD7,
+        0xA2, 0xD9, 0xB3, 0x1F, 0xF6, 0x33, 0x50, 0x86, 0x9A, 0x32, 0x7C, 0xCA,
+        0x04, 0x2D, 0xBC, 0x59, 0xF0, 0x89, 0xF9, 0x76, 0x49, 0x81, 0x36, 0xF0,
+        0x9A, 0xB6, 0xC6, 0xB7, 0x54, 0x13, 0x1A, 0x29, 0xC9, 0x16, 0x2E, 0xAA,
+        0xAB, 0x64, 0xE1, 0xE8, 0x77, 0xAA, 0xAC, 0x04, 0xFE, 0xCD, 0x25, 0xB5,
+        0xF1, 0x0A, 0xE4, 0xEE, 0xEF, 0x57, 0xCD, 0x94, 0x65, 0x6E, 0xAD, 0xFC,
+        0x47, 0x53, 0x48, 0x32, 0x75, 0x8B, 0x97, 0xE9, 0xE2, 0xA6, 0xAE, 0x2D,
+        0x8A, 0x78, 0xF2, 0xCC, 0x3D, 0x5E, 0xA1, 0x2D, 0x55, 0xB6, 0x3C, 0x61,
+        0xD8, 0x9D, 0xA2, 0x02, 0xBA, 0x16, 0xAD, 0x94, 0x66, 0x67, 0x9C, 0x87,
+        0xEE, 0x66, 0x5B, 0x7D, 0xCC, 0x86, 0x02, 0xF7, 0x13, 0x01, 0xFA, 0xA4,
+        0x27, 0x1D, 0x08, 0x55, 0x23, 0xA3, 0x8A, 0x18, 0xED, 0xDC, 0x4C, 0x6F,
+        0x87, 0xEB, 0xED, 0x60, 0x50, 0xCA, 0xB0, 0x6C, 0xFE, 0x41, 0x9A, 0xD1,
+        0x28, 0xEE, 0xFA, 0x36, 0x3B, 0xB9, 0x11, 0x67, 0x03, 0x8D, 0x1E, 0xC3,
+        0x32, 0x6F, 0x4A, 0x50, 0x6C, 0xE3, 0xD5, 0xA9, 0x43, 0x5E, 0x0E, 0x84,
+        0xB0, 0xDD, 0x10, 0x2A, 0x98, 0x2F, 0xFE, 0x50, 0xB7, 0x4C, 0x66, 0x6E,
+        0x33, 0x1F, 0xBC, 0xC9, 0x5C, 0x70, 0xC1, 0x85, 0x14, 0x26, 0xE8, 0xEE,
+        0x99, 0x80, 0xA1, 0x9A, 0xD8, 0xD8, 0x9F, 0xEC, 0xE8, 0x23, 0x0B, 0xE8,
+        0xD5, 0x1C, 0xE6, 0x5B, 0xD0, 0x3C, 0x4A, 0xAE, 0xB4, 0x50, 0xCB, 0xB3,
+        0xE5, 0x1C, 0x45, 0xFA, 0x2A, 0x04, 0xDD, 0x79, 0x7A, 0x7B, 0xD9, 0x78,
+        0x4A, 0x22, 0x9A, 0x91, 0xB2, 0xD8, 0xD8, 0x55, 0xC4, 0xDF, 0xF1, 0x7D,
+        0x04, 0xD3, 0xF0, 0x6C, 0x6B, 0xC6, 0xA4, 0x10, 0x9A, 0x06, 0xD4, 0xA0,
+        0xEA, 0xFD, 0xB0, 0x42, 0xA8, 0x84, 0x85, 0x18, 0x8B, 0x5D, 0x53, 0xC8,
+        0xCB, 0x2D, 0x2F, 0xF2, 0xAA, 0xD7, 0x75, 0xAC, 0x1C, 0x02, 0x03, 0x1E,
+        0x9B, 0x52, 0xCC, 0x21, 0x01, 0x43, 0xBA, 0x2B, 0x49, 0xC7, 0x2A, 0x0C,
+        0x7A, 0xC4, 0xE8, 0x85, 0x61, 0x1D, 0x3E, 0x34, 0x05, 0xEB, 0xD1, 0xFF,
+        0x2F, 0x13, 0xB1, 0xB4, 0x3A, 0x79, 0x5B, 0x1D, 0x40, 0x99, 0x1E, 0x07,
+        0xB5, 0x4E, 0xC6, 0x95, 0xB3, 0xB3, 0x07, 0x6A, 0xAC, 0xA9, 0x31, 0xBE,
+        0x17, 0xF3, 0xEB, 0xAC, 0xC7, 0xFC, 0xEE, 0x36, 0xBC, 0xEC, 0xF2, 0xF0,
+        0xF0, 0xB2, 0x9B, 0x55, 0x12, 0x90, 0x91, 0x14, 0xC8, 0x98, 0xB4, 0xE7,
+        0x25, 0x46, 0x22, 0x2E, 0x8D, 0xAA, 0x13, 0x3B, 0x6B, 0x0B, 0x72, 0xFF,
+        0x19, 0x3F, 0x7F, 0x98, 0xE4, 0xB8, 0xA5, 0x84, 0x7C, 0xEC, 0x15, 0x55,
+        0x69, 0x46, 0xC2, 0x35, 0xDB, 0x56, 0x1B, 0x97, 0xFD, 0x17, 0x65, 0xC8,
+        0xD7, 0x14, 0x47, 0xD9, 0xBB, 0xF4, 0x7F, 0xE8, 0xA0, 0x67, 0x4F, 0x43,
+        0x0C, 0x97, 0x1E, 0x5B, 0xA7, 0xB1, 0xAE, 0x16, 0x7B, 0x35, 0xA6, 0xAF,
+        0xD3, 0xA9, 0xF5, 0xF3, 0x6D, 0x3E, 0x7B, 0x61, 0x05, 0xBC, 0xC1, 0x42,
+        0x8A, 0xE1, 0xB3, 0x96, 0xB7, 0x0D, 0xD3, 0x36, 0xBB, 0x93, 0xBC, 0xCD,
+        0xAD, 0x1B, 0x47, 0x4D, 0x2E, 0x79, 0x96, 0x57, 0xC3, 0x32, 0xA7, 0x80,
+        0x76, 0x8E, 0xF5, 0xC3, 0xB8, 0xFF, 0xE1, 0x35, 0x33, 0xCF, 0x20, 0x8C,
+        0x3A, 0x84, 0x10, 0x3B, 0xA5, 0x88, 0x45, 0xDD, 0x98, 0x9F, 0xEE, 0x71,
+        0xAF, 0xAC, 0x46, 0x69, 0x56, 0x9D, 0x7F, 0xB8, 0xCB, 0x6F, 0x3F, 0x94,
+        0x72, 0xBA, 0x03, 0x7B, 0x06, 0x54, 0x1A, 0x35, 0x6B, 0x7D, 0x36, 0xF4,
+        0xFB, 0x1F, 0x56, 0xB3, 0x0A, 0x53, 0x51, 0x6A, 0xAF, 0xB4, 0x12, 0x9A,
+        0x1A, 0x41, 0x28, 0x44, 0x9F, 0xF0, 0x0D, 0x6A, 0x1F, 0x87, 0x35, 0x78,
+        0x01, 0x67, 0x40, 0x9F, 0x22, 0xA0, 0x37, 0x45, 0x44, 0x7A, 0x19, 0x19,
+        0xE4, 0x93, 0x88, 0x57, 0x5F, 0x50, 0x01, 0x97, 0x8F, 0x62, 0xC4, 0xEA,
+        0xC5, 0xFD, 0x82, 0x11, 0x07, 0x07, 0x48, 0x8D, 0x31, 0xC0, 0xC3, 0xA1,
+        0xBB, 0x04, 0x94, 0x31, 0x17, 0xF0, 0x6B, 0xC5, 0x7C, 0x23, 0x70, 0x95,
+        0x22, 0x66, 0xD3, 0xA9, 0xD9, 0x50, 0x7B, 0x2E, 0x24, 0x10, 0x91, 0x3B,
+        0x84, 0x02, 0xBD, 0x63, 0x5B, 0xD6, 0x35, 0x4D, 0xC1, 0xD6, 0xCC, 0x82,
+        0xD2, 0x19, 0x6D, 0xAC, 0xFC, 0xF6, 0xB8, 0xFE, 0xBF, 0x71, 0xD3, 0x79,
+        0x5B, 0xAC, 0x93, 0x07, 0xBF, 0x92, 0x9C, 0xF4, 0x26, 0x7D, 0x38, 0xE8,
+        0x2C, 0x9C, 0xB1, 0x5E, 0xD0, 0x6F, 0x3F, 0x28, 0x36, 0x72, 0x92, 0x5F,
+        0x87, 0xB9, 0x3A, 0x54, 0xAF, 0xED, 0x18, 0xA9, 0x88, 0xF5, 0x78, 0x8B,
+        0x9F, 0xFA, 0x20, 0xAF, 0xAC, 0xA0, 0xE5, 0x0E, 0x7E, 0xE8, 0x96, 0xDD,
+        0x62, 0x10, 0x1E, 0x07, 0x84, 0xF7, 0xD1, 0xF4, 0x09, 0xBC, 0xA1, 0xBE,
+        0x9A, 0xCC, 0xD3, 0x92, 0x06, 0xC7, 0xEB, 0x18, 0x95, 0xF8, 0x0C, 0xD3,
+        0x2B, 0xE1, 0x62, 0xAE, 0xF1, 0x09, 0xF3, 0xCB, 0xD0, 0x86, 0xF6, 0xDD,
+        0xC2, 0x3C, 0xE1, 0x27, 0x13, 0x79, 0x6E, 0x12, 0x3D, 0x84, 0xD6, 0x75,
+        0x6E, 0xDD, 0x12, 0x32, 0x1F, 0x9C, 0x2E, 0x7F, 0x78, 0x32, 0x6F, 0x5E,
+        0x57, 0x6B, 0x93, 0x6D, 0x15, 0xF4, 0x57, 0x84, 0x40, 0xD4, 0x82, 0x71,
+        0xD2, 0x0A, 0x12, 0x50, 0x1C, 0x46, 0x38, 0x80, 0x22, 0xA1, 0x74, 0xE2,
+        0x60, 0x03, 0x3D, 0xFC, 0x3D, 0x47, 0x78, 0xC1, 0xE0, 0x24, 0x05, 0x10,
+        0x67, 0x1E, 0x18, 0x37, 0x12, 0xD0, 0xA9, 0x79, 0x46, 0x8A, 0x47, 0x12,
+        0x70, 0xCA, 0xC9, 0xBA, 0x07, 0xC5, 0x7D, 0x97, 0x59, 0x35, 0xCC, 0x04,
+        0xEC, 0x28, 0x0E, 0x6B, 0xCF, 0x53, 0x65, 0x2E, 0x13, 0x61, 0x11, 0xC3,
+        0x96, 0xAB, 0x73, 0x2D, 0x13, 0x7C, 0x08, 0x47, 0x5A, 0x07, 0x0F, 0x6C,
+        0x66, 0x2B, 0x44, 0xC1, 0xB5, 0x62, 0x2C, 0x0E, 0xD4, 0x28, 0x8B, 0x6B,
+        0x67, 0x8E, 0x92, 0x44, 0xAF, 0x9D, 0xC0, 0xC6, 0xF9, 0x92, 0x91, 0x57,
+        0x5B, 0xFF, 0x26, 0xEB, 0xCA, 0xE2, 0x86, 0xDA, 0x5A, 0x4A, 0xF6, 0x88,
+        0x78, 0x08, 0x7E, 0x60, 0x75, 0x13, 0x34, 0x41, 0x91, 0x3F, 0x85, 0x14,
+        0x87, 0x7D, 0x8D, 0x4B, 0xBA, 0xA3, 0x91, 0x50, 0x7F, 0x80, 0xF9, 0x92,
+        0x2A, 0xC7, 0x0F, 0x2E, 0xBB, 0x32, 0xF5, 0xFA, 0xA1, 0x80, 0xAB, 0x86,
+        0xA4, 0xC1, 0xD6, 0x4A, 0xFE, 0x42, 0x72, 0x44, 0x4F, 0xD9, 0xBD, 0x6B,
+        0xDD, 0xD7, 0x0D, 0x9E, 0xEE, 0x46, 0x8A, 0x62, 0x7C, 0xFD, 0x06, 0x27,
+        0xFA, 0x6F, 0xE0, 0x5A, 0xB4, 0xF6, 0x42, 0xA3, 0xF9, 0xE6, 0xDD, 0x3B,
+        0x0E, 0x2B, 0x5C, 0xB2, 0x16, 0x28, 0x1C, 0xDA, 0x12, 0x72, 0x6D, 0xE8,
+        0xCC, 0x77, 0x76, 0xA6, 0x5A, 0x9E, 0x58, 0x87, 0xF6, 0xFB, 0x39, 0x14,
+        0xD5, 0x54, 0x7C, 0x61, 0x34, 0x15, 0xC2, 0x3C, 0xBB, 0xFE, 0x65, 0xD0,
+        0x44, 0xF7, 0xD9, 0x96, 0x84, 0x9C, 0xB8, 0x22, 0x94, 0x31, 0xB1, 0xF5,
+        0xB8, 0x33, 0x0A, 0x8B, 0x9A, 0x34, 0x6F, 0x71, 0x9E, 0x0C, 0xB3, 0x4B,
+        0x8F, 0x28, 0x65, 0xC8, 0x69, 0xE1, 0xB3, 0x17, 0x8E, 0xA1, 0x17, 0xCA,
+        0x08, 0xB5, 0xCF, 0xB0, 0x88, 0x4A, 0x10, 0xA9, 0xB6, 0x4E, 0xD4, 0x7F,
+        0x26, 0xE6, 0xA0, 0x34, 0x92, 0x38, 0x3F, 0x4A, 0x61, 0x64, 0x55, 0x39,
+        0xA7, 0x76, 0x7F, 0x75, 0x0E, 0xBB, 0xF9, 0x34, 0x27, 0x62, 0xA2, 0xA6,
+        0xF7, 0x84, 0x23, 0xDD, 0x7A, 0x34, 0x8A, 0x91, 0x95, 0x34, 0x53, 0x34,
+        0x9E, 0xB6, 0xAB, 0x9C, 0xE5, 0x05, 0xCC, 0xB7, 0x54, 0xF1, 0xFC, 0x95,
+        0x7C, 0xFE, 0xF2, 0xD1, 0x71, 0xC1, 0xF3, 0x2C, 0x7F, 0xD9, 0xA4, 0xE3,
+        0x67, 0x9E, 0xBF, 0xB2, 0x4A, 0x68, 0x7F, 0xDD, 0xC8, 0xAB, 0xC0, 0xF8,
+        0xDB, 0x7C, 0x9D, 0x4D, 0xA4, 0x55, 0xC6, 0xC6, 0x68, 0xAC, 0x41, 0x84,
+        0x3C, 0x2B, 0x99, 0x4B, 0x53, 0x4C, 0x67, 0x2C, 0x11, 0x51, 0x75, 0x73,
+        0xFB, 0x4A, 0xA6, 0x28, 0x9C, 0x3F, 0xCF, 0xEC, 0x30, 0xFB, 0x87, 0x9C,
+        0x08, 0x17, 0x5F, 0x00, 0x66, 0xB7, 0x2A, 0x37, 0x36, 0x9B, 0x36, 0x86,
+        0x46, 0x38, 0x8E, 0x90, 0x8A, 0x84, 0xC5, 0x2A, 0x1D, 0xA7, 0x23, 0x3A,
+        0xB0, 0x4F, 0x44, 0xF1, 0x5C, 0x6D, 0x6D, 0x64, 0xBC, 0x81, 0x34, 0x08,
+        0xFA, 0x4B, 0xFC, 0x4B, 0xA2, 0xA7, 0x96, 0x4E, 0x97, 0x3E, 0x26, 0x20,
+        0xD3, 0x90, 0x69, 0x14, 0x82, 0xBC, 0x41, 0xC2, 0xE8, 0xA8, 0x44, 0xC3,
+        0x56, 0xD0, 0x60, 0xA3, 0xF2, 0x37, 0x79, 0x12, 0x8D, 0x4C, 0x67, 0x24,
+        0xC1, 0x91, 0x56, 0x31, 0xD3, 0x45, 0x9F, 0xB9, 0x34, 0x4D, 0xF8, 0xB0,
+        0x81, 0xA7, 0x39, 0x72, 0x7E, 0x9E, 0xC6, 0xD3, 0x0C, 0xB1, 0xC1, 0x14,
+        0x20, 0xD3, 0xAB, 0xD6, 0x6E, 0xB3, 0xCF, 0xB9, 0x73, 0x4A, 0x33, 0xE4,
+        0xF3, 0xEC, 0x97, 0x75, 0x59, 0x66, 0xA7, 0x42, 0xA8, 0xDE, 0xCF, 0x46,
+        0x3E, 0xB2, 0x2A, 0x69, 0x11, 0x43, 0x99, 0x70, 0x5C, 0x8B, 0x1F, 0x62,
+        0x76, 0x62, 0x5D, 0xF0, 0xF1, 0x13, 0xA9, 0x4C, 0x33, 0x4C, 0x47, 0x59,
+        0x65, 0x16, 0x45, 0x11, 0xF8, 0x5E, 0xA1, 0xA9, 0x52, 0xFC, 0x20, 0x3F,
+        0xF3, 0xD2, 0x1D, 0xDC, 0x57, 0x45, 0x51, 0x4D, 0xF5, 0x4A, 0xD4, 0x92,
+        0x65, 0xDA, 0x53, 0x2F, 0xFE, 0x4F, 0xCF, 0x8F, 0xFE, 0x28, 0xA4, 0x26,
+        0xF5, 0xC0, 0xEF, 0x3C, 0xF3, 0x6A, 0x66, 0xD2, 0x45, 0xF6, 0x4B, 0x17,
+        0xF6, 0xB0, 0xEC, 0xF5, 0xB1, 0x31, 0x74, 0x72, 0x3C, 0xDA, 0x1B, 0x01,
+        0x23, 0x51, 0x12, 0x33, 0x28, 0x67, 0x5D, 0xF1, 0xD1, 0x1F, 0x47, 0x99,
+        0xC8, 0x64, 0xF4, 0x8F, 0x64, 0x37, 0x51, 0x30, 0x32, 0xE7, 0xBE, 0xAA,
+        0x70, 0x9D, 0x08, 0xC9, 0xA0, 0xC9, 0x4C, 0xCC, 0xC0, 0x3A, 0x69, 0x71,
+        0xF3, 0x5E, 0x9C, 0x57, 0x1F, 0x2C, 0x49, 0xE2, 0x53, 0x3D, 0xB6, 0x24,
+        0x29, 0x1E, 0x5B, 0xA6, 0x0D, 0xFA, 0xC7, 0xD1, 0x82, 0x6B, 0x0F, 0xB3,
+        0xF9, 0x4D, 0xC7, 0x2F, 0x79, 0x43, 0xBE, 0x90, 0x43, 0x87, 0x92, 0x01,
+        0xD1, 0xD9, 0x61, 0x05, 0xDF, 0x7E, 0x66, 0x53, 0x26, 0xD2, 0x1D, 0x05,
+        0xCA, 0xB8, 0xDF, 0xB5, 0x42, 0xFE, 0x0B, 0x8E, 0xF2, 0x70, 0xCC, 0x1C,
+        0x55, 0xBD, 0xBB, 0xD8, 0xF0, 0x89, 0xD0, 0x86, 0xD9, 0xDB, 0x82, 0x99,
+        0x25, 0x85, 0x9A, 0x84, 0xAC, 0xAA, 0x73, 0x19, 0x61, 0xA1, 0x38, 0x06,
+        0x18, 0xDB, 0x04, 0xF8, 0x34, 0x0B, 0x6D, 0x6A, 0xCF, 0xD8, 0x9D, 0x98,
+        0xFB, 0x28, 0x7E, 0xC1, 0x0B, 0x1E, 0xD6, 0xE6, 0x9B, 0x64, 0xE1, 0x26,
+        0xFF, 0x37, 0x7A, 0x6F, 0xA8, 0x30, 0x40, 0xAB, 0xD1, 0x06, 0xBB, 0x9B,
+        0x60, 0x4A, 0x9A, 0xA0, 0x2C, 0x4B, 0xFB, 0x03, 0xE5, 0x89, 0x02, 0xC7,
+        0x9D, 0x2B, 0x37, 0x6C, 0xE9, 0x0F, 0xBF, 0xAB, 0x35, 0xF1, 0x61, 0xE5,
+        0x16, 0xAC, 0x3B, 0x93, 0xAE, 0x1E, 0x96, 0x86, 0xE7, 0x84, 0xA4, 0x09,
+        0x85, 0x71, 0x40, 0x2A, 0xC1, 0xFE, 0xAF, 0x4E, 0x49, 0x5C, 0xEA, 0x3A,
+        0x52, 0xDA, 0x39, 0xDE, 0x83, 0x13, 0xB3, 0xFE, 0x17, 0x7C, 0xED, 0xED,
+        0x0E, 0x7D, 0x4B, 0x4A, 0xBB, 0x4C, 0x5B, 0x3B, 0x81, 0x5D, 0x1A, 0xB8,
+        0x5C, 0x28, 0x5B, 0x3C, 0x94, 0xDE, 0xC7, 0x4B, 0x5D, 0xD0, 0x40, 0xD5,
+        0xBA, 0x9A, 0xFC, 0x3D, 0xAC, 0xF1, 0x85, 0xDD, 0xE1, 0xB5, 0x27, 0x8C,
+        0xC0, 0x09, 0x3B, 0xF1, 0x13, 0x6E, 0x02, 0x27, 0x36, 0x16, 0xE7, 0x1D,
+        0x6D, 0x04, 0x8B, 0x61, 0xA3, 0xFC, 0x76, 0xC0, 0x71, 0x32, 0x66, 0x0D,
+        0x51, 0x03, 0x5F, 0x83, 0x11, 0x95, 0xF1, 0xCB, 0x1E, 0xBD, 0xC0, 0x92,
+        0x9F, 0x44, 0x85, 0x27, 0x84, 0xDB, 0x1C, 0x4D, 0x36, 0x54, 0x43, 0x0C,
+        0x75, 0xC4, 0x93, 0x10, 0x84, 0x67, 0xE2, 0xC7, 0x3C, 0x02, 0xEF, 0xB1,
+        0xFC, 0x18, 0x82, 0xD8, 0xDD, 0x84, 0xE4, 0x67, 0x7C, 0x97, 0x07, 0x52,
+        0x30, 0x66, 0x07, 0xA9, 0x8B, 0x52, 0xFF, 0x1D, 0x8D, 0x8C, 0xF6, 0x96,
+        0x97, 0x93, 0x92, 0x57, 0x7E, 0x89, 0x34, 0xF6, 0xD8, 0xC4, 0x61, 0x2F,
+        0x04, 0x9B, 0x0C, 0xF5, 0x41, 0xE6, 0x5C, 0x0C, 0xEE, 0x54, 0x28, 0x2E,
+        0x5C, 0x9D, 0xD3, 0x37, 0xF9, 0x68, 0x13, 0xA7, 0x18, 0x83, 0x21, 0xC5,
+        0xBC, 0x42, 0x34, 0xA2, 0x93, 0xD8, 0x2C, 0x74, 0xD8, 0xC9, 0x8D, 0xEE,
+        0xB4, 0x1C, 0x26, 0x8C, 0x9D, 0xBD, 0x85, 0x91, 0x44, 0xEA, 0xC1, 0xB0,
+        0x0C, 0xA3, 0xBE, 0xBD, 0x20, 0xCB, 0xBF, 0x06, 0x65, 0x81, 0x66, 0xF9,
+        0xBF, 0xE9, 0x66, 0xA0, 0x63, 0x01, 0x03, 0x49, 0x9D, 0xD6, 0xDC, 0x1D,
+        0xF6, 0xEB, 0x4F, 0x97, 0x27, 0xBD, 0xB0, 0xEA, 0x0D, 0xF6, 0x35, 0xCB,
+        0xC7, 0xC9, 0xE6, 0x49, 0x5D, 0xDC, 0x01, 0x6C, 0x4A, 0x81, 0xE0, 0x64,
+        0x2F, 0xE2, 0x48, 0x1D, 0x98, 0xDC, 0x61, 0xA8, 0x0A, 0x63, 0xE0, 0x8C,
+        0x06, 0xFA, 0x40, 0xE8, 0x34, 0x3D, 0x9A, 0x62, 0x1B, 0xAE, 0xEF, 0xDC,
+        0x03, 0xAE, 0xE4, 0x05, 0x26, 0xDD, 0xD1, 0x36, 0x83, 0x3B, 0x8A, 0x9F,
+        0xA5, 0x26, 0xB1, 0x9F, 0xC6, 0x1C, 0xBF, 0x78, 0xFB, 0xF6, 0xE3, 0xF5,
+        0x7C, 0x43, 0x12, 0x82, 0xF2, 0x9E, 0x7C, 0xAD, 0x1B, 0x34, 0x59, 0x4B,
+        0xE0, 0xF4, 0xD8, 0xF0, 0x2B, 0xA5, 0x97, 0xFD, 0xD1, 0x69, 0xF4, 0xFD,
+        0xE5, 0x46, 0xB3, 0xEC, 0x9D, 0x01, 0x29, 0x5A, 0x90, 0xFF, 0x22, 0xD4,
+        0xFE, 0x20, 0x09, 0xB4, 0xAF, 0xE1, 0x40, 0xDE, 0xE5, 0x3B, 0xC7, 0x53,
+        0x4F, 0x54, 0x4D, 0xC4, 0xCF, 0x2C, 0x90, 0xAA, 0x3A, 0x6A, 0x3E, 0x57,
+        0xF3, 0x71, 0xA5, 0xA4, 0x58, 0x0C, 0x22, 0xAA, 0x2F, 0xEC, 0x91, 0xE4,
+        0x58, 0x4B, 0x85, 0x6F, 0x22, 0x3A, 0x34, 0x93, 0x58, 0xA9, 0x49, 0x3C,
+        0xEE, 0xC4, 0x47, 0x6A, 0xA2, 0xC9, 0x24, 0xED, 0x69, 0xCE, 0x35, 0x1E,
+        0xDD, 0x0B, 0xBA, 0x7F, 0x67, 0x06, 0xB9, 0x30, 0xFB, 0xD5, 0x0F, 0x98,
+        0x61, 0x2B, 0xB8, 0xED, 0xDC, 0x98, 0x16, 0x6B, 0x65, 0x78, 0xCC, 0x7B,
+        0xB6, 0x83, 0x66, 0x1F, 0xA9, 0x53, 0x62, 0x7F, 0xCC, 0x7B, 0x39, 0x4E,
+        0x30, 0x84, 0xB3, 0xCC, 0x53, 0x6F, 0x69, 0xE3, 0x77, 0x9A, 0x58, 0x24,
+        0xED, 0x24, 0xAB, 0x79, 0x2A, 0x22, 0xC3, 0xE3, 0x96, 0x07, 0x71, 0x4C,
+        0x0E, 0xFE, 0xEE, 0xC5, 0x73, 0xE3, 0xFB, 0x77, 0xAC, 0x48, 0x75, 0xFB,
+        0x7B, 0x52, 0x5A, 0xAC, 0x24, 0xE3, 0xEE, 0x91, 0x52, 0x59, 0xBE, 0x93,
+        0xC1, 0x85, 0x62, 0x82, 0xE1, 0xFA, 0x52, 0xFE, 0x24, 0xD5, 0x79, 0x4B,
+        0xC0, 0x45, 0x70, 0xC5, 0xED, 0x88, 0xCE, 0xD8, 0x52, 0xC8, 0x32, 0x45,
+        0xE0, 0x29, 0x8E, 0xFB, 0x2D, 0xAA, 0x9D, 0xEF, 0xC1, 0xE2, 0xEE, 0xBC,
+        0xA5, 0x3E, 0x79, 0x1B, 0xF8, 0xF6, 0x40, 0x7D, 0x99, 0x93, 0x5D, 0x0A,
+        0x05, 0x59, 0x97, 0xA5, 0xBC, 0xF4, 0xFB, 0xB6, 0xAC, 0xAA, 0x11, 0xC7,
+        0xF8, 0xCC, 0xB4, 0x77, 0xC9, 0x10, 0xE0, 0xBB, 0x4C, 0x1A, 0x81, 0x8E,
+        0x5A, 0x87, 0x76, 0x3E, 0xD9, 0xEC, 0x06, 0x69, 0xB6, 0x0C, 0x6F, 0x8D,
+        0x56, 0x6C, 0x64, 0x9D, 0x18, 0x30, 0xB3, 0x8F, 0xBF, 0xFF, 0x09, 0x43,
+        0x8E, 0x58, 0x13, 0x0B, 0xCA, 0xE3, 0x6B, 0x18, 0x14, 0xC2, 0x18, 0x79,
+        0xD6, 0xE1, 0x72, 0x4A, 0x9C, 0x8C, 0x92, 0xD0, 0x77, 0x94, 0xCB, 0x4F,
+        0xC4, 0x3A, 0xFB, 0x82, 0x04, 0x58, 0x62, 0xC2, 0x37, 0x82, 0x33, 0x89,
+        0x8D, 0x62, 0x57, 0x8E, 0xCD, 0xF0, 0xD0, 0xA7, 0xBC, 0x1A, 0x5C, 0x38,
+        0xED, 0xA3, 0x59, 0x6D, 0xD8, 0xE2, 0x3F, 0x67, 0x08, 0xB5, 0x1F, 0x16,
+        0x22, 0xAE, 0xFF, 0x04, 0x82, 0x0D, 0x9D, 0x30, 0xA9, 0x2C, 0xDF, 0x4F,
+        0xBA, 0x78, 0x9E, 0x77, 0x2A, 0x12, 0x92, 0x61, 0x4C, 0xCC, 0xFC, 0x61,
+        0x4F, 0xF1, 0x90, 0x67, 0xA1, 0xEE, 0x4B, 0x3C, 0xBB, 0x65, 0xD2, 0xA2,
+        0xF8, 0xC6, 0xC0, 0x8A, 0xF0, 0x9B, 0x21, 0xA1, 0xCC, 0xD9, 0x0F, 0x7E,
+        0x9E, 0xC2, 0x78, 0x9E, 0x05, 0x7F, 0x82, 0x17, 0xC1, 0x77, 0x28, 0x36,
+        0x87, 0x22, 0x60, 0x65, 0xE8, 0x3D, 0xC5, 0x17, 0x95, 0xF0, 0x6D, 0x56,
+        0xDE, 0x0C, 0xFC, 0x67, 0xF0, 0x20, 0x90, 0x81, 0x34, 0x03, 0xDF, 0x8C,
+        0xBC, 0xD9, 0x28, 0x18, 0xBA, 0x9F, 0x60, 0x83, 0x9A, 0x75, 0x3D, 0x6A,
+        0xA4, 0xF8, 0x89, 0xDA, 0x1A, 0xB0, 0x5C, 0xE9, 0x1C, 0x92, 0x2B, 0xA9,
+        0xE3, 0x49, 0x1D, 0x1D, 0x39, 0x5E, 0xC3, 0x03, 0x5C, 0x55, 0x8D, 0xDB,
+        0x71, 0xAA, 0xB7, 0x8A, 0xC1, 0x32, 0x54, 0x17, 0xFC, 0x21, 0x55, 0xF7,
+        0x8E, 0x14, 0x3A, 0xEB, 0x1C, 0x36, 0x22, 0x68, 0x56, 0x83, 0x8B, 0x48,
+        0x16, 0x2F, 0x3A, 0xF9, 0x22, 0x04, 0x2D, 0x18, 0x8B, 0x38, 0x06, 0x74,
+        0x1B, 0x1E, 0xE4, 0x28, 0x7A, 0x2C, 0xB6, 0x47, 0x9E, 0x6A, 0xCF, 0x22,
+        0x7F, 0x78, 0x82, 0xEE, 0x1A, 0x60, 0xB8, 0xC6, 0x76, 0x61, 0x32, 0x57,
+        0x6C, 0x04, 0x52, 0x3A, 0x52, 0x03, 0x19, 0x78, 0x22, 0x50, 0x98, 0x89,
+        0x55, 0xD6, 0x83, 0x65, 0xC7, 0x1B, 0x4B, 0x49, 0x3A, 0x21, 0x8C, 0x5B,
+        0x41, 0x31, 0x1B, 0xFF, 0x78, 0x15, 0xA1, 0x8C, 0x1B, 0xDF, 0xC2, 0xE8,
+        0xE4, 0x2E, 0x35, 0x90, 0xEA, 0xB7, 0x66, 0xFC, 0x94, 0x23, 0x1D, 0x16,
+        0x79, 0xE7, 0x94, 0xA2, 0x88, 0x1C, 0xA5, 0x45, 0x29, 0x60, 0xD6, 0x01,
+        0x47, 0xB2, 0x31, 0xE1, 0x2D, 0x8D, 0x65, 0xF8, 0xBC, 0xB0, 0x2E, 0x55,
+        0x57, 0x62, 0x36, 0x52, 0x1B, 0xF1, 0xFD, 0x80, 0x75, 0x9C, 0x88, 0x2F,
+        0xB5, 0x83, 0xC1, 0x13, 0x59, 0x8A, 0x17, 0x9B, 0x3A, 0x63, 0xE5, 0xB0,
+        0x48, 0x7A, 0x75, 0xAE, 0x9C, 0xBD, 0xC9, 0x51, 0xF4, 0xCF, 0xFE, 0x45,
+        0x18, 0x02, 0xEA, 0xDD, 0xA2, 0x2D, 0xED, 0xF3, 0x2C, 0x54, 0x90, 0xF1,
+        0x25, 0x6B, 0x43, 0xC8, 0xD5, 0x12, 0x80, 0xCB, 0xDE, 0xE5, 0xE4, 0xB3,
+        0xC8, 0xE4, 0x60, 0x37, 0x38, 0x8B, 0x7F, 0x15, 0xB3, 0x72, 0xD8, 0x72,
+        0xA8, 0xB7, 0x47, 0xE0, 0x4D, 0xC9, 0xBB, 0x1E, 0xE4, 0xB5, 0x89, 0x86,
+        0xCF, 0xAB, 0x97, 0x50, 0x1B, 0x2D, 0xE7, 0x61, 0x06, 0x21, 0x22, 0x11,
+        0x32, 0x1D, 0x11, 0x55, 0x53, 0xFD, 0x83, 0xF8, 0x01, 0x7C, 0x89, 0xE5,
+        0x70, 0x1A, 0xF9, 0x9C, 0x2E, 0x47, 0x59, 0x1E, 0x99, 0xAA, 0x66, 0xB4,
+        0x27, 0xD5, 0xB1, 0x65, 0x23, 0x04, 0xB1, 0xA6, 0x95, 0x45, 0x6C, 0x0F,
+        0xB9, 0x88, 0x15, 0x6D, 0x95, 0x3F, 0x1A, 0x11, 0xA3, 0xDF, 0x59, 0x34,
+        0x62, 0x4B, 0x48, 0x0D, 0x3E, 0xB7, 0x93, 0x71, 0x36, 0xA8, 0xB2, 0x45,
+        0xC4, 0x86, 0x05, 0xFF, 0x25, 0xE5, 0x60, 0xAE, 0xD2, 0x9A, 0xF7, 0x35,
+        0xEB, 0xB9, 0xBA, 0xA0, 0x75, 0x36, 0x63, 0x77, 0xF6, 0xA8, 0xDB, 0x89,
+        0x17, 0x0C, 0x44, 0xCA, 0x04, 0x5C, 0x15, 0x43, 0x8F, 0xE4, 0xD3, 0x3A,
+        0x0B, 0x80, 0xEF, 0x00, 0xB2, 0x77, 0xB0, 0x06, 0x04, 0x93, 0xF3, 0xDA,
+        0xB0, 0x8D, 0x63, 0xD3, 0x76, 0x84, 0xDF, 0x60, 0x43, 0x13, 0x27, 0xF8,
+        0x20, 0x42, 0x51, 0x3D, 0xEC, 0xBB, 0xEF, 0xE3, 0x5C, 0x27, 0xAE, 0x4C,
+        0x89, 0xE5, 0xB1, 0x89, 0x23, 0xAF, 0xF2, 0x4C, 0xF3, 0xB3, 0x8C, 0xB6,
+        0xCD, 0xB1, 0xFA, 0x1C, 0x00, 0xB5, 0xBE, 0xB3, 0x6E, 0x78, 0xA8, 0x92,
+        0x25, 0x09, 0xA1, 0x26, 0x28, 0x69, 0xAC, 0x2A, 0x37, 0x54, 0x8F, 0x78,
+        0x45, 0x49, 0x91, 0xB5, 0x0B, 0xE2, 0xD8, 0x2F, 0x49, 0x74, 0x62, 0x07,
+        0xE3, 0x40, 0x76, 0x51, 0x93, 0xA3, 0xA7, 0xA8, 0xF1, 0xAB, 0x55, 0x42,
+        0x14, 0x0B, 0x5B, 0x02, 0x96, 0x53, 0x5A, 0x4F, 0x4A, 0x56, 0x33, 0xAF,
+        0xA9, 0xD2, 0xA5, 0x2A, 0x12, 0xD4, 0x47, 0x1C, 0x0B, 0xA6, 0x51, 0xEB,
+        0x3D, 0x69, 0x8D, 0x92, 0x3A, 0x4B, 0x4C, 0xE1, 0x4A, 0x9B, 0xEF, 0x13,
+        0xA1, 0x49, 0xDD, 0xF9, 0x00, 0x55, 0xAA, 0xC6, 0x97, 0x4D, 0xCF, 0xB3,
+        0xF0, 0x5B, 0x40, 0xC1, 0x05, 0x63, 0xA2, 0x4E, 0xE6, 0xED, 0x24, 0xD2,
+        0xDF, 0x26, 0xB6, 0xD8, 0x4C, 0x9A, 0xE6, 0xE7, 0x34, 0xC7, 0xB3, 0xF3,
+        0x02, 0xD2, 0x4C, 0x91, 0xAD, 0x48, 0x41, 0xC5, 0x0E, 0x91, 0x56, 0xF2,
+        0x46, 0x19, 0xC3, 0x2A, 0x58, 0x2D, 0x1B, 0xE5, 0x88, 0xE7, 0x52, 0xDA,
+        0x37, 0x27, 0x31, 0x43, 0x18, 0x22, 0x9F, 0x31, 0x63, 0x0E, 0x30, 0x38,
+        0x46, 0x53, 0x5F, 0xB2, 0x9B, 0x32, 0x9B, 0x38, 0x9B, 0x40, 0xE5, 0x87,
+        0x17, 0x82, 0xCD, 0x56, 0x8D, 0xE0, 0x02, 0x64, 0xEF, 0xA7, 0xC5, 0x00,
+        0xEF, 0x08, 0x2F, 0x13, 0x59, 0x99, 0x54, 0x64, 0xF0, 0x29, 0x5C, 0xF9,
+        0x43, 0x07, 0x2D, 0x34, 0x53, 0x0C, 0xA6, 0xA2, 0x6C, 0xFC, 0xD2, 0x79,
+        0x20, 0xB3, 0xCC, 0xD4, 0xC9, 0xD8, 0x48, 0xDE, 0x15, 0x27, 0x70, 0xCC,
+        0xCB, 0xB7, 0xA2, 0x42, 0x64, 0x90, 0xF4, 0x3A, 0xC1, 0x3D, 0xFB, 0x52,
+        0x4C, 0xAC, 0x19, 0x6C, 0xC0, 0x04, 0xAA, 0xD4, 0xB0, 0xFE, 0x21, 0xD7,
+        0xA6, 0x81, 0x56, 0x19, 0x8C, 0x6D, 0x29, 0xA6, 0xF5, 0x0A, 0x8E, 0x95,
+        0x37, 0x68, 0x08, 0x68, 0x8A, 0x72, 0xFD, 0x0D, 0x9F, 0x98, 0xD6, 0x1D,
+        0x4B, 0x4B, 0x36, 0x13, 0xF8, 0xF3, 0xF4, 0x98, 0xF0, 0x51, 0xB3, 0xEC,
+        0xD9, 0x3C, 0xE2, 0x93, 0xAC, 0xCA, 0xA7, 0xCF, 0x50, 0x33, 0x1E, 0x52,
+        0x94, 0xAD, 0xD9, 0x13, 0xE4, 0xCD, 0xEB, 0x27, 0xAA, 0x2C, 0x69, 0x92,
+        0x1C, 0xF6, 0xA3, 0xAC, 0xED, 0x83, 0xEC, 0xD7, 0x17, 0xDE, 0x06, 0xB3,
+        0xB0, 0xF9, 0xDF, 0xFB, 0x30, 0xB7, 0x2E, 0xF6, 0x6C, 0xEA, 0x70, 0xD8,
+        0x54, 0xFD, 0x91, 0x85, 0x33, 0xFD, 0x37, 0xDB, 0xAF, 0xBB, 0x01, 0x0A,
+        0x8E, 0xCA, 0x22, 0x87, 0x05, 0x41, 0x64, 0xE1, 0xC1, 0xEA, 0x64, 0x3C,
+        0x6A, 0x61, 0x34, 0xB2, 0x27, 0x1B, 0x90, 0x06, 0xCC, 0x13, 0xE2, 0xF3,
+        0xD8, 0x50, 0x6B, 0x51, 0xC5, 0x7A, 0x05, 0xAE, 0xDE, 0x24, 0xBD, 0x6B,
+        0xB9, 0xD0, 0x8F, 0x09, 0x1F, 0x77, 0x13, 0xB3, 0xBD, 0x59, 0xC6, 0xE1,
+        0xE7, 0xAC, 0xF8, 0x79, 0x4B, 0x66, 0xA4, 0x23, 0x9D, 0xE2, 0xD1, 0xC2,
+        0x47, 0x6F, 0xC0, 0x03, 0x28, 0x30, 0xFF, 0xFE, 0x78, 0x6F, 0xD9, 0xBD,
+        0x3E, 0x34, 0x03, 0xD1, 0x71, 0x40, 0x80, 0x82, 0x37, 0x1D, 0x7D, 0x13,
+        0xC6, 0x18, 0x6D, 0xD8, 0x41, 0xE5, 0x06, 0xA3, 0xEC, 0xDC, 0xD5, 0x85,
+        0x06, 0xBD, 0x8D, 0x2D, 0x8C, 0x99, 0x03, 0xD5, 0xC2, 0x70, 0x67, 0x1E,
+        0x26, 0x94, 0x94, 0xAD, 0x76, 0x36, 0xF5, 0x16, 0xB6, 0xD6, 0x3A, 0x35,
+        0x0A, 0xB6, 0x31, 0xB0, 0xC7, 0xA9, 0x8E, 0x5C, 0x14, 0x5B, 0xC6, 0xB0,
+        0xE4, 0x20, 0xA2, 0x45, 0xA5, 0x18, 0x62, 0x0B, 0x8C, 0x12, 0x77, 0x48,
+        0x30, 0x86, 0xC4, 0x94, 0x4E, 0x08, 0x53, 0xC2, 0xBD, 0x4C, 0x70, 0x03,
+        0xAA, 0x5C, 0xAF, 0x9C, 0x17, 0x42, 0xB4, 0x70, 0xB3, 0xB0, 0x47, 0xFB,
+        0x73, 0x7D, 0xFA, 0x6B, 0x4A, 0x44, 0x04, 0x36, 0x7F, 0x02, 0x7F, 0xA0,
+        0xC5, 0xEF, 0x5B, 0x70, 0xA7, 0x9E, 0x00, 0xEA, 0xAA, 0x91, 0x1B, 0xF2,
+        0x96, 0xA9, 0x1A, 0xCE, 0xD8, 0x11, 0xBB, 0x02, 0x3A, 0xDD, 0x7E, 0x34,
+        0x13, 0x30, 0x00, 0x52, 0x78, 0x2E, 0x03, 0xCF, 0x1E, 0x04, 0xEC, 0xBD,
+        0x32, 0x24, 0xEB, 0x99, 0xE7, 0xEF, 0x69, 0xE4, 0x9F, 0xCE, 0xD6, 0xFB,
+        0xDD, 0x31, 0x29, 0x08, 0xD4, 0x76, 0x88, 0x6D, 0xAA, 0x5B, 0x74, 0xA9,
+        0xCC, 0x0F, 0x21, 0x24, 0x47, 0xE6, 0x90, 0xB2, 0x60, 0x72, 0x47, 0x69,
+        0xE9, 0x9D, 0x84, 0x86, 0x5B, 0xB5, 0x79, 0xEB, 0xD0, 0xC5, 0xDC, 0xF5,
+        0x16, 0xC1, 0xF8, 0x20, 0x4E, 0x95, 0xEE, 0xC1, 0xEA, 0xB5, 0x4F, 0x35,
+        0xC1, 0xC9, 0xB9, 0x96, 0x5F, 0xDB, 0xF0, 0x50, 0x55, 0x66, 0x12, 0x85,
+        0x7B, 0xF3, 0x91, 0xE0, 0x44, 0x9D, 0x33, 0x8E, 0x9C, 0x9A, 0x79, 0xD6,
+        0x86, 0x4B, 0xE4, 0x6D, 0x79, 0x64, 0xAB, 0xDE, 0x7D, 0xA8, 0xC5, 0xB6,
+        0x42, 0x3A, 0xDE, 0x35, 0x97, 0x6E, 0x93, 0x9F, 0x9F, 0xBB, 0x25, 0x1B,
+        0x26, 0x80, 0xA8, 0xAC, 0xE6, 0x9E, 0x70, 0x52, 0x91, 0xFE, 0x19, 0x55,
+        0xB7, 0x4A, 0x94, 0x47, 0x2A, 0x3E, 0xB3, 0x4E, 0xE7, 0xE7, 0x8E, 0x3C,
+        0xF7, 0x5F, 0x9B, 0xC6, 0x0E, 0x5B, 0x5F, 0x6B, 0x3D, 0x2B, 0x0D, 0x0F,
+        0xB9, 0xD7, 0x44, 0xAD, 0x91, 0x7C, 0x8B, 0xAB, 0x7F, 0x98, 0x4D, 0xC4,
+        0xFD, 0xBA, 0x05, 0x64, 0x69, 0xB3, 0xD0, 0xD6, 0x5F, 0x78, 0x4C, 0x7F,
+        0x48, 0x77, 0x78, 0x0E, 0x35, 0x6F, 0x68, 0xAE, 0x50, 0x1D, 0xA7, 0xC1,
+        0x0E, 0x00, 0x28, 0x3D, 0x13, 0x08, 0x3C, 0x0B, 0x95, 0xB1, 0xC5, 0x54,
+        0xF1, 0x00, 0xB9, 0xA8, 0x0D, 0xAB, 0xE3, 0x3D, 0x45, 0x3B, 0x81, 0x81,
+        0xD3, 0xD1, 0x1C, 0x55, 0x18, 0x02, 0xD1, 0x53, 0x41, 0xB0, 0x7A, 0x0A,
+        0xFD, 0x02, 0x09, 0x8E, 0xE0, 0x7D, 0x3C, 0xF6, 0x24, 0x8B, 0x52, 0x40,
+        0xDB, 0xBD, 0xC5, 0x0A, 0xC3, 0x54, 0x4E, 0x3A, 0x95, 0x35, 0xCD, 0x45,
+        0xCC, 0xE6, 0xC3, 0x8D, 0xA4, 0xEC, 0x24, 0x5B, 0x48, 0x8E, 0x91, 0x58,
+        0xC9, 0x8C, 0xA4, 0x4A, 0xAC, 0xBA, 0x8F, 0x39, 0x51, 0x88, 0x74, 0xD3,
+        0x80, 0xBD, 0x60, 0x00, 0xE3, 0xD2, 0x85, 0x43, 0xCE, 0xCC, 0x7B, 0xD5,
+        0xA8, 0x44, 0x0A, 0xAA, 0x02, 0xD7, 0x17, 0xEA, 0x88, 0x62, 0xD2, 0x5D,
+        0xAD, 0x0B, 0xFE, 0x18, 0xD9, 0xAC, 0x47, 0x9D, 0x0F, 0xF2, 0x0E, 0x82,
+        0xD7, 0xCF, 0xC6, 0x81, 0x77, 0x2B, 0x41, 0x71, 0xE4, 0xF6, 0x90, 0x4C,
+        0xD7, 0xF2, 0x24, 0x8A, 0xC5, 0xDD, 0x64, 0x5B, 0x54, 0x40, 0x39, 0xA9,
+        0x9C, 0x05, 0x53, 0xDA, 0x3B, 0x70, 0xFB, 0xC2, 0xA3, 0x1B, 0x1B, 0xFB,
+        0x1D, 0x77, 0x36, 0xD2, 0x31, 0x4B, 0x1A, 0x45, 0x43, 0xC2, 0xFA, 0x0B,
+        0x32, 0x92, 0x69, 0xDD, 0x59, 0xFA, 0x8F, 0x44, 0x03, 0xB7, 0xFD, 0x2F,
+        0xED, 0x71, 0x1C, 0xD9, 0x86, 0x18, 0xC2, 0x0A, 0xB6, 0x45, 0xFD, 0xA4,
+        0x0B, 0x98, 0x87, 0xD1, 0xE1, 0xD2, 0xA4, 0x4F, 0x8C, 0x09, 0x94, 0x60,
+        0x61, 0x2F, 0x62, 0xB6, 0x28, 0xE0, 0x4D, 0x82, 0xCA, 0xAE, 0x06, 0x9F,
+        0xED, 0x0C, 0x8D, 0x69, 0xEA, 0x18, 0x8B, 0xF6, 0x09, 0xDE, 0x78, 0x9B,
+        0x28, 0x8B, 0x5B, 0x22, 0x10, 0x63, 0xAA, 0xCF, 0x39, 0x62, 0x80, 0xCF,
+        0x35, 0x83, 0x4B, 0xA7, 0xCF, 0x8C, 0x34, 0xB9, 0xBF, 0x0A, 0x53, 0x6B,
+        0x57, 0x07, 0x90, 0x09, 0x46, 0x66, 0x5B, 0x72, 0x68, 0x93, 0xA6, 0xCC,
+        0x7C, 0x01, 0x9B, 0x64, 0x06, 0x0D, 0x40, 0x15, 0x6B, 0x41, 0x0A, 0xAB,
+        0xE1, 0xB0, 0x6A, 0xE3, 0xC6, 0xBD, 0xB8, 0x14, 0x9C, 0xB6, 0x2D, 0x98,
+        0x10, 0x59, 0x07, 0x29, 0x8E, 0x26, 0x1D, 0x1E, 0x6D, 0xA7, 0xA3, 0xF5,
+        0x3F, 0x10, 0xCE, 0x0B, 0x4E, 0xA7, 0x70, 0x97, 0xA3, 0x0B, 0xF6, 0x58,
+        0x42, 0x9D, 0xB4, 0x85, 0x5C, 0x30, 0x36, 0x9D, 0xBA, 0x45, 0x56, 0xCC,
+        0xAA, 0xF8, 0x83, 0xB2, 0x31, 0xA3, 0x98, 0x84, 0xD4, 0x18, 0xDB, 0x91,
+        0xC9, 0x7D, 0x19, 0x6D, 0xF6, 0x72, 0x05, 0x7F, 0x32, 0x01, 0xCE, 0x58,
+        0x18, 0xDE, 0x93, 0xB2, 0x5A, 0x6E, 0xF7, 0xF4, 0x95, 0x54, 0xDB, 0x65,
+        0xD8, 0x18, 0x33, 0xE3, 0x1A, 0x6C, 0xA3, 0x35, 0xA7, 0x02, 0x86, 0xF8,
+        0xBC, 0xAA, 0xE8, 0x9C, 0xAF, 0x64, 0xF3, 0xEA, 0x96, 0xB7, 0xC4, 0xB7,
+        0x62, 0xA7, 0x43, 0xD5, 0x05, 0xF7, 0xA7, 0x2F, 0x25, 0x73, 0x36, 0x13,
+        0x52, 0xCD, 0x86, 0xE7, 0x1E, 0x2B, 0xC1, 0xD0, 0x88, 0xDF, 0x5F, 0xC8,
+        0x75, 0xD9, 0xC7, 0xEF, 0x8A, 0xF6, 0x40, 0x92, 0x22, 0x0D, 0x1E, 0x03,
+        0x0B, 0x1D, 0xC2, 0x8E, 0xC9, 0x21, 0x06, 0x81, 0x77, 0xEB, 0xD5, 0xB4,
+        0xC8, 0x73, 0x22, 0x4E, 0xE9, 0x8D, 0x8C, 0xEB, 0xEC, 0x37, 0xED, 0x1D,
+        0x2D, 0x90, 0x38, 0x62, 0xF7, 0x4E, 0xFA, 0x70, 0x92, 0x12, 0x52, 0x0F,
+        0xDB, 0x3B, 0xB6, 0x8B, 0x28, 0xEE, 0x70, 0xBC, 0x23, 0x52, 0xBD, 0x04,
+        0xB3, 0xAE, 0x8A, 0xC2, 0x55, 0x41, 0x19, 0x37, 0x58, 0xEE, 0xD9, 0xFD,
+        0x64, 0x1C, 0x7B, 0x1C, 0x14, 0x9E, 0x43, 0xED, 0x53, 0xCA, 0x36, 0xBF,
+        0x91, 0x21, 0xD8, 0xCC, 0x9D, 0xFC, 0x0E, 0x5D, 0x86, 0x01, 0x78, 0x50,
+        0xF4, 0xF3, 0x2D, 0xE3, 0xF0, 0xBB, 0x77, 0xFD, 0x61, 0xEB, 0x54, 0x13,
+        0x3F, 0x8A, 0xD6, 0xFC, 0x1B, 0xDA, 0x70, 0x17, 0x65, 0x3B, 0xBA, 0xE0,
+        0xDC, 0x0F, 0x76, 0x75, 0xCC, 0x8B, 0x1B, 0x78, 0xAD, 0x9E, 0x30, 0x6A,
+        0x2D, 0x6F, 0xA9, 0x5E, 0xEE, 0xE3, 0xC6, 0xC6, 0xAC, 0x71, 0xF8, 0x05,
+        0xBC, 0x4E, 0x82, 0x07, 0x24, 0x20, 0x36, 0x0D, 0x1C, 0x5B, 0xB6, 0xF3,
+        0x27, 0x23, 0xC7, 0x1F, 0x65, 0x05, 0xEF, 0x29, 0xBA, 0x6E, 0x5F, 0xE7,
+        0xDE, 0xBB, 0x1E, 0xB6, 0x00, 0x87, 0x18, 0xD8, 0xAB, 0x4A, 0xEA, 0xEC,
+        0x76, 0xA8, 0x0E, 0x2F, 0xD2, 0x32, 0x02, 0x2C, 0x2E, 0xF7, 0x29, 0xFD,
+        0xC5, 0x9F, 0x9F, 0xC9, 0x94, 0x7D, 0xF0, 0x6E, 0x51, 0x0B, 0x80, 0x3A,
+        0xBF, 0x0D, 0x50, 0x72, 0xAE, 0x32, 0x1D, 0x3E, 0xA7, 0x1E, 0x49, 0x17,
+        0x60, 0x8D, 0xA0, 0x7D, 0x5C, 0x34, 0xD2, 0x4B, 0x89, 0x53, 0x1E, 0x26,
+        0x83, 0x5C, 0x25, 0x15, 0x0C, 0x0E, 0x57, 0x6B, 0x16, 0x6D, 0x1D, 0x5A,
+        0x94, 0x45, 0x4F, 0x7B, 0x34, 0xB5, 0x23, 0x0B, 0x66, 0xA7, 0xAB, 0x61,
+        0x33, 0xE6, 0x77, 0xE1, 0x55, 0xA6, 0xF0, 0x90, 0x24, 0xD0, 0x72, 0xC3,
+        0x49, 0x5A, 0x8E, 0xBF, 0x66, 0xE9, 0x3C, 0x8E, 0x2E, 0xC8, 0xE5, 0x14,
+        0xA9, 0x45, 0x0F, 0xCF, 0x00, 0x84, 0xEE, 0x3C, 0x75, 0x2C, 0x34, 0xC9,
+        0xCF, 0x1F, 0xAD, 0x0B, 0x78, 0x72, 0xB2, 0x32, 0xC6, 0xCF, 0x9E, 0x7D,
+        0x6B, 0x92, 0x66, 0xD9, 0xEA, 0xE7, 0xBB, 0x61, 0x28, 0x2D, 0x18, 0x09,
+        0x40, 0xE5, 0xBF, 0x8C, 0x14, 0x19, 0xE8, 0xE7, 0xEF, 0xB5, 0xFD, 0x25,
+        0x4C, 0x4D, 0x70, 0x47, 0xB1, 0x99, 0xAE, 0xA3, 0xF8, 0x4F, 0x47, 0x7C,
+        0xB7, 0x0C, 0xD7, 0x4C, 0x64, 0x96, 0xDC, 0xBE, 0x06, 0x92, 0x7B, 0x85,
+        0xC8, 0x0A, 0xF8, 0xB0, 0x24, 0x03, 0x1A, 0x4B, 0x82, 0xA2, 0x5F, 0x12,
+        0x61, 0xB3, 0x65, 0xAE, 0xAC, 0xB3, 0x90, 0x43, 0xA7, 0x6F, 0x5C, 0x8A,
+        0x5C, 0x96, 0xA0, 0x14, 0xE7, 0xAC, 0x96, 0x44, 0x77, 0x19, 0x5F, 0x3B,
+        0xEF, 0x99, 0xD6, 0x4E, 0xDA, 0xBA, 0x04, 0xDB, 0x53, 0xFB, 0x91, 0x3E,
+        0x11, 0xBD, 0xC8, 0x6A, 0x7E, 0xF5, 0x17, 0xE8, 0xC1, 0x77, 0x30, 0xD1,
+        0x7F, 0x9C, 0x75, 0x24, 0xBF, 0x51, 0x06, 0x4F, 0x81, 0x40, 0x9E, 0xBD,
+        0x0D, 0x1F, 0x64, 0x60, 0x7C, 0x0F, 0x27, 0xA3, 0xCC, 0xE2, 0xDC, 0x47,
+        0xCE, 0x37, 0xBD, 0x6D, 0x0A, 0x96, 0xB7, 0xAA, 0x0D, 0x4A, 0x37, 0xAC,
+        0x54, 0x19, 0x44, 0x61, 0xC8, 0xDE, 0x54, 0x28, 0x7F, 0x39, 0xB2, 0xE6,
+        0x38, 0x87, 0x0E, 0x7C, 0x86, 0xCA, 0x1B, 0x9A, 0xC8, 0x6F, 0xC8, 0xF3,
+        0x9A, 0xF8, 0x0F, 0x54, 0x98, 0x6E, 0x7F, 0x85, 0xB1, 0x18, 0x18, 0xFF,
+        0xE3, 0x98, 0x68, 0x15, 0x95, 0x36, 0xF5, 0x8D, 0x80, 0x3B, 0x84, 0x69,
+        0x27, 0x45, 0x65, 0x35, 0x5C, 0x1A, 0x83, 0x9B, 0x29, 0xF3, 0x77, 0xAA,
+        0xB5, 0x27, 0x45, 0x6C, 0x57, 0x24, 0xD7, 0x07, 0xAF, 0x7A, 0x26, 0xE8,
+        0x61, 0x06, 0x3A, 0x89, 0xE0, 0xE5, 0xA7, 0x10, 0x06, 0x8A, 0xCA, 0x26,
+        0x2E, 0x48, 0x40, 0xCD, 0x22, 0x45, 0x05, 0x34, 0x8E, 0xAB, 0x86, 0x2C,
+        0xEE, 0x2D, 0x08, 0x11, 0xC1, 0xA8, 0xD8, 0x0C, 0xD0, 0x5A, 0x94, 0x8E,
+        0x68, 0x10, 0x9C, 0x12, 0xEB, 0xC5, 0x50, 0x6E, 0x1C, 0xD1, 0x55, 0x94,
+        0x64, 0x65, 0xAA, 0x5C, 0x70, 0x29, 0x47, 0xE5, 0xD1, 0x1B, 0xE1, 0x18,
+        0xBB, 0x31, 0x20, 0x54, 0x83, 0x02, 0x35, 0xA9, 0xDE, 0xAE, 0x65, 0x1C,
+        0xCD, 0x8B, 0xEB, 0x4E, 0xB6, 0x02, 0x02, 0x35, 0x49, 0xAB, 0x4B, 0xD1,
+        0xFC, 0x9D, 0xAB, 0x3B, 0x05, 0x9C, 0xA6, 0x8D, 0xFF, 0xB2, 0x59, 0x7C,
+        0x1D, 0x67, 0xB6, 0x0B, 0x43, 0x08, 0x4E, 0xCA, 0xE0, 0x42, 0x2D, 0x4A,
+        0xE6, 0x6C, 0x41, 0x09, 0x9B, 0xAD, 0x14, 0x3F, 0x4E, 0xAE, 0x29, 0xF1,
+        0xF4, 0xB6, 0x14, 0xDE, 0x36, 0x0C, 0x14, 0x4A, 0x42, 0xC9, 0xB6, 0x36,
+        0xA1, 0x31, 0x1C, 0xA0, 0xFC, 0x8F, 0x9C, 0xCC, 0x7A, 0x9D, 0xDD, 0x21,
+        0x84, 0xA4, 0x27, 0x29, 0x14, 0x8E, 0xF8, 0x66, 0xB3, 0x9E, 0x2E, 0xD8,
+        0xB2, 0x2B, 0x32, 0xD6, 0xA0, 0x4C, 0x60, 0x10, 0x70, 0x9C, 0x1D, 0x30,
+        0x85, 0x12, 0x09, 0x8F, 0x81, 0x50, 0x9D, 0x89, 0xC9, 0xB2, 0xBC, 0xBD,
+        0x3E, 0x0E, 0x28, 0x8D, 0x8F, 0x71, 0x8A, 0xC4, 0xFB, 0xE8, 0x36, 0x92,
+        0x0E, 0x7E, 0x18, 0xEA, 0xFB, 0x4A, 0x68, 0xB7, 0x64, 0x3D, 0x0E, 0x1B,
+        0x0F, 0xBB, 0x86, 0x58, 0xDE, 0x64, 0x59, 0x4E, 0x13, 0x92, 0xAF, 0x52,
+        0x28, 0xDD, 0x9B, 0x04, 0xB8, 0x67, 0x50, 0x50, 0xAB, 0xCF, 0x64, 0x1A,
+        0xDD, 0x02, 0x3C, 0xF7, 0x6E, 0xEF, 0x94, 0xDB, 0x51, 0x82, 0x4A, 0x2B,
+        0x0C, 0x3A, 0x41, 0x11, 0xAD, 0xB0, 0xAE, 0x27, 0x5E, 0x54, 0x1D, 0xC8,
+        0x03, 0x15, 0x04, 0x14, 0xF3, 0x57, 0x40, 0x15, 0x14, 0x46, 0xC9, 0x26,
+        0x85, 0x38, 0x81, 0x2A, 0x96, 0xF4, 0xD3, 0x76, 0x6B, 0x67, 0x46, 0x08,
+        0x3D, 0x34, 0x50, 0x7D, 0x0D, 0x67, 0xC4, 0x9F, 0x09, 0x74, 0x28, 0xB4,
+        0x01, 0x32, 0x9C, 0x18, 0xE3, 0x0F, 0x0B, 0xD5, 0x5B, 0x2F, 0x51, 0x73,
+        0x76, 0x93, 0x6F, 0x2F, 0x4B, 0xF4, 0xF8, 0x38, 0x04, 0x92, 0xA7, 0x8F,
+        0xE1, 0x39, 0x60, 0x57, 0x8A, 0xF2, 0xC0, 0x6B, 0xFD, 0xCE, 0xE1, 0xD5,
+        0xC3, 0x19, 0xBF, 0x28, 0xE4, 0x1A, 0xE2, 0x74, 0x51, 0x68, 0xA5, 0x53,
+        0x61, 0xC3, 0xBC, 0x72, 0x0C, 0x09, 0x0A, 0x6D, 0x1F, 0xEB, 0x26, 0xC5,
+        0xBC, 0xDB, 0xA1, 0xF4, 0x36, 0xF3, 0x27, 0x23, 0xF7, 0x43, 0xF1, 0x76,
+        0x21, 0x97, 0xD7, 0xBD, 0x38, 0xC1, 0xF4, 0xD6, 0x2E, 0xE8, 0x10, 0x9D,
+        0x0A, 0xBE, 0xF9, 0x19, 0x4E, 0xB1, 0x7C, 0x27, 0x5B, 0xFD, 0x07, 0xEC,
+        0xE1, 0xDA, 0x2E, 0x58, 0x17, 0xAA, 0xE5, 0x02, 0xA2, 0x23, 0xB1, 0x24,
+        0xD8, 0x0A, 0x43, 0xCD, 0x10, 0xFD, 0xF4, 0x77, 0xF3, 0xCB, 0xD2, 0x24,
+        0xCC, 0x52, 0xE5, 0x4C, 0x11, 0x11, 0x58, 0xB5, 0x7F, 0x23, 0x3A, 0x2A,
+        0x73, 0x1A, 0x3D, 0xEC, 0x5B, 0x36, 0xCD, 0xFF, 0x8A, 0xAE, 0x72, 0x77,
+        0xFF, 0xC4, 0x5F, 0x16, 0x1E, 0x18, 0xF4, 0xAE, 0x1D, 0x9C, 0xD7, 0xCA,
+        0xF8, 0x00, 0xBE, 0x2B, 0xCA, 0x51, 0xF1, 0xD7, 0x2B, 0xB7, 0x17, 0x15,
+        0x9A, 0x25, 0xC8, 0x37, 0x07, 0x9D, 0x52, 0x1F, 0x4C, 0xEF, 0x3F, 0x12,
+        0x96, 0xAE, 0xA3, 0xC7, 0xF8, 0xD9, 0xFE, 0xCE, 0x25, 0x51, 0xDD, 0x9F,
+        0x40, 0x05, 0xE3, 0xE2, 0x71, 0x9C, 0x29, 0xA6, 0xB6, 0x7D, 0x30, 0x08,
+        0xAA, 0x60, 0x96, 0x0D, 0x63, 0xE8, 0xD8, 0x40, 0xE2, 0x27, 0xBD, 0xF8,
+        0x3E, 0x68, 0x1D, 0x70, 0x29, 0x1A, 0x44, 0x0E, 0xD2, 0xBD, 0x1C, 0xC2,
+        0xC2, 0x26, 0xDF, 0xE9, 0x40, 0x97, 0x52, 0x82, 0xC6, 0xBD, 0xDC, 0xC4,
+        0x7B, 0x36, 0xB2, 0xF1, 0xA3, 0x7D, 0xD5, 0x57, 0x84, 0xFB, 0x56, 0x35,
+        0x50, 0xD8, 0xF6, 0x62, 0x08, 0xD8, 0x78, 0x0B, 0x28, 0xAE, 0xD6, 0x6D,
+        0x50, 0xD2, 0x20, 0x58, 0x5E, 0x17, 0xBD, 0x3C, 0x05, 0xFD, 0xDE, 0xF6,
+        0x58, 0xB7, 0x7A, 0xB7, 0x8A, 0xD0, 0xD5, 0xCF, 0xAA, 0x29, 0x85, 0x48,
+        0xE2, 0xC8, 0xA7, 0xCD, 0xBA, 0x70, 0xA5, 0xF9, 0x04, 0x73, 0x70, 0x34,
+        0x5C, 0x21, 0x2E, 0x37, 0x81, 0xC0, 0xEC, 0xE6, 0x4B, 0xFD, 0xA0, 0xED,
+        0x6C, 0xD5, 0xE6, 0x8B, 0xF1, 0x28, 0x52, 0xA0, 0xD8, 0x4A, 0x48, 0x1C,
+        0x08, 0x5A, 0x75, 0x09, 0xB8, 0xAD, 0x9D, 0x7C, 0x7F, 0x52, 0x02, 0xCC,
+        0x7F, 0x2B, 0xCE, 0x5E, 0x2E, 0xAA, 0xCA, 0x2A, 0xF5, 0xD8, 0x77, 0x6C,
+        0x37, 0xE3, 0xC5, 0x4E, 0x9F, 0x98, 0x1A, 0xFE, 0x4B, 0x0F, 0x88, 0x8C,
+        0x12, 0x32, 0xF6, 0xD9, 0x3A, 0xC2, 0x16, 0x17, 0x19, 0xAB, 0x6D, 0x90,
+        0x4E, 0x62, 0x5A, 0xAD, 0x4F, 0xAC, 0xE9, 0x24, 0x35, 0xA9, 0x99, 0x79,
+        0xC5, 0xE0, 0x98, 0x89, 0x7D, 0x1B, 0xBC, 0x3F, 0xEC, 0x01, 0x04, 0x02,
+        0x77, 0x49, 0x2A, 0xA0, 0xCF, 0x75, 0xE6, 0x28, 0x44, 0x9B, 0x60, 0xB6,
+        0x36, 0x64, 0xF7, 0x0E, 0xFD, 0x10, 0xA4, 0xB7, 0x5F, 0x51, 0xE0, 0x9A,
+        0xFA, 0xE8, 0xD7, 0x6C, 0xEC, 0x45, 0x6D, 0x4D, 0xAF, 0x1D, 0xB6, 0xC1,
+        0x86, 0xD0, 0x1A, 0x04, 0x17, 0xAF, 0x23, 0xD4, 0x1E, 0x76, 0x92, 0x10,
+        0x26, 0x2D, 0xE5, 0xE7, 0x43, 0x5D, 0x0A, 0xA8, 0xAD, 0x7A, 0x75, 0x63,
+        0x91, 0x86, 0x5C, 0x28, 0x3D, 0xA3, 0xAD, 0xCD, 0x08, 0x8D, 0x49, 0xD3,
+        0xF8, 0xFC, 0xB1, 0x94, 0x36, 0x5E, 0x86, 0x0C, 0x02, 0xC2, 0x68, 0x1C,
+        0x8E, 0x90, 0x27, 0xE1, 0x12, 0xC2, 0x3A, 0x4F, 0x09, 0xB8, 0x49, 0x9E,
+        0x3B, 0x58, 0xD0, 0xAE, 0x8F, 0x14, 0x77, 0xA5, 0x1E, 0xD4, 0x36, 0x3A,
+        0xCE, 0xD7, 0xDB, 0x21, 0xBE, 0xFE, 0x95, 0x87, 0x89, 0xCF, 0x27, 0x50,
+        0x5D, 0x7A, 0x29, 0xD1, 0xE9, 0x14, 0xFD, 0x88, 0x26, 0xBD, 0x82, 0xEA,
+        0x22, 0xE2, 0x27, 0x03, 0x36, 0xCA, 0xB1, 0x0A, 0x49, 0x2C, 0xAD, 0x5C,
+        0x0D, 0x1B, 0xED, 0x2E, 0xBD, 0x7C, 0x2E, 0x71, 0x91, 0x48, 0x25, 0xAC,
+        0x52, 0xAA, 0x4B, 0x8B, 0x73, 0x8D, 0x1B, 0xCC, 0xDE, 0x50, 0xC2, 0x9C,
+        0x38, 0x50, 0x84, 0x47, 0x0E, 0x5E, 0xC4, 0x66, 0x36, 0x25, 0xB8, 0x8D,
+        0x3C, 0x50, 0xEA, 0xB7, 0x51, 0xDE, 0x0D, 0x51, 0x80, 0x81, 0xF2, 0x5E,
+        0x92, 0x0D, 0x39, 0x3E, 0x4D, 0x67, 0x34, 0x01, 0xA4, 0xE6, 0xB6, 0x89,
+        0x22, 0xFA, 0xF8, 0x6E, 0x39, 0x25, 0x4B, 0xBA, 0xE5, 0x95, 0x9B, 0x30,
+        0x26, 0xC4, 0x66, 0xAE, 0x83, 0x7E, 0x33, 0xC5, 0x34, 0x74, 0x48, 0xBB,
+        0x3A, 0x16, 0x1F, 0xB1, 0x85, 0x76, 0x74, 0xB8, 0x1E, 0xC1, 0x80, 0x0D,
+        0x8E, 0x59, 0xFE, 0x2E, 0x79, 0x82, 0x61, 0x2F, 0x09, 0xC5, 0x8F, 0x3B,
+        0x5C, 0xEC, 0x44, 0x2C, 0xBB, 0x5A, 0x2C, 0x23, 0x45, 0xDF, 0x1C, 0x36,
+        0x14, 0xB6, 0x7D, 0x76, 0x70, 0xE9, 0x18, 0xD9, 0xE2, 0x2C, 0x44, 0xC7,
+        0xDB, 0xA2, 0x94, 0x26, 0x86, 0x46, 0xE6, 0x1A, 0x23, 0xEF, 0xCB, 0x7A,
+        0xE8, 0x21, 0x86, 0x59, 0x19, 0x45, 0xB8, 0x70, 0x9B, 0x22, 0xA6, 0x49,
+        0x67, 0x0B, 0x1A, 0xC9, 0xE0, 0xF0, 0x11, 0x83, 0x7C, 0x56, 0x42, 0x08,
+        0xB2, 0x6C, 0xB5, 0x9A, 0x7A, 0xEF, 0x32, 0x56, 0x8C, 0x00, 0x06, 0x8C,
+        0x57, 0x12, 0xE7, 0x99, 0xAD, 0x20, 0x42, 0x29, 0x5D, 0x72, 0x6E, 0xC6,
+        0xCC, 0x65, 0xCB, 0xAF, 0xE5, 0x8E, 0x43, 0xDC, 0x39, 0x23, 0x53, 0xC2,
+        0x75, 0x00, 0x25, 0xB0, 0x95, 0x79, 0x1B, 0xFC, 0x1F, 0x66, 0x6C, 0xF3,
+        0x3E, 0x31, 0x2A, 0x2B, 0xAC, 0x39, 0xFE, 0x50, 0xA6, 0xDD, 0x4A, 0x86,
+        0xB5, 0x3F, 0xB0, 0x09, 0x20, 0xE7, 0xFD, 0xD2, 0x81, 0x99, 0xF9, 0x3B,
+        0x58, 0x71, 0x06, 0x6D, 0x4F, 0xD3, 0xD4, 0x63, 0x09, 0xE4, 0x36, 0x90,
+        0xD8, 0xEC, 0xBC, 0xD0, 0x1F, 0xBE, 0x82, 0x0A, 0xC4, 0x5C, 0xB7, 0x53,
+        0x73, 0x23, 0xDE, 0x96, 0xF3, 0xC1, 0x62, 0xD6, 0x12, 0xF7, 0xDB, 0xD7,
+        0x57, 0x78, 0x6B, 0x09, 0x61, 0x5D, 0x61, 0xFC, 0x08, 0x10, 0x8D, 0xC0,
+        0x1A, 0x35, 0x20, 0xC4, 0x6F, 0x80, 0xAD, 0xF0, 0x8F, 0x3F, 0xF5, 0x17,
+        0x3F, 0x69, 0x08, 0x93, 0x44, 0x4F, 0xA2, 0x48, 0xB5, 0x2E, 0xF7, 0xD0,
+        0x03, 0x5B, 0x50, 0xE2, 0x69, 0x5F, 0x41, 0x43, 0x60, 0x87, 0x8A, 0x78,
+        0x60, 0x43, 0xDD, 0xCC, 0x69, 0xE9, 0xA4, 0x94, 0x3A, 0xCE, 0x49, 0x1D,
+        0xC4, 0xB2, 0xA1, 0xB5, 0xB3, 0x27, 0xA7, 0x17, 0x94, 0x69, 0xBE, 0x57,
+        0x90, 0x74, 0xE2, 0x98, 0xD1, 0x4E, 0x3C, 0x09, 0x3D, 0xA2, 0xB6, 0x31,
+        0xFF, 0xF4, 0x9D, 0xF5, 0x67, 0xE6, 0x56, 0x95, 0x3B, 0xBE, 0xA5, 0x3B,
+        0xB6, 0x62, 0xB6, 0x4C, 0x61, 0x00, 0x97, 0x97, 0xD1, 0xCA, 0x5C, 0x19,
+        0x67, 0x17, 0x7F, 0x05, 0x7B, 0xBA, 0xCA, 0xBF, 0x7E, 0x62, 0x12, 0x0A,
+        0x90, 0xA7, 0x48, 0xDB, 0xC2, 0x3F, 0xD8, 0x53, 0xFF, 0x90, 0x13, 0x69,
+        0x79, 0xC4, 0xC5, 0x51, 0x49, 0xE0, 0x6B, 0xC0, 0x1F, 0x1F, 0xF9, 0x5E,
+        0x5B, 0x72, 0x04, 0xF9, 0x0F, 0x6D, 0x29, 0x22, 0xCD, 0x74, 0xA5, 0x89,
+        0x20, 0x54, 0xCD, 0xD9, 0xA9, 0x7A, 0x43, 0x50, 0x9D, 0x66, 0xA1, 0xBA,
+        0x82, 0x3A, 0xF5, 0x1F, 0xC4, 0x0C, 0x88, 0xFE, 0x94, 0xC2, 0x9B, 0xEF,
+        0xCF, 0x27, 0xA9, 0x55, 0xEF, 0x48, 0x3F, 0x3A, 0xE6, 0xB1, 0x92, 0x7B,
+        0xF2, 0x58, 0x31, 0x83, 0xAE, 0xCB, 0x35, 0xCD, 0xE0, 0x08, 0x3D, 0x65,
+        0x42, 0x41, 0x77, 0x13, 0xD5, 0x94, 0xB0, 0x6F, 0x8C, 0x0C, 0x7B, 0xC1,
+        0xCD, 0x1B, 0xD5, 0xBC, 0xB8, 0xF8, 0x3B, 0x36, 0xCA, 0xC3, 0x3C, 0x0B,
+        0x31, 0xE4, 0x23, 0x6B, 0x9B, 0x14, 0x0A, 0xD1, 0xB5, 0xA5, 0x4B, 0x83,
+        0xAA, 0x8D, 0xB0, 0x94, 0x68, 0x08, 0x6C, 0x68, 0x80, 0x55, 0x62, 0x8D,
+        0x0E, 0xC1, 0x34, 0x9F, 0xDD, 0x4B, 0xD8, 0x48, 0x5A, 0x1B, 0x51, 0x9D,
+        0xE0, 0x2C, 0x0E, 0x30, 0xC9, 0x09, 0x83, 0x8B, 0xB3, 0x25, 0xD3, 0xD3,
+        0x48, 0x01, 0x4F, 0x18, 0x27, 0xA2, 0x1F, 0xED, 0xC2, 0xC1, 0x42, 0x5E,
+        0x2C, 0xB3, 0xB6, 0xC9, 0xAC, 0x0E, 0x03, 0x44, 0x52, 0x23, 0xAE, 0xAB,
+        0x03, 0x96, 0xF1, 0x54, 0x0F, 0x6F, 0xE1, 0x71, 0xE6, 0xEC, 0xA1, 0x22,
+        0xE9, 0x12, 0x7A, 0x67, 0x52, 0xAE, 0x0F, 0x81, 0xC1, 0x9D, 0x1B, 0x73,
+        0x6A, 0x43, 0x48, 0x57, 0x9B, 0x40, 0xC0, 0xE6, 0x4E, 0xF4, 0x7E, 0x9B,
+        0xCA, 0x93, 0xEA, 0x71, 0x53, 0xD2, 0x49, 0x3C, 0xC7, 0x27, 0xA8, 0xA1,
+        0xB9, 0x19, 0x00, 0x2F, 0x37, 0xEF, 0x12, 0x28, 0x74, 0x44, 0x4E, 0x8D,
+        0x2B, 0x34, 0x16, 0x94, 0xC3, 0xF7, 0xB7, 0xBE, 0x86, 0xEC, 0x43, 0x5B,
+        0x5E, 0x04, 0x26, 0x45, 0xAF, 0x5E, 0x1A, 0xEF, 0x8E, 0x5D, 0xAE, 0x36,
+        0x31, 0x8F, 0xF3, 0xEF, 0x0C, 0x03, 0xEF, 0x76, 0xB7, 0xE1, 0x8E, 0x68,
+        0x4A, 0xA0, 0x38, 0x99, 0x60, 0xC3, 0x77, 0xDF, 0x71, 0x25, 0xFB, 0xC2,
+        0x3F, 0x97, 0xBA, 0x78, 0x68, 0x18, 0x0B, 0xDF, 0xA9, 0x61, 0x35, 0x32,
+        0x64, 0xE0, 0xDA, 0x91, 0xB5, 0xF6, 0xB5, 0xD7, 0x36, 0xF0, 0x81, 0x48,
+        0x15, 0x63, 0xD3, 0x9C, 0x25, 0x84, 0x0C, 0xED, 0x7E, 0xD4, 0xFD, 0x6E,
+        0x33, 0x48, 0x28, 0xB0, 0x12, 0x9F, 0x84, 0x7B, 0x68, 0x38, 0xFE, 0xF7,
+        0xB9, 0xA8, 0x9A, 0xB6, 0xF7, 0x7F, 0x4C, 0xB8, 0x43, 0x16, 0x1A, 0x94,
+        0xF0, 0x9D, 0xEF, 0x47, 0x81, 0x03, 0x7F, 0x30, 0xAE, 0xB4, 0x1F, 0xF7,
+        0xAB, 0xD0, 0x4E, 0x5D, 0xE6, 0xD0, 0x2B, 0x81, 0x1A, 0x0D, 0x62, 0x14,
+        0x6A, 0xC2, 0xF1, 0xFD, 0xE0, 0x53, 0x53, 0x43, 0xF6, 0xA4, 0x7E, 0x63,
+        0x0D, 0xB6, 0xB5, 0xFC, 0x09, 0x58, 0x17, 0x5F, 0xC0, 0xB1, 0x2C, 0x0C,
+        0x78, 0x62, 0x7E, 0xB4, 0x5A, 0x28, 0xBC, 0x01, 0x5F, 0x69, 0x58, 0x56,
+        0x87, 0x72, 0x10, 0x5A, 0x1C, 0x73, 0x8A, 0x30, 0x6C, 0x04, 0x3A, 0x11,
+        0x05, 0xAF, 0x4D, 0x61, 0x50, 0xDE, 0x1B, 0x18, 0x66, 0xD2, 0x25, 0x3E,
+        0x95, 0x2F, 0xAA, 0xD7, 0x8B, 0x40, 0xC8, 0xFF, 0x2A, 0xF7, 0x5A, 0x6F,
+        0xB0, 0x9D, 0x7E, 0xAF, 0xCB, 0xA3, 0x88, 0x47, 0x00, 0x3A, 0xE4, 0x08,
+        0x0B, 0xA0, 0x1D, 0xAE, 0x8A, 0x31, 0x84, 0x81, 0x2D, 0x05, 0x74, 0x60,
+        0x95, 0xC0, 0x34, 0x4C, 0x86, 0xED, 0x8B, 0x6D, 0x51, 0x54, 0x18, 0xAD,
+        0xFB, 0xE5, 0xC2, 0x98, 0x3A, 0x9C, 0x02, 0x1F, 0xA8, 0xE9, 0x92, 0xCF,
+        0x4F, 0x17, 0x78, 0xB4, 0x6E, 0xEC, 0x7B, 0xB6, 0x06, 0xDF, 0x18, 0x03,
+        0x0F, 0xE4, 0x3A, 0xDA, 0xE0, 0x22, 0x28, 0xCE, 0x5D, 0xB2, 0x5C, 0x55,
+        0x05, 0x46, 0x74, 0xB1, 0x10, 0xDA, 0x7C, 0xBF, 0x9A, 0x60, 0x9A, 0xEF,
+        0x90, 0x77, 0x6B, 0xBB, 0x05, 0x40, 0x3F, 0x1B, 0xD0, 0xBF, 0xDA, 0x86,
+        0x6C, 0xE2, 0xAA, 0xC6, 0xF9, 0xBB, 0x6A, 0x3D, 0xA1, 0xD5, 0xE0, 0x59,
+        0x05, 0xAF, 0x49, 0xA4, 0x9B, 0xD9, 0xDD, 0xAE, 0x01, 0x1B, 0x89, 0xAD,
+        0xCD, 0xF9, 0xB3, 0xEA, 0xE1, 0x41, 0xEC, 0x9A, 0xD6, 0x88, 0x8F, 0x08,
+        0x0A, 0x26, 0x2E, 0x88, 0x3E, 0x94, 0x69, 0xAD, 0xAA, 0xAA, 0x05, 0xD8,
+        0x53, 0xA7, 0x55, 0xC5, 0x7D, 0x21, 0x97, 0xA8, 0x77, 0x2E, 0x4B, 0x77,
+        0x58, 0xCE, 0x3E, 0x70, 0xF7, 0x8F, 0xC7, 0xF9, 0xCD, 0x9E, 0xEB, 0xA5,
+        0x3F, 0xF0, 0x22, 0xE5, 0xD0, 0xC2, 0x97, 0x20, 0x1C, 0x32, 0xE2, 0xC9,
+        0x44, 0xC5, 0x07, 0xEC, 0x93, 0xDC, 0x9B, 0x5A, 0x3C, 0xD6, 0xDE, 0x4D,
+        0x84, 0x42, 0x71, 0xFD, 0xF6, 0x3B, 0xBD, 0x10, 0x27, 0xA4, 0x61, 0x53,
+        0x67, 0xFC, 0xA6, 0x57, 0x47, 0x8C, 0x05, 0x79, 0xB5, 0x00, 0xB8, 0xA6,
+        0x53, 0xB0, 0x0C, 0x7B, 0xA6, 0x62, 0xA6, 0x63, 0xC9, 0x06, 0x0F, 0xFA,
+        0xE3, 0x47, 0x12, 0x70, 0x9A, 0x31, 0x6D, 0x46, 0x6B, 0x0B, 0xC1, 0x83,
+        0xC9, 0x79, 0x22, 0xD8, 0xC6, 0x20, 0xD0, 0xC1, 0x1E, 0x0B, 0x3B, 0x61,
+        0x24, 0xE7, 0xE0, 0x7F, 0x09, 0xEC, 0xA4, 0xE1, 0xEE, 0x6F, 0x00, 0xC1,
+        0x43, 0x08, 0x70, 0x6F, 0x83, 0xC6, 0x21, 0x19, 0xE9, 0x87, 0x85, 0x58,
+        0x37, 0x67, 0xC2, 0x2E, 0xE7, 0xB9, 0x20, 0x93, 0x4F, 0x1C, 0xC4, 0x98,
+        0x20, 0xA3, 0xE8, 0x2F, 0x08, 0xF9, 0xB1, 0x4F, 0xCB, 0xC2, 0xA9, 0x9D,
+        0x68, 0x93, 0x54, 0x7E, 0x9F, 0x71, 0x81, 0x79, 0x0B, 0x73, 0xE2, 0x78,
+        0x36, 0x74, 0x85, 0x75, 0xBA, 0x72, 0xD1, 0x08, 0x29, 0x61, 0xEF, 0xF0,
+        0x84, 0xC3, 0x8B, 0x21, 0xFF, 0xB0, 0x5D, 0x26, 0x8F, 0x19, 0x6E, 0x6D,
+        0x8D, 0xD6, 0x44, 0xDD, 0x3F, 0x2E, 0x02, 0x24, 0x1D, 0x0E, 0x8B, 0xB7,
+        0xFF, 0xA4, 0x68, 0x74, 0x97, 0x36, 0x3D, 0x09, 0xBC, 0x82, 0x8E, 0x74,
+        0x44, 0x31, 0xB9, 0x3D, 0x0F, 0x5A, 0x94, 0x34, 0x37, 0xC1, 0xE4, 0xBC,
+        0xB8, 0xBB, 0x2B, 0x96, 0x57, 0x25, 0x9E, 0xD5, 0xDF, 0xDC, 0xAF, 0x47,
+        0x23, 0xE9, 0x28, 0xDD, 0x1F, 0x25, 0x9F, 0x5F, 0x1F, 0xBF, 0x98, 0xD0,
+        0x1D, 0xDF, 0x3C, 0x8D, 0x3C, 0x3E, 0x7C, 0xFD, 0xFD, 0x41, 0x70, 0x0B,
+        0xDF, 0x85, 0xD0, 0x5F, 0x29, 0x8D, 0xE9, 0x1C, 0x78, 0x09, 0xBC, 0x9B,
+        0xAB, 0xD2, 0xC6, 0xCE, 0x53, 0xDE, 0xC8, 0x84, 0x6A, 0x10, 0xB4, 0x43,
+        0xEB, 0x41, 0x52, 0xEF, 0x1B, 0xB6, 0x02, 0x2E, 0x19, 0x7D, 0x8D, 0x4C,
+        0xA8, 0x67, 0x69, 0x4D, 0x2A, 0x5A, 0xE7, 0x51, 0x8E, 0x9D, 0x4C, 0xFF,
+        0xF1, 0x1C, 0x9C, 0xD0, 0xBF, 0xCA, 0x57, 0x2F, 0x28, 0x0B, 0x4E, 0x66,
+        0x27, 0x7F, 0xD2, 0xD3, 0x86, 0x41, 0xB0, 0x53, 0x3C, 0x37, 0x1F, 0x0C,
+        0xA8, 0x88, 0x4F, 0x9A, 0xA2, 0x95, 0x82, 0x87, 0xDB, 0xA0, 0x4E, 0x3D,
+        0x83, 0xE4, 0x21, 0xD4, 0xE9, 0x8F, 0x39, 0xE4, 0x7D, 0x6F, 0x29, 0x87,
+        0xDA, 0x20, 0xD5, 0xD7, 0xD7, 0x75, 0x8A, 0x62, 0x17, 0x0D, 0x1E, 0x87,
+        0x3D, 0x81, 0x6F, 0x3C, 0x6C, 0xDF, 0x97, 0xB9, 0xA9, 0x93, 0x09, 0x2E,
+        0x6C, 0x06, 0xD9, 0x6A, 0xC5, 0x3C, 0x46, 0xFF, 0x55, 0x38, 0x79, 0xB3,
+        0x12, 0x28, 0xA8, 0x3A, 0x5E, 0xD2, 0x16, 0xDC, 0xA8, 0x54, 0xBC, 0x6C,
+        0x35, 0x19, 0x60, 0x75, 0xA9, 0x32, 0x4D, 0xBA, 0x50, 0xD1, 0x63, 0x87,
+        0x90, 0x30, 0x39, 0x87, 0xC6, 0xAB, 0x73, 0x76, 0x49, 0x7B, 0xB1, 0x64,
+        0x94, 0xB0, 0x71, 0x7B, 0x48, 0x1C, 0x7A, 0xDD, 0xC4, 0x71, 0xA3, 0x7A,
+        0x08, 0x11, 0xA6, 0xAB, 0xE8, 0x78, 0xFF, 0x2F, 0xA7, 0xAA, 0x32, 0xA3,
+        0xBC, 0xE0, 0x99, 0xC3, 0x8C, 0x0D, 0x76, 0xBD, 0xBB, 0xB9, 0x61, 0xEA,
+        0x14, 0x1C, 0xEC, 0xAB, 0xB0, 0xEE, 0x12, 0x0E, 0x48, 0x1F, 0x8A, 0xFD,
+        0x98, 0x52, 0x3E, 0x9E, 0xA8, 0xE9, 0x9F, 0x9A, 0x3F, 0xC6, 0x13, 0x0F,
+        0x2A, 0x91, 0xFE, 0x08, 0x37, 0x60, 0x50, 0x58, 0x32, 0x24, 0x08, 0xC0,
+        0xC3, 0x54, 0x3C, 0xDA, 0xFB, 0xF5, 0xDB, 0x4A, 0x7A, 0x64, 0x14, 0x42,
+        0x23, 0x83, 0x44, 0x67, 0x20, 0x39, 0x92, 0x0F, 0x6C, 0x46, 0x29, 0xBE,
+        0x0F, 0x94, 0x84, 0x38, 0x7C, 0xF8, 0xBD, 0x2A, 0x5F, 0x22, 0x78, 0x63,
+        0xA6, 0x87, 0x9C, 0xBE, 0x18, 0x24, 0x63, 0x32, 0x58, 0x04, 0xC0, 0x75,
+        0x3E, 0xCD, 0x35, 0x3A, 0xB0, 0x0B, 0x05, 0x4D, 0x1A, 0x38, 0xA9, 0x22,
+        0x2A, 0x21, 0xBC, 0x26, 0x43, 0x2B, 0x94, 0x40, 0xF2, 0xD5, 0x23, 0x88,
+        0x3F, 0x26, 0x48, 0x4F, 0xD8, 0xB4, 0xD9, 0xB0, 0x5C, 0xE3, 0xAD, 0x8A,
+        0xB2, 0x7D, 0x74, 0x28, 0xC8, 0xF4, 0xCE, 0x37, 0x05, 0x84, 0x1F, 0x77,
+        0x6B, 0xD4, 0x71, 0xD5, 0x44, 0x0F, 0x6E, 0x84, 0x4D, 0xD6, 0x1D, 0xC8,
+        0xB5, 0x07, 0x36, 0x02, 0x86, 0x7F, 0xF6, 0x5A, 0x54, 0xB0, 0x97, 0x69,
+        0xCE, 0xAC, 0x16, 0x86, 0x0A, 0x65, 0x57, 0x03, 0xD4, 0x0C, 0x1B, 0xCA,
+        0xDF, 0x98, 0x03, 0x01, 0xC6, 0xC2, 0x5D, 0x42, 0x60, 0x3B, 0x00, 0x81,
+        0xDC, 0x09, 0x8F, 0x07, 0x67, 0x1A, 0x58, 0x82, 0x83, 0x2A, 0x4C, 0x8B,
+        0x38, 0xE4, 0xC8, 0xB8, 0x86, 0x57, 0x22, 0x60, 0x39, 0xBD, 0x24, 0xBC,
+        0x00, 0xB7, 0x86, 0x8C, 0x67, 0xC9, 0x45, 0x72, 0x2A, 0x55, 0x37, 0x56,
+        0x56, 0x32, 0x25, 0x8F, 0x5B, 0xDA, 0x4C, 0x8B, 0x16, 0x2A, 0x4F, 0xDB,
+        0x6B, 0x0E, 0x86, 0xB8, 0x81, 0x3E, 0xDB, 0xE0, 0x94, 0x87, 0x30, 0x90,
+        0xB2, 0x1A, 0xA2, 0xDD, 0x8C, 0xB4, 0xC6, 0xD4, 0x89, 0x86, 0x84, 0x6E,
+        0x57, 0xB6, 0x10, 0xF8, 0xBA, 0x94, 0xE1, 0x62, 0x53, 0x48, 0x68, 0x52,
+        0x9C, 0x71, 0x5F, 0x39, 0xCB, 0xB4, 0x6D, 0xDC, 0xC1, 0x43, 0x06, 0xA8,
+        0x3F, 0x24, 0x2B, 0xE1, 0xEA, 0x13, 0x87, 0xCD, 0x83, 0x4A, 0x28, 0xF9,
+        0x58, 0x88, 0x52, 0x3C, 0x40, 0x1A, 0x23, 0xE8, 0x02, 0xB0, 0x32, 0x6D,
+        0x49, 0xB9, 0x22, 0xF9, 0x33, 0x9C, 0xE2, 0xC6, 0xD5, 0xA7, 0x38, 0xE7,
+        0xF2, 0xE3, 0x80, 0x04, 0x8A, 0x5C, 0x18, 0x16, 0xB6, 0x53, 0xAF, 0x42,
+        0x2E, 0x94, 0xBA, 0x0D, 0x31, 0x08, 0x5C, 0x3F, 0xD9, 0xD9, 0xE0, 0x51,
+        0x65, 0x84, 0x5C, 0x40, 0x2F, 0xD4, 0xB4, 0xBE, 0x95, 0xE8, 0x4C, 0x02,
+        0x2C, 0xB6, 0x40, 0x0C, 0x35, 0x6A, 0x29, 0xD3, 0xF8, 0xCA, 0xD5, 0xA3,
+        0x74, 0x97, 0xC8, 0x10, 0x2C, 0x88, 0xCD, 0x96, 0xB4, 0x55, 0x29, 0xEA,
+        0xB1, 0x81, 0x7B, 0x10, 0x4A, 0x47, 0x10, 0x81, 0x4E, 0x88, 0x9B, 0x47,
+        0xEA, 0x6E, 0x8A, 0x0D, 0x88, 0xD4, 0x88, 0x3B, 0x1C, 0xC8, 0xCA, 0xE7,
+        0x84, 0x1A, 0x30, 0x92, 0x99, 0xF8, 0x6E, 0x64, 0x8C, 0x38, 0x0A, 0xFB,
+        0x6A, 0x5C, 0x48, 0x83, 0x1E, 0xA0, 0x26, 0xD1, 0x09, 0xE4, 0xAF, 0x6C,
+        0xC8, 0xA6, 0xDB, 0x27, 0x7F, 0xF1, 0x10, 0x25, 0xBC, 0x9A, 0x91, 0x2C,
+        0x62, 0x03, 0x8E, 0xD0, 0x63, 0x74, 0x9A, 0x95, 0xE6, 0x38, 0x3C, 0x04,
+        0xBE, 0xC0, 0x66, 0x7C, 0x1C, 0xE2, 0x40, 0x7F, 0x98, 0xC3, 0x44, 0xCB,
+        0xFA, 0x12, 0x60, 0x97, 0x54, 0x11, 0xB7, 0x40, 0xA7, 0x0F, 0xF0, 0xC6,
+        0x42, 0x54, 0xDC, 0x4D, 0xF0, 0x90, 0xBA, 0xF1, 0xBD, 0xDB, 0xC2, 0x66,
+        0x5E, 0xBF, 0xC9, 0x9C, 0xB3, 0x65, 0x48, 0x49, 0x7F, 0x97, 0x88, 0xBB,
+        0xF8, 0xD8, 0x6E, 0x85, 0xBA, 0x9C, 0x3B, 0x9D, 0x86, 0xF6, 0x89, 0x81,
+        0x34, 0xF3, 0xED, 0x23, 0x4F, 0x97, 0x77, 0x8E, 0x9B, 0x3A, 0x3C, 0x7C,
+        0xDC, 0xA5, 0xC2, 0xC1, 0x95, 0x88, 0xB8, 0x85, 0x31, 0x83, 0x31, 0xA0,
+        0x9D, 0x8B, 0xC0, 0xD1, 0xEF, 0x49, 0x6F, 0x08, 0x05, 0x3D, 0x3E, 0xB4,
+        0xB6, 0x4E, 0x36, 0xBA, 0x64, 0x9F, 0x4F, 0xC4, 0xE9, 0xE9, 0x8D, 0x71,
+        0x84, 0xC3, 0x05, 0xA1, 0xA2, 0xF0, 0xDE, 0xEA, 0x1B, 0xCF, 0xD3, 0x17,
+        0x9B, 0x6D, 0xC6, 0xE1, 0xAC, 0x3B, 0x64, 0xDE, 0x00, 0x8C, 0xC2, 0x33,
+        0x3B, 0x8F, 0x79, 0xE2, 0x42, 0xEB, 0x0F, 0x86, 0xC7, 0x1C, 0x05, 0x80,
+        0x1E, 0xDF, 0xF8, 0xAC, 0xD3, 0x86, 0xB0, 0x72, 0x1B, 0x77, 0x18, 0xAF,
+        0xAF, 0x73, 0xF3, 0x91, 0x7A, 0x05, 0x2F, 0x8E, 0x7A, 0x3E, 0x80, 0x45,
+        0xA9, 0x8D, 0xCC, 0xBD, 0x7F, 0xEB, 0x6E, 0x75, 0x3B, 0x76, 0xED, 0xEF,
+        0xEC, 0x9D, 0x48, 0x77, 0x81, 0x68, 0x92, 0x6E, 0xBF, 0x78, 0x76, 0xFE,
+        0x57, 0xCF, 0xA6, 0xEF, 0xDC, 0x5D, 0x2E, 0x97, 0x3B, 0xC0, 0x70, 0x61,
+        0x9C, 0x9E, 0xBF, 0xF8, 0xBC, 0x7E, 0xA8, 0x2E, 0x32, 0xAC, 0x90, 0x3F,
+        0xFC, 0x27, 0x70, 0x3C, 0x2C, 0x88, 0x08, 0x41, 0xF9, 0x1F, 0xF7, 0x9D,
+        0xCB, 0xE5, 0x7F, 0x75, 0xD8, 0x94, 0x79, 0xA4, 0x7A, 0x8D, 0x90, 0x2E,
+        0xB5, 0x63, 0x88, 0xCE, 0x26, 0x3C, 0x47, 0xE7, 0x71, 0x6E, 0xB0, 0x8D,
+        0x3C, 0xF2, 0xDB, 0x5E, 0x80, 0x68, 0x1C, 0xEF, 0x1C, 0x97, 0x92, 0x5B,
+        0x28, 0x2A, 0x51, 0x87, 0x1D, 0xB0, 0x4E, 0xCF, 0x86, 0x48, 0xC7, 0x58,
+        0xC1, 0x90, 0xC3, 0x9F, 0xEA, 0xF3, 0x72, 0xAB, 0x97, 0xBD, 0xE8, 0x52,
+        0xB8, 0xAD, 0x5D, 0x91, 0x47, 0x05, 0x0F, 0xD4, 0xF6, 0x67, 0xB5, 0x54,
+        0x75, 0xA2, 0x66, 0xCF, 0xFF, 0xC4, 0xA8, 0xDD, 0x77, 0x10, 0xEA, 0x1A,
+        0x04, 0xF2, 0xD9, 0xE3, 0x11, 0xF0, 0x4B, 0xF2, 0x43, 0xAD, 0x66, 0x71,
+        0x61, 0x88, 0x52, 0xF2, 0x68, 0xC1, 0x9B, 0x72, 0xD7, 0x30, 0xC6, 0x5E,
+        0xAE, 0x2A, 0x29, 0x9D, 0x58, 0x69, 0xE8, 0x63, 0x8D, 0xED, 0x4F, 0x74,
+        0x35, 0xF5, 0x72, 0xC5, 0xD4, 0xAB, 0x21, 0xFB, 0x4D, 0xC3, 0xD1, 0xE2,
+        0x68, 0x53, 0x6E, 0x83, 0xE0, 0x5B, 0xBB, 0xE9, 0x6D, 0x58, 0xD2, 0xF0,
+        0x60, 0x7B, 0x0D, 0xDD, 0x38, 0xD0, 0xC8, 0x55, 0x45, 0xEF, 0xA0, 0x31,
+        0x00, 0xC1, 0xED, 0xD1, 0xDF, 0x93, 0xE3, 0x2B, 0x6A, 0xF4, 0x50, 0x68,
+        0x02, 0x55, 0xBD, 0x16, 0xD6, 0x35, 0x2E, 0xBC, 0x64, 0x24, 0xF9, 0xB3,
+        0xEC, 0xE4, 0xE4, 0xCF, 0xA7, 0x2D, 0x08, 0xF1, 0xA9, 0x7E, 0x87, 0x91,
+        0x30, 0x0D, 0xEA, 0x4E, 0x03, 0xD9, 0x80, 0x20, 0x8C, 0x46, 0x6D, 0xDF,
+        0x9E, 0x8D, 0x97, 0xD1, 0xE3, 0xFA, 0x7C, 0x97, 0x64, 0xB6, 0xCC, 0x11,
+        0x71, 0x14, 0xFF, 0x20, 0x1F, 0x01, 0x7A, 0x27, 0x9B, 0x04, 0x6A, 0xD7,
+        0x1C, 0xDE, 0xBB, 0xF8, 0x7D, 0xF9, 0x68, 0x76, 0xAD, 0x6F, 0xE9, 0x33,
+        0xF1, 0x0E, 0x89, 0xE7, 0x4D, 0x7E, 0x34, 0x88, 0x33, 0xDD, 0xB8, 0x84,
+        0x49, 0x25, 0x88, 0xD1, 0x07, 0x77, 0x84, 0xA5, 0xC5, 0xF4, 0x33, 0x19,
+        0x91, 0x0F, 0xAB, 0x25, 0xBC, 0xF7, 0x70, 0x3E, 0xE0, 0xE2, 0xEA, 0xC0,
+        0x6C, 0x09, 0x53, 0xC2, 0x88, 0xD8, 0x10, 0x9A, 0x7F, 0xF2, 0x34, 0x8B,
+        0x51, 0x34, 0x57, 0xF6, 0x1A, 0x2E, 0x81, 0x0F, 0x7B, 0xE3, 0x47, 0xD4,
+        0x2B, 0xD4, 0x3F, 0x69, 0x07, 0xDA, 0x3D, 0x7F, 0x32, 0x1C, 0xF9, 0x33,
+        0x5F, 0x47, 0xB3, 0xC8, 0x8A, 0x41, 0xD4, 0x12, 0x87, 0xD5, 0xE7, 0x3A,
+        0x74, 0xE4, 0xF2, 0x67, 0x99, 0x6C, 0xD1, 0x69, 0xDE, 0x04, 0xC4, 0xE6,
+        0x03, 0x53, 0x3B, 0xE2, 0x56, 0x93, 0xB1, 0xB2, 0xBB, 0xB1, 0xA5, 0x14,
+        0xFA, 0x6C, 0xCB, 0xCE, 0xC1, 0x76, 0x02, 0x97, 0x18, 0xAA, 0x34, 0x7C,
+        0xB9, 0xE4, 0xEF, 0x00, 0xFE, 0xAA, 0x96, 0xEE, 0x06, 0x82, 0x01, 0x17,
+        0x01, 0xFE, 0x45, 0x48, 0xD8, 0x2D, 0xAB, 0x79, 0x2B, 0x4A, 0x66, 0x3A,
+        0x38, 0xD0, 0x07, 0xC1, 0x6B, 0xFE, 0x57, 0xB5, 0xB5, 0x25, 0x72, 0xB1,
+        0x98, 0x98, 0x2E, 0xB0, 0x9D, 0xCD, 0xBA, 0x21, 0xC0, 0x6A, 0xCC, 0x81,
+        0xBD, 0x91, 0xCC, 0xBD, 0xD8, 0x37, 0x48, 0xB9, 0x84, 0xAF, 0x8C, 0x07,
+        0x46, 0xC3, 0x2A, 0xD8, 0x2A, 0x2D, 0x15, 0x9D, 0x45, 0x8D, 0x9D, 0x45,
+        0xDC, 0xCE, 0xD3, 0xD0, 0xCC, 0x5B, 0x17, 0xB8, 0x12, 0x7C, 0xC7, 0xD2,
+        0x85, 0x2D, 0x2B, 0x02, 0x29, 0x7B, 0x11, 0x20, 0x7D, 0x5C, 0x3B, 0x67,
+        0x80, 0x93, 0x13, 0x00, 0x21, 0xF6, 0x65, 0x16, 0xC6, 0xE4, 0xEA, 0xEB,
+        0x19, 0x10, 0xC9, 0xE9, 0x8B, 0x5C, 0xC7, 0x9E, 0xC7, 0x80, 0x08, 0x6A,
+        0xE8, 0xDC, 0xE5, 0x4B, 0x95, 0x41, 0xD8, 0x7F, 0x94, 0xDC, 0x00, 0x1F,
+        0x98, 0x36, 0x6B, 0x83, 0xAD, 0x33, 0xA8, 0xED, 0x97, 0x26, 0xC8, 0xBD,
+        0x6E, 0xA4, 0xC9, 0x2F, 0xB4, 0x92, 0x96, 0x99, 0xD5, 0x26, 0xEB, 0x20,
+        0x13, 0x07, 0x9E, 0x5A, 0xFA, 0x3E, 0x94, 0xB1, 0x3B, 0xC4, 0x61, 0xFF,
+        0x79, 0x4B, 0x2C, 0x86, 0x87, 0x40, 0x90, 0xE8, 0x82, 0x51, 0x99, 0x96,
+        0x0E, 0x1F, 0x43, 0xE3, 0x89, 0x79, 0x66, 0xB5, 0x1E, 0xCA, 0x52, 0x0C,
+        0x53, 0x2C, 0xD4, 0xF8, 0x83, 0x72, 0x6A, 0x7B, 0xCE, 0x96, 0xC4, 0xCD,
+        0x01, 0xB2, 0x08, 0x99, 0xDC, 0x47, 0x7B, 0x4C, 0x12, 0x88, 0xE7, 0x85,
+        0xB9, 0xA0, 0x97, 0xEB, 0x2C, 0x0C, 0x27, 0xA0, 0x69, 0x4B, 0x06, 0x98,
+        0x37, 0x12, 0xCE, 0x7F, 0x0F, 0xDD, 0xBF, 0xDD, 0x32, 0x4D, 0x54, 0x37,
+        0x1F, 0x39, 0xB1, 0x5C, 0xFC, 0x5C, 0xB1, 0x00, 0xFA, 0x04, 0x30, 0x58,
+        0xBC, 0x54, 0xA7, 0xC5, 0xC6, 0xD3, 0x9D, 0xBD, 0x9A, 0x88, 0xDF, 0x30,
+        0x79, 0x54, 0x94, 0xD9, 0x25, 0xEE, 0x04, 0xF4, 0x26, 0x8C, 0xD9, 0xDF,
+        0x6E, 0x21, 0xA5, 0xC7, 0xB6, 0x22, 0x62, 0xD3, 0xB7, 0xE9, 0x92, 0x51,
+        0xDF, 0xB2, 0x74, 0x87, 0x5A, 0x95, 0x14, 0xA9, 0xA7, 0xD8, 0x06, 0x54,
+        0xC7, 0x04, 0x9F, 0x24, 0x42, 0x4F, 0xFC, 0x6D, 0x8D, 0x13, 0xEC, 0x82,
+        0x92, 0xDA, 0x86, 0x48, 0x8B, 0x50, 0x33, 0x93, 0xEE, 0x4C, 0xAD, 0x2E,
+        0x26, 0xA5, 0x0B, 0x39, 0x71, 0x80, 0x9C, 0xEA, 0xF5, 0x71, 0xEA, 0xDB,
+        0x91, 0x36, 0xD4, 0x25, 0xC1, 0x7F, 0xF2, 0x1B, 0x68, 0x0B, 0xCD, 0xA6,
+        0xD8, 0x99, 0x45, 0xA9, 0x25, 0xAB, 0x8B, 0xA0, 0x4C, 0x2A, 0xB2, 0xD2,
+        0x86, 0xBC, 0x7D, 0xF4, 0x93, 0xC8, 0xD2, 0x1A, 0xAE, 0x73, 0x40, 0x6C,
+        0xE3, 0x7B, 0x04, 0x15, 0x3C, 0x96, 0x4D, 0xC4, 0x71, 0x36, 0xF3, 0xFC,
+        0x45, 0x98, 0xD2, 0x8B, 0x57, 0x78, 0x21, 0xDA, 0x48, 0x17, 0x5E, 0xE1,
+        0xA9, 0xF3, 0x36, 0x3A, 0xBF, 0xD3, 0x32, 0x3F, 0xC1, 0x83, 0x0F, 0x28,
+        0xC4, 0x3A, 0xDE, 0x92, 0xB7, 0x61, 0x39, 0x59, 0xC7, 0x84, 0x8A, 0x6D,
+        0x98, 0xB0, 0x4E, 0x17, 0x1C, 0x6E, 0xD1, 0x13, 0x6B, 0xFC, 0xD2, 0x6A,
+        0xD1, 0x90, 0x54, 0x21, 0xA8, 0xE0, 0xD2, 0x1D, 0xC8, 0x62, 0x35, 0xC0,
+        0x3A, 0x39, 0x9B, 0x4D, 0x11, 0xBE, 0xD6, 0x06, 0xBD, 0x41, 0x8E, 0x92,
+        0xE0, 0x1B, 0xD5, 0xF8, 0xD1, 0x3E, 0xD6, 0x47, 0xFD, 0xE4, 0x41, 0xFC,
+        0x98, 0xEB, 0xF1, 0x83, 0xAE, 0x3C, 0xD7, 0xE2, 0x07, 0x44, 0x65, 0x9E,
+        0x88, 0x1F, 0x90, 0x95, 0x79, 0x22, 0x7E, 0xC8, 0x0D, 0xF3, 0x44, 0xFC,
+        0xE0, 0x1B, 0xE6, 0xB1, 0xE3, 0x07, 0x64, 0xBC, 0x79, 0x5A, 0xFC, 0x80,
+        0x1A, 0xCC, 0xE3, 0xF1, 0xC3, 0xF8, 0x88, 0x69, 0x1C, 0x49, 0xA9, 0xD7,
+        0x99, 0x0F, 0xCF, 0x30, 0x15, 0x2C, 0x11, 0x4B, 0x0D, 0x18, 0x44, 0x70,
+        0xF8, 0x29, 0x11, 0x09, 0x61, 0x52, 0x30, 0x81, 0xF7, 0x62, 0xC2, 0x27,
+        0x78, 0xCF, 0x35, 0x54, 0xCA, 0xBD, 0x90, 0x1C, 0x1B, 0x10, 0x93, 0xC5,
+        0x64, 0x54, 0xD1, 0x8E, 0x07, 0x50, 0xD4, 0x92, 0xEB, 0xCB, 0xC9, 0x65,
+        0xF5, 0x6D, 0x36, 0x7B, 0xC2, 0xAB, 0x19, 0xE3, 0x51, 0xD1, 0x9E, 0x32,
+        0xCB, 0x17, 0xBB, 0xF5, 0xB6, 0xDF, 0xC1, 0xBF, 0xE1, 0x82, 0x47, 0x12,
+        0x45, 0x7D, 0x83, 0x59, 0x66, 0x9E, 0xEB, 0x6C, 0xCE, 0x3A, 0x15, 0x87,
+        0x6D, 0x6A, 0x27, 0xB9, 0xBF, 0x3E, 0x68, 0xBD, 0xBF, 0xA9, 0x36, 0xAC,
+        0x3A, 0x85, 0x5D, 0x6D, 0x43, 0xA9, 0x50, 0xDB, 0xA8, 0xA5, 0x3D, 0xC7,
+        0xB2, 0x81, 0x22, 0x34, 0xAD, 0x6E, 0x44, 0x5C, 0xC6, 0x87, 0xE2, 0x00,
+        0xE9, 0xAA, 0xB2, 0x2B, 0xDA, 0x26, 0xC0, 0x6D, 0x36, 0xD3, 0xB2, 0x94,
+        0x32, 0x1D, 0x77, 0xC7, 0xA0, 0xF5, 0x22, 0x17, 0x0F, 0x04, 0xE1, 0xEB,
+        0xB6, 0x89, 0x6C, 0xBB, 0x3C, 0x92, 0x48, 0x07, 0x23, 0x7C, 0xC3, 0x0F,
+        0x81, 0x3B, 0x08, 0x8B, 0xBD, 0xC8, 0xC5, 0x16, 0x4F, 0x88, 0x93, 0x18,
+        0x61, 0x49, 0x24, 0x0C, 0xE1, 0x17, 0xC5, 0x42, 0x91, 0xD7, 0xD5, 0x52,
+        0x0B, 0xF0, 0xEF, 0xAB, 0x9A, 0x2D, 0xAD, 0xCC, 0xC7, 0x9D, 0x84, 0x2D,
+        0xCB, 0x2F, 0x1D, 0xD0, 0xBE, 0x08, 0xF5, 0xB1, 0x76, 0x04, 0x47, 0x37,
+        0x22, 0x43, 0x26, 0x84, 0x47, 0x84, 0x8C, 0x61, 0x2F, 0x9A, 0xE5, 0xEF,
+        0x0A, 0x7D, 0x89, 0x23, 0x36, 0xC1, 0x5E, 0x9D, 0xF0, 0x9F, 0x74, 0x15,
+        0x78, 0x08, 0x81, 0x60, 0x84, 0x50, 0x11, 0x93, 0x20, 0xDC, 0xB6, 0xAB,
+        0x84, 0x8E, 0xEA, 0x35, 0xF2, 0xDE, 0xA3, 0x99, 0x67, 0x95, 0x68, 0x10,
+        0x10, 0x45, 0xA2, 0x36, 0xE3, 0x76, 0xC2, 0x91, 0x1E, 0xF5, 0x90, 0x6A,
+        0xEF, 0x97, 0xDE, 0x24, 0xF0, 0x3B, 0x41, 0x20, 0x52, 0x8E, 0x10, 0xAD,
+        0x21, 0x19, 0x73, 0x03, 0xE8, 0x05, 0x05, 0x5D, 0xE6, 0x7B, 0xB0, 0x2B,
+        0x09, 0xA8, 0x39, 0xBA, 0x34, 0xD3, 0xDA, 0x52, 0x1A, 0xC2, 0x1C, 0x9F,
+        0xC9, 0xEE, 0x90, 0x0E, 0xA4, 0x3F, 0xF4, 0x62, 0x39, 0xE5, 0x73, 0x88,
+        0xC8, 0xC8, 0x9A, 0xC8, 0xA3, 0xC9, 0xDA, 0x4E, 0x5D, 0xA9, 0x8D, 0xD3,
+        0x62, 0x6A, 0x0E, 0xBF, 0xB4, 0xF5, 0x0B, 0x0E, 0x52, 0x24, 0x1B, 0xDE,
+        0x8B, 0x0D, 0x23, 0xE9, 0x69, 0x68, 0x9F, 0x54, 0x7E, 0xC4, 0x92, 0xC3,
+        0xC1, 0xE1, 0xC4, 0x0C, 0xB1, 0xCD, 0x1B, 0x07, 0x8E, 0x66, 0x45, 0x44,
+        0x42, 0x63, 0x75, 0x4F, 0xA7, 0xAD, 0x34, 0x0F, 0xB5, 0x63, 0xC7, 0x14,
+        0x3F, 0x99, 0x5E, 0x91, 0x03, 0xA4, 0xD3, 0x35, 0x37, 0x48, 0x6D, 0x6B,
+        0x1D, 0x64, 0x95, 0x04, 0x58, 0x61, 0xB3, 0xD5, 0xB2, 0xCE, 0x8B, 0xE7,
+        0x68, 0xAC, 0x73, 0x8F, 0x37, 0x69, 0x51, 0x3F, 0x25, 0xA4, 0xEF, 0x36,
+        0x7E, 0x05, 0x67, 0x1F, 0x60, 0x13, 0xFC, 0x17, 0x59, 0x34, 0xCB, 0xE0,
+        0x24, 0x1E, 0xBF, 0xBE, 0x15, 0x65, 0x26, 0x61, 0xA7, 0x25, 0xA5, 0xBE,
+        0x0E, 0xCB, 0x49, 0xC0, 0x59, 0xE8, 0x42, 0x42, 0xE9, 0xF3, 0xEF, 0x03,
+        0x0E, 0x8E, 0xF3, 0xCA, 0xAA, 0xE4, 0x9A, 0x48, 0xC3, 0x19, 0xF7, 0x59,
+        0x1B, 0xA2, 0x7D, 0x5F, 0x6C, 0xE9, 0xCF, 0x81, 0x6C, 0x69, 0xA8, 0xB4,
+        0x4D, 0x04, 0x85, 0x3F, 0x3F, 0xD5, 0xE1, 0x6F, 0x68, 0x58, 0x84, 0x82,
+        0xB2, 0x0C, 0x74, 0x81, 0xF2, 0x9A, 0x7F, 0xE4, 0xBB, 0x90, 0x5A, 0x01,
+        0x1D, 0x4C, 0x68, 0xC5, 0x90, 0x73, 0x9D, 0x1F, 0x7C, 0x5F, 0x13, 0xCB,
+        0x2E, 0x84, 0xA1, 0x27, 0xC8, 0xB1, 0xFC, 0x70, 0x34, 0xDB, 0x52, 0xBE,
+        0xF9, 0x67, 0x98, 0x59, 0xF9, 0x98, 0xA5, 0x5E, 0xA6, 0xB2, 0xB4, 0x6E,
+        0xF2, 0x70, 0xF4, 0x4F, 0x6F, 0x1E, 0x1E, 0x8B, 0x45, 0x58, 0x1F, 0xCA,
+        0x42, 0xE2, 0xB3, 0x72, 0x5D, 0x75, 0x25, 0x51, 0xEF, 0x05, 0xEB, 0x72,
+        0x67, 0x68, 0xE5, 0x0A, 0xE1, 0x39, 0x2F, 0xD0, 0xD6, 0x8A, 0xB4, 0x75,
+        0xAA, 0x18, 0x50, 0x7C, 0x73, 0x55, 0x05, 0x32, 0xCA, 0x87, 0x94, 0x7A,
+        0x50, 0xA2, 0xC1, 0x77, 0x84, 0x7D, 0x17, 0xBC, 0x22, 0xA0, 0x07, 0x94,
+        0xF6, 0xCC, 0x66, 0xCB, 0x38, 0x9B, 0x29, 0x80, 0x79, 0x38, 0x61, 0x89,
+        0x0B, 0xA9, 0xF1, 0xDC, 0x32, 0xDB, 0xE6, 0x0F, 0x4C, 0xA5, 0x86, 0x9F,
+        0x0C, 0x99, 0xE1, 0xBC, 0x61, 0x9F, 0xBE, 0x7E, 0x40, 0x4B, 0x03, 0xCD,
+        0xE1, 0xDD, 0xC4, 0x52, 0x19, 0xF5, 0x76, 0x25, 0x46, 0xAB, 0xF4, 0xAC,
+        0x13, 0x50, 0x5C, 0x48, 0x1F, 0x70, 0x42, 0x3E, 0x03, 0xAB, 0xD9, 0x86,
+        0x60, 0xBF, 0x16, 0xAD, 0x2D, 0x05, 0xD3, 0xDF, 0x7E, 0xD4, 0x88, 0xEA,
+        0xBF, 0x2A, 0x76, 0xF1, 0xB6, 0xFE, 0xA9, 0xB8, 0x12, 0xCD, 0x06, 0x10,
+        0x58, 0xA3, 0x78, 0x95, 0xDD, 0x0F, 0xAB, 0xC7, 0x7A, 0x99, 0xD5, 0x28,
+        0x0F, 0x93, 0xF1, 0xDB, 0x40, 0x01, 0xBA, 0xE2, 0x48, 0x04, 0x9D, 0xB4,
+        0xC7, 0x97, 0xF2, 0xD6, 0x0C, 0x5C, 0xE8, 0xE9, 0x22, 0x0B, 0x7F, 0x50,
+        0x17, 0x32, 0x47, 0x61, 0xAC, 0x4F, 0xFC, 0x8B, 0x7A, 0x78, 0x8A, 0x7B,
+        0x09, 0x2B, 0xAD, 0x39, 0x36, 0x01, 0xA8, 0xA6, 0x60, 0x0F, 0xB6, 0x38,
+        0x14, 0xE8, 0x29, 0xA9, 0x22, 0xF8, 0xDE, 0xCD, 0x19, 0xF7, 0x4E, 0x63,
+        0xBE, 0xD9, 0x7A, 0x84, 0x8D, 0x34, 0x05, 0x44, 0x4F, 0xA7, 0x88, 0xD2,
+        0xF9, 0x76, 0x9A, 0x87, 0xA3, 0xEE, 0x90, 0xAA, 0x75, 0xFA, 0x75, 0xEA,
+        0x95, 0x6B, 0xF8, 0x11, 0xFE, 0xE8, 0x80, 0xB6, 0x30, 0x75, 0x25, 0x1E,
+        0xB4, 0x19, 0x60, 0xCD, 0xD7, 0x0C, 0x17, 0x02, 0xA9, 0xA9, 0x28, 0xBE,
+        0x40, 0x96, 0xBD, 0x3A, 0xBB, 0x31, 0x45, 0x22, 0x88, 0x81, 0xFD, 0xAC,
+        0x23, 0x6D, 0x50, 0x93, 0xE4, 0x7C, 0x5B, 0xC2, 0x8B, 0xB6, 0x65, 0xF4,
+        0x63, 0xD4, 0xA3, 0x37, 0x74, 0x5C, 0x14, 0x77, 0x7D, 0xBB, 0x75, 0x4C,
+        0x71, 0x01, 0xEB, 0xCD, 0x88, 0x1A, 0xE1, 0xB0, 0x49, 0xAF, 0x3E, 0xD1,
+        0x89, 0x5F, 0xDB, 0x5C, 0x27, 0x96, 0x54, 0xA5, 0xBD, 0xC4, 0x67, 0xB4,
+        0x55, 0x6D, 0x39, 0xCC, 0x46, 0xBE, 0xFA, 0x61, 0xE7, 0xED, 0x8D, 0x9B,
+        0x8D, 0x8B, 0x35, 0x81, 0x7B, 0xA2, 0xC1, 0x74, 0x64, 0xAE, 0xAF, 0x54,
+        0x13, 0x63, 0x3B, 0x1D, 0xD1, 0xC1, 0x3C, 0x6B, 0xDD, 0x1E, 0x04, 0x60,
+        0x67, 0x55, 0x52, 0xBE, 0x38, 0x6B, 0x81, 0x6C, 0x00, 0x82, 0xD4, 0x9C,
+        0x41, 0x8F, 0x4E, 0xFB, 0x89, 0xE0, 0x3D, 0x48, 0xCA, 0x0C, 0x05, 0xB6,
+        0xA4, 0xE4, 0x23, 0xFB, 0xE2, 0x0A, 0xB7, 0x30, 0x4E, 0xF5, 0x2E, 0x4C,
+        0x6E, 0xBF, 0x47, 0x7F, 0x77, 0x6B, 0xA8, 0x09, 0x1A, 0x5C, 0x01, 0x96,
+        0x8C, 0xBA, 0x9C, 0x7E, 0x50, 0x7A, 0xD1, 0x9A, 0x6A, 0x37, 0x1A, 0xE7,
+        0x18, 0x0C, 0x1E, 0xCA, 0x6A, 0xFF, 0xCE, 0x6B, 0x02, 0x27, 0x88, 0x1D,
+        0x22, 0x6E, 0x86, 0x55, 0x9A, 0xEA, 0x0B, 0x0F, 0xE1, 0xA6, 0xB7, 0xB3,
+        0x23, 0x8C, 0x23, 0xA1, 0x40, 0x39, 0x50, 0xD8, 0x4D, 0x0A, 0xCD, 0x4C,
+        0xBF, 0x5B, 0xD0, 0x6C, 0xE4, 0xB3, 0x3F, 0x57, 0xCB, 0xAD, 0x5E, 0x72,
+        0x1C, 0x31, 0x29, 0x55, 0x18, 0x2B, 0x56, 0x00, 0xC2, 0xAA, 0x86, 0x94,
+        0xDE, 0x43, 0x69, 0x1D, 0x89, 0x73, 0x30, 0xC0, 0xD3, 0x24, 0xCC, 0xC1,
+        0x9F, 0x22, 0x10, 0xBE, 0x04, 0x95, 0x41, 0xC4, 0xD9, 0x8D, 0x34, 0xAA,
+        0xC4, 0x6D, 0x70, 0x29, 0x6A, 0xC7, 0x92, 0xF7, 0x84, 0xBA, 0x7F, 0x6A,
+        0x52, 0x6E, 0x97, 0x1A, 0x93, 0x3B, 0x6C, 0xE5, 0x95, 0x32, 0x3B, 0xDA,
+        0x95, 0x2C, 0x48, 0x39, 0x76, 0xD1, 0x21, 0xF0, 0x76, 0xB0, 0xBE, 0x6C,
+        0xF0, 0xD2, 0x2F, 0x6B, 0x8F, 0x1A, 0xF0, 0x2C, 0x8A, 0x92, 0x74, 0xBE,
+        0x52, 0x7A, 0x36, 0xA7, 0xD3, 0x68, 0xE4, 0xED, 0xD3, 0xF1, 0x5D, 0xCF,
+        0x99, 0xED, 0xA7, 0x73, 0x52, 0x84, 0xEB, 0x5B, 0xF3, 0x5C, 0x91, 0x83,
+        0xB3, 0x70, 0xDB, 0x8C, 0x6D, 0x62, 0x09, 0xF9, 0x72, 0x32, 0xAB, 0xDB,
+        0xDC, 0x63, 0x11, 0x19, 0xD6, 0x5B, 0x17, 0x56, 0xCF, 0xE4, 0xCB, 0x62,
+        0x3F, 0x22, 0x0C, 0x4A, 0x49, 0x8C, 0x04, 0xD1, 0xA6, 0xC8, 0xA0, 0x63,
+        0x4E, 0x61, 0xA0, 0xBE, 0x04, 0xCD, 0xDB, 0xAC, 0x5D, 0xD6, 0x6F, 0x6C,
+        0x7F, 0x0A, 0x01, 0x75, 0x34, 0xE7, 0x95, 0x8D, 0xF6, 0x13, 0xED, 0x46,
+        0x69, 0x54, 0xB9, 0xC1, 0x43, 0x36, 0xCC, 0x97, 0x06, 0xFE, 0xDD, 0x16,
+        0xB5, 0xCF, 0xB9, 0xA7, 0x49, 0x5B, 0x82, 0xC9, 0x89, 0x07, 0x8C, 0xAE,
+        0xEC, 0x77, 0x45, 0x27, 0x0F, 0x36, 0xFC, 0x21, 0x06, 0x66, 0xC3, 0xEB,
+        0x9E, 0x8B, 0x97, 0xFA, 0x19, 0x5F, 0x71, 0xC0, 0xAD, 0x99, 0x9B, 0xB3,
+        0xD5, 0x00, 0x9A, 0x4D, 0xFE, 0x65, 0x44, 0x20, 0xB9, 0x09, 0xA3, 0xC3,
+        0x65, 0xAB, 0x60, 0x39, 0x38, 0x70, 0xEA, 0x1A, 0xBF, 0xCB, 0x13, 0x4E,
+        0x77, 0x72, 0x90, 0x8C, 0xAF, 0x97, 0x41, 0xC6, 0x78, 0x73, 0xDB, 0x13,
+        0x2C, 0x97, 0xEF, 0x5A, 0x47, 0x19, 0x5A, 0xD0, 0xA7, 0xAB, 0x3E, 0x73,
+        0x1D, 0x08, 0xCE, 0x53, 0x7A, 0x66, 0x52, 0x12, 0x33, 0x8D, 0xE9, 0x23,
+        0x21, 0x63, 0x79, 0xC4, 0x07, 0xFB, 0x5C, 0x22, 0xCC, 0xDD, 0xBD, 0xB5,
+        0x83, 0xE2, 0x30, 0x5C, 0xAC, 0x97, 0x19, 0x9D, 0x03, 0xE1, 0x34, 0x86,
+        0x55, 0xAC, 0x52, 0x79, 0x0F, 0x97, 0x8C, 0xF7, 0x24, 0x81, 0x41, 0x26,
+        0xC4, 0xF7, 0x12, 0xE3, 0x79, 0x89, 0xF3, 0xBB, 0x84, 0x18, 0x67, 0x92,
+        0x33, 0xCD, 0x24, 0x32, 0xC2, 0xA4, 0x31, 0xC1, 0x24, 0x32, 0xC0, 0x84,
+        0x98, 0x5F, 0xC2, 0xEC, 0x39, 0x71, 0x8E, 0x97, 0xA4, 0x9C, 0x2D, 0xC9,
+        0xD8, 0x55, 0x92, 0xF7, 0x3F, 0x07, 0x35, 0x2E, 0xA6, 0x87, 0x5F, 0xED,
+        0xD0, 0x8B, 0x8F, 0xB9, 0x3A, 0xF9, 0x40, 0x4A, 0x87, 0x4F, 0xC4, 0x80,
+        0x0A, 0x97, 0x78, 0xEA, 0x74, 0x38, 0x3C, 0x5C, 0xD1, 0x4E, 0xB1, 0xEA,
+        0x5D, 0xED, 0x9A, 0xFA, 0xA7, 0xFB, 0x1D, 0xF9, 0x30, 0x73, 0xB8, 0x9B,
+        0xB9, 0x91, 0x40, 0x52, 0x16, 0x63, 0x68, 0x63, 0x93, 0xF7, 0x8B, 0xF1,
+        0x5A, 0xBA, 0xC8, 0xA9, 0xAE, 0x7A, 0xA3, 0xCA, 0xEA, 0x9C, 0xF0, 0xF6,
+        0x86, 0x74, 0x5F, 0xC4, 0xA9, 0x94, 0xD5, 0x06, 0x9C, 0xB5, 0x4F, 0x19,
+        0xCD, 0xE1, 0xF1, 0xDD, 0x95, 0xDD, 0x68, 0xFC, 0xF7, 0xB1, 0x1F, 0x7A,
+        0xC5, 0xDA, 0x95, 0xDC, 0x42, 0x5F, 0x4E, 0x3D, 0x53, 0x7A, 0x98, 0xF1,
+        0x7C, 0x08, 0xCC, 0xD7, 0x06, 0x56, 0xF2, 0x85, 0x59, 0xE7, 0x1E, 0xC2,
+        0x2A, 0xE6, 0xF7, 0xBB, 0xA0, 0x7F, 0x4E, 0x81, 0x11, 0xBD, 0xD4, 0xD1,
+        0xF8, 0x27, 0xAC, 0x62, 0xD9, 0xB4, 0x7A, 0xD7, 0xD6, 0x4E, 0xC0, 0x19,
+        0x40, 0xA8, 0x11, 0x56, 0x31, 0x7F, 0x30, 0xD4, 0xE4, 0x82, 0x57, 0x9A,
+        0x69, 0xC2, 0x19, 0x71, 0x78, 0x81, 0xAE, 0x76, 0x29, 0x5B, 0x7E, 0x7D,
+        0x60, 0xBD, 0x98, 0x11, 0x5A, 0xF8, 0xA7, 0xAB, 0x5D, 0xCF, 0x1B, 0x8D,
+        0xFF, 0x76, 0x77, 0x95, 0x8A, 0x4F, 0xCF, 0xDA, 0xCA, 0x33, 0x9F, 0x50,
+        0x6C, 0x65, 0xC3, 0xD4, 0x2B, 0x43, 0x67, 0x15, 0xEF, 0x97, 0x89, 0x77,
+        0xAF, 0x68, 0xE0, 0x50, 0x6A, 0xA5, 0x38, 0x2F, 0x6F, 0xF6, 0xD1, 0xD5,
+        0x42, 0x99, 0x1C, 0xDA, 0x8A, 0xBE, 0xCE, 0x7E, 0x0D, 0x8A, 0x97, 0x96,
+        0xB8, 0xE9, 0x8C, 0xDA, 0x2B, 0x55, 0x3C, 0xFC, 0xA8, 0xC5, 0xFA, 0x81,
+        0xF5, 0x62, 0xB1, 0xE2, 0x43, 0xD8, 0x18, 0xEB, 0xF9, 0xD3, 0x38, 0xF6,
+        0x44, 0x84, 0x29, 0x90, 0x12, 0x9C, 0x7C, 0xD6, 0xD9, 0xC6, 0x34, 0x94,
+        0x47, 0xC9, 0x35, 0xC7, 0xAF, 0x63, 0x38, 0x7E, 0x09, 0x91, 0x7A, 0x5F,
+        0x37, 0xBA, 0x8E, 0x12, 0x65, 0xF9, 0xE3, 0xEE, 0x2C, 0x6B, 0x7D, 0x67,
+        0xB0, 0xA7, 0x2C, 0x75, 0xCC, 0x49, 0x3A, 0x90, 0x16, 0xC3, 0xBB, 0x74,
+        0xB5, 0x98, 0x35, 0x81, 0x97, 0x27, 0x11, 0x52, 0x5B, 0x1C, 0xA6, 0x13,
+        0x39, 0x8F, 0xA4, 0x04, 0xF5, 0x26, 0xB0, 0xD1, 0x08, 0xAB, 0x98, 0xD0,
+        0x48, 0x4D, 0x97, 0x92, 0x00, 0x02, 0x0E, 0x96, 0x0F, 0x0F, 0x96, 0xDC,
+        0xB7, 0x6E, 0x33, 0x74, 0x9C, 0x42, 0x33, 0x52, 0x2B, 0xA3, 0x21, 0x75,
+        0x8F, 0xDF, 0xDB, 0xD1, 0xD5, 0xB1, 0x1A, 0xDB, 0xA7, 0x6C, 0xA4, 0xAE,
+        0x24, 0x9D, 0xA0, 0xC7, 0xD4, 0x55, 0x57, 0x27, 0x83, 0x76, 0xEC, 0x99,
+        0xD6, 0x52, 0xFF, 0x1E, 0xA1, 0x39, 0x1F, 0x1E, 0x0B, 0x43, 0x53, 0x5E,
+        0x3E, 0x0C, 0xCA, 0xD7, 0x89, 0x3A, 0x25, 0x7C, 0xAB, 0x73, 0x0F, 0x4F,
+        0xEA, 0x3C, 0xB3, 0x30, 0x62, 0xF7, 0x14, 0x39, 0x79, 0x32, 0xA2, 0xB3,
+        0x44, 0xEE, 0xA4, 0x34, 0x94, 0x42, 0x5E, 0x9C, 0xD6, 0x77, 0x00, 0x39,
+        0x8B, 0x48, 0xCA, 0x19, 0x23, 0xD2, 0xAB, 0xC6, 0x6A, 0xD5, 0x40, 0x1E,
+        0xF2, 0xCF, 0x94, 0xE3, 0xF7, 0xDE, 0x65, 0x47, 0x8E, 0x3C, 0x78, 0x29,
+        0xA8, 0x00, 0x87, 0x3B, 0xFE, 0x79, 0xC9, 0xBB, 0x00, 0xF9, 0x9C, 0x23,
+        0xE4, 0xFE, 0xB8, 0xE7, 0x8D, 0x7A, 0x14, 0x1B, 0x0B, 0xCF, 0x07, 0xCD,
+        0x07, 0xF6, 0x9A, 0xE5, 0x45, 0x2B, 0x1E, 0x97, 0x4F, 0x34, 0xC2, 0x31,
+        0xAF, 0x7A, 0x12, 0x3A, 0xD7, 0xDC, 0xB0, 0x3B, 0x50, 0x17, 0x09, 0x67,
+        0x20, 0xF1, 0xF1, 0x5B, 0x79, 0x5A, 0xAE, 0x67, 0x2B, 0x6F, 0x49, 0xFC,
+        0x6C, 0x43, 0x39, 0xB2, 0x4C, 0xBD, 0xEF, 0x59, 0x72, 0x16, 0x20, 0x17,
+        0x63, 0x99, 0x26, 0xAF, 0x30, 0x9A, 0xE6, 0x46, 0xFD, 0xE2, 0x06, 0x5D,
+        0xA4, 0x48, 0xED, 0xD7, 0x3A, 0x41, 0xD6, 0x78, 0x00, 0x39, 0x8C, 0x9B,
+        0x29, 0x79, 0x91, 0xD4, 0x48, 0xAD, 0xF4, 0x75, 0xD8, 0xCD, 0x16, 0x10,
+        0x08, 0x77, 0x75, 0xCC, 0x8B, 0x1A, 0x73, 0xED, 0x91, 0xE1, 0xA4, 0x90,
+        0xF5, 0x6A, 0x4D, 0x1E, 0xF9, 0x29, 0x9B, 0x9C, 0x16, 0x88, 0x4E, 0xD4,
+        0xA5, 0xB0, 0x4A, 0xDE, 0xED, 0x99, 0x36, 0xC6, 0xA1, 0x26, 0xE5, 0x03,
+        0xD9, 0xE3, 0x13, 0x7A, 0xEE, 0x41, 0xD7, 0xF9, 0x83, 0x06, 0x8C, 0x42,
+        0x6D, 0xB4, 0xF0, 0x6F, 0x5E, 0x35, 0xF5, 0x45, 0xA1, 0x6F, 0x5F, 0x61,
+        0x10, 0x5D, 0x5F, 0xEF, 0xAF, 0x3B, 0x03, 0x65, 0xA6, 0xAE, 0x09, 0x29,
+        0x1A, 0xA6, 0x0A, 0xC4, 0xC4, 0x55, 0xDA, 0x34, 0x13, 0xEE, 0x6A, 0x1E,
+        0x6E, 0x86, 0xC9, 0x83, 0xB5, 0xB2, 0x7D, 0x6F, 0x60, 0xAE, 0x48, 0x27,
+        0x8E, 0x55, 0x56, 0xA4, 0x22, 0x52, 0x5A, 0x45, 0x98, 0x01, 0xBD, 0x32,
+        0xB3, 0xE3, 0x83, 0xC8, 0xB5, 0x06, 0xE9, 0x84, 0xB6, 0x13, 0xEA, 0x5D,
+        0x80, 0x41, 0x74, 0x17, 0x39, 0x34, 0x57, 0x38, 0x02, 0x12, 0x5C, 0x2A,
+        0x73, 0x8B, 0xA8, 0xFA, 0x2D, 0x1B, 0x44, 0x04, 0x2A, 0x48, 0x95, 0x5E,
+        0x25, 0xF6, 0x11, 0xF2, 0x44, 0x5A, 0x48, 0x14, 0x72, 0x43, 0x56, 0xAE,
+        0x04, 0x49, 0x72, 0x59, 0x77, 0x8A, 0xB2, 0xBB, 0x31, 0x03, 0x1B, 0xCC,
+        0x55, 0x9B, 0x32, 0x46, 0x25, 0xF5, 0x18, 0x22, 0xB3, 0xCA, 0x11, 0x98,
+        0x41, 0xCD, 0x23, 0x3B, 0x57, 0x8D, 0xF5, 0x5A, 0x50, 0x7A, 0x58, 0x66,
+        0xCB, 0x08, 0x35, 0xCE, 0x09, 0x6A, 0xCA, 0x17, 0xF0, 0x17, 0x98, 0x4B,
+        0x7F, 0x59, 0xD4, 0xA1, 0x77, 0xBF, 0xCB, 0xA5, 0x9E, 0xAC, 0x12, 0x50,
+        0x69, 0xDD, 0x85, 0x3A, 0x0C, 0x87, 0x24, 0x70, 0x71, 0x87, 0x11, 0x71,
+        0x4D, 0xF3, 0x6A, 0xC4, 0x18, 0x9E, 0x1A, 0xDE, 0xF7, 0x18, 0xCA, 0x19,
+        0x37, 0x47, 0x54, 0xD3, 0x25, 0x7A, 0x56, 0xDF, 0x2E, 0x3D, 0xBA, 0x5B,
+        0x4B, 0x86, 0x66, 0x26, 0x58, 0x19, 0xDF, 0xD7, 0x52, 0x9D, 0x7D, 0x4C,
+        0x77, 0xBB, 0x4C, 0x62, 0xF1, 0x0A, 0xA5, 0x72, 0x28, 0xB2, 0x96, 0x88,
+        0x0B, 0x22, 0x8E, 0xBA, 0xE8, 0x83, 0xE0, 0x8B, 0xF6, 0xF6, 0xC4, 0x7D,
+        0x49, 0xFB, 0xE2, 0x9C, 0x0B, 0xF4, 0xAF, 0x3D, 0xE8, 0xC0, 0x5F, 0x87,
+        0x4D, 0xBA, 0x95, 0x0E, 0x21, 0x1F, 0x86, 0x75, 0xE9, 0xF2, 0xBC, 0xF6,
+        0xD2, 0x2B, 0xA8, 0xE2, 0x7F, 0xDA, 0xCF, 0x75, 0xD3, 0x8F, 0xEF, 0xED,
+        0x29, 0xB5, 0x75, 0x7A, 0x15, 0x58, 0x8F, 0x75, 0x9A, 0xD4, 0xD1, 0xC4,
+        0x75, 0x51, 0x04, 0xBA, 0xA4, 0x4D, 0xB2, 0x50, 0xDC, 0x47, 0x03, 0xED,
+        0x21, 0x6C, 0x61, 0x45, 0xD3, 0x72, 0x05, 0xB0, 0xE2, 0xD5, 0x5F, 0x1B,
+        0xBC, 0x4E, 0xCE, 0x0A, 0x56, 0x11, 0x44, 0x8F, 0x1A, 0x57, 0x59, 0x7F,
+        0xCD, 0xB1, 0x27, 0x19, 0xC9, 0xC2, 0xF2, 0xDA, 0xAB, 0x99, 0x6B, 0x82,
+        0xAC, 0xFE, 0xF2, 0x96, 0x24, 0xF6, 0x6D, 0x80, 0xC1, 0x4A, 0x3A, 0xCF,
+        0x6A, 0xA3, 0xA4, 0x84, 0x94, 0x59, 0x90, 0x39, 0xEE, 0x75, 0xFC, 0x32,
+        0x2C, 0xDD, 0xA7, 0xF9, 0xB1, 0x90, 0x9D, 0x54, 0xEE, 0x91, 0x9F, 0xB8,
+        0x1E, 0xB0, 0x6B, 0x07, 0xBC, 0x3C, 0xD9, 0xE0, 0x4F, 0x6B, 0x44, 0x71,
+        0xDA, 0x8A, 0x16, 0x3B, 0x18, 0x9D, 0x4C, 0xDD, 0x51, 0x54, 0x4F, 0x91,
+        0x13, 0x8B, 0x6B, 0xF8, 0x94, 0x87, 0x66, 0x8B, 0x48, 0x88, 0x56, 0x31,
+        0xFB, 0x70, 0x6E, 0x24, 0x95, 0xA3, 0x35, 0x65, 0x81, 0x0B, 0xA9, 0x2F,
+        0x35, 0x62, 0xB2, 0xB3, 0x58, 0x02, 0x6B, 0x26, 0xE7, 0x9A, 0x8C, 0x42,
+        0x90, 0x52, 0x88, 0x5B, 0xA2, 0xE8, 0x98, 0x18, 0x3C, 0xAE, 0x2A, 0xBA,
+        0xC8, 0x38, 0x8E, 0xE8, 0x6C, 0x94, 0x58, 0x86, 0xCB, 0x86, 0xE8, 0x6C,
+        0xA8, 0x80, 0xE4, 0x40, 0x64, 0x17, 0x39, 0x38, 0xDC, 0xE6, 0x55, 0x47,
+        0xBC, 0x69, 0x6C, 0xD4, 0x44, 0xDA, 0xC8, 0x54, 0x71, 0x02, 0xC0, 0x66,
+        0xE2, 0x7B, 0xFC, 0x4B, 0xD5, 0x96, 0xAC, 0xE9, 0xBE, 0xD1, 0xE1, 0x7C,
+        0x5B, 0x66, 0x28, 0x3A, 0xC9, 0xE6, 0x03, 0x01, 0x3F, 0x29, 0x1A, 0x64,
+        0xAF, 0x21, 0x08, 0xCB, 0xCB, 0xB6, 0xD5, 0x8B, 0xC5, 0xA2, 0x0D, 0x51,
+        0xB5, 0x42, 0x24, 0x8B, 0x28, 0x49, 0xAD, 0x3C, 0xD1, 0x44, 0x09, 0x7C,
+        0x08, 0x89, 0x5B, 0xBD, 0xAC, 0x48, 0x08, 0x7C, 0x40, 0x06, 0xC8, 0x6D,
+        0x34, 0xCA, 0x02, 0x28, 0xE5, 0xCF, 0xEB, 0x35, 0x95, 0xE5, 0xA8, 0xE5,
+        0x60, 0xFD, 0x1C, 0xEC, 0x99, 0xE8, 0x0E, 0xAF, 0xD0, 0x10, 0x40, 0x89,
+        0x1B, 0x89, 0x0B, 0xF5, 0x6D, 0xA5, 0x84, 0x42, 0x54, 0x63, 0x18, 0x30,
+        0xD7, 0x95, 0xF5, 0x20, 0xD4, 0xFB, 0xE7, 0x7F, 0xDD, 0x65, 0x94, 0x03,
+        0xFB, 0x31, 0x53, 0x43, 0xC3, 0xC1, 0x7C, 0xF6, 0xD5, 0xED, 0xE3, 0xA0,
+        0xF2, 0x60, 0xF5, 0x4D, 0xDF, 0xC8, 0x83, 0x76, 0x87, 0xD0, 0x4E, 0x25,
+        0x71, 0x8B, 0xE2, 0xFF, 0x6C, 0xB0, 0x55, 0xB3, 0xA0, 0x3A, 0x98, 0xF7,
+        0xDE, 0x33, 0xEF, 0xDC, 0x29, 0xFD, 0x41, 0xF6, 0x29, 0xB9, 0xB4, 0xB5,
+        0x8B, 0xF3, 0xBB, 0x6B, 0xBF, 0x0A, 0x21, 0xAD, 0x92, 0xD1, 0x1F, 0x8C,
+        0xBB, 0x81, 0x7E, 0xBE, 0x8B, 0xE0, 0x08, 0xAB, 0x87, 0x11, 0xDA, 0x18,
+        0x7F, 0xDD, 0x49, 0xB6, 0x6E, 0x9E, 0xF9, 0x76, 0x6B, 0xFB, 0x36, 0xB5,
+        0x3B, 0xC0, 0x10, 0x31, 0x91, 0x56, 0xE3, 0xE4, 0xCA, 0x13, 0x29, 0x54,
+        0x72, 0x9E, 0x3E, 0x96, 0xFA, 0xCA, 0xB6, 0x91, 0xE8, 0xB8, 0x37, 0x17,
+        0x5B, 0x63, 0x6D, 0x10, 0x3C, 0xBE, 0xA5, 0xB6, 0x01, 0xCE, 0x17, 0x80,
+        0xE1, 0x74, 0xF6, 0x61, 0xB2, 0x3C, 0xA0, 0x6B, 0x65, 0xE1, 0x7A, 0x22,
+        0x6E, 0xD1, 0xE9, 0xDB, 0xF0, 0xC1, 0x6F, 0xD6, 0x9C, 0x71, 0x88, 0x10,
+        0x2E, 0x68, 0x59, 0xB3, 0x32, 0xD9, 0x0C, 0xAA, 0x6C, 0x04, 0x81, 0x6F,
+        0x57, 0x51, 0xFA, 0x2A, 0x29, 0xEE, 0xBE, 0x17, 0xE5, 0x3A, 0xD8, 0x37,
+        0x3B, 0x11, 0x8E, 0xC4, 0x3B, 0x99, 0x6F, 0x38, 0xD8, 0xE7, 0x64, 0x79,
+        0x52, 0xAD, 0xA0, 0x00, 0x6E, 0xC6, 0xF0, 0x3A, 0x94, 0xD6, 0x8D, 0x21,
+        0x65, 0x80, 0x71, 0x33, 0xE4, 0xA4, 0x65, 0x56, 0xA6, 0xA3, 0xE1, 0xA4,
+        0x80, 0x33, 0xE7, 0xEE, 0x4E, 0xB0, 0x2A, 0x4B, 0xE4, 0x67, 0xF2, 0xFE,
+        0x5D, 0x70, 0x9E, 0x3C, 0x2C, 0xF9, 0x41, 0xBC, 0x7E, 0x15, 0x6B, 0x44,
+        0x3E, 0x56, 0xDF, 0x60, 0x59, 0xAE, 0x1D, 0xCE, 0xCC, 0x89, 0x96, 0x90,
+        0x7D, 0x5F, 0x54, 0x2F, 0xE7, 0x59, 0xF3, 0x14, 0x58, 0xCE, 0x32, 0x9F,
+        0xAC, 0x6F, 0xA5, 0x95, 0x1B, 0x19, 0xF8, 0x29, 0x85, 0x4D, 0x40, 0x73,
+        0xF6, 0xA9, 0x7D, 0x20, 0xCD, 0x76, 0x52, 0xC3, 0x27, 0x6D, 0xC5, 0x10,
+        0xD6, 0x5F, 0x7D, 0x6F, 0x55, 0x32, 0xCA, 0xE1, 0x58, 0xAC, 0xEB, 0x1A,
+        0xE0, 0x69, 0x6D, 0xE4, 0x2C, 0x5B, 0xE2, 0x23, 0x74, 0x7A, 0x0C, 0xDF,
+        0x64, 0x8F, 0xF3, 0xB6, 0xE5, 0xEE, 0x81, 0xC7, 0xF0, 0xEC, 0x3A, 0x48,
+        0x1A, 0x09, 0xB3, 0x94, 0xB3, 0xE9, 0xA5, 0xEE, 0x86, 0x24, 0x40, 0xE3,
+        0x0A, 0x6A, 0x2D, 0x42, 0xE2, 0x9E, 0x9D, 0xA5, 0x9C, 0x76, 0xF7, 0x7B,
+        0x76, 0x29, 0x9F, 0xA4, 0x1B, 0xB9, 0xDD, 0x9C, 0x75, 0x83, 0x8A, 0x0F,
+        0xAD, 0x62, 0x11, 0xD8, 0xD8, 0x03, 0x1B, 0xAD, 0xD5, 0xF1, 0x09, 0x7F,
+        0x94, 0xF7, 0xE9, 0x1E, 0x8C, 0x9B, 0x32, 0xD9, 0x07, 0x6D, 0xF4, 0x62,
+        0x3C, 0x38, 0x55, 0x9D, 0x5E, 0xD9, 0xE3, 0x3A, 0xC3, 0x81, 0xCD, 0x9A,
+        0xA5, 0xCC, 0x0A, 0x81, 0xFF, 0x76, 0x4D, 0x9A, 0x95, 0x3B, 0xD8, 0x9E,
+        0x87, 0x2D, 0x8F, 0xA6, 0xB8, 0x0C, 0x40, 0xF6, 0x92, 0x7E, 0x57, 0x06,
+        0x94, 0xA1, 0x11, 0x36, 0xA7, 0xFB, 0x32, 0x60, 0xB6, 0x8B, 0x2F, 0x28,
+        0xBB, 0x5D, 0xF2, 0x90, 0xA2, 0x73, 0x81, 0x03, 0x9F, 0x26, 0xA5, 0x1A,
+        0x20, 0xB1, 0x96, 0x60, 0xC9, 0x92, 0xCC, 0xE3, 0x7A, 0xEC, 0x1A, 0x12,
+        0x2C, 0xBD, 0x77, 0x03, 0xEA, 0x50, 0x65, 0xDA, 0xD4, 0xF8, 0x9F, 0x56,
+        0xC0, 0x47, 0x61, 0x45, 0xF4, 0x9A, 0x4B, 0x7E, 0x62, 0xC5, 0x71, 0xCD,
+        0x0F, 0xC0, 0x3A, 0xF1, 0x0E, 0x13, 0xE3, 0x7B, 0x75, 0xA7, 0x12, 0x62,
+        0x4D, 0x69, 0x0D, 0x3F, 0xCC, 0x7D, 0x28, 0x38, 0xCE, 0x44, 0xE1, 0xB0,
+        0xC9, 0xE8, 0x38, 0xC6, 0x05, 0xC2, 0x91, 0x21, 0x16, 0x06, 0x5E, 0x1B,
+        0x1D, 0x1A, 0x81, 0x73, 0x73, 0xC5, 0x4C, 0xD5, 0x95, 0x2D, 0x0D, 0x04,
+        0x7E, 0x55, 0xF2, 0x5C, 0xEF, 0x48, 0x83, 0xDB, 0x32, 0xE8, 0x9D, 0x95,
+        0x59, 0xCB, 0x47, 0xFC, 0xD9, 0xA6, 0x13, 0x38, 0xC6, 0x47, 0x2F, 0x5E,
+        0x91, 0x05, 0x24, 0x32, 0xD2, 0x2D, 0x73, 0xBD, 0xD7, 0xA7, 0x4C, 0x25,
+        0x64, 0x86, 0xC9, 0x3A, 0x05, 0x56, 0x86, 0x13, 0xC8, 0x2E, 0x98, 0xBB,
+        0x93, 0xA5, 0x5A, 0x2D, 0xC6, 0x87, 0xA1, 0xBD, 0x31, 0xD0, 0x97, 0x1D,
+        0xAA, 0xD4, 0x2A, 0xC3, 0xC3, 0xA6, 0x01, 0x8B, 0x38, 0xD1, 0x30, 0xB0,
+        0xD3, 0x27, 0x2F, 0xDA, 0xDB, 0xE1, 0x2A, 0x8A, 0xD0, 0x13, 0x0C, 0x5E,
+        0x67, 0x92, 0x9A, 0x32, 0xC4, 0x5D, 0x05, 0x8B, 0x9E, 0xF9, 0xAD, 0x31,
+        0x91, 0x4D, 0x41, 0xBC, 0xE0, 0xA2, 0x04, 0x0A, 0xC3, 0xCB, 0x1B, 0x4B,
+        0xA0, 0xA5, 0xA4, 0x48, 0x7C, 0xDA, 0x70, 0xCA, 0x8E, 0x6B, 0x62, 0x2A,
+        0xA1, 0xA1, 0x88, 0x82, 0x5E, 0xAF, 0xF4, 0x87, 0x8F, 0x95, 0x5B, 0x95,
+        0xAA, 0xD7, 0x03, 0xD7, 0x06, 0xAD, 0x6D, 0xD8, 0x6C, 0x83, 0x0D, 0x44,
+        0x3C, 0x44, 0x6E, 0x0A, 0xCF, 0x17, 0x74, 0xD5, 0xAB, 0xE1, 0x82, 0x09,
+        0x50, 0x62, 0xE1, 0xA1, 0xF9, 0xBA, 0x9C, 0x04, 0xC8, 0xC9, 0xA8, 0xB0,
+        0x7C, 0xC8, 0x57, 0x27, 0xA1, 0xCC, 0xD1, 0x3F, 0xAD, 0xAA, 0x03, 0x2E,
+        0xB6, 0x5E, 0x37, 0x2E, 0x49, 0xF5, 0x79, 0xAF, 0xBC, 0x42, 0xAE, 0x12,
+        0x5F, 0xFE, 0x56, 0xE8, 0x86, 0xDE, 0xC9, 0x5F, 0x87, 0x8C, 0xDD, 0x54,
+        0xF0, 0x17, 0xFC, 0xF3, 0x9D, 0x95, 0x87, 0xCA, 0xA9, 0x26, 0x3B, 0x8E,
+        0x6C, 0x8D, 0xD7, 0x17, 0xFD, 0xFE, 0xCE, 0x0C, 0x0B, 0xE2, 0xDB, 0x35,
+        0x5E, 0xE4, 0x1B, 0xF6, 0xDD, 0x5D, 0xFC, 0x54, 0x57, 0x38, 0x23, 0xCC,
+        0xEB, 0xF9, 0x59, 0x5F, 0xDB, 0xC9, 0x35, 0xBB, 0x7B, 0x1E, 0x11, 0x34,
+        0x72, 0xA8, 0xF0, 0xFD, 0xAD, 0x39, 0x19, 0x77, 0xB0, 0xE2, 0xED, 0xF7,
+        0x5F, 0x59, 0xA5, 0x96, 0x34, 0xD3, 0x7D, 0x69, 0xA4, 0x64, 0xE2, 0xD9,
+        0xA6, 0x53, 0xA3, 0xAD, 0xAD, 0x6F, 0xDC, 0xCE, 0x36, 0x06, 0x1F, 0x73,
+        0x92, 0xDE, 0x36, 0x12, 0x99, 0xCD, 0x52, 0xCD, 0x8F, 0x58, 0xB3, 0x8A,
+        0x21, 0xEB, 0x8E, 0x49, 0xEB, 0xD6, 0x3D, 0xCD, 0x05, 0x55, 0xFF, 0x21,
+        0x96, 0x74, 0xC3, 0xEF, 0xEA, 0xED, 0xD4, 0x15, 0xF3, 0x04, 0x95, 0x26,
+        0x5F, 0xF5, 0x93, 0x5D, 0xC5, 0x37, 0xED, 0x9B, 0x76, 0x7C, 0xAC, 0xCA,
+        0x02, 0x10, 0xB3, 0x27, 0xD6, 0x44, 0x21, 0xFE, 0x0B, 0xBE, 0x96, 0x50,
+        0x2B, 0x68, 0xEF, 0xE6, 0x06, 0x89, 0x0C, 0x91, 0x29, 0xD1, 0xA9, 0x26,
+        0xC1, 0x51, 0x76, 0xCE, 0xC9, 0x95, 0xF7, 0xE0, 0x8C, 0x0B, 0x7F, 0xF0,
+        0x8E, 0x8B, 0x50, 0xDD, 0xF8, 0xF3, 0xD2, 0x4F, 0x26, 0xF2, 0x14, 0x79,
+        0xEC, 0x21, 0xFA, 0x1B, 0x2F, 0x5D, 0xE3, 0xAB, 0x17, 0x0C, 0x07, 0x94,
+        0xE9, 0x5F, 0x2A, 0xCA, 0x23, 0xB6, 0xC0, 0xD7, 0x85, 0xE9, 0xE1, 0xD2,
+        0x60, 0xA7, 0xD0, 0x28, 0xB0, 0xA6, 0x78, 0xCC, 0x80, 0xDC, 0xA5, 0x0F,
+        0xE2, 0xE0, 0xE3, 0x8E, 0x25, 0xF5, 0xD7, 0xC8, 0x43, 0xA5, 0x03, 0xCC,
+        0xFE, 0x44, 0x6A, 0x86, 0xBD, 0x3F, 0x5B, 0x93, 0x35, 0x28, 0xAE, 0x02,
+        0x48, 0xE6, 0xD5, 0x1A, 0x6E, 0x67, 0xA2, 0x8E, 0xE2, 0x60, 0x66, 0xA7,
+        0x6B, 0x0A, 0x41, 0xEF, 0xF0, 0xB0, 0xB5, 0xB8, 0x15, 0x80, 0x54, 0xFE,
+        0xC7, 0x8E, 0x44, 0x2A, 0xED, 0xAA, 0x69, 0x64, 0xD0, 0x8C, 0x0C, 0x6F,
+        0x51, 0xBE, 0xA4, 0xA4, 0x60, 0x9D, 0xD3, 0xB4, 0x3F, 0x66, 0xB6, 0x2D,
+        0xCF, 0xF5, 0xB8, 0x14, 0xAA, 0xBC, 0xA7, 0x09, 0xF3, 0xB4, 0xA6, 0xB6,
+        0x8D, 0x33, 0x49, 0x65, 0xA7, 0x9E, 0xAB, 0x13, 0xA2, 0xA0, 0xFF, 0xA1,
+        0xB9, 0x15, 0x66, 0xC3, 0xFA, 0xE6, 0x2E, 0xE3, 0x5A, 0x60, 0x83, 0x8D,
+        0x25, 0x85, 0xC9, 0x06, 0x90, 0xD9, 0xAF, 0x15, 0xBD, 0x4D, 0x2E, 0xA8,
+        0x77, 0xAC, 0xC1, 0xC4, 0x27, 0xEE, 0xF4, 0xD9, 0x30, 0x08, 0x0F, 0x1C,
+        0xD4, 0xBB, 0xAC, 0x55, 0x82, 0xFB, 0x32, 0x06, 0x22, 0x22, 0x69, 0x25,
+        0xB9, 0xB6, 0xA2, 0x6A, 0xB0, 0xE5, 0x88, 0x82, 0xB7, 0xBB, 0x5C, 0x29,
+        0x06, 0x20, 0x0E, 0x9C, 0xCE, 0xA9, 0x06, 0xA6, 0x8E, 0x37, 0x39, 0x88,
+        0xD3, 0xCA, 0xCD, 0x2B, 0x47, 0xAE, 0x44, 0xE0, 0x9D, 0x12, 0x4C, 0xE3,
+        0xC6, 0xEC, 0xFB, 0x68, 0xC4, 0x86, 0x41, 0xBD, 0xE1, 0xC8, 0xB2, 0x6F,
+        0xB8, 0xF7, 0x00, 0xF8, 0x49, 0x33, 0x15, 0xFF, 0xBD, 0x8B, 0x64, 0xB4,
+        0x6D, 0xCC, 0x60, 0x38, 0x95, 0xE5, 0x20, 0x78, 0xB1, 0x65, 0x29, 0x7D,
+        0x18, 0x34, 0xD7, 0xA0, 0x8D, 0xD3, 0xE4, 0xCB, 0xAD, 0x45, 0xC2, 0x05,
+        0xF6, 0xB0, 0x9C, 0x5C, 0xA0, 0x97, 0xA9, 0xF3, 0x42, 0xFB, 0x78, 0x82,
+        0x01, 0xFF, 0x84, 0xF3, 0x2C, 0x46, 0x5B, 0xCB, 0x40, 0xF5, 0x45, 0x89,
+        0xF6, 0xBF, 0xEE, 0x39, 0x95, 0x29, 0x44, 0x52, 0x9D, 0x38, 0x01, 0x93,
+        0x38, 0xE9, 0xE9, 0x3E, 0xFF, 0x77, 0x17, 0xD3, 0xB5, 0x5F, 0x24, 0xEA,
+        0xB8, 0x53, 0x1F, 0x8E, 0x7A, 0x36, 0xF6, 0x4A, 0x88, 0xDB, 0xF8, 0x55,
+        0x63, 0x77, 0x20, 0xFC, 0x8D, 0x7C, 0x3A, 0x3D, 0x08, 0x27, 0x5B, 0xD8,
+        0xF8, 0x19, 0x68, 0x8D, 0x2C, 0xC3, 0x01, 0x40, 0x12, 0xEC, 0x7C, 0xC1,
+        0x83, 0xE9, 0x4B, 0x9B, 0x12, 0xDE, 0x0D, 0x9B, 0xAC, 0x6D, 0xE0, 0x51,
+        0x71, 0x7B, 0x60, 0xA0, 0x0D, 0x73, 0x60, 0xBF, 0x7A, 0xEE, 0x89, 0x55,
+        0xEF, 0x1F, 0xE0, 0xE5, 0xDA, 0x06, 0x9B, 0xF7, 0x0E, 0xBA, 0x79, 0xFF,
+        0x3F, 0x4F, 0xF3, 0x54, 0x1B, 0xBF, 0x67, 0xBE, 0xBD, 0xD0, 0x48, 0xAF,
+        0x81, 0xAB, 0xAE, 0xD8, 0x96, 0xE8, 0x47, 0x73, 0xE9, 0x2B, 0xA7, 0x94,
+        0xD5, 0xC6, 0xFF, 0xBE, 0xF2, 0x6B, 0x4C, 0x24, 0x6B, 0x33, 0x47, 0xE6,
+        0x10, 0x4E, 0x96, 0xED, 0x25, 0x7F, 0xE3, 0x0C, 0x10, 0x40, 0xF9, 0xC1,
+        0x4A, 0xFD, 0xD4, 0x6B, 0x0B, 0xAB, 0x93, 0x2D, 0xFA, 0x1E, 0x37, 0xAB,
+        0x4A, 0x9D, 0xB1, 0xC6, 0x73, 0x63, 0x1E, 0xDE, 0xCD, 0x81, 0x2F, 0xEE,
+        0x8B, 0xA5, 0x64, 0x90, 0x97, 0x97, 0xAA, 0x83, 0xC9, 0xC6, 0x78, 0xBC,
+        0x6C, 0xC9, 0xEF, 0x02, 0xA7, 0x4F, 0xD5, 0x3E, 0x2F, 0x97, 0xA6, 0x95,
+        0xF9, 0x31, 0xE4, 0x3E, 0xC8, 0x48, 0x38, 0xE9, 0xF9, 0x08, 0x48, 0x44,
+        0xB8, 0x30, 0xB0, 0x5D, 0xF0, 0x30, 0x81, 0x57, 0xFB, 0x34, 0xC1, 0x34,
+        0x56, 0x30, 0x2C, 0x57, 0x88, 0xA3, 0xA9, 0xF6, 0xB1, 0x89, 0x66, 0xF0,
+        0x21, 0x5B, 0x18, 0xF1, 0xF6, 0x9C, 0xC6, 0xDC, 0x16, 0x0A, 0xC7, 0x81,
+        0x8F, 0x47, 0xC7, 0xFE, 0x7E, 0x0C, 0xC7, 0xB6, 0x42, 0xEE, 0x0D, 0xBF,
+        0xFD, 0x48, 0xC9, 0x3D, 0xA1, 0x2B, 0xF0, 0xBC, 0x7B, 0x9B, 0x2D, 0xEA,
+        0x5C, 0x10, 0xE5, 0x22, 0x37, 0x05, 0x71, 0x7C, 0x8A, 0x58, 0x41, 0x95,
+        0x8F, 0x74, 0x11, 0x33, 0x72, 0xD9, 0xE6, 0x29, 0x69, 0xDB, 0x63, 0xED,
+        0xB0, 0xD8, 0x76, 0xE7, 0x7E, 0x2E, 0x3B, 0x36, 0xF6, 0x89, 0xED, 0x39,
+        0xC8, 0x68, 0xAE, 0x03, 0x5A, 0xB7, 0x8C, 0x86, 0x7C, 0x76, 0x6C, 0x6C,
+        0xF6, 0x28, 0x6A, 0xBC, 0x2C, 0xC6, 0x3B, 0xAE, 0x99, 0x00, 0xAB, 0xF8,
+        0x60, 0x68, 0xB0, 0x88, 0xC7, 0x08, 0x08, 0x21, 0xA2, 0xED, 0xD7, 0x23,
+        0xEF, 0xBA, 0xC6, 0xAA, 0x83, 0xE7, 0x68, 0xD2, 0x4C, 0x57, 0x89, 0x58,
+        0x12, 0xB5, 0x40, 0xE4, 0x0F, 0x38, 0xD0, 0xCF, 0x0B, 0xA8, 0xEA, 0x77,
+        0x8B, 0x0B, 0x9E, 0xAB, 0x22, 0x85, 0x6E, 0x14, 0x5B, 0x2B, 0x84, 0x9D,
+        0x1E, 0x27, 0x6C, 0x9C, 0x0A, 0xBD, 0x84, 0x07, 0xD3, 0xD2, 0xA0, 0x21,
+        0x12, 0x31, 0x62, 0x38, 0x55, 0x8C, 0x0C, 0xEB, 0x77, 0xDD, 0x71, 0xA6,
+        0xC3, 0x6B, 0x11, 0xF8, 0x2D, 0xD3, 0x1D, 0xD2, 0xB1, 0xBC, 0xF3, 0x87,
+        0x51, 0x04, 0x78, 0xEB, 0x03, 0xD0, 0x1F, 0x5D, 0xB1, 0x0C, 0x28, 0x18,
+        0x77, 0x95, 0x53, 0x82, 0x99, 0xEF, 0x57, 0x36, 0x20, 0x8F, 0xC0, 0xD0,
+        0x97, 0xEE, 0x50, 0x32, 0x67, 0xAA, 0xBF, 0x07, 0xF7, 0x0E, 0xA9, 0xED,
+        0x49, 0xA9, 0xF8, 0x35, 0x9D, 0x3C, 0xBA, 0x77, 0xC5, 0x71, 0x31, 0x7E,
+        0xB5, 0x6B, 0x93, 0x01, 0xD0, 0x9B, 0x62, 0x33, 0xA6, 0x80, 0x72, 0xF1,
+        0x4E, 0x7E, 0x5F, 0xC1, 0x23, 0x6B, 0xFE, 0x5D, 0x89, 0xEF, 0x57, 0x0B,
+        0x6E, 0xD3, 0x5E, 0x32, 0x10, 0x7B, 0xFB, 0xB0, 0x8B, 0x8D, 0xEE, 0xE6,
+        0x4B, 0x8D, 0xA2, 0xD0, 0x86, 0x00, 0xD4, 0x79, 0xC1, 0x9E, 0x7B, 0x7D,
+        0x8F, 0x81, 0xF5, 0x9E, 0xDD, 0x99, 0x98, 0x3E, 0x1A, 0x92, 0xF5, 0x0D,
+        0x56, 0x2F, 0xE0, 0x93, 0xF9, 0xE8, 0x7F, 0x0F, 0xFB, 0x46, 0xA6, 0x3F,
+        0x8F, 0x3E, 0x6B, 0xF7, 0x0D, 0x1E, 0xF4, 0x75, 0x01, 0x43, 0xCF, 0x26,
+        0xA3, 0x27, 0xF0, 0xC0, 0x6F, 0xD6, 0x0D, 0x2F, 0x79, 0x0D, 0x12, 0x79,
+        0xE5, 0x2D, 0x79, 0x76, 0x0D, 0x90, 0xA2, 0x1D, 0x42, 0x9A, 0x26, 0x88,
+        0x6D, 0x61, 0x72, 0xCE, 0xE9, 0xD9, 0x51, 0x74, 0x4B, 0x60, 0x62, 0xCB,
+        0x83, 0xBA, 0xA1, 0x3D, 0xD3, 0x5C, 0xE0, 0x98, 0x38, 0xFD, 0x76, 0x18,
+        0x6A, 0xA2, 0x6C, 0x39, 0xCD, 0x92, 0x60, 0x08, 0x1C, 0xA7, 0xDF, 0x93,
+        0x40, 0x0A, 0xD7, 0x0F, 0xBF, 0x37, 0xA8, 0xF2, 0xFD, 0x03, 0x4C, 0x6E,
+        0x9F, 0xA5, 0x7C, 0x70, 0x93, 0x7E, 0x88, 0x9F, 0x1F, 0xE9, 0xA5, 0xD2,
+        0x4B, 0xED, 0x3A, 0x14, 0x64, 0xD1, 0xD2, 0xFA, 0xF6, 0x79, 0x22, 0xB6,
+        0x86, 0xF6, 0xF9, 0xE5, 0x2F, 0x2B, 0xAA, 0xE7, 0xA2, 0x73, 0x7A, 0x22,
+        0xD3, 0x21, 0xA3, 0xF2, 0x41, 0x80, 0x72, 0x40, 0x8A, 0x82, 0xA0, 0x34,
+        0xCB, 0xBA, 0x17, 0xFF, 0xE8, 0xE2, 0x66, 0x43, 0x6F, 0x6B, 0x94, 0xD9,
+        0x74, 0xB3, 0x8C, 0xEC, 0x10, 0xEC, 0x7E, 0xB9, 0x6E, 0x1B, 0xBC, 0x20,
+        0x37, 0xD5, 0xB7, 0x4E, 0xCA, 0x66, 0x92, 0x6C, 0xC2, 0x3E, 0xA1, 0x48,
+        0xC9, 0xC3, 0x07, 0x01, 0x3A, 0x2A, 0x90, 0x4E, 0xFC, 0x8D, 0x6F, 0x56,
+        0x56, 0x2F, 0x8D, 0x02, 0x09, 0x33, 0xF1, 0x18, 0x24, 0xC1, 0x00, 0x75,
+        0xD0, 0x38, 0xFC, 0x7A, 0xD1, 0x0B, 0xE7, 0x18, 0x1F, 0x6E, 0x02, 0xF1,
+        0x68, 0xB1, 0xCE, 0x06, 0x10, 0xDD, 0x29, 0x84, 0x50, 0x26, 0xC5, 0x90,
+        0x8C, 0xAC, 0x57, 0x5F, 0xA9, 0xC9, 0xDD, 0x22, 0xEF, 0xD8, 0xC7, 0x48,
+        0xAC, 0x63, 0xCC, 0x50, 0x52, 0x55, 0x16, 0x61, 0x03, 0x49, 0xC9, 0xB2,
+        0xFE, 0x3B, 0xEE, 0x65, 0x21, 0x38, 0xB0, 0xE4, 0x24, 0x2F, 0x5B, 0x0A,
+        0xE8, 0x75, 0xED, 0x4A, 0xD6, 0x2E, 0x52, 0x5E, 0x04, 0x02, 0x7C, 0xC0,
+        0xAE, 0x0A, 0xC5, 0xA5, 0x87, 0xF0, 0x0C, 0x97, 0x30, 0x83, 0x9F, 0x92,
+        0x7A, 0xC3, 0xD3, 0x33, 0x72, 0x39, 0x2C, 0x1C, 0x4E, 0xE0, 0xA9, 0xAB,
+        0xB9, 0x22, 0x31, 0xA7, 0x4D, 0xBA, 0x9A, 0x4F, 0xC8, 0x6B, 0xD9, 0x02,
+        0x01, 0xFE, 0x35, 0xFF, 0xB3, 0xD9, 0x44, 0x78, 0xB6, 0x4D, 0xA5, 0xCD,
+        0x26, 0xC4, 0x33, 0xB2, 0x2C, 0x50, 0x23, 0x4C, 0x96, 0xD7, 0x1D, 0x3C,
+        0x26, 0x61, 0xF2, 0xD4, 0x2E, 0x1D, 0x86, 0xA9, 0x69, 0x42, 0x85, 0x3A,
+        0xDD, 0xC6, 0x7D, 0x86, 0x58, 0x31, 0x5B, 0x94, 0xB7, 0x37, 0x09, 0xD3,
+        0x1B, 0xC7, 0x23, 0x50, 0x27, 0x4C, 0x96, 0xB7, 0x43, 0x7E, 0x7B, 0x9B,
+        0x08, 0xBF, 0xFD, 0x1A, 0x7B, 0xD8, 0xE2, 0x62, 0xBE, 0x58, 0x0C, 0x48,
+        0x4B, 0x0C, 0x11, 0x5E, 0x79, 0x49, 0x24, 0xC2, 0x39, 0xD5, 0x80, 0x28,
+        0x92, 0xCA, 0x58, 0x88, 0xE6, 0x8B, 0x87, 0x64, 0x3A, 0x7B, 0x00, 0xE6,
+        0x33, 0x82, 0x2D, 0x97, 0x71, 0x0F, 0xCF, 0xA5, 0x3D, 0xBC, 0xF2, 0x27,
+        0x42, 0x39, 0x95, 0x81, 0x4F, 0xA7, 0x13, 0x87, 0x55, 0xAE, 0xC2, 0xFC,
+        0xBC, 0x90, 0x8C, 0x1E, 0xAF, 0x9F, 0x95, 0x95, 0x0F, 0x95, 0xF1, 0x41,
+        0x75, 0x5E, 0xBA, 0x25, 0x63, 0x62, 0x6E, 0x70, 0x5C, 0x25, 0x33, 0x65,
+        0x7D, 0xC0, 0x30, 0x26, 0x0A, 0x3E, 0x9F, 0xB7, 0xB2, 0x74, 0x1B, 0x7A,
+        0xED, 0xD5, 0xD8, 0xFF, 0xFD, 0x46, 0x6A, 0x09, 0x65, 0x2C, 0x27, 0xE5,
+        0xE8, 0xA8, 0x75, 0xD6, 0xBE, 0x87, 0xFD, 0xE5, 0xDD, 0xCC, 0x35, 0xD6,
+        0x53, 0x26, 0x88, 0x52, 0xDF, 0xD3, 0x2A, 0xB1, 0xF2, 0x8C, 0x3D, 0x0A,
+        0x2A, 0x26, 0xA2, 0x56, 0x47, 0xA9, 0x5F, 0xD9, 0x42, 0x0F, 0xEB, 0xDA,
+        0x0B, 0x76, 0xAD, 0xA4, 0x70, 0x58, 0xC7, 0x5D, 0x64, 0xFE, 0xD0, 0x2F,
+        0xE2, 0x0E, 0xE5, 0x88, 0x69, 0x6E, 0x21, 0xA0, 0x3D, 0x71, 0x72, 0x45,
+        0x28, 0xB1, 0x9B, 0xCA, 0x01, 0x1B, 0x2A, 0x22, 0x09, 0x68, 0x8D, 0x33,
+        0x71, 0xDB, 0xD5, 0x6D, 0x23, 0x25, 0x84, 0xB8, 0x0F, 0x22, 0x83, 0x5D,
+        0x53, 0x01, 0x73, 0xCC, 0x33, 0xE0, 0x1C, 0x89, 0x14, 0x0E, 0x3D, 0x61,
+        0x1F, 0xA6, 0xD3, 0xF1, 0xC8, 0x10, 0x5F, 0xEC, 0xD8, 0x19, 0xBD, 0x23,
+        0x01, 0x41, 0xA5, 0xC0, 0x68, 0x10, 0x3E, 0x7A, 0x54, 0x76, 0x97, 0x6C,
+        0xC6, 0x41, 0x93, 0xAE, 0xD2, 0x20, 0xE6, 0x6C, 0xA4, 0x6B, 0xB9, 0x16,
+        0x6F, 0xF3, 0xB7, 0x4B, 0xAF, 0x3C, 0x56, 0x31, 0x7B, 0x1B, 0xC0, 0xAE,
+        0x48, 0xEB, 0x90, 0xE9, 0x71, 0xD2, 0x5B, 0xC9, 0x82, 0xC5, 0xED, 0xEE,
+        0xA8, 0xB6, 0xC5, 0xF4, 0xB5, 0x29, 0xA1, 0x69, 0x75, 0x3C, 0xB1, 0x7C,
+        0xCD, 0x99, 0xD4, 0xB0, 0x34, 0x66, 0x1B, 0x45, 0xA4, 0x3E, 0xF4, 0x11,
+        0xC8, 0xD7, 0x0D, 0x46, 0x0C, 0xA7, 0xA2, 0xF1, 0xF2, 0x06, 0x95, 0xC8,
+        0xD6, 0x1C, 0xFC, 0x64, 0x8A, 0x51, 0x6D, 0xA6, 0x8D, 0x50, 0xBC, 0x50,
+        0x24, 0x4F, 0x3A, 0x42, 0x60, 0xD9, 0x30, 0x25, 0xFD, 0x35, 0x3C, 0x78,
+        0x04, 0x19, 0x37, 0x42, 0xD1, 0x3F, 0xE2, 0x00, 0x4B, 0x3B, 0x06, 0x10,
+        0x50, 0xE6, 0x1A, 0xE4, 0x5A, 0x4F, 0x6D, 0xD2, 0x67, 0xFB, 0xE2, 0x34,
+        0xE2, 0x86, 0xD0, 0x5A, 0xFF, 0xE1, 0x9F, 0xD3, 0x1F, 0x93, 0x16, 0x9B,
+        0x9D, 0x76, 0x9E, 0x23, 0x78, 0x71, 0xDD, 0xC7, 0x11, 0x46, 0xF7, 0x10,
+        0x17, 0x23, 0xF5, 0x3F, 0x9B, 0xBD, 0x16, 0x00, 0xEE, 0xFC, 0xAB, 0xE1,
+        0x4E, 0xB3, 0x42, 0x11, 0xA2, 0x60, 0x97, 0xFB, 0x2B, 0x36, 0x77, 0x7A,
+        0x09, 0x75, 0x14, 0x4B, 0x8B, 0x9B, 0x77, 0x46, 0x4E, 0xED, 0xCB, 0x3C,
+        0xF8, 0x24, 0x6F, 0xD0, 0x21, 0x72, 0xFE, 0x36, 0xF5, 0xE4, 0xDA, 0xF4,
+        0x9E, 0x26, 0x15, 0x42, 0x39, 0x89, 0x63, 0x72, 0x7A, 0x15, 0x54, 0x8C,
+        0x4E, 0x27, 0x01, 0x34, 0x67, 0xF0, 0xE0, 0x92, 0x7F, 0xC5, 0x3D, 0x76,
+        0x73, 0xCE, 0xBF, 0x83, 0x90, 0xDD, 0xC5, 0x55, 0x85, 0x9D, 0x02, 0x75,
+        0xC3, 0xFA, 0x09, 0xA4, 0x35, 0xD7, 0x0C, 0xD9, 0x34, 0x01, 0xDB, 0xA9,
+        0x4C, 0xA0, 0x16, 0x84, 0x54, 0x4E, 0x90, 0x82, 0xDA, 0x44, 0x1A, 0x8B,
+        0xE2, 0x2C, 0x6A, 0x55, 0x8A, 0x51, 0x2D, 0x02, 0xC8, 0x97, 0x14, 0xC4,
+        0x67, 0x4D, 0x5F, 0xF3, 0x29, 0x74, 0xC9, 0x04, 0x78, 0xA7, 0x1C, 0xA2,
+        0xF2, 0xC6, 0xCA, 0x67, 0xFA, 0x34, 0x2B, 0x85, 0x0B, 0x72, 0x62, 0x5F,
+        0x7A, 0xBF, 0x60, 0x87, 0x7C, 0x50, 0x99, 0xF3, 0xC9, 0x3A, 0x80, 0x03,
+        0x51, 0xA6, 0xC4, 0xEE, 0x6A, 0x5F, 0xA0, 0xFD, 0x28, 0xEA, 0xFE, 0x28,
+        0xFF, 0x06, 0xE5, 0xB2, 0x07, 0x58, 0x5A, 0x31, 0x44, 0x84, 0xE4, 0xE0,
+        0xC5, 0x71, 0xF2, 0xE0, 0x51, 0x44, 0x75, 0xC4, 0xE9, 0xB1, 0xF1, 0xF9,
+        0x4E, 0xDE, 0xF4, 0x3C, 0x6F, 0xE3, 0x99, 0x8D, 0x6D, 0x8A, 0x5A, 0xDD,
+        0xAD, 0x08, 0x9E, 0x61, 0x45, 0xA1, 0xED, 0xEB, 0x72, 0x9F, 0xE2, 0xA2,
+        0x19, 0x34, 0x4C, 0xEE, 0x35, 0xAD, 0xB9, 0x3C, 0x35, 0x01, 0x81, 0xFA,
+        0x98, 0xD9, 0x35, 0xB8, 0x16, 0xA5, 0xE0, 0x91, 0xAA, 0x92, 0xF4, 0xCC,
+        0x92, 0xBE, 0xC5, 0x7D, 0x05, 0xFE, 0x6D, 0xD5, 0x9B, 0x33, 0x0F, 0x88,
+        0x82, 0xB6, 0xBE, 0xA1, 0x75, 0xA6, 0x9E, 0xAF, 0x48, 0x62, 0xA7, 0x29,
+        0x72, 0x3D, 0xE1, 0x67, 0x26, 0xFB, 0x33, 0x40, 0x90, 0x76, 0x9D, 0x26,
+        0x45, 0xAB, 0xB3, 0xB8, 0xB5, 0x87, 0x56, 0x01, 0x1D, 0x90, 0x01, 0xA7,
+        0x00, 0x4D, 0x3F, 0x52, 0x91, 0xF7, 0x39, 0x9A, 0xB8, 0xA8, 0x46, 0xB2,
+        0x67, 0x7E, 0x7A, 0x98, 0xB1, 0x33, 0xC8, 0x4D, 0x5B, 0x51, 0xF2, 0xE6,
+        0x8E, 0xFD, 0xBE, 0xBC, 0xFC, 0xAD, 0x5A, 0x90, 0x08, 0x52, 0x53, 0x6F,
+        0xF6, 0x15, 0xC5, 0x59, 0x6F, 0x24, 0x19, 0xB2, 0x5B, 0xD8, 0xA0, 0x82,
+        0x85, 0xB9, 0x28, 0xD6, 0x00, 0x1F, 0x43, 0xA4, 0xCE, 0x43, 0x0E, 0x8F,
+        0xB0, 0xA7, 0x5E, 0xF0, 0xF8, 0x40, 0x80, 0x0D, 0xDF, 0x67, 0xAD, 0xE6,
+        0x69, 0xF4, 0x10, 0x09, 0xEB, 0xC1, 0x3D, 0x45, 0xD4, 0x8B, 0xC7, 0x18,
+        0x7F, 0x18, 0x79, 0x04, 0xD3, 0x6A, 0xB7, 0x5E, 0xBD, 0x00, 0x6A, 0x84,
+        0x28, 0x5B, 0x1A, 0xFB, 0x11, 0x76, 0x69, 0x12, 0x10, 0x3E, 0xB9, 0x5C,
+        0xDA, 0x99, 0x07, 0x41, 0xB1, 0x33, 0x27, 0xFC, 0xE0, 0x40, 0x54, 0x31,
+        0x64, 0x23, 0x9B, 0xBA, 0x77, 0x27, 0xF3, 0xAD, 0x95, 0x3B, 0x5C, 0xF5,
+        0x23, 0xE1, 0xB6, 0x7B, 0x95, 0x22, 0xA4, 0x03, 0xF6, 0x73, 0xEE, 0xF9,
+        0xFE, 0x22, 0x8B, 0x00, 0x6E, 0xDC, 0x32, 0x56, 0x7A, 0x7A, 0x6C, 0x9A,
+        0x6E, 0x38, 0x45, 0x3F, 0xA6, 0x0B, 0x0D, 0xC6, 0xD8, 0xD5, 0xB9, 0x2B,
+        0x9E, 0x48, 0xAC, 0xC4, 0xD0, 0xFC, 0x37, 0x14, 0x15, 0x30, 0xD0, 0xAA,
+        0x8A, 0x5D, 0x7C, 0xB8, 0x14, 0xF6, 0xBD, 0x66, 0x35, 0x74, 0xE9, 0xCE,
+        0x98, 0x65, 0x05, 0x7C, 0xFD, 0xE2, 0xD0, 0x1D, 0x3F, 0x23, 0xF8, 0x20,
+        0xF4, 0x6C, 0x2F, 0x3F, 0x5F, 0xC9, 0x0E, 0xA5, 0xDD, 0x52, 0x94, 0x59,
+        0x68, 0x99, 0x90, 0x18, 0xD7, 0xC3, 0x58, 0xE6, 0xD8, 0xC9, 0xA0, 0x8D,
+        0x6D, 0x4E, 0xC6, 0xFD, 0xE5, 0x4D, 0x7D, 0x5C, 0xD8, 0xE3, 0x2B, 0xD1,
+        0x8E, 0x54, 0x2F, 0xC4, 0xCF, 0xA6, 0xA2, 0x6A, 0x33, 0x1A, 0xC9, 0x8A,
+        0xA3, 0xCE, 0xE1, 0x89, 0x46, 0xF8, 0xBF, 0xE8, 0x63, 0x99, 0x60, 0xE9,
+        0x08, 0xE2, 0x8C, 0xA5, 0x1B, 0x31, 0xC8, 0x80, 0x7F, 0xA6, 0xE8, 0x7A,
+        0x48, 0x2D, 0xBF, 0x66, 0xDA, 0x76, 0x89, 0x10, 0xF0, 0x01, 0x55, 0x4C,
+        0xE8, 0xE1, 0xED, 0x37, 0xA2, 0x05, 0xCB, 0xE2, 0xE7, 0xB8, 0xFA, 0xB6,
+        0x79, 0x1F, 0x73, 0x87, 0xC9, 0xF3, 0xD2, 0x2C, 0x14, 0xFE, 0x97, 0x37,
+        0xF8, 0x12, 0xCA, 0xB4, 0x4B, 0x26, 0x25, 0xD1, 0x5A, 0x05, 0x3C, 0xEF,
+        0x36, 0x2B, 0x1F, 0xD8, 0xBD, 0x6D, 0x5E, 0x43, 0x5A, 0xBC, 0x10, 0xE1,
+        0xC7, 0xE5, 0x65, 0xB0, 0xF9, 0xE6, 0xE2, 0xCF, 0x29, 0x1C, 0x50, 0xDF,
+        0xE5, 0xD1, 0xD4, 0xB2, 0x6B, 0xA7, 0xE1, 0x7E, 0x88, 0x9A, 0x6B, 0x0B,
+        0x85, 0x6E, 0x0F, 0xC3, 0x4C, 0x7D, 0xFD, 0x38, 0xC4, 0x62, 0xF7, 0xA5,
+        0xAA, 0xFD, 0x0F, 0x75, 0xBC, 0x7B, 0xDC, 0xC5, 0xEF, 0x43, 0x9C, 0x5C,
+        0x6A, 0xD1, 0xF9, 0xCF, 0x21, 0x5E, 0xE3, 0x52, 0xED, 0x05, 0xFF, 0x3B,
+        0xE4, 0x1B, 0x74, 0xCA, 0x1B, 0xD4, 0x76, 0x88, 0xB7, 0x74, 0xFC, 0xF9,
+        0x41, 0x2D, 0x87, 0x78, 0xE7, 0x1A, 0xFD, 0x34, 0x24, 0xFD, 0x8C, 0x13,
+        0x11, 0x26, 0x6B, 0xC6, 0xF5, 0x81, 0xCB, 0xBB, 0xCF, 0x45, 0xFE, 0x65,
+        0x64, 0xDC, 0xBF, 0x03, 0xB8, 0xAB, 0x74, 0x66, 0xD2, 0x35, 0x80, 0x2D,
+        0x5B, 0x71, 0x76, 0x59, 0x46, 0xE6, 0x29, 0x25, 0xD5, 0x8B, 0x9F, 0xCA,
+        0x9D, 0xD9, 0x86, 0x21, 0xF8, 0x27, 0x3E, 0x3C, 0x5A, 0x6F, 0x90, 0x41,
+        0x74, 0xD3, 0x76, 0x11, 0xBE, 0x04, 0x92, 0xC3, 0x6B, 0x85, 0x36, 0x91,
+        0x83, 0x26, 0xA5, 0x7A, 0x61, 0xFC, 0x83, 0xCF, 0x15, 0x67, 0x77, 0x1F,
+        0x1E, 0xCF, 0x67, 0x73, 0x84, 0x1E, 0xFE, 0xFA, 0x33, 0xF8, 0x07, 0x19,
+        0xD1, 0x5F, 0xF3, 0xC4, 0xBF, 0x29, 0xA7, 0x09, 0xC9, 0xF6, 0x57, 0x20,
+        0x79, 0x69, 0x4B, 0x8C, 0x00, 0xDE, 0x93, 0x9A, 0x32, 0x77, 0x5B, 0xF3,
+        0xA1, 0x7E, 0x19, 0xC0, 0xBA, 0x8B, 0x69, 0xF3, 0xFF, 0x4B, 0x93, 0x13,
+        0x78, 0x5F, 0xF8, 0xB0, 0x6E, 0x9E, 0xCC, 0xC2, 0xDF, 0xC2, 0x7D, 0x60,
+        0xA0, 0x2F, 0x8E, 0x63, 0x5B, 0x98, 0x36, 0x4B, 0xB9, 0x9A, 0x32, 0x4D,
+        0x73, 0x8C, 0xDA, 0xC2, 0xBF, 0x7F, 0x21, 0x95, 0x67, 0x92, 0xAF, 0xE9,
+        0x76, 0x3A, 0x5D, 0xD8, 0x79, 0xED, 0x6D, 0xF6, 0x5C, 0x31, 0x77, 0x9E,
+        0x1F, 0xE3, 0x39, 0xA9, 0xDC, 0x9D, 0x49, 0x81, 0xE3, 0x7A, 0x71, 0x8D,
+        0x94, 0xCF, 0x9F, 0x6B, 0xBC, 0xB7, 0x3E, 0x4E, 0x98, 0x3F, 0xEE, 0xE6,
+        0xE6, 0x2D, 0xBA, 0xD1, 0x21, 0x85, 0x9A, 0x8D, 0xD9, 0xF1, 0x5F, 0xF0,
+        0xFA, 0xB6, 0xC7, 0x3A, 0x59, 0x4F, 0x31, 0x72, 0x97, 0x0D, 0x74, 0x16,
+        0x2F, 0x2F, 0xCC, 0x59, 0xD8, 0x5B, 0xFB, 0xA1, 0x34, 0x43, 0xF6, 0xC4,
+        0xB9, 0xE3, 0x86, 0xC5, 0xC9, 0x46, 0x3F, 0xF9, 0xEF, 0x45, 0x93, 0xAC,
+        0xD5, 0x14, 0xCC, 0x48, 0x6E, 0x19, 0xD6, 0x57, 0x0D, 0x40, 0xD2, 0xD5,
+        0x01, 0xD4, 0x86, 0x89, 0x04, 0xBC, 0xE0, 0xC5, 0xCA, 0xAA, 0xF5, 0xFE,
+        0x4F, 0x9A, 0xAF, 0xCE, 0x29, 0xC1, 0xDE, 0x15, 0x0B, 0xA7, 0xD3, 0x57,
+        0x62, 0xA1, 0xD4, 0xA6, 0x1A, 0x6D, 0x44, 0xDE, 0xA9, 0x04, 0xFB, 0xAA,
+        0xD6, 0x68, 0x9C, 0xC4, 0xCB, 0x13, 0x5A, 0x46, 0x3A, 0xE1, 0x78, 0xDB,
+        0xF7, 0x62, 0xC5, 0x07, 0xDD, 0x99, 0xA6, 0x2A, 0x4B, 0xDD, 0x59, 0x51,
+        0x36, 0xF8, 0xF9, 0x34, 0x98, 0xFA, 0x74, 0xAA, 0xCE, 0x4F, 0xAF, 0x42,
+        0x9F, 0x63, 0x6D, 0x13, 0x95, 0x5E, 0x6F, 0xF5, 0x5C, 0x1C, 0x11, 0xBF,
+        0xEA, 0xBD, 0x65, 0x3B, 0x01, 0x18, 0x60, 0xAF, 0x05, 0xF3, 0xB5, 0x3C,
+        0xDE, 0x39, 0x80, 0x51, 0x4F, 0xC2, 0x4E, 0xCA, 0xE0, 0xCF, 0xE7, 0xC1,
+        0x82, 0x55, 0x6B, 0x1E, 0x2A, 0x2C, 0x7E, 0x8A, 0x9A, 0x28, 0x4E, 0xDD,
+        0x12, 0x4E, 0x9C, 0xAD, 0x56, 0x0C, 0xA5, 0x6A, 0x56, 0x05, 0xF4, 0xC8,
+        0x5A, 0x7F, 0x3C, 0xE1, 0x25, 0xF2, 0x55, 0x0B, 0xE9, 0x4A, 0xD8, 0x49,
+        0xAB, 0x01, 0xBC, 0x3A, 0xCF, 0x75, 0x58, 0x2B, 0x46, 0xAC, 0x02, 0xC3,
+        0x73, 0xB9, 0x42, 0xD4, 0xBE, 0x4C, 0x4E, 0x63, 0xFB, 0x66, 0xD1, 0xBD,
+        0xF1, 0x78, 0x22, 0x6D, 0xCA, 0x02, 0x83, 0x8A, 0xE1, 0xDC, 0xD3, 0xF2,
+        0x2F, 0x72, 0x84, 0x4F, 0xD1, 0x67, 0xD4, 0x54, 0x2D, 0x5A, 0x0C, 0x07,
+        0x74, 0x4C, 0x99, 0xB0, 0x04, 0x55, 0xF7, 0x16, 0x9D, 0xFB, 0xC0, 0xBB,
+        0x1D, 0x7E, 0x7E, 0x49, 0xA2, 0x1A, 0xE1, 0x48, 0x77, 0xE6, 0xFC, 0xB5,
+        0xAB, 0x84, 0x35, 0x80, 0x46, 0xBF, 0x2E, 0x69, 0x23, 0x6C, 0xB7, 0xFE,
+        0x16, 0xD1, 0x7D, 0x10, 0x55, 0x9A, 0x91, 0x40, 0xEB, 0x36, 0x3C, 0x23,
+        0x08, 0x2F, 0x24, 0xF0, 0x6F, 0x4C, 0xB6, 0x7D, 0xE9, 0x14, 0xBA, 0x6E,
+        0x72, 0x33, 0xB6, 0x0A, 0x4F, 0x2F, 0xC0, 0xA7, 0x1A, 0xEF, 0x78, 0xA7,
+        0x14, 0xD0, 0x58, 0x17, 0x0D, 0x0F, 0x43, 0x9F, 0x04, 0xA4, 0x9B, 0x88,
+        0x57, 0x11, 0xF0, 0x8E, 0x0B, 0x95, 0x20, 0xB0, 0x73, 0x2D, 0xC7, 0xF0,
+        0xF0, 0x74, 0x61, 0xD3, 0xD7, 0xB9, 0xDF, 0x83, 0x0D, 0xD8, 0x9D, 0x77,
+        0x16, 0xD6, 0xC6, 0x63, 0x73, 0x95, 0x80, 0xD4, 0xDC, 0x22, 0x3A, 0xE9,
+        0x9F, 0x57, 0x47, 0xD8, 0x10, 0x35, 0x8D, 0x34, 0x01, 0x50, 0x58, 0x7D,
+        0x6F, 0x6E, 0x11, 0xBF, 0xD5, 0xE3, 0xEB, 0xF1, 0xE2, 0xF2, 0x72, 0x4A,
+        0x6D, 0xFB, 0xF2, 0xDD, 0x9A, 0x2E, 0x2E, 0xAE, 0x56, 0x8F, 0x4F, 0x2F,
+        0xBC, 0x0E, 0x9B, 0x2A, 0xDA, 0xB2, 0x7A, 0xA6, 0x9E, 0x78, 0xCA, 0x3E,
+        0x03, 0xAA, 0x3B, 0x55, 0x6B, 0x00, 0x8F, 0x43, 0x86, 0x0B, 0x15, 0x78,
+        0x41, 0x73, 0x9A, 0xA1, 0x4D, 0xF6, 0x0C, 0xA7, 0x4A, 0x36, 0x8E, 0x30,
+        0x59, 0x72, 0x10, 0xAD, 0x35, 0x5C, 0x7E, 0x50, 0x1C, 0xA7, 0x7F, 0xF5,
+        0xEC, 0xE4, 0xB3, 0x7B, 0xC9, 0x57, 0x59, 0x64, 0x6C, 0x7C, 0xAA, 0xAE,
+        0x22, 0x65, 0xC2, 0xAE, 0x84, 0x99, 0x5B, 0xF3, 0x86, 0x06, 0xA0, 0x5B,
+        0x31, 0xA6, 0x23, 0x1F, 0xAC, 0x53, 0x65, 0x43, 0x34, 0x74, 0xBF, 0xBF,
+        0xFA, 0xD0, 0xC5, 0x8E, 0x74, 0x56, 0x15, 0x9D, 0x47, 0xFB, 0x4A, 0xBD,
+        0x87, 0xFA, 0xD3, 0xAE, 0xB8, 0x9B, 0x0F, 0x11, 0x80, 0x06, 0xB4, 0xB0,
+        0x9C, 0x37, 0x9C, 0x0D, 0x1B, 0x9A, 0xF6, 0x45, 0xF3, 0x60, 0xDF, 0xFE,
+        0x0A, 0x0D, 0x1E, 0x7B, 0xF7, 0x41, 0xE6, 0xF1, 0x82, 0x9B, 0x9F, 0x1E,
+        0xF6, 0x63, 0x0C, 0x42, 0x09, 0xCF, 0x2B, 0x2D, 0x18, 0xA7, 0x85, 0xA9,
+        0xF4, 0x0E, 0x9B, 0x56, 0x5E, 0xB6, 0x96, 0xBB, 0x02, 0x41, 0x33, 0x4C,
+        0xE9, 0x28, 0x53, 0xE7, 0x25, 0x4A, 0xA2, 0xE3, 0x02, 0xBC, 0x7E, 0x65,
+        0x6D, 0xF8, 0x7B, 0x91, 0x5A, 0x73, 0x5B, 0x52, 0xA6, 0xD1, 0x4A, 0xE2,
+        0xEB, 0x3C, 0x86, 0xEA, 0xA3, 0x06, 0x56, 0x4F, 0xFE, 0xB4, 0x7F, 0xC9,
+        0xE0, 0x78, 0xA4, 0x1E, 0x21, 0x79, 0x72, 0x9E, 0x9C, 0xCA, 0x4C, 0x63,
+        0xEA, 0xE9, 0x2B, 0xE1, 0xE8, 0x48, 0x81, 0xE1, 0x14, 0x51, 0x57, 0xAE,
+        0x21, 0x1E, 0x25, 0x2F, 0xEB, 0xE2, 0xAF, 0x24, 0x34, 0x4B, 0xB1, 0x8C,
+        0x3C, 0xC2, 0x50, 0x8C, 0x99, 0x57, 0x9C, 0xE3, 0xA8, 0xB9, 0x62, 0x9C,
+        0x57, 0xD1, 0xA6, 0xC6, 0xE6, 0x5E, 0xCA, 0xF9, 0x70, 0x95, 0x98, 0x48,
+        0xE5, 0x3C, 0x81, 0x15, 0xA1, 0xED, 0x2F, 0x90, 0xEC, 0x27, 0x0C, 0x40,
+        0x15, 0x95, 0x6C, 0x9C, 0xF5, 0x56, 0xEE, 0x2E, 0xFC, 0xEE, 0xF6, 0xB2,
+        0x81, 0x25, 0x04, 0x7B, 0x91, 0xDF, 0x40, 0xD6, 0x6E, 0x7C, 0x08, 0x71,
+        0x29, 0x4A, 0xF9, 0xF2, 0xF4, 0xD2, 0x33, 0xB8, 0x20, 0x44, 0xAC, 0x62,
+        0x2C, 0xE3, 0x7C, 0x1D, 0x25, 0x67, 0xAE, 0x6B, 0xD5, 0x3B, 0x8E, 0x34,
+        0xD7, 0x91, 0xCA, 0x05, 0x4A, 0x8C, 0x77, 0xC6, 0x51, 0xF7, 0x79, 0xD4,
+        0x6E, 0xBB, 0x97, 0xCA, 0xB9, 0x7E, 0x2D, 0x89, 0xD4, 0x83, 0xC5, 0xD8,
+        0x28, 0x72, 0x4F, 0xAA, 0x44, 0xA0, 0xDA, 0xD7, 0xCB, 0xA4, 0x75, 0x2A,
+        0x22, 0x6F, 0xDD, 0xB2, 0x78, 0xFA, 0x21, 0x75, 0x68, 0xA3, 0xB3, 0xB5,
+        0x25, 0x81, 0x67, 0x29, 0xEB, 0x71, 0x1F, 0x06, 0xD8, 0xEA, 0x2B, 0x98,
+        0x7C, 0x18, 0xC2, 0x32, 0x2D, 0x10, 0xDF, 0x1E, 0x15, 0xDF, 0x2F, 0xA5,
+        0x89, 0x16, 0x6D, 0x2A, 0x68, 0xAF, 0x63, 0x84, 0x9C, 0xED, 0xBB, 0xA0,
+        0x6F, 0x6F, 0x00, 0x76, 0x70, 0x1C, 0x68, 0x2E, 0xB0, 0x19, 0x67, 0xF1,
+        0x20, 0xFC, 0xF0, 0x31, 0x1D, 0x03, 0xE8, 0x7D, 0x16, 0xB4, 0x7D, 0x46,
+        0xE5, 0xAC, 0x6B, 0x3A, 0xD8, 0x63, 0x55, 0xC3, 0x05, 0x64, 0x3A, 0xEF,
+        0x90, 0xBA, 0xE7, 0x07, 0x48, 0x12, 0x1A, 0xFA, 0x2A, 0x81, 0x75, 0x20,
+        0x2D, 0x18, 0x70, 0x18, 0xFF, 0xC8, 0x7E, 0x7D, 0x1F, 0xEB, 0x25, 0xBF,
+        0x58, 0xA0, 0x99, 0xC6, 0xC7, 0x6E, 0x42, 0x23, 0xB9, 0x56, 0x22, 0x58,
+        0x27, 0x96, 0x21, 0xD5, 0x73, 0x88, 0xE4, 0x9A, 0x55, 0x6A, 0xD9, 0xFA,
+        0xA8, 0xF4, 0xB7, 0x20, 0x5B, 0xBC, 0xF8, 0xA4, 0xF9, 0xCB, 0xE1, 0x3F,
+        0x5D, 0x1A, 0x45, 0x43, 0xA2, 0x68, 0xB8, 0x7D, 0x02, 0xA2, 0xC0, 0x68,
+        0xDA, 0x1A, 0xB1, 0x9B, 0x71, 0x6A, 0x2D, 0x5D, 0xCB, 0x05, 0x66, 0x59,
+        0xC7, 0xF2, 0xC9, 0x46, 0x9F, 0xEB, 0x82, 0xF9, 0x59, 0x55, 0x8D, 0x97,
+        0xB0, 0x4C, 0xEF, 0x6A, 0x71, 0x2D, 0xB2, 0x21, 0xE3, 0x62, 0x1D, 0xC6,
+        0xC0, 0x7E, 0xA9, 0x48, 0x3E, 0xF3, 0x92, 0x82, 0xAA, 0xBB, 0x63, 0x77,
+        0xFF, 0x6C, 0xDC, 0x41, 0x16, 0xFD, 0x4C, 0x78, 0xDD, 0x5A, 0x60, 0x14,
+        0x42, 0x83, 0x22, 0x05, 0x93, 0x2F, 0x5F, 0x75, 0xCE, 0x4C, 0x8A, 0x68,
+        0xFB, 0xAC, 0x61, 0xDE, 0xC5, 0xE2, 0x7E, 0x40, 0xD7, 0x65, 0x22, 0x49,
+        0xBC, 0x4F, 0xE5, 0x53, 0x41, 0xE6, 0x3F, 0xAB, 0xD0, 0xB9, 0xB6, 0xE9,
+        0xD8, 0xCD, 0xA6, 0x75, 0x92, 0x1A, 0x0A, 0xD4, 0x02, 0x60, 0xF9, 0x5B,
+        0xD7, 0x0F, 0x16, 0xFF, 0xC2, 0x0F, 0x10, 0xF8, 0x0A, 0x66, 0xC0, 0xD9,
+        0x15, 0x2C, 0x2E, 0x88, 0x8D, 0x5D, 0xE0, 0x1C, 0xE5, 0x6D, 0x25, 0xB0,
+        0xAC, 0xFE, 0xE7, 0x79, 0xCD, 0x75, 0xC0, 0xF0, 0x12, 0x00, 0xBE, 0x45,
+        0xB5, 0xBB, 0xD0, 0x92, 0x1A, 0x43, 0xBF, 0x4F, 0x8B, 0x10, 0x0A, 0x9C,
+        0x22, 0x73, 0xCD, 0x0B, 0x28, 0xA4, 0x92, 0x21, 0xBF, 0xE1, 0x50, 0x04,
+        0xEC, 0xF5, 0x34, 0x22, 0x6F, 0x13, 0x53, 0x57, 0xBE, 0x26, 0xCB, 0x6E,
+        0xFD, 0x36, 0xD0, 0xFC, 0x49, 0xED, 0x7B, 0x89, 0x7D, 0xD5, 0xDB, 0xA0,
+        0x08, 0x39, 0xB7, 0x55, 0x97, 0x84, 0x15, 0x55, 0xF2, 0x7A, 0xB3, 0xD9,
+        0xB9, 0xF5, 0x58, 0x01, 0xE8, 0x68, 0xA7, 0xA9, 0xA1, 0xF5, 0xCE, 0xC2,
+        0xFA, 0xBE, 0xCE, 0xF4, 0x58, 0xC6, 0xE3, 0x42, 0x61, 0xCE, 0xE3, 0x1B,
+        0xFF, 0x72, 0xD8, 0x47, 0xAE, 0x42, 0x74, 0x9F, 0x56, 0xB4, 0xAA, 0x3D,
+        0xFE, 0xA1, 0xC0, 0xB4, 0xE1, 0x57, 0x7E, 0x6B, 0x4C, 0x9C, 0xFB, 0xF8,
+        0x0C, 0xD5, 0x32, 0xA1, 0xBA, 0xAB, 0xBC, 0x45, 0xCC, 0x5E, 0xAA, 0x89,
+        0xAC, 0xB3, 0xAC, 0x8D, 0x34, 0xA0, 0x85, 0x3A, 0x26, 0xD6, 0xF1, 0x85,
+        0x1B, 0x6A, 0x8C, 0xFE, 0xE5, 0x51, 0x54, 0x9C, 0x73, 0x4A, 0x2A, 0xEC,
+        0xA9, 0xA2, 0x27, 0xD2, 0x8F, 0xE7, 0x5D, 0xEA, 0x6B, 0x95, 0xFB, 0x73,
+        0x96, 0x93, 0xC2, 0x82, 0xAD, 0x6D, 0x9B, 0x57, 0x66, 0x8F, 0x99, 0xE6,
+        0xB3, 0x0F, 0x0E, 0xC6, 0x10, 0xFB, 0xDF, 0x48, 0xC8, 0xCD, 0x09, 0x39,
+        0x7F, 0x16, 0x5F, 0xF7, 0x5C, 0x96, 0xC3, 0x3B, 0xF3, 0x9D, 0x78, 0x42,
+        0xEF, 0x97, 0xAC, 0xCA, 0x52, 0xBC, 0xDC, 0x5B, 0x47, 0x06, 0xC0, 0xDD,
+        0x29, 0xCF, 0x02, 0xED, 0xEF, 0xD1, 0x95, 0xD6, 0x42, 0xF6, 0x99, 0x50,
+        0xE4, 0xF3, 0x83, 0x23, 0x38, 0xF9, 0xAF, 0xBB, 0x08, 0x87, 0x42, 0x0B,
+        0x88, 0xD0, 0x9F, 0xE7, 0xD2, 0x1C, 0xD5, 0x89, 0x95, 0x26, 0x4D, 0x89,
+        0xE8, 0xE3, 0xF5, 0x71, 0x2F, 0xBE, 0x26, 0xB8, 0xA7, 0x38, 0xA9, 0xB1,
+        0x6B, 0xC2, 0xE7, 0xBA, 0x93, 0xC8, 0xE2, 0x89, 0x19, 0xF5, 0x23, 0x09,
+        0xA3, 0x8F, 0x84, 0x2F, 0xE1, 0xDB, 0x45, 0x1D, 0xDB, 0x3D, 0xAE, 0xB3,
+        0x5E, 0xAE, 0x57, 0x04, 0x23, 0xBE, 0x8E, 0x06, 0xAA, 0x4C, 0x2E, 0xDE,
+        0x52, 0xFF, 0x3A, 0xD9, 0xD9, 0xF7, 0xAF, 0x68, 0xFD, 0xF6, 0x6C, 0x09,
+        0xE0, 0x79, 0xC0, 0xE6, 0x61, 0xD5, 0x3C, 0x97, 0x12, 0x83, 0xA7, 0x9C,
+        0x4C, 0x46, 0xDF, 0x42, 0xB0, 0x8A, 0x4F, 0xC0, 0x77, 0xED, 0x13, 0xDF,
+        0xBB, 0xD6, 0x31, 0xF0, 0xBD, 0x35, 0x44, 0xFE, 0xEF, 0x12, 0x9C, 0x93,
+        0x40, 0x3A, 0xBD, 0x6D, 0x85, 0xC8, 0xAE, 0x49, 0x40, 0x79, 0x3C, 0x99,
+        0x69, 0xC4, 0x16, 0x82, 0x4D, 0xA8, 0xEB, 0xE3, 0xE2, 0x49, 0x1F, 0x2F,
+        0xA5, 0xEC, 0x8F, 0xA9, 0xB8, 0x69, 0x67, 0x25, 0x39, 0x77, 0x78, 0x93,
+        0xA2, 0x85, 0xB1, 0x28, 0x89, 0x20, 0xF7, 0xF0, 0x63, 0xAB, 0x7E, 0x49,
+        0xA8, 0xC1, 0x68, 0x3A, 0x52, 0x17, 0x4B, 0xC7, 0x8A, 0xD3, 0x29, 0x8A,
+        0xBC, 0xD1, 0x36, 0x09, 0xF0, 0x21, 0xD2, 0x5F, 0x60, 0x29, 0x2A, 0xBB,
+        0x14, 0x5A, 0xF3, 0x39, 0xB4, 0x93, 0x63, 0x11, 0x17, 0x77, 0x22, 0x2B,
+        0xA0, 0x10, 0xE8, 0x20, 0x5E, 0x1E, 0x69, 0x1D, 0xD5, 0x15, 0xB0, 0xD5,
+        0xCE, 0x86, 0xA9, 0xAB, 0xD3, 0x08, 0xA7, 0xF3, 0x2E, 0xB2, 0x3F, 0x01,
+        0x3B, 0x11, 0x4E, 0x54, 0x99, 0xF8, 0xDD, 0x10, 0x07, 0x51, 0xF9, 0x2A,
+        0x45, 0xB6, 0xDC, 0x79, 0xAD, 0x94, 0xE5, 0x9F, 0x77, 0xFE, 0xF6, 0x30,
+        0xEC, 0x34, 0x92, 0x27, 0x8E, 0x12, 0xBD, 0x2C, 0xF9, 0xDB, 0x04, 0x2F,
+        0x7C, 0x66, 0x6F, 0xB1, 0xB8, 0x97, 0x94, 0x0B, 0x29, 0xC4, 0x63, 0x34,
+        0xF4, 0xAE, 0xF7, 0x5C, 0x4C, 0x43, 0x02, 0xD7, 0x12, 0x77, 0xE4, 0x5D,
+        0xF1, 0xAC, 0xCC, 0x39, 0x1E, 0xF2, 0x7A, 0x7F, 0x7B, 0x56, 0x11, 0x59,
+        0x4D, 0x5D, 0xFD, 0x99, 0xE2, 0xE3, 0xFA, 0xF4, 0xE6, 0x96, 0xF5, 0xFF,
+        0xFB, 0xAF, 0xEA, 0xB4, 0x99, 0xE9, 0x52, 0xF3, 0xAA, 0xEF, 0xF6, 0xC9,
+        0xD6, 0x63, 0xED, 0x5B, 0xED, 0x31, 0x63, 0xA5, 0xB6, 0x41, 0x4F, 0x58,
+        0xAA, 0xEE, 0xB7, 0x53, 0x97, 0x60, 0x92, 0x9D, 0x98, 0x3C, 0xCF, 0x3B,
+        0xDC, 0x71, 0x2A, 0x4A, 0x71, 0x2F, 0x92, 0xB5, 0x7C, 0xEF, 0x04, 0xB0,
+        0x6C, 0x32, 0x96, 0xCF, 0xB8, 0xD8, 0xE6, 0x87, 0xEE, 0x7C, 0x87, 0xE9,
+        0x29, 0xB2, 0x7B, 0xF7, 0xD3, 0x7E, 0xF0, 0x2D, 0x68, 0x97, 0xF3, 0x45,
+        0xEF, 0xEC, 0x85, 0xBB, 0x2B, 0x9C, 0xD0, 0xFA, 0x0E, 0x41, 0x08, 0x59,
+        0xB2, 0x90, 0xBB, 0xED, 0x2B, 0x48, 0x02, 0x2D, 0x55, 0x72, 0x74, 0x6F,
+        0xDB, 0xC3, 0x37, 0xBF, 0xDD, 0x15, 0x5E, 0xB6, 0xE3, 0x42, 0x7B, 0xE9,
+        0x68, 0x82, 0x02, 0x49, 0xAA, 0x45, 0x60, 0x9A, 0xC1, 0x1B, 0xAF, 0x02,
+        0xAB, 0xA4, 0x29, 0x80, 0x5B, 0x96, 0xE2, 0x18, 0xBE, 0x58, 0x83, 0xAE,
+        0x20, 0x10, 0x2D, 0x69, 0x70, 0xD1, 0x24, 0x3A, 0x25, 0x42, 0xD6, 0x50,
+        0xEA, 0x3B, 0x50, 0xAE, 0xD3, 0xC4, 0xC0, 0x88, 0xE5, 0xD1, 0x5C, 0xA8,
+        0xCA, 0xFD, 0xE0, 0xCB, 0x8A, 0xA4, 0xB0, 0xFA, 0xB7, 0x3B, 0xDC, 0x1F,
+        0xA1, 0x97, 0x03, 0x81, 0x6C, 0xEE, 0x39, 0x15, 0x42, 0x5B, 0x5B, 0x8E,
+        0xFF, 0xB0, 0x79, 0x1F, 0x49, 0x6A, 0x7F, 0xD8, 0x81, 0xE0, 0x3F, 0x96,
+        0x75, 0xE1, 0xE1, 0x10, 0x20, 0x9A, 0xE8, 0x62, 0x6D, 0x74, 0xC2, 0xEF,
+        0xE4, 0x36, 0xC1, 0x31, 0xB4, 0x77, 0x37, 0xED, 0xF7, 0x22, 0x3B, 0xFA,
+        0x19, 0x77, 0x6D, 0x79, 0xEC, 0x59, 0xD8, 0xDF, 0x91, 0xDC, 0xEE, 0x77,
+        0x27, 0xFA, 0xCE, 0xF5, 0x38, 0x55, 0x5C, 0xAE, 0xAB, 0x9F, 0xFF, 0x56,
+        0x96, 0xFD, 0x6E, 0xD7, 0x8E, 0x8A, 0xE1, 0x38, 0x09, 0xAD, 0x53, 0xA9,
+        0x08, 0x64, 0x40, 0x15, 0x41, 0xEF, 0xCA, 0x90, 0xB8, 0xD2, 0x75, 0xAC,
+        0xFA, 0xBA, 0xDA, 0x01, 0x63, 0x87, 0xE3, 0x6A, 0xE8, 0xFB, 0x80, 0xFD,
+        0xAA, 0xD4, 0x86, 0xEF, 0x45, 0x0D, 0x7D, 0x0D, 0x7E, 0xE7, 0xBB, 0xCD,
+        0x30, 0xC8, 0x16, 0x02, 0x7B, 0x74, 0x1F, 0xA4, 0x08, 0x93, 0xFD, 0xFA,
+        0xF7, 0xC2, 0xED, 0x32, 0xF0, 0xBE, 0x15, 0x19, 0x2B, 0xEF, 0x3F, 0xDF,
+        0x2A, 0x46, 0xF0, 0x22, 0x9A, 0x2D, 0x2F, 0x8D, 0x8B, 0xD6, 0x07, 0xBD,
+        0xFD, 0x18, 0x4B, 0xC2, 0x40, 0xFD, 0x6E, 0x07, 0xFF, 0xDE, 0xA5, 0x64,
+        0x4B, 0xD5, 0x3D, 0xF8, 0x29, 0xDC, 0x73, 0x3F, 0x08, 0x18, 0x05, 0x1B,
+        0xB4, 0xA2, 0xA2, 0x87, 0x33, 0x5D, 0x6F, 0x9E, 0xBC, 0x3B, 0x74, 0xA9,
+        0x27, 0x93, 0xFB, 0xE0, 0x6D, 0xFB, 0x6B, 0x0F, 0x21, 0xF7, 0x59, 0xC3,
+        0xF7, 0x9D, 0x0F, 0x52, 0x83, 0x53, 0x78, 0x0F, 0xB4, 0x77, 0x4D, 0x07,
+        0x2C, 0x5F, 0xCF, 0x08, 0x1F, 0x86, 0x5C, 0xA2, 0x4F, 0xFD, 0x64, 0xCC,
+        0x7E, 0x66, 0x1C, 0x36, 0x9D, 0xF4, 0xC6, 0xF4, 0x49, 0x84, 0xF5, 0x88,
+        0xF7, 0xDB, 0xD7, 0x5C, 0xFA, 0x59, 0xD8, 0xBE, 0x2B, 0xD6, 0x51, 0x34,
+        0x3B, 0xDC, 0x8A, 0x2E, 0xF5, 0x14, 0xE9, 0x68, 0x5E, 0x3A, 0x73, 0x61,
+        0x86, 0x2F, 0xD2, 0xD2, 0x78, 0xB6, 0x82, 0xDA, 0x91, 0x86, 0x04, 0x7D,
+        0x8A, 0xC8, 0x7F, 0xEB, 0x3A, 0xCB, 0x16, 0xE9, 0xB3, 0x47, 0x9E, 0xE0,
+        0x8C, 0x25, 0x45, 0x02, 0xDC, 0x82, 0x3D, 0x45, 0x55, 0x5C, 0x28, 0xEF,
+        0x6C, 0xD9, 0x07, 0xCC, 0x99, 0x31, 0x5D, 0x84, 0x0E, 0xD0, 0x71, 0xA1,
+        0x71, 0xF7, 0xCE, 0x7D, 0xA8, 0xCD, 0x9D, 0xD3, 0xB7, 0x81, 0x5B, 0x72,
+        0x7C, 0x72, 0xDF, 0x8E, 0x5A, 0xB4, 0xA7, 0xD3, 0x82, 0x76, 0x56, 0x2D,
+        0xBE, 0x79, 0xBE, 0x17, 0x2D, 0x9F, 0x43, 0xBA, 0x05, 0x06, 0xA2, 0xA7,
+        0x21, 0xF2, 0x15, 0x13, 0x98, 0x77, 0xFC, 0x9A, 0xF6, 0x9E, 0x73, 0x9B,
+        0xD6, 0x59, 0xD6, 0x0F, 0x38, 0xFE, 0xF2, 0xFA, 0xD0, 0x07, 0x61, 0xA5,
+        0x7C, 0x31, 0xD1, 0x3D, 0x1D, 0xDE, 0x9E, 0x0A, 0xAE, 0xB8, 0x93, 0x62,
+        0x9E, 0x7D, 0x0F, 0x8B, 0x70, 0xE9, 0xFF, 0x1C, 0x57, 0x63, 0xEA, 0x3F,
+        0x7C, 0x5C, 0xFD, 0x57, 0x75, 0xAB, 0xF3, 0xB6, 0x64, 0xAA, 0x57, 0xF2,
+        0x3D, 0x50, 0x0D, 0x16, 0xE5, 0x94, 0xA6, 0x20, 0xF7, 0x59, 0xD3, 0xCC,
+        0x2F, 0x7C, 0x86, 0xBA, 0x9B, 0x9B, 0x66, 0x4C, 0x63, 0xA0, 0x33, 0xF4,
+        0xED, 0x85, 0x0E, 0x41, 0x5F, 0x23, 0x1E, 0x73, 0xD8, 0xF0, 0x05, 0x2A,
+        0x93, 0xC6, 0xBE, 0x50, 0xBE, 0x26, 0xF1, 0xE3, 0x9A, 0xF3, 0xBC, 0x63,
+        0x82, 0x0C, 0xDA, 0x3F, 0xA3, 0x4E, 0xCF, 0x2F, 0x3F, 0xF5, 0xF9, 0xD5,
+        0xE2, 0x19, 0xE5, 0xC5, 0xE7, 0xAA, 0x0B, 0xC4, 0xF6, 0x62, 0xB4, 0x1C,
+        0xCF, 0x18, 0x32, 0xF6, 0xE7, 0xC2, 0xB6, 0x63, 0xB7, 0x4F, 0x8C, 0x23,
+        0x6E, 0x3D, 0x2E, 0x16, 0xAA, 0xB6, 0xD0, 0xBE, 0x7B, 0x34, 0x1E, 0x57,
+        0x9F, 0x6F, 0xD8, 0x2F, 0x1D, 0x31, 0x8E, 0xB8, 0xF5, 0x18, 0xDD, 0xF5,
+        0x9E, 0xFD, 0x5D, 0xFB, 0x47, 0x6C, 0xFF, 0xDA, 0x39, 0x3F, 0xFA, 0x34,
+        0x43, 0x8F, 0x7F, 0x8E, 0x8F, 0xAB, 0xAF, 0xB6, 0x71, 0xF5, 0xB2, 0xE1,
+        0x4D, 0x68, 0xE5, 0x9D, 0xF6, 0xFD, 0x47, 0xE5, 0xC7, 0x65, 0xBD, 0x3B,
+        0xCF, 0x89, 0x34, 0x8A, 0x59, 0xD5, 0xBF, 0xBD, 0x65, 0xB8, 0x0A, 0x8F,
+        0xCC, 0xC7, 0xBA, 0xCD, 0x1F, 0x6B, 0x8F, 0x58, 0x87, 0x89, 0x18, 0xFD,
+        0xE2, 0x63, 0x50, 0x89, 0xC4, 0x4A, 0x2B, 0xE1, 0x94, 0x3D, 0x1E, 0x7B,
+        0x5C, 0x46, 0x58, 0x0A, 0x0D, 0x9D, 0x50, 0xEB, 0xC1, 0x3C, 0xB4, 0x9C,
+        0x2B, 0x63, 0x72, 0x97, 0xD2, 0x18, 0x53, 0x0B, 0x0E, 0xC0, 0xE7, 0xAE,
+        0xFF, 0x3B, 0x6F, 0x1A, 0x99, 0xFA, 0xEA, 0x43, 0x18, 0xDB, 0x39, 0x3F,
+        0xA5, 0x51, 0x57, 0x47, 0xB1, 0xF8, 0xCA, 0x17, 0x7E, 0xA2, 0x25, 0x8C,
+        0x40, 0x7E, 0xEC, 0xF2, 0x15, 0x60, 0x1C, 0xAB, 0xAE, 0x69, 0x80, 0x36,
+        0x72, 0x1C, 0x22, 0x56, 0x6F, 0x7D, 0xE4, 0xC5, 0xBB, 0x7D, 0x9F, 0xA1,
+        0x07, 0xCB, 0x5A, 0x54, 0x8A, 0x82, 0xDC, 0xD6, 0x5A, 0xD2, 0xC7, 0xA4,
+        0x8E, 0xEC, 0xB9, 0x43, 0x37, 0x47, 0xE8, 0x45, 0xFE, 0xC6, 0xBB, 0x14,
+        0xAF, 0x3E, 0xFF, 0x24, 0x23, 0x3D, 0xF0, 0xCB, 0x6E, 0x87, 0xC5, 0xBB,
+        0xED, 0x68, 0xDA, 0x77, 0xED, 0x35, 0x87, 0xDB, 0x8F, 0xA4, 0xF1, 0x94,
+        0xA4, 0x2F, 0x08, 0x19, 0xAB, 0x3A, 0xAF, 0xBA, 0x0D, 0x49, 0xFB, 0x4F,
+        0xF9, 0x39, 0xE7, 0x46, 0x99, 0x0D, 0xF9, 0xEE, 0xD5, 0x65, 0x7C, 0xB3,
+        0x19, 0x06, 0x74, 0x0B, 0x3C, 0xBE, 0xE1, 0x69, 0x1C, 0x6B, 0xBC, 0xE9,
+        0x4E, 0xF3, 0x13, 0x8F, 0x68, 0xAC, 0x9E, 0xBB, 0xAC, 0x71, 0x53, 0x22,
+        0xA1, 0xBA, 0x82, 0xD6, 0x24, 0x46, 0x0C, 0xB9, 0xFC, 0xDE, 0x09, 0x27,
+        0xF5, 0x36, 0xF6, 0x7D, 0x4D, 0xD7, 0x31, 0xD7, 0x42, 0x7D, 0xF6, 0xE9,
+        0xDA, 0xD0, 0xEF, 0x76, 0xCE, 0x3F, 0x81, 0x89, 0x0A, 0x93, 0xB8, 0xBB,
+        0x55, 0x25, 0x99, 0x3E, 0x9F, 0xD3, 0xD2, 0x59, 0xE5, 0x03, 0x1F, 0xEE,
+        0x6E, 0x7C, 0xD7, 0x1A, 0xDA, 0xE5, 0x50, 0x9B, 0x1F, 0xA7, 0xCB, 0x5E,
+        0x7B, 0x28, 0x68, 0x35, 0xDE, 0x26, 0x02, 0x8E, 0x88, 0x1C, 0x03, 0x20,
+        0x35, 0xEB, 0x3D, 0x2A, 0x1F, 0x1E, 0xF3, 0x0E, 0x5E, 0xE7, 0xF4, 0x98,
+        0x78, 0xEC, 0xBB, 0xC9, 0x65, 0xB8, 0xDE, 0x9A, 0xD4, 0x5F, 0x47, 0xFF,
+        0x45, 0x73, 0xFA, 0x5F, 0x4B, 0xE8, 0x74, 0x21, 0x50, 0xBB, 0x8D, 0xA7,
+        0xA4, 0xD8, 0x7F, 0x2C, 0x19, 0x84, 0x7B, 0xDD, 0x1B, 0x70, 0x63, 0x0E,
+        0xA6, 0x24, 0x13, 0x70, 0x7A, 0x85, 0x2F, 0x53, 0xC8, 0x13, 0x3D, 0x6D,
+        0xF4, 0x1C, 0xF1, 0xEC, 0xEB, 0x5C, 0x5F, 0xD7, 0x2A, 0x55, 0x6F, 0x5F,
+        0xEC, 0x73, 0x4E, 0xFC, 0x91, 0x6E, 0xF9, 0x17, 0x0B, 0x5C, 0xA9, 0x56,
+        0x15, 0x03, 0x4A, 0x94, 0x9F, 0x31, 0x2A, 0xB1, 0xBC, 0x7E, 0xEC, 0xEF,
+        0x5F, 0xCD, 0xB3, 0x86, 0xBE, 0xB4, 0x02, 0xA1, 0xE3, 0x83, 0xAE, 0xC9,
+        0x81, 0x66, 0xF7, 0x49, 0xDB, 0x0B, 0xD5, 0xE3, 0x8D, 0xD9, 0xFD, 0x29,
+        0xDF, 0x07, 0xE7, 0x6F, 0xC4, 0x25, 0x05, 0xF5, 0xF0, 0x45, 0x6F, 0x91,
+        0xFB, 0x5F, 0xF8, 0x34, 0xFB, 0xFE, 0xC9, 0xB9, 0x6B, 0x30, 0xDD, 0xE6,
+        0x52, 0xBB, 0xA7, 0x93, 0x5D, 0xA6, 0xAE, 0x06, 0x9D, 0x23, 0x78, 0x78,
+        0x77, 0x9C, 0xB3, 0xBB, 0xFB, 0x4E, 0xF2, 0x25, 0x2D, 0xFB, 0x28, 0xEB,
+        0x9C, 0xB7, 0x4D, 0x3F, 0x9C, 0x96, 0xA0, 0xC4, 0xE4, 0x5C, 0x22, 0xA8,
+        0x5F, 0xDE, 0x2B, 0x0D, 0xE1, 0x86, 0x49, 0x42, 0xFC, 0x50, 0xFD, 0x60,
+        0x76, 0x65, 0xAA, 0x61, 0x4B, 0xC9, 0x16, 0x44, 0xF4, 0xD6, 0x5D, 0xA6,
+        0x5F, 0xBB, 0x8A, 0xB2, 0xE6, 0x36, 0xFA, 0xC2, 0xD8, 0x0C, 0x26, 0xDA,
+        0x92, 0x68, 0xE9, 0x7E, 0xD4, 0x7F, 0x3F, 0xAF, 0xE7, 0x84, 0xFD, 0xFF,
+        0xFA, 0xE5, 0x3D, 0x74, 0xDA, 0x4C, 0x11, 0xF2, 0x1F, 0x1F, 0x76, 0xCF,
+        0x7A, 0xF0, 0x58, 0x48, 0xE8, 0xD0, 0xC1, 0x89, 0xC3, 0x2C, 0x63, 0x36,
+        0xCE, 0x60, 0x55, 0x0E, 0x6C, 0x38, 0x2D, 0xAC, 0x8F, 0x26, 0x61, 0x28,
+        0xB7, 0xCE, 0x59, 0xE7, 0x9D, 0x2C, 0x6C, 0x87, 0xF2, 0x43, 0x4F, 0x7C,
+        0x79, 0xBA, 0xAA, 0xA0, 0xAE, 0x21, 0x35, 0x1B, 0xF1, 0xC5, 0x1E, 0x56,
+        0xA7, 0x27, 0x8F, 0x22, 0xA4, 0xED, 0x3E, 0xF2, 0x70, 0xD7, 0x56, 0x3C,
+        0x16, 0x3C, 0x8E, 0xD5, 0x87, 0x22, 0x41, 0xAD, 0x79, 0xD0, 0x23, 0x7C,
+        0x7C, 0x49, 0x10, 0x45, 0x57, 0xF6, 0xF3, 0xA0, 0x95, 0x3B, 0x4A, 0xE5,
+        0x29, 0x7A, 0x9B, 0xDE, 0x79, 0x6D, 0xAB, 0x02, 0xDA, 0x23, 0x47, 0xBD,
+        0x0C, 0x54, 0x1A, 0x37, 0xC8, 0x6D, 0x79, 0xE1, 0x58, 0x0F, 0x20, 0x56,
+        0xE9, 0xE1, 0x56, 0x7A, 0xAA, 0xB4, 0x7E, 0x2D, 0x69, 0xF8, 0xBE, 0x48,
+        0x1E, 0x11, 0xA8, 0x2B, 0x3A, 0x87, 0x77, 0xA4, 0xA2, 0x29, 0x42, 0xF4,
+        0x7A, 0x29, 0x97, 0x35, 0x1E, 0x06, 0x3D, 0x9B, 0xC3, 0x45, 0x39, 0xE0,
+        0x42, 0xFF, 0xAA, 0x59, 0xE1, 0x6F, 0x07, 0xB9, 0xD3, 0x34, 0x6E, 0xFD,
+        0xE1, 0xB3, 0x08, 0x1F, 0x86, 0x8C, 0xF1, 0xF1, 0x04, 0x14, 0xE3, 0x7B,
+        0x7F, 0xA2, 0xCD, 0x0A, 0xE1, 0x67, 0x7F, 0xE9, 0x5D, 0x9B, 0x83, 0x23,
+        0x4C, 0x0A, 0xEA, 0x28, 0x93, 0xC0, 0x90, 0xE5, 0x7A, 0x8B, 0xAF, 0xD5,
+        0x96, 0x4A, 0x6A, 0x17, 0x8D, 0x0A, 0x4D, 0xD1, 0xB5, 0xE2, 0x68, 0xD0,
+        0x1E, 0xEC, 0x17, 0x6A, 0x99, 0x9D, 0x73, 0xF9, 0x57, 0x18, 0xAD, 0xF8,
+        0x51, 0x5B, 0xB2, 0x1C, 0xB2, 0x3B, 0x6B, 0x3E, 0xD1, 0x88, 0x24, 0xE7,
+        0x85, 0x63, 0x9F, 0xB5, 0xC5, 0xB6, 0xF6, 0x4F, 0x56, 0x9F, 0x80, 0xF3,
+        0x36, 0xDE, 0x3F, 0xAF, 0xDA, 0x5D, 0x9F, 0xDE, 0xB6, 0x22, 0xB8, 0xEF,
+        0x1A, 0xF3, 0x1C, 0x0A, 0xC2, 0xF9, 0x74, 0x59, 0xEB, 0xCA, 0xEC, 0x81,
+        0x1E, 0x0C, 0xD6, 0x10, 0xCA, 0x2F, 0x3A, 0x4B, 0x2A, 0x33, 0x57, 0xDA,
+        0x10, 0x94, 0xF9, 0x2D, 0x14, 0xC1, 0x35, 0xBE, 0x0A, 0x27, 0xE6, 0xD5,
+        0x39, 0xFA, 0x34, 0xD2, 0x28, 0xB8, 0x2F, 0x09, 0x68, 0xC0, 0x89, 0x1D,
+        0x13, 0xFD, 0x23, 0x9D, 0x14, 0x15, 0xCE, 0x4A, 0xDC, 0xD8, 0x0B, 0xF2,
+        0xC5, 0xE5, 0x76, 0xEE, 0x45, 0x6C, 0x95, 0x44, 0xBF, 0x84, 0x13, 0xD4,
+        0xEA, 0xDA, 0xD0, 0x05, 0x8D, 0x20, 0x86, 0xBE, 0x84, 0x6C, 0xB6, 0x03,
+        0x8E, 0x98, 0xE7, 0x2A, 0xB0, 0xB2, 0x46, 0x2B, 0x9E, 0x0C, 0xFE, 0xA4,
+        0x97, 0x61, 0x9F, 0xD4, 0xD7, 0xCE, 0xC7, 0x17, 0xBE, 0xB6, 0x70, 0x25,
+        0xB9, 0x0D, 0x60, 0x8D, 0x3B, 0x24, 0xB7, 0x2D, 0xF9, 0x3E, 0x6C, 0xE4,
+        0x40, 0x12, 0x56, 0x31, 0x9E, 0x98, 0xBC, 0x65, 0x98, 0x77, 0x75, 0x14,
+        0xCE, 0x6B, 0x85, 0xC6, 0xB3, 0x26, 0x3F, 0xA8, 0x12, 0x12, 0x98, 0xFB,
+        0xDE, 0x2D, 0xFB, 0x34, 0xCA, 0x35, 0xBD, 0x62, 0x72, 0xC6, 0x1B, 0x74,
+        0x39, 0xB4, 0x94, 0x3A, 0x2E, 0xCA, 0x7E, 0x02, 0x41, 0x5C, 0xB9, 0x8F,
+        0x22, 0x93, 0xF4, 0xED, 0xF2, 0x49, 0x0A, 0xE3, 0xCB, 0xAF, 0xD7, 0xD3,
+        0x21, 0x7B, 0x60, 0xF5, 0xA6, 0x6C, 0x88, 0xB0, 0x72, 0xAF, 0x21, 0xA5,
+        0x57, 0xAB, 0x47, 0x53, 0x0F, 0x00, 0x3F, 0x53, 0x88, 0x36, 0x6B, 0x92,
+        0x6B, 0xFB, 0x75, 0x84, 0x26, 0xA4, 0x32, 0x3A, 0xD9, 0x27, 0x47, 0x5A,
+        0x35, 0x9B, 0x8C, 0x77, 0xE9, 0xAD, 0xCD, 0x58, 0xA9, 0x8F, 0xC7, 0x37,
+        0xD3, 0x57, 0x7E, 0x82, 0x55, 0x2D, 0x83, 0x64, 0xCA, 0x9A, 0xAE, 0xC4,
+        0xB5, 0xCB, 0xD8, 0x0C, 0x1B, 0xA9, 0x28, 0xBF, 0x0E, 0x9F, 0xC9, 0x2B,
+        0x8B, 0xD7, 0x7F, 0xF1, 0x4B, 0x0B, 0xED, 0x15, 0x23, 0x4C, 0xF4, 0xA7,
+        0x32, 0x89, 0xB6, 0xB1, 0x1B, 0xD6, 0x33, 0xD3, 0x5F, 0x09, 0x12, 0x34,
+        0xE0, 0x64, 0x8A, 0xC2, 0x0E, 0x3A, 0x9A, 0x32, 0xEE, 0xF8, 0xA4, 0x1E,
+        0x9F, 0xFD, 0x13, 0x40, 0x1D, 0x45, 0x16, 0x48, 0xFF, 0x22, 0xA9, 0xFE,
+        0xA5, 0xBF, 0x1B, 0x4B, 0x93, 0x7A, 0x33, 0x28, 0xDC, 0x9D, 0x35, 0x02,
+        0x3C, 0xE4, 0xCF, 0xCA, 0x22, 0x55, 0x26, 0x51, 0xD9, 0x33, 0x2C, 0x81,
+        0x8A, 0xBB, 0x6F, 0x8E, 0x05, 0xC4, 0xF7, 0x94, 0x87, 0xB2, 0x37, 0xA6,
+        0x2F, 0x04, 0x13, 0xD8, 0xCC, 0xE8, 0x68, 0x10, 0xCA, 0x72, 0x42, 0x7F,
+        0x4A, 0xA4, 0x16, 0x5D, 0x90, 0x62, 0x6F, 0xD9, 0x10, 0xFC, 0x59, 0x33,
+        0xF3, 0xAF, 0xA7, 0x9D, 0x0B, 0x85, 0x1F, 0x35, 0x91, 0x10, 0xE6, 0xC4,
+        0xB0, 0x04, 0x82, 0xE8, 0xC9, 0xA1, 0x50, 0xF9, 0x51, 0x13, 0x08, 0xEA,
+        0x08, 0xD8, 0xB5, 0x1A, 0x66, 0xCE, 0x91, 0x2E, 0xB5, 0x99, 0xC0, 0xB2,
+        0x9E, 0xBB, 0xD8, 0x2E, 0x55, 0x70, 0xF2, 0x1E, 0x91, 0x0D, 0x06, 0xF9,
+        0x31, 0x10, 0xAE, 0x19, 0xAD, 0x91, 0x0E, 0x93, 0x80, 0x89, 0xD1, 0xA2,
+        0x94, 0xAA, 0xE7, 0xB0, 0x4E, 0xDB, 0x89, 0xA8, 0x88, 0x55, 0xB6, 0x47,
+        0x18, 0xA3, 0x4F, 0xC8, 0xB4, 0xA2, 0x55, 0x61, 0xAD, 0x90, 0xB3, 0x59,
+        0x05, 0xF5, 0x06, 0xE7, 0x39, 0x58, 0xCA, 0x49, 0x5E, 0x40, 0x31, 0x3D,
+        0x50, 0x0F, 0x94, 0x7D, 0x26, 0x3E, 0xE8, 0xF1, 0x9C, 0x46, 0xD5, 0x67,
+        0x13, 0x8A, 0x4E, 0x45, 0x82, 0xA0, 0xF1, 0xCB, 0x83, 0x85, 0x24, 0xA6,
+        0x5B, 0xC6, 0xA4, 0x15, 0xD6, 0x57, 0xBE, 0x71, 0xF5, 0xDE, 0x76, 0xF0,
+        0xC8, 0x3F, 0x14, 0xE5, 0xEB, 0xB9, 0x51, 0xDB, 0x26, 0x41, 0x65, 0x79,
+        0x88, 0xD2, 0x66, 0x40, 0x76, 0x70, 0x31, 0x27, 0x2B, 0xAB, 0x04, 0x3E,
+        0x8B, 0x6B, 0x0A, 0x7A, 0xD3, 0xF6, 0xC4, 0xBC, 0x4E, 0xB0, 0xAF, 0x51,
+        0x7F, 0x7B, 0xEA, 0x92, 0xA9, 0x56, 0xEE, 0x64, 0x1A, 0xC7, 0xA8, 0x54,
+        0xB3, 0x75, 0x52, 0x18, 0x6D, 0x67, 0x0F, 0x7E, 0x2C, 0x21, 0x23, 0x81,
+        0xF2, 0x6D, 0x0D, 0x80, 0x57, 0x65, 0xD1, 0x03, 0xBA, 0xB6, 0x31, 0xAB,
+        0x1E, 0x3C, 0x14, 0xAA, 0xD9, 0xA8, 0x58, 0x8C, 0xDA, 0x92, 0x00, 0xEB,
+        0xFE, 0xBF, 0x7E, 0x99, 0x04, 0xEB, 0x95, 0xAB, 0xB1, 0x95, 0x33, 0xB7,
+        0xA1, 0xA5, 0xAB, 0xE3, 0x9D, 0x41, 0xE1, 0xD9, 0x2D, 0x78, 0xA3, 0x09,
+        0x7E, 0xC3, 0xF4, 0x6B, 0x71, 0x0B, 0xF8, 0xA5, 0xD6, 0xE4, 0x9E, 0x83,
+        0x08, 0xA6, 0x75, 0xDA, 0x97, 0x4A, 0x01, 0xE8, 0x59, 0xD4, 0x7F, 0xDB,
+        0x76, 0x02, 0x0B, 0x3C, 0x67, 0xD3, 0xF6, 0xA9, 0x5F, 0x08, 0x4E, 0xB7,
+        0xC1, 0xC6, 0xE2, 0x2C, 0xCC, 0xA1, 0xED, 0xC5, 0xD4, 0xBD, 0x2D, 0x7A,
+        0x95, 0x5A, 0x9A, 0x00, 0x17, 0x04, 0x53, 0x32, 0x7A, 0xF2, 0xC7, 0xE0,
+        0x4F, 0x4A, 0xD2, 0x6A, 0x2D, 0x57, 0xFD, 0x70, 0x56, 0xD9, 0xD6, 0x04,
+        0x76, 0x2C, 0x2B, 0xB3, 0xBD, 0x63, 0x9A, 0x8D, 0x0C, 0xD5, 0x9D, 0x29,
+        0x5C, 0xB1, 0xA4, 0xF9, 0x59, 0x49, 0x0A, 0xE3, 0x54, 0xAD, 0x9A, 0x3F,
+        0x2C, 0xF4, 0x7C, 0x40, 0x38, 0xEE, 0x2A, 0x6B, 0x53, 0x38, 0x77, 0x48,
+        0x32, 0xC1, 0xD1, 0xC7, 0x8B, 0xE8, 0xB4, 0x81, 0xA3, 0x01, 0xE2, 0x53,
+        0x9A, 0x9D, 0xA8, 0xD1, 0xF3, 0x5B, 0x9C, 0xC5, 0x4F, 0xDB, 0x7B, 0x85,
+        0xCD, 0x0A, 0xB6, 0xD3, 0xFD, 0x38, 0x86, 0x1C, 0xF5, 0xDC, 0xC2, 0xB0,
+        0xC6, 0x47, 0x15, 0x30, 0x67, 0xEC, 0x0A, 0x59, 0xAF, 0x14, 0xC6, 0x26,
+        0x13, 0x60, 0x80, 0x43, 0xDE, 0xC9, 0x07, 0x5B, 0xAF, 0x87, 0x45, 0xAC,
+        0x4F, 0x87, 0x67, 0x56, 0x5B, 0x85, 0x31, 0xA0, 0xC9, 0x3B, 0x09, 0x60,
+        0x1E, 0xA6, 0x1C, 0x6C, 0x76, 0x5F, 0x3D, 0xDA, 0x2F, 0xA8, 0x1C, 0xA3,
+        0xFD, 0x33, 0x02, 0x6B, 0x69, 0xC8, 0x31, 0x0E, 0x63, 0x0C, 0xC1, 0x3C,
+        0xC6, 0x7E, 0xFE, 0x55, 0xA1, 0x77, 0x18, 0x18, 0xEF, 0xB9, 0x73, 0xF2,
+        0x64, 0xC7, 0x17, 0xD5, 0xBD, 0xD4, 0xE5, 0x5B, 0x91, 0x12, 0x72, 0xF0,
+        0x34, 0xDD, 0x57, 0x6E, 0xDD, 0xA6, 0xBB, 0x8A, 0xF7, 0x2A, 0x8F, 0xDE,
+        0xA7, 0xB6, 0xF3, 0x53, 0xD5, 0x6B, 0x9F, 0x76, 0xED, 0x43, 0xB8, 0x54,
+        0x65, 0xEE, 0xC3, 0xE2, 0x41, 0xD5, 0xAB, 0x05, 0xA5, 0x74, 0x4F, 0x60,
+        0xAD, 0xB4, 0x60, 0x7C, 0x8B, 0x11, 0xDF, 0x4F, 0xA8, 0x8C, 0x19, 0xAF,
+        0xAE, 0xE5, 0x25, 0xF5, 0x27, 0x11, 0x90, 0x06, 0xAB, 0xA2, 0xDA, 0x78,
+        0x29, 0x10, 0xC9, 0x98, 0xAF, 0x37, 0x92, 0x43, 0xBD, 0x4A, 0x56, 0x90,
+        0xB1, 0x9D, 0x65, 0x88, 0x30, 0xA9, 0xFB, 0xFA, 0xC2, 0x74, 0xF4, 0xFA,
+        0xD5, 0x03, 0xE9, 0xE8, 0x03, 0xD7, 0xF8, 0xEB, 0x67, 0xEE, 0x1F, 0x38,
+        0xB2, 0x5B, 0xDD, 0x71, 0xAC, 0x2D, 0x9B, 0xFE, 0x9E, 0x64, 0x3F, 0xAF,
+        0x55, 0xBA, 0x78, 0x78, 0x92, 0x8C, 0xB0, 0xCF, 0xEE, 0xB9, 0x3D, 0xBD,
+        0xF8, 0x76, 0x0A, 0x5A, 0xA2, 0xEC, 0xB3, 0x68, 0xD5, 0xA8, 0x33, 0xF9,
+        0xAF, 0x2B, 0xFB, 0xFB, 0x27, 0x4B, 0xA7, 0x0E, 0xDF, 0x5B, 0x46, 0x89,
+        0x4F, 0xA3, 0xAA, 0xDD, 0xA3, 0xA5, 0xDF, 0xBB, 0xE7, 0x74, 0xB4, 0xF9,
+        0x57, 0x20, 0x54, 0xC9, 0x73, 0xB2, 0x3F, 0x1F, 0x43, 0x17, 0x9B, 0x32,
+        0x59, 0x4F, 0x3B, 0x59, 0x3E, 0x9A, 0x13, 0x45, 0x2D, 0xF7, 0x8E, 0xD3,
+        0xBE, 0x64, 0x3B, 0xD1, 0xB1, 0xEC, 0xA6, 0x4A, 0x5B, 0x8C, 0x1A, 0x37,
+        0xC0, 0xD8, 0x46, 0x69, 0x6E, 0x62, 0xCF, 0x0C, 0x21, 0xE1, 0xA3, 0xD5,
+        0xAE, 0x84, 0xFD, 0xAA, 0x21, 0xC3, 0xC4, 0xD5, 0x15, 0x04, 0xD9, 0xDB,
+        0x1A, 0xFD, 0x36, 0x91, 0xCB, 0xEB, 0xD0, 0xE5, 0x0B, 0xFF, 0xDE, 0x41,
+        0x64, 0xCE, 0xE3, 0x8F, 0x5E, 0x8B, 0xE6, 0xBD, 0xE8, 0x4F, 0x6D, 0xEE,
+        0xEB, 0x00, 0x35, 0x6C, 0x4E, 0x77, 0x85, 0x04, 0xD6, 0xE5, 0x2B, 0xBC,
+        0x38, 0x3C, 0x19, 0xD0, 0x48, 0xD8, 0xFD, 0xB4, 0xB3, 0x1B, 0x9F, 0xFD,
+        0x3A, 0x7F, 0x21, 0x1F, 0x78, 0xFB, 0x61, 0xCB, 0xD7, 0xD4, 0x5F, 0x08,
+        0x16, 0x3E, 0x61, 0xDE, 0xFC, 0xF9, 0x37, 0x05, 0xC1, 0x78, 0x79, 0x83,
+        0xD9, 0x76, 0xB2, 0xC9, 0xD5, 0xB0, 0x86, 0x93, 0xDC, 0x4A, 0xA1, 0x41,
+        0x35, 0x23, 0x0F, 0x29, 0x4D, 0xE7, 0xEB, 0xDE, 0x2D, 0xBF, 0x7E, 0x7F,
+        0x24, 0x5A, 0xB7, 0x89, 0x2E, 0xDC, 0xA1, 0x17, 0xFF, 0x22, 0xB6, 0xD2,
+        0x5F, 0x8A, 0x12, 0x88, 0x07, 0x09, 0x2A, 0x62, 0x01, 0x3B, 0x54, 0xC2,
+        0x52, 0xCC, 0xD5, 0x10, 0xFA, 0xBA, 0xB4, 0xCA, 0x74, 0x8E, 0x01, 0x4F,
+        0xAD, 0xB3, 0xEC, 0x3A, 0x7B, 0xFB, 0x3E, 0x55, 0xCD, 0x7B, 0xFD, 0xC9,
+        0x8B, 0xEE, 0xCA, 0x83, 0x92, 0xD7, 0xB9, 0xA4, 0x79, 0xB8, 0x4A, 0xAB,
+        0xBA, 0xB9, 0x9B, 0x9E, 0xE0, 0xDB, 0xB5, 0xED, 0xE8, 0x4C, 0x2A, 0xA8,
+        0xBC, 0x7B, 0x0B, 0x27, 0xB6, 0x9D, 0xB9, 0x13, 0xCF, 0x2D, 0x0F, 0xDC,
+        0x18, 0xC9, 0x39, 0xF2, 0x45, 0xBC, 0xFF, 0x79, 0xC0, 0x73, 0x6B, 0x2B,
+        0x51, 0xD7, 0x84, 0xE7, 0x96, 0x4C, 0x94, 0x8C, 0xAE, 0x00, 0x0A, 0xE6,
+        0x1C, 0x0E, 0x66, 0xD1, 0x53, 0x20, 0x8E, 0x9A, 0xC9, 0x18, 0x3E, 0x8A,
+        0xCD, 0x81, 0xA5, 0x8E, 0x9C, 0x69, 0x3F, 0xA1, 0x18, 0x14, 0x65, 0x00,
+        0x4D, 0xBF, 0xFE, 0x89, 0xF9, 0x2B, 0x3B, 0xEB, 0x5D, 0x3B, 0x87, 0xEB,
+        0xA8, 0x19, 0xE4, 0xB7, 0xE5, 0xC6, 0xB7, 0x50, 0xD0, 0xDC, 0xF2, 0x73,
+        0x2E, 0xB8, 0xB7, 0xD6, 0xC9, 0xBA, 0xE8, 0x20, 0x08, 0xF9, 0x0D, 0x95,
+        0x52, 0x6D, 0x39, 0xF3, 0xDB, 0xAF, 0xFA, 0x85, 0x15, 0x78, 0x62, 0xAD,
+        0x23, 0x5A, 0xA5, 0x78, 0xDC, 0x3C, 0x0B, 0xD5, 0x4E, 0x85, 0xC7, 0x79,
+        0x0B, 0x5C, 0xFC, 0x3C, 0xC6, 0x69, 0x82, 0x0A, 0x58, 0x06, 0x6F, 0x65,
+        0x7C, 0xCE, 0x72, 0x09, 0xBF, 0x98, 0x09, 0x6F, 0xD6, 0xC4, 0x67, 0x2F,
+        0xA4, 0xD7, 0x8D, 0xDE, 0x87, 0x43, 0xB3, 0xBF, 0x2D, 0x73, 0xA6, 0x78,
+        0xED, 0x45, 0x0E, 0x71, 0xA7, 0x16, 0x9F, 0xB9, 0xD6, 0x69, 0xD3, 0x36,
+        0xEB, 0x01, 0xD8, 0xE6, 0x4C, 0xAE, 0x71, 0x42, 0xFD, 0xF1, 0xF4, 0xF2,
+        0x5D, 0x01, 0xF3, 0x29, 0x0F, 0x59, 0x72, 0xBC, 0x57, 0xB7, 0x72, 0x5B,
+        0x4D, 0x4A, 0x57, 0x85, 0x5E, 0xF9, 0x32, 0xEF, 0xE1, 0xED, 0x34, 0x7C,
+        0xD6, 0x82, 0xB0, 0x03, 0xB9, 0x57, 0xD3, 0xB5, 0x36, 0x01, 0x6F, 0xD2,
+        0x4C, 0x6E, 0x9E, 0x36, 0x99, 0x55, 0x25, 0xCB, 0x55, 0xDA, 0x49, 0x07,
+        0x9B, 0x6F, 0x2C, 0x2B, 0x56, 0x6A, 0xFD, 0x29, 0x6B, 0x36, 0x3F, 0x4E,
+        0x44, 0x28, 0x2D, 0xEC, 0xA9, 0x49, 0x83, 0x5B, 0x58, 0x88, 0xE5, 0x74,
+        0xC4, 0xA0, 0x33, 0xEA, 0xA7, 0x05, 0x59, 0xE5, 0x06, 0x02, 0xC6, 0x3B,
+        0xD5, 0x82, 0xC4, 0xDD, 0xCE, 0x44, 0xA2, 0xC5, 0x79, 0xAD, 0xBB, 0xF9,
+        0xF0, 0x0A, 0xFD, 0x8B, 0xAD, 0xF5, 0xC3, 0xE2, 0xA3, 0x21, 0x7B, 0x33,
+        0x7E, 0x72, 0x70, 0x94, 0x90, 0xBA, 0xE3, 0x28, 0x9D, 0xD8, 0xE7, 0x1F,
+        0x1D, 0x2D, 0x4F, 0x50, 0x80, 0xF6, 0xE9, 0xCD, 0xDB, 0xD3, 0xC0, 0x05,
+        0xE4, 0xEC, 0xD8, 0xB9, 0xC8, 0x36, 0x3F, 0xD9, 0x7C, 0x8E, 0x5D, 0x2C,
+        0xB5, 0x68, 0x86, 0x87, 0xF6, 0xAA, 0x20, 0x8F, 0x31, 0x2B, 0xE5, 0x83,
+        0x59, 0x9A, 0xE1, 0xDF, 0x0C, 0xC3, 0x8F, 0x91, 0xB6, 0x01, 0xC1, 0x88,
+        0x32, 0x9C, 0x2A, 0x25, 0xCA, 0x84, 0xF3, 0x9C, 0xA7, 0x9B, 0xC0, 0x96,
+        0xA7, 0x00, 0x24, 0x23, 0x94, 0xBA, 0xE3, 0x9B, 0x28, 0xD8, 0xE5, 0xE7,
+        0xB6, 0x65, 0xC5, 0x7C, 0x5B, 0x1E, 0x0F, 0x29, 0x42, 0x59, 0x24, 0xEF,
+        0x53, 0x86, 0xC5, 0x07, 0xDA, 0xBE, 0x35, 0x4A, 0x72, 0xB0, 0x3A, 0x25,
+        0xE9, 0xBA, 0xA2, 0x2A, 0xFA, 0x68, 0x4C, 0x69, 0x71, 0x46, 0x63, 0x30,
+        0xE1, 0x86, 0x2E, 0xA2, 0xAE, 0x4F, 0xB3, 0x78, 0x1E, 0xC9, 0x7B, 0x8F,
+        0xD3, 0x79, 0xF0, 0x6A, 0x29, 0xEF, 0x17, 0xC7, 0x5C, 0xC2, 0x19, 0x9F,
+        0x13, 0xC3, 0xD5, 0x4C, 0xD5, 0x26, 0x9C, 0x96, 0x31, 0x05, 0xD3, 0xA2,
+        0xB8, 0xA2, 0x54, 0xF7, 0x51, 0xA9, 0xE9, 0xC6, 0xCF, 0xA7, 0x22, 0x52,
+        0x2A, 0xA3, 0x22, 0xE2, 0x31, 0x26, 0x67, 0x2E, 0x79, 0xAD, 0x57, 0x63,
+        0x31, 0x7B, 0x4A, 0x37, 0x17, 0x72, 0xF5, 0x7F, 0xB8, 0xDF, 0x86, 0xE2,
+        0xE7, 0xF1, 0x3E, 0x10, 0xC2, 0xDA, 0xE5, 0x02, 0x2E, 0x1F, 0xD9, 0xA3,
+        0x07, 0x2A, 0x7D, 0xE2, 0xBB, 0x9B, 0x5D, 0xD4, 0x34, 0x37, 0xC0, 0x86,
+        0xC0, 0x55, 0x6E, 0x07, 0x1C, 0x11, 0xD1, 0xA5, 0xFF, 0x7D, 0x9B, 0x0A,
+        0x7B, 0xD7, 0x65, 0xAB, 0xF5, 0x7E, 0x80, 0x1C, 0xB6, 0xC4, 0x95, 0xF6,
+        0x75, 0xA3, 0x3B, 0xC3, 0xE8, 0xC0, 0xB8, 0x4E, 0xAD, 0x95, 0xC4, 0x70,
+        0x5D, 0xDB, 0xC9, 0x56, 0x18, 0x51, 0x7B, 0xE1, 0x03, 0x5D, 0xDE, 0x55,
+        0x0A, 0xBB, 0x44, 0xED, 0xB8, 0xD4, 0xB1, 0x47, 0xDE, 0x6B, 0xE1, 0xD8,
+        0xD5, 0xC6, 0x45, 0x3F, 0x67, 0x4C, 0x89, 0x76, 0xC7, 0xF6, 0xE3, 0xF3,
+        0x58, 0x88, 0xF7, 0x05, 0x24, 0x1D, 0x1F, 0x38, 0x4F, 0xB1, 0x97, 0x7E,
+        0x1B, 0xEB, 0x68, 0x0D, 0x22, 0xD2, 0x79, 0xA9, 0x24, 0x4E, 0xAD, 0x17,
+        0x5C, 0x68, 0xB5, 0xDF, 0xD4, 0x18, 0x2E, 0xEB, 0xD8, 0x13, 0x58, 0x67,
+        0xF1, 0x6E, 0xBD, 0x9A, 0xCA, 0x2A, 0x3C, 0x08, 0xD9, 0x09, 0xDF, 0xC9,
+        0xDE, 0xAD, 0x99, 0x01, 0xFB, 0x26, 0x11, 0x98, 0x34, 0x55, 0xF8, 0x00,
+        0x92, 0x15, 0x5F, 0xD1, 0x8C, 0x22, 0x64, 0xF4, 0x5F, 0x6C, 0xC1, 0xA0,
+        0x0F, 0x62, 0x06, 0x8A, 0xA4, 0xBC, 0x31, 0x98, 0x90, 0x10, 0x30, 0x27,
+        0x9E, 0xE8, 0x53, 0xF0, 0xCC, 0xE8, 0x24, 0xB2, 0xC9, 0xD6, 0x43, 0x67,
+        0xEB, 0x16, 0x00, 0x84, 0xAD, 0x8D, 0xE2, 0xFA, 0xE3, 0xA6, 0xCB, 0xCD,
+        0x5C, 0x9C, 0xF8, 0x8D, 0x4E, 0x3D, 0x93, 0x38, 0xAB, 0xAD, 0x7A, 0x3F,
+        0x36, 0x7D, 0xEE, 0xE8, 0x8E, 0xA9, 0x5F, 0xF8, 0xEC, 0x1B, 0x97, 0x5C,
+        0xFD, 0xE5, 0x13, 0xB8, 0xB0, 0xF1, 0x35, 0x8D, 0x2F, 0x19, 0xF1, 0xC7,
+        0xA5, 0x0B, 0x5F, 0x41, 0x86, 0xC7, 0x3E, 0x97, 0xC7, 0xBF, 0xB6, 0xC5,
+        0x32, 0xA4, 0x07, 0xF7, 0x9B, 0x4C, 0xA6, 0xFE, 0xA2, 0x70, 0x47, 0xF0,
+        0x94, 0x3C, 0x52, 0xCC, 0x6B, 0x54, 0x16, 0x93, 0x08, 0xDD, 0x3E, 0xDE,
+        0x23, 0xE6, 0x0E, 0xD5, 0x8B, 0x44, 0xEB, 0x30, 0xBD, 0x29, 0x22, 0x9A,
+        0x9E, 0x64, 0x49, 0x36, 0x39, 0x9B, 0xFA, 0x45, 0xF4, 0x5B, 0x93, 0x89,
+        0xB6, 0x88, 0xA4, 0xC4, 0x29, 0xF7, 0xAC, 0x80, 0xEF, 0x70, 0x78, 0xF8,
+        0xD9, 0x5D, 0xEB, 0x15, 0xBE, 0x1C, 0x42, 0xC4, 0x54, 0xBC, 0x9D, 0xE0,
+        0x5C, 0xB2, 0xAB, 0x84, 0x1B, 0x0E, 0x29, 0xE1, 0xB5, 0x0A, 0x26, 0x90,
+        0x39, 0x6B, 0x27, 0x11, 0xB6, 0x17, 0x4E, 0x42, 0x3E, 0x33, 0xD8, 0x18,
+        0x05, 0x7A, 0x41, 0x0F, 0x58, 0xC0, 0x1A, 0x5A, 0x64, 0xB0, 0x2F, 0x07,
+        0x23, 0x34, 0x58, 0x05, 0x3D, 0x8D, 0xC3, 0xAD, 0xA5, 0x5E, 0xA7, 0x6F,
+        0x5B, 0xD9, 0xE1, 0xDA, 0x1B, 0x61, 0x23, 0xBB, 0x25, 0x58, 0x8C, 0xAA,
+        0x4A, 0x7D, 0x46, 0xE4, 0x36, 0xAC, 0xF0, 0xB6, 0x84, 0xC9, 0x6D, 0x8D,
+        0x26, 0x15, 0x8F, 0xDA, 0xB6, 0x1F, 0xE7, 0xEC, 0x35, 0x23, 0xB3, 0x09,
+        0x55, 0xA2, 0xDB, 0x89, 0x78, 0x33, 0x63, 0xB9, 0x41, 0x27, 0xAA, 0x42,
+        0x1F, 0xF5, 0x4C, 0xED, 0x07, 0xEC, 0x44, 0xBC, 0x99, 0xB1, 0xDC, 0xA0,
+        0xD3, 0x5F, 0xFF, 0xB8, 0x74, 0xF6, 0xE0, 0x5F, 0x2A, 0x5F, 0x30, 0x0D,
+        0x3E, 0x3D, 0xE2, 0x7B, 0x6A, 0x67, 0x20, 0x13, 0x04, 0x06, 0x34, 0x9D,
+        0x6A, 0xEB, 0x79, 0x4A, 0xDD, 0x56, 0x28, 0x73, 0x6E, 0x5F, 0x10, 0x14,
+        0xB3, 0x74, 0x9F, 0xCF, 0x32, 0x17, 0x2A, 0x17, 0x13, 0x70, 0xDA, 0xE6,
+        0x62, 0xA0, 0x25, 0x6F, 0xC0, 0x38, 0xF0, 0xB7, 0x93, 0x08, 0x87, 0x2D,
+        0x07, 0xB9, 0xC1, 0x17, 0x28, 0x4F, 0x5F, 0xA0, 0x6C, 0xA0, 0x85, 0x0B,
+        0x2E, 0xEC, 0x13, 0xA2, 0xE1, 0x27, 0xA4, 0x06, 0x7E, 0xB2, 0xEA, 0xF4,
+        0xA7, 0xC2, 0x8B, 0x27, 0xE5, 0x71, 0x31, 0x0B, 0x35, 0x2F, 0xB9, 0x2D,
+        0x99, 0x9D, 0x98, 0x3D, 0x56, 0xF5, 0xF0, 0xE9, 0x78, 0x0F, 0xF5, 0xE8,
+        0xC0, 0x1D, 0xF9, 0xDE, 0x06, 0xB9, 0xE1, 0xCF, 0xB2, 0x58, 0x81, 0xEB,
+        0x5C, 0xC8, 0x49, 0x05, 0x72, 0xC7, 0x55, 0x89, 0x45, 0xFC, 0x98, 0xCA,
+        0xE6, 0x63, 0x2E, 0x19, 0xDB, 0x7A, 0xA8, 0xA6, 0xC6, 0x89, 0xDE, 0x1C,
+        0x52, 0xBE, 0xF0, 0x4E, 0x90, 0xFB, 0x32, 0x54, 0x6C, 0xA2, 0x9D, 0x9F,
+        0x32, 0x4B, 0xB8, 0x9C, 0xAB, 0x20, 0x08, 0x56, 0xFB, 0x4B, 0xF6, 0x14,
+        0xCD, 0x30, 0x76, 0xE8, 0xB5, 0x15, 0x83, 0x66, 0xA1, 0xBC, 0x27, 0x86,
+        0x6A, 0xB4, 0x83, 0xD8, 0x6D, 0x52, 0xBE, 0xDE, 0xB8, 0xEF, 0x9F, 0x30,
+        0xE9, 0x05, 0x3B, 0x4B, 0xFA, 0xA3, 0x87, 0xA5, 0xE4, 0x59, 0x0E, 0x57,
+        0x48, 0xDC, 0x82, 0x37, 0x2F, 0xBD, 0xCC, 0x59, 0xC3, 0xBC, 0xAD, 0x62,
+        0xF9, 0xC3, 0x20, 0xC0, 0xDF, 0xF9, 0x72, 0xCE, 0xA8, 0x4F, 0x25, 0x93,
+        0x57, 0xA0, 0x69, 0x94, 0x70, 0x2F, 0x9C, 0x02, 0xF1, 0x68, 0xAB, 0xB9,
+        0xC9, 0x31, 0xF5, 0x6A, 0x45, 0x38, 0x1B, 0xF7, 0x41, 0x1B, 0x9D, 0x38,
+        0xB5, 0xB0, 0x2D, 0xAA, 0xC5, 0x2A, 0x15, 0x56, 0x30, 0x91, 0xAC, 0x51,
+        0x2A, 0x3B, 0x95, 0xE3, 0xC8, 0xFA, 0xE7, 0x64, 0x53, 0x5E, 0x09, 0x7B,
+        0xA7, 0xD0, 0x00, 0xAD, 0xF8, 0x25, 0xD9, 0x23, 0x24, 0x57, 0xEF, 0xCF,
+        0x67, 0x83, 0xFB, 0x8E, 0x36, 0x63, 0x61, 0x49, 0xFA, 0x29, 0xF5, 0xAC,
+        0xE7, 0x91, 0x64, 0xBF, 0x2A, 0xD2, 0x93, 0x9C, 0x4D, 0x65, 0xD3, 0x83,
+        0x58, 0x65, 0xB3, 0xD5, 0x65, 0xA7, 0x96, 0x42, 0xAF, 0x93, 0xCC, 0xB2,
+        0x46, 0xBA, 0x4F, 0x48, 0x71, 0xAB, 0xC7, 0x4A, 0xFB, 0x63, 0x13, 0xFD,
+        0x67, 0x70, 0x1B, 0x83, 0x5E, 0x8C, 0x42, 0xAE, 0xAE, 0x0C, 0xD3, 0x8D,
+        0xC3, 0xCF, 0xC6, 0xD2, 0x2B, 0x3B, 0x15, 0xA5, 0x3E, 0x72, 0x21, 0x67,
+        0x5F, 0x40, 0x51, 0xA5, 0x46, 0x96, 0xDE, 0x16, 0x29, 0x4A, 0x5E, 0xBC,
+        0x98, 0xDD, 0x87, 0x4A, 0x56, 0x97, 0xCC, 0x2B, 0xB9, 0x6E, 0x69, 0x15,
+        0x2A, 0x63, 0x43, 0x15, 0x85, 0x55, 0x76, 0x97, 0x4D, 0x0B, 0x52, 0xB9,
+        0x1D, 0xC2, 0x46, 0xF0, 0x6F, 0xC3, 0xB1, 0x53, 0x3B, 0x53, 0x1F, 0x3C,
+        0x7A, 0x69, 0x5B, 0xD0, 0x08, 0xA4, 0xC6, 0x3C, 0x3A, 0xBC, 0xD6, 0x53,
+        0x84, 0x5C, 0xA3, 0x6E, 0x09, 0xA9, 0x46, 0x85, 0xD1, 0xA8, 0x94, 0xAF,
+        0xA8, 0xBE, 0x2E, 0x69, 0x83, 0x62, 0x31, 0x97, 0x16, 0xA9, 0xB1, 0xBA,
+        0x42, 0x17, 0x7A, 0x70, 0x54, 0x61, 0x54, 0xB3, 0xFC, 0xEC, 0xE7, 0xC8,
+        0x84, 0xEA, 0xB7, 0x4B, 0x20, 0xE4, 0xEC, 0xFC, 0xEE, 0x6F, 0x56, 0xA2,
+        0x7D, 0x7D, 0xDE, 0xF3, 0xEC, 0x93, 0xE6, 0xBE, 0x33, 0xD3, 0xE9, 0xBD,
+        0xF3, 0x4C, 0x72, 0x8D, 0x31, 0xF8, 0xFF, 0x87, 0x1D, 0x17, 0x7C, 0xA5,
+        0x52, 0xAD, 0xCD, 0x9E, 0x33, 0x33, 0x9F, 0xCF, 0xAD, 0x55, 0xED, 0x88,
+        0x22, 0x92, 0x98, 0x91, 0xDB, 0x08, 0xAB, 0x9C, 0x0B, 0x8E, 0xA4, 0x66,
+        0xC4, 0x8C, 0xD2, 0x2C, 0xC2, 0xFF, 0x09, 0xDF, 0xB0, 0x11, 0xCF, 0xC2,
+        0xA9, 0xC0, 0x49, 0xE8, 0x8C, 0x1D, 0xB0, 0xD3, 0x71, 0xF6, 0x3F, 0xBA,
+        0xE4, 0xB9, 0xF1, 0xDF, 0x38, 0xE7, 0x85, 0xC7, 0x7B, 0x0D, 0x71, 0x99,
+        0x4E, 0x28, 0x45, 0xE1, 0x6C, 0x5C, 0xCF, 0x39, 0x06, 0xE7, 0xBB, 0x62,
+        0x3E, 0x59, 0x10, 0x4F, 0xC4, 0x6F, 0x6A, 0x0E, 0x58, 0x3B, 0x7B, 0x54,
+        0x03, 0x9B, 0x90, 0x9F, 0x3B, 0x2D, 0xA9, 0x8E, 0x6E, 0x53, 0xA8, 0x0A,
+        0x38, 0x8E, 0x42, 0x7A, 0xB5, 0x63, 0x2D, 0x93, 0x32, 0x55, 0x48, 0x3B,
+        0x47, 0x1D, 0xC1, 0xDC, 0x6F, 0x82, 0x54, 0xF2, 0x41, 0x2D, 0xD4, 0x79,
+        0x0A, 0x5F, 0x1D, 0xB2, 0xA0, 0x4C, 0xCD, 0xDF, 0xCA, 0x12, 0x57, 0xD6,
+        0xB4, 0x52, 0xC7, 0x4E, 0x1D, 0xF8, 0x49, 0xB3, 0xB2, 0xEF, 0x1A, 0x1A,
+        0xE5, 0xBD, 0x93, 0x79, 0x68, 0x62, 0x16, 0xE7, 0x61, 0xE7, 0x62, 0xE1,
+        0x36, 0x8B, 0xB9, 0x19, 0x1E, 0x83, 0x66, 0x64, 0xED, 0x10, 0xD0, 0x73,
+        0x1D, 0xA7, 0x88, 0x75, 0x23, 0x44, 0x74, 0xAF, 0xAE, 0xF8, 0xE8, 0xC0,
+        0x3F, 0xB6, 0x9E, 0xCB, 0xD9, 0xAA, 0x61, 0x4F, 0xA5, 0x52, 0x67, 0xFC,
+        0x78, 0x85, 0x96, 0xDD, 0x28, 0xE8, 0xA3, 0xA8, 0xCB, 0xF2, 0x42, 0x8A,
+        0x5D, 0xD6, 0x6D, 0xAD, 0xD1, 0xFB, 0xC4, 0x56, 0xCA, 0xDF, 0x40, 0x72,
+        0xF4, 0xCD, 0xDD, 0xE5, 0x8B, 0xEA, 0xC3, 0xA9, 0x9B, 0x73, 0x83, 0xDB,
+        0xAC, 0x4C, 0x91, 0x92, 0xF9, 0x38, 0xBE, 0xBC, 0x32, 0x88, 0xA4, 0x9C,
+        0x29, 0x64, 0x41, 0xD2, 0x11, 0x0D, 0x25, 0xD2, 0xA1, 0x89, 0xD8, 0x89,
+        0x25, 0x94, 0x35, 0x32, 0xFA, 0xC4, 0x12, 0x07, 0x87, 0x98, 0x60, 0x13,
+        0x7A, 0x30, 0x7A, 0x0C, 0xCC, 0x8E, 0x68, 0x38, 0x06, 0x49, 0xC0, 0x6D,
+        0xF9, 0x06, 0x52, 0xCC, 0x49, 0x62, 0xD2, 0x31, 0x29, 0x10, 0x23, 0x86,
+        0xF5, 0x6F, 0xA8, 0xA1, 0x16, 0x9E, 0x6D, 0xDB, 0x50, 0x80, 0xB2, 0xE1,
+        0xDF, 0x90, 0x62, 0xEC, 0x45, 0xBB, 0xC2, 0xD3, 0x41, 0x15, 0x77, 0xEC,
+        0x18, 0xA1, 0xE3, 0x91, 0xD6, 0x4E, 0x45, 0x90, 0x51, 0x75, 0x9C, 0xC4,
+        0x08, 0x83, 0x68, 0xD4, 0xC0, 0x5C, 0x18, 0xA0, 0x1A, 0x74, 0x69, 0x0F,
+        0xCD, 0xF6, 0xD9, 0x62, 0xCC, 0xC8, 0x60, 0x67, 0x41, 0x2B, 0xF7, 0xA2,
+        0xC2, 0x24, 0xFB, 0x33, 0x43, 0xEA, 0x63, 0x4E, 0x68, 0x00, 0x7B, 0x0C,
+        0x27, 0x1E, 0xC2, 0xE5, 0x9D, 0x18, 0x35, 0x80, 0x10, 0xE2, 0xA5, 0x46,
+        0xB4, 0xEA, 0x2F, 0x41, 0x68, 0x5B, 0x4C, 0xA9, 0x9C, 0x2C, 0x2E, 0xCF,
+        0x1D, 0x9F, 0x2D, 0xE3, 0x46, 0x8D, 0x48, 0x80, 0xC3, 0x0D, 0x58, 0xF4,
+        0x91, 0x3A, 0x59, 0x0F, 0x1B, 0x5E, 0x6A, 0x69, 0xF2, 0x5F, 0xCA, 0xA0,
+        0x76, 0x12, 0x38, 0x48, 0xD3, 0xD1, 0xFD, 0x09, 0x79, 0x5D, 0x34, 0xCF,
+        0x3C, 0xFF, 0x2A, 0xA2, 0x42, 0xD5, 0x82, 0x93, 0x3C, 0xD6, 0x60, 0x9A,
+        0x3A, 0x31, 0x87, 0x41, 0xB8, 0x00, 0x27, 0x10, 0x73, 0x9C, 0x81, 0xE4,
+        0x70, 0x6D, 0x25, 0x20, 0x6A, 0xF0, 0x20, 0x70, 0x33, 0xBB, 0x67, 0x6F,
+        0x3F, 0xE9, 0x88, 0xEF, 0xC8, 0x28, 0x86, 0x36, 0xB4, 0x4D, 0xE5, 0x9A,
+        0x5D, 0x90, 0x14, 0xE2, 0x1F, 0xB6, 0xDB, 0x07, 0x5B, 0x15, 0xAD, 0x49,
+        0xF2, 0x4B, 0x24, 0xA4, 0xE7, 0xB2, 0x8C, 0x65, 0xEB, 0x49, 0x8F, 0x24,
+        0x24, 0x52, 0x21, 0x65, 0x6A, 0xE3, 0x28, 0x65, 0xB3, 0xE0, 0xBD, 0x90,
+        0x54, 0x23, 0x5F, 0x3C, 0x51, 0x1B, 0x40, 0x5A, 0x86, 0xCA, 0x2E, 0x8F,
+        0x4F, 0xC3, 0xDF, 0x0D, 0xC6, 0x36, 0x55, 0xB8, 0x11, 0x66, 0x21, 0xB5,
+        0x85, 0xE8, 0x61, 0xF0, 0x14, 0x04, 0x67, 0x3B, 0x2B, 0x46, 0xD6, 0x2F,
+        0xCB, 0xDF, 0x55, 0xD6, 0xE2, 0x60, 0x63, 0x43, 0x3E, 0xCB, 0x63, 0xFA,
+        0xAA, 0x74, 0xE0, 0x8C, 0x30, 0x85, 0xC3, 0x93, 0x1C, 0x28, 0x79, 0x35,
+        0xB4, 0xD4, 0x50, 0xF8, 0xD4, 0x27, 0x5B, 0x73, 0x3D, 0xD8, 0x8F, 0x5A,
+        0xEA, 0x1D, 0xC5, 0x2A, 0xCF, 0x51, 0x5B, 0xEE, 0xC6, 0x4E, 0x68, 0x4B,
+        0x01, 0x2B, 0xEC, 0x32, 0xC6, 0xB5, 0x26, 0xC5, 0x65, 0xE6, 0x8A, 0xD7,
+        0x76, 0x01, 0x4E, 0x90, 0x37, 0xC1, 0x44, 0xF7, 0xAD, 0x41, 0x24, 0xD7,
+        0x1B, 0xE4, 0xD8, 0xE3, 0x2A, 0xB9, 0x41, 0x07, 0x27, 0xC6, 0xF8, 0x1B,
+        0x7E, 0xB8, 0xB2, 0x72, 0x92, 0x85, 0x3C, 0x59, 0x6F, 0x4A, 0x62, 0xBD,
+        0xDB, 0x37, 0x08, 0x84, 0x9E, 0x39, 0xC2, 0x4C, 0xEB, 0x58, 0x2F, 0x22,
+        0x9A, 0xDB, 0xA1, 0xEA, 0x8A, 0x9B, 0x28, 0x02, 0x29, 0x78, 0x9F, 0x62,
+        0x86, 0xF3, 0x64, 0x0F, 0x32, 0xCF, 0x83, 0xCF, 0x1E, 0xCF, 0x92, 0x7F,
+        0xF9, 0x98, 0x92, 0x72, 0xFF, 0xDB, 0x8A, 0x55, 0xE8, 0x8E, 0xD6, 0x3D,
+        0xA5, 0x0F, 0xBA, 0x61, 0xC7, 0x43, 0x74, 0x2C, 0x7A, 0x58, 0x8E, 0x1B,
+        0xF5, 0xF1, 0xE6, 0x35, 0xC6, 0xB9, 0x40, 0x43, 0xF0, 0x7B, 0x2B, 0x32,
+        0xBD, 0x41, 0x31, 0x45, 0x62, 0x13, 0xFF, 0x86, 0x24, 0x27, 0x5B, 0xD9,
+        0x4B, 0x14, 0x89, 0xB1, 0x1C, 0x85, 0x4E, 0x9E, 0x24, 0x27, 0xB2, 0x8E,
+        0x8E, 0xF3, 0x21, 0x65, 0xFD, 0x52, 0x25, 0xCE, 0xED, 0x46, 0x4D, 0xA4,
+        0xFF, 0x3C, 0xDF, 0x0F, 0x5D, 0xE9, 0x84, 0x1E, 0x3E, 0x5F, 0xDF, 0x73,
+        0x49, 0xC6, 0x3A, 0x28, 0x98, 0xE3, 0x1B, 0x29, 0x1E, 0xBC, 0x74, 0x7B,
+        0xE2, 0x2F, 0xF3, 0xEF, 0x6D, 0xE8, 0x8B, 0x01, 0x14, 0x3A, 0x91, 0xE0,
+        0x9C, 0x97, 0x43, 0x11, 0x71, 0xC5, 0x91, 0x8C, 0xE1, 0x0A, 0xA1, 0x0A,
+        0x8D, 0x2F, 0x8C, 0x74, 0x7B, 0x3C, 0x55, 0xD1, 0xB9, 0xB8, 0x2B, 0xF6,
+        0x5B, 0x2E, 0x52, 0x9A, 0xA4, 0x28, 0x77, 0xDF, 0xE0, 0xC1, 0x46, 0x3F,
+        0x01, 0xC9, 0xD1, 0x1C, 0x6D, 0xC8, 0xC1, 0xB7, 0x16, 0xBE, 0x56, 0x4C,
+        0x7E, 0x46, 0x20, 0x9A, 0x08, 0x22, 0x1E, 0x78, 0x68, 0x7A, 0x63, 0x19,
+        0x52, 0x16, 0x9F, 0xE6, 0xE2, 0xCB, 0xDA, 0xC2, 0x20, 0x75, 0x33, 0xB4,
+        0xEC, 0x12, 0xBB, 0x6C, 0xE1, 0xE7, 0x20, 0xC2, 0xB5, 0x91, 0x0A, 0xA4,
+        0x00, 0x4B, 0x8A, 0x12, 0xE5, 0x34, 0xEA, 0xBA, 0x69, 0x60, 0x8D, 0xA0,
+        0xA5, 0x8D, 0x14, 0xF3, 0x24, 0x4C, 0x9A, 0x1B, 0xBC, 0xC5, 0x70, 0x49,
+        0x38, 0x19, 0x04, 0xC3, 0x0B, 0x68, 0x8E, 0x75, 0x22, 0x8D, 0xFF, 0x4E,
+        0xC7, 0x38, 0xDB, 0xC8, 0x17, 0xC7, 0x86, 0x09, 0x32, 0x7C, 0x9A, 0x08,
+        0x53, 0x2A, 0x36, 0xC9, 0x5C, 0x7E, 0xB3, 0x23, 0x18, 0xAD, 0xA4, 0x34,
+        0xC8, 0xAC, 0x22, 0xE0, 0xEA, 0x73, 0xD7, 0xDF, 0xD1, 0xC7, 0xA1, 0x67,
+        0xDA, 0x32, 0x8C, 0x5A, 0xD6, 0x56, 0xF1, 0x95, 0x33, 0xEF, 0x6E, 0xEB,
+        0xBE, 0x76, 0x89, 0x08, 0x80, 0x3E, 0x05, 0x8D, 0x8B, 0x3E, 0x73, 0xDD,
+        0x4B, 0xD0, 0x56, 0xC6, 0x98, 0x24, 0xE0, 0x04, 0x7F, 0x61, 0x22, 0x47,
+        0x3F, 0xAA, 0x1F, 0xF6, 0x06, 0xA7, 0xBB, 0x8F, 0xC6, 0xD2, 0x1A, 0x4C,
+        0xAC, 0xBE, 0xD7, 0x58, 0x6D, 0x07, 0xB6, 0x8D, 0x4E, 0x21, 0xBA, 0xAE,
+        0x13, 0x6A, 0x59, 0x30, 0x1D, 0x93, 0xAE, 0x64, 0x46, 0x48, 0x2B, 0x66,
+        0x8E, 0x75, 0xCC, 0xA9, 0x68, 0x3A, 0x8C, 0xE6, 0xC2, 0x38, 0xBB, 0xA7,
+        0x00, 0xFB, 0x4E, 0x44, 0x8B, 0xE9, 0x46, 0xF0, 0x26, 0xA6, 0x99, 0x26,
+        0xD5, 0x7E, 0x9D, 0xA2, 0x9D, 0xC4, 0x8B, 0xC2, 0x1D, 0xBE, 0x29, 0xD4,
+        0xE0, 0x7D, 0x37, 0xCA, 0xB8, 0x53, 0x83, 0xB8, 0x61, 0x29, 0x86, 0xDA,
+        0x03, 0x9C, 0x45, 0x11, 0x9C, 0xB4, 0xB8, 0x04, 0x06, 0x84, 0x9A, 0x63,
+        0xD0, 0x79, 0x42, 0x52, 0xBA, 0x64, 0x72, 0x50, 0x60, 0x34, 0x35, 0x28,
+        0xE9, 0xE5, 0x78, 0xD1, 0xCC, 0x3E, 0xF1, 0xBC, 0xAB, 0xF8, 0x2C, 0xB1,
+        0xCA, 0x07, 0xEB, 0x22, 0x29, 0x24, 0x6F, 0x4E, 0x2E, 0xB3, 0xE0, 0x37,
+        0x48, 0x49, 0x76, 0xC2, 0x1F, 0x42, 0xFE, 0x44, 0x65, 0x98, 0xA8, 0x64,
+        0x4B, 0x3C, 0x6C, 0xB9, 0x0B, 0xBC, 0x62, 0x7A, 0x87, 0x3C, 0x2E, 0xFA,
+        0x72, 0x62, 0xE3, 0x9B, 0xF9, 0xFA, 0x88, 0xF6, 0xF5, 0xA7, 0x4D, 0xB5,
+        0xD3, 0x16, 0xBE, 0x3E, 0xAB, 0xE1, 0xB5, 0xE6, 0x2D, 0xB8, 0xCC, 0xBB,
+        0x86, 0xE1, 0xBA, 0x88, 0xCF, 0x98, 0x78, 0xC5, 0x90, 0xB5, 0x56, 0xEC,
+        0xB6, 0xBF, 0x4C, 0x50, 0x73, 0xF6, 0x6F, 0xD9, 0x37, 0xF8, 0xEB, 0xEF,
+        0x86, 0xB9, 0x6D, 0xFE, 0x01, 0x2F, 0x23, 0xD2, 0x4D, 0xC0, 0x1C, 0x2D,
+        0xED, 0x26, 0xCB, 0x8C, 0x97, 0x11, 0x03, 0x7C, 0x5A, 0x79, 0x02, 0x97,
+        0x56, 0x5B, 0x4B, 0x21, 0x8B, 0xA7, 0x2F, 0x09, 0x8E, 0xA8, 0xF4, 0x1B,
+        0x81, 0xAC, 0x0E, 0xA7, 0xFB, 0xA5, 0x3D, 0x25, 0x87, 0x46, 0x3F, 0x59,
+        0xBD, 0x1D, 0x8F, 0x23, 0xAE, 0x7A, 0x6A, 0xD1, 0x59, 0x10, 0x4E, 0xFC,
+        0x7F, 0xDE, 0x82, 0x32, 0xCD, 0x9E, 0xD5, 0xBB, 0x4A, 0x88, 0x6E, 0x2B,
+        0xF3, 0x58, 0x24, 0xA3, 0x24, 0x23, 0x62, 0x39, 0xCA, 0xB5, 0xDE, 0x59,
+        0xB1, 0xE4, 0x82, 0x9E, 0x06, 0x55, 0x40, 0x0A, 0x7E, 0x97, 0xC4, 0xBB,
+        0x00, 0x5F, 0x08, 0x4E, 0xB8, 0x5B, 0xBA, 0xE1, 0x8E, 0x00, 0x43, 0x88,
+        0x29, 0xF9, 0x85, 0xEE, 0xD7, 0x45, 0xA9, 0x52, 0x53, 0x63, 0x90, 0xD6,
+        0x72, 0x5F, 0x69, 0xE7, 0xE9, 0x9A, 0x66, 0xFC, 0xF6, 0x8B, 0x14, 0x75,
+        0x2D, 0x0F, 0x99, 0x5A, 0xA2, 0x2E, 0xA5, 0xB3, 0x91, 0xD2, 0x54, 0x0A,
+        0xB2, 0xDF, 0x6F, 0x26, 0x21, 0xB0, 0x8A, 0x43, 0xC4, 0x17, 0xE2, 0x9D,
+        0x9D, 0x4D, 0xAE, 0xFB, 0x33, 0x86, 0xA9, 0x92, 0xC5, 0x15, 0xA2, 0x30,
+        0xA6, 0x2D, 0xF4, 0x00, 0x05, 0xD4, 0x34, 0x24, 0xD5, 0xA4, 0x35, 0xD1,
+        0x8B, 0x31, 0x68, 0x2C, 0x9A, 0x71, 0x52, 0x28, 0xF6, 0xB3, 0xC9, 0x90,
+        0xAC, 0x9B, 0xDC, 0x22, 0x83, 0x8E, 0xAB, 0x4C, 0x85, 0x87, 0x80, 0x34,
+        0x89, 0x2C, 0x29, 0xFE, 0x2A, 0x2A, 0xDC, 0x75, 0xA5, 0x68, 0x0E, 0x36,
+        0x68, 0xDA, 0xEF, 0x52, 0x80, 0x68, 0xF9, 0x2A, 0x5B, 0x4C, 0x86, 0x13,
+        0x16, 0x9E, 0xE7, 0x3B, 0x49, 0xBC, 0x0F, 0x14, 0xCF, 0x73, 0xAD, 0xEC,
+        0x5E, 0x7F, 0x73, 0x30, 0xA8, 0x39, 0x45, 0xD8, 0x55, 0x03, 0xB0, 0xF7,
+        0x82, 0xD5, 0x89, 0x4D, 0x2A, 0x69, 0x2D, 0x0C, 0x42, 0x25, 0x16, 0x86,
+        0x1A, 0x3D, 0x00, 0x44, 0x8D, 0x3C, 0xF9, 0xCE, 0x48, 0xDD, 0xF4, 0x44,
+        0x7A, 0xD0, 0x0B, 0x0E, 0x35, 0xA0, 0xD2, 0xD8, 0x09, 0xE3, 0xE5, 0xD7,
+        0xC2, 0xA3, 0x7D, 0x0B, 0xCF, 0x78, 0x64, 0x46, 0xFD, 0x83, 0x84, 0x86,
+        0x49, 0xB4, 0x17, 0x34, 0x41, 0x24, 0x4A, 0x43, 0xD9, 0x96, 0x42, 0xBC,
+        0x3A, 0x45, 0x7D, 0x9F, 0x60, 0x02, 0x19, 0xD5, 0x9C, 0x70, 0xA5, 0x82,
+        0x4C, 0xC1, 0x5F, 0x07, 0xE1, 0xC0, 0xC8, 0xCE, 0x76, 0x09, 0x6C, 0xB4,
+        0x85, 0xB3, 0x82, 0xCD, 0xB2, 0x91, 0xE9, 0x1C, 0xBB, 0x48, 0x8C, 0xC8,
+        0x14, 0x68, 0x59, 0xB6, 0x14, 0x98, 0xB1, 0x7A, 0x29, 0xCD, 0xD3, 0x4F,
+        0x7B, 0x65, 0xB6, 0x9D, 0x16, 0x2B, 0x1B, 0x72, 0x12, 0xD3, 0x06, 0xEA,
+        0x34, 0xA9, 0x5C, 0x2C, 0xE0, 0x40, 0x11, 0xFD, 0x40, 0xF5, 0xC4, 0x94,
+        0x4E, 0x7F, 0xF8, 0x67, 0x70, 0xBF, 0x15, 0xD3, 0x87, 0x7F, 0xE2, 0x0D,
+        0x5E, 0x1B, 0x28, 0xC2, 0x24, 0x56, 0xDA, 0xDA, 0x18, 0xFE, 0x2A, 0x4A,
+        0xB2, 0x9E, 0xC7, 0x87, 0x15, 0x35, 0x04, 0xB5, 0x80, 0x7E, 0x39, 0x4A,
+        0x3E, 0xCD, 0x8C, 0x0A, 0x33, 0x64, 0x48, 0x70, 0x45, 0xE4, 0xDE, 0xB8,
+        0x22, 0xC2, 0x64, 0xB6, 0x65, 0xE4, 0x06, 0xE8, 0xF4, 0xC1, 0x4D, 0x07,
+        0x41, 0xEC, 0x92, 0xBF, 0xF6, 0x69, 0xA9, 0xF7, 0xFB, 0xA4, 0x22, 0x35,
+        0x01, 0x9E, 0xF1, 0x31, 0x46, 0x8B, 0xFC, 0x61, 0xDA, 0x22, 0x29, 0x70,
+        0x54, 0x9A, 0x5C, 0x37, 0xB2, 0x69, 0x3D, 0x31, 0x72, 0x57, 0x4A, 0xB0,
+        0x4C, 0xAB, 0xAA, 0x82, 0x5D, 0x63, 0x9F, 0x27, 0xC1, 0x5A, 0x12, 0x69,
+        0xDB, 0x71, 0x11, 0xE5, 0x72, 0x93, 0x87, 0x3E, 0x69, 0xAB, 0x57, 0x6A,
+        0xE5, 0xEE, 0x79, 0xAD, 0x84, 0xA7, 0x4B, 0xE3, 0x34, 0x92, 0xAD, 0x2D,
+        0x51, 0xCF, 0x9D, 0x88, 0x7A, 0x04, 0xA5, 0x26, 0x9C, 0x6A, 0x4B, 0xF9,
+        0x1E, 0x3A, 0x69, 0x55, 0x05, 0x2D, 0x4C, 0xA0, 0xCB, 0xD9, 0x73, 0x4D,
+        0x8E, 0x28, 0xBB, 0xAA, 0x13, 0x5D, 0x0C, 0x80, 0xB9, 0xC7, 0xB4, 0x61,
+        0x3E, 0x4D, 0x68, 0x92, 0xDA, 0x2F, 0xBA, 0x3B, 0x47, 0x08, 0xA4, 0x6B,
+        0xE4, 0x9E, 0x07, 0x9C, 0x2B, 0xBC, 0xC9, 0xB9, 0x01, 0xCF, 0xE1, 0x67,
+        0x3F, 0x69, 0xFB, 0x67, 0x55, 0x1F, 0xDE, 0x9E, 0x86, 0x62, 0x37, 0x3B,
+        0xB3, 0xCE, 0x63, 0x0B, 0x73, 0xD8, 0xC0, 0xC7, 0x11, 0x74, 0x0C, 0xC1,
+        0x54, 0x51, 0x83, 0x73, 0xFB, 0x1E, 0x26, 0x58, 0x24, 0xB1, 0x1F, 0xCF,
+        0x40, 0x98, 0x2A, 0xCD, 0x98, 0x56, 0x80, 0xED, 0x1C, 0x69, 0x03, 0x6F,
+        0x13, 0xC9, 0xC5, 0x83, 0xA7, 0x8A, 0x11, 0x3E, 0x2F, 0x41, 0x97, 0xE4,
+        0x96, 0x04, 0x43, 0xD0, 0x38, 0x9D, 0x22, 0x52, 0x29, 0xAD, 0x09, 0xB5,
+        0x68, 0x8C, 0x6A, 0x85, 0xA0, 0x9B, 0x3B, 0x0D, 0x8B, 0xE2, 0x26, 0x81,
+        0xC1, 0xC4, 0x34, 0xF5, 0xFC, 0x17, 0x05, 0x01, 0xD5, 0x01, 0x42, 0xD9,
+        0xFD, 0xDA, 0x93, 0x88, 0xC3, 0xB2, 0x6B, 0xB8, 0xE9, 0x70, 0x24, 0xA5,
+        0x97, 0xE2, 0x2C, 0x08, 0x00, 0xDB, 0x75, 0x98, 0x5F, 0x7C, 0x8A, 0xBB,
+        0x7E, 0xE8, 0x11, 0xC5, 0x26, 0xF2, 0xEB, 0xC8, 0x30, 0x5F, 0xDB, 0x17,
+        0xF9, 0x1B, 0xD1, 0xEE, 0xDC, 0x72, 0x10, 0xA8, 0xD8, 0xE4, 0xCE, 0x38,
+        0x80, 0x77, 0x82, 0x5E, 0xE5, 0xFB, 0x2C, 0x9B, 0x5D, 0xB6, 0xCD, 0xBF,
+        0x53, 0x50, 0x59, 0x90, 0x9B, 0x46, 0x69, 0xEC, 0x6E, 0xF7, 0x05, 0xD9,
+        0x33, 0x01, 0xE7, 0x7F, 0xCB, 0xE8, 0xC2, 0x26, 0x0B, 0xD3, 0x68, 0x54,
+        0xA9, 0x83, 0xB2, 0x69, 0x2A, 0xCC, 0xBE, 0xC7, 0x8D, 0x76, 0xCB, 0xA9,
+        0xBA, 0x86, 0x1D, 0x63, 0xB0, 0x08, 0x75, 0x8D, 0x1E, 0x5A, 0x10, 0x86,
+        0x37, 0xA7, 0x67, 0x74, 0x71, 0x61, 0x0C, 0xA6, 0x18, 0x12, 0xE0, 0x7F,
+        0xD7, 0xE0, 0x70, 0x51, 0x47, 0xE8, 0x8C, 0x60, 0x62, 0x7A, 0x91, 0x1A,
+        0x32, 0x6E, 0xE2, 0x42, 0xDC, 0xA0, 0x7A, 0xC1, 0xFF, 0x8E, 0x18, 0x03,
+        0xB1, 0xDA, 0x45, 0x95, 0xB7, 0xF0, 0x99, 0xBE, 0xE3, 0x0C, 0x09, 0x58,
+        0xD6, 0x6F, 0xE5, 0xD9, 0xA6, 0x93, 0x85, 0xC7, 0xFD, 0x36, 0xF6, 0x7F,
+        0x41, 0x65, 0x9E, 0xFF, 0xE5, 0x86, 0xA3, 0x2C, 0x83, 0x66, 0xC6, 0x0C,
+        0x9B, 0xAA, 0x46, 0xC6, 0x06, 0x84, 0x93, 0xE8, 0xA5, 0x5C, 0xFB, 0x44,
+        0x72, 0xE5, 0xB7, 0x4A, 0xA7, 0xCD, 0xAF, 0x65, 0xF5, 0x5F, 0x6C, 0xA2,
+        0x24, 0x52, 0xFB, 0x47, 0x0A, 0x19, 0x89, 0x78, 0x43, 0xC0, 0x2C, 0xA6,
+        0x66, 0x68, 0x6E, 0x04, 0x12, 0x22, 0x40, 0x6C, 0xD1, 0x9D, 0x58, 0x00,
+        0x01, 0x59, 0x8A, 0x20, 0xDC, 0x51, 0x22, 0x53, 0x4E, 0xA7, 0x46, 0x9C,
+        0xBD, 0x69, 0x1F, 0xEC, 0x8D, 0xF8, 0x70, 0xF4, 0x14, 0xFC, 0x9F, 0x4A,
+        0x8C, 0x1A, 0x4D, 0x78, 0xC4, 0x06, 0x94, 0x2C, 0xD2, 0x02, 0xC9, 0x20,
+        0xBB, 0x9C, 0x3C, 0xFE, 0x17, 0x06, 0x8D, 0xFD, 0xA4, 0xB3, 0x52, 0xFC,
+        0x40, 0x37, 0x29, 0x04, 0x2C, 0x04, 0x45, 0x6D, 0xAB, 0xA9, 0xE0, 0xE5,
+        0x74, 0xBA, 0x2F, 0x21, 0xEE, 0x11, 0x1B, 0x48, 0x67, 0x43, 0x41, 0x6F,
+        0xE9, 0xB3, 0x73, 0xD1, 0x4D, 0xB3, 0x02, 0xD3, 0xD8, 0x81, 0xFE, 0x4D,
+        0xAB, 0xF2, 0x34, 0xBF, 0x87, 0xE6, 0xE8, 0x9A, 0xF7, 0xB6, 0x09, 0x52,
+        0x6B, 0x80, 0x38, 0x32, 0x35, 0x7C, 0x77, 0x71, 0x94, 0xBD, 0x8D, 0x63,
+        0x8C, 0xF0, 0x9A, 0x6C, 0x29, 0xA7, 0xDD, 0xD6, 0xC5, 0x31, 0x1B, 0xFB,
+        0x23, 0x6D, 0x39, 0xA1, 0x46, 0x1F, 0x4E, 0x13, 0xE5, 0x4F, 0x67, 0xF2,
+        0x70, 0x74, 0x48, 0xA5, 0xA1, 0xB2, 0xAC, 0x93, 0xCA, 0x5B, 0x07, 0x62,
+        0x4E, 0x27, 0xD9, 0xE3, 0x66, 0xFC, 0x65, 0x08, 0x0D, 0x32, 0xA9, 0x93,
+        0x5E, 0xF1, 0xC5, 0x97, 0x25, 0x56, 0xFF, 0x01, 0x45, 0x10, 0xBE, 0x66,
+        0xE2, 0xF1, 0x75, 0x28, 0x98, 0x48, 0xFF, 0xFB, 0x83, 0xB0, 0x9B, 0xB6,
+        0x88, 0x30, 0x68, 0x28, 0x6B, 0x8B, 0x2C, 0x76, 0xCF, 0xAF, 0x65, 0xD1,
+        0x9D, 0x43, 0xA5, 0xE2, 0x9B, 0xC4, 0xEC, 0x43, 0xF9, 0xF5, 0xA0, 0xEF,
+        0x44, 0x7F, 0x1F, 0x25, 0xA2, 0x68, 0xF0, 0xFE, 0x1D, 0xBE, 0xC9, 0xCD,
+        0xBB, 0x28, 0x94, 0x15, 0x57, 0x8A, 0x1F, 0x15, 0x62, 0xA4, 0x32, 0xB3,
+        0x1E, 0x27, 0x33, 0x52, 0xAF, 0x48, 0xED, 0x4D, 0x50, 0xA6, 0x27, 0xDC,
+        0x2C, 0x80, 0x6C, 0xA0, 0x81, 0x39, 0xCF, 0xBE, 0x07, 0x90, 0x83, 0x86,
+        0xE0, 0x26, 0x9F, 0x53, 0x43, 0x90, 0x49, 0x70, 0x08, 0x77, 0x7D, 0xCE,
+        0xDF, 0x00, 0xEE, 0x39, 0x90, 0xE6, 0x63, 0x0E, 0xF5, 0xFD, 0xBA, 0x4B,
+        0xF4, 0xD4, 0x8D, 0x7F, 0xDC, 0xDE, 0xE6, 0x2C, 0x96, 0xFF, 0x91, 0x9C,
+        0xA6, 0x9E, 0x77, 0x06, 0xB6, 0xB5, 0x85, 0x22, 0x13, 0xA6, 0x61, 0x4C,
+        0x82, 0x51, 0x43, 0xB5, 0xB6, 0x3E, 0xC9, 0x97, 0xED, 0xC7, 0x12, 0x1B,
+        0x7C, 0x09, 0xDB, 0x1A, 0xC7, 0x43, 0xB7, 0x9F, 0xA6, 0x60, 0xC4, 0x52,
+        0x1E, 0x16, 0xDE, 0x97, 0x7A, 0x73, 0xFE, 0xFC, 0x0A, 0x12, 0x05, 0x57,
+        0xAF, 0xE3, 0x7E, 0xD8, 0x4E, 0xCF, 0xE5, 0x17, 0x5B, 0xEC, 0x34, 0x74,
+        0xA8, 0x95, 0xA8, 0xA9, 0x8D, 0x61, 0x67, 0x96, 0x4F, 0xDF, 0xAA, 0xE2,
+        0xBA, 0x83, 0xB9, 0x27, 0xB0, 0x22, 0x71, 0xC3, 0x69, 0x4C, 0xA4, 0x42,
+        0x88, 0xA4, 0x6A, 0xB8, 0x8E, 0xB1, 0x57, 0x36, 0x12, 0x5F, 0x68, 0xFF,
+        0x5B, 0xDA, 0xEB, 0x92, 0x3A, 0x95, 0x2E, 0x66, 0x6C, 0x86, 0xCF, 0x9D,
+        0xE5, 0x45, 0xAF, 0xB9, 0x04, 0xF4, 0x2B, 0x26, 0x3F, 0x34, 0x17, 0xF3,
+        0x3A, 0xB6, 0xA0, 0x4C, 0x4C, 0x72, 0x3C, 0x96, 0x70, 0xD1, 0x76, 0x1F,
+        0x72, 0x00, 0xF9, 0x91, 0x45, 0x14, 0x5A, 0x38, 0x61, 0x15, 0xCA, 0x47,
+        0x16, 0xCA, 0xF8, 0x99, 0xCF, 0x6A, 0x45, 0x7D, 0x8E, 0x29, 0xC7, 0x43,
+        0xEC, 0xB0, 0x66, 0x7A, 0xD4, 0xE6, 0x95, 0xA0, 0x1C, 0xD7, 0x8E, 0xB5,
+        0x1C, 0xA5, 0x11, 0xD8, 0xEA, 0x92, 0x55, 0xEF, 0xFF, 0xC6, 0x1C, 0x63,
+        0x95, 0xF6, 0x84, 0xC5, 0x6C, 0x71, 0x17, 0xA3, 0x2E, 0x90, 0x01, 0x5E,
+        0xAE, 0x44, 0x67, 0xE7, 0x8A, 0x9E, 0xB3, 0xCA, 0x62, 0x4A, 0x7A, 0xA9,
+        0x4B, 0x28, 0x6B, 0xB8, 0xCA, 0xD3, 0xB3, 0x9C, 0x9F, 0xD8, 0x02, 0x0C,
+        0x00, 0x6B, 0xF0, 0x40, 0xD0, 0xAC, 0x62, 0x0B, 0xBA, 0x13, 0x1E, 0x38,
+        0x64, 0xA9, 0x60, 0x3A, 0xC4, 0x39, 0xDF, 0x02, 0xA3, 0x8F, 0x4B, 0x24,
+        0x71, 0xF1, 0xB6, 0x06, 0xD8, 0x3E, 0xA5, 0x55, 0x59, 0x3A, 0xE5, 0x70,
+        0xD1, 0x75, 0x76, 0xE5, 0x99, 0xAD, 0x39, 0x44, 0x48, 0xBE, 0xD8, 0x06,
+        0xBE, 0x1D, 0x17, 0x71, 0x86, 0xCF, 0x19, 0x59, 0x72, 0x3D, 0x13, 0x2C,
+        0x35, 0xAB, 0x6E, 0x1D, 0xEF, 0xD5, 0x2A, 0xF3, 0x44, 0xDD, 0xA3, 0x1F,
+        0xCC, 0xEC, 0x9B, 0xA0, 0xA2, 0x9E, 0x92, 0xA8, 0xD5, 0x19, 0x93, 0x68,
+        0x7F, 0x97, 0x27, 0xE2, 0x68, 0x2A, 0x38, 0xD2, 0xA7, 0x0B, 0xF0, 0x87,
+        0x27, 0xB8, 0xC1, 0x63, 0xFA, 0xAC, 0x64, 0x32, 0x9A, 0x60, 0x75, 0xE6,
+        0x4D, 0x17, 0x8B, 0x59, 0x29, 0x3A, 0xE6, 0x3F, 0xDA, 0x8E, 0x93, 0x26,
+        0x84, 0x10, 0x6C, 0x52, 0x54, 0xB3, 0xB0, 0x8A, 0xDF, 0x07, 0xFD, 0x7E,
+        0xC0, 0xF7, 0x18, 0xFF, 0x99, 0x25, 0x40, 0xC4, 0x23, 0x7A, 0xB8, 0xE0,
+        0x19, 0x80, 0x4C, 0x90, 0xA7, 0xAE, 0xB0, 0x59, 0xD7, 0xEE, 0xAB, 0x34,
+        0x8F, 0xFD, 0xDF, 0x0F, 0xFE, 0x5D, 0xA3, 0xB2, 0x65, 0xC5, 0xF1, 0xBB,
+        0x95, 0x70, 0x8A, 0xAE, 0xD7, 0x20, 0x78, 0xD7, 0xDA, 0x86, 0x58, 0x0B,
+        0x2D, 0xDC, 0x4B, 0x31, 0x89, 0xB1, 0x81, 0x30, 0xBE, 0xD4, 0x5C, 0x85,
+        0x33, 0xB8, 0x31, 0x79, 0xB3, 0x04, 0x10, 0x74, 0x2F, 0x0A, 0x78, 0xBE,
+        0x3C, 0x33, 0xB7, 0x39, 0x85, 0x11, 0xC3, 0x70, 0x74, 0x95, 0x5C, 0xF2,
+        0x71, 0xE9, 0xD7, 0x11, 0xC6, 0xE4, 0x14, 0x94, 0x1B, 0x4E, 0x0B, 0xBB,
+        0x7D, 0xA7, 0x65, 0x2C, 0xEA, 0xCD, 0x7E, 0x1D, 0x4B, 0x71, 0x7B, 0x78,
+        0xC6, 0xAB, 0xC4, 0xF4, 0x4A, 0x5B, 0x05, 0x39, 0x53, 0x76, 0x34, 0xF1,
+        0xAF, 0xAD, 0x58, 0xEE, 0x47, 0xCC, 0x90, 0x94, 0xDC, 0xD8, 0xD9, 0x91,
+        0x63, 0x4A, 0xCD, 0x40, 0x98, 0xE8, 0xC7, 0xE0, 0x97, 0x2F, 0x91, 0x62,
+        0x5A, 0xD5, 0xFC, 0xD9, 0x15, 0xC4, 0xFB, 0xFB, 0xD0, 0xE0, 0x1C, 0xB9,
+        0xAE, 0x1E, 0x76, 0xA5, 0xB5, 0xE2, 0x19, 0xBC, 0x08, 0xA5, 0xD8, 0x25,
+        0xE4, 0x19, 0x9B, 0xB0, 0x0A, 0x35, 0x22, 0xD7, 0xE3, 0x44, 0xCB, 0x0C,
+        0xD0, 0x78, 0xCB, 0x16, 0xC3, 0xAA, 0xCF, 0x7C, 0x6A, 0xF1, 0xAB, 0xE3,
+        0xCA, 0xC4, 0x11, 0xA0, 0xE3, 0x73, 0x33, 0x8C, 0xBE, 0x9C, 0x1F, 0x7A,
+        0x6A, 0x0E, 0xC4, 0xB6, 0x98, 0x4F, 0x03, 0xEE, 0x93, 0x63, 0x52, 0x10,
+        0xF7, 0xC7, 0x64, 0xB4, 0x45, 0x6D, 0xF0, 0x70, 0xF2, 0x41, 0xB3, 0x86,
+        0x0C, 0x28, 0x41, 0x77, 0x89, 0xA5, 0x3B, 0xB2, 0xF8, 0x18, 0xF0, 0x58,
+        0x16, 0x65, 0xBA, 0x2E, 0xD6, 0xFF, 0xB9, 0xB3, 0x73, 0xCA, 0x05, 0x9C,
+        0xAE, 0x41, 0xA9, 0x46, 0xCE, 0x61, 0xC4, 0xA4, 0x58, 0x24, 0xE2, 0xA0,
+        0x7D, 0x6C, 0x48, 0x35, 0xEB, 0x70, 0xA4, 0xD4, 0x78, 0x6F, 0x4B, 0x0E,
+        0xAA, 0xEF, 0xEA, 0x33, 0xC7, 0xA2, 0xE3, 0x8D, 0xE5, 0xBE, 0xA5, 0xCC,
+        0x39, 0xC8, 0x75, 0xAA, 0x33, 0x4A, 0xED, 0xE9, 0x6D, 0xC2, 0x56, 0x17,
+        0x97, 0xF1, 0xF9, 0x6A, 0xF2, 0xA0, 0xE6, 0x5E, 0xDC, 0x2D, 0x2B, 0xB0,
+        0x1B, 0x36, 0x13, 0x38, 0x41, 0xB8, 0x29, 0xE6, 0x44, 0x49, 0x65, 0x34,
+        0x29, 0x89, 0x39, 0x30, 0xD9, 0x71, 0x16, 0x44, 0xD6, 0x42, 0x20, 0xE3,
+        0x8E, 0x0A, 0xC5, 0xCA, 0x4B, 0x17, 0x38, 0x8D, 0x95, 0xA4, 0xFE, 0x43,
+        0x70, 0x22, 0x1C, 0xCD, 0xE8, 0x41, 0x3A, 0x36, 0x6F, 0xA8, 0xCE, 0x2A,
+        0xE7, 0xA5, 0xE5, 0x5B, 0x2A, 0x1D, 0xB7, 0xEB, 0xF1, 0xC4, 0xCB, 0x65,
+        0x37, 0x15, 0xF3, 0xAF, 0xF9, 0x3F, 0x71, 0x6D, 0xD7, 0xFD, 0x2B, 0xF9,
+        0xA1, 0x68, 0xBC, 0x19, 0x8F, 0x7B, 0x20, 0xFE, 0xD8, 0x9C, 0x01
+};
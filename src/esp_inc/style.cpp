@@ -1,841 +1,853 @@
 /*****************************************************************************
  ***                        DO NOT EDIT THIS FILE !                        ***
  *****************************************************************************
- * This file is generated by build.py for version 0.50b at 08.09.2023 20:02:36
+ * This file is generated by build.py for version 0.54b at 19.10.2026 12:54:01
  */
 #include "hub/portal.h"
 
-const size_t gyverhub::portal::style_size = 9971;
+const size_t gyverhub::portal::style_size = 9977;
+const char gyverhub::portal::style_etag[] = "\"324e88da\"";
+const char gyverhub::portal::style_head[] PROGMEM =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/css\r\n"
+        "Content-Encoding: gzip\r\n"
+        "Content-Length: 9977\r\n"
+        "Vary: Accept-Encoding\r\n"
+        "ETag: \"324e88da\"\r\n"
+        "Cache-Control: " GHC_PORTAL_CACHE "\r\n"
+        GHI_HTTP_CORS
+        "\r\n";
 const uint8_t gyverhub::portal::style[] PROGMEM = {
-        0x1F, 0x8B, 0x08, 0x08, 0xAC, 0x53, 0xFB, 0x64, 0x02, 0xFF, 0x73, 0x74,
-        0x79, 0x6C, 0x65, 0x2E, 0x63, 0x73, 0x73, 0x00, 0xED, 0x7C, 0x67, 0x93,
-        0xE2, 0x4A, 0xB6, 0xE0, 0xF7, 0x89, 0x98, 0xFF, 0xC0, 0xEB, 0x8E, 0x89,
-        0xDB, 0x35, 0x14, 0x85, 0x2C, 0x02, 0xEA, 0xDD, 0x1B, 0x23, 0xBC, 0xF7,
-        0xFE, 0xC5, 0x8B, 0x0A, 0x59, 0x10, 0xC8, 0x21, 0x09, 0x04, 0xD4, 0xD6,
-        0x87, 0xFD, 0x89, 0xFB, 0x8F, 0x36, 0x33, 0x25, 0x81, 0x10, 0x82, 0xAA,
-        0xBE, 0x66, 0x77, 0x63, 0x63, 0xAA, 0xBB, 0xAB, 0x65, 0xD2, 0x9C, 0x3C,
-        0xE7, 0xE4, 0xF1, 0xA9, 0x7F, 0xC9, 0x86, 0xEE, 0xA4, 0x64, 0x4E, 0x90,
-        0xDE, 0xFD, 0x2B, 0x4D, 0x51, 0x8F, 0xF9, 0x6F, 0x15, 0x70, 0x93, 0x60,
-        0x5D, 0xC9, 0x36, 0x34, 0x29, 0x41, 0x27, 0x2A, 0x96, 0x24, 0x7D, 0x7B,
-        0x45, 0x2D, 0x6C, 0xE7, 0xA8, 0x4A, 0x79, 0xDD, 0xB0, 0x34, 0x4E, 0xF5,
-        0x9E, 0xB8, 0x92, 0xB2, 0x5C, 0x39, 0xF9, 0x1C, 0x86, 0x79, 0xF7, 0xA2,
-        0x62, 0x9B, 0x2A, 0x77, 0xCC, 0xF3, 0xAA, 0x21, 0x6C, 0x5E, 0x6D, 0x4B,
-        0xC8, 0xEF, 0x2C, 0xF5, 0x87, 0xC8, 0x39, 0x5C, 0x1E, 0xBE, 0x4F, 0xBB,
-        0x86, 0x2C, 0x13, 0xAF, 0xC2, 0x8A, 0xB3, 0x6C, 0xC9, 0xF9, 0x75, 0xE7,
-        0xC8, 0xA9, 0xEC, 0x2B, 0xCF, 0xD9, 0x52, 0x86, 0x7A, 0x16, 0xB1, 0x5C,
-        0xB5, 0xBD, 0x64, 0x0B, 0x2C, 0xFA, 0x39, 0x6D, 0x58, 0x16, 0x43, 0x57,
-        0xB5, 0x62, 0x1F, 0xFC, 0x3E, 0xB6, 0x59, 0xB6, 0xCC, 0x3E, 0xFA, 0xE9,
-        0x61, 0x8B, 0xEA, 0xA4, 0x8C, 0x09, 0x55, 0xD5, 0xA8, 0xCE, 0xD9, 0x62,
-        0xB9, 0x56, 0x28, 0xD7, 0x8B, 0xDB, 0x82, 0xA1, 0x0D, 0xEC, 0xD6, 0x00,
-        0x8C, 0xDB, 0x59, 0xD6, 0x37, 0x2C, 0x55, 0xAE, 0x17, 0x8A, 0x6C, 0x45,
-        0x51, 0xEC, 0xDA, 0x52, 0xDB, 0xF0, 0xCD, 0x95, 0x38, 0x50, 0x6B, 0x95,
-        0x69, 0x33, 0x5B, 0xEC, 0xB9, 0xB9, 0x15, 0x3D, 0x36, 0x26, 0xCD, 0xC5,
-        0xD8, 0xC6, 0x35, 0xA3, 0x40, 0x0D, 0xF6, 0x9B, 0x34, 0x4D, 0x6C, 0xCB,
-        0x8D, 0x56, 0x3B, 0x3D, 0xCA, 0xED, 0xB7, 0xE9, 0xA1, 0xBA, 0x1C, 0x16,
-        0xA6, 0xEB, 0xC1, 0xF1, 0x34, 0x57, 0x87, 0x8A, 0x55, 0xAD, 0xF5, 0x4A,
-        0xEC, 0x9A, 0x1B, 0x56, 0xED, 0x5A, 0x51, 0x69, 0x17, 0x9D, 0x8D, 0x85,
-        0xB5, 0x73, 0x43, 0x4B, 0xDC, 0x12, 0xC7, 0x6C, 0x73, 0xA9, 0x25, 0xC9,
-        0x64, 0x92, 0xA4, 0x99, 0x4C, 0x6F, 0xD0, 0x68, 0x34, 0x85, 0x64, 0x56,
-        0x32, 0xD4, 0xCD, 0xDA, 0xAC, 0xD8, 0xDB, 0x3E, 0x35, 0x68, 0x1B, 0xBA,
-        0x5A, 0x2F, 0x75, 0xDA, 0xB9, 0xF1, 0x2C, 0xBB, 0xC9, 0xF6, 0x17, 0x8E,
-        0xB3, 0xEC, 0x3B, 0x47, 0x3E, 0x29, 0xEF, 0x9B, 0x9A, 0x3D, 0x6C, 0x32,
-        0x85, 0x74, 0x79, 0x61, 0x4F, 0x1B, 0x2D, 0xDC, 0xD5, 0xD7, 0xC3, 0x9C,
-        0x3A, 0xE9, 0xF3, 0x7D, 0x3B, 0x49, 0x0D, 0xE5, 0x7A, 0xA3, 0x2C, 0x5A,
-        0xA6, 0x4D, 0xAA, 0x69, 0x6A, 0xB7, 0xDC, 0x6A, 0xCB, 0xE6, 0x61, 0x59,
-        0xE6, 0x67, 0xD3, 0x36, 0x51, 0xCE, 0x59, 0x8B, 0x7D, 0x9F, 0x5C, 0xF6,
-        0x25, 0x6A, 0xC0, 0xA4, 0x1B, 0xE3, 0x79, 0xAB, 0x38, 0xE9, 0xCC, 0x9B,
-        0xF5, 0xD9, 0x7C, 0xDA, 0xB0, 0xE4, 0xC2, 0x24, 0xAD, 0x4D, 0x72, 0x26,
-        0xC7, 0x34, 0xB1, 0x8E, 0x7E, 0x2C, 0xD8, 0xB4, 0x89, 0x1D, 0x0A, 0xC2,
-        0xCA, 0xE9, 0x4D, 0x9D, 0xA3, 0x3D, 0x1C, 0x1B, 0x6B, 0xB6, 0x51, 0xE8,
-        0x31, 0xBC, 0x0B, 0x90, 0xB8, 0x64, 0xE5, 0xBD, 0xAC, 0x09, 0xB5, 0x65,
-        0x69, 0xC9, 0xE6, 0x30, 0x8A, 0x65, 0x0B, 0xD9, 0x74, 0x6B, 0xA9, 0x96,
-        0x0F, 0x00, 0xFB, 0xF3, 0x42, 0x95, 0x2D, 0x2C, 0x57, 0x35, 0x96, 0x2E,
-        0xD5, 0x8B, 0xEC, 0xA6, 0x3E, 0x3F, 0xD6, 0x8B, 0xC5, 0xBA, 0xB6, 0x5A,
-        0x54, 0x07, 0x7D, 0xA1, 0x51, 0x76, 0x37, 0xC3, 0xC6, 0x72, 0x33, 0x68,
-        0x2D, 0x37, 0xDA, 0xB4, 0x54, 0xAD, 0x6E, 0x5C, 0x40, 0xC9, 0x36, 0x5B,
-        0x28, 0xCB, 0xF5, 0x5A, 0x8F, 0x5D, 0xEA, 0xFD, 0xEE, 0xAE, 0xCE, 0x1A,
-        0x45, 0x4B, 0x48, 0x9A, 0xF6, 0xD4, 0x26, 0x96, 0x7A, 0xC3, 0x75, 0xDC,
-        0xDA, 0x56, 0x4F, 0x6E, 0xDB, 0xF5, 0xCE, 0xE6, 0x58, 0xB3, 0x9D, 0x43,
-        0x0B, 0xCB, 0xB6, 0xE7, 0xAD, 0xD1, 0xC8, 0xED, 0x4D, 0xD6, 0xF4, 0xB4,
-        0xBF, 0xEF, 0x19, 0xD3, 0x65, 0x61, 0x59, 0x67, 0x2D, 0x72, 0x32, 0xAE,
-        0x67, 0x3A, 0xBC, 0x59, 0xCE, 0xE4, 0x04, 0x3D, 0xCD, 0x62, 0xF3, 0x36,
-        0xBB, 0x5E, 0x4D, 0x86, 0xEE, 0xB8, 0x8A, 0x19, 0x1D, 0x7B, 0x58, 0xB1,
-        0xB8, 0x9A, 0x5C, 0xAF, 0x26, 0x8D, 0xFA, 0x7A, 0xBE, 0xE8, 0xAE, 0xF0,
-        0x45, 0x69, 0x4D, 0x0D, 0xA5, 0xA9, 0x90, 0x9B, 0x93, 0x4C, 0x27, 0xC9,
-        0xED, 0x09, 0x26, 0x37, 0xCA, 0xA5, 0x67, 0xFB, 0x34, 0x9D, 0xC3, 0x93,
-        0x9A, 0xAC, 0xEA, 0x39, 0x5A, 0xA8, 0xC9, 0xC3, 0xF5, 0x9C, 0xE8, 0x56,
-        0x04, 0x0D, 0x37, 0x8D, 0xE9, 0xAE, 0xA7, 0xE9, 0x1D, 0x85, 0x65, 0x33,
-        0x5C, 0x1A, 0x6B, 0xF6, 0x4B, 0x66, 0x6D, 0x5E, 0xC2, 0xA6, 0xBA, 0xD9,
-        0xED, 0x2A, 0x3A, 0x3E, 0xDC, 0x92, 0x43, 0x7E, 0xD1, 0xC0, 0x8F, 0xFD,
-        0xEE, 0xB0, 0x30, 0x57, 0xA7, 0x1B, 0xC5, 0x92, 0x5A, 0x6D, 0x6A, 0x3C,
-        0x1B, 0x5A, 0xDB, 0xF2, 0x48, 0x37, 0x47, 0x6E, 0xB9, 0x80, 0x01, 0xDE,
-        0x9C, 0xF7, 0xB0, 0x0A, 0x4B, 0x3B, 0x6C, 0x69, 0xB5, 0x55, 0xB3, 0x83,
-        0x41, 0xDA, 0x66, 0x27, 0xE5, 0xA9, 0xB6, 0x1D, 0xB0, 0x93, 0x01, 0xEF,
-        0xDA, 0x9D, 0xBE, 0xDA, 0x2A, 0xCA, 0x35, 0x99, 0xA6, 0xCB, 0x6D, 0xB1,
-        0xB0, 0x10, 0xD4, 0xDC, 0xAC, 0x58, 0xD1, 0xC9, 0xF4, 0x7C, 0x45, 0xB7,
-        0x27, 0xF5, 0x8C, 0x7E, 0x20, 0xF6, 0x06, 0x5E, 0x70, 0x16, 0xD9, 0xCE,
-        0x8C, 0xD5, 0x5B, 0xDB, 0x03, 0x3B, 0xEE, 0x5B, 0xCB, 0xB1, 0xD5, 0x50,
-        0xBA, 0xD4, 0x68, 0xAD, 0xED, 0x56, 0xD5, 0xA3, 0x3A, 0x4A, 0x6F, 0x15,
-        0xA3, 0x71, 0xC8, 0x09, 0xDB, 0xB6, 0x3B, 0x29, 0x0C, 0x54, 0xAE, 0x59,
-        0xEE, 0xAF, 0xAB, 0xAB, 0x4A, 0x59, 0x53, 0xC0, 0xD0, 0xAD, 0x89, 0x36,
-        0xD8, 0x18, 0xCD, 0x23, 0x56, 0x2A, 0x4E, 0xF6, 0xC2, 0xD6, 0x1C, 0x8F,
-        0xDD, 0x7A, 0x61, 0x22, 0x88, 0x9B, 0x49, 0x75, 0xDC, 0xCE, 0xF4, 0x5D,
-        0xD5, 0xDD, 0x8B, 0x9D, 0xDA, 0xBA, 0xD6, 0xD5, 0x8D, 0x76, 0xB3, 0xE8,
-        0xEE, 0xC6, 0xEC, 0x5A, 0xD5, 0x79, 0x9A, 0x1A, 0x66, 0x37, 0x69, 0xB0,
-        0x69, 0x57, 0xE3, 0xF9, 0xC1, 0x6C, 0x12, 0x75, 0xDE, 0x95, 0x44, 0xCB,
-        0x95, 0x86, 0x6C, 0x76, 0x53, 0x96, 0xDC, 0x4D, 0x0D, 0x1B, 0x08, 0x9D,
-        0x9C, 0x5B, 0x15, 0x67, 0x7D, 0xA5, 0x5E, 0x58, 0x64, 0xB4, 0xE3, 0x0E,
-        0xDB, 0xB3, 0x76, 0x6E, 0x9E, 0xE9, 0x77, 0xC6, 0x5B, 0x7C, 0xE3, 0x2C,
-        0x4E, 0xCB, 0x62, 0x0D, 0xEB, 0x48, 0x54, 0x7F, 0xD5, 0xED, 0x6A, 0xED,
-        0x02, 0x7D, 0xAA, 0x76, 0x94, 0x4A, 0x1D, 0x9B, 0x8D, 0xB9, 0x01, 0x7F,
-        0xA2, 0x0F, 0x66, 0x2F, 0x53, 0xAB, 0x4A, 0x3B, 0xAA, 0xA9, 0xAF, 0xD6,
-        0xEE, 0x5C, 0x74, 0xF8, 0xCD, 0xAC, 0x68, 0x2B, 0x3C, 0x6F, 0x2C, 0x25,
-        0x7C, 0x59, 0xDE, 0xF4, 0x1C, 0x5C, 0xDC, 0x9C, 0x3A, 0xE2, 0x69, 0x5E,
-        0x6F, 0xBB, 0xFB, 0x45, 0xE5, 0xA4, 0xCF, 0xF0, 0x21, 0xE1, 0xF2, 0x98,
-        0x4A, 0x16, 0xB0, 0xA3, 0xCA, 0x33, 0xED, 0x52, 0xBB, 0xAB, 0x8B, 0x78,
-        0x73, 0x71, 0x10, 0x71, 0xAC, 0xE7, 0x10, 0x47, 0xE5, 0x34, 0xE1, 0x99,
-        0xF9, 0xE9, 0x98, 0x2E, 0x31, 0x99, 0x51, 0x21, 0xDB, 0xED, 0x92, 0xB5,
-        0xDD, 0xBA, 0x4A, 0xB6, 0x70, 0x2A, 0xD3, 0xAF, 0xF4, 0x9A, 0x96, 0x23,
-        0x26, 0x07, 0xD4, 0xF6, 0x38, 0xC3, 0x4F, 0x85, 0x29, 0x55, 0xB7, 0x37,
-        0xA3, 0xC3, 0x66, 0xA7, 0xB5, 0x0F, 0xF5, 0xDA, 0x6E, 0xD1, 0xED, 0x64,
-        0x8F, 0x1C, 0x3B, 0x1D, 0x52, 0x2D, 0xA1, 0x9C, 0x34, 0xAA, 0xFC, 0x7C,
-        0x35, 0x9A, 0x57, 0xB4, 0xE5, 0x92, 0xAC, 0x15, 0x8B, 0xB8, 0x79, 0xC0,
-        0x9A, 0xF6, 0x58, 0x1D, 0x56, 0x88, 0x6A, 0xB3, 0x9A, 0xA6, 0x07, 0xA7,
-        0x3A, 0x27, 0xCE, 0x8B, 0x36, 0xE6, 0x94, 0x16, 0x8B, 0x7E, 0x89, 0x50,
-        0xC5, 0x96, 0x25, 0x74, 0x36, 0x87, 0xF2, 0xB6, 0x58, 0x91, 0xE4, 0x32,
-        0xEE, 0xB0, 0x56, 0x15, 0xDF, 0x12, 0x0C, 0xC5, 0x97, 0x01, 0x2B, 0x2F,
-        0x8D, 0x56, 0xD9, 0x74, 0x07, 0xD8, 0x69, 0x51, 0xAF, 0xB7, 0xA7, 0xC4,
-        0x64, 0x6C, 0x88, 0xDC, 0xA8, 0x60, 0xB8, 0x2A, 0x5F, 0x74, 0x4A, 0x6B,
-        0xA7, 0xD8, 0xB3, 0x0F, 0x2B, 0xB2, 0x6D, 0xB2, 0x04, 0xA1, 0x69, 0x35,
-        0x6B, 0x51, 0x66, 0xFA, 0xAB, 0x15, 0xB5, 0x22, 0x32, 0x94, 0x58, 0x3B,
-        0x15, 0x04, 0xA2, 0x99, 0x69, 0xE6, 0x96, 0x59, 0xB2, 0xC3, 0xC8, 0x99,
-        0x43, 0x76, 0xE5, 0x90, 0xD3, 0x5A, 0xB2, 0xD2, 0x48, 0x1F, 0xAC, 0xEC,
-        0x9E, 0xA9, 0x35, 0x1C, 0xBB, 0xDF, 0xB1, 0x36, 0xD5, 0xEE, 0xA6, 0x93,
-        0x66, 0xCA, 0x6D, 0xD6, 0x5D, 0xE9, 0xC5, 0xF1, 0xB4, 0xAE, 0x27, 0x37,
-        0xDD, 0x3A, 0x35, 0x1A, 0xCD, 0xBB, 0x4A, 0xAB, 0x51, 0x58, 0xA9, 0x1C,
-        0xB5, 0x28, 0xD5, 0x1A, 0x62, 0x9F, 0x00, 0xDD, 0xFA, 0x95, 0xA5, 0x5C,
-        0xAC, 0x0F, 0x55, 0x30, 0x53, 0xA6, 0xA5, 0x54, 0xD3, 0xCE, 0x56, 0xAE,
-        0x8B, 0x82, 0x33, 0xA6, 0x66, 0x24, 0x55, 0x10, 0x84, 0x61, 0x66, 0x70,
-        0x98, 0x6F, 0x4D, 0xB5, 0x31, 0x53, 0x32, 0x15, 0x7D, 0xCD, 0xF5, 0x99,
-        0x85, 0xC6, 0xCB, 0x92, 0xCD, 0x2E, 0x26, 0x75, 0x4D, 0x11, 0xEA, 0xDD,
-        0x8D, 0xD2, 0xB7, 0xF7, 0xC9, 0xC6, 0x6A, 0x7A, 0x2A, 0x8E, 0xB4, 0xE4,
-        0xC8, 0xE4, 0xCA, 0xE3, 0x4E, 0xDF, 0xAC, 0x89, 0x15, 0xD7, 0x39, 0x32,
-        0xBD, 0x03, 0x5E, 0x9D, 0x2E, 0xB3, 0xD4, 0x6A, 0x9F, 0x3E, 0xE6, 0xC4,
-        0xF4, 0x7C, 0xD2, 0xEF, 0x27, 0x8B, 0x6D, 0xBC, 0xC6, 0xCE, 0xB4, 0x6E,
-        0xA1, 0x72, 0xA8, 0x4C, 0x95, 0xEE, 0x82, 0x6E, 0x2F, 0x98, 0x49, 0xBB,
-        0x83, 0x93, 0x46, 0x8B, 0x50, 0x93, 0x4D, 0x9A, 0xA9, 0xE8, 0x8E, 0x5A,
-        0x23, 0xDD, 0xDC, 0x69, 0xC9, 0xD7, 0x87, 0x27, 0xA6, 0xB2, 0x22, 0x6C,
-        0x63, 0x7D, 0xE2, 0x64, 0xA7, 0x7D, 0x50, 0x98, 0x05, 0x67, 0x98, 0x27,
-        0x91, 0xEA, 0x1C, 0xFA, 0xFC, 0x48, 0xCD, 0xA4, 0x93, 0x8B, 0x61, 0xE1,
-        0xE0, 0xCE, 0xAB, 0xA7, 0xDA, 0x58, 0x55, 0x35, 0xC9, 0xCA, 0x18, 0xC4,
-        0x64, 0xA7, 0x11, 0xEB, 0x95, 0x76, 0x3C, 0x4E, 0x37, 0x3B, 0xC2, 0x6D,
-        0x4E, 0xC6, 0xD9, 0xE4, 0x76, 0x40, 0xB5, 0xDB, 0x98, 0x34, 0x3F, 0x6C,
-        0xF0, 0x86, 0xC0, 0xB6, 0xBA, 0xA7, 0x2E, 0x27, 0xAE, 0x78, 0x20, 0xDF,
-        0x3A, 0x8A, 0xB3, 0xE1, 0xB2, 0x49, 0x75, 0x7B, 0x18, 0xED, 0x1B, 0x6A,
-        0x67, 0xB1, 0x5B, 0xCA, 0xA7, 0xE1, 0xB0, 0x5C, 0x48, 0x9A, 0x87, 0xED,
-        0x8E, 0xA4, 0xE6, 0xD9, 0xA6, 0xD4, 0x60, 0x27, 0x2C, 0x46, 0x98, 0x6B,
-        0x31, 0x59, 0xEB, 0xCC, 0x1A, 0xAB, 0xAC, 0x93, 0x5E, 0x37, 0xEC, 0x6E,
-        0xFA, 0xA0, 0x0E, 0x8A, 0x5D, 0xA3, 0xB7, 0x2E, 0xE4, 0x4A, 0x25, 0x9B,
-        0x9B, 0x53, 0x3D, 0x97, 0xC9, 0x10, 0x2E, 0x3B, 0x98, 0xED, 0xDA, 0x38,
-        0x3B, 0xA3, 0x1D, 0x62, 0x33, 0xA6, 0x76, 0x0D, 0x6E, 0x35, 0xEA, 0x65,
-        0x33, 0xEE, 0xA8, 0x5E, 0x1F, 0x90, 0x53, 0x69, 0x9D, 0xAB, 0xE8, 0x75,
-        0xB6, 0xDD, 0xA3, 0x85, 0x6C, 0x96, 0xDF, 0x1D, 0x7A, 0x47, 0x07, 0x5B,
-        0x6E, 0x7B, 0x99, 0x72, 0xAF, 0xD6, 0x31, 0x98, 0x9D, 0x20, 0xA5, 0x69,
-        0x23, 0xB3, 0xAB, 0xD4, 0xD5, 0x81, 0xA6, 0xC8, 0x58, 0x86, 0x69, 0x8C,
-        0x89, 0x96, 0x2E, 0x6D, 0xA4, 0x79, 0xB3, 0xDC, 0xE9, 0x12, 0x0E, 0x83,
-        0x37, 0x6D, 0x8A, 0x9C, 0x65, 0x32, 0xA5, 0xD9, 0xA9, 0x58, 0x57, 0x56,
-        0xFB, 0x89, 0xC1, 0x6F, 0x76, 0xDB, 0x31, 0xD1, 0xAB, 0x16, 0x77, 0xA5,
-        0xA3, 0x85, 0xD7, 0x8B, 0x13, 0x3A, 0xC9, 0xF2, 0x6D, 0x7E, 0xD8, 0xAB,
-        0x77, 0x79, 0xAA, 0xC0, 0x54, 0xF7, 0xF3, 0xF9, 0xAA, 0x51, 0x58, 0x0F,
-        0x28, 0xA2, 0xD2, 0xAC, 0x9A, 0x25, 0x59, 0x1F, 0x1A, 0x58, 0x77, 0xDC,
-        0x29, 0x9B, 0x8B, 0x4D, 0x0E, 0x13, 0x9C, 0x6A, 0x6B, 0xD5, 0x99, 0xD2,
-        0x36, 0x7E, 0xCC, 0x8E, 0x1A, 0xD4, 0xA2, 0x3F, 0x25, 0xC4, 0xE4, 0x7A,
-        0xAE, 0xD8, 0xD3, 0xE1, 0x56, 0xAD, 0xAE, 0xCB, 0xAA, 0xE1, 0xB0, 0xCD,
-        0x8C, 0x34, 0xE3, 0x0F, 0x0A, 0x5F, 0x6F, 0x5B, 0x5D, 0xC2, 0x38, 0x0A,
-        0x39, 0x9E, 0x2A, 0x96, 0x4F, 0xA7, 0x99, 0x53, 0x28, 0x53, 0xBA, 0x36,
-        0xEF, 0x10, 0x58, 0x52, 0x32, 0xAB, 0x4E, 0x65, 0xBD, 0x94, 0xD6, 0xED,
-        0x7A, 0x2B, 0x57, 0xCE, 0x74, 0x8A, 0xD6, 0x61, 0xB7, 0x16, 0x15, 0x43,
-        0x4E, 0x8E, 0x4E, 0x58, 0x67, 0x69, 0x66, 0x17, 0xB5, 0xF9, 0xB2, 0x42,
-        0xF5, 0xAD, 0x1E, 0x85, 0xA5, 0x93, 0x8D, 0xD2, 0x92, 0x76, 0x0E, 0x7C,
-        0x8F, 0x26, 0x1B, 0x07, 0xA7, 0x7A, 0xDC, 0x10, 0x6B, 0x0A, 0x6C, 0x1A,
-        0x53, 0x3C, 0x55, 0xE8, 0xDC, 0x9A, 0x3A, 0x69, 0xE9, 0x6D, 0x83, 0xE3,
-        0xB4, 0x5D, 0xAE, 0x9D, 0x6D, 0xF5, 0x4E, 0x47, 0x7A, 0x56, 0xAF, 0x32,
-        0x83, 0x8A, 0xE1, 0xB6, 0x1A, 0x2D, 0xA5, 0x5B, 0xCC, 0x19, 0xD3, 0x0E,
-        0xBD, 0x3D, 0x96, 0xAA, 0xAB, 0xD6, 0x40, 0x19, 0x35, 0x4F, 0x73, 0x8C,
-        0x27, 0x07, 0x69, 0x0E, 0xCB, 0x9A, 0x8A, 0x20, 0xB9, 0xEA, 0x3E, 0x9D,
-        0xA9, 0x9C, 0x2C, 0x23, 0xC3, 0x24, 0xF7, 0x6C, 0x56, 0x98, 0xE1, 0x7A,
-        0x83, 0x53, 0xE8, 0x55, 0x5B, 0x9F, 0xAD, 0x57, 0xB4, 0x61, 0x6D, 0x8C,
-        0x43, 0x5A, 0x3E, 0xD5, 0x2A, 0xFB, 0xDC, 0x88, 0x62, 0xA4, 0xF4, 0x58,
-        0xDC, 0x02, 0xBB, 0xA2, 0x48, 0x71, 0x47, 0x5B, 0x28, 0x6D, 0xB7, 0x6D,
-        0xB5, 0x6D, 0xA5, 0xC9, 0x92, 0x25, 0xA4, 0x33, 0xE6, 0x62, 0x2F, 0xA5,
-        0x07, 0xB3, 0x1C, 0xDB, 0xC6, 0x88, 0x8A, 0xBB, 0xCB, 0x16, 0xF6, 0xE6,
-        0x71, 0x31, 0x1E, 0x94, 0x19, 0x66, 0x84, 0x91, 0xB3, 0x82, 0xB4, 0x37,
-        0x33, 0x22, 0x97, 0xA3, 0x8F, 0x9B, 0x9C, 0x5C, 0x9B, 0x15, 0xA6, 0xB2,
-        0xDD, 0x75, 0x75, 0x95, 0x6F, 0x14, 0x1A, 0x73, 0xAA, 0x6E, 0xD4, 0x09,
-        0x6E, 0x36, 0xB0, 0xC4, 0xAE, 0xC5, 0x1D, 0xB9, 0xE2, 0x68, 0x4E, 0xC8,
-        0x26, 0xD0, 0xA7, 0xDB, 0x0E, 0x23, 0xCE, 0x97, 0x12, 0xD6, 0xEB, 0xE1,
-        0xB9, 0xE3, 0x41, 0x74, 0xDD, 0xBD, 0xDB, 0xD5, 0xB5, 0x16, 0x5E, 0xAE,
-        0xEA, 0x98, 0xB6, 0x94, 0xCC, 0xC2, 0x9C, 0xA6, 0x55, 0x89, 0xA6, 0xD7,
-        0x84, 0xB8, 0x19, 0xD6, 0xC7, 0x07, 0xCC, 0xDD, 0x6C, 0xE5, 0x35, 0x51,
-        0x1E, 0xA9, 0x4C, 0x43, 0xB1, 0xEB, 0x47, 0x7D, 0x64, 0x33, 0xED, 0x45,
-        0x7A, 0x46, 0x9A, 0xB3, 0xAC, 0x74, 0xDC, 0x69, 0xAB, 0xED, 0xB0, 0x4E,
-        0xF6, 0xAC, 0xF1, 0x21, 0x53, 0x75, 0x0E, 0x99, 0xAD, 0x79, 0x4A, 0x2E,
-        0xF9, 0xDC, 0xD2, 0x2C, 0x2D, 0xB9, 0xA9, 0xAA, 0xB9, 0x47, 0x22, 0xD7,
-        0x18, 0xD6, 0x8B, 0x6B, 0x49, 0xEA, 0xF7, 0x72, 0xCB, 0x59, 0x66, 0x29,
-        0xD0, 0x1D, 0xA9, 0xB3, 0x3C, 0x32, 0xA3, 0x6C, 0xB7, 0xA7, 0x91, 0x99,
-        0x32, 0x96, 0xE9, 0xEC, 0x0E, 0x45, 0x91, 0x17, 0x98, 0x0E, 0xBF, 0xAA,
-        0xE4, 0xA4, 0x6E, 0x2F, 0x33, 0x90, 0xCB, 0x64, 0x52, 0xA8, 0xF4, 0x6B,
-        0x7B, 0xDC, 0x3D, 0xE0, 0xC3, 0x31, 0x23, 0x52, 0x99, 0x7D, 0xE3, 0xA8,
-        0x98, 0xD6, 0x36, 0xD7, 0xED, 0xAA, 0x39, 0xAA, 0xB7, 0xDD, 0x70, 0x23,
-        0x6B, 0xE6, 0x10, 0xF6, 0xE4, 0xC0, 0x30, 0x19, 0x66, 0x40, 0x96, 0x14,
-        0x69, 0x5E, 0x59, 0x8E, 0xC8, 0xCA, 0xA9, 0x83, 0xAD, 0x66, 0x5A, 0x61,
-        0x5C, 0x5A, 0x13, 0x9B, 0x59, 0x27, 0xE3, 0xBA, 0xDC, 0xA9, 0xC7, 0x0F,
-        0xDB, 0x1D, 0xF6, 0x30, 0x90, 0xB3, 0xC7, 0x53, 0xA3, 0x94, 0x26, 0x32,
-        0xA3, 0x64, 0x6F, 0xE7, 0xB0, 0x19, 0x7D, 0xA3, 0x66, 0xA6, 0xAA, 0x51,
-        0x5B, 0x31, 0x74, 0xA1, 0xD2, 0x3D, 0x39, 0x1B, 0x4A, 0x6F, 0xED, 0x8D,
-        0xE2, 0xA6, 0x78, 0x1C, 0xCF, 0xDD, 0xF4, 0x7E, 0x46, 0xD1, 0x8D, 0x8E,
-        0xAB, 0x89, 0xEE, 0x68, 0x2F, 0xC9, 0xB5, 0x72, 0x91, 0x4B, 0x76, 0x2D,
-        0x9C, 0x2D, 0x9B, 0x9A, 0x75, 0x00, 0x9A, 0x42, 0x39, 0x3A, 0xE4, 0xAE,
-        0x99, 0x9D, 0xCC, 0xD9, 0x6E, 0xCB, 0x26, 0x14, 0xAD, 0x78, 0x24, 0xB3,
-        0xC3, 0x26, 0xA5, 0x34, 0x98, 0xF6, 0x52, 0x1B, 0x38, 0x7C, 0x61, 0xD2,
-        0xE8, 0x8D, 0x34, 0xAE, 0xE4, 0x76, 0xC6, 0xDD, 0xA9, 0xC1, 0x99, 0x7C,
-        0x57, 0x5F, 0x91, 0xF3, 0x5A, 0x51, 0xDC, 0x75, 0x65, 0xBD, 0xE6, 0xEE,
-        0x78, 0x6D, 0x69, 0xC8, 0xDD, 0x91, 0x92, 0x5C, 0xB4, 0x2B, 0xBD, 0xA3,
-        0x51, 0xCD, 0xB8, 0xBC, 0xC9, 0x9A, 0xD6, 0x7A, 0x39, 0x33, 0xD5, 0xEC,
-        0x68, 0x48, 0x31, 0x32, 0x2B, 0x8C, 0x67, 0xEA, 0xB4, 0xD7, 0x68, 0x4A,
-        0xF2, 0xA6, 0x75, 0x9A, 0x54, 0x55, 0x7A, 0xD7, 0x18, 0xCA, 0xBB, 0xBD,
-        0x22, 0xCF, 0xF7, 0x8A, 0xD2, 0x91, 0x84, 0x59, 0xB5, 0x22, 0x4B, 0x66,
-        0xA6, 0x58, 0x38, 0x0D, 0xC6, 0xB9, 0xD6, 0xBE, 0x5D, 0x3A, 0x15, 0x7A,
-        0xEB, 0x41, 0xB9, 0x85, 0xE7, 0x6A, 0x8C, 0x9B, 0x34, 0x9A, 0x8E, 0x9A,
-        0xB1, 0xCC, 0x9D, 0x39, 0x24, 0x39, 0x73, 0x7F, 0x52, 0xA7, 0x33, 0x80,
-        0xAD, 0xDA, 0x2E, 0x8D, 0x6F, 0x73, 0x73, 0x51, 0xD7, 0xF8, 0x45, 0x39,
-        0xD7, 0x9C, 0x4D, 0x3B, 0x0E, 0x5D, 0xCD, 0xE4, 0xA4, 0x72, 0x8E, 0x9F,
-        0xA7, 0x9B, 0xF5, 0xD6, 0x42, 0x90, 0x16, 0xF4, 0x7A, 0x4D, 0x8E, 0xDD,
-        0x43, 0x16, 0x10, 0x6E, 0xBC, 0xB1, 0xC8, 0x45, 0xAF, 0xB2, 0xE9, 0xD0,
-        0x6D, 0x7A, 0xAF, 0xD7, 0x08, 0x91, 0x05, 0xBD, 0x77, 0x85, 0xB9, 0x8C,
-        0x71, 0x86, 0xD5, 0xC2, 0xDC, 0xBD, 0xC6, 0x1D, 0xAC, 0x3A, 0xB9, 0x27,
-        0xEB, 0x7A, 0x5A, 0x2C, 0xCD, 0x77, 0x63, 0x8C, 0xDD, 0x37, 0xAD, 0xCD,
-        0x6C, 0xDA, 0xD8, 0x3A, 0xCD, 0xEA, 0xA8, 0x75, 0xCC, 0xA9, 0x45, 0xD5,
-        0x9A, 0x52, 0xC9, 0xEA, 0xBA, 0xB3, 0xD3, 0xD7, 0xAC, 0xE8, 0xEE, 0xB8,
-        0x9A, 0x7D, 0xEA, 0x15, 0x73, 0xF5, 0xCA, 0xCC, 0x28, 0xEA, 0xEB, 0xEE,
-        0xB6, 0x99, 0xE5, 0xD9, 0xDD, 0xFE, 0x70, 0xA2, 0xB6, 0x6B, 0xF6, 0x50,
-        0xDE, 0xCB, 0xDD, 0x65, 0xB3, 0xA4, 0x99, 0x63, 0x31, 0xBD, 0xC3, 0xC8,
-        0xE4, 0x81, 0xDE, 0x6C, 0x19, 0x86, 0x38, 0x34, 0x47, 0xC9, 0x69, 0x9A,
-        0x5E, 0x0E, 0xD3, 0x59, 0x32, 0x8B, 0xA5, 0x7B, 0xF2, 0xA1, 0x2D, 0xF7,
-        0x44, 0xA2, 0x41, 0x59, 0xDB, 0x3D, 0x33, 0x93, 0xB2, 0x5B, 0x3E, 0xB9,
-        0xD9, 0x4B, 0x0D, 0x7C, 0x58, 0x77, 0x35, 0x8A, 0xE0, 0xD6, 0xC9, 0x63,
-        0x7B, 0x2D, 0xDB, 0x47, 0x92, 0x6A, 0x96, 0xA5, 0xE3, 0x84, 0xC5, 0xC7,
-        0x7B, 0x6E, 0xD5, 0x92, 0xF7, 0xD6, 0xB1, 0x3E, 0x35, 0x8F, 0x9B, 0x6D,
-        0x9D, 0x5E, 0x51, 0x5D, 0x6B, 0xDE, 0xD2, 0xB6, 0xAB, 0xFE, 0x22, 0x63,
-        0xEE, 0x2A, 0x49, 0x85, 0xEA, 0x77, 0xA6, 0x38, 0xBD, 0x13, 0x09, 0xAC,
-        0x59, 0x2A, 0x52, 0x40, 0xEF, 0x1A, 0x76, 0x6E, 0x6F, 0xF5, 0x04, 0x47,
-        0xDA, 0xA4, 0x8F, 0xDD, 0xD3, 0x74, 0xD1, 0x96, 0x16, 0x95, 0x59, 0xA7,
-        0x93, 0x63, 0xA8, 0x43, 0x1F, 0x97, 0x59, 0xD6, 0x6A, 0x4D, 0x93, 0x38,
-        0xBF, 0x37, 0x16, 0xBC, 0xD4, 0x34, 0x97, 0xED, 0xDA, 0x49, 0x73, 0xA5,
-        0x0D, 0xC1, 0xF1, 0x12, 0xC6, 0x0F, 0xB6, 0xCC, 0x4C, 0xA4, 0xA8, 0xAA,
-        0x48, 0xA9, 0xA2, 0x9A, 0x2E, 0x33, 0x87, 0x1A, 0xD9, 0x97, 0x01, 0x90,
-        0xA5, 0x43, 0x5A, 0x4C, 0x4E, 0xF8, 0xF6, 0xAC, 0x2F, 0xD1, 0xC3, 0xC9,
-        0x26, 0xB7, 0x29, 0x91, 0xBC, 0x2A, 0x4C, 0x38, 0xFC, 0x00, 0x64, 0xD3,
-        0xA2, 0x27, 0x63, 0xA5, 0xDE, 0xF1, 0x40, 0xCF, 0x27, 0x4B, 0x66, 0x27,
-        0xA6, 0xC7, 0xD9, 0xED, 0x72, 0xB7, 0xB3, 0xEB, 0x66, 0x79, 0xA8, 0x25,
-        0x0F, 0xCA, 0x6A, 0xA6, 0xAC, 0x70, 0x7B, 0x3E, 0xDE, 0x62, 0xC2, 0xB8,
-        0x44, 0xDB, 0xB3, 0xFD, 0x7E, 0xA4, 0x37, 0x8E, 0x4C, 0x5A, 0x37, 0x71,
-        0x4A, 0x2B, 0x2E, 0x4D, 0x49, 0x29, 0x8D, 0xAD, 0xB5, 0xD6, 0x17, 0x55,
-        0xE6, 0x78, 0x28, 0x31, 0xB2, 0x96, 0x93, 0x56, 0xC2, 0x42, 0x98, 0x12,
-        0xFB, 0x9D, 0xD5, 0x59, 0xCD, 0xF0, 0x85, 0x69, 0xB5, 0x94, 0xDE, 0x21,
-        0xAB, 0x93, 0xCC, 0xD1, 0xEA, 0x6C, 0x3B, 0xAA, 0xAD, 0x95, 0xF7, 0xC9,
-        0x55, 0xB7, 0x77, 0xEC, 0xAB, 0x49, 0x7B, 0xA0, 0xAE, 0xB0, 0xF6, 0x66,
-        0x48, 0x25, 0x17, 0x53, 0x69, 0x61, 0xD7, 0xE5, 0x53, 0x72, 0xC1, 0xCD,
-        0xE6, 0xB2, 0xD3, 0x29, 0x27, 0x3B, 0xE0, 0x05, 0xC9, 0xF7, 0x98, 0x2C,
-        0xAE, 0xE7, 0x08, 0xC6, 0x71, 0xCB, 0xA3, 0x66, 0xB2, 0x99, 0xA9, 0x0B,
-        0x73, 0x45, 0xE1, 0xE5, 0x0A, 0xED, 0x24, 0x33, 0x33, 0xC0, 0x4D, 0x4C,
-        0x99, 0x68, 0xF3, 0x6D, 0x93, 0xCE, 0x6A, 0x99, 0x1A, 0x9B, 0x6E, 0x68,
-        0xDA, 0x1E, 0x2B, 0x65, 0x8D, 0x8A, 0x96, 0xC6, 0xC6, 0xB3, 0x45, 0x73,
-        0x7C, 0x6C, 0xD2, 0x9B, 0xCC, 0xBC, 0x43, 0xF6, 0x64, 0xE6, 0xE4, 0x66,
-        0xF6, 0x22, 0xB3, 0x5B, 0x96, 0x7A, 0xE4, 0x24, 0xAB, 0xF7, 0x26, 0x0B,
-        0xA3, 0x26, 0x66, 0x25, 0x9E, 0xDA, 0xED, 0x4F, 0xF4, 0x8A, 0x25, 0x71,
-        0x12, 0x4B, 0x2E, 0xE4, 0xCE, 0x16, 0xC8, 0x4D, 0x9A, 0x53, 0x8C, 0x59,
-        0xA5, 0x35, 0x22, 0xB7, 0xFC, 0xA2, 0xD6, 0x14, 0xE6, 0x36, 0xC5, 0x11,
-        0xC7, 0xE6, 0x6A, 0x34, 0x1D, 0x4C, 0x3B, 0x19, 0x3A, 0x3B, 0x49, 0x66,
-        0x70, 0x83, 0x1F, 0xD1, 0x9D, 0x4D, 0xEF, 0x64, 0xE6, 0xD8, 0x8A, 0x49,
-        0x4D, 0x73, 0xD9, 0x7A, 0x7F, 0xA1, 0x63, 0xD5, 0xE4, 0x29, 0x3B, 0x15,
-        0x69, 0xFD, 0xC8, 0x0F, 0x04, 0xB7, 0xC4, 0xAE, 0x08, 0xA2, 0xB1, 0xA0,
-        0xDC, 0x8E, 0xDB, 0xAA, 0x17, 0xFB, 0x07, 0x3B, 0x39, 0x3C, 0x89, 0xC3,
-        0xCD, 0x60, 0x44, 0x6C, 0x30, 0x81, 0x11, 0xA4, 0x26, 0x5F, 0xC7, 0x76,
-        0x2A, 0xC7, 0x53, 0xB3, 0x5A, 0x69, 0x75, 0x94, 0xC9, 0x23, 0x8B, 0xA7,
-        0xD7, 0x83, 0xF6, 0x7C, 0xCB, 0x8C, 0x66, 0x53, 0xDE, 0x00, 0xBE, 0x92,
-        0x5E, 0x48, 0x57, 0x9B, 0x38, 0x55, 0x1F, 0x75, 0x27, 0x87, 0x53, 0xD7,
-        0xAA, 0xCA, 0xA4, 0xB5, 0x5E, 0x33, 0x56, 0xA3, 0xE8, 0xD8, 0x75, 0xD7,
-        0x56, 0x0B, 0x52, 0xEB, 0x38, 0x26, 0xB7, 0xDB, 0xB2, 0xDD, 0xEB, 0x2D,
-        0x0F, 0x6D, 0xAD, 0xCB, 0x1E, 0x1A, 0x56, 0x69, 0x5D, 0xDC, 0x54, 0x04,
-        0xF6, 0x20, 0x2F, 0x2B, 0x45, 0xBE, 0xD2, 0x2F, 0x35, 0x87, 0x9D, 0x5D,
-        0x61, 0x6C, 0x8E, 0xEB, 0x46, 0x75, 0xAA, 0x02, 0x21, 0xDC, 0x2C, 0x6D,
-        0x73, 0x85, 0x75, 0x7D, 0x30, 0xE8, 0x0F, 0xCB, 0xF5, 0xBE, 0xBD, 0x5E,
-        0xD5, 0x6D, 0x87, 0x50, 0xD4, 0xE1, 0x84, 0xAC, 0xB6, 0x2A, 0xDA, 0x34,
-        0x5B, 0xE8, 0x2D, 0xE7, 0xD3, 0x55, 0x99, 0x6A, 0xAC, 0x59, 0x76, 0xEE,
-        0xB0, 0x6C, 0xB5, 0x63, 0xA9, 0xCB, 0xA2, 0x83, 0x57, 0x0F, 0x6C, 0xBB,
-        0xDE, 0x97, 0x87, 0xB8, 0xCE, 0x16, 0x1B, 0xC3, 0xBD, 0xC4, 0x3A, 0x56,
-        0x57, 0x65, 0x0B, 0x45, 0x4D, 0xEF, 0xE3, 0xC7, 0xEA, 0x70, 0xC3, 0x1C,
-        0xD9, 0xF6, 0x6C, 0x0A, 0x4C, 0x81, 0x72, 0x77, 0x50, 0xA0, 0xCB, 0x47,
-        0x65, 0x09, 0xDC, 0xC3, 0xAD, 0x48, 0x97, 0x8A, 0xA7, 0x6C, 0x77, 0x49,
-        0x9A, 0xB4, 0xD3, 0x6B, 0x6F, 0x0F, 0x62, 0xE9, 0x38, 0x9E, 0x56, 0x88,
-        0xA3, 0x45, 0x8B, 0xE3, 0x62, 0x6E, 0xD1, 0x5F, 0x50, 0xB9, 0xDA, 0x60,
-        0x9B, 0x23, 0xC8, 0xA5, 0x39, 0x6D, 0xEA, 0xB3, 0xE6, 0x96, 0xC1, 0x98,
-        0x5E, 0xB3, 0xB0, 0x3E, 0x4E, 0xAD, 0x0A, 0x51, 0x2A, 0x4D, 0x89, 0x6A,
-        0x77, 0xB2, 0xDF, 0x9E, 0xF4, 0xB2, 0x63, 0xCE, 0x55, 0xB9, 0x7A, 0xC8,
-        0x92, 0xC7, 0xE2, 0xA8, 0xA2, 0x75, 0x93, 0xC3, 0x96, 0xAE, 0xB4, 0xF6,
-        0x3B, 0x8C, 0x6D, 0xBB, 0x6B, 0x91, 0xD2, 0xA6, 0x7D, 0xC9, 0x91, 0xA7,
-        0x58, 0x5D, 0x24, 0xF0, 0xC9, 0x40, 0x71, 0xC4, 0xAD, 0x8D, 0x01, 0xDF,
-        0x45, 0x9D, 0x6F, 0x3A, 0xED, 0x2D, 0x35, 0xC9, 0x8D, 0x46, 0xED, 0x52,
-        0xD9, 0x1D, 0x92, 0xCE, 0xB0, 0x90, 0x34, 0x88, 0x4C, 0x57, 0xD2, 0x4B,
-        0xD8, 0xBE, 0x35, 0xAB, 0x33, 0xB9, 0x4D, 0x65, 0x54, 0xE8, 0x66, 0x4A,
-        0x13, 0x6D, 0x49, 0xA9, 0x83, 0xCA, 0xCA, 0x4A, 0x2E, 0x9B, 0x39, 0x6C,
-        0x65, 0xEC, 0x28, 0xCE, 0x61, 0x58, 0x57, 0x37, 0x31, 0x8D, 0xB3, 0x33,
-        0x3D, 0x56, 0x3F, 0x8D, 0xB7, 0x55, 0xC2, 0xE2, 0x8F, 0x63, 0xAE, 0xDF,
-        0xD5, 0xC6, 0xC9, 0xB9, 0x5B, 0x95, 0x08, 0xD5, 0x2A, 0x83, 0xF9, 0x56,
-        0x40, 0x3C, 0x9D, 0xE6, 0x5D, 0x72, 0xCA, 0x33, 0x3B, 0x16, 0xB8, 0xCD,
-        0x4A, 0x3B, 0xD7, 0x3C, 0x6D, 0xE6, 0x18, 0x45, 0x36, 0x4C, 0x3E, 0xC7,
-        0x72, 0x2B, 0x22, 0x27, 0x69, 0x1A, 0x9B, 0xE3, 0xC7, 0x66, 0x2D, 0x99,
-        0x6E, 0x33, 0x2D, 0x55, 0x62, 0x71, 0x86, 0x2A, 0xCF, 0x28, 0x20, 0x02,
-        0x2A, 0x35, 0x67, 0x72, 0x6A, 0x30, 0x44, 0xCE, 0xCA, 0xC9, 0x93, 0xAD,
-        0x51, 0x6D, 0x0C, 0xAD, 0x0C, 0x29, 0xD5, 0xE9, 0xE4, 0xB4, 0xB2, 0x97,
-        0x98, 0xFD, 0xB4, 0xEB, 0x76, 0x26, 0xC7, 0x03, 0x23, 0xB1, 0x26, 0x5D,
-        0xE8, 0xE9, 0x3B, 0xAD, 0x53, 0xDC, 0x24, 0x8F, 0xD3, 0x64, 0x27, 0x49,
-        0x75, 0xD7, 0xE2, 0xB0, 0xE2, 0x8A, 0xE3, 0xC1, 0x40, 0x65, 0x73, 0xCD,
-        0xF1, 0xE1, 0xA4, 0xD6, 0x49, 0xD9, 0x1E, 0x65, 0x00, 0x61, 0xD9, 0x72,
-        0xD1, 0x75, 0x57, 0xC5, 0x76, 0x71, 0x33, 0x5F, 0x15, 0x7B, 0xED, 0x41,
-        0x8D, 0xDD, 0xF4, 0x01, 0xC5, 0xEB, 0xAB, 0xF6, 0x78, 0x55, 0x5C, 0x6E,
-        0xC1, 0x85, 0xDD, 0xE8, 0x77, 0xEB, 0x26, 0x2B, 0xAC, 0x86, 0x0D, 0x43,
-        0x65, 0x31, 0x65, 0x53, 0x3D, 0x34, 0x59, 0x06, 0x98, 0x17, 0xC3, 0xB1,
-        0xD2, 0x68, 0xF4, 0xDB, 0xDA, 0xE4, 0x30, 0x33, 0x67, 0x33, 0x3C, 0x59,
-        0xB5, 0xF0, 0xAE, 0x3A, 0xAF, 0x8F, 0x15, 0xA3, 0x24, 0x76, 0x86, 0xF3,
-        0xEA, 0x42, 0x1A, 0x4B, 0xA4, 0xDE, 0xED, 0x9C, 0x54, 0xFE, 0x38, 0xB7,
-        0x4F, 0xEB, 0x6A, 0x72, 0x3E, 0x31, 0xFA, 0x15, 0x5D, 0x2C, 0x68, 0xBD,
-        0x46, 0x69, 0x7A, 0x70, 0x34, 0x23, 0xBD, 0xDA, 0xEC, 0x32, 0x52, 0x9A,
-        0xC8, 0xE5, 0x0E, 0x9B, 0xF9, 0xBC, 0x4F, 0xD8, 0xCD, 0x49, 0x72, 0x5D,
-        0x6D, 0xF5, 0xF1, 0xA5, 0xB5, 0x90, 0x64, 0x45, 0x57, 0xAA, 0xBD, 0x4D,
-        0xAB, 0x4B, 0x14, 0x99, 0x29, 0x3D, 0xDD, 0xCA, 0x6D, 0xD2, 0x30, 0xB3,
-        0xC7, 0x31, 0x66, 0x96, 0x88, 0x8A, 0x04, 0xFE, 0xF1, 0xEA, 0xFA, 0xB8,
-        0xAA, 0x4D, 0x9C, 0xD9, 0x2C, 0xBD, 0x5C, 0x2A, 0x65, 0x79, 0x29, 0xE4,
-        0x4E, 0x49, 0x72, 0xE5, 0x76, 0xE6, 0x76, 0xA9, 0xD6, 0xDA, 0xEC, 0x09,
-        0x71, 0xED, 0x64, 0xF6, 0xBD, 0xA3, 0x54, 0x9F, 0x54, 0x2D, 0xC2, 0xA9,
-        0x4D, 0x9B, 0xCC, 0x50, 0x9E, 0x12, 0xA6, 0x3C, 0xC0, 0x8F, 0xC0, 0xA2,
-        0x59, 0xAB, 0x5A, 0xC3, 0x9C, 0x17, 0x58, 0xA9, 0xB1, 0x2D, 0x75, 0xA7,
-        0xD3, 0xE1, 0x50, 0xCB, 0x6A, 0x85, 0x63, 0xBB, 0xA8, 0x8F, 0x32, 0xB3,
-        0x35, 0x10, 0x7F, 0x2C, 0xFB, 0x94, 0x90, 0x61, 0x20, 0xC6, 0xF9, 0xF1,
-        0x0D, 0x05, 0x55, 0xBE, 0x3D, 0x7D, 0xE4, 0x2D, 0xC3, 0x70, 0xDE, 0x53,
-        0x29, 0xD3, 0x52, 0xB4, 0xFC, 0x77, 0x92, 0xE1, 0x72, 0xA4, 0xF0, 0x9A,
-        0x4A, 0x49, 0x96, 0x95, 0xFF, 0x9E, 0x95, 0x70, 0x0A, 0xA7, 0xC0, 0x1D,
-        0xCF, 0x09, 0x9B, 0xFC, 0x77, 0x09, 0xFD, 0x80, 0x5B, 0x87, 0xE3, 0xF3,
-        0xDF, 0x65, 0x59, 0x06, 0x97, 0x30, 0x40, 0x93, 0xFF, 0x8E, 0xE3, 0xB8,
-        0x7F, 0x4D, 0x80, 0x31, 0x48, 0xD2, 0xBF, 0x21, 0xF3, 0xDF, 0x73, 0x38,
-        0xFC, 0xE3, 0xDF, 0xBF, 0x29, 0xFA, 0x3E, 0xE8, 0x28, 0x72, 0x16, 0x18,
-        0x92, 0xCB, 0xC2, 0x3F, 0x70, 0xC8, 0xD5, 0x4E, 0x03, 0x83, 0xE6, 0x72,
-        0x39, 0x70, 0x63, 0x0B, 0x2B, 0x49, 0x93, 0xF2, 0x2A, 0x0C, 0x13, 0xA1,
-        0xD9, 0x6D, 0xE9, 0xCD, 0x55, 0x44, 0x67, 0x95, 0xA7, 0x68, 0xCC, 0x3C,
-        0x80, 0x47, 0x3B, 0x25, 0xF2, 0xC0, 0x5E, 0x71, 0x62, 0xFE, 0x3B, 0x86,
-        0x7E, 0xB8, 0x60, 0xFE, 0x37, 0x39, 0xAF, 0x19, 0xBA, 0x61, 0x9B, 0x9C,
-        0x00, 0xC1, 0xD6, 0x24, 0x7D, 0xF7, 0xB6, 0xCA, 0xE3, 0x18, 0xE8, 0xF2,
-        0xF1, 0xDD, 0x51, 0x1C, 0x55, 0x7A, 0x13, 0x40, 0xB3, 0xE7, 0xEF, 0x1A,
-        0xA7, 0xE8, 0xFE, 0xA5, 0x28, 0xED, 0x81, 0x15, 0x69, 0xBF, 0x03, 0x05,
-        0x9B, 0xF2, 0xA6, 0xD8, 0x73, 0xD6, 0x8F, 0xCB, 0x8C, 0x4F, 0x1F, 0x2B,
-        0x47, 0x53, 0xDF, 0x57, 0x5E, 0x0C, 0x0B, 0x8C, 0xF5, 0x8F, 0x0F, 0xDE,
-        0x10, 0x8F, 0xEF, 0x29, 0x57, 0xE2, 0x37, 0x8A, 0x03, 0x70, 0x63, 0xA6,
-        0x56, 0xE0, 0x1D, 0x02, 0x3E, 0x25, 0x18, 0xAA, 0x61, 0xE5, 0x1D, 0x8B,
-        0xD3, 0x01, 0x10, 0x96, 0xA4, 0x3B, 0xAF, 0x1A, 0x67, 0x2D, 0x15, 0x3D,
-        0x8F, 0xBD, 0x42, 0x9C, 0x2E, 0x2D, 0x63, 0xA7, 0x8B, 0xFE, 0x0C, 0xF0,
-        0xC1, 0xD3, 0xAB, 0x37, 0x27, 0x1C, 0xF7, 0x35, 0x34, 0xC7, 0x6B, 0x38,
-        0xD8, 0xE6, 0x35, 0xF7, 0x16, 0xF8, 0xE4, 0x07, 0xD9, 0x94, 0x93, 0x94,
-        0xC7, 0x19, 0x80, 0x0A, 0x61, 0x67, 0xD9, 0x60, 0x4A, 0x51, 0x92, 0xB9,
-        0x9D, 0xEA, 0xBC, 0x46, 0xE1, 0xCC, 0xE7, 0x03, 0x40, 0x6D, 0xC1, 0x32,
-        0x54, 0x95, 0xE7, 0xAC, 0x77, 0x6F, 0x4A, 0xD8, 0xD9, 0x6F, 0x0D, 0x2E,
-        0xEF, 0x35, 0x4E, 0x81, 0xB5, 0x08, 0x9B, 0xF7, 0x10, 0xF0, 0x08, 0xE9,
-        0xF7, 0x9B, 0x43, 0xBA, 0xBE, 0xDF, 0xAC, 0x15, 0x3D, 0x7E, 0x7A, 0xE5,
-        0x0D, 0x4B, 0x94, 0xAC, 0x94, 0xC5, 0x89, 0xCA, 0xCE, 0xCE, 0x53, 0x60,
-        0xDA, 0x17, 0x44, 0x96, 0xF7, 0x5B, 0x2C, 0x90, 0x59, 0x00, 0x9F, 0x8F,
-        0x3C, 0x6E, 0xE7, 0x18, 0x1F, 0x2F, 0x7B, 0xC9, 0xB2, 0x15, 0x43, 0x7F,
-        0x0F, 0x21, 0x00, 0x8C, 0x70, 0x15, 0x62, 0xA4, 0x00, 0x64, 0x2F, 0x2B,
-        0x89, 0x13, 0x63, 0x06, 0x44, 0x8C, 0x73, 0x03, 0x18, 0xDC, 0x06, 0x4F,
-        0xAF, 0xA6, 0x61, 0x2B, 0x0E, 0x18, 0x3B, 0x2F, 0x2B, 0x07, 0x49, 0x7C,
-        0x3D, 0xA5, 0x14, 0x5D, 0x94, 0x0E, 0x79, 0x0A, 0x00, 0x7C, 0x40, 0xAC,
-        0x66, 0xB8, 0x79, 0xD0, 0x3D, 0x01, 0xFF, 0x31, 0xFE, 0xFF, 0x5E, 0x7F,
-        0xF8, 0xF2, 0xC9, 0x5F, 0x05, 0x60, 0x77, 0xFD, 0x3D, 0x04, 0x72, 0x02,
-        0x87, 0x53, 0x7A, 0x2C, 0xE1, 0xAE, 0x14, 0x47, 0x0A, 0xD1, 0x8E, 0x20,
-        0x22, 0xA0, 0xF3, 0x86, 0x2A, 0x5E, 0xE0, 0xB0, 0x24, 0x95, 0x73, 0x94,
-        0xBD, 0xF4, 0xEA, 0x18, 0x66, 0x9E, 0x04, 0x8B, 0x08, 0x62, 0xA6, 0xB2,
-        0x2A, 0x1D, 0x5E, 0x39, 0xC0, 0x6C, 0x7A, 0x0A, 0x0C, 0xA8, 0xD9, 0x79,
-        0x01, 0x30, 0x99, 0x64, 0xBD, 0xAE, 0x77, 0xB6, 0xA3, 0xC8, 0xC7, 0x14,
-        0x64, 0x6A, 0xF0, 0x24, 0x8F, 0xF6, 0x40, 0x8A, 0x97, 0x1C, 0x57, 0x92,
-        0xF4, 0x00, 0x3E, 0xCB, 0x70, 0xDF, 0x83, 0x81, 0x14, 0x5D, 0x55, 0x74,
-        0xD0, 0x02, 0xC5, 0x60, 0x7D, 0x26, 0x32, 0x0D, 0x05, 0x0E, 0xF6, 0xF1,
-        0xA2, 0x08, 0x01, 0x9E, 0xC3, 0xD0, 0x85, 0x79, 0xF2, 0x97, 0x98, 0x00,
-        0xF0, 0x2F, 0xA1, 0xF5, 0x91, 0x11, 0x6C, 0xEB, 0x86, 0x2E, 0xF9, 0xE4,
-        0xF7, 0xAE, 0x77, 0x36, 0x60, 0x04, 0x5B, 0x52, 0x25, 0xC1, 0x41, 0x0F,
-        0xBC, 0x49, 0xDF, 0x34, 0x25, 0x4C, 0x60, 0x02, 0xB1, 0x88, 0x6D, 0x02,
-        0xC4, 0x2A, 0xFA, 0xF2, 0xBC, 0xE7, 0x38, 0x5D, 0x01, 0x32, 0x0D, 0xE2,
-        0x09, 0xBE, 0x4A, 0x60, 0x2F, 0x8C, 0x9D, 0x80, 0xAB, 0xE1, 0xAC, 0x84,
-        0xA2, 0x43, 0xA1, 0x0B, 0x50, 0x9D, 0xD2, 0x8C, 0xD3, 0x97, 0x1A, 0x7E,
-        0xA1, 0xCD, 0xC7, 0xBF, 0xD0, 0x68, 0x1B, 0xE9, 0x28, 0x5B, 0x9C, 0x26,
-        0xD9, 0x09, 0xD8, 0xF2, 0x1D, 0x32, 0xD7, 0x3B, 0x7A, 0x81, 0xF6, 0x3B,
-        0x14, 0xB4, 0x40, 0xB8, 0x3A, 0x9C, 0x23, 0xFD, 0x20, 0x33, 0x98, 0x28,
-        0x2D, 0x9F, 0x3E, 0x40, 0x47, 0x1F, 0xE4, 0xD8, 0xBE, 0x81, 0x08, 0xB9,
-        0xDF, 0xFD, 0xF7, 0x74, 0x7B, 0xBD, 0x3F, 0xDE, 0x8B, 0xF2, 0xB6, 0x32,
-        0xC0, 0x3E, 0x7A, 0xBF, 0x26, 0xB8, 0x2F, 0x84, 0x20, 0xCD, 0xCE, 0x4D,
-        0xF2, 0x5E, 0x43, 0x59, 0x51, 0x41, 0x83, 0x3C, 0x6F, 0x41, 0x36, 0xD0,
-        0x25, 0xDB, 0xFE, 0x81, 0xBD, 0xE4, 0x9E, 0x2E, 0xAD, 0x38, 0x01, 0xB2,
-        0x69, 0x6C, 0xB3, 0xEC, 0x93, 0xB7, 0x17, 0xDF, 0x78, 0x47, 0xB7, 0xE3,
-        0xF9, 0x4E, 0x56, 0x0D, 0xCE, 0xC9, 0xA3, 0x4E, 0x1F, 0x2F, 0x90, 0x5B,
-        0x60, 0xDB, 0x73, 0x53, 0xC4, 0x27, 0x91, 0x2D, 0x63, 0x72, 0xA2, 0x08,
-        0x58, 0x01, 0xEE, 0x46, 0x1F, 0xEA, 0x9D, 0x6E, 0x4B, 0xCE, 0x7F, 0x28,
-        0x9A, 0x69, 0x58, 0x0E, 0xA7, 0x83, 0x71, 0xA0, 0x70, 0x0F, 0x6F, 0xC3,
-        0xD7, 0x8B, 0x68, 0xA7, 0x10, 0x5B, 0x02, 0x1E, 0x4B, 0x85, 0x65, 0x6D,
-        0xBC, 0x64, 0xF6, 0x06, 0x42, 0x7B, 0xDA, 0x9F, 0x34, 0x05, 0x37, 0x63,
-        0x86, 0xBE, 0xC8, 0x25, 0x28, 0x06, 0x68, 0x88, 0x33, 0x5F, 0x9F, 0xA8,
-        0x61, 0xB1, 0xE3, 0xED, 0xFB, 0x8B, 0xEC, 0x7E, 0x7A, 0xBD, 0x5A, 0x57,
-        0x54, 0xDF, 0x5C, 0x94, 0xDE, 0xD3, 0xB5, 0xD8, 0xD3, 0x0D, 0x07, 0x28,
-        0xA8, 0xF7, 0xE8, 0x70, 0x50, 0xB7, 0x3E, 0xDD, 0x93, 0x67, 0x77, 0xC4,
-        0x16, 0x14, 0xDD, 0x4C, 0x44, 0x08, 0x43, 0x31, 0x1B, 0x11, 0x7F, 0xBC,
-        0xE1, 0x38, 0x86, 0xE6, 0x6D, 0x61, 0x55, 0x92, 0xA1, 0xE8, 0xFC, 0x47,
-        0x88, 0xA9, 0xD0, 0x95, 0x0A, 0xF9, 0x2A, 0x05, 0x5E, 0x3C, 0xC3, 0x5F,
-        0x4F, 0x67, 0xBA, 0x20, 0x91, 0x17, 0xA2, 0x19, 0xBC, 0x0D, 0xC4, 0x29,
-        0x71, 0x8D, 0x01, 0x03, 0x88, 0x28, 0xC5, 0x39, 0xE6, 0xB1, 0x30, 0x9B,
-        0xCB, 0x9C, 0x28, 0xA5, 0x8C, 0x9D, 0xF3, 0x2E, 0x5B, 0x86, 0xF6, 0x1E,
-        0x34, 0x41, 0xEA, 0xCC, 0x31, 0xCE, 0xF7, 0xE0, 0xEE, 0xA6, 0x13, 0x14,
-        0x1C, 0xE1, 0x3E, 0xD7, 0x3D, 0xD0, 0x08, 0x50, 0x94, 0x70, 0x3A, 0xE2,
-        0xB1, 0xC8, 0x06, 0xF0, 0xB0, 0xFB, 0x5D, 0xC8, 0x40, 0xE5, 0xF6, 0xEA,
-        0x48, 0x07, 0x27, 0x25, 0x4A, 0x82, 0x61, 0x79, 0x82, 0x01, 0xA0, 0x57,
-        0xB2, 0x20, 0xDB, 0x06, 0xD4, 0x78, 0x43, 0xEC, 0xFB, 0x7E, 0x9D, 0xC8,
-        0xBA, 0xA3, 0xE0, 0x03, 0xCC, 0xD0, 0x67, 0x5D, 0x10, 0xE6, 0x89, 0x6B,
-        0x62, 0x84, 0x78, 0x0B, 0x5C, 0x26, 0x70, 0xFA, 0x0A, 0x99, 0xE8, 0x36,
-        0x2C, 0x37, 0x21, 0x9C, 0x1F, 0x2F, 0x32, 0x30, 0xE8, 0x24, 0x2B, 0x46,
-        0xE3, 0x11, 0x17, 0x15, 0x8A, 0x58, 0x37, 0x45, 0xE4, 0xE2, 0x54, 0x20,
-        0xB0, 0xEE, 0x6E, 0x38, 0x06, 0x3F, 0x2B, 0x38, 0xF8, 0x36, 0x98, 0x03,
-        0x6E, 0x06, 0x30, 0x53, 0x78, 0x6F, 0x79, 0xB3, 0xCA, 0x8A, 0x13, 0x68,
-        0x9E, 0x3B, 0x3A, 0x0C, 0xB2, 0xD0, 0xAD, 0xE0, 0x3A, 0xB3, 0xD2, 0xFC,
-        0x87, 0xC7, 0x46, 0x29, 0xCD, 0x7E, 0xF4, 0xFA, 0xFE, 0xAB, 0x6B, 0x10,
-        0x13, 0xDC, 0xCD, 0x7E, 0x21, 0x9E, 0x6E, 0xC8, 0x8A, 0xB8, 0x30, 0x24,
-        0x50, 0x12, 0xB7, 0xE8, 0x0E, 0xCB, 0x95, 0xEB, 0x09, 0x7C, 0xF9, 0x78,
-        0x43, 0xD1, 0x8F, 0x17, 0x41, 0x5E, 0xBE, 0x01, 0x47, 0x57, 0x02, 0xD2,
-        0x00, 0x2A, 0xFD, 0x14, 0x52, 0xC5, 0x60, 0x32, 0xD7, 0xE2, 0x4C, 0xEF,
-        0xED, 0x45, 0xBD, 0x7A, 0x13, 0x65, 0xCF, 0xC2, 0x8C, 0x80, 0x20, 0xC4,
-        0x8A, 0x4A, 0x04, 0x3C, 0x52, 0xFC, 0x81, 0xCA, 0xF7, 0x29, 0x6B, 0x79,
-        0xD6, 0x0D, 0x14, 0x43, 0x68, 0xEC, 0x88, 0xFC, 0x0C, 0xB1, 0x45, 0xC4,
-        0x72, 0x0C, 0xEB, 0x77, 0x1A, 0x70, 0x7D, 0x0C, 0xC6, 0xBE, 0x2C, 0xA4,
-        0xE0, 0xCC, 0x50, 0xFE, 0xF9, 0x30, 0xF9, 0x12, 0x04, 0x0F, 0x4B, 0x6C,
-        0xDC, 0x17, 0x44, 0xB4, 0xF7, 0x7F, 0x84, 0xF3, 0x71, 0xEC, 0x4B, 0xAC,
-        0x99, 0xC0, 0x90, 0x51, 0x85, 0x06, 0xF2, 0xAD, 0x7F, 0x12, 0xF3, 0xA6,
-        0x0F, 0x1B, 0x37, 0xC8, 0x4A, 0x7A, 0x68, 0x12, 0xC5, 0xD9, 0x50, 0xA1,
-        0x9D, 0xEA, 0x99, 0x6E, 0x21, 0x45, 0xE1, 0xE9, 0x46, 0xF0, 0x40, 0x41,
-        0xE2, 0xE3, 0x1A, 0x95, 0x17, 0x2E, 0x39, 0x8F, 0x91, 0xBD, 0xE6, 0x1D,
-        0x8F, 0x32, 0xE6, 0x2D, 0x90, 0xF0, 0x57, 0x4A, 0x54, 0x2C, 0xB0, 0x9D,
-        0xD1, 0x9E, 0x31, 0xDC, 0x38, 0xC8, 0x7C, 0xB4, 0x22, 0x61, 0x8C, 0x44,
-        0xEA, 0x85, 0x30, 0x04, 0x71, 0x51, 0x85, 0x48, 0xC8, 0x85, 0xE7, 0x7A,
-        0x03, 0x08, 0x7C, 0x3F, 0x7B, 0x20, 0x97, 0x4E, 0x48, 0x67, 0x5E, 0xB7,
-        0x04, 0xA2, 0x3F, 0xE4, 0x03, 0xE1, 0x59, 0x2C, 0x60, 0x28, 0xE0, 0x9B,
-        0x01, 0x51, 0xE7, 0x4F, 0x86, 0x5D, 0x9C, 0x06, 0xE2, 0xDC, 0x02, 0x19,
-        0xDC, 0x11, 0x99, 0x1F, 0x66, 0xAE, 0x4C, 0x0C, 0x73, 0xF9, 0xFB, 0x44,
-        0x50, 0x15, 0x61, 0xC3, 0xF1, 0xC0, 0x03, 0x88, 0x9A, 0xA0, 0x3E, 0x6C,
-        0x11, 0x4C, 0x5F, 0x99, 0x90, 0xF7, 0x7D, 0xA4, 0x10, 0xD3, 0xDF, 0xB8,
-        0x1C, 0xF7, 0xE4, 0xF4, 0xAD, 0x6C, 0x0E, 0xD4, 0x3E, 0x42, 0x7B, 0x26,
-        0x8E, 0x1F, 0x20, 0xF2, 0x5C, 0xC8, 0x0F, 0x37, 0xB3, 0x24, 0x20, 0xAB,
-        0x52, 0x97, 0x4D, 0x69, 0xE6, 0x65, 0x43, 0xD8, 0xD9, 0xEF, 0x40, 0xB5,
-        0xC1, 0x4D, 0xED, 0x9B, 0xBC, 0xF0, 0x1D, 0xE8, 0x8E, 0xC8, 0x14, 0xAB,
-        0x91, 0xAE, 0x9C, 0x94, 0x90, 0xA4, 0xCA, 0x04, 0x23, 0xC3, 0xDE, 0x9F,
-        0x72, 0xBE, 0xCF, 0x45, 0x88, 0xD7, 0xA0, 0x14, 0xCA, 0x5F, 0x44, 0x91,
-        0x3F, 0xFB, 0x5D, 0x6B, 0x0F, 0x7F, 0xC1, 0xE9, 0xA7, 0xEB, 0xA6, 0x9F,
-        0x98, 0x7C, 0x7E, 0xD3, 0x28, 0x43, 0x3C, 0x58, 0x9E, 0x27, 0x6C, 0x80,
-        0x01, 0x08, 0x26, 0xD0, 0x8D, 0x37, 0xB0, 0xCE, 0xF7, 0xF3, 0x5A, 0x2F,
-        0x53, 0x5F, 0xAB, 0x5C, 0xB4, 0xCE, 0xF0, 0xB6, 0x48, 0x91, 0xF4, 0x79,
-        0x1F, 0xA0, 0xCB, 0xC0, 0xEA, 0xC0, 0x23, 0x43, 0x10, 0x0F, 0xC6, 0x60,
-        0x2E, 0x7B, 0x89, 0xC1, 0x62, 0xC7, 0x78, 0x2C, 0xF6, 0x81, 0xC3, 0x60,
-        0x04, 0xFB, 0x0D, 0xC9, 0x29, 0x3C, 0x24, 0x97, 0x65, 0x23, 0xA2, 0x96,
-        0x10, 0x59, 0x3F, 0xCE, 0x11, 0x88, 0xA5, 0xA5, 0x88, 0x29, 0xB0, 0xEB,
-        0x4D, 0xA8, 0xD6, 0x60, 0x24, 0x61, 0xA7, 0xE9, 0x36, 0xD0, 0xA2, 0xA6,
-        0xC4, 0x39, 0x3F, 0xA0, 0x98, 0x4D, 0x01, 0x35, 0xFB, 0x0C, 0x78, 0x10,
-        0x6C, 0xD3, 0x1F, 0x78, 0x06, 0x0C, 0xFF, 0x8C, 0xCB, 0xD6, 0x13, 0x34,
-        0xC6, 0xC1, 0xD8, 0x6F, 0x80, 0xAD, 0x36, 0xB7, 0xC3, 0xC7, 0xF9, 0x59,
-        0x41, 0xEB, 0x7C, 0xAC, 0x2F, 0xF0, 0xC0, 0xF8, 0xF1, 0x96, 0x77, 0xD9,
-        0x04, 0x88, 0xB0, 0x01, 0xA9, 0x48, 0x5F, 0x6A, 0x7E, 0xBC, 0x78, 0x0B,
-        0x7A, 0x8F, 0x91, 0x63, 0xB1, 0x6E, 0x47, 0xD8, 0x34, 0x40, 0xB2, 0x5E,
-        0x39, 0xC1, 0xF1, 0xFC, 0x2D, 0x05, 0x9E, 0x78, 0xBE, 0x5C, 0xFC, 0xAB,
-        0xF8, 0xA7, 0x3E, 0x7C, 0xC8, 0x56, 0x0F, 0xE0, 0xA3, 0x22, 0x62, 0xD2,
-        0x83, 0xD2, 0x37, 0x69, 0xEE, 0x69, 0x9E, 0x5B, 0x15, 0xF5, 0x58, 0x19,
-        0x11, 0xD8, 0xBD, 0x80, 0xCE, 0x27, 0x0E, 0xFC, 0x35, 0x3C, 0x3E, 0x65,
-        0xBE, 0xA0, 0xF9, 0x0C, 0x59, 0x86, 0xB4, 0x09, 0x88, 0x88, 0x04, 0xFB,
-        0xAB, 0xBF, 0x35, 0x7D, 0xDB, 0x17, 0xEC, 0x4B, 0x32, 0x8E, 0x0F, 0x44,
-        0x4F, 0x70, 0x3F, 0x52, 0x47, 0x1E, 0x13, 0xDE, 0xD1, 0xA4, 0x1C, 0xC2,
-        0xD7, 0xD5, 0x22, 0xAF, 0xF0, 0xFB, 0xA6, 0x03, 0xE3, 0x3C, 0x2C, 0xBF,
-        0x33, 0x31, 0x7A, 0x01, 0x59, 0x38, 0x01, 0x3B, 0xA1, 0xCD, 0x22, 0xBE,
-        0xD9, 0xC0, 0x69, 0x05, 0xA2, 0x32, 0x62, 0xF8, 0x86, 0x8A, 0xCB, 0x14,
-        0x07, 0x20, 0x50, 0x80, 0x4D, 0x91, 0x25, 0xE5, 0xFB, 0x76, 0x58, 0xC8,
-        0x74, 0x7A, 0x24, 0x06, 0x43, 0xCE, 0x1B, 0x89, 0x04, 0x35, 0xE3, 0x4D,
-        0x8B, 0xE2, 0x0F, 0x60, 0xFB, 0x39, 0x47, 0x7F, 0x44, 0x04, 0x8E, 0xCA,
-        0xAB, 0xDE, 0xB6, 0x8E, 0x1A, 0xDE, 0x01, 0x33, 0xA3, 0x6B, 0x48, 0x2E,
-        0xE0, 0xCC, 0xBA, 0x9E, 0x78, 0xE5, 0x2D, 0x89, 0xDB, 0xA4, 0x5C, 0xC0,
-        0x3D, 0xAF, 0x91, 0xE5, 0x5F, 0x34, 0x2C, 0x0D, 0x71, 0x84, 0xB6, 0xA2,
-        0xAD, 0x71, 0xAA, 0x1A, 0x5E, 0x2D, 0x19, 0x31, 0xF3, 0xC1, 0xEB, 0x68,
-        0x84, 0xE6, 0x3B, 0x80, 0x55, 0x8F, 0xF6, 0x09, 0x8B, 0x32, 0x32, 0x2E,
-        0x32, 0x06, 0x3B, 0xBD, 0x01, 0x3E, 0x0B, 0x77, 0xC4, 0x22, 0x1D, 0xF1,
-        0x10, 0x16, 0x03, 0x3E, 0x11, 0x01, 0x1C, 0x8E, 0xF4, 0x7E, 0x6B, 0xD9,
-        0x9F, 0xC5, 0x74, 0x02, 0x5A, 0x7A, 0xC8, 0xC7, 0x40, 0x5A, 0xDA, 0xB3,
-        0x49, 0x33, 0x11, 0x8F, 0x07, 0xED, 0xA9, 0xEB, 0xE8, 0x5D, 0xC0, 0xF6,
-        0x1E, 0xC3, 0x27, 0x2E, 0x73, 0x79, 0xFD, 0xAC, 0x25, 0xCF, 0xFD, 0x20,
-        0x68, 0xFA, 0x19, 0x83, 0x7F, 0x5E, 0x32, 0x18, 0x60, 0xE4, 0xA8, 0xA1,
-        0xE0, 0xEF, 0x80, 0xDF, 0xD5, 0x57, 0xD8, 0xC7, 0xA9, 0x95, 0x3B, 0x7C,
-        0x13, 0x2C, 0x36, 0x13, 0x98, 0x87, 0x01, 0xD1, 0xF3, 0x2B, 0x45, 0x14,
-        0x61, 0x94, 0x2D, 0x18, 0xEE, 0x8D, 0x8F, 0xC4, 0x4C, 0x43, 0xEB, 0xF7,
-        0xB9, 0x0F, 0x71, 0x5E, 0x44, 0xC0, 0x20, 0x3E, 0xB4, 0x5D, 0xC5, 0x11,
-        0x56, 0xEF, 0x21, 0x26, 0x05, 0xA8, 0x4D, 0xA4, 0x70, 0xFF, 0x2A, 0xC6,
-        0xBD, 0x8A, 0x75, 0x17, 0x7C, 0x26, 0x23, 0x2E, 0xF6, 0x9A, 0x67, 0xB1,
-        0x78, 0xC3, 0x27, 0x80, 0x41, 0x02, 0x7C, 0xEC, 0xB3, 0xAB, 0xEC, 0x37,
-        0xC7, 0x82, 0xB6, 0x80, 0x57, 0x6C, 0x55, 0x11, 0x91, 0x08, 0x0A, 0x43,
-        0x88, 0x42, 0x02, 0x67, 0x08, 0x38, 0xDE, 0x06, 0xF2, 0xC1, 0x91, 0xA2,
-        0x62, 0x1D, 0xF1, 0x01, 0x1D, 0x04, 0x0F, 0x30, 0x9F, 0x1B, 0xB0, 0x20,
-        0xAE, 0x40, 0xC7, 0xD9, 0x60, 0x30, 0x3D, 0xF0, 0x74, 0xED, 0x21, 0x7A,
-        0x93, 0xBC, 0xE0, 0xF6, 0xEB, 0xF5, 0x6D, 0x00, 0x5B, 0x9E, 0x97, 0x80,
-        0x2B, 0x28, 0x45, 0x40, 0x84, 0xDA, 0x24, 0x06, 0x42, 0x9F, 0x94, 0xBF,
-        0xFC, 0x72, 0x36, 0x5F, 0x89, 0x8B, 0xD3, 0x45, 0x04, 0xB0, 0x22, 0xF3,
-        0xD0, 0x83, 0x32, 0x62, 0x29, 0x7A, 0xF1, 0xDB, 0xAF, 0xC1, 0x87, 0x90,
-        0x9B, 0x47, 0x76, 0xB3, 0x24, 0x26, 0xCF, 0x98, 0x8C, 0x0D, 0xD5, 0xC4,
-        0x37, 0x0E, 0x96, 0xF6, 0xC0, 0x63, 0x9E, 0xFD, 0x80, 0x60, 0xDF, 0xF5,
-        0x98, 0x83, 0xD7, 0x0F, 0x5E, 0x85, 0x63, 0xFA, 0xB2, 0x2C, 0x03, 0xF6,
-        0x7D, 0x03, 0x4D, 0x96, 0x97, 0x59, 0x39, 0x13, 0x98, 0x1E, 0xE0, 0x91,
-        0xE0, 0x99, 0xAB, 0x7E, 0x48, 0x35, 0xFA, 0xF0, 0xCF, 0xD5, 0xDC, 0xB7,
-        0xDA, 0x93, 0x0A, 0x47, 0xFD, 0x62, 0xD3, 0x29, 0x37, 0xB1, 0xE5, 0x3B,
-        0xDC, 0x75, 0x79, 0x9C, 0xF2, 0xAC, 0x2A, 0xD0, 0xDA, 0xBF, 0x0A, 0xBF,
-        0x53, 0x34, 0x6E, 0x09, 0x93, 0x51, 0x30, 0x04, 0x9C, 0x5A, 0x42, 0xB6,
-        0x02, 0x9C, 0xF3, 0x23, 0x44, 0xB3, 0xE7, 0xD0, 0xF5, 0xD3, 0x19, 0x6D,
-        0xA1, 0x6C, 0x08, 0xA2, 0x61, 0xCA, 0xDA, 0xE9, 0x3A, 0x74, 0x6D, 0xFC,
-        0x14, 0x4A, 0x38, 0x34, 0x18, 0x15, 0x43, 0x77, 0x46, 0xF0, 0x92, 0x29,
-        0xF7, 0xC8, 0x11, 0x36, 0xC2, 0x42, 0xEE, 0xD9, 0x57, 0xFC, 0x6A, 0xCF,
-        0x34, 0xFC, 0x29, 0x30, 0x3E, 0xF5, 0x10, 0xCE, 0x9D, 0x21, 0xC9, 0xD1,
-        0xF5, 0xCF, 0x2C, 0x3C, 0xD4, 0x09, 0x2D, 0xFA, 0xE1, 0xE2, 0xC2, 0x14,
-        0xFF, 0x63, 0x0B, 0x8D, 0x4C, 0xFB, 0xC5, 0x45, 0x4E, 0x7F, 0x6E, 0x8B,
-        0xC4, 0x24, 0xB7, 0xE8, 0x4F, 0x99, 0xFA, 0x2F, 0x67, 0xDC, 0x98, 0xD0,
-        0xE3, 0x1D, 0x3C, 0x4D, 0xBF, 0x8A, 0x96, 0xCF, 0xB6, 0xC0, 0x83, 0x96,
-        0x5F, 0x62, 0x75, 0xFC, 0x62, 0xC2, 0x23, 0xB7, 0xEA, 0xE1, 0x60, 0x3F,
-        0x01, 0x74, 0x94, 0x63, 0xEF, 0xBD, 0xF4, 0x60, 0x8C, 0x23, 0x71, 0xD8,
-        0xAD, 0xBF, 0x27, 0x8A, 0x1E, 0xAC, 0xC4, 0x56, 0xC5, 0xE9, 0x1B, 0x8C,
-        0x7A, 0x5F, 0x79, 0xA3, 0x38, 0xEE, 0xA9, 0x5B, 0x44, 0x8D, 0x94, 0xB4,
-        0x07, 0xD4, 0xB4, 0xBD, 0x51, 0x42, 0xC1, 0x40, 0xB4, 0xAE, 0x8B, 0xA3,
-        0x7A, 0x61, 0xB6, 0x0B, 0x87, 0xF9, 0x21, 0x42, 0xCF, 0x39, 0x03, 0x53,
-        0x79, 0x86, 0x79, 0xD8, 0xE4, 0xF1, 0xB5, 0xD0, 0x19, 0x8F, 0x00, 0x14,
-        0x68, 0x7E, 0x9A, 0x30, 0x94, 0xB7, 0x03, 0xEA, 0x50, 0x7F, 0x8E, 0x34,
-        0x40, 0x5E, 0x4A, 0xB8, 0xC1, 0x5D, 0xD2, 0x05, 0xBC, 0xED, 0x4D, 0xF1,
-        0x5F, 0xCE, 0xD1, 0x94, 0x7E, 0xD5, 0x01, 0x1E, 0x25, 0xEB, 0xBF, 0x6F,
-        0x50, 0x09, 0x97, 0x25, 0x2B, 0x92, 0x2A, 0x42, 0x02, 0x38, 0x28, 0x2C,
-        0xE4, 0x33, 0x29, 0x30, 0xE9, 0x54, 0xCE, 0xB4, 0xA5, 0x7C, 0x70, 0x11,
-        0xDE, 0x54, 0xD7, 0x41, 0x47, 0x2F, 0xE8, 0xE2, 0x75, 0x4F, 0x38, 0xE2,
-        0xF3, 0xE5, 0x7A, 0xE5, 0x8F, 0x86, 0x42, 0x91, 0xC0, 0x30, 0x50, 0xC4,
-        0xC4, 0xC5, 0x83, 0x27, 0x9F, 0xC2, 0x9E, 0x62, 0x22, 0x7B, 0x35, 0x0A,
-        0x20, 0xA6, 0xB3, 0x4A, 0x09, 0x2B, 0x45, 0x15, 0x7F, 0x40, 0x3A, 0x3C,
-        0xBD, 0x5F, 0xBD, 0xF4, 0x38, 0xED, 0x23, 0x3C, 0x13, 0x32, 0xB6, 0x1D,
-        0xCB, 0x50, 0x6F, 0x02, 0x58, 0xB1, 0x56, 0x61, 0x28, 0x6C, 0xE8, 0xD9,
-        0x96, 0x7F, 0x28, 0xDF, 0x1B, 0xC1, 0x08, 0x62, 0xB6, 0x9B, 0x50, 0xF4,
-        0x55, 0x34, 0x8B, 0xBE, 0x51, 0x1C, 0x10, 0xD6, 0x4B, 0x5A, 0xDF, 0xC3,
-        0xF6, 0x57, 0x13, 0x57, 0xD0, 0xB8, 0x45, 0x09, 0xF0, 0xE0, 0xE2, 0x8C,
-        0x8D, 0x37, 0xDD, 0x08, 0x02, 0x92, 0x28, 0x25, 0x91, 0x8D, 0xC9, 0x12,
-        0x9F, 0x7D, 0xA9, 0xC3, 0xC5, 0xB0, 0xF6, 0x7B, 0x7B, 0xC5, 0x02, 0x31,
-        0x81, 0xEA, 0x07, 0x89, 0x75, 0x18, 0xDA, 0x8E, 0x4E, 0xF1, 0x89, 0x67,
-        0x18, 0x81, 0xD9, 0x43, 0xC3, 0x7B, 0x08, 0x2E, 0xEF, 0xC9, 0xB9, 0x45,
-        0x5C, 0x91, 0xC5, 0xB5, 0x0F, 0x25, 0xF8, 0x19, 0x81, 0x9B, 0x8D, 0x1B,
-        0x8A, 0xC7, 0x22, 0x82, 0xF8, 0x6C, 0x1D, 0x93, 0x46, 0x3B, 0x0F, 0x82,
-        0xA2, 0x85, 0xB7, 0xE9, 0x80, 0x4B, 0x6B, 0xCA, 0x6F, 0x0D, 0xA3, 0x93,
-        0x71, 0x89, 0x2A, 0x84, 0xBF, 0xA0, 0xE8, 0xC6, 0x2F, 0x63, 0x40, 0x37,
-        0x4F, 0x57, 0xE0, 0xDC, 0xE4, 0x07, 0xAE, 0xAD, 0xFC, 0x28, 0x4E, 0xE3,
-        0x72, 0x5B, 0xE7, 0xF0, 0x45, 0x8C, 0xC2, 0x46, 0xDE, 0xF5, 0xFF, 0xFA,
-        0x9F, 0x08, 0x4A, 0x14, 0x7C, 0xBE, 0xAC, 0x1E, 0x06, 0x9F, 0xAF, 0xA2,
-        0xE7, 0x97, 0xA5, 0xA0, 0xC5, 0x5F, 0x0F, 0x74, 0x4B, 0xDE, 0xF0, 0x2A,
-        0x6E, 0x23, 0x62, 0x91, 0xC0, 0x64, 0x8C, 0x1A, 0xBE, 0x0D, 0x94, 0x5F,
-        0x03, 0xF0, 0x40, 0x0E, 0x3E, 0xDF, 0x6F, 0x2B, 0x70, 0xAA, 0xA4, 0x03,
-        0x85, 0x9E, 0x32, 0x15, 0x60, 0xEB, 0x5B, 0x50, 0x62, 0x2B, 0x02, 0xE7,
-        0x18, 0xD7, 0xBC, 0xF2, 0x7A, 0x47, 0x90, 0x7E, 0x78, 0xC1, 0x80, 0x30,
-        0x9A, 0x88, 0x2B, 0x34, 0xDD, 0x89, 0x6B, 0xC7, 0xE4, 0x26, 0xB0, 0xC4,
-        0x75, 0x76, 0xC2, 0x1B, 0x39, 0x61, 0x98, 0xD0, 0x83, 0xB9, 0xE3, 0xB6,
-        0xDE, 0xCB, 0x5C, 0xDE, 0xAA, 0x3F, 0xE0, 0xD2, 0x03, 0xBF, 0x54, 0x3B,
-        0xD7, 0xF4, 0x50, 0x58, 0x24, 0x0C, 0xE0, 0xF9, 0x3D, 0x7E, 0xAB, 0x37,
-        0x37, 0x48, 0x2D, 0x90, 0x3E, 0xD7, 0xC2, 0x34, 0x52, 0x38, 0xCB, 0x1F,
-        0x4F, 0x5C, 0x24, 0xB1, 0x02, 0x0F, 0x01, 0x39, 0xE3, 0xF7, 0x34, 0xF0,
-        0xAD, 0x51, 0x23, 0x18, 0xDE, 0x1E, 0x0A, 0x02, 0x31, 0x97, 0x91, 0xE0,
-        0xF5, 0x87, 0xA2, 0x2D, 0x5F, 0x10, 0xBC, 0x90, 0x4E, 0x29, 0xE9, 0x28,
-        0x89, 0x96, 0x01, 0x68, 0x01, 0x09, 0x06, 0x34, 0x18, 0x30, 0x11, 0x94,
-        0xE5, 0x52, 0xBA, 0xDD, 0xE0, 0x28, 0x0D, 0x70, 0x2F, 0x1D, 0x7F, 0xCF,
-        0x6A, 0xA5, 0x3F, 0x8F, 0x8C, 0x7B, 0x89, 0xFE, 0x3B, 0x65, 0x10, 0xE7,
-        0x20, 0x73, 0x58, 0xF4, 0x32, 0xF1, 0xF2, 0x3E, 0x36, 0xFD, 0x79, 0x1B,
-        0x16, 0x14, 0x42, 0x61, 0xEE, 0x07, 0xC6, 0x13, 0x6C, 0xF4, 0x49, 0x26,
-        0x00, 0x86, 0xDC, 0x61, 0xC6, 0x2C, 0xAC, 0x02, 0x73, 0xB1, 0xD9, 0x32,
-        0xE6, 0x6A, 0x01, 0xB7, 0x8A, 0x18, 0xC5, 0xC9, 0xE0, 0x70, 0x00, 0xE9,
-        0xB7, 0x48, 0xF6, 0xD4, 0xB7, 0xDF, 0x0A, 0x45, 0x04, 0xA3, 0xAB, 0x0A,
-        0x4D, 0x79, 0x9D, 0x76, 0xBD, 0x85, 0x25, 0x9C, 0x4F, 0x3D, 0x0F, 0xF8,
-        0xB6, 0x8B, 0xC4, 0x31, 0xC3, 0xD2, 0x09, 0xC2, 0x15, 0xC9, 0xE8, 0xD2,
-        0xB1, 0x3C, 0x1F, 0xA5, 0x74, 0x28, 0xC6, 0x83, 0x42, 0x3F, 0xC1, 0x40,
-        0x9F, 0x21, 0xFF, 0xDC, 0xEE, 0x01, 0xFE, 0x19, 0xD0, 0x4E, 0x95, 0x44,
-        0x54, 0xE4, 0xF8, 0x27, 0x05, 0x93, 0x50, 0x39, 0x41, 0xA8, 0xB4, 0xE0,
-        0x32, 0x81, 0x1F, 0x4E, 0xBA, 0xDE, 0x11, 0xE0, 0xE5, 0xFB, 0x6D, 0x20,
-        0xE6, 0xF3, 0xD8, 0x10, 0xEA, 0xF9, 0x07, 0x63, 0x3B, 0xA1, 0x84, 0x7A,
-        0xC4, 0xC2, 0xF8, 0x2E, 0xF0, 0x38, 0x87, 0x73, 0x61, 0xDD, 0xA4, 0x40,
-        0x19, 0x8F, 0x2A, 0x1E, 0x48, 0x3F, 0xBE, 0x8E, 0x62, 0xEC, 0xB2, 0x2C,
-        0x33, 0xD1, 0xE8, 0x0C, 0x5C, 0x53, 0xCC, 0xB3, 0x33, 0xB4, 0xA1, 0x79,
-        0x48, 0x52, 0xC0, 0x30, 0xFE, 0xAB, 0xF3, 0xF8, 0x71, 0xB9, 0x37, 0xC5,
-        0x23, 0xD8, 0x17, 0xE9, 0xE2, 0xD3, 0x35, 0x45, 0xC1, 0x8C, 0x35, 0xFA,
-        0x85, 0x25, 0xCE, 0xB1, 0xBC, 0x0B, 0xB1, 0x42, 0x81, 0x3F, 0x7F, 0x82,
-        0x58, 0x82, 0x05, 0x2D, 0x62, 0xA8, 0x76, 0x4B, 0x86, 0xDF, 0x51, 0x1C,
-        0xF8, 0x30, 0xC6, 0x8A, 0x12, 0x0F, 0x40, 0x3D, 0xC6, 0xD9, 0xBA, 0x41,
-        0xE5, 0x6F, 0x48, 0xE2, 0x5F, 0x57, 0x6A, 0x90, 0x9F, 0x88, 0x51, 0x5E,
-        0x45, 0x05, 0x5D, 0xD1, 0x50, 0x5B, 0xB0, 0xDE, 0x18, 0xE5, 0x04, 0x39,
-        0x5B, 0x79, 0xBF, 0x63, 0x26, 0x46, 0x4A, 0x6E, 0x83, 0xDA, 0x21, 0xC4,
-        0x58, 0x7E, 0xD7, 0xBF, 0x8C, 0x8C, 0x97, 0xD1, 0xEF, 0x6D, 0x3A, 0xFF,
-        0x75, 0x38, 0xF5, 0x8F, 0xF2, 0x9A, 0x09, 0xF4, 0xEB, 0xB3, 0x91, 0x61,
-        0xAF, 0x3B, 0xCB, 0x0E, 0xE5, 0x45, 0x83, 0xBA, 0xE1, 0x6B, 0x2B, 0x95,
-        0x84, 0x52, 0xEC, 0x76, 0x77, 0xF8, 0xA3, 0xFA, 0x68, 0xF2, 0xF6, 0x45,
-        0x84, 0x1F, 0xAF, 0x80, 0x85, 0x59, 0xBB, 0x44, 0xE6, 0x8B, 0xDC, 0xFC,
-        0x29, 0xBC, 0x99, 0x10, 0xDB, 0x64, 0xAE, 0xD9, 0x86, 0x8A, 0x49, 0xE8,
-        0xA1, 0x4C, 0x46, 0xE2, 0x4A, 0x68, 0xDF, 0x70, 0xC7, 0x1D, 0x3E, 0xF2,
-        0x4C, 0xD3, 0x3B, 0x11, 0xA8, 0x38, 0xA5, 0x7E, 0x5E, 0x86, 0x73, 0x70,
-        0xDE, 0x3F, 0x29, 0xF8, 0x0E, 0xA5, 0xCC, 0x42, 0xA6, 0x00, 0x1D, 0xC2,
-        0x05, 0x18, 0x04, 0x41, 0x10, 0x7D, 0xAD, 0x73, 0x7B, 0xF0, 0xF8, 0xB7,
-        0x5D, 0xC8, 0xAA, 0xBA, 0xDE, 0x8A, 0xAA, 0x62, 0xFB, 0x89, 0xB5, 0x14,
-        0xF4, 0xCE, 0xAF, 0xDC, 0x76, 0x1C, 0x91, 0x21, 0xAE, 0x4A, 0xE5, 0xC6,
-        0x1B, 0x8A, 0x33, 0x39, 0xE2, 0x1C, 0xC8, 0x00, 0xA2, 0xC4, 0xEE, 0x0B,
-        0x7E, 0xD3, 0x19, 0xF8, 0xDF, 0x54, 0xE5, 0xFD, 0x33, 0x9F, 0xF8, 0x13,
-        0x43, 0x2A, 0xE2, 0x65, 0x13, 0x97, 0xC4, 0x57, 0x38, 0xE4, 0x7F, 0x5D,
-        0x07, 0x47, 0x07, 0xD9, 0xD6, 0x6B, 0x50, 0x1E, 0x14, 0xC7, 0x42, 0xC3,
-        0xC7, 0x5F, 0xE0, 0x0B, 0xF8, 0xF5, 0x06, 0x74, 0xF4, 0xAD, 0x80, 0x09,
-        0x5B, 0xED, 0xD7, 0x13, 0x52, 0xD7, 0xDC, 0x17, 0xB6, 0x33, 0xBC, 0x51,
-        0x43, 0x96, 0xAB, 0x97, 0x67, 0xBD, 0x3C, 0xFE, 0x59, 0x1A, 0x5F, 0x9B,
-        0x65, 0x7F, 0x2A, 0x91, 0x2F, 0x61, 0x9F, 0x10, 0x7C, 0x3F, 0x41, 0xF1,
-        0xB7, 0x3F, 0x91, 0xEA, 0xB7, 0x16, 0x77, 0xB8, 0x24, 0xD3, 0x07, 0x94,
-        0xB8, 0x6C, 0x95, 0xB7, 0x28, 0x99, 0xEF, 0xD5, 0x07, 0x87, 0x56, 0x76,
-        0x26, 0x75, 0xFC, 0xFE, 0x0F, 0xD1, 0x3B, 0x3E, 0x21, 0x7A, 0xD9, 0xDE,
-        0xC0, 0xB6, 0x5E, 0xF9, 0x21, 0x35, 0x1F, 0x34, 0x26, 0x30, 0xDB, 0x88,
-        0xDF, 0x63, 0xB5, 0x91, 0x58, 0x34, 0x05, 0x18, 0x8C, 0xFF, 0x66, 0x47,
-        0xB3, 0x7B, 0x74, 0x34, 0xF0, 0xF4, 0x69, 0xAA, 0x2F, 0x7E, 0x8E, 0x88,
-        0x95, 0x97, 0xA2, 0xEE, 0x67, 0xFC, 0xEE, 0xC8, 0xEE, 0x18, 0x3A, 0x47,
-        0xEA, 0x25, 0xE3, 0x2A, 0x70, 0xCE, 0x0B, 0xBB, 0x4B, 0xB8, 0x58, 0x43,
-        0x20, 0x8C, 0x90, 0x47, 0xE2, 0x1B, 0xF1, 0x7E, 0x68, 0x1A, 0xA4, 0xE3,
-        0xEF, 0x16, 0x13, 0x79, 0x65, 0x70, 0x57, 0x25, 0x57, 0xD7, 0x25, 0x9B,
-        0x29, 0xFA, 0x8A, 0x1A, 0x67, 0x3D, 0x18, 0x8F, 0x12, 0xFF, 0x18, 0xC4,
-        0xB9, 0xD0, 0x97, 0x8E, 0xF3, 0x8D, 0xAF, 0xEB, 0xD2, 0x5F, 0xEF, 0xD5,
-        0xC0, 0x5E, 0xC5, 0x8D, 0xAE, 0x73, 0xF8, 0xD7, 0x32, 0xE1, 0x3C, 0xE9,
-        0x6D, 0x8D, 0x59, 0x5C, 0x09, 0x0B, 0x0A, 0x7D, 0xBC, 0xC7, 0x67, 0xE6,
-        0x2E, 0xD1, 0x9A, 0x6B, 0x47, 0x8B, 0xBC, 0x6C, 0xC2, 0x8B, 0xEB, 0x15,
-        0x95, 0x8A, 0x44, 0xC8, 0x60, 0xBE, 0xB2, 0xD3, 0x84, 0x50, 0x69, 0x5D,
-        0x9C, 0xBF, 0x44, 0xA2, 0x36, 0xAA, 0xB1, 0x0C, 0x89, 0xCC, 0x78, 0x67,
-        0x90, 0x8E, 0xF5, 0xD8, 0xE2, 0xB9, 0x16, 0x8E, 0xC9, 0x59, 0x12, 0xF7,
-        0x06, 0x89, 0x7A, 0x55, 0xE5, 0x6B, 0x5A, 0x92, 0x3F, 0xE1, 0x97, 0x0F,
-        0x5E, 0xDD, 0x6D, 0x7E, 0xEF, 0xE8, 0xD5, 0x83, 0x0E, 0x3F, 0x7B, 0xF8,
-        0x4A, 0x80, 0x0E, 0xB5, 0xF9, 0x05, 0xAE, 0x8F, 0x5A, 0x4D, 0x91, 0xD2,
-        0x87, 0x57, 0x4B, 0x42, 0xEF, 0xC2, 0x01, 0x97, 0xC0, 0x3C, 0xBE, 0xA9,
-        0xAA, 0xBD, 0x57, 0xF2, 0x1E, 0x0D, 0xE0, 0x03, 0x4E, 0x7D, 0x1C, 0xEA,
-        0x45, 0x34, 0x8B, 0x60, 0x3F, 0xE5, 0x97, 0x36, 0xAE, 0x60, 0x77, 0xB0,
-        0xA1, 0x83, 0xCB, 0xF7, 0xDB, 0x6C, 0xE1, 0xC7, 0xCB, 0xDA, 0x38, 0x16,
-        0xE1, 0x1E, 0xBE, 0x53, 0xB2, 0xE5, 0x18, 0x3B, 0x61, 0x95, 0xE2, 0x84,
-        0x73, 0xB4, 0x04, 0x0C, 0xC6, 0xE9, 0x7B, 0xCE, 0xF6, 0x94, 0x7A, 0x24,
-        0xAE, 0x64, 0x72, 0xB6, 0xED, 0x57, 0x93, 0xC5, 0x84, 0x14, 0xC3, 0x16,
-        0x73, 0xB8, 0x40, 0x10, 0xC9, 0x00, 0xD4, 0x15, 0xC6, 0x8F, 0x1E, 0x1D,
-        0x06, 0xBC, 0x20, 0x3F, 0xBA, 0xCB, 0xE3, 0x01, 0x31, 0xEF, 0x32, 0xC2,
-        0x4D, 0xEA, 0xE4, 0x0C, 0xCA, 0xAB, 0x00, 0xD8, 0x3A, 0xEE, 0x14, 0x63,
-        0xF8, 0x0C, 0x5D, 0x24, 0xCC, 0x71, 0x23, 0x51, 0x2E, 0x10, 0xF8, 0xE8,
-        0xF8, 0x99, 0xE2, 0x9A, 0x33, 0x4E, 0x50, 0x21, 0xD6, 0x1B, 0x7F, 0x23,
-        0x4D, 0xC2, 0x85, 0x6E, 0x1F, 0x2F, 0x96, 0x24, 0x46, 0x03, 0x6F, 0xDF,
-        0x05, 0x09, 0x17, 0x71, 0xF1, 0xE3, 0x05, 0x2C, 0x73, 0x29, 0x39, 0xB7,
-        0x92, 0x2B, 0x94, 0xF7, 0x60, 0x10, 0x1B, 0x78, 0x0D, 0xDF, 0xFF, 0xBA,
-        0x4A, 0x86, 0x50, 0x89, 0xE4, 0x19, 0xAC, 0x47, 0x75, 0x87, 0x77, 0xD8,
-        0xE0, 0x36, 0x41, 0xF3, 0x85, 0xDA, 0xBD, 0x88, 0x24, 0x0D, 0x87, 0x1E,
-        0xBC, 0x80, 0x04, 0x0C, 0x40, 0x80, 0x1F, 0x8C, 0x7E, 0x8E, 0x2D, 0x68,
-        0xC4, 0xCF, 0x10, 0x7B, 0x19, 0x8C, 0xD0, 0xF6, 0xC3, 0x5F, 0xE2, 0x94,
-        0x0C, 0xF9, 0x14, 0x89, 0x45, 0x06, 0xC7, 0x8F, 0x3C, 0x4E, 0xB9, 0x14,
-        0xA4, 0xEC, 0x60, 0x50, 0x55, 0xE0, 0x60, 0x2E, 0xEF, 0xD6, 0xA8, 0x0C,
-        0x59, 0x9E, 0x82, 0xAA, 0x98, 0xD7, 0x40, 0x78, 0x09, 0xCC, 0xC8, 0x70,
-        0x91, 0x38, 0x5F, 0xB4, 0x5C, 0x2F, 0x6C, 0x49, 0xFB, 0x63, 0xC5, 0x94,
-        0x7E, 0x7D, 0x21, 0xD3, 0xE6, 0x3F, 0x0E, 0x13, 0xE6, 0xF3, 0xCA, 0x30,
-        0x7F, 0x46, 0xB4, 0xC4, 0x18, 0x05, 0x79, 0x95, 0x27, 0xF9, 0xF8, 0x2E,
-        0xDB, 0x7C, 0xE4, 0xAC, 0x4D, 0x40, 0x96, 0x8F, 0x17, 0xD9, 0x7E, 0x93,
-        0x2C, 0xEB, 0x5E, 0xFE, 0x27, 0xDE, 0x4D, 0x24, 0xE2, 0x23, 0xF0, 0x2E,
-        0xA7, 0x38, 0xD1, 0xED, 0xF9, 0x65, 0x04, 0x04, 0xDD, 0xDF, 0xF8, 0x18,
-        0xA9, 0x95, 0xA1, 0x7D, 0x50, 0x81, 0x4E, 0x8E, 0x96, 0xF6, 0x87, 0xBD,
-        0xB0, 0x47, 0x0A, 0xD8, 0x33, 0xDE, 0x6F, 0xAA, 0x2E, 0x63, 0x77, 0xCC,
-        0x79, 0xAE, 0x4F, 0x4E, 0x2D, 0xC2, 0x56, 0x86, 0x7A, 0xBF, 0x1A, 0xEB,
-        0xE1, 0xB1, 0x85, 0x50, 0xF9, 0x1E, 0xCA, 0x5D, 0xD2, 0x71, 0x91, 0x6A,
-        0x30, 0x83, 0xD7, 0xFD, 0x0B, 0x07, 0x1E, 0x41, 0x5B, 0x3F, 0x81, 0x68,
-        0x5F, 0xA7, 0x80, 0x1E, 0x9C, 0x4D, 0x89, 0x2F, 0x73, 0xF1, 0x1D, 0x12,
-        0xD9, 0xF6, 0x4A, 0x55, 0x6F, 0xFD, 0x1B, 0x04, 0x30, 0x4E, 0xDF, 0x3F,
-        0xFD, 0xF0, 0x28, 0x9F, 0x88, 0xA3, 0xD3, 0x06, 0x3B, 0x13, 0xC0, 0x2E,
-        0xC6, 0x88, 0xD3, 0x6B, 0x0E, 0xBD, 0x92, 0xE4, 0x5E, 0xF9, 0x3B, 0xE8,
-        0xF9, 0xE6, 0xBB, 0x34, 0x57, 0x51, 0x39, 0x34, 0x71, 0xC4, 0xAC, 0x8F,
-        0x71, 0xCD, 0x82, 0x18, 0x50, 0xEE, 0xD6, 0x78, 0x08, 0x5C, 0x74, 0x3A,
-        0xD8, 0x1D, 0x30, 0x55, 0x83, 0x4C, 0xB3, 0xF7, 0xD0, 0xF5, 0x8B, 0x1F,
-        0x27, 0xF7, 0xD3, 0x30, 0xD0, 0x98, 0x14, 0x39, 0x7B, 0x25, 0x89, 0x89,
-        0x87, 0xA6, 0xDE, 0xED, 0xB1, 0x90, 0xEB, 0x73, 0x18, 0xC4, 0xF9, 0x1C,
-        0x46, 0xC8, 0x4B, 0x8D, 0x16, 0xFC, 0xDC, 0x71, 0x7B, 0xE2, 0x4F, 0x5C,
-        0x62, 0x41, 0x54, 0xFC, 0x7C, 0x62, 0x12, 0x0D, 0xEE, 0x2D, 0xE8, 0xC1,
-        0xD1, 0x52, 0x60, 0x15, 0x5D, 0xC4, 0xD1, 0x1D, 0x9B, 0xE8, 0x22, 0x51,
-        0x8F, 0x81, 0x2F, 0x1F, 0xA5, 0x30, 0x9C, 0x0A, 0x25, 0x32, 0x1E, 0xE6,
-        0x4C, 0x89, 0xA0, 0x29, 0x62, 0x93, 0xF7, 0x9B, 0xC3, 0xC6, 0x39, 0xEF,
-        0x10, 0xF2, 0xDD, 0x53, 0xCA, 0xC1, 0xFB, 0xD8, 0x83, 0xD3, 0xE7, 0x97,
-        0xF6, 0xFD, 0x77, 0xC6, 0xBD, 0x57, 0x21, 0xB0, 0x62, 0x8E, 0x69, 0xF8,
-        0x0B, 0xB9, 0x9B, 0xD1, 0x02, 0x5D, 0x7F, 0xDF, 0xE9, 0x2C, 0x1F, 0x71,
-        0x71, 0x06, 0x97, 0x47, 0xEC, 0xEB, 0x0A, 0x10, 0xAF, 0xB9, 0xA7, 0x7B,
-        0xE2, 0x4F, 0x29, 0x47, 0x3E, 0x40, 0x71, 0x63, 0x41, 0x27, 0xE8, 0xF3,
-        0x51, 0x8B, 0x80, 0x3B, 0x3E, 0x8D, 0xAB, 0x84, 0x4E, 0xCB, 0xC2, 0xAA,
-        0xDF, 0xC8, 0x51, 0xD9, 0xAB, 0x93, 0xB2, 0x1F, 0x1F, 0xDF, 0xD1, 0x97,
-        0x33, 0x20, 0x06, 0x41, 0xFF, 0x1B, 0xF1, 0x7D, 0xCD, 0xBA, 0x3E, 0xC7,
-        0x42, 0xF9, 0x82, 0xBD, 0xDE, 0xDB, 0x05, 0xF1, 0xA7, 0xAD, 0x7D, 0x3B,
-        0x13, 0x5A, 0x1A, 0xD9, 0xD0, 0x21, 0xE1, 0xCB, 0x81, 0x7C, 0x08, 0x52,
-        0x02, 0x16, 0xD8, 0xC2, 0x3E, 0x70, 0x3B, 0xA7, 0x02, 0xF2, 0xA9, 0x3B,
-        0xEB, 0x07, 0x90, 0xB9, 0xF0, 0x90, 0x36, 0x00, 0x35, 0x52, 0xDF, 0x00,
-        0x31, 0x19, 0x04, 0x8B, 0xC3, 0xB5, 0xB9, 0x97, 0xE7, 0x70, 0xD0, 0x84,
-        0x04, 0x4C, 0x0F, 0x58, 0xE9, 0x74, 0xE3, 0xCC, 0x44, 0x56, 0xE8, 0x1D,
-        0x5F, 0xBD, 0x5B, 0xBA, 0x13, 0x00, 0x4E, 0xC6, 0xC8, 0xA6, 0x20, 0xA2,
-        0x47, 0x5D, 0x95, 0xFE, 0x47, 0x3F, 0x30, 0x82, 0xD6, 0xF0, 0x66, 0xAF,
-        0x00, 0xF7, 0x85, 0x40, 0xF7, 0x5A, 0x79, 0xDF, 0x30, 0x79, 0xFA, 0x6C,
-        0x19, 0x8A, 0xEE, 0x8F, 0x12, 0x3A, 0xAE, 0xEE, 0x8B, 0xE4, 0xE0, 0x05,
-        0xE0, 0xD8, 0x28, 0x29, 0xC3, 0xD5, 0x3F, 0xE1, 0x83, 0x18, 0x24, 0x7D,
-        0x7B, 0x88, 0xFB, 0xEA, 0x30, 0x5C, 0xC8, 0x8F, 0x43, 0x5C, 0xE9, 0x15,
-        0x53, 0x85, 0x1D, 0x06, 0x1F, 0x17, 0x7E, 0xF4, 0x1E, 0x05, 0xD6, 0xBD,
-        0x93, 0xF2, 0x01, 0x2C, 0x9F, 0xC4, 0xD6, 0x50, 0x3B, 0x14, 0x50, 0x3B,
-        0x17, 0x80, 0x45, 0xCC, 0x97, 0xBF, 0xFF, 0x2D, 0xFD, 0xCF, 0xFF, 0x48,
-        0xF4, 0x14, 0x61, 0x63, 0x25, 0xF0, 0x97, 0xEC, 0x0B, 0x91, 0x68, 0xD7,
-        0x47, 0x89, 0xFF, 0x91, 0x58, 0x39, 0x8E, 0x69, 0xE7, 0xD3, 0xE9, 0xA5,
-        0x02, 0xDC, 0x1D, 0xFE, 0x45, 0x30, 0xB4, 0xF4, 0x50, 0xD1, 0x0C, 0xDD,
-        0x95, 0xCC, 0xB4, 0x89, 0x5A, 0xFF, 0x33, 0xFD, 0xF7, 0xBF, 0xBD, 0xA0,
-        0xCB, 0x98, 0x0C, 0xCD, 0x99, 0x19, 0xF6, 0x8A, 0xAD, 0xF0, 0xAA, 0x14,
-        0x7F, 0xE6, 0x18, 0x03, 0x20, 0xFA, 0x83, 0xBD, 0xC7, 0x9B, 0xFF, 0x77,
-        0xEB, 0x11, 0xEE, 0xD5, 0x77, 0xF8, 0xE3, 0xBD, 0x98, 0x82, 0x15, 0xD4,
-        0xD4, 0xDD, 0x42, 0x17, 0x24, 0x38, 0x25, 0x2D, 0xC8, 0x6F, 0x82, 0xAB,
-        0xB3, 0xC6, 0x7D, 0xA1, 0xC1, 0x5D, 0x84, 0xC6, 0xE1, 0xBC, 0x02, 0x9C,
-        0x53, 0x05, 0x8A, 0xE1, 0x68, 0x03, 0x02, 0x3C, 0x17, 0xE0, 0x19, 0xB0,
-        0x36, 0x27, 0x0C, 0xD1, 0x2D, 0x4C, 0xD9, 0x3D, 0x7F, 0x1B, 0x4A, 0x4B,
-        0x43, 0x4A, 0x8C, 0xEB, 0xDF, 0x9E, 0xBF, 0x0D, 0x0C, 0xA0, 0x95, 0x0C,
-        0x70, 0x51, 0x93, 0xD4, 0xBD, 0xE4, 0x28, 0x02, 0x97, 0xE8, 0x48, 0x3B,
-        0xE9, 0xDB, 0x33, 0x6B, 0x29, 0x9C, 0xFA, 0x6C, 0x03, 0x5C, 0x00, 0xC3,
-        0xCC, 0x52, 0xE4, 0x08, 0xDF, 0x03, 0x71, 0x0A, 0xA0, 0x08, 0xD1, 0x15,
-        0x7E, 0xDC, 0xF9, 0x17, 0xF4, 0x75, 0x67, 0x54, 0xA0, 0x9A, 0xB6, 0xF7,
-        0xCB, 0xE4, 0x41, 0x53, 0x5F, 0x77, 0x8E, 0x9C, 0x7D, 0x4E, 0xFC, 0x27,
-        0xB8, 0x4D, 0x80, 0x5B, 0xDD, 0xFE, 0xF5, 0x1B, 0x24, 0x1D, 0xA0, 0x9C,
-        0xEB, 0xBA, 0x2F, 0x2E, 0xF9, 0x62, 0x58, 0xCB, 0x34, 0x01, 0x64, 0x03,
-        0xEC, 0xF0, 0x2D, 0xB1, 0x57, 0x24, 0xB7, 0x60, 0x1C, 0x7E, 0xFD, 0x86,
-        0x58, 0x09, 0xFE, 0xFD, 0x96, 0xB0, 0x81, 0xED, 0xB4, 0x91, 0x7E, 0xFD,
-        0xF6, 0x0F, 0x82, 0xA4, 0x08, 0x8A, 0xA2, 0xD9, 0xE0, 0x91, 0xC7, 0x77,
-        0xBF, 0x7E, 0x03, 0x2C, 0x77, 0x7E, 0x04, 0xA9, 0x21, 0x70, 0xE6, 0xAF,
-        0xDF, 0x10, 0x54, 0xDF, 0x7E, 0xFB, 0x4F, 0x93, 0x73, 0x56, 0x09, 0xF1,
-        0xD7, 0x6F, 0x6D, 0x8A, 0x7E, 0xA6, 0xE8, 0x16, 0xFD, 0x4C, 0x83, 0x87,
-        0x69, 0xF8, 0xF4, 0xFA, 0x1D, 0x7C, 0x45, 0x85, 0xDE, 0x41, 0x78, 0x7E,
-        0xFB, 0xE5, 0x29, 0x71, 0xAE, 0xC1, 0x4D, 0xF8, 0x16, 0x53, 0x48, 0xB2,
-        0xA1, 0x7D, 0x73, 0x25, 0x7C, 0x38, 0x55, 0x4D, 0x60, 0x2F, 0xA4, 0x1D,
-        0x43, 0xE7, 0x7C, 0x90, 0x3F, 0x7E, 0x98, 0xDB, 0xF6, 0x24, 0xAC, 0x2F,
-        0x6E, 0x3F, 0x95, 0xAD, 0x7F, 0x05, 0xD6, 0x89, 0x04, 0x11, 0xA0, 0x0D,
-        0xC8, 0x61, 0xF5, 0xD7, 0x6F, 0xC8, 0xCE, 0xF8, 0x86, 0xF0, 0x84, 0x3F,
-        0x63, 0x35, 0x62, 0x82, 0xD7, 0xF0, 0x09, 0xB6, 0x68, 0x63, 0xCF, 0xF0,
-        0x82, 0xA8, 0x61, 0x13, 0x7C, 0xF1, 0x2D, 0x7D, 0xD5, 0x65, 0x69, 0x71,
-        0x47, 0xAF, 0x07, 0x06, 0x7A, 0xE0, 0xA0, 0x07, 0x06, 0x7B, 0xE0, 0xA0,
-        0x07, 0x01, 0x7A, 0xE0, 0x7E, 0x0F, 0x1F, 0xC7, 0x37, 0x28, 0x45, 0x1C,
-        0x1E, 0xC7, 0x6F, 0x81, 0x14, 0x4E, 0xE1, 0x8F, 0x10, 0x1C, 0xB4, 0x82,
-        0x5F, 0x75, 0x01, 0x4C, 0x1C, 0xDB, 0x94, 0x93, 0xA1, 0x59, 0xF3, 0x75,
-        0x52, 0xC4, 0x9F, 0x7F, 0x0B, 0x93, 0xFE, 0xB2, 0x08, 0xC4, 0x01, 0x31,
-        0x55, 0xEA, 0x82, 0x2F, 0xE0, 0x9E, 0xE2, 0xD6, 0x16, 0x03, 0x25, 0xD0,
-        0xFB, 0x40, 0x76, 0xBC, 0x47, 0xB1, 0xC3, 0xC0, 0x7C, 0xD0, 0x9D, 0xC6,
-        0x67, 0x1C, 0x5C, 0x94, 0xFE, 0xDD, 0xA6, 0x5E, 0x3C, 0xF5, 0x26, 0x33,
-        0x0A, 0x4B, 0x17, 0xCE, 0xA7, 0xAA, 0x82, 0x7F, 0xD8, 0x4B, 0x96, 0x7E,
-        0x7A, 0xF6, 0x1A, 0x90, 0x97, 0xF0, 0xEC, 0x79, 0x45, 0x71, 0xB3, 0x00,
-        0x75, 0x0D, 0xEB, 0x64, 0xC5, 0x40, 0x1F, 0xE9, 0x06, 0xF4, 0x3D, 0x80,
-        0xD0, 0x95, 0xC4, 0xB3, 0x58, 0x7D, 0x46, 0x1D, 0x80, 0xC0, 0xFA, 0xD3,
-        0x25, 0xAC, 0x17, 0xFD, 0x47, 0x6B, 0x7C, 0x0E, 0x3F, 0xF2, 0x26, 0x44,
-        0xAE, 0x42, 0xF0, 0xDC, 0xE7, 0x89, 0xAB, 0xB6, 0xFE, 0x1A, 0xAE, 0x1A,
-        0xFB, 0x90, 0x5E, 0x8F, 0x1C, 0x7E, 0x18, 0xDB, 0x3C, 0x32, 0xFA, 0xD5,
-        0xD3, 0x50, 0x87, 0xBF, 0x82, 0x10, 0x26, 0xA7, 0x4A, 0x8E, 0x73, 0x5E,
-        0x27, 0x7A, 0xE6, 0x15, 0xCF, 0x5F, 0x00, 0x89, 0x34, 0x0C, 0x3F, 0xF5,
-        0x8F, 0x34, 0x85, 0x79, 0xFC, 0x0C, 0xE3, 0xAD, 0x94, 0xF3, 0xC7, 0xB8,
-        0x46, 0x63, 0x68, 0x9C, 0x28, 0x06, 0x62, 0x3B, 0xDD, 0x4E, 0xFF, 0x87,
-        0xD8, 0x14, 0x35, 0xC0, 0xFC, 0xB3, 0x81, 0x04, 0x74, 0x00, 0xFC, 0x19,
-        0xDE, 0x23, 0xD6, 0xDF, 0x17, 0x42, 0x6C, 0xE7, 0xE2, 0x7B, 0xF4, 0xF1,
-        0x98, 0x88, 0x15, 0xF8, 0x82, 0x5F, 0x6B, 0x43, 0xF4, 0x39, 0xBC, 0xCB,
-        0xC1, 0x3B, 0x64, 0x65, 0x28, 0x2A, 0xBC, 0xF1, 0xAD, 0xCF, 0x10, 0x52,
-        0xFD, 0x66, 0x08, 0xA3, 0xCF, 0x89, 0x4B, 0xD3, 0x04, 0x66, 0x7B, 0x92,
-        0xE4, 0xFF, 0x88, 0x72, 0x0F, 0xA3, 0x17, 0x09, 0x24, 0x60, 0x6E, 0xC1,
-        0xDF, 0xD8, 0x35, 0x12, 0x71, 0x0F, 0xBD, 0xF8, 0xED, 0x1B, 0x78, 0xF2,
-        0x32, 0xEC, 0x26, 0x9C, 0x71, 0xFD, 0xE2, 0xDB, 0x58, 0xEF, 0x77, 0xD6,
-        0x1C, 0xC6, 0x4E, 0x60, 0x8E, 0x5D, 0xDC, 0x94, 0x08, 0x4F, 0xB8, 0x9C,
-        0x23, 0xAC, 0x24, 0x3B, 0xC6, 0x81, 0xBB, 0xC9, 0xBF, 0x21, 0x28, 0x5E,
-        0x18, 0x4F, 0xB6, 0xC6, 0x0D, 0x82, 0x6E, 0x54, 0xCE, 0xBE, 0x94, 0xCE,
-        0x7D, 0xFC, 0xCB, 0xDE, 0x99, 0x30, 0x80, 0x68, 0x27, 0x7E, 0x04, 0x33,
-        0x24, 0xE0, 0x89, 0xFD, 0xA7, 0xF7, 0x4F, 0xE0, 0x80, 0x8D, 0xE2, 0x22,
-        0x3A, 0x5F, 0x3B, 0xEE, 0x0F, 0x70, 0x0D, 0xE1, 0x84, 0xDF, 0xEE, 0x8A,
-        0x9D, 0xE6, 0x37, 0xDF, 0x54, 0x0C, 0xF9, 0x98, 0xD0, 0x22, 0xBC, 0x31,
-        0x1C, 0x3D, 0xCD, 0x24, 0x70, 0xAA, 0xF0, 0xC3, 0x1B, 0x31, 0x91, 0x82,
-        0x06, 0xF9, 0x39, 0x70, 0x10, 0xF3, 0xE6, 0x86, 0x91, 0x63, 0xAC, 0xCB,
-        0x20, 0x7B, 0x8E, 0x22, 0xC1, 0x08, 0xD9, 0xF6, 0xCA, 0x82, 0x9F, 0x16,
-        0xC0, 0xCE, 0x61, 0x43, 0x5B, 0x52, 0xE5, 0x60, 0xCD, 0x37, 0xF6, 0x10,
-        0x4E, 0xDB, 0x37, 0xEE, 0x57, 0x68, 0xB3, 0x84, 0x3D, 0x8A, 0xD0, 0xB7,
-        0x18, 0x1E, 0x61, 0xE2, 0xDF, 0xC6, 0xD4, 0x97, 0x8D, 0xA9, 0xCC, 0x4D,
-        0x3C, 0x2D, 0xC6, 0x96, 0x7A, 0x88, 0x6A, 0xCF, 0x56, 0x0A, 0xE1, 0x35,
-        0xBE, 0xE0, 0xF3, 0x27, 0x30, 0x7D, 0xC7, 0x20, 0x0A, 0x1D, 0xD9, 0xB9,
-        0x16, 0x2D, 0xF4, 0x1D, 0x3E, 0x8D, 0x35, 0x19, 0x3E, 0x59, 0xCE, 0xFD,
-        0xB2, 0x5B, 0x2C, 0xA4, 0x20, 0xE2, 0xFB, 0x02, 0x13, 0xE6, 0x47, 0x48,
-        0x67, 0x3F, 0xBD, 0x47, 0x83, 0xFA, 0xD7, 0xDD, 0xD1, 0xEE, 0xF1, 0x32,
-        0x8B, 0x0F, 0x05, 0xD6, 0xDD, 0x6F, 0x01, 0x01, 0x61, 0x9C, 0x02, 0x8A,
-        0x0B, 0x09, 0x5B, 0xEF, 0xE2, 0xFE, 0x0C, 0xBF, 0xFD, 0xF3, 0x2C, 0xC6,
-        0x12, 0x9F, 0x34, 0xF5, 0x8B, 0x0A, 0x91, 0xEA, 0xB5, 0x50, 0x04, 0xD1,
-        0x73, 0x2C, 0x31, 0x06, 0xE0, 0xF4, 0x22, 0x63, 0x3C, 0xE1, 0x19, 0x13,
-        0x34, 0x8E, 0xFF, 0xAC, 0x1A, 0x43, 0x33, 0x39, 0x46, 0xBA, 0xD6, 0x82,
-        0xB8, 0x4C, 0xCA, 0x54, 0x2C, 0xFB, 0xC5, 0x0A, 0x89, 0x8B, 0x8F, 0x4B,
-        0x21, 0xDD, 0x83, 0x1C, 0x81, 0xCF, 0xC4, 0xF9, 0xCD, 0xC2, 0x1E, 0xA5,
-        0x07, 0x98, 0x1B, 0x1A, 0xDF, 0x76, 0xFF, 0xC3, 0x16, 0x47, 0x26, 0xF3,
-        0x8C, 0x93, 0xE4, 0x33, 0x70, 0x56, 0x9F, 0x21, 0xC4, 0x8F, 0x66, 0x44,
-        0x0F, 0x2C, 0xC9, 0xDE, 0xA9, 0x41, 0x1A, 0x3C, 0xC0, 0x63, 0x08, 0xED,
-        0x70, 0x5F, 0x21, 0x9E, 0xC9, 0xE3, 0x09, 0x3C, 0x91, 0x85, 0x38, 0x39,
-        0x9F, 0x0F, 0xC9, 0xC6, 0xE1, 0x92, 0xB0, 0x3F, 0x73, 0xD7, 0x03, 0xD2,
-        0x84, 0x3E, 0x6F, 0xF1, 0x35, 0x28, 0xFD, 0xB3, 0x92, 0x5E, 0xB2, 0x26,
-        0x72, 0x92, 0xE4, 0x3B, 0x45, 0x64, 0x69, 0x38, 0xA8, 0xB7, 0x10, 0x74,
-        0xDC, 0xFC, 0x6B, 0x63, 0xFE, 0x49, 0xC3, 0xC1, 0xAA, 0xB7, 0x20, 0x0F,
-        0x70, 0xE9, 0xF5, 0x7A, 0x3B, 0xE6, 0x67, 0x03, 0xD9, 0xDC, 0x3E, 0x6A,
-        0x0D, 0xDF, 0xB4, 0x11, 0xA0, 0xCF, 0xA1, 0x7E, 0xDA, 0x0A, 0xF9, 0x70,
-        0x21, 0x60, 0x3C, 0xB2, 0x79, 0x67, 0xCF, 0xFE, 0x6F, 0x01, 0xF1, 0x95,
-        0x99, 0xBD, 0x5D, 0xF4, 0xB5, 0xF9, 0xBF, 0xD8, 0x16, 0xB9, 0x9D, 0x0F,
-        0x36, 0x27, 0xF1, 0xF9, 0x56, 0x81, 0x90, 0xBD, 0xFF, 0x3C, 0x3D, 0xD1,
-        0xD4, 0x5F, 0x5B, 0xCB, 0xD5, 0xE8, 0x32, 0x45, 0x11, 0x34, 0xF6, 0xA5,
-        0xD1, 0x63, 0x7D, 0x98, 0x7B, 0xF8, 0xFA, 0xC3, 0x22, 0x06, 0xCA, 0x16,
-        0x20, 0x66, 0xB2, 0x58, 0xAC, 0x84, 0x39, 0x6F, 0x27, 0xDF, 0xCB, 0x42,
-        0x47, 0xD1, 0x62, 0x6C, 0xA5, 0x40, 0x3D, 0x5F, 0x4E, 0x52, 0xA0, 0xCB,
-        0x50, 0x0A, 0xCD, 0xD3, 0xC6, 0xDE, 0x2E, 0x8A, 0xD4, 0xD6, 0x84, 0x3E,
-        0xE8, 0x14, 0x3D, 0x89, 0xE3, 0xE5, 0x7D, 0x62, 0x9E, 0xDA, 0xB7, 0x0F,
-        0x6F, 0xCF, 0x26, 0x3D, 0x5A, 0x8A, 0x77, 0xAA, 0xF1, 0x8E, 0xBF, 0x1A,
-        0xD7, 0x54, 0x58, 0x19, 0x86, 0x7D, 0xC3, 0x9B, 0xB1, 0x4D, 0x7D, 0xA7,
-        0x23, 0x26, 0x20, 0xFB, 0x57, 0xAC, 0xF3, 0x2B, 0x3E, 0xA7, 0x2F, 0x9D,
-        0x81, 0x05, 0xC8, 0x07, 0xD7, 0x01, 0x28, 0xF0, 0xD9, 0x4F, 0xA0, 0x2A,
-        0x1F, 0x0D, 0x4B, 0x7C, 0x8A, 0xB1, 0x9F, 0xE8, 0x11, 0x78, 0x6B, 0x81,
-        0xE4, 0xBD, 0x40, 0xCD, 0x03, 0x6D, 0x1E, 0x07, 0x39, 0x7C, 0x7E, 0x86,
-        0xFE, 0xBF, 0xA0, 0xCD, 0x9D, 0x72, 0xE0, 0xD9, 0xD4, 0x5F, 0x7F, 0xD1,
-        0x39, 0xDD, 0xF8, 0xE5, 0xBF, 0xCF, 0xC7, 0x0A, 0x81, 0xD7, 0x8E, 0x4C,
-        0x80, 0x20, 0xAB, 0x92, 0xA3, 0xF7, 0xEE, 0xA3, 0x8E, 0x11, 0xF7, 0x2C,
-        0x64, 0x3B, 0xBC, 0x64, 0xC2, 0x41, 0xF4, 0x04, 0xBC, 0xFD, 0x7C, 0xA0,
-        0xB0, 0x05, 0x77, 0xDD, 0xF7, 0xF2, 0xEB, 0x0B, 0xE0, 0x9C, 0xB5, 0xDB,
-        0x95, 0xBB, 0x88, 0x7C, 0xC3, 0x25, 0xE7, 0x83, 0x16, 0xEF, 0x29, 0xE2,
-        0xB2, 0x95, 0xA0, 0xE4, 0xA8, 0x1F, 0x69, 0x19, 0xAE, 0x9D, 0xA7, 0xC1,
-        0x2B, 0x74, 0xFE, 0x1A, 0x25, 0x16, 0x63, 0x6C, 0xC8, 0xB3, 0xF1, 0x8D,
-        0xCC, 0xA8, 0x90, 0x55, 0xEE, 0xB5, 0x45, 0x2E, 0x9B, 0xE7, 0xCD, 0x39,
-        0x9C, 0xE5, 0xFC, 0xC4, 0x32, 0xAE, 0xF8, 0xCB, 0x92, 0xA0, 0xC7, 0xE3,
-        0x7D, 0xD7, 0x0E, 0x25, 0x29, 0x89, 0x44, 0x1A, 0x58, 0x29, 0xE9, 0x04,
-        0x05, 0xFF, 0xBF, 0x17, 0x38, 0xFD, 0x2C, 0x01, 0xFB, 0xF0, 0xEC, 0xB6,
-        0x97, 0x9E, 0xFA, 0x49, 0xDC, 0xC7, 0x00, 0x9D, 0x38, 0x47, 0x00, 0xBC,
-        0xE7, 0x91, 0x22, 0xF5, 0x3F, 0x3E, 0x34, 0xE0, 0x7C, 0xE8, 0xD5, 0xFA,
-        0xA3, 0xDF, 0xCA, 0x95, 0x47, 0x2E, 0xD1, 0x25, 0xF3, 0x13, 0x4A, 0x07,
-        0x45, 0x8F, 0x68, 0x81, 0x47, 0x37, 0x55, 0x48, 0x7F, 0x32, 0xD8, 0xFF,
-        0x76, 0xB5, 0xFF, 0xE4, 0xBC, 0xC5, 0xEF, 0x22, 0x8F, 0x27, 0xC5, 0x43,
-        0xBB, 0x0C, 0xF7, 0x77, 0x19, 0xDC, 0x6D, 0xE4, 0x3D, 0x8C, 0xDF, 0x46,
-        0x53, 0x7E, 0xD7, 0xB4, 0x57, 0xB1, 0xDA, 0xF7, 0xB8, 0x05, 0xC6, 0xCF,
-        0xFF, 0x27, 0xCE, 0xFA, 0x6F, 0x2E, 0xFC, 0x7F, 0x80, 0x0B, 0x7D, 0xCB,
-        0x20, 0x22, 0xEB, 0xCF, 0xFF, 0x7E, 0xE7, 0xA8, 0x81, 0xD9, 0x75, 0x19,
-        0x95, 0x0C, 0xF8, 0xFA, 0x0F, 0x8C, 0x1A, 0xB5, 0xFB, 0x7E, 0x1F, 0x4C,
-        0x41, 0x81, 0x49, 0x28, 0x10, 0xF1, 0x65, 0xDB, 0xE1, 0x11, 0x58, 0x61,
-        0xBB, 0xFC, 0x8F, 0x81, 0x78, 0x65, 0xE1, 0x07, 0xDF, 0x60, 0x7F, 0xF4,
-        0x05, 0xF5, 0x3F, 0x0E, 0x76, 0x24, 0x85, 0xF4, 0x07, 0xC0, 0xF6, 0x33,
-        0x4C, 0x48, 0xFF, 0x03, 0x16, 0x76, 0xF3, 0x78, 0x8C, 0x86, 0xFB, 0xF3,
-        0x40, 0x0E, 0xBB, 0x76, 0xD1, 0x0F, 0x68, 0x01, 0x3B, 0x0A, 0xF9, 0xA2,
-        0xCF, 0x09, 0x4B, 0x12, 0x9F, 0xA1, 0xC7, 0x83, 0x3D, 0x27, 0x54, 0x45,
-        0x93, 0x9E, 0x13, 0xC2, 0x91, 0xD3, 0x9F, 0x13, 0xBC, 0xBA, 0x93, 0xE0,
-        0x73, 0x4C, 0x46, 0x4D, 0x9E, 0x3E, 0xFE, 0xBC, 0xF5, 0x7F, 0x09, 0xAC,
-        0x50, 0x94, 0x1C, 0x02, 0x03, 0x0B, 0x68, 0x9E, 0xFF, 0xFF, 0x14, 0x60,
-        0x50, 0x4C, 0x3F, 0xC3, 0x28, 0x16, 0x8C, 0xF5, 0xFD, 0xFD, 0x6F, 0xF0,
-        0xCF, 0xFF, 0x06, 0xE4, 0x42, 0x6B, 0x03, 0xA1, 0x7C, 0x00, 0x00
+        0x1F, 0x8B, 0x08, 0x08, 0xE9, 0x12, 0xD6, 0x6A, 0x02, 0xFF, 0x73, 0x74,
+        0x79, 0x6C, 0x65, 0x2E, 0x63, 0x73, 0x73, 0x00, 0xED, 0x7C, 0x69, 0x73,
+        0xE2, 0x4A, 0xB6, 0xE0, 0xF7, 0xFE, 0x15, 0xBC, 0xAA, 0xE8, 0xB8, 0xE5,
+        0xC6, 0x18, 0xAD, 0x08, 0xF0, 0xBB, 0x1D, 0x2D, 0xF6, 0x7D, 0xDF, 0x5F,
+        0xBC, 0x70, 0x68, 0x05, 0x81, 0x36, 0x24, 0x81, 0x00, 0x8F, 0x3F, 0xCC,
+        0x4F, 0x9C, 0x7F, 0x34, 0x99, 0x29, 0x09, 0x84, 0x10, 0xD8, 0x75, 0xEB,
+        0xDE, 0x99, 0x89, 0x89, 0x76, 0x55, 0xB9, 0xB4, 0xE4, 0x72, 0xF2, 0x9C,
+        0x93, 0x67, 0x4F, 0xFD, 0x4B, 0x36, 0x74, 0x27, 0x25, 0x73, 0x82, 0xF4,
+        0xEE, 0x5F, 0x69, 0x8A, 0x7A, 0xCC, 0x7F, 0xAB, 0x80, 0x9B, 0x04, 0xEB,
+        0x4A, 0xB6, 0xA1, 0x49, 0x09, 0x3A, 0x51, 0xB1, 0x24, 0xE9, 0xDB, 0x2B,
+        0x6A, 0x61, 0x3B, 0x47, 0x55, 0xCA, 0xEB, 0x86, 0xA5, 0x71, 0xAA, 0xF7,
+        0xC4, 0x95, 0x94, 0xE5, 0xCA, 0xC9, 0xE7, 0x30, 0xCC, 0xBB, 0x17, 0x15,
+        0xDB, 0x54, 0xB9, 0x63, 0x9E, 0x57, 0x0D, 0x61, 0xF3, 0x6A, 0x5B, 0x42,
+        0x7E, 0x67, 0xA9, 0x3F, 0x44, 0xCE, 0xE1, 0xF2, 0xF0, 0x7D, 0xDA, 0x35,
+        0x64, 0x99, 0x78, 0x15, 0x56, 0x9C, 0x65, 0x4B, 0xCE, 0xEF, 0x3B, 0x47,
+        0x4E, 0x65, 0x5F, 0x79, 0xCE, 0x96, 0x32, 0xD4, 0xB3, 0x88, 0xE5, 0xAA,
+        0xED, 0x25, 0x5B, 0x60, 0xD1, 0xCF, 0x69, 0xC3, 0xB2, 0x18, 0xBA, 0xAA,
+        0x15, 0xFB, 0xE0, 0xF7, 0xB1, 0xCD, 0xB2, 0x65, 0xF6, 0xD1, 0x4F, 0x0F,
+        0x5B, 0x54, 0x27, 0x65, 0x4C, 0xA8, 0xAA, 0x46, 0x75, 0xCE, 0x16, 0xCB,
+        0xB5, 0x42, 0xB9, 0x5E, 0xDC, 0x16, 0x0C, 0x6D, 0x60, 0xB7, 0x06, 0x60,
+        0xDC, 0xCE, 0xB2, 0xBE, 0x61, 0xA9, 0x72, 0xBD, 0x50, 0x64, 0x2B, 0x8A,
+        0x62, 0xD7, 0x96, 0xDA, 0x86, 0x6F, 0xAE, 0xC4, 0x81, 0x5A, 0xAB, 0x4C,
+        0x9B, 0xD9, 0x62, 0xCF, 0xCD, 0xAD, 0xE8, 0xB1, 0x31, 0x69, 0x2E, 0xC6,
+        0x36, 0xAE, 0x19, 0x05, 0x6A, 0xB0, 0xDF, 0xA4, 0x69, 0x62, 0x5B, 0x6E,
+        0xB4, 0xDA, 0xE9, 0x51, 0x6E, 0xBF, 0x4D, 0x0F, 0xD5, 0xE5, 0xB0, 0x30,
+        0x5D, 0x0F, 0x8E, 0xA7, 0xB9, 0x3A, 0x54, 0xAC, 0x6A, 0xAD, 0x57, 0x62,
+        0xD7, 0xDC, 0xB0, 0x6A, 0xD7, 0x8A, 0x4A, 0xBB, 0xE8, 0x6C, 0x2C, 0xAC,
+        0x9D, 0x1B, 0x5A, 0xE2, 0x96, 0x38, 0x66, 0x9B, 0x4B, 0x2D, 0x49, 0x26,
+        0x93, 0x24, 0xCD, 0x64, 0x7A, 0x83, 0x46, 0xA3, 0x29, 0x24, 0xB3, 0x92,
+        0xA1, 0x6E, 0xD6, 0x66, 0xC5, 0xDE, 0xF6, 0xA9, 0x41, 0xDB, 0xD0, 0xD5,
+        0x7A, 0xA9, 0xD3, 0xCE, 0x8D, 0x67, 0xD9, 0x4D, 0xB6, 0xBF, 0x70, 0x9C,
+        0x65, 0xDF, 0x39, 0xF2, 0x49, 0x79, 0xDF, 0xD4, 0xEC, 0x61, 0x93, 0x29,
+        0xA4, 0xCB, 0x0B, 0x7B, 0xDA, 0x68, 0xE1, 0xAE, 0xBE, 0x1E, 0xE6, 0xD4,
+        0x49, 0x9F, 0xEF, 0xDB, 0x49, 0x6A, 0x28, 0xD7, 0x1B, 0x65, 0xD1, 0x32,
+        0x6D, 0x52, 0x4D, 0x53, 0xBB, 0xE5, 0x56, 0x5B, 0x36, 0x0F, 0xCB, 0x32,
+        0x3F, 0x9B, 0xB6, 0x89, 0x72, 0xCE, 0x5A, 0xEC, 0xFB, 0xE4, 0xB2, 0x2F,
+        0x51, 0x03, 0x26, 0xDD, 0x18, 0xCF, 0x5B, 0xC5, 0x49, 0x67, 0xDE, 0xAC,
+        0xCF, 0xE6, 0xD3, 0x86, 0x25, 0x17, 0x26, 0x69, 0x6D, 0x92, 0x33, 0x39,
+        0xA6, 0x89, 0x75, 0xF4, 0x63, 0xC1, 0xA6, 0x4D, 0xEC, 0x50, 0x10, 0x56,
+        0x4E, 0x6F, 0xEA, 0x1C, 0xED, 0xE1, 0xD8, 0x58, 0xB3, 0x8D, 0x42, 0x8F,
+        0xE1, 0x5D, 0x80, 0xC4, 0x25, 0x2B, 0xEF, 0x65, 0x4D, 0xA8, 0x2D, 0x4B,
+        0x4B, 0x36, 0x87, 0x51, 0x2C, 0x5B, 0xC8, 0xA6, 0x5B, 0x4B, 0xB5, 0x7C,
+        0x00, 0xD8, 0x9F, 0x17, 0xAA, 0x6C, 0x61, 0xB9, 0xAA, 0xB1, 0x74, 0xA9,
+        0x5E, 0x64, 0x37, 0xF5, 0xF9, 0xB1, 0x5E, 0x2C, 0xD6, 0xB5, 0xD5, 0xA2,
+        0x3A, 0xE8, 0x0B, 0x8D, 0xB2, 0xBB, 0x19, 0x36, 0x96, 0x9B, 0x41, 0x6B,
+        0xB9, 0xD1, 0xA6, 0xA5, 0x6A, 0x75, 0xE3, 0x02, 0x4A, 0xB6, 0xD9, 0x42,
+        0x59, 0xAE, 0xD7, 0x7A, 0xEC, 0x52, 0xEF, 0x77, 0x77, 0x75, 0xD6, 0x28,
+        0x5A, 0x42, 0xD2, 0xB4, 0xA7, 0x36, 0xB1, 0xD4, 0x1B, 0xAE, 0xE3, 0xD6,
+        0xB6, 0x7A, 0x72, 0xDB, 0xAE, 0x77, 0x36, 0xC7, 0x9A, 0xED, 0x1C, 0x5A,
+        0x58, 0xB6, 0x3D, 0x6F, 0x8D, 0x46, 0x6E, 0x6F, 0xB2, 0xA6, 0xA7, 0xFD,
+        0x7D, 0xCF, 0x98, 0x2E, 0x0B, 0xCB, 0x3A, 0x6B, 0x91, 0x93, 0x71, 0x3D,
+        0xD3, 0xE1, 0xCD, 0x72, 0x26, 0x27, 0xE8, 0x69, 0x16, 0x9B, 0xB7, 0xD9,
+        0xF5, 0x6A, 0x32, 0x74, 0xC7, 0x55, 0xCC, 0xE8, 0xD8, 0xC3, 0x8A, 0xC5,
+        0xD5, 0xE4, 0x7A, 0x35, 0x69, 0xD4, 0xD7, 0xF3, 0x45, 0x77, 0x85, 0x2F,
+        0x4A, 0x6B, 0x6A, 0x28, 0x4D, 0x85, 0xDC, 0x9C, 0x64, 0x3A, 0x49, 0x6E,
+        0x4F, 0x30, 0xB9, 0x51, 0x2E, 0x3D, 0xDB, 0xA7, 0xE9, 0x1C, 0x9E, 0xD4,
+        0x64, 0x55, 0xCF, 0xD1, 0x42, 0x4D, 0x1E, 0xAE, 0xE7, 0x44, 0xB7, 0x22,
+        0x68, 0xB8, 0x69, 0x4C, 0x77, 0x3D, 0x4D, 0xEF, 0x28, 0x2C, 0x9B, 0xE1,
+        0xD2, 0x58, 0xB3, 0x5F, 0x32, 0x6B, 0xF3, 0x12, 0x36, 0xD5, 0xCD, 0x6E,
+        0x57, 0xD1, 0xF1, 0xE1, 0x96, 0x1C, 0xF2, 0x8B, 0x06, 0x7E, 0xEC, 0x77,
+        0x87, 0x85, 0xB9, 0x3A, 0xDD, 0x28, 0x96, 0xD4, 0x6A, 0x53, 0xE3, 0xD9,
+        0xD0, 0xDA, 0x96, 0x47, 0xBA, 0x39, 0x72, 0xCB, 0x05, 0x0C, 0xF0, 0xE6,
+        0xBC, 0x87, 0x55, 0x58, 0xDA, 0x61, 0x4B, 0xAB, 0xAD, 0x9A, 0x1D, 0x0C,
+        0xD2, 0x36, 0x3B, 0x29, 0x4F, 0xB5, 0xED, 0x80, 0x9D, 0x0C, 0x78, 0xD7,
+        0xEE, 0xF4, 0xD5, 0x56, 0x51, 0xAE, 0xC9, 0x34, 0x5D, 0x6E, 0x8B, 0x85,
+        0x85, 0xA0, 0xE6, 0x66, 0xC5, 0x8A, 0x4E, 0xA6, 0xE7, 0x2B, 0xBA, 0x3D,
+        0xA9, 0x67, 0xF4, 0x03, 0xB1, 0x37, 0xF0, 0x82, 0xB3, 0xC8, 0x76, 0x66,
+        0xAC, 0xDE, 0xDA, 0x1E, 0xD8, 0x71, 0xDF, 0x5A, 0x8E, 0xAD, 0x86, 0xD2,
+        0xA5, 0x46, 0x6B, 0x6D, 0xB7, 0xAA, 0x1E, 0xD5, 0x51, 0x7A, 0xAB, 0x18,
+        0x8D, 0x43, 0x4E, 0xD8, 0xB6, 0xDD, 0x49, 0x61, 0xA0, 0x72, 0xCD, 0x72,
+        0x7F, 0x5D, 0x5D, 0x55, 0xCA, 0x9A, 0x02, 0x86, 0x6E, 0x4D, 0xB4, 0xC1,
+        0xC6, 0x68, 0x1E, 0xB1, 0x52, 0x71, 0xB2, 0x17, 0xB6, 0xE6, 0x78, 0xEC,
+        0xD6, 0x0B, 0x13, 0x41, 0xDC, 0x4C, 0xAA, 0xE3, 0x76, 0xA6, 0xEF, 0xAA,
+        0xEE, 0x5E, 0xEC, 0xD4, 0xD6, 0xB5, 0xAE, 0x6E, 0xB4, 0x9B, 0x45, 0x77,
+        0x37, 0x66, 0xD7, 0xAA, 0xCE, 0xD3, 0xD4, 0x30, 0xBB, 0x49, 0x83, 0x4D,
+        0xBB, 0x1A, 0xCF, 0x0F, 0x66, 0x93, 0xA8, 0xF3, 0xAE, 0x24, 0x5A, 0xAE,
+        0x34, 0x64, 0xB3, 0x9B, 0xB2, 0xE4, 0x6E, 0x6A, 0xD8, 0x40, 0xE8, 0xE4,
+        0xDC, 0xAA, 0x38, 0xEB, 0x2B, 0xF5, 0xC2, 0x22, 0xA3, 0x1D, 0x77, 0xD8,
+        0x9E, 0xB5, 0x73, 0xF3, 0x4C, 0xBF, 0x33, 0xDE, 0xE2, 0x1B, 0x67, 0x71,
+        0x5A, 0x16, 0x6B, 0x58, 0x47, 0xA2, 0xFA, 0xAB, 0x6E, 0x57, 0x6B, 0x17,
+        0xE8, 0x53, 0xB5, 0xA3, 0x54, 0xEA, 0xD8, 0x6C, 0xCC, 0x0D, 0xF8, 0x13,
+        0x7D, 0x30, 0x7B, 0x99, 0x5A, 0x55, 0xDA, 0x51, 0x4D, 0x7D, 0xB5, 0x76,
+        0xE7, 0xA2, 0xC3, 0x6F, 0x66, 0x45, 0x5B, 0xE1, 0x79, 0x63, 0x29, 0xE1,
+        0xCB, 0xF2, 0xA6, 0xE7, 0xE0, 0xE2, 0xE6, 0xD4, 0x11, 0x4F, 0xF3, 0x7A,
+        0xDB, 0xDD, 0x2F, 0x2A, 0x27, 0x7D, 0x86, 0x0F, 0x09, 0x97, 0xC7, 0x54,
+        0xB2, 0x80, 0x1D, 0x55, 0x9E, 0x69, 0x97, 0xDA, 0x5D, 0x5D, 0xC4, 0x9B,
+        0x8B, 0x83, 0x88, 0x63, 0x3D, 0x87, 0x38, 0x2A, 0xA7, 0x09, 0xCF, 0xCC,
+        0x4F, 0xC7, 0x74, 0x89, 0xC9, 0x8C, 0x0A, 0xD9, 0x6E, 0x97, 0xAC, 0xED,
+        0xD6, 0x55, 0xB2, 0x85, 0x53, 0x99, 0x7E, 0xA5, 0xD7, 0xB4, 0x1C, 0x31,
+        0x39, 0xA0, 0xB6, 0xC7, 0x19, 0x7E, 0x2A, 0x4C, 0xA9, 0xBA, 0xBD, 0x19,
+        0x1D, 0x36, 0x3B, 0xAD, 0x7D, 0xA8, 0xD7, 0x76, 0x8B, 0x6E, 0x27, 0x7B,
+        0xE4, 0xD8, 0xE9, 0x90, 0x6A, 0x09, 0xE5, 0xA4, 0x51, 0xE5, 0xE7, 0xAB,
+        0xD1, 0xBC, 0xA2, 0x2D, 0x97, 0x64, 0xAD, 0x58, 0xC4, 0xCD, 0x03, 0xD6,
+        0xB4, 0xC7, 0xEA, 0xB0, 0x42, 0x54, 0x9B, 0xD5, 0x34, 0x3D, 0x38, 0xD5,
+        0x39, 0x71, 0x5E, 0xB4, 0x31, 0xA7, 0xB4, 0x58, 0xF4, 0x4B, 0x84, 0x2A,
+        0xB6, 0x2C, 0xA1, 0xB3, 0x39, 0x94, 0xB7, 0xC5, 0x8A, 0x24, 0x97, 0x71,
+        0x87, 0xB5, 0xAA, 0xF8, 0x96, 0x60, 0x28, 0xBE, 0x0C, 0x58, 0x79, 0x69,
+        0xB4, 0xCA, 0xA6, 0x3B, 0xC0, 0x4E, 0x8B, 0x7A, 0xBD, 0x3D, 0x25, 0x26,
+        0x63, 0x43, 0xE4, 0x46, 0x05, 0xC3, 0x55, 0xF9, 0xA2, 0x53, 0x5A, 0x3B,
+        0xC5, 0x9E, 0x7D, 0x58, 0x91, 0x6D, 0x93, 0x25, 0x08, 0x4D, 0xAB, 0x59,
+        0x8B, 0x32, 0xD3, 0x5F, 0xAD, 0xA8, 0x15, 0x91, 0xA1, 0xC4, 0xDA, 0xA9,
+        0x20, 0x10, 0xCD, 0x4C, 0x33, 0xB7, 0xCC, 0x92, 0x1D, 0x46, 0xCE, 0x1C,
+        0xB2, 0x2B, 0x87, 0x9C, 0xD6, 0x92, 0x95, 0x46, 0xFA, 0x60, 0x65, 0xF7,
+        0x4C, 0xAD, 0xE1, 0xD8, 0xFD, 0x8E, 0xB5, 0xA9, 0x76, 0x37, 0x9D, 0x34,
+        0x53, 0x6E, 0xB3, 0xEE, 0x4A, 0x2F, 0x8E, 0xA7, 0x75, 0x3D, 0xB9, 0xE9,
+        0xD6, 0xA9, 0xD1, 0x68, 0xDE, 0x55, 0x5A, 0x8D, 0xC2, 0x4A, 0xE5, 0xA8,
+        0x45, 0xA9, 0xD6, 0x10, 0xFB, 0x04, 0xE8, 0xD6, 0xAF, 0x2C, 0xE5, 0x62,
+        0x7D, 0xA8, 0x82, 0x99, 0x32, 0x2D, 0xA5, 0x9A, 0x76, 0xB6, 0x72, 0x5D,
+        0x14, 0x9C, 0x31, 0x35, 0x23, 0xA9, 0x82, 0x20, 0x0C, 0x33, 0x83, 0xC3,
+        0x7C, 0x6B, 0xAA, 0x8D, 0x99, 0x92, 0xA9, 0xE8, 0x6B, 0xAE, 0xCF, 0x2C,
+        0x34, 0x5E, 0x96, 0x6C, 0x76, 0x31, 0xA9, 0x6B, 0x8A, 0x50, 0xEF, 0x6E,
+        0x94, 0xBE, 0xBD, 0x4F, 0x36, 0x56, 0xD3, 0x53, 0x71, 0xA4, 0x25, 0x47,
+        0x26, 0x57, 0x1E, 0x77, 0xFA, 0x66, 0x4D, 0xAC, 0xB8, 0xCE, 0x91, 0xE9,
+        0x1D, 0xF0, 0xEA, 0x74, 0x99, 0xA5, 0x56, 0xFB, 0xF4, 0x31, 0x27, 0xA6,
+        0xE7, 0x93, 0x7E, 0x3F, 0x59, 0x6C, 0xE3, 0x35, 0x76, 0xA6, 0x75, 0x0B,
+        0x95, 0x43, 0x65, 0xAA, 0x74, 0x17, 0x74, 0x7B, 0xC1, 0x4C, 0xDA, 0x1D,
+        0x9C, 0x34, 0x5A, 0x84, 0x9A, 0x6C, 0xD2, 0x4C, 0x45, 0x77, 0xD4, 0x1A,
+        0xE9, 0xE6, 0x4E, 0x4B, 0xBE, 0x3E, 0x3C, 0x31, 0x95, 0x15, 0x61, 0x1B,
+        0xEB, 0x13, 0x27, 0x3B, 0xED, 0x83, 0xC2, 0x2C, 0x38, 0xC3, 0x3C, 0x89,
+        0x54, 0xE7, 0xD0, 0xE7, 0x47, 0x6A, 0x26, 0x9D, 0x5C, 0x0C, 0x0B, 0x07,
+        0x77, 0x5E, 0x3D, 0xD5, 0xC6, 0xAA, 0xAA, 0x49, 0x56, 0xC6, 0x20, 0x26,
+        0x3B, 0x8D, 0x58, 0xAF, 0xB4, 0xE3, 0x71, 0xBA, 0xD9, 0x11, 0x6E, 0x73,
+        0x32, 0xCE, 0x26, 0xB7, 0x03, 0xAA, 0xDD, 0xC6, 0xA4, 0xF9, 0x61, 0x83,
+        0x37, 0x04, 0xB6, 0xD5, 0x3D, 0x75, 0x39, 0x71, 0xC5, 0x03, 0xF9, 0xD6,
+        0x51, 0x9C, 0x0D, 0x97, 0x4D, 0xAA, 0xDB, 0xC3, 0x68, 0xDF, 0x50, 0x3B,
+        0x8B, 0xDD, 0x52, 0x3E, 0x0D, 0x87, 0xE5, 0x42, 0xD2, 0x3C, 0x6C, 0x77,
+        0x24, 0x35, 0xCF, 0x36, 0xA5, 0x06, 0x3B, 0x61, 0x31, 0xC2, 0x5C, 0x8B,
+        0xC9, 0x5A, 0x67, 0xD6, 0x58, 0x65, 0x9D, 0xF4, 0xBA, 0x61, 0x77, 0xD3,
+        0x07, 0x75, 0x50, 0xEC, 0x1A, 0xBD, 0x75, 0x21, 0x57, 0x2A, 0xD9, 0xDC,
+        0x9C, 0xEA, 0xB9, 0x4C, 0x86, 0x70, 0xD9, 0xC1, 0x6C, 0xD7, 0xC6, 0xD9,
+        0x19, 0xED, 0x10, 0x9B, 0x31, 0xB5, 0x6B, 0x70, 0xAB, 0x51, 0x2F, 0x9B,
+        0x71, 0x47, 0xF5, 0xFA, 0x80, 0x9C, 0x4A, 0xEB, 0x5C, 0x45, 0xAF, 0xB3,
+        0xED, 0x1E, 0x2D, 0x64, 0xB3, 0xFC, 0xEE, 0xD0, 0x3B, 0x3A, 0xD8, 0x72,
+        0xDB, 0xCB, 0x94, 0x7B, 0xB5, 0x8E, 0xC1, 0xEC, 0x04, 0x29, 0x4D, 0x1B,
+        0x99, 0x5D, 0xA5, 0xAE, 0x0E, 0x34, 0x45, 0xC6, 0x32, 0x4C, 0x63, 0x4C,
+        0xB4, 0x74, 0x69, 0x23, 0xCD, 0x9B, 0xE5, 0x4E, 0x97, 0x70, 0x18, 0xBC,
+        0x69, 0x53, 0xE4, 0x2C, 0x93, 0x29, 0xCD, 0x4E, 0xC5, 0xBA, 0xB2, 0xDA,
+        0x4F, 0x0C, 0x7E, 0xB3, 0xDB, 0x8E, 0x89, 0x5E, 0xB5, 0xB8, 0x2B, 0x1D,
+        0x2D, 0xBC, 0x5E, 0x9C, 0xD0, 0x49, 0x96, 0x6F, 0xF3, 0xC3, 0x5E, 0xBD,
+        0xCB, 0x53, 0x05, 0xA6, 0xBA, 0x9F, 0xCF, 0x57, 0x8D, 0xC2, 0x7A, 0x40,
+        0x11, 0x95, 0x66, 0xD5, 0x2C, 0xC9, 0xFA, 0xD0, 0xC0, 0xBA, 0xE3, 0x4E,
+        0xD9, 0x5C, 0x6C, 0x72, 0x98, 0xE0, 0x54, 0x5B, 0xAB, 0xCE, 0x94, 0xB6,
+        0xF1, 0x63, 0x76, 0xD4, 0xA0, 0x16, 0xFD, 0x29, 0x21, 0x26, 0xD7, 0x73,
+        0xC5, 0x9E, 0x0E, 0xB7, 0x6A, 0x75, 0x5D, 0x56, 0x0D, 0x87, 0x6D, 0x66,
+        0xA4, 0x19, 0x7F, 0x50, 0xF8, 0x7A, 0xDB, 0xEA, 0x12, 0xC6, 0x51, 0xC8,
+        0xF1, 0x54, 0xB1, 0x7C, 0x3A, 0xCD, 0x9C, 0x42, 0x99, 0xD2, 0xB5, 0x79,
+        0x87, 0xC0, 0x92, 0x92, 0x59, 0x75, 0x2A, 0xEB, 0xA5, 0xB4, 0x6E, 0xD7,
+        0x5B, 0xB9, 0x72, 0xA6, 0x53, 0xB4, 0x0E, 0xBB, 0xB5, 0xA8, 0x18, 0x72,
+        0x72, 0x74, 0xC2, 0x3A, 0x4B, 0x33, 0xBB, 0xA8, 0xCD, 0x97, 0x15, 0xAA,
+        0x6F, 0xF5, 0x28, 0x2C, 0x9D, 0x6C, 0x94, 0x96, 0xB4, 0x73, 0xE0, 0x7B,
+        0x34, 0xD9, 0x38, 0x38, 0xD5, 0xE3, 0x86, 0x58, 0x53, 0x60, 0xD3, 0x98,
+        0xE2, 0xA9, 0x42, 0xE7, 0xD6, 0xD4, 0x49, 0x4B, 0x6F, 0x1B, 0x1C, 0xA7,
+        0xED, 0x72, 0xED, 0x6C, 0xAB, 0x77, 0x3A, 0xD2, 0xB3, 0x7A, 0x95, 0x19,
+        0x54, 0x0C, 0xB7, 0xD5, 0x68, 0x29, 0xDD, 0x62, 0xCE, 0x98, 0x76, 0xE8,
+        0xED, 0xB1, 0x54, 0x5D, 0xB5, 0x06, 0xCA, 0xA8, 0x79, 0x9A, 0x63, 0x3C,
+        0x39, 0x48, 0x73, 0x58, 0xD6, 0x54, 0x04, 0xC9, 0x55, 0xF7, 0xE9, 0x4C,
+        0xE5, 0x64, 0x19, 0x19, 0x26, 0xB9, 0x67, 0xB3, 0xC2, 0x0C, 0xD7, 0x1B,
+        0x9C, 0x42, 0xAF, 0xDA, 0xFA, 0x6C, 0xBD, 0xA2, 0x0D, 0x6B, 0x63, 0x1C,
+        0xD2, 0xF2, 0xA9, 0x56, 0xD9, 0xE7, 0x46, 0x14, 0x23, 0xA5, 0xC7, 0xE2,
+        0x16, 0xD8, 0x15, 0x45, 0x8A, 0x3B, 0xDA, 0x42, 0x69, 0xBB, 0x6D, 0xAB,
+        0x6D, 0x2B, 0x4D, 0x96, 0x2C, 0x21, 0x9D, 0x31, 0x17, 0x7B, 0x29, 0x3D,
+        0x98, 0xE5, 0xD8, 0x36, 0x46, 0x54, 0xDC, 0x5D, 0xB6, 0xB0, 0x37, 0x8F,
+        0x8B, 0xF1, 0xA0, 0xCC, 0x30, 0x23, 0x8C, 0x9C, 0x15, 0xA4, 0xBD, 0x99,
+        0x11, 0xB9, 0x1C, 0x7D, 0xDC, 0xE4, 0xE4, 0xDA, 0xAC, 0x30, 0x95, 0xED,
+        0xAE, 0xAB, 0xAB, 0x7C, 0xA3, 0xD0, 0x98, 0x53, 0x75, 0xA3, 0x4E, 0x70,
+        0xB3, 0x81, 0x25, 0x76, 0x2D, 0xEE, 0xC8, 0x15, 0x47, 0x73, 0x42, 0x36,
+        0x81, 0x3E, 0xDD, 0x76, 0x18, 0x71, 0xBE, 0x94, 0xB0, 0x5E, 0x0F, 0xCF,
+        0x1D, 0x0F, 0xA2, 0xEB, 0xEE, 0xDD, 0xAE, 0xAE, 0xB5, 0xF0, 0x72, 0x55,
+        0xC7, 0xB4, 0xA5, 0x64, 0x16, 0xE6, 0x34, 0xAD, 0x4A, 0x34, 0xBD, 0x26,
+        0xC4, 0xCD, 0xB0, 0x3E, 0x3E, 0x60, 0xEE, 0x66, 0x2B, 0xAF, 0x89, 0xF2,
+        0x48, 0x65, 0x1A, 0x8A, 0x5D, 0x3F, 0xEA, 0x23, 0x9B, 0x69, 0x2F, 0xD2,
+        0x33, 0xD2, 0x9C, 0x65, 0xA5, 0xE3, 0x4E, 0x5B, 0x6D, 0x87, 0x75, 0xB2,
+        0x67, 0x8D, 0x0F, 0x99, 0xAA, 0x73, 0xC8, 0x6C, 0xCD, 0x53, 0x72, 0xC9,
+        0xE7, 0x96, 0x66, 0x69, 0xC9, 0x4D, 0x55, 0xCD, 0x3D, 0x12, 0xB9, 0xC6,
+        0xB0, 0x5E, 0x5C, 0x4B, 0x52, 0xBF, 0x97, 0x5B, 0xCE, 0x32, 0x4B, 0x81,
+        0xEE, 0x48, 0x9D, 0xE5, 0x91, 0x19, 0x65, 0xBB, 0x3D, 0x8D, 0xCC, 0x94,
+        0xB1, 0x4C, 0x67, 0x77, 0x28, 0x8A, 0xBC, 0xC0, 0x74, 0xF8, 0x55, 0x25,
+        0x27, 0x75, 0x7B, 0x99, 0x81, 0x5C, 0x26, 0x93, 0x42, 0xA5, 0x5F, 0xDB,
+        0xE3, 0xEE, 0x01, 0x1F, 0x8E, 0x19, 0x91, 0xCA, 0xEC, 0x1B, 0x47, 0xC5,
+        0xB4, 0xB6, 0xB9, 0x6E, 0x57, 0xCD, 0x51, 0xBD, 0xED, 0x86, 0x1B, 0x59,
+        0x33, 0x87, 0xB0, 0x27, 0x07, 0x86, 0xC9, 0x30, 0x03, 0xB2, 0xA4, 0x48,
+        0xF3, 0xCA, 0x72, 0x44, 0x56, 0x4E, 0x1D, 0x6C, 0x35, 0xD3, 0x0A, 0xE3,
+        0xD2, 0x9A, 0xD8, 0xCC, 0x3A, 0x19, 0xD7, 0xE5, 0x4E, 0x3D, 0x7E, 0xD8,
+        0xEE, 0xB0, 0x87, 0x81, 0x9C, 0x3D, 0x9E, 0x1A, 0xA5, 0x34, 0x91, 0x19,
+        0x25, 0x7B, 0x3B, 0x87, 0xCD, 0xE8, 0x1B, 0x35, 0x33, 0x55, 0x8D, 0xDA,
+        0x8A, 0xA1, 0x0B, 0x95, 0xEE, 0xC9, 0xD9, 0x50, 0x7A, 0x6B, 0x6F, 0x14,
+        0x37, 0xC5, 0xE3, 0x78, 0xEE, 0xA6, 0xF7, 0x33, 0x8A, 0x6E, 0x74, 0x5C,
+        0x4D, 0x74, 0x47, 0x7B, 0x49, 0xAE, 0x95, 0x8B, 0x5C, 0xB2, 0x6B, 0xE1,
+        0x6C, 0xD9, 0xD4, 0xAC, 0x03, 0xD0, 0x14, 0xCA, 0xD1, 0x21, 0x77, 0xCD,
+        0xEC, 0x64, 0xCE, 0x76, 0x5B, 0x36, 0xA1, 0x68, 0xC5, 0x23, 0x99, 0x1D,
+        0x36, 0x29, 0xA5, 0xC1, 0xB4, 0x97, 0xDA, 0xC0, 0xE1, 0x0B, 0x93, 0x46,
+        0x6F, 0xA4, 0x71, 0x25, 0xB7, 0x33, 0xEE, 0x4E, 0x0D, 0xCE, 0xE4, 0xBB,
+        0xFA, 0x8A, 0x9C, 0xD7, 0x8A, 0xE2, 0xAE, 0x2B, 0xEB, 0x35, 0x77, 0xC7,
+        0x6B, 0x4B, 0x43, 0xEE, 0x8E, 0x94, 0xE4, 0xA2, 0x5D, 0xE9, 0x1D, 0x8D,
+        0x6A, 0xC6, 0xE5, 0x4D, 0xD6, 0xB4, 0xD6, 0xCB, 0x99, 0xA9, 0x66, 0x47,
+        0x43, 0x8A, 0x91, 0x59, 0x61, 0x3C, 0x53, 0xA7, 0xBD, 0x46, 0x53, 0x92,
+        0x37, 0xAD, 0xD3, 0xA4, 0xAA, 0xD2, 0xBB, 0xC6, 0x50, 0xDE, 0xED, 0x15,
+        0x79, 0xBE, 0x57, 0x94, 0x8E, 0x24, 0xCC, 0xAA, 0x15, 0x59, 0x32, 0x33,
+        0xC5, 0xC2, 0x69, 0x30, 0xCE, 0xB5, 0xF6, 0xED, 0xD2, 0xA9, 0xD0, 0x5B,
+        0x0F, 0xCA, 0x2D, 0x3C, 0x57, 0x63, 0xDC, 0xA4, 0xD1, 0x74, 0xD4, 0x8C,
+        0x65, 0xEE, 0xCC, 0x21, 0xC9, 0x99, 0xFB, 0x93, 0x3A, 0x9D, 0x01, 0x6C,
+        0xD5, 0x76, 0x69, 0x7C, 0x9B, 0x9B, 0x8B, 0xBA, 0xC6, 0x2F, 0xCA, 0xB9,
+        0xE6, 0x6C, 0xDA, 0x71, 0xE8, 0x6A, 0x26, 0x27, 0x95, 0x73, 0xFC, 0x3C,
+        0xDD, 0xAC, 0xB7, 0x16, 0x82, 0xB4, 0xA0, 0xD7, 0x6B, 0x72, 0xEC, 0x1E,
+        0xB2, 0x80, 0x70, 0xE3, 0x8D, 0x45, 0x2E, 0x7A, 0x95, 0x4D, 0x87, 0x6E,
+        0xD3, 0x7B, 0xBD, 0x46, 0x88, 0x2C, 0xE8, 0xBD, 0x2B, 0xCC, 0x65, 0x8C,
+        0x33, 0xAC, 0x16, 0xE6, 0xEE, 0x35, 0xEE, 0x60, 0xD5, 0xC9, 0x3D, 0x59,
+        0xD7, 0xD3, 0x62, 0x69, 0xBE, 0x1B, 0x63, 0xEC, 0xBE, 0x69, 0x6D, 0x66,
+        0xD3, 0xC6, 0xD6, 0x69, 0x56, 0x47, 0xAD, 0x63, 0x4E, 0x2D, 0xAA, 0xD6,
+        0x94, 0x4A, 0x56, 0xD7, 0x9D, 0x9D, 0xBE, 0x66, 0x45, 0x77, 0xC7, 0xD5,
+        0xEC, 0x53, 0xAF, 0x98, 0xAB, 0x57, 0x66, 0x46, 0x51, 0x5F, 0x77, 0xB7,
+        0xCD, 0x2C, 0xCF, 0xEE, 0xF6, 0x87, 0x13, 0xB5, 0x5D, 0xB3, 0x87, 0xF2,
+        0x5E, 0xEE, 0x2E, 0x9B, 0x25, 0xCD, 0x1C, 0x8B, 0xE9, 0x1D, 0x46, 0x26,
+        0x0F, 0xF4, 0x66, 0xCB, 0x30, 0xC4, 0xA1, 0x39, 0x4A, 0x4E, 0xD3, 0xF4,
+        0x72, 0x98, 0xCE, 0x92, 0x59, 0x2C, 0xDD, 0x93, 0x0F, 0x6D, 0xB9, 0x27,
+        0x12, 0x0D, 0xCA, 0xDA, 0xEE, 0x99, 0x99, 0x94, 0xDD, 0xF2, 0xC9, 0xCD,
+        0x5E, 0x6A, 0xE0, 0xC3, 0xBA, 0xAB, 0x51, 0x04, 0xB7, 0x4E, 0x1E, 0xDB,
+        0x6B, 0xD9, 0x3E, 0x92, 0x54, 0xB3, 0x2C, 0x1D, 0x27, 0x2C, 0x3E, 0xDE,
+        0x73, 0xAB, 0x96, 0xBC, 0xB7, 0x8E, 0xF5, 0xA9, 0x79, 0xDC, 0x6C, 0xEB,
+        0xF4, 0x8A, 0xEA, 0x5A, 0xF3, 0x96, 0xB6, 0x5D, 0xF5, 0x17, 0x19, 0x73,
+        0x57, 0x49, 0x2A, 0x54, 0xBF, 0x33, 0xC5, 0xE9, 0x9D, 0x48, 0x60, 0xCD,
+        0x52, 0x91, 0x02, 0x7A, 0xD7, 0xB0, 0x73, 0x7B, 0xAB, 0x27, 0x38, 0xD2,
+        0x26, 0x7D, 0xEC, 0x9E, 0xA6, 0x8B, 0xB6, 0xB4, 0xA8, 0xCC, 0x3A, 0x9D,
+        0x1C, 0x43, 0x1D, 0xFA, 0xB8, 0xCC, 0xB2, 0x56, 0x6B, 0x9A, 0xC4, 0xF9,
+        0xBD, 0xB1, 0xE0, 0xA5, 0xA6, 0xB9, 0x6C, 0xD7, 0x4E, 0x9A, 0x2B, 0x6D,
+        0x08, 0x8E, 0x97, 0x30, 0x7E, 0xB0, 0x65, 0x66, 0x22, 0x45, 0x55, 0x45,
+        0x4A, 0x15, 0xD5, 0x74, 0x99, 0x39, 0xD4, 0xC8, 0xBE, 0x0C, 0x80, 0x2C,
+        0x1D, 0xD2, 0x62, 0x72, 0xC2, 0xB7, 0x67, 0x7D, 0x89, 0x1E, 0x4E, 0x36,
+        0xB9, 0x4D, 0x89, 0xE4, 0x55, 0x61, 0xC2, 0xE1, 0x07, 0x20, 0x9B, 0x16,
+        0x3D, 0x19, 0x2B, 0xF5, 0x8E, 0x07, 0x7A, 0x3E, 0x59, 0x32, 0x3B, 0x31,
+        0x3D, 0xCE, 0x6E, 0x97, 0xBB, 0x9D, 0x5D, 0x37, 0xCB, 0x43, 0x2D, 0x79,
+        0x50, 0x56, 0x33, 0x65, 0x85, 0xDB, 0xF3, 0xF1, 0x16, 0x13, 0xC6, 0x25,
+        0xDA, 0x9E, 0xED, 0xF7, 0x23, 0xBD, 0x71, 0x64, 0xD2, 0xBA, 0x89, 0x53,
+        0x5A, 0x71, 0x69, 0x4A, 0x4A, 0x69, 0x6C, 0xAD, 0xB5, 0xBE, 0xA8, 0x32,
+        0xC7, 0x43, 0x89, 0x91, 0xB5, 0x9C, 0xB4, 0x12, 0x16, 0xC2, 0x94, 0xD8,
+        0xEF, 0xAC, 0xCE, 0x6A, 0x86, 0x2F, 0x4C, 0xAB, 0xA5, 0xF4, 0x0E, 0x59,
+        0x9D, 0x64, 0x8E, 0x56, 0x67, 0xDB, 0x51, 0x6D, 0xAD, 0xBC, 0x4F, 0xAE,
+        0xBA, 0xBD, 0x63, 0x5F, 0x4D, 0xDA, 0x03, 0x75, 0x85, 0xB5, 0x37, 0x43,
+        0x2A, 0xB9, 0x98, 0x4A, 0x0B, 0xBB, 0x2E, 0x9F, 0x92, 0x0B, 0x6E, 0x36,
+        0x97, 0x9D, 0x4E, 0x39, 0xD9, 0x01, 0x2F, 0x48, 0xBE, 0xC7, 0x64, 0x71,
+        0x3D, 0x47, 0x30, 0x8E, 0x5B, 0x1E, 0x35, 0x93, 0xCD, 0x4C, 0x5D, 0x98,
+        0x2B, 0x0A, 0x2F, 0x57, 0x68, 0x27, 0x99, 0x99, 0x01, 0x6E, 0x62, 0xCA,
+        0x44, 0x9B, 0x6F, 0x9B, 0x74, 0x56, 0xCB, 0xD4, 0xD8, 0x74, 0x43, 0xD3,
+        0xF6, 0x58, 0x29, 0x6B, 0x54, 0xB4, 0x34, 0x36, 0x9E, 0x2D, 0x9A, 0xE3,
+        0x63, 0x93, 0xDE, 0x64, 0xE6, 0x1D, 0xB2, 0x27, 0x33, 0x27, 0x37, 0xB3,
+        0x17, 0x99, 0xDD, 0xB2, 0xD4, 0x23, 0x27, 0x59, 0xBD, 0x37, 0x59, 0x18,
+        0x35, 0x31, 0x2B, 0xF1, 0xD4, 0x6E, 0x7F, 0xA2, 0x57, 0x2C, 0x89, 0x93,
+        0x58, 0x72, 0x21, 0x77, 0xB6, 0x40, 0x6E, 0xD2, 0x9C, 0x62, 0xCC, 0x2A,
+        0xAD, 0x11, 0xB9, 0xE5, 0x17, 0xB5, 0xA6, 0x30, 0xB7, 0x29, 0x8E, 0x38,
+        0x36, 0x57, 0xA3, 0xE9, 0x60, 0xDA, 0xC9, 0xD0, 0xD9, 0x49, 0x32, 0x83,
+        0x1B, 0xFC, 0x88, 0xEE, 0x6C, 0x7A, 0x27, 0x33, 0xC7, 0x56, 0x4C, 0x6A,
+        0x9A, 0xCB, 0xD6, 0xFB, 0x0B, 0x1D, 0xAB, 0x26, 0x4F, 0xD9, 0xA9, 0x48,
+        0xEB, 0x47, 0x7E, 0x20, 0xB8, 0x25, 0x76, 0x45, 0x10, 0x8D, 0x05, 0xE5,
+        0x76, 0xDC, 0x56, 0xBD, 0xD8, 0x3F, 0xD8, 0xC9, 0xE1, 0x49, 0x1C, 0x6E,
+        0x06, 0x23, 0x62, 0x83, 0x09, 0x8C, 0x20, 0x35, 0xF9, 0x3A, 0xB6, 0x53,
+        0x39, 0x9E, 0x9A, 0xD5, 0x4A, 0xAB, 0xA3, 0x4C, 0x1E, 0x59, 0x3C, 0xBD,
+        0x1E, 0xB4, 0xE7, 0x5B, 0x66, 0x34, 0x9B, 0xF2, 0x06, 0xF0, 0x95, 0xF4,
+        0x42, 0xBA, 0xDA, 0xC4, 0xA9, 0xFA, 0xA8, 0x3B, 0x39, 0x9C, 0xBA, 0x56,
+        0x55, 0x26, 0xAD, 0xF5, 0x9A, 0xB1, 0x1A, 0x45, 0xC7, 0xAE, 0xBB, 0xB6,
+        0x5A, 0x90, 0x5A, 0xC7, 0x31, 0xB9, 0xDD, 0x96, 0xED, 0x5E, 0x6F, 0x79,
+        0x68, 0x6B, 0x5D, 0xF6, 0xD0, 0xB0, 0x4A, 0xEB, 0xE2, 0xA6, 0x22, 0xB0,
+        0x07, 0x79, 0x59, 0x29, 0xF2, 0x95, 0x7E, 0xA9, 0x39, 0xEC, 0xEC, 0x0A,
+        0x63, 0x73, 0x5C, 0x37, 0xAA, 0x53, 0x15, 0x08, 0xE1, 0x66, 0x69, 0x9B,
+        0x2B, 0xAC, 0xEB, 0x83, 0x41, 0x7F, 0x58, 0xAE, 0xF7, 0xED, 0xF5, 0xAA,
+        0x6E, 0x3B, 0x84, 0xA2, 0x0E, 0x27, 0x64, 0xB5, 0x55, 0xD1, 0xA6, 0xD9,
+        0x42, 0x6F, 0x39, 0x9F, 0xAE, 0xCA, 0x54, 0x63, 0xCD, 0xB2, 0x73, 0x87,
+        0x65, 0xAB, 0x1D, 0x4B, 0x5D, 0x16, 0x1D, 0xBC, 0x7A, 0x60, 0xDB, 0xF5,
+        0xBE, 0x3C, 0xC4, 0x75, 0xB6, 0xD8, 0x18, 0xEE, 0x25, 0xD6, 0xB1, 0xBA,
+        0x2A, 0x5B, 0x28, 0x6A, 0x7A, 0x1F, 0x3F, 0x56, 0x87, 0x1B, 0xE6, 0xC8,
+        0xB6, 0x67, 0x53, 0x60, 0x0A, 0x94, 0xBB, 0x83, 0x02, 0x5D, 0x3E, 0x2A,
+        0x4B, 0xE0, 0x1E, 0x6E, 0x45, 0xBA, 0x54, 0x3C, 0x65, 0xBB, 0x4B, 0xD2,
+        0xA4, 0x9D, 0x5E, 0x7B, 0x7B, 0x10, 0x4B, 0xC7, 0xF1, 0xB4, 0x42, 0x1C,
+        0x2D, 0x5A, 0x1C, 0x17, 0x73, 0x8B, 0xFE, 0x82, 0xCA, 0xD5, 0x06, 0xDB,
+        0x1C, 0x41, 0x2E, 0xCD, 0x69, 0x53, 0x9F, 0x35, 0xB7, 0x0C, 0xC6, 0xF4,
+        0x9A, 0x85, 0xF5, 0x71, 0x6A, 0x55, 0x88, 0x52, 0x69, 0x4A, 0x54, 0xBB,
+        0x93, 0xFD, 0xF6, 0xA4, 0x97, 0x1D, 0x73, 0xAE, 0xCA, 0xD5, 0x43, 0x96,
+        0x3C, 0x16, 0x47, 0x15, 0xAD, 0x9B, 0x1C, 0xB6, 0x74, 0xA5, 0xB5, 0xDF,
+        0x61, 0x6C, 0xDB, 0x5D, 0x8B, 0x94, 0x36, 0xED, 0x4B, 0x8E, 0x3C, 0xC5,
+        0xEA, 0x22, 0x81, 0x4F, 0x06, 0x8A, 0x23, 0x6E, 0x6D, 0x0C, 0xF8, 0x2E,
+        0xEA, 0x7C, 0xD3, 0x69, 0x6F, 0xA9, 0x49, 0x6E, 0x34, 0x6A, 0x97, 0xCA,
+        0xEE, 0x90, 0x74, 0x86, 0x85, 0xA4, 0x41, 0x64, 0xBA, 0x92, 0x5E, 0xC2,
+        0xF6, 0xAD, 0x59, 0x9D, 0xC9, 0x6D, 0x2A, 0xA3, 0x42, 0x37, 0x53, 0x9A,
+        0x68, 0x4B, 0x4A, 0x1D, 0x54, 0x56, 0x56, 0x72, 0xD9, 0xCC, 0x61, 0x2B,
+        0x63, 0x47, 0x71, 0x0E, 0xC3, 0xBA, 0xBA, 0x89, 0x69, 0x9C, 0x9D, 0xE9,
+        0xB1, 0xFA, 0x69, 0xBC, 0xAD, 0x12, 0x16, 0x7F, 0x1C, 0x73, 0xFD, 0xAE,
+        0x36, 0x4E, 0xCE, 0xDD, 0xAA, 0x44, 0xA8, 0x56, 0x19, 0xCC, 0xB7, 0x02,
+        0xE2, 0xE9, 0x34, 0xEF, 0x92, 0x53, 0x9E, 0xD9, 0xB1, 0xC0, 0x6D, 0x56,
+        0xDA, 0xB9, 0xE6, 0x69, 0x33, 0xC7, 0x28, 0xB2, 0x61, 0xF2, 0x39, 0x96,
+        0x5B, 0x11, 0x39, 0x49, 0xD3, 0xD8, 0x1C, 0x3F, 0x36, 0x6B, 0xC9, 0x74,
+        0x9B, 0x69, 0xA9, 0x12, 0x8B, 0x33, 0x54, 0x79, 0x46, 0x01, 0x11, 0x50,
+        0xA9, 0x39, 0x93, 0x53, 0x83, 0x21, 0x72, 0x56, 0x4E, 0x9E, 0x6C, 0x8D,
+        0x6A, 0x63, 0x68, 0x65, 0x48, 0xA9, 0x4E, 0x27, 0xA7, 0x95, 0xBD, 0xC4,
+        0xEC, 0xA7, 0x5D, 0xB7, 0x33, 0x39, 0x1E, 0x18, 0x89, 0x35, 0xE9, 0x42,
+        0x4F, 0xDF, 0x69, 0x9D, 0xE2, 0x26, 0x79, 0x9C, 0x26, 0x3B, 0x49, 0xAA,
+        0xBB, 0x16, 0x87, 0x15, 0x57, 0x1C, 0x0F, 0x06, 0x2A, 0x9B, 0x6B, 0x8E,
+        0x0F, 0x27, 0xB5, 0x4E, 0xCA, 0xF6, 0x28, 0x03, 0x08, 0xCB, 0x96, 0x8B,
+        0xAE, 0xBB, 0x2A, 0xB6, 0x8B, 0x9B, 0xF9, 0xAA, 0xD8, 0x6B, 0x0F, 0x6A,
+        0xEC, 0xA6, 0x0F, 0x28, 0x5E, 0x5F, 0xB5, 0xC7, 0xAB, 0xE2, 0x72, 0x0B,
+        0x2E, 0xEC, 0x46, 0xBF, 0x5B, 0x37, 0x59, 0x61, 0x35, 0x6C, 0x18, 0x2A,
+        0x8B, 0x29, 0x9B, 0xEA, 0xA1, 0xC9, 0x32, 0xC0, 0xBC, 0x18, 0x8E, 0x95,
+        0x46, 0xA3, 0xDF, 0xD6, 0x26, 0x87, 0x99, 0x39, 0x9B, 0xE1, 0xC9, 0xAA,
+        0x85, 0x77, 0xD5, 0x79, 0x7D, 0xAC, 0x18, 0x25, 0xB1, 0x33, 0x9C, 0x57,
+        0x17, 0xD2, 0x58, 0x22, 0xF5, 0x6E, 0xE7, 0xA4, 0xF2, 0xC7, 0xB9, 0x7D,
+        0x5A, 0x57, 0x93, 0xF3, 0x89, 0xD1, 0xAF, 0xE8, 0x62, 0x41, 0xEB, 0x35,
+        0x4A, 0xD3, 0x83, 0xA3, 0x19, 0xE9, 0xD5, 0x66, 0x97, 0x91, 0xD2, 0x44,
+        0x2E, 0x77, 0xD8, 0xCC, 0xE7, 0x7D, 0xC2, 0x6E, 0x4E, 0x92, 0xEB, 0x6A,
+        0xAB, 0x8F, 0x2F, 0xAD, 0x85, 0x24, 0x2B, 0xBA, 0x52, 0xED, 0x6D, 0x5A,
+        0x5D, 0xA2, 0xC8, 0x4C, 0xE9, 0xE9, 0x56, 0x6E, 0x93, 0x86, 0x99, 0x3D,
+        0x8E, 0x31, 0xB3, 0x44, 0x54, 0x24, 0xF0, 0x8F, 0x57, 0xD7, 0xC7, 0x55,
+        0x6D, 0xE2, 0xCC, 0x66, 0xE9, 0xE5, 0x52, 0x29, 0xCB, 0x4B, 0x21, 0x77,
+        0x4A, 0x92, 0x2B, 0xB7, 0x33, 0xB7, 0x4B, 0xB5, 0xD6, 0x66, 0x4F, 0x88,
+        0x6B, 0x27, 0xB3, 0xEF, 0x1D, 0xA5, 0xFA, 0xA4, 0x6A, 0x11, 0x4E, 0x6D,
+        0xDA, 0x64, 0x86, 0xF2, 0x94, 0x30, 0xE5, 0x01, 0x7E, 0x04, 0x16, 0xCD,
+        0x5A, 0xD5, 0x1A, 0xE6, 0xBC, 0xC0, 0x4A, 0x8D, 0x6D, 0xA9, 0x3B, 0x9D,
+        0x0E, 0x87, 0x5A, 0x56, 0x2B, 0x1C, 0xDB, 0x45, 0x7D, 0x94, 0x99, 0xAD,
+        0x81, 0xF8, 0x63, 0xD9, 0xA7, 0x84, 0x0C, 0x03, 0x31, 0xCE, 0x8F, 0x6F,
+        0x28, 0xA8, 0xF2, 0xED, 0xE9, 0x23, 0x6F, 0x19, 0x86, 0xF3, 0x9E, 0x4A,
+        0x99, 0x96, 0xA2, 0xE5, 0xBF, 0x93, 0x0C, 0x97, 0x23, 0x85, 0xD7, 0x54,
+        0x4A, 0xB2, 0xAC, 0xFC, 0xF7, 0xAC, 0x84, 0x53, 0x38, 0x05, 0xEE, 0x78,
+        0x4E, 0xD8, 0xE4, 0xBF, 0x4B, 0xE8, 0x07, 0xDC, 0x3A, 0x1C, 0x9F, 0xFF,
+        0x2E, 0xCB, 0x32, 0xB8, 0x84, 0x01, 0x9A, 0xFC, 0x77, 0x1C, 0xC7, 0xFD,
+        0x6B, 0x02, 0x8C, 0x41, 0x92, 0xFE, 0x0D, 0x99, 0xFF, 0x9E, 0xC3, 0xE1,
+        0x1F, 0xFF, 0xFE, 0x4D, 0xD1, 0xF7, 0x41, 0x47, 0x91, 0xB3, 0xC0, 0x90,
+        0x5C, 0x16, 0xFE, 0x81, 0x43, 0xAE, 0x76, 0x1A, 0x18, 0x34, 0x97, 0xCB,
+        0x81, 0x1B, 0x5B, 0x58, 0x49, 0x9A, 0x94, 0x57, 0x61, 0x98, 0x08, 0xCD,
+        0x6E, 0x4B, 0x6F, 0xAE, 0x22, 0x3A, 0xAB, 0x3C, 0x45, 0x63, 0xE6, 0x01,
+        0x3C, 0xDA, 0x29, 0x91, 0x07, 0xF6, 0x8A, 0x13, 0xF3, 0xDF, 0x31, 0xF4,
+        0xC3, 0x05, 0xF3, 0xBF, 0xC9, 0x79, 0xCD, 0xD0, 0x0D, 0xDB, 0xE4, 0x04,
+        0x08, 0xB6, 0x26, 0xE9, 0xBB, 0xB7, 0x55, 0x1E, 0xC7, 0x40, 0x97, 0x8F,
+        0xEF, 0x8E, 0xE2, 0xA8, 0xD2, 0x9B, 0x00, 0x9A, 0x3D, 0x7F, 0xD7, 0x38,
+        0x45, 0xF7, 0x2F, 0x45, 0x69, 0x0F, 0xAC, 0x48, 0xFB, 0x1D, 0x28, 0xD8,
+        0x94, 0x37, 0xC5, 0x9E, 0xB3, 0x7E, 0x5C, 0x66, 0x7C, 0xFA, 0x58, 0x39,
+        0x9A, 0xFA, 0xBE, 0xF2, 0x62, 0x58, 0x60, 0xAC, 0xBF, 0x7F, 0xF0, 0x86,
+        0x78, 0x7C, 0x4F, 0xB9, 0x12, 0xBF, 0x51, 0x1C, 0x80, 0x1B, 0x33, 0xB5,
+        0x02, 0xEF, 0x10, 0xF0, 0x29, 0xC1, 0x50, 0x0D, 0x2B, 0xEF, 0x58, 0x9C,
+        0x0E, 0x80, 0xB0, 0x24, 0xDD, 0x79, 0xD5, 0x38, 0x6B, 0xA9, 0xE8, 0x79,
+        0xEC, 0x15, 0xE2, 0x74, 0x69, 0x19, 0x3B, 0x5D, 0xF4, 0x67, 0x80, 0x0F,
+        0x9E, 0x5E, 0xBD, 0x39, 0xE1, 0xB8, 0xAF, 0xA1, 0x39, 0x5E, 0xC3, 0xC1,
+        0x36, 0xAF, 0xB9, 0xB7, 0xC0, 0x27, 0x3F, 0xC8, 0xA6, 0x9C, 0xA4, 0x3C,
+        0xCE, 0x00, 0x54, 0x08, 0x3B, 0xCB, 0x06, 0x53, 0x8A, 0x92, 0xCC, 0xED,
+        0x54, 0xE7, 0x35, 0x0A, 0x67, 0x3E, 0x1F, 0x00, 0x6A, 0x0B, 0x96, 0xA1,
+        0xAA, 0x3C, 0x67, 0xBD, 0x7B, 0x53, 0xC2, 0xCE, 0x7E, 0x6B, 0x70, 0x79,
+        0xAF, 0x71, 0x0A, 0xAC, 0x45, 0xD8, 0xBC, 0x87, 0x80, 0x47, 0x48, 0xBF,
+        0xDF, 0x1C, 0xD2, 0xF5, 0xFD, 0x66, 0xAD, 0xE8, 0xF1, 0xD3, 0x2B, 0x6F,
+        0x58, 0xA2, 0x64, 0xA5, 0x2C, 0x4E, 0x54, 0x76, 0x76, 0x9E, 0x02, 0xD3,
+        0xBE, 0x20, 0xB2, 0xBC, 0xDF, 0x62, 0x81, 0xCC, 0x02, 0xF8, 0x7C, 0xE4,
+        0x71, 0x3B, 0xC7, 0xF8, 0x78, 0xD9, 0x4B, 0x96, 0xAD, 0x18, 0xFA, 0x7B,
+        0x08, 0x01, 0x60, 0x84, 0xAB, 0x10, 0x23, 0x05, 0x20, 0x7B, 0x59, 0x49,
+        0x9C, 0x18, 0x33, 0x20, 0x62, 0x9C, 0x1B, 0xC0, 0xE0, 0x36, 0x78, 0x7A,
+        0x35, 0x0D, 0x5B, 0x71, 0xC0, 0xD8, 0x79, 0x59, 0x39, 0x48, 0xE2, 0xEB,
+        0x29, 0xA5, 0xE8, 0xA2, 0x74, 0xC8, 0x53, 0x00, 0xE0, 0x03, 0x62, 0x35,
+        0xC3, 0xCD, 0x83, 0xEE, 0x09, 0xF8, 0x8F, 0xF1, 0xFF, 0xF7, 0xFA, 0xC3,
+        0x97, 0x4F, 0xFE, 0x2A, 0x00, 0xBB, 0xEB, 0xEF, 0x21, 0x90, 0x13, 0x38,
+        0x9C, 0xD2, 0x63, 0x09, 0x77, 0xA5, 0x38, 0x52, 0x88, 0x76, 0x04, 0x11,
+        0x01, 0x9D, 0x37, 0x54, 0xF1, 0x02, 0x87, 0x25, 0xA9, 0x9C, 0xA3, 0xEC,
+        0xA5, 0x57, 0xC7, 0x30, 0xF3, 0x24, 0x58, 0x44, 0x10, 0x33, 0x95, 0x55,
+        0xE9, 0xF0, 0xCA, 0x01, 0x66, 0xD3, 0x53, 0x60, 0x40, 0xCD, 0xCE, 0x0B,
+        0x80, 0xC9, 0x24, 0xEB, 0x75, 0xBD, 0xB3, 0x1D, 0x45, 0x3E, 0xA6, 0x20,
+        0x53, 0x83, 0x27, 0x79, 0xB4, 0x07, 0x52, 0xBC, 0xE4, 0xB8, 0x92, 0xA4,
+        0x07, 0xF0, 0x59, 0x86, 0xFB, 0x1E, 0x0C, 0xA4, 0xE8, 0xAA, 0xA2, 0x83,
+        0x16, 0x28, 0x06, 0xEB, 0x33, 0x91, 0x69, 0x28, 0x70, 0xB0, 0x8F, 0x17,
+        0x45, 0x08, 0xF0, 0x1C, 0x86, 0x2E, 0xCC, 0x93, 0xBF, 0xC5, 0x04, 0x80,
+        0x7F, 0x0B, 0xAD, 0x8F, 0x8C, 0x60, 0x5B, 0x37, 0x74, 0xC9, 0x27, 0xBF,
+        0x77, 0xBD, 0xB3, 0x01, 0x23, 0xD8, 0x92, 0x2A, 0x09, 0x0E, 0x7A, 0xE0,
+        0x4D, 0xFA, 0xA6, 0x29, 0x61, 0x02, 0x13, 0x88, 0x45, 0x6C, 0x13, 0x20,
+        0x56, 0xD1, 0x97, 0xE7, 0x3D, 0xC7, 0xE9, 0x0A, 0x90, 0x69, 0x10, 0x4F,
+        0xF0, 0x55, 0x02, 0x7B, 0x61, 0xEC, 0x04, 0x5C, 0x0D, 0x67, 0x25, 0x14,
+        0x1D, 0x0A, 0x5D, 0x80, 0xEA, 0x94, 0x66, 0x9C, 0xBE, 0xD4, 0xF0, 0x0B,
+        0x6D, 0x3E, 0xFE, 0x85, 0x46, 0xDB, 0x48, 0x47, 0xD9, 0xE2, 0x34, 0xC9,
+        0x4E, 0xC0, 0x96, 0xEF, 0x90, 0xB9, 0xDE, 0xD1, 0x0B, 0xB4, 0xDF, 0xA1,
+        0xA0, 0x05, 0xC2, 0xD5, 0xE1, 0x1C, 0xE9, 0x07, 0x99, 0xC1, 0x44, 0x69,
+        0xF9, 0xF4, 0x01, 0x3A, 0xFA, 0x20, 0xC7, 0xF6, 0x0D, 0x44, 0xC8, 0xFD,
+        0xEE, 0x7F, 0xA4, 0xDB, 0xEB, 0xFD, 0xF1, 0x5E, 0x94, 0xB7, 0x95, 0x01,
+        0xF6, 0xD1, 0xFB, 0x35, 0xC1, 0x7D, 0x21, 0x04, 0x69, 0x76, 0x6E, 0x92,
+        0xF7, 0x1A, 0xCA, 0x8A, 0x0A, 0x1A, 0xE4, 0x79, 0x0B, 0xB2, 0x81, 0x2E,
+        0xD9, 0xF6, 0x0F, 0xEC, 0x25, 0xF7, 0x74, 0x69, 0xC5, 0x09, 0x90, 0x4D,
+        0x63, 0x9B, 0x65, 0x9F, 0xBC, 0xBD, 0xF8, 0xC6, 0x3B, 0xBA, 0x1D, 0xCF,
+        0x77, 0xB2, 0x6A, 0x70, 0x4E, 0x1E, 0x75, 0xFA, 0x78, 0x81, 0xDC, 0x02,
+        0xDB, 0x9E, 0x9B, 0x22, 0x3E, 0x89, 0x6C, 0x19, 0x93, 0x13, 0x45, 0xC0,
+        0x0A, 0x70, 0x37, 0xFA, 0x50, 0xEF, 0x74, 0x5B, 0x72, 0xFE, 0x43, 0xD1,
+        0x4C, 0xC3, 0x72, 0x38, 0x1D, 0x8C, 0x03, 0x85, 0x7B, 0x78, 0x1B, 0xBE,
+        0x5E, 0x44, 0x3B, 0x85, 0xD8, 0x12, 0xF0, 0x58, 0x2A, 0x2C, 0x6B, 0xE3,
+        0x25, 0xB3, 0x37, 0x10, 0xDA, 0xD3, 0xFE, 0xA4, 0x29, 0xB8, 0x19, 0x33,
+        0xF4, 0x45, 0x2E, 0x41, 0x31, 0x40, 0x43, 0x9C, 0xF9, 0xFA, 0x44, 0x0D,
+        0x8B, 0x1D, 0x6F, 0xDF, 0x5F, 0x64, 0xF7, 0xD3, 0xEB, 0xD5, 0xBA, 0xA2,
+        0xFA, 0xE6, 0xA2, 0xF4, 0x9E, 0xAE, 0xC5, 0x9E, 0x6E, 0x38, 0x40, 0x41,
+        0xBD, 0x47, 0x87, 0x83, 0xBA, 0xF5, 0xE9, 0x9E, 0x3C, 0xBB, 0x23, 0xB6,
+        0xA0, 0xE8, 0x66, 0x22, 0x42, 0x18, 0x8A, 0xD9, 0x88, 0xF8, 0xE3, 0x0D,
+        0xC7, 0x31, 0x34, 0x6F, 0x0B, 0xAB, 0x92, 0x0C, 0x45, 0xE7, 0xDF, 0x43,
+        0x4C, 0x85, 0xAE, 0x54, 0xC8, 0x57, 0x29, 0xF0, 0xE2, 0x19, 0xFE, 0x7A,
+        0x3A, 0xD3, 0x05, 0x89, 0xBC, 0x10, 0xCD, 0xE0, 0x6D, 0x20, 0x4E, 0x89,
+        0x6B, 0x0C, 0x18, 0x40, 0x44, 0x29, 0xCE, 0x31, 0x8F, 0x85, 0xD9, 0x5C,
+        0xE6, 0x44, 0x29, 0x65, 0xEC, 0x9C, 0x77, 0xD9, 0x32, 0xB4, 0xF7, 0xA0,
+        0x09, 0x52, 0x67, 0x8E, 0x71, 0xBE, 0x07, 0x77, 0x37, 0x9D, 0xA0, 0xE0,
+        0x08, 0xF7, 0xB9, 0xEE, 0x81, 0x46, 0x80, 0xA2, 0x84, 0xD3, 0x11, 0x8F,
+        0x45, 0x36, 0x80, 0x87, 0xDD, 0xEF, 0x42, 0x06, 0x2A, 0xB7, 0x57, 0x47,
+        0x3A, 0x38, 0x29, 0x51, 0x12, 0x0C, 0xCB, 0x13, 0x0C, 0x00, 0xBD, 0x92,
+        0x05, 0xD9, 0x36, 0xA0, 0xC6, 0x1B, 0x62, 0xDF, 0xF7, 0xEB, 0x44, 0xD6,
+        0x1D, 0x05, 0x1F, 0x60, 0x86, 0x3E, 0xEB, 0x82, 0x30, 0x4F, 0x5C, 0x13,
+        0x23, 0xC4, 0x5B, 0xE0, 0x32, 0x81, 0xD3, 0x57, 0xC8, 0x44, 0xB7, 0x61,
+        0xB9, 0x09, 0xE1, 0xFC, 0x78, 0x91, 0x81, 0x41, 0x27, 0x59, 0x31, 0x1A,
+        0x8F, 0xB8, 0xA8, 0x50, 0xC4, 0xBA, 0x29, 0x22, 0x17, 0xA7, 0x02, 0x81,
+        0x75, 0x77, 0xC3, 0x31, 0xF8, 0x59, 0xC1, 0xC1, 0xB7, 0xC1, 0x1C, 0x70,
+        0x33, 0x80, 0x99, 0xC2, 0x7B, 0xCB, 0x9B, 0x55, 0x56, 0x9C, 0x40, 0xF3,
+        0xDC, 0xD1, 0x61, 0x90, 0x85, 0x6E, 0x05, 0xD7, 0x99, 0x95, 0xE6, 0x3F,
+        0x3C, 0x36, 0x4A, 0x69, 0xF6, 0xA3, 0xD7, 0xF7, 0x5F, 0x5D, 0x83, 0x98,
+        0xE0, 0x6E, 0xF6, 0x0B, 0xF1, 0x74, 0x43, 0x56, 0xC4, 0x85, 0x21, 0x81,
+        0x92, 0xB8, 0x45, 0x77, 0x58, 0xAE, 0x5C, 0x4F, 0xE0, 0xCB, 0xC7, 0x1B,
+        0x8A, 0x7E, 0xBC, 0x08, 0xF2, 0xF2, 0x0D, 0x38, 0xBA, 0x12, 0x90, 0x06,
+        0x50, 0xE9, 0xA7, 0x90, 0x2A, 0x06, 0x93, 0xB9, 0x16, 0x67, 0x7A, 0x6F,
+        0x2F, 0xEA, 0xD5, 0x9B, 0x28, 0x7B, 0x16, 0x66, 0x04, 0x04, 0x21, 0x56,
+        0x54, 0x22, 0xE0, 0x91, 0xE2, 0x0F, 0x54, 0xBE, 0x4F, 0x59, 0xCB, 0xB3,
+        0x6E, 0xA0, 0x18, 0x42, 0x63, 0x47, 0xE4, 0x67, 0x88, 0x2D, 0x22, 0x96,
+        0x63, 0x58, 0xBF, 0xD3, 0x80, 0xEB, 0x63, 0x30, 0xF6, 0x65, 0x21, 0x05,
+        0x67, 0x86, 0xF2, 0xCF, 0x87, 0xC9, 0x97, 0x20, 0x78, 0x58, 0x62, 0xE3,
+        0xBE, 0x20, 0xA2, 0xBD, 0xFF, 0x23, 0x9C, 0x8F, 0x63, 0x5F, 0x62, 0xCD,
+        0x04, 0x86, 0x8C, 0x2A, 0x34, 0x90, 0x6F, 0xFD, 0x93, 0x98, 0x37, 0x7D,
+        0xD8, 0xB8, 0x41, 0x56, 0xD2, 0x43, 0x93, 0x28, 0xCE, 0x86, 0x0A, 0xED,
+        0x54, 0xCF, 0x74, 0x0B, 0x29, 0x0A, 0x4F, 0x37, 0x82, 0x07, 0x0A, 0x12,
+        0x1F, 0xD7, 0xA8, 0xBC, 0x70, 0xC9, 0x79, 0x8C, 0xEC, 0x35, 0xEF, 0x78,
+        0x94, 0x31, 0x6F, 0x81, 0x84, 0xBF, 0x52, 0xA2, 0x62, 0x81, 0xED, 0x8C,
+        0xF6, 0x8C, 0xE1, 0xC6, 0x41, 0xE6, 0xA3, 0x15, 0x09, 0x63, 0x24, 0x52,
+        0x2F, 0x84, 0x21, 0x88, 0x8B, 0x2A, 0x44, 0x42, 0x2E, 0x3C, 0xD7, 0x1B,
+        0x40, 0xE0, 0xFB, 0xD9, 0x03, 0xB9, 0x74, 0x42, 0x3A, 0xF3, 0xBA, 0x25,
+        0x10, 0xFD, 0x21, 0x1F, 0x08, 0xCF, 0x62, 0x01, 0x43, 0x01, 0xDF, 0x0C,
+        0x88, 0x3A, 0x7F, 0x32, 0xEC, 0xE2, 0x34, 0x10, 0xE7, 0x16, 0xC8, 0xE0,
+        0x8E, 0xC8, 0xFC, 0x30, 0x73, 0x65, 0x62, 0x98, 0xCB, 0xDF, 0x27, 0x82,
+        0xAA, 0x08, 0x1B, 0x8E, 0x07, 0x1E, 0x40, 0xD4, 0x04, 0xF5, 0x61, 0x8B,
+        0x60, 0xFA, 0xCA, 0x84, 0xBC, 0xEF, 0x23, 0x85, 0x98, 0xFE, 0xC6, 0xE5,
+        0xB8, 0x27, 0xA7, 0x6F, 0x65, 0x73, 0xA0, 0xF6, 0x11, 0xDA, 0x33, 0x71,
+        0xFC, 0x00, 0x91, 0xE7, 0x42, 0x7E, 0xB8, 0x99, 0x25, 0x01, 0x59, 0x95,
+        0xBA, 0x6C, 0x4A, 0x33, 0x2F, 0x1B, 0xC2, 0xCE, 0x7E, 0x07, 0xAA, 0x0D,
+        0x6E, 0x6A, 0xDF, 0xE4, 0x85, 0xEF, 0x40, 0x77, 0x44, 0xA6, 0x58, 0x8D,
+        0x74, 0xE5, 0xA4, 0x84, 0x24, 0x55, 0x26, 0x18, 0x19, 0xF6, 0xFE, 0x94,
+        0xF3, 0x7D, 0x2E, 0x42, 0xBC, 0x06, 0xA5, 0x50, 0xFE, 0x22, 0x8A, 0xFC,
+        0xD9, 0xEF, 0x5A, 0x7B, 0xF8, 0x0B, 0x4E, 0x3F, 0x5D, 0x37, 0xFD, 0xC4,
+        0xE4, 0xF3, 0x9B, 0x46, 0x19, 0xE2, 0xC1, 0xF2, 0x3C, 0x61, 0x03, 0x0C,
+        0x40, 0x30, 0x81, 0x6E, 0xBC, 0x81, 0x75, 0xBE, 0x9F, 0xD7, 0x7A, 0x99,
+        0xFA, 0x5A, 0xE5, 0xA2, 0x75, 0x86, 0xB7, 0x45, 0x8A, 0xA4, 0xCF, 0xFB,
+        0x00, 0x5D, 0x06, 0x56, 0x07, 0x1E, 0x19, 0x82, 0x78, 0x30, 0x06, 0x73,
+        0xD9, 0x4B, 0x0C, 0x16, 0x3B, 0xC6, 0x63, 0xB1, 0x0F, 0x1C, 0x06, 0x23,
+        0xD8, 0x6F, 0x48, 0x4E, 0xE1, 0x21, 0xB9, 0x2C, 0x1B, 0x11, 0xB5, 0x84,
+        0xC8, 0xFA, 0x71, 0x8E, 0x40, 0x2C, 0x2D, 0x45, 0x4C, 0x81, 0x5D, 0x6F,
+        0x42, 0xB5, 0x06, 0x23, 0x09, 0x3B, 0x4D, 0xB7, 0x81, 0x16, 0x35, 0x25,
+        0xCE, 0xF9, 0x01, 0xC5, 0x6C, 0x0A, 0xA8, 0xD9, 0x67, 0xC0, 0x83, 0x60,
+        0x9B, 0xFE, 0xC0, 0x33, 0x60, 0xF8, 0x67, 0x5C, 0xB6, 0x9E, 0xA0, 0x31,
+        0x0E, 0xC6, 0x7E, 0x03, 0x6C, 0xB5, 0xB9, 0x1D, 0x3E, 0xCE, 0xCF, 0x0A,
+        0x5A, 0xE7, 0x63, 0x7D, 0x81, 0x07, 0xC6, 0x8F, 0xB7, 0xBC, 0xCB, 0x26,
+        0x40, 0x84, 0x0D, 0x48, 0x45, 0xFA, 0x52, 0xF3, 0xE3, 0xC5, 0x5B, 0xD0,
+        0x7B, 0x8C, 0x1C, 0x8B, 0x75, 0x3B, 0xC2, 0xA6, 0x01, 0x92, 0xF5, 0xCA,
+        0x09, 0x8E, 0xE7, 0x6F, 0x29, 0xF0, 0xC4, 0xF3, 0xE5, 0xE2, 0x5F, 0xC5,
+        0x3F, 0xF5, 0xE1, 0x43, 0xB6, 0x7A, 0x00, 0x1F, 0x15, 0x11, 0x93, 0x1E,
+        0x94, 0xBE, 0x49, 0x73, 0x4F, 0xF3, 0xDC, 0xAA, 0xA8, 0xC7, 0xCA, 0x88,
+        0xC0, 0xEE, 0x05, 0x74, 0x3E, 0x71, 0xE0, 0xAF, 0xE1, 0xF1, 0x29, 0xF3,
+        0x05, 0xCD, 0x67, 0xC8, 0x32, 0xA4, 0x4D, 0x40, 0x44, 0x24, 0xD8, 0x5F,
+        0xFD, 0xAD, 0xE9, 0xDB, 0xBE, 0x60, 0x5F, 0x92, 0x71, 0x7C, 0x20, 0x7A,
+        0x82, 0xFB, 0x91, 0x3A, 0xF2, 0x98, 0xF0, 0x8E, 0x26, 0xE5, 0x10, 0xBE,
+        0xAE, 0x16, 0x79, 0x85, 0xDF, 0x37, 0x1D, 0x18, 0xE7, 0x61, 0xF9, 0x9D,
+        0x89, 0xD1, 0x0B, 0xC8, 0xC2, 0x09, 0xD8, 0x09, 0x6D, 0x16, 0xF1, 0xCD,
+        0x06, 0x4E, 0x2B, 0x10, 0x95, 0x11, 0xC3, 0x37, 0x54, 0x5C, 0xA6, 0x38,
+        0x00, 0x81, 0x02, 0x6C, 0x8A, 0x2C, 0x29, 0xDF, 0xB7, 0xC3, 0x42, 0xA6,
+        0xD3, 0x23, 0x31, 0x18, 0x72, 0xDE, 0x48, 0x24, 0xA8, 0x19, 0x6F, 0x5A,
+        0x14, 0x7F, 0x00, 0xDB, 0xCF, 0x39, 0xFA, 0x23, 0x22, 0x70, 0x54, 0x5E,
+        0xF5, 0xB6, 0x75, 0xD4, 0xF0, 0x0E, 0x98, 0x19, 0x5D, 0x43, 0x72, 0x01,
+        0x67, 0xD6, 0xF5, 0xC4, 0x2B, 0x6F, 0x49, 0xDC, 0x26, 0xE5, 0x02, 0xEE,
+        0x79, 0x8D, 0x2C, 0xFF, 0xA2, 0x61, 0x69, 0x88, 0x23, 0xB4, 0x15, 0x6D,
+        0x8D, 0x53, 0xD5, 0xF0, 0x6A, 0xC9, 0x88, 0x99, 0x0F, 0x5E, 0x47, 0x23,
+        0x34, 0xDF, 0x01, 0xAC, 0x7A, 0xB4, 0x4F, 0x58, 0x94, 0x91, 0x71, 0x91,
+        0x31, 0xD8, 0xE9, 0x0D, 0xF0, 0x59, 0xB8, 0x23, 0x16, 0xE9, 0x88, 0x87,
+        0xB0, 0x18, 0xF0, 0x89, 0x08, 0xE0, 0x70, 0xA4, 0xF7, 0x5B, 0xCB, 0xFE,
+        0x2C, 0xA6, 0x13, 0xD0, 0xD2, 0x43, 0x3E, 0x06, 0xD2, 0xD2, 0x9E, 0x4D,
+        0x9A, 0x89, 0x78, 0x3C, 0x68, 0x4F, 0x5D, 0x47, 0xEF, 0x02, 0xB6, 0xF7,
+        0x18, 0x3E, 0x71, 0x99, 0xCB, 0xEB, 0x67, 0x2D, 0x79, 0xEE, 0x07, 0x41,
+        0xD3, 0xCF, 0x18, 0xFC, 0xF3, 0x92, 0xC1, 0x00, 0x23, 0x47, 0x0D, 0x05,
+        0x7F, 0x07, 0xFC, 0xA1, 0xBE, 0xC2, 0x3E, 0x4E, 0xAD, 0xDC, 0xE1, 0x9B,
+        0x60, 0xB1, 0x99, 0xC0, 0x3C, 0x0C, 0x88, 0x9E, 0x5F, 0x29, 0xA2, 0x08,
+        0xA3, 0x6C, 0xC1, 0x70, 0x6F, 0x7C, 0x24, 0x66, 0x1A, 0x5A, 0xBF, 0xCF,
+        0x7D, 0x88, 0xF3, 0x22, 0x02, 0x06, 0xF1, 0xA1, 0xED, 0x2A, 0x8E, 0xB0,
+        0x7A, 0x0F, 0x31, 0x29, 0x40, 0x6D, 0x22, 0x85, 0xFB, 0x57, 0x31, 0xEE,
+        0x55, 0xAC, 0xBB, 0xE0, 0x33, 0x19, 0x71, 0xB1, 0xD7, 0x3C, 0x8B, 0xC5,
+        0x1B, 0x3E, 0x01, 0x0C, 0x12, 0xE0, 0x63, 0x9F, 0x5D, 0x65, 0xBF, 0x39,
+        0x16, 0xB4, 0x05, 0xBC, 0x62, 0xAB, 0x8A, 0x88, 0x44, 0x50, 0x18, 0x42,
+        0x14, 0x12, 0x38, 0x43, 0xC0, 0xF1, 0x36, 0x90, 0x0F, 0x8E, 0x14, 0x15,
+        0xEB, 0x88, 0x0F, 0xE8, 0x20, 0x78, 0x80, 0xF9, 0xDC, 0x80, 0x05, 0x71,
+        0x05, 0x3A, 0xCE, 0x06, 0x83, 0xE9, 0x81, 0xA7, 0x6B, 0x0F, 0xD1, 0x9B,
+        0xE4, 0x05, 0xB7, 0x5F, 0xAF, 0x6F, 0x03, 0xD8, 0xF2, 0xBC, 0x04, 0x5C,
+        0x41, 0x29, 0x02, 0x22, 0xD4, 0x26, 0x31, 0x10, 0xFA, 0xA4, 0xFC, 0xED,
+        0xB7, 0xB3, 0xF9, 0x4A, 0x5C, 0x9C, 0x2E, 0x22, 0x80, 0x15, 0x99, 0x87,
+        0x1E, 0x94, 0x11, 0x4B, 0xD1, 0x8B, 0xDF, 0x7E, 0x0D, 0x3E, 0x84, 0xDC,
+        0x3C, 0xB2, 0x9B, 0x25, 0x31, 0x79, 0xC6, 0x64, 0x6C, 0xA8, 0x26, 0xBE,
+        0x71, 0xB0, 0xB4, 0x07, 0x1E, 0xF3, 0xEC, 0x07, 0x04, 0xFB, 0xAE, 0xC7,
+        0x1C, 0xBC, 0x7E, 0xF0, 0x2A, 0x1C, 0xD3, 0x97, 0x65, 0x19, 0xB0, 0xEF,
+        0x1B, 0x68, 0xB2, 0xBC, 0xCC, 0xCA, 0x99, 0xC0, 0xF4, 0x00, 0x8F, 0x04,
+        0xCF, 0x5C, 0xF5, 0x43, 0xAA, 0xD1, 0x87, 0x7F, 0xAE, 0xE6, 0xBE, 0xD5,
+        0x9E, 0x54, 0x38, 0xEA, 0x17, 0x9B, 0x4E, 0xB9, 0x89, 0x2D, 0xDF, 0xE1,
+        0xAE, 0xCB, 0xE3, 0x94, 0x67, 0x55, 0x81, 0xD6, 0xFE, 0x55, 0xF8, 0x9D,
+        0xA2, 0x71, 0x4B, 0x98, 0x8C, 0x82, 0x21, 0xE0, 0xD4, 0x12, 0xB2, 0x15,
+        0xE0, 0x9C, 0x1F, 0x21, 0x9A, 0x3D, 0x87, 0xAE, 0x9F, 0xCE, 0x68, 0x0B,
+        0x65, 0x43, 0x10, 0x0D, 0x53, 0xD6, 0x4E, 0xD7, 0xA1, 0x6B, 0xE3, 0xA7,
+        0x50, 0xC2, 0xA1, 0xC1, 0xA8, 0x18, 0xBA, 0x33, 0x82, 0x97, 0x4C, 0xB9,
+        0x47, 0x8E, 0xB0, 0x11, 0x16, 0x72, 0xCF, 0xBE, 0xE2, 0x57, 0x7B, 0xA6,
+        0xE1, 0x4F, 0x81, 0xF1, 0xA9, 0x87, 0x70, 0xEE, 0x0C, 0x49, 0x8E, 0xAE,
+        0x7F, 0x66, 0xE1, 0xA1, 0x4E, 0x68, 0xD1, 0x0F, 0x17, 0x17, 0xA6, 0xF8,
+        0xAF, 0x2D, 0x34, 0x32, 0xED, 0x17, 0x17, 0x39, 0xFD, 0xB9, 0x2D, 0x12,
+        0x93, 0xDC, 0xA2, 0x3F, 0x65, 0xEA, 0xBF, 0x9C, 0x71, 0x63, 0x42, 0x8F,
+        0x77, 0xF0, 0x34, 0xFD, 0x2A, 0x5A, 0x3E, 0xDB, 0x02, 0x0F, 0x5A, 0x7E,
+        0x89, 0xD5, 0xF1, 0x8B, 0x09, 0x8F, 0xDC, 0xAA, 0x87, 0x83, 0xFD, 0x04,
+        0xD0, 0x51, 0x8E, 0xBD, 0xF7, 0xD2, 0x83, 0x31, 0x8E, 0xC4, 0x61, 0xB7,
+        0xFE, 0x9E, 0x28, 0x7A, 0xB0, 0x12, 0x5B, 0x15, 0xA7, 0x6F, 0x30, 0xEA,
+        0x7D, 0xE5, 0x8D, 0xE2, 0xB8, 0xA7, 0x6E, 0x11, 0x35, 0x52, 0xD2, 0x1E,
+        0x50, 0xD3, 0xF6, 0x46, 0x09, 0x05, 0x03, 0xD1, 0xBA, 0x2E, 0x8E, 0xEA,
+        0x85, 0xD9, 0x2E, 0x1C, 0xE6, 0x87, 0x08, 0x3D, 0xE7, 0x0C, 0x4C, 0xE5,
+        0x19, 0xE6, 0x61, 0x93, 0xC7, 0xD7, 0x42, 0x67, 0x3C, 0x02, 0x50, 0xA0,
+        0xF9, 0x69, 0xC2, 0x50, 0xDE, 0x0E, 0xA8, 0x43, 0xFD, 0x39, 0xD2, 0x00,
+        0x79, 0x29, 0xE1, 0x06, 0x77, 0x49, 0x17, 0xF0, 0xB6, 0x37, 0xC5, 0x7F,
+        0x39, 0x47, 0x53, 0xFA, 0x5D, 0x07, 0x78, 0x94, 0xAC, 0xFF, 0xBE, 0x41,
+        0x25, 0x5C, 0x96, 0xAC, 0x48, 0xAA, 0x08, 0x09, 0xE0, 0xA0, 0xB0, 0x90,
+        0xCF, 0xA4, 0xC0, 0xA4, 0x53, 0x39, 0xD3, 0x96, 0xF2, 0xC1, 0x45, 0x78,
+        0x53, 0x5D, 0x07, 0x1D, 0xBD, 0xA0, 0x8B, 0xD7, 0x3D, 0xE1, 0x88, 0xCF,
+        0x97, 0xEB, 0x95, 0x3F, 0x1A, 0x0A, 0x45, 0x02, 0xC3, 0x40, 0x11, 0x13,
+        0x17, 0x0F, 0x9E, 0x7C, 0x0A, 0x7B, 0x8A, 0x89, 0xAC, 0x37, 0x8A, 0x09,
+        0x76, 0x94, 0xF5, 0xFE, 0xB3, 0xC9, 0xD7, 0xC0, 0xA5, 0x3B, 0xCF, 0x0C,
+        0x98, 0xC1, 0x59, 0xA5, 0x84, 0x95, 0xA2, 0x8A, 0x3F, 0x20, 0x1D, 0x9F,
+        0xDE, 0xAF, 0x5E, 0x7A, 0x9C, 0xFA, 0x11, 0x86, 0x14, 0x19, 0xEB, 0x8E,
+        0x65, 0xA8, 0x37, 0x01, 0xB0, 0x58, 0xAB, 0x32, 0x14, 0x76, 0xF4, 0x6C,
+        0xD3, 0x5F, 0xCA, 0x17, 0x47, 0x30, 0x8A, 0x98, 0xF5, 0x26, 0x94, 0x7D,
+        0x15, 0x0D, 0xA3, 0x6F, 0x14, 0x0F, 0x84, 0xF5, 0x52, 0x16, 0xE0, 0x51,
+        0xEB, 0xAB, 0x89, 0x2F, 0x68, 0x1C, 0xA3, 0x04, 0x7A, 0x70, 0x71, 0xC6,
+        0xC6, 0x9B, 0x6E, 0x04, 0x01, 0x4D, 0x94, 0xD2, 0xC8, 0xC6, 0x64, 0x99,
+        0xCF, 0xBE, 0xD8, 0xE1, 0x62, 0x98, 0xFB, 0xBD, 0xBD, 0x62, 0x83, 0x98,
+        0x40, 0xF7, 0x83, 0xC4, 0x3C, 0x0C, 0x8D, 0x47, 0xA7, 0xF8, 0xC4, 0xB3,
+        0x8C, 0xC0, 0xEC, 0xA1, 0xE1, 0x3D, 0x04, 0x97, 0xF7, 0xE4, 0xDC, 0x22,
+        0xAE, 0x48, 0xE3, 0xDA, 0x07, 0x13, 0xFC, 0x8C, 0xC2, 0xCD, 0xC6, 0x0F,
+        0xC5, 0x73, 0x11, 0x41, 0xFC, 0x6D, 0x11, 0x93, 0x86, 0x3B, 0x0F, 0x82,
+        0xA2, 0x8D, 0xB7, 0xE9, 0x84, 0x4B, 0x6B, 0xCA, 0x6F, 0x0D, 0xA3, 0x9B,
+        0x71, 0x89, 0x2E, 0x84, 0xBF, 0xA0, 0x68, 0xC7, 0x2F, 0x83, 0x40, 0x37,
+        0x4F, 0x57, 0xE0, 0xDC, 0xE4, 0x17, 0xAE, 0xBD, 0x84, 0x28, 0x4E, 0xE3,
+        0x72, 0x63, 0xE7, 0xF0, 0x47, 0x8C, 0xC2, 0x47, 0xDE, 0xF9, 0xFF, 0xFA,
+        0x9F, 0x08, 0x4A, 0x14, 0xBC, 0xBE, 0xAC, 0x1E, 0x06, 0xAF, 0xAF, 0xA2,
+        0xEF, 0x97, 0xA5, 0xA0, 0xC5, 0x5F, 0x0F, 0x74, 0x4B, 0xDE, 0xF0, 0x2A,
+        0x6E, 0x23, 0x6A, 0x91, 0xC0, 0x66, 0x8C, 0x1A, 0xBF, 0x0D, 0xB4, 0x5F,
+        0x03, 0xF0, 0x40, 0x8E, 0x3E, 0xDF, 0x6F, 0x2B, 0x70, 0xAA, 0xA4, 0x03,
+        0x83, 0x20, 0x65, 0x2A, 0xC0, 0x57, 0xB0, 0xA0, 0xC4, 0x57, 0x04, 0xCE,
+        0x31, 0xAE, 0x79, 0xE5, 0xF5, 0x8E, 0x20, 0xFE, 0xF0, 0x82, 0x09, 0x61,
+        0x34, 0x11, 0x57, 0x68, 0xBA, 0x13, 0x17, 0x8F, 0xC9, 0x6D, 0x60, 0x89,
+        0xEB, 0xEC, 0x86, 0x37, 0x72, 0xC2, 0x30, 0xA1, 0x07, 0x74, 0xC7, 0xED,
+        0xBD, 0x97, 0xF9, 0xBC, 0x55, 0x9F, 0x1F, 0x2F, 0x22, 0xF0, 0x6B, 0xB5,
+        0x73, 0x4D, 0x10, 0x85, 0x45, 0xC2, 0x08, 0x9E, 0xDF, 0xE4, 0xB7, 0x7A,
+        0x73, 0x83, 0xD4, 0x04, 0xE9, 0x73, 0x2D, 0x4C, 0x43, 0x85, 0xAB, 0x04,
+        0xE2, 0x89, 0x8B, 0x24, 0x56, 0xE0, 0x61, 0x20, 0x67, 0xFE, 0x9E, 0x06,
+        0xBF, 0x35, 0x8A, 0x04, 0xC3, 0xDB, 0x43, 0x41, 0x20, 0xE7, 0x32, 0x12,
+        0xBC, 0xFE, 0x50, 0xB4, 0xE5, 0x0B, 0x82, 0x17, 0xD2, 0x29, 0x25, 0x1D,
+        0x25, 0xD1, 0x32, 0x00, 0x2D, 0x20, 0xC1, 0x80, 0x06, 0x04, 0x26, 0x86,
+        0xB2, 0x0C, 0x2B, 0x95, 0x60, 0x83, 0xA3, 0x34, 0xC2, 0xBD, 0x74, 0xFE,
+        0x3D, 0xAB, 0x97, 0xFE, 0x3C, 0xB2, 0xEE, 0x15, 0x0A, 0xDC, 0x29, 0xA3,
+        0x38, 0x07, 0xA9, 0xC3, 0xA2, 0x97, 0x89, 0x97, 0xF7, 0xB1, 0xE9, 0xD3,
+        0xDB, 0xB0, 0xA2, 0x10, 0x0A, 0x93, 0x3F, 0x30, 0xBE, 0x60, 0xA3, 0x4F,
+        0x32, 0x09, 0x30, 0x64, 0x0F, 0x33, 0x6E, 0x61, 0x15, 0x98, 0x8B, 0xCD,
+        0xB6, 0x31, 0x57, 0x0B, 0xB8, 0x55, 0xE4, 0x28, 0xCE, 0x06, 0x87, 0x03,
+        0x48, 0xBF, 0x45, 0xB2, 0xA7, 0xFE, 0xFD, 0x56, 0x28, 0xA2, 0x18, 0x5D,
+        0x55, 0x68, 0xCA, 0xEB, 0xB4, 0xED, 0x2D, 0x2C, 0xE1, 0x7C, 0xEC, 0x79,
+        0xC0, 0xB7, 0x5D, 0x24, 0x0E, 0x1A, 0x96, 0x4E, 0x10, 0xAE, 0x48, 0x46,
+        0x98, 0x8E, 0xE5, 0xF9, 0x28, 0xA5, 0x43, 0x31, 0x22, 0x14, 0x3A, 0x0A,
+        0x06, 0xFA, 0x0C, 0xF9, 0xE7, 0x76, 0x0F, 0xF0, 0xCF, 0x80, 0x76, 0xAA,
+        0x24, 0xA2, 0x22, 0xC9, 0x3F, 0x29, 0x18, 0x85, 0xCA, 0x11, 0x42, 0xA5,
+        0x09, 0x97, 0x09, 0xFC, 0x70, 0xD4, 0xF5, 0x8E, 0x00, 0x2F, 0xDF, 0x6F,
+        0x03, 0x39, 0x9F, 0xC7, 0x96, 0x50, 0xCF, 0x5F, 0x8C, 0x0D, 0x85, 0x12,
+        0xF2, 0x11, 0x0B, 0xE3, 0xBB, 0xC0, 0xE3, 0x1C, 0xCE, 0x85, 0x75, 0x93,
+        0x02, 0x65, 0x3C, 0xAA, 0x98, 0x20, 0xFD, 0xF8, 0x3C, 0x8A, 0xD1, 0xCB,
+        0xB2, 0xCC, 0x44, 0xA3, 0x3B, 0x70, 0x4D, 0x31, 0xCF, 0xCE, 0xD0, 0x86,
+        0xE6, 0x21, 0x49, 0x01, 0xC3, 0xF8, 0xAF, 0xCE, 0xE3, 0xC7, 0xF5, 0xDE,
+        0x14, 0x8F, 0x60, 0x5F, 0xA4, 0x8B, 0x4F, 0xD7, 0x14, 0x05, 0x33, 0xDE,
+        0xE8, 0x17, 0x96, 0x38, 0xC7, 0x02, 0x2F, 0xC4, 0x0A, 0x05, 0x0E, 0xFD,
+        0x09, 0x62, 0x09, 0x16, 0xB4, 0x88, 0xA1, 0xDA, 0x2D, 0x19, 0xFE, 0x40,
+        0x71, 0xE1, 0xC3, 0x18, 0x2D, 0x4A, 0x5C, 0x00, 0xF5, 0x18, 0x67, 0xEB,
+        0x06, 0x95, 0xC3, 0x21, 0x89, 0x7F, 0x5D, 0xE9, 0x41, 0x7E, 0x22, 0x46,
+        0x79, 0x15, 0x15, 0x84, 0x45, 0x43, 0x75, 0xC1, 0x7A, 0x63, 0x94, 0x13,
+        0xE4, 0x6C, 0xE5, 0xFD, 0x8E, 0x99, 0x18, 0x29, 0xD9, 0x0D, 0x6A, 0x8F,
+        0x10, 0x63, 0xF9, 0x5D, 0xFF, 0x32, 0x32, 0x5E, 0x46, 0xBF, 0xB7, 0xE9,
+        0xFC, 0xD7, 0xE1, 0xD2, 0x01, 0x94, 0x17, 0x4D, 0xA0, 0x5F, 0x9F, 0x8D,
+        0x0C, 0x7B, 0xDD, 0x59, 0x76, 0x28, 0xAF, 0x1A, 0xD4, 0x1D, 0x5F, 0x5B,
+        0xA9, 0x24, 0x94, 0x62, 0xB7, 0xBB, 0xC3, 0x1F, 0xD5, 0x47, 0x93, 0xB7,
+        0x2F, 0x22, 0xFC, 0x78, 0x05, 0x2C, 0xCC, 0xFA, 0x25, 0x32, 0x5F, 0xE4,
+        0xE6, 0x4F, 0xE1, 0xCD, 0x84, 0xD8, 0x26, 0x73, 0xCD, 0x36, 0x54, 0x4C,
+        0x42, 0x10, 0x65, 0x42, 0x12, 0x57, 0x42, 0xFB, 0x86, 0x3B, 0xEE, 0xF0,
+        0x91, 0x67, 0x9A, 0xDE, 0x89, 0x60, 0xC5, 0x29, 0xF5, 0xF3, 0x32, 0x9C,
+        0x83, 0xF3, 0xFE, 0x49, 0xC1, 0x78, 0x28, 0xE5, 0x16, 0x32, 0x05, 0xE8,
+        0x10, 0x2E, 0xC0, 0x20, 0x08, 0x82, 0xE8, 0x6B, 0x9D, 0xDB, 0x83, 0xC7,
+        0xFF, 0xDC, 0x85, 0xAC, 0xAA, 0xEB, 0xAD, 0xA8, 0x2A, 0xB6, 0x9F, 0x98,
+        0x4B, 0x41, 0xEF, 0xFE, 0xCA, 0xED, 0xC7, 0x11, 0x19, 0xE2, 0xAA, 0x5C,
+        0x6E, 0xBC, 0xA1, 0x38, 0x93, 0x23, 0xCE, 0x81, 0x0C, 0x20, 0x4A, 0xEC,
+        0xBE, 0xE0, 0x37, 0x9D, 0x81, 0xFF, 0xA7, 0xAA, 0x7C, 0xEA, 0xC6, 0x7F,
+        0x62, 0x48, 0x45, 0xBC, 0x6C, 0xE2, 0x92, 0x38, 0x0B, 0xA7, 0x0C, 0xAE,
+        0xEB, 0xE8, 0xE8, 0x20, 0x5B, 0x7B, 0x0D, 0xCA, 0x83, 0xE2, 0x5A, 0x68,
+        0xF8, 0xF8, 0x0B, 0x7C, 0x01, 0xBF, 0xDE, 0x80, 0x8E, 0xBE, 0x15, 0x30,
+        0x61, 0xAB, 0xFD, 0x7A, 0x42, 0xEA, 0x9A, 0xFB, 0xC2, 0x76, 0x86, 0x37,
+        0x6A, 0xC8, 0x72, 0xF5, 0xF2, 0xB4, 0x97, 0xC7, 0x3F, 0x4B, 0xE3, 0x6B,
+        0xB3, 0xEC, 0x4F, 0x25, 0xF2, 0x25, 0x6C, 0x14, 0x82, 0xEF, 0x27, 0x28,
+        0xFE, 0xF6, 0x27, 0x52, 0xFD, 0xD6, 0xE2, 0x0E, 0x97, 0x74, 0xFA, 0x80,
+        0x12, 0x97, 0xAD, 0xF2, 0x16, 0x25, 0xF3, 0xBD, 0xFA, 0xE2, 0xD0, 0xCA,
+        0xCE, 0xA4, 0x8E, 0xDF, 0xFF, 0x21, 0x7A, 0xC7, 0x27, 0x54, 0x2F, 0xDB,
+        0x1B, 0xD8, 0xD6, 0x2B, 0x3F, 0x24, 0xE7, 0x83, 0xC6, 0x04, 0x66, 0x1B,
+        0xF1, 0x47, 0xAC, 0x36, 0x12, 0x8B, 0xA6, 0x10, 0x83, 0xF1, 0xDF, 0xEC,
+        0x68, 0x76, 0x90, 0x8E, 0x06, 0x9E, 0x3E, 0x4D, 0x15, 0xC6, 0xCF, 0x11,
+        0xB1, 0xF2, 0x52, 0xD4, 0xFD, 0x8C, 0xE1, 0x1D, 0xD9, 0x1D, 0x43, 0xE7,
+        0x48, 0xBD, 0x65, 0x5C, 0x05, 0xCF, 0x79, 0x61, 0x77, 0x09, 0x17, 0x6B,
+        0x08, 0x84, 0x11, 0xF2, 0x48, 0x7C, 0x23, 0xDE, 0x0F, 0x4D, 0x83, 0x74,
+        0xFC, 0xDD, 0x62, 0x24, 0xAF, 0x8C, 0xEE, 0xAA, 0x64, 0xEB, 0xBA, 0xE4,
+        0x33, 0x45, 0x5F, 0x51, 0xE3, 0xAC, 0x07, 0xEF, 0x45, 0x23, 0xD1, 0x31,
+        0x8A, 0x73, 0xA1, 0x30, 0x1D, 0xE7, 0x1B, 0x5F, 0xD7, 0xB5, 0xBF, 0xDE,
+        0xAB, 0xA1, 0xBD, 0x8A, 0x1B, 0x5D, 0xD7, 0x00, 0x5C, 0xCB, 0x84, 0xF3,
+        0xA4, 0xB7, 0x35, 0x6A, 0x71, 0x25, 0x30, 0x28, 0xF4, 0xF1, 0x1E, 0x9F,
+        0xD9, 0xBB, 0x44, 0x6B, 0xAE, 0x1D, 0x2D, 0xF2, 0xB2, 0x09, 0x2F, 0xAE,
+        0x57, 0x54, 0x2A, 0x12, 0x21, 0x83, 0xF9, 0xCA, 0x4E, 0x13, 0x42, 0xA5,
+        0x79, 0x71, 0xFE, 0x12, 0x89, 0xDA, 0xA8, 0xC6, 0x32, 0x24, 0x32, 0xE3,
+        0x9D, 0x41, 0x3A, 0xD6, 0x63, 0x8B, 0xE7, 0x5A, 0x38, 0x26, 0x67, 0x49,
+        0xDC, 0x1B, 0x24, 0xEA, 0x55, 0x95, 0xB0, 0x69, 0x49, 0xFE, 0x84, 0x5F,
+        0x3E, 0xB8, 0x75, 0xB7, 0xF9, 0xBD, 0xA3, 0x5B, 0x0F, 0x3A, 0xFC, 0xEC,
+        0xE1, 0x2D, 0x01, 0x3A, 0xD4, 0xE6, 0x17, 0xB8, 0x3E, 0x6A, 0x35, 0x45,
+        0x4A, 0x27, 0x5E, 0x2D, 0x09, 0xBD, 0x0B, 0x07, 0x5C, 0x02, 0xF3, 0xF8,
+        0xA6, 0x2A, 0xF7, 0x5E, 0xC9, 0x7C, 0x34, 0x01, 0x00, 0x38, 0xF5, 0x71,
+        0xA8, 0x17, 0xD1, 0x2C, 0x82, 0xFD, 0x94, 0x5F, 0x1A, 0xB9, 0x82, 0xDD,
+        0xC1, 0x86, 0x0E, 0x2E, 0xDF, 0x6F, 0xB3, 0x8D, 0x1F, 0x2F, 0x6B, 0xE3,
+        0x58, 0x84, 0x7B, 0xF8, 0x4E, 0xC9, 0x97, 0x63, 0xEC, 0x84, 0x55, 0x8A,
+        0x13, 0xCE, 0xD1, 0x12, 0x30, 0x18, 0xA7, 0xEF, 0x39, 0xDB, 0x53, 0xEA,
+        0x91, 0xB8, 0x92, 0xC9, 0xD9, 0xB6, 0x5F, 0x8D, 0x16, 0x13, 0x52, 0x0C,
+        0x5B, 0xCC, 0xE1, 0x02, 0x43, 0x24, 0x03, 0x50, 0x57, 0x18, 0x3F, 0x7A,
+        0x74, 0x98, 0xF0, 0x82, 0xFC, 0xE8, 0x2E, 0x8F, 0x07, 0xC4, 0xBC, 0xCB,
+        0x08, 0x37, 0xA9, 0x97, 0x33, 0x28, 0xAF, 0x02, 0x60, 0xEB, 0xB8, 0x53,
+        0x90, 0xE1, 0x33, 0x78, 0x91, 0x30, 0xC7, 0x8D, 0x44, 0xB9, 0x40, 0xE0,
+        0xA3, 0xE3, 0x67, 0x8A, 0x73, 0xCE, 0x38, 0x41, 0x85, 0x5C, 0x6F, 0xFC,
+        0x8D, 0x34, 0x09, 0x17, 0xCA, 0x7D, 0xBC, 0x58, 0x92, 0x18, 0x0D, 0xBC,
+        0x7D, 0x17, 0x24, 0x5C, 0xC4, 0xC5, 0x8F, 0x17, 0xB0, 0xCC, 0xA5, 0xE4,
+        0xDC, 0x4A, 0xAE, 0x50, 0xDE, 0x83, 0x41, 0x6C, 0xE0, 0x35, 0x7C, 0xFF,
+        0xEB, 0x2A, 0x21, 0x42, 0x25, 0x96, 0x67, 0xB0, 0x1E, 0xD5, 0x2D, 0xDE,
+        0x61, 0x83, 0xDB, 0x04, 0xCD, 0x17, 0x6A, 0xFF, 0x22, 0x92, 0x34, 0x1C,
+        0x7A, 0xF0, 0x02, 0x12, 0x30, 0x00, 0x01, 0x7E, 0x30, 0xFA, 0x39, 0xB6,
+        0x20, 0x12, 0x3F, 0x43, 0xEC, 0x65, 0x30, 0x42, 0xDB, 0x0F, 0x7F, 0x89,
+        0x53, 0x32, 0xE4, 0x53, 0x24, 0x16, 0x19, 0x1C, 0x5F, 0xF2, 0x38, 0xE5,
+        0x52, 0xD0, 0xB2, 0x83, 0x41, 0x55, 0x81, 0x83, 0xB9, 0xC0, 0x5B, 0xA3,
+        0x32, 0x64, 0x79, 0x0A, 0xAA, 0x62, 0x5E, 0x03, 0xE1, 0x25, 0x40, 0x23,
+        0xC3, 0x45, 0xE2, 0x7C, 0xD1, 0x72, 0xBF, 0xB0, 0x25, 0xED, 0x8F, 0x15,
+        0x53, 0x3A, 0xF6, 0xE5, 0xE4, 0xE0, 0x15, 0x61, 0x3E, 0xAF, 0x2C, 0xF3,
+        0x67, 0x44, 0x4B, 0x8C, 0x51, 0x90, 0x57, 0x79, 0x92, 0x8F, 0xEF, 0xB2,
+        0xCD, 0x47, 0xCE, 0xEA, 0x04, 0x64, 0xF9, 0x78, 0x91, 0xED, 0x37, 0xC9,
+        0xB2, 0xEE, 0xE5, 0x7F, 0xE2, 0xDD, 0x44, 0x22, 0x3E, 0x02, 0xEF, 0x72,
+        0x8A, 0xF3, 0x0B, 0xD9, 0x51, 0xAF, 0xFB, 0x1B, 0x1F, 0x23, 0xB5, 0x32,
+        0xB4, 0x0F, 0x2A, 0xD0, 0xC9, 0xD1, 0xA3, 0x01, 0x61, 0x2F, 0xEC, 0x91,
+        0x02, 0xF6, 0x8C, 0xF7, 0x9B, 0xAA, 0xCD, 0xD8, 0x1D, 0x73, 0x9E, 0xEB,
+        0x93, 0x53, 0x8F, 0xB0, 0x95, 0xA1, 0xDE, 0xAF, 0xE6, 0x7A, 0x78, 0xEC,
+        0x21, 0x54, 0xFE, 0x87, 0x72, 0x97, 0x74, 0x5C, 0xA4, 0x1A, 0xCC, 0xE0,
+        0x75, 0xFF, 0xC2, 0x81, 0x49, 0xD0, 0xD6, 0x4F, 0x20, 0xDA, 0xD7, 0x29,
+        0xA0, 0x07, 0x67, 0x5B, 0xE2, 0xCB, 0x64, 0x7C, 0x87, 0x44, 0xB6, 0xBD,
+        0x52, 0xD7, 0x5B, 0xFF, 0x06, 0x01, 0x8C, 0xD3, 0xF7, 0x4F, 0x4F, 0x3C,
+        0xCA, 0x27, 0xE2, 0xE8, 0xB4, 0xC2, 0xCE, 0x04, 0xB0, 0x8B, 0x31, 0xE2,
+        0xF4, 0x9A, 0x43, 0xAF, 0x24, 0xB9, 0x57, 0x3E, 0x0F, 0x7A, 0xBE, 0xF9,
+        0x2E, 0xCD, 0x55, 0x54, 0x0E, 0x4D, 0x1C, 0x31, 0xEB, 0x63, 0x5C, 0xB3,
+        0x20, 0x06, 0x94, 0xBB, 0x35, 0x1E, 0x02, 0x17, 0x9D, 0x0E, 0x76, 0x07,
+        0x4C, 0xD5, 0x20, 0xD3, 0xEC, 0x3D, 0x74, 0xFD, 0xE2, 0xC7, 0xC9, 0xFD,
+        0x34, 0x0C, 0x34, 0x26, 0x45, 0xCE, 0x5E, 0x49, 0x62, 0xE2, 0xA1, 0xA9,
+        0x77, 0x7B, 0xAC, 0xE4, 0xFA, 0x1C, 0x07, 0x71, 0x3E, 0xC7, 0x11, 0xF2,
+        0x52, 0xA3, 0x05, 0x43, 0x77, 0xDC, 0x9E, 0xF8, 0x13, 0x9B, 0x58, 0x10,
+        0x15, 0x3F, 0x9F, 0xB8, 0x44, 0x83, 0x7B, 0x0B, 0x7A, 0x70, 0x34, 0x15,
+        0x58, 0x45, 0x17, 0x71, 0x74, 0xC7, 0x26, 0xBA, 0x48, 0xD4, 0x63, 0xE0,
+        0xCB, 0x47, 0x29, 0x0C, 0xA7, 0x42, 0x89, 0x8C, 0x87, 0x39, 0x53, 0x22,
+        0x68, 0x8A, 0xD8, 0xE4, 0xFD, 0xE6, 0xB0, 0x72, 0xCE, 0x3B, 0xC4, 0x7C,
+        0xF7, 0x94, 0x73, 0xF0, 0x3E, 0xF6, 0xE0, 0xF5, 0xF9, 0xA5, 0x7D, 0xFF,
+        0x9D, 0x71, 0xEF, 0x55, 0x08, 0xAC, 0x98, 0x63, 0x1E, 0xFE, 0x42, 0xEE,
+        0x66, 0xB4, 0x40, 0xD7, 0x3F, 0x76, 0xBA, 0xCB, 0x47, 0x5C, 0x9C, 0xC1,
+        0xE5, 0x11, 0xFB, 0xBA, 0x02, 0xC4, 0x6B, 0xEE, 0xE9, 0x9E, 0xF8, 0x53,
+        0xCE, 0x91, 0x0F, 0x58, 0xDC, 0x58, 0xD0, 0x09, 0xFA, 0x7C, 0x54, 0x23,
+        0xE0, 0x8E, 0x4F, 0xE3, 0x2A, 0xA1, 0xD3, 0xB6, 0xB0, 0x6A, 0x38, 0x72,
+        0xD4, 0xF6, 0xEA, 0xA4, 0xED, 0xC7, 0xC7, 0x77, 0xF4, 0xE5, 0x0D, 0x88,
+        0x41, 0xD0, 0xFF, 0x46, 0x7C, 0x5F, 0xB3, 0xAE, 0xCF, 0xB1, 0x50, 0xBE,
+        0x60, 0xAF, 0xF7, 0x76, 0x41, 0xFC, 0x69, 0x6D, 0xDF, 0xCE, 0x84, 0x96,
+        0x46, 0x36, 0x74, 0xC8, 0xF8, 0x72, 0xA0, 0x1F, 0x82, 0x94, 0x80, 0x05,
+        0xBA, 0xB0, 0x0F, 0xDC, 0xCE, 0xA9, 0x80, 0x7C, 0xEA, 0xCE, 0xFA, 0x01,
+        0x64, 0x2E, 0x3C, 0xE4, 0x0D, 0x40, 0x8D, 0xD4, 0x37, 0x40, 0x4C, 0x06,
+        0xC1, 0xE2, 0x70, 0x6D, 0xEF, 0xE5, 0x39, 0x1C, 0x34, 0x21, 0x01, 0xD3,
+        0x03, 0x56, 0x4A, 0xDD, 0x38, 0x33, 0x91, 0x15, 0x7A, 0xC7, 0x5F, 0xEF,
+        0x96, 0xEE, 0x04, 0x80, 0x93, 0x31, 0xB2, 0x29, 0x88, 0xE8, 0x51, 0x57,
+        0x47, 0x07, 0xA2, 0x1F, 0x28, 0x41, 0x6B, 0x78, 0xB3, 0x57, 0x80, 0xFB,
+        0x42, 0xA0, 0x7B, 0xAD, 0xBC, 0x6F, 0xA0, 0x3C, 0x7D, 0xB6, 0x0C, 0x45,
+        0xF7, 0x47, 0x09, 0x1D, 0x77, 0xF7, 0x45, 0x72, 0xF0, 0x02, 0x70, 0x6C,
+        0x94, 0x94, 0xE1, 0xEA, 0x9F, 0xF0, 0x41, 0x0E, 0x92, 0xBE, 0x3D, 0x04,
+        0x7E, 0x75, 0x98, 0x2E, 0xE4, 0xC7, 0x21, 0xAE, 0xF4, 0x8A, 0xB1, 0xC2,
+        0x0E, 0x83, 0x8F, 0x0B, 0x3F, 0x7A, 0x8F, 0x02, 0xEB, 0xDE, 0x49, 0xFB,
+        0x00, 0x96, 0x4F, 0x62, 0x6B, 0xA8, 0x1D, 0x0A, 0xA8, 0x9D, 0x0B, 0xC8,
+        0x22, 0xE6, 0xCB, 0xDF, 0xD2, 0xFF, 0xF8, 0x8F, 0x44, 0x4F, 0x11, 0x36,
+        0x56, 0x02, 0x7F, 0xC9, 0xBE, 0x10, 0x89, 0x76, 0x7D, 0x94, 0xF8, 0x1F,
+        0x89, 0x95, 0xE3, 0x98, 0x76, 0x3E, 0x9D, 0x5E, 0x2A, 0xC0, 0xDB, 0xE1,
+        0x5F, 0x04, 0x43, 0x4B, 0x0F, 0x15, 0xCD, 0xD0, 0x5D, 0xC9, 0x4C, 0x9B,
+        0xA8, 0xF5, 0x3F, 0xD2, 0x7F, 0x7B, 0x41, 0x57, 0x31, 0xF9, 0x99, 0x33,
+        0x2B, 0xEC, 0x15, 0x5B, 0xE1, 0x55, 0x29, 0xFE, 0xC4, 0x32, 0x06, 0x00,
+        0xF4, 0xC7, 0x7A, 0x8F, 0x37, 0xFE, 0xEF, 0x56, 0x23, 0xDC, 0xAB, 0xEE,
+        0xF0, 0xC7, 0x7B, 0x31, 0x05, 0x2B, 0xA8, 0xC8, 0xBB, 0x85, 0x2E, 0x48,
+        0x6F, 0x4A, 0x5A, 0x90, 0xDD, 0x04, 0x57, 0x67, 0x7D, 0xFB, 0x42, 0x83,
+        0xBB, 0x08, 0x85, 0xC3, 0x59, 0x05, 0x38, 0xA7, 0x0A, 0xD4, 0xC2, 0xD1,
+        0x06, 0xE8, 0x7F, 0x2E, 0xC0, 0x13, 0x64, 0x6D, 0x4E, 0x18, 0xA2, 0x5B,
+        0x98, 0xB0, 0x7B, 0xFE, 0x36, 0x94, 0x96, 0x86, 0x94, 0x18, 0xD7, 0xBF,
+        0x3D, 0x7F, 0x1B, 0x18, 0x40, 0x27, 0x19, 0xE0, 0xA2, 0x26, 0xA9, 0x7B,
+        0xC9, 0x51, 0x04, 0x2E, 0xD1, 0x91, 0x76, 0xD2, 0xB7, 0x67, 0xD6, 0x52,
+        0x38, 0xF5, 0xD9, 0x06, 0xB8, 0x00, 0x66, 0x99, 0xA5, 0xC8, 0x11, 0xAE,
+        0x07, 0xC2, 0x14, 0x40, 0x11, 0xA2, 0x2A, 0xFC, 0x34, 0xF4, 0x6F, 0xE8,
+        0xDB, 0xD0, 0xA8, 0xBC, 0x35, 0x6D, 0xEF, 0x97, 0xC9, 0x83, 0xA6, 0xBE,
+        0xEE, 0x1C, 0x39, 0xFB, 0x9C, 0xF8, 0x4F, 0x70, 0x9B, 0x00, 0xB7, 0xBA,
+        0xFD, 0xFB, 0x37, 0x48, 0x39, 0x40, 0x38, 0xD7, 0x75, 0x5F, 0x5C, 0xF2,
+        0xC5, 0xB0, 0x96, 0x69, 0x02, 0x48, 0x06, 0xD8, 0xE1, 0x5B, 0x62, 0xAF,
+        0x48, 0x6E, 0xC1, 0x38, 0xFC, 0xFE, 0x0D, 0x31, 0x12, 0xFC, 0xFB, 0x2D,
+        0x61, 0x03, 0xCB, 0x69, 0x23, 0xFD, 0xFE, 0xED, 0xEF, 0x04, 0x49, 0x11,
+        0x14, 0x45, 0xB3, 0xC1, 0x23, 0x8F, 0xEB, 0x7E, 0xFF, 0x06, 0x18, 0xEE,
+        0xFC, 0x08, 0x52, 0x43, 0xE0, 0xCC, 0xDF, 0xBF, 0x21, 0xA8, 0xBE, 0xFD,
+        0xF3, 0x3F, 0x4D, 0xCE, 0x59, 0x25, 0xC4, 0xDF, 0xBF, 0xB5, 0x29, 0xFA,
+        0x99, 0xA2, 0x5B, 0xF4, 0x33, 0x0D, 0x1E, 0xA6, 0xE1, 0xD3, 0xEB, 0x77,
+        0xF0, 0x15, 0x15, 0x7A, 0x07, 0xE1, 0xF9, 0xE7, 0x6F, 0x4F, 0x89, 0x73,
+        0x05, 0x6F, 0xC2, 0xB7, 0x97, 0x42, 0x72, 0x0D, 0xED, 0x9A, 0x2B, 0xD1,
+        0xC3, 0xA9, 0x6A, 0x02, 0x7B, 0x21, 0xED, 0x18, 0x3A, 0xE7, 0x83, 0xEC,
+        0xF1, 0xC3, 0xCC, 0xB6, 0x27, 0x5F, 0x7D, 0x61, 0xFB, 0xA9, 0x64, 0xFD,
+        0x2B, 0xB0, 0x4E, 0x24, 0x88, 0x00, 0x6D, 0x40, 0x0A, 0xAB, 0xBF, 0x7F,
+        0x43, 0x56, 0xC6, 0x37, 0x84, 0x27, 0xFC, 0x19, 0xAB, 0x11, 0x13, 0xBC,
+        0x86, 0x4F, 0xB0, 0x45, 0x1B, 0x7B, 0x86, 0x17, 0x44, 0x0D, 0x9B, 0xE0,
+        0x8B, 0x6F, 0xE9, 0xAB, 0x2E, 0x4B, 0x8B, 0x3B, 0x7A, 0x3D, 0x30, 0xD0,
+        0x03, 0x07, 0x3D, 0x30, 0xD8, 0x03, 0x07, 0x3D, 0x08, 0xD0, 0x03, 0xF7,
+        0x7B, 0xF8, 0x38, 0xBE, 0x41, 0x29, 0xE2, 0xF0, 0x38, 0x7E, 0x0B, 0x64,
+        0x70, 0x0A, 0x7F, 0x84, 0xE0, 0xA0, 0x15, 0xFC, 0x26, 0x0C, 0x60, 0xE2,
+        0xD8, 0xA6, 0x9C, 0x0C, 0x8D, 0x9A, 0xAF, 0x93, 0x22, 0xFE, 0xF4, 0x5C,
+        0x98, 0xF4, 0x97, 0x45, 0x20, 0x0E, 0x88, 0xA9, 0x71, 0x17, 0x7C, 0xF1,
+        0xF6, 0x14, 0xB7, 0xB6, 0x18, 0x28, 0x81, 0xD6, 0x07, 0xB2, 0xE3, 0x3D,
+        0x8A, 0x1D, 0x06, 0x66, 0x83, 0xEE, 0x34, 0x3E, 0xE3, 0xE0, 0xA2, 0xF2,
+        0xEF, 0x36, 0xF5, 0xA2, 0xA9, 0x37, 0x79, 0x51, 0x58, 0xB8, 0x70, 0x3E,
+        0x93, 0x15, 0xFC, 0xC3, 0x5E, 0xB2, 0xF4, 0xD3, 0xB3, 0xD7, 0x80, 0xBC,
+        0x04, 0x67, 0xCF, 0x2B, 0x8A, 0x9B, 0x05, 0x28, 0x6B, 0x58, 0x25, 0x2B,
+        0x06, 0xDA, 0x48, 0x37, 0xA0, 0xE7, 0x01, 0x84, 0xAE, 0x24, 0x9E, 0xC5,
+        0xEA, 0x33, 0xEA, 0x00, 0x04, 0xD6, 0x9F, 0x2E, 0x61, 0xBD, 0xD8, 0x3F,
+        0x5A, 0xE3, 0x73, 0xF8, 0x91, 0x37, 0x21, 0x72, 0x14, 0x82, 0xE7, 0x3E,
+        0x4F, 0x5C, 0xB5, 0xF5, 0xD7, 0x70, 0xD5, 0xD8, 0x87, 0xF4, 0x7A, 0xE4,
+        0xF0, 0xC3, 0xD8, 0xE6, 0x91, 0xD1, 0xAF, 0x9E, 0x86, 0x3A, 0xFC, 0x15,
+        0x84, 0x30, 0x39, 0x55, 0x72, 0x9C, 0xF3, 0x3A, 0xD1, 0x33, 0xAF, 0xF4,
+        0xFE, 0x02, 0x48, 0xA4, 0x61, 0xF8, 0xA9, 0x7F, 0x20, 0x2A, 0xCC, 0xE3,
+        0x67, 0x18, 0x6F, 0xA5, 0x9C, 0x3F, 0xC6, 0x35, 0x1A, 0x43, 0xE3, 0x44,
+        0x31, 0x10, 0xDB, 0xE9, 0x76, 0xFA, 0x5F, 0x62, 0x53, 0xD4, 0x00, 0xF3,
+        0x4F, 0x16, 0x12, 0xD0, 0xFC, 0xF7, 0x67, 0x78, 0x8F, 0xD8, 0x7E, 0x5F,
+        0x08, 0xB0, 0x9D, 0x4B, 0xF7, 0xD1, 0xA7, 0x67, 0x22, 0x36, 0xE0, 0x0B,
+        0x7E, 0xAD, 0x0D, 0xD1, 0xC7, 0xF4, 0x2E, 0xC7, 0xF6, 0x90, 0x95, 0xA1,
+        0xA8, 0xF0, 0xC6, 0xB7, 0x3D, 0x43, 0x48, 0xF5, 0x9B, 0x21, 0x8C, 0x3E,
+        0x27, 0x2E, 0x4D, 0x13, 0x98, 0xED, 0x49, 0x92, 0xFF, 0x23, 0xCA, 0x3D,
+        0x8C, 0x5E, 0x24, 0x90, 0x80, 0xB5, 0x05, 0x7F, 0x63, 0xD7, 0x48, 0xC4,
+        0x3D, 0xF4, 0xE2, 0xB7, 0x6F, 0xE0, 0xB9, 0xCD, 0xB0, 0x93, 0x70, 0xC6,
+        0xF5, 0x8B, 0x6F, 0x63, 0xBD, 0xDF, 0x59, 0x73, 0x18, 0x3B, 0x81, 0x39,
+        0x76, 0x71, 0x52, 0x22, 0x3C, 0xE1, 0x72, 0x8E, 0xB0, 0x92, 0xEC, 0x18,
+        0xF7, 0xED, 0x26, 0xFB, 0x86, 0xA0, 0x78, 0x61, 0x3C, 0xD9, 0x1A, 0x37,
+        0x08, 0xBA, 0x51, 0x39, 0xFB, 0x52, 0x38, 0xF7, 0xF1, 0x2F, 0x7B, 0x67,
+        0xC2, 0xF0, 0xA1, 0x9D, 0xF8, 0x11, 0xCC, 0x90, 0x80, 0xE7, 0xFD, 0x9F,
+        0xDE, 0x3F, 0x81, 0x03, 0x36, 0x8A, 0x8B, 0xE7, 0x7C, 0xED, 0x63, 0x01,
+        0x00, 0xD7, 0x10, 0x4E, 0xF8, 0xE5, 0xAF, 0xD8, 0x69, 0xFE, 0xE9, 0x9B,
+        0x8A, 0x21, 0x0F, 0x13, 0x5A, 0x84, 0x37, 0x86, 0xA3, 0xA7, 0x99, 0x04,
+        0x4E, 0x15, 0x7E, 0x78, 0x23, 0x26, 0x52, 0xD0, 0x1C, 0x3F, 0x87, 0x0D,
+        0x62, 0xDE, 0xDC, 0x30, 0x72, 0x8C, 0x75, 0x19, 0xE4, 0xCE, 0x51, 0x1C,
+        0x18, 0x21, 0xDB, 0x5E, 0x59, 0xF0, 0xC3, 0x04, 0xD8, 0x39, 0x68, 0x68,
+        0x4B, 0xAA, 0x1C, 0xAC, 0xF9, 0xC6, 0x1E, 0xC2, 0x69, 0xFB, 0xC6, 0xF9,
+        0x0A, 0x6D, 0x96, 0xB0, 0x3F, 0x11, 0xFA, 0x92, 0xC3, 0x23, 0x4C, 0xFC,
+        0xDB, 0x98, 0xFA, 0xB2, 0x31, 0x95, 0xB9, 0x89, 0xA6, 0xC5, 0xD8, 0x52,
+        0x0F, 0x51, 0xED, 0xD9, 0x4A, 0x21, 0xBC, 0xC6, 0x97, 0x7B, 0xFE, 0x04,
+        0xA6, 0xEF, 0x18, 0x44, 0xA1, 0x03, 0x3F, 0xD7, 0xA2, 0x85, 0xBE, 0xC3,
+        0xA7, 0xB1, 0x26, 0xC3, 0x27, 0xCB, 0xB9, 0x5F, 0x74, 0x8B, 0x85, 0x14,
+        0x44, 0x7C, 0x5F, 0x60, 0xC2, 0xFC, 0x08, 0xE9, 0xEC, 0xA7, 0xF7, 0x68,
+        0x48, 0xFF, 0xBA, 0x3B, 0xDA, 0x3D, 0x5E, 0x5E, 0xF1, 0xA1, 0xC0, 0xBA,
+        0xFB, 0x25, 0x21, 0x20, 0x8C, 0x53, 0x40, 0x71, 0x21, 0x61, 0xEB, 0x5D,
+        0xDC, 0x9F, 0xE1, 0x9F, 0xFF, 0x38, 0x8B, 0xB1, 0xC4, 0x27, 0x4D, 0xFD,
+        0x92, 0x42, 0xA4, 0x7A, 0x2D, 0x14, 0x3F, 0xF4, 0x1C, 0x4B, 0x8C, 0x01,
+        0x38, 0xBD, 0xC8, 0x18, 0x4F, 0x78, 0xC6, 0x84, 0x8C, 0xE3, 0x3F, 0xCA,
+        0xC6, 0xD0, 0x4C, 0x8E, 0x91, 0xAE, 0xB5, 0x20, 0x2E, 0x93, 0x32, 0x15,
+        0xCB, 0x7E, 0xB1, 0x42, 0xE2, 0xE2, 0xE3, 0x52, 0x48, 0xF7, 0x20, 0x47,
+        0xE0, 0x33, 0x71, 0x7E, 0xB3, 0xB0, 0x47, 0xC9, 0x01, 0xE6, 0x86, 0xC6,
+        0xB7, 0xDD, 0x7F, 0xD9, 0xE2, 0xC8, 0x64, 0x9E, 0x71, 0x92, 0x7C, 0x06,
+        0xCE, 0xEA, 0x33, 0x84, 0xF8, 0xD1, 0x8C, 0xE8, 0x81, 0x25, 0xD9, 0x3B,
+        0x35, 0x48, 0x82, 0x07, 0x78, 0x0C, 0xA1, 0x1D, 0xEE, 0x2B, 0xC4, 0x33,
+        0x79, 0x3C, 0x81, 0x27, 0xB2, 0x10, 0x27, 0xE7, 0xD3, 0x21, 0xD9, 0x38,
+        0x5C, 0x12, 0xF6, 0x67, 0xEE, 0x7A, 0x40, 0x9A, 0xD0, 0xC7, 0x31, 0xBE,
+        0x06, 0xA5, 0x7F, 0xD2, 0xD2, 0x4B, 0xD5, 0x44, 0xCE, 0x91, 0x7C, 0xA7,
+        0x88, 0x2C, 0x0D, 0x07, 0xF5, 0x16, 0x82, 0x0E, 0xAB, 0x7F, 0x6D, 0xCC,
+        0x3F, 0x69, 0x38, 0x58, 0xF3, 0x16, 0x64, 0x01, 0x2E, 0xBD, 0x5E, 0x6F,
+        0xC7, 0xFC, 0x6C, 0x20, 0x9B, 0xDB, 0x47, 0xAD, 0xE1, 0x9B, 0x36, 0x02,
+        0xF4, 0x39, 0xD4, 0x4F, 0x5B, 0x21, 0x1F, 0x2E, 0x04, 0x8C, 0x47, 0x36,
+        0xEF, 0xE4, 0xD9, 0xFF, 0x2D, 0x20, 0xBE, 0x32, 0xB3, 0xB7, 0x8B, 0xBE,
+        0x36, 0xFF, 0x17, 0xDB, 0x22, 0xB7, 0xF3, 0xC1, 0xE6, 0x24, 0x3E, 0xDF,
+        0x2A, 0x10, 0xB2, 0xF7, 0x9F, 0xA7, 0x27, 0x9A, 0xFA, 0x6B, 0x6B, 0xB9,
+        0x1A, 0x5D, 0xA6, 0x28, 0x82, 0xC6, 0xBE, 0x34, 0x7A, 0xAC, 0x0F, 0x73,
+        0x0F, 0x5F, 0xBF, 0x2C, 0x62, 0xA0, 0x6C, 0x01, 0x62, 0x26, 0x8B, 0xC5,
+        0x4A, 0x98, 0xF3, 0x76, 0xF2, 0xBD, 0x2C, 0x74, 0x10, 0x2D, 0xC6, 0x56,
+        0x0A, 0xD4, 0xF3, 0xE5, 0x1C, 0x05, 0xBA, 0x0C, 0x25, 0xD0, 0x3C, 0x6D,
+        0xEC, 0xED, 0xA2, 0x48, 0x65, 0x4D, 0xE8, 0x73, 0x50, 0xD1, 0x73, 0x38,
+        0x5E, 0xD6, 0x27, 0xE6, 0xA9, 0x7D, 0xFB, 0xF0, 0xF6, 0x64, 0xD2, 0xA3,
+        0xA5, 0x78, 0x67, 0x1A, 0xEF, 0xF8, 0xAB, 0x71, 0x4D, 0x85, 0x95, 0x61,
+        0xD8, 0x37, 0xBC, 0x19, 0xDB, 0xD4, 0x77, 0x3A, 0x62, 0x02, 0xB2, 0x7F,
+        0xC5, 0x3A, 0xBF, 0xE2, 0x73, 0xFA, 0xD2, 0x19, 0x58, 0x80, 0x7C, 0x70,
+        0x1D, 0x80, 0x02, 0x9F, 0xFD, 0x04, 0xAA, 0xF2, 0xD1, 0xB0, 0xC4, 0xA7,
+        0x18, 0xFB, 0x89, 0x1E, 0x81, 0xB7, 0x16, 0x48, 0xDE, 0x0B, 0xD4, 0x3C,
+        0xD0, 0xE6, 0x71, 0x90, 0xC3, 0xE7, 0x67, 0xE8, 0xFF, 0x0B, 0xDA, 0xDC,
+        0x29, 0x07, 0x9E, 0x4C, 0xFD, 0xFD, 0x37, 0x9D, 0xD3, 0x8D, 0xDF, 0xFE,
+        0xFB, 0x7C, 0xA8, 0x10, 0x78, 0xED, 0xC8, 0x04, 0x08, 0x72, 0x2A, 0x39,
+        0x7A, 0xEF, 0x3E, 0xEA, 0x18, 0x71, 0xCF, 0x42, 0xB6, 0xC3, 0x4B, 0x26,
+        0x1C, 0x44, 0x4F, 0xC0, 0xDB, 0xCF, 0x07, 0x0A, 0x5B, 0x70, 0xD7, 0x7D,
+        0x2F, 0xBF, 0xBE, 0x00, 0xCE, 0x59, 0xBB, 0x5D, 0xB9, 0x8B, 0xC8, 0x37,
+        0x5C, 0x72, 0x3E, 0x68, 0xF1, 0x9E, 0x22, 0x2E, 0x5B, 0x09, 0x4A, 0x8E,
+        0xFA, 0x91, 0x96, 0xE1, 0xDA, 0x79, 0x1A, 0xBC, 0x42, 0xA7, 0xAF, 0x51,
+        0x5A, 0x31, 0xC6, 0x86, 0x3C, 0x1B, 0xDF, 0xC8, 0x8C, 0x0A, 0x59, 0xE5,
+        0x5E, 0x5B, 0xE4, 0xB2, 0x79, 0xDE, 0x9C, 0xC3, 0x59, 0xCE, 0x4F, 0x2C,
+        0xE3, 0x8A, 0xBF, 0x2C, 0x09, 0x7A, 0x3C, 0xDE, 0x57, 0xF1, 0x50, 0x8A,
+        0x92, 0x48, 0xA4, 0x81, 0x95, 0x92, 0x4E, 0x50, 0xF0, 0xFF, 0x7B, 0x81,
+        0xD3, 0xCF, 0xD2, 0xAF, 0x0F, 0x4F, 0x6E, 0x7B, 0xC9, 0xA9, 0x9F, 0xC4,
+        0x7D, 0x0C, 0xD0, 0x89, 0x73, 0x04, 0xC0, 0x7B, 0x1E, 0x29, 0x51, 0xFF,
+        0xF5, 0xA1, 0x01, 0xE7, 0x43, 0xAF, 0xD6, 0x1F, 0xFD, 0x56, 0xAE, 0x3C,
+        0x72, 0x89, 0x2E, 0x99, 0x9F, 0x50, 0x3A, 0x28, 0x7A, 0x40, 0x0B, 0x3C,
+        0xBA, 0xA9, 0x41, 0xFA, 0x93, 0xC1, 0xFE, 0xB7, 0xAB, 0xFD, 0x27, 0xE7,
+        0x2D, 0xFE, 0x10, 0x79, 0x3C, 0x29, 0x1E, 0xDA, 0x65, 0xB8, 0xBF, 0xCB,
+        0xE0, 0x6E, 0x23, 0xEF, 0x61, 0xFC, 0x36, 0x9A, 0xF2, 0x87, 0xA6, 0xBD,
+        0x8A, 0xD5, 0xBE, 0xC7, 0x2D, 0x30, 0x7E, 0xFE, 0x3F, 0x71, 0xD6, 0x7F,
+        0x73, 0xE1, 0xFF, 0x03, 0x5C, 0xE8, 0x5B, 0x06, 0x11, 0x59, 0x7F, 0xFE,
+        0xF7, 0x07, 0x47, 0x0D, 0xCC, 0xAE, 0xCB, 0xA8, 0x64, 0xC0, 0xD7, 0xBF,
+        0x30, 0x6A, 0xD4, 0xEE, 0xFB, 0x63, 0x30, 0x05, 0xE5, 0x25, 0xA1, 0x40,
+        0xC4, 0x97, 0x6D, 0x87, 0x47, 0x60, 0x85, 0xED, 0xF2, 0x5F, 0x03, 0xF1,
+        0xCA, 0xC2, 0x0F, 0xBE, 0xE0, 0xFE, 0xE8, 0xFB, 0xEB, 0xBF, 0x0E, 0x76,
+        0x24, 0x85, 0xF4, 0x0B, 0x60, 0xFB, 0x19, 0x26, 0xA4, 0xFF, 0x01, 0x0B,
+        0xBB, 0x79, 0x3C, 0x46, 0xC3, 0xFD, 0x79, 0x20, 0x87, 0x5D, 0xBB, 0xE8,
+        0xE7, 0xB7, 0x80, 0x1D, 0x85, 0x7C, 0xD1, 0xE7, 0x84, 0x25, 0x89, 0xCF,
+        0xD0, 0xE3, 0xC1, 0x9E, 0x13, 0xAA, 0xA2, 0x49, 0xCF, 0x09, 0xE1, 0xC8,
+        0xE9, 0xCF, 0x09, 0x5E, 0xDD, 0x49, 0xF0, 0x39, 0x26, 0xA3, 0x26, 0x4F,
+        0x1F, 0x7F, 0xDE, 0xFA, 0xBF, 0x04, 0x56, 0x28, 0x4A, 0x0E, 0x81, 0x81,
+        0xE5, 0x33, 0xCF, 0xFF, 0x7F, 0x0A, 0x30, 0x28, 0xA6, 0x9F, 0x61, 0x14,
+        0x0B, 0xC6, 0xFA, 0xFE, 0xF6, 0xB7, 0xBF, 0xFD, 0x6F, 0x39, 0x7F, 0xA9,
+        0xB9, 0xDC, 0x7C, 0x00, 0x00
 };
@@ -0,0 +1,757 @@
+/*****************************************************************************
+ ***                        DO NOT EDIT THIS FILE !                        ***
+ *****************************************************************************
+ * This file is generated by build.py for version 0.54b at 19.10.2026 12:54:01
+ */
+#include "hub/portal.h"
+
+const size_t gyverhub::portal::style_br_size = 8828;
+const char gyverhub::portal::style_br_etag[] = "\"54e40a75\"";
+const char gyverhub::portal::style_br_head[] PROGMEM =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/css\r\n"
+        "Content-Encoding: br\r\n"
+        "Content-Length: 8828\r\n"
+        "Vary: Accept-Encoding\r\n"
+        "ETag: \"54e40a75\"\r\n"
+        "Cache-Control: " GHC_PORTAL_CACHE "\r\n"
+        GHI_HTTP_CORS
+        "\r\n";
+const uint8_t gyverhub::portal::style_br[] PROGMEM = {
+        0x1B, 0xDB, 0x7C, 0x51, 0x94, 0x86, 0x5E, 0x13, 0x51, 0xB5, 0x8A, 0x03,
+        0x3A, 0x13, 0x4C, 0x95, 0x0D, 0x1F, 0xA1, 0xD4, 0x8F, 0xA0, 0xB7, 0x33,
+        0x28, 0x85, 0x94, 0x29, 0x8B, 0x5B, 0x57, 0x2D, 0x28, 0x7C, 0xDD, 0x3F,
+        0xE6, 0xEB, 0x11, 0x1A, 0xFB, 0x24, 0xF7, 0x7E, 0xCD, 0xFC, 0xFB, 0x5E,
+        0x4E, 0xA4, 0x4B, 0xC2, 0x68, 0x4A, 0x85, 0xF4, 0x7F, 0xFE, 0xA7, 0xD6,
+        0xC6, 0x86, 0xC6, 0x2D, 0xA3, 0x80, 0x5B, 0xE7, 0x31, 0xB4, 0x2D, 0x63,
+        0x20, 0x98, 0xC4, 0x43, 0xC4, 0xDA, 0x33, 0xDC, 0xDB, 0xFC, 0x47, 0x5D,
+        0xBA, 0x67, 0x99, 0xDC, 0xBB, 0x84, 0x2D, 0xF5, 0xBD, 0x0F, 0x92, 0x5C,
+        0xA0, 0x89, 0x61, 0x33, 0x16, 0x0F, 0x42, 0xE4, 0xF7, 0x6E, 0xA2, 0xD3,
+        0x75, 0xA4, 0x63, 0x3A, 0xC1, 0xFB, 0x84, 0x0B, 0xFC, 0x00, 0x77, 0x64,
+        0x31, 0x3A, 0x84, 0x11, 0xFD, 0xFF, 0xA7, 0xF6, 0xB9, 0x61, 0x56, 0x7A,
+        0x27, 0x30, 0x28, 0xB8, 0x17, 0xC2, 0x13, 0x3C, 0xBE, 0xE5, 0xDD, 0x3F,
+        0x92, 0xE5, 0x39, 0xF1, 0xFC, 0x52, 0xEB, 0x2E, 0xCC, 0xBB, 0xE5, 0xC9,
+        0xB2, 0xE5, 0x6D, 0xF3, 0x27, 0xA5, 0x77, 0x94, 0x5D, 0xB4, 0x61, 0x81,
+        0x81, 0x30, 0x2C, 0x10, 0x3A, 0xA5, 0x03, 0x44, 0xA3, 0x6B, 0xAC, 0x53,
+        0x83, 0xE8, 0xC3, 0xA2, 0x31, 0x84, 0x60, 0xC3, 0xF5, 0x11, 0x61, 0x14,
+        0x70, 0xDA, 0xDB, 0xFE, 0x50, 0xFD, 0x5E, 0x7A, 0xE9, 0x5F, 0xCB, 0x36,
+        0x06, 0x81, 0x84, 0xD0, 0x02, 0x27, 0xE9, 0xD5, 0xAF, 0xE6, 0x53, 0x83,
+        0x0A, 0x17, 0xB8, 0x40, 0x30, 0xC0, 0x26, 0x87, 0x9F, 0xDE, 0x12, 0x60,
+        0xD5, 0x5E, 0x71, 0xF0, 0xF6, 0xBE, 0xF9, 0x15, 0x0A, 0x39, 0xD1, 0x22,
+        0x3A, 0x39, 0xEC, 0x5F, 0xD9, 0x00, 0x86, 0x8C, 0xA7, 0x8F, 0x73, 0xA5,
+        0x4D, 0x0C, 0x24, 0xAD, 0xF5, 0xEE, 0x27, 0xCF, 0x4E, 0x6B, 0x9A, 0xCB,
+        0xFB, 0xE9, 0x14, 0x6E, 0x5B, 0xD6, 0x06, 0xDE, 0xEF, 0xEB, 0xE6, 0x49,
+        0x6F, 0xAD, 0x1E, 0xBA, 0x57, 0x00, 0x2B, 0x9B, 0x35, 0xE0, 0xC0, 0xC3,
+        0x95, 0xAF, 0x07, 0x00, 0x79, 0xF7, 0x3A, 0x0A, 0xEF, 0x02, 0x00, 0x5E,
+        0x73, 0xD7, 0x22, 0x58, 0xFE, 0xFF, 0x15, 0x1D, 0x24, 0x93, 0x23, 0x11,
+        0xF9, 0x93, 0x87, 0x59, 0x4E, 0x01, 0x2F, 0x2A, 0x9C, 0xA8, 0xF2, 0x2B,
+        0x37, 0x8F, 0xDE, 0x6E, 0x78, 0x35, 0xE0, 0xAC, 0x5A, 0xED, 0x01, 0x21,
+        0xAA, 0x1C, 0x0F, 0xA4, 0xB6, 0xDD, 0x95, 0x7A, 0xEC, 0x73, 0xBD, 0x29,
+        0xBC, 0x41, 0x91, 0x62, 0x9D, 0xE1, 0x9D, 0x9B, 0x6D, 0xC8, 0x70, 0x8E,
+        0xF4, 0x2C, 0xDC, 0xD1, 0x71, 0xE6, 0x08, 0xEF, 0xEA, 0x61, 0x12, 0x5B,
+        0x45, 0xCD, 0x30, 0xE1, 0x80, 0xBD, 0x56, 0xD8, 0x1F, 0x6A, 0x9F, 0x8B,
+        0x3B, 0xEF, 0xFD, 0xD2, 0xC1, 0x6F, 0x37, 0x59, 0x71, 0x04, 0xD0, 0xFD,
+        0x7C, 0x79, 0x57, 0xF8, 0xD6, 0xE4, 0x8F, 0x7E, 0x43, 0x4C, 0xD6, 0xDF,
+        0x8A, 0x15, 0x7B, 0x19, 0xBD, 0x1E, 0x21, 0x1C, 0x82, 0x70, 0x92, 0xA6,
+        0x1C, 0x4F, 0xD3, 0xF4, 0x3F, 0x88, 0x29, 0xE7, 0xA1, 0xEF, 0x16, 0x69,
+        0x5F, 0x5D, 0xC2, 0x33, 0xE7, 0x69, 0x50, 0x05, 0xCB, 0x64, 0xC3, 0x84,
+        0xE9, 0x19, 0x37, 0x3B, 0x8E, 0xDA, 0x3D, 0xDE, 0x1C, 0xAA, 0x2E, 0x7D,
+        0xDC, 0x7D, 0x9D, 0xE6, 0x60, 0xF1, 0xE7, 0x1E, 0x6B, 0x06, 0x7A, 0x4F,
+        0x9D, 0xCF, 0x0E, 0x91, 0x9B, 0xBB, 0x3B, 0x44, 0xF8, 0x95, 0xAA, 0x89,
+        0xC5, 0xB6, 0xEC, 0xF8, 0x00, 0x13, 0x67, 0xBD, 0x8E, 0xB5, 0xFE, 0xD4,
+        0x62, 0x9E, 0xC4, 0x26, 0x26, 0xB2, 0x5B, 0x76, 0xB9, 0x78, 0xED, 0x96,
+        0x84, 0x47, 0xC3, 0x5A, 0x98, 0x1A, 0x7C, 0x64, 0xA5, 0xBA, 0x9A, 0xA4,
+        0xB1, 0xB6, 0x55, 0x5C, 0x04, 0x8F, 0x11, 0xBB, 0xFC, 0x68, 0x1D, 0xB1,
+        0xA6, 0x97, 0xDB, 0xC9, 0x05, 0x79, 0xB8, 0xBF, 0xE6, 0x70, 0xE2, 0xE3,
+        0xDD, 0xFD, 0x70, 0xEE, 0x80, 0xC6, 0x39, 0x74, 0x7E, 0x03, 0x00, 0x6A,
+        0x50, 0x5D, 0xD5, 0xF8, 0xA7, 0xD4, 0x42, 0x0D, 0x58, 0x84, 0x00, 0x80,
+        0x63, 0x60, 0xA3, 0x1E, 0xC4, 0x07, 0x00, 0x31, 0xE5, 0x64, 0xC0, 0xD5,
+        0x8D, 0x02, 0x48, 0x41, 0xE5, 0x41, 0xAF, 0xA6, 0xAF, 0xCA, 0xF3, 0xEA,
+        0xD8, 0x64, 0xB2, 0xE7, 0xFE, 0x69, 0xE2, 0xDD, 0xFB, 0x5A, 0xDD, 0x7B,
+        0x46, 0xDD, 0x8F, 0xB1, 0x20, 0xCB, 0xFD, 0xCD, 0x01, 0x60, 0x02, 0x4E,
+        0xAC, 0x54, 0xC5, 0x01, 0xF5, 0xE4, 0xDA, 0xA7, 0x0A, 0x66, 0x7E, 0xFB,
+        0x83, 0x96, 0x3D, 0xDE, 0xB1, 0x7A, 0xD2, 0xEE, 0xE3, 0x56, 0xD6, 0x09,
+        0x5A, 0x4D, 0xD5, 0xEA, 0x5F, 0x65, 0x3F, 0x1E, 0x03, 0x61, 0xCC, 0xD4,
+        0x08, 0x82, 0xDB, 0x89, 0x3A, 0x32, 0x76, 0x2F, 0x67, 0x8E, 0x6B, 0xAE,
+        0x56, 0xC1, 0x86, 0x47, 0xA1, 0x4A, 0x59, 0xF9, 0x22, 0x52, 0xEC, 0xDF,
+        0x04, 0x03, 0xA4, 0x26, 0xE8, 0x9A, 0xC8, 0xBF, 0x43, 0x19, 0x99, 0xAD,
+        0xDD, 0x97, 0xB6, 0x9F, 0x52, 0xA9, 0x32, 0x34, 0xAB, 0x5D, 0x9A, 0xD9,
+        0x0D, 0x9A, 0x09, 0x1D, 0xE1, 0x97, 0xF1, 0x1F, 0x9B, 0xE2, 0xB4, 0x05,
+        0xFD, 0x2E, 0x8C, 0x66, 0x03, 0x16, 0x4E, 0x2E, 0x98, 0x64, 0x51, 0x68,
+        0xAC, 0x86, 0x89, 0x25, 0xFF, 0x94, 0xCA, 0xEF, 0x52, 0xCC, 0x96, 0xFE,
+        0x46, 0x74, 0x99, 0xE3, 0xD3, 0x19, 0x27, 0xAB, 0x05, 0x80, 0xFA, 0xC1,
+        0x88, 0xEE, 0x0A, 0x8B, 0x92, 0x0A, 0x48, 0x3C, 0x2D, 0xB6, 0xDD, 0x4E,
+        0xA8, 0xBF, 0xE2, 0x7E, 0x9E, 0x69, 0xE8, 0xEB, 0xDA, 0x3E, 0x97, 0x0E,
+        0x71, 0xDF, 0x6E, 0xA5, 0x61, 0x12, 0x61, 0xE2, 0x6F, 0xAB, 0x18, 0x4C,
+        0x4B, 0x70, 0x8B, 0x1C, 0x02, 0x44, 0x90, 0x3A, 0x88, 0x04, 0xC8, 0x03,
+        0x08, 0xCD, 0x3A, 0x30, 0x9E, 0x07, 0xEF, 0x20, 0x12, 0xE3, 0x71, 0xF5,
+        0x40, 0xE4, 0xE5, 0xF7, 0x6E, 0xB9, 0x83, 0xC1, 0x57, 0x4A, 0x45, 0x92,
+        0xA2, 0x59, 0x70, 0xD9, 0xDF, 0xC0, 0x26, 0xBC, 0x34, 0xE1, 0x70, 0xDA,
+        0x90, 0x66, 0xA4, 0x52, 0xD3, 0x83, 0x5D, 0x33, 0xCA, 0x1D, 0x19, 0x63,
+        0x25, 0x60, 0x32, 0xD6, 0x07, 0x84, 0xEE, 0x56, 0x87, 0x9B, 0xD6, 0xDA,
+        0x44, 0xD0, 0x8D, 0x67, 0x23, 0xBF, 0x43, 0x00, 0xAF, 0xED, 0xAC, 0x3D,
+        0xEC, 0xDF, 0x6A, 0xDE, 0x11, 0xE7, 0x0D, 0x3F, 0x5D, 0x74, 0x3B, 0xB9,
+        0x91, 0xC4, 0xB1, 0x35, 0xF8, 0xCA, 0x88, 0x46, 0xAF, 0x9F, 0xF5, 0x17,
+        0x11, 0xF8, 0xE8, 0xFA, 0x5B, 0x97, 0x30, 0xBC, 0x55, 0x2E, 0xFA, 0x2B,
+        0xFA, 0x48, 0x0E, 0x4D, 0xCA, 0xBD, 0x87, 0xFB, 0x2A, 0x2C, 0xA5, 0x53,
+        0xEC, 0x69, 0x36, 0x75, 0xFE, 0x3E, 0x43, 0xD0, 0x0D, 0x53, 0x4E, 0x12,
+        0x3E, 0xD3, 0xC3, 0xED, 0xBE, 0x34, 0x61, 0xFA, 0x2C, 0x3A, 0xA6, 0xE6,
+        0x77, 0x59, 0x6C, 0x77, 0xE9, 0x03, 0xA6, 0x17, 0xCB, 0xBB, 0x57, 0x10,
+        0xEF, 0xCF, 0x62, 0x6F, 0xB9, 0x48, 0xDC, 0x56, 0xE5, 0x32, 0x6A, 0x7C,
+        0x4F, 0xE4, 0x02, 0x3B, 0x9B, 0x52, 0xAE, 0x15, 0xAE, 0x68, 0x7F, 0x64,
+        0x5F, 0xCD, 0x2B, 0x88, 0x55, 0x12, 0x6E, 0x63, 0xDB, 0xA3, 0xC9, 0x91,
+        0x9F, 0x6C, 0xB5, 0x92, 0x8A, 0x24, 0xE1, 0xCF, 0xCB, 0x3F, 0xF2, 0x59,
+        0x1C, 0x4A, 0x91, 0xCB, 0x93, 0xD0, 0xA7, 0xA6, 0xBB, 0xD3, 0xE2, 0xC8,
+        0xFB, 0x84, 0xDF, 0xDB, 0x3C, 0x9F, 0xEB, 0x12, 0xAD, 0xC5, 0xDE, 0x39,
+        0xD0, 0xA2, 0xFF, 0xAC, 0xE2, 0x4B, 0x55, 0xF3, 0xBE, 0x32, 0xE9, 0x9B,
+        0x12, 0xD4, 0xC7, 0xEE, 0x1C, 0x19, 0x70, 0x0E, 0x79, 0x87, 0x9C, 0x36,
+        0x05, 0xD3, 0x9E, 0x0A, 0x54, 0xCF, 0x9E, 0x02, 0x45, 0x9C, 0x03, 0x7B,
+        0xDB, 0x2F, 0xCA, 0xE9, 0xF4, 0x7B, 0x61, 0x81, 0xA6, 0x02, 0x8E, 0xB1,
+        0x6D, 0x5C, 0x39, 0x3B, 0x19, 0x37, 0x50, 0x82, 0x72, 0x25, 0x47, 0xDF,
+        0x8E, 0x02, 0xF2, 0x88, 0xF5, 0x4D, 0xD0, 0x8F, 0x8B, 0x09, 0x75, 0xEF,
+        0x83, 0xA7, 0x3F, 0x47, 0xF3, 0x51, 0x95, 0x33, 0xB3, 0x2D, 0xE6, 0xFD,
+        0x81, 0xD8, 0x27, 0x8C, 0x3F, 0x11, 0x9A, 0xE5, 0x3C, 0x6D, 0x82, 0x54,
+        0x1A, 0xEB, 0x1A, 0x57, 0x78, 0x1E, 0x5D, 0x1E, 0x44, 0xDF, 0xC3, 0xC1,
+        0x97, 0x30, 0x59, 0x97, 0x61, 0xD2, 0xFB, 0xD4, 0x5F, 0x91, 0xF2, 0x3B,
+        0x72, 0x08, 0x59, 0xE6, 0x0A, 0xD8, 0x50, 0x18, 0xDB, 0x9F, 0xD5, 0x3F,
+        0xE2, 0xCA, 0x4B, 0x65, 0x25, 0xA2, 0x07, 0xD8, 0x64, 0x74, 0xC5, 0x68,
+        0x22, 0x17, 0xEB, 0x49, 0xAB, 0x67, 0x43, 0x5C, 0x6E, 0x0F, 0xF9, 0x32,
+        0x55, 0x35, 0x63, 0x2C, 0x0A, 0xE7, 0xE2, 0x17, 0x70, 0xF3, 0x3D, 0xE4,
+        0xFC, 0x21, 0x74, 0x07, 0xEF, 0xEC, 0x4F, 0x83, 0x9B, 0x0B, 0xC0, 0xB0,
+        0x71, 0x54, 0xB6, 0x4C, 0xA4, 0xDD, 0xA6, 0x21, 0x1A, 0x8C, 0x22, 0x0A,
+        0xE5, 0xE3, 0xFE, 0x30, 0x9D, 0xD2, 0xD9, 0x9A, 0xC1, 0x2D, 0xBA, 0xA2,
+        0x1E, 0xA6, 0x39, 0xF0, 0x58, 0x81, 0x24, 0x0D, 0x7E, 0x36, 0xE6, 0xA2,
+        0x15, 0xED, 0xD8, 0x5D, 0x6B, 0xEB, 0x65, 0xBB, 0xB7, 0x60, 0x5A, 0x34,
+        0xC1, 0xDD, 0x4C, 0x7C, 0x18, 0xAB, 0x13, 0xD4, 0xDB, 0x2A, 0x11, 0x04,
+        0xA9, 0xDD, 0x1A, 0x1A, 0xD7, 0x0C, 0x3F, 0x22, 0x13, 0x14, 0xAD, 0x70,
+        0x31, 0xF8, 0xD9, 0x5C, 0xA9, 0xAE, 0x78, 0xD5, 0x1F, 0x94, 0x2D, 0xA3,
+        0x8C, 0x56, 0x86, 0x8F, 0xB5, 0x52, 0x8B, 0xBF, 0x23, 0x24, 0x12, 0x9C,
+        0xE0, 0xFE, 0xFE, 0x7C, 0xCA, 0x7B, 0xD2, 0x75, 0x19, 0xB4, 0xA4, 0xA5,
+        0xA4, 0xA9, 0xFB, 0xB9, 0x74, 0x36, 0xE6, 0x55, 0xB9, 0x83, 0x2C, 0x52,
+        0xC7, 0xF6, 0x4F, 0xB5, 0xFB, 0xD6, 0xDD, 0x2F, 0x48, 0x6B, 0xE2, 0x8F,
+        0x0F, 0x46, 0x28, 0x58, 0x7E, 0x62, 0x68, 0xB9, 0x8B, 0x52, 0x48, 0xF7,
+        0xF1, 0xD2, 0xCE, 0x83, 0xCA, 0x71, 0xCD, 0x10, 0xCD, 0x05, 0xBF, 0x6C,
+        0x01, 0xA7, 0x91, 0xEB, 0x42, 0xBC, 0x89, 0x2A, 0x20, 0x19, 0x6D, 0x4E,
+        0x7A, 0xA4, 0xB8, 0xB5, 0x33, 0xD2, 0xCC, 0xE8, 0xC8, 0xB4, 0x50, 0x7C,
+        0x36, 0xB0, 0x01, 0xD2, 0x49, 0x5A, 0x9A, 0x8E, 0x41, 0xC1, 0x6F, 0xF6,
+        0xAB, 0x73, 0xD5, 0xFF, 0x68, 0xA9, 0xC1, 0xF6, 0xB9, 0xFB, 0x7E, 0xD5,
+        0x61, 0x3E, 0x2D, 0x9D, 0xFD, 0xE6, 0xE5, 0x2B, 0x08, 0xEB, 0x71, 0xF3,
+        0x60, 0xA0, 0x60, 0x28, 0xF3, 0xB9, 0xE7, 0x4E, 0xE5, 0x4F, 0x09, 0x87,
+        0x61, 0x2C, 0x37, 0x6A, 0xC6, 0xA2, 0x73, 0xC4, 0xBA, 0x66, 0x7C, 0xDF,
+        0xB8, 0x3F, 0xB1, 0x5B, 0x8F, 0x42, 0x06, 0x5A, 0x3D, 0xC2, 0x34, 0x91,
+        0x32, 0x7D, 0x7A, 0x54, 0xFB, 0x03, 0x86, 0xFD, 0xD9, 0xBF, 0xA2, 0xC9,
+        0x11, 0x6B, 0xB2, 0xDA, 0xA3, 0xFF, 0x31, 0xD0, 0xB0, 0x3E, 0xC1, 0xA5,
+        0x0D, 0x56, 0x76, 0xD6, 0xD5, 0xE7, 0xFB, 0x22, 0x07, 0x2D, 0xCF, 0x7A,
+        0xE2, 0x44, 0xCA, 0xE8, 0xA5, 0x06, 0x22, 0x80, 0x60, 0x4B, 0x57, 0x40,
+        0x8A, 0x95, 0x68, 0x0D, 0x73, 0xC0, 0x9D, 0xB6, 0xDB, 0xF0, 0x33, 0x78,
+        0xBC, 0x3D, 0x3B, 0x1D, 0xC7, 0x0A, 0xC2, 0xFE, 0x4B, 0x09, 0xE7, 0xA6,
+        0x29, 0xEC, 0x06, 0x5E, 0x72, 0x9A, 0x28, 0x48, 0xC8, 0x03, 0xEB, 0x43,
+        0xE2, 0xD4, 0x7E, 0x4D, 0xE0, 0x30, 0xD4, 0x1D, 0xA8, 0xAA, 0x87, 0xC7,
+        0x65, 0xC7, 0x4A, 0x93, 0x0A, 0x4C, 0x87, 0xFC, 0x63, 0x98, 0xFC, 0x7C,
+        0x9C, 0xF7, 0x40, 0xEA, 0xD5, 0xA1, 0x44, 0x47, 0xB1, 0x66, 0xFA, 0xFC,
+        0x2B, 0x61, 0x72, 0xA6, 0x4E, 0x49, 0x1D, 0xBC, 0xB1, 0xAD, 0x10, 0x8A,
+        0xD6, 0x42, 0xCC, 0x98, 0xCA, 0xBE, 0x4C, 0x75, 0xD1, 0xB2, 0xB1, 0x83,
+        0x46, 0xF5, 0x9D, 0xC0, 0x13, 0x8A, 0x12, 0x92, 0x8F, 0x57, 0xDB, 0xE6,
+        0x8A, 0xE6, 0xBC, 0x3F, 0xD7, 0x10, 0x73, 0x64, 0xFE, 0x14, 0xDE, 0x0D,
+        0x55, 0xF9, 0x88, 0x84, 0x40, 0x67, 0xE6, 0xBE, 0xA3, 0xDA, 0x39, 0xC1,
+        0xD1, 0xF2, 0x95, 0xA6, 0x8D, 0xC6, 0x75, 0x1E, 0x81, 0x49, 0xBA, 0xBC,
+        0x08, 0xD5, 0xE4, 0xCF, 0x88, 0x1D, 0x5A, 0xE2, 0x92, 0xF5, 0x2C, 0xF2,
+        0x77, 0xC8, 0x46, 0x63, 0xC5, 0xE4, 0x8E, 0xBE, 0x4C, 0xA0, 0x11, 0x99,
+        0x1B, 0x63, 0x05, 0xD4, 0xA5, 0xED, 0x1E, 0xFB, 0xEB, 0x20, 0x77, 0xE2,
+        0x30, 0x1F, 0x40, 0xA7, 0xCA, 0x24, 0x7F, 0xDA, 0x5C, 0x35, 0x37, 0x1B,
+        0x9B, 0xDF, 0x3F, 0x36, 0x27, 0x78, 0xF1, 0xFB, 0x92, 0x83, 0x13, 0x89,
+        0x69, 0x4C, 0x2D, 0x0C, 0x81, 0xCA, 0x45, 0x3E, 0xA4, 0xAE, 0x2E, 0x3B,
+        0x53, 0x35, 0x58, 0x91, 0xB2, 0xF8, 0xED, 0x39, 0xBB, 0xA2, 0x9D, 0x2B,
+        0x28, 0xF8, 0x10, 0xAB, 0x5E, 0x98, 0x4C, 0x49, 0x6B, 0x89, 0x70, 0x37,
+        0x87, 0x40, 0x60, 0x48, 0x13, 0x6A, 0xF2, 0x78, 0x72, 0x87, 0xC4, 0xB5,
+        0xE7, 0x90, 0xDF, 0x1E, 0xEB, 0x08, 0xE4, 0x10, 0x96, 0xE2, 0x93, 0x48,
+        0xB6, 0x23, 0xBE, 0x11, 0x5E, 0xB5, 0xDF, 0x6F, 0x3C, 0x59, 0x93, 0x31,
+        0x9C, 0xEF, 0x25, 0x13, 0x55, 0xA6, 0x3D, 0x69, 0xBE, 0x0D, 0xCD, 0x68,
+        0x6D, 0x9E, 0x9D, 0x63, 0x8B, 0x5C, 0x5F, 0x41, 0x6E, 0x0C, 0xAF, 0x0D,
+        0xF4, 0x2F, 0x45, 0x72, 0xDC, 0x83, 0x7F, 0x08, 0xB3, 0xB4, 0x7F, 0xE5,
+        0x3D, 0x5C, 0x30, 0x25, 0x7D, 0xDB, 0x4C, 0xD1, 0xD0, 0x05, 0x98, 0xBF,
+        0x04, 0x9D, 0xB4, 0x5F, 0x4B, 0x36, 0xE6, 0x94, 0x74, 0x0D, 0x39, 0x6F,
+        0xFD, 0xFC, 0xC0, 0xD5, 0xA7, 0x48, 0x17, 0x1B, 0x10, 0x74, 0x09, 0x87,
+        0xC3, 0xDA, 0xFC, 0x36, 0x9E, 0xF8, 0xBD, 0xFB, 0x9F, 0xB0, 0xAE, 0xE6,
+        0x60, 0x6E, 0x30, 0x2E, 0x6C, 0x7F, 0x30, 0xB5, 0x64, 0x57, 0x09, 0x7B,
+        0x09, 0x0B, 0x4C, 0x04, 0x93, 0xEE, 0x93, 0xE1, 0xAE, 0xE5, 0xCD, 0x42,
+        0x4F, 0xA4, 0xE9, 0x00, 0xC1, 0x13, 0xAE, 0xBC, 0x16, 0xAA, 0xF8, 0xB1,
+        0xE4, 0xDB, 0xB3, 0x95, 0x92, 0x70, 0x71, 0xB5, 0xDB, 0xF7, 0x34, 0xE4,
+        0x1A, 0xA7, 0xA5, 0x84, 0x3A, 0xAB, 0xD8, 0x2F, 0xF1, 0xB6, 0xC2, 0xDE,
+        0x7E, 0xEF, 0x8F, 0x0F, 0x52, 0xAC, 0x5A, 0xB8, 0x08, 0x5E, 0x2D, 0xBA,
+        0x48, 0xEB, 0x12, 0x71, 0x1C, 0x94, 0x7D, 0x9F, 0xE2, 0xBE, 0xAF, 0xDB,
+        0x9E, 0x46, 0x03, 0x15, 0xE5, 0x09, 0x19, 0xEB, 0x72, 0xE1, 0x52, 0x92,
+        0x1C, 0x4A, 0x92, 0xEC, 0xB0, 0xA2, 0xF7, 0xD5, 0xF0, 0x41, 0xEE, 0x7E,
+        0xAD, 0x3A, 0x4C, 0x0C, 0x06, 0x5A, 0x6B, 0x77, 0xF5, 0x9D, 0x82, 0x9D,
+        0x36, 0x33, 0x38, 0xC1, 0x97, 0x84, 0x29, 0xDF, 0x73, 0x6C, 0x56, 0x5F,
+        0xC5, 0x9D, 0x2D, 0x7C, 0x28, 0xF9, 0x78, 0xA8, 0x75, 0xF9, 0xA0, 0x3A,
+        0x67, 0xEB, 0x45, 0xA8, 0x7F, 0xF1, 0x30, 0xDE, 0x2F, 0xC6, 0x6A, 0xBE,
+        0xCA, 0x77, 0x65, 0xE9, 0x3A, 0x6C, 0x9D, 0x50, 0xF5, 0x1F, 0x69, 0x95,
+        0x56, 0xFD, 0xD2, 0x01, 0x63, 0x3B, 0x23, 0x4E, 0x89, 0x08, 0x65, 0x9D,
+        0x0F, 0x5F, 0xE4, 0x7F, 0xB4, 0x95, 0x37, 0x12, 0x5B, 0xDA, 0x0E, 0xE5,
+        0x55, 0x22, 0x0E, 0xFD, 0x49, 0xAE, 0x72, 0xA1, 0xF7, 0x83, 0xFA, 0x21,
+        0x5D, 0x10, 0xD4, 0xA5, 0xBD, 0xED, 0xB2, 0xAD, 0xAC, 0x6D, 0x0F, 0x2C,
+        0xE1, 0xAC, 0xFD, 0x2F, 0xD8, 0x92, 0x03, 0xDB, 0xA3, 0x87, 0xA6, 0x29,
+        0xDA, 0xC3, 0x85, 0xB6, 0x4C, 0xA5, 0x3A, 0xC0, 0xA5, 0xCF, 0x42, 0x9A,
+        0x64, 0xE4, 0x42, 0xA1, 0xC3, 0xFA, 0xC4, 0xA2, 0xEE, 0xFB, 0xF7, 0x39,
+        0xB9, 0x6F, 0x5A, 0xE0, 0xF1, 0x2A, 0xE6, 0xFD, 0x34, 0x01, 0xC6, 0xA8,
+        0x00, 0x72, 0xCE, 0x03, 0x50, 0x53, 0x3F, 0x50, 0xF1, 0x30, 0x2B, 0x0D,
+        0x4D, 0x72, 0x92, 0xFD, 0x1D, 0x3D, 0x31, 0x19, 0xD7, 0xCC, 0xF7, 0xFC,
+        0x1B, 0xA6, 0x37, 0x7C, 0x25, 0x04, 0xA9, 0x59, 0xF7, 0x58, 0xDC, 0xC1,
+        0x55, 0x56, 0x8A, 0xC8, 0xFF, 0x20, 0xFB, 0x08, 0x05, 0xE2, 0x32, 0x6E,
+        0x0F, 0xF9, 0xC9, 0xED, 0x7B, 0xE0, 0xA7, 0xCE, 0x44, 0x29, 0xB0, 0x8D,
+        0x1D, 0x6B, 0x47, 0xFE, 0xC5, 0x19, 0x5F, 0x27, 0x5A, 0x8D, 0x36, 0xEB,
+        0xD1, 0x3B, 0x72, 0x2E, 0xD2, 0x9C, 0x60, 0xFC, 0x09, 0xB7, 0x15, 0xDA,
+        0xF1, 0xFC, 0x5B, 0x72, 0x7B, 0x6A, 0xF0, 0x54, 0xE1, 0x8B, 0xD3, 0xAE,
+        0x26, 0xE5, 0x3E, 0xF3, 0xB1, 0x9E, 0x2B, 0x3B, 0x68, 0xA1, 0xCC, 0x94,
+        0x9C, 0x77, 0x96, 0xA9, 0x3B, 0x5F, 0xC0, 0xB2, 0x75, 0x75, 0xB2, 0x0C,
+        0x4C, 0xE0, 0x13, 0x74, 0x05, 0xFE, 0xC2, 0x64, 0x88, 0x1D, 0x4D, 0x2F,
+        0xAB, 0xDE, 0xF8, 0x22, 0x79, 0x20, 0x4F, 0xCD, 0xAF, 0xCE, 0xAB, 0xAD,
+        0xD2, 0xAB, 0x6D, 0xAD, 0xF2, 0x2F, 0x91, 0xA5, 0xAA, 0x5C, 0x28, 0x9E,
+        0xFB, 0xBC, 0x90, 0x35, 0x2E, 0x53, 0xF8, 0x38, 0xA7, 0xF3, 0x44, 0x03,
+        0x65, 0x15, 0xFA, 0x86, 0x66, 0xFD, 0x18, 0xA8, 0x6D, 0x39, 0x17, 0x1F,
+        0xFF, 0x2D, 0xD7, 0x37, 0xC4, 0x09, 0xB6, 0x47, 0xCA, 0x09, 0xA3, 0x2B,
+        0x9B, 0x16, 0xD3, 0x98, 0x67, 0x22, 0xAB, 0x27, 0xB1, 0x75, 0x90, 0x32,
+        0xC5, 0x96, 0x22, 0x9B, 0xA7, 0xB0, 0xAE, 0x1A, 0xD9, 0x5F, 0x99, 0x91,
+        0x5D, 0x87, 0x87, 0xF7, 0xC3, 0x60, 0xAC, 0x16, 0xF6, 0x1B, 0x9E, 0x39,
+        0x52, 0x6F, 0x91, 0x26, 0x79, 0x4D, 0x0A, 0x56, 0x00, 0x74, 0x65, 0x4F,
+        0x2E, 0xAD, 0x90, 0xDF, 0xBC, 0x19, 0xC8, 0x7D, 0x8D, 0xBF, 0x67, 0x53,
+        0xF1, 0x0B, 0x57, 0x27, 0xB8, 0x10, 0xD2, 0x33, 0x44, 0xC0, 0xA5, 0x6F,
+        0x7D, 0x12, 0x6B, 0xEB, 0xA1, 0xCB, 0x81, 0xF1, 0xB2, 0x03, 0x3F, 0x6C,
+        0x31, 0x01, 0xC9, 0x9D, 0x75, 0x4E, 0x1D, 0x28, 0xEE, 0xF3, 0xA7, 0xEC,
+        0x9F, 0xC3, 0xB3, 0xAA, 0x94, 0xCC, 0xFC, 0xD4, 0xD9, 0xAB, 0xCE, 0xE4,
+        0xE0, 0xBC, 0x9E, 0x8F, 0x58, 0x3B, 0xF0, 0x88, 0x57, 0x65, 0xD7, 0xBA,
+        0x30, 0x2E, 0x61, 0x01, 0x9F, 0x08, 0x0E, 0x3D, 0x64, 0xBF, 0xD2, 0x34,
+        0xF6, 0xE8, 0x01, 0x14, 0xC3, 0x64, 0xED, 0xC3, 0x0C, 0xCE, 0x20, 0xB0,
+        0x53, 0x3D, 0x66, 0xE5, 0x14, 0x98, 0x46, 0x6C, 0xEB, 0x45, 0x27, 0x25,
+        0xB3, 0xE6, 0x50, 0x7F, 0x95, 0x1A, 0xEA, 0xAB, 0xF7, 0x48, 0x60, 0xBF,
+        0x0E, 0x7A, 0xCD, 0xAE, 0xDA, 0x5F, 0x9C, 0xD0, 0xC5, 0xF2, 0x8D, 0x00,
+        0x1A, 0x5E, 0xBF, 0xC6, 0xA8, 0xAE, 0xED, 0x55, 0xE3, 0xE5, 0xED, 0x57,
+        0x95, 0x6C, 0x08, 0x7B, 0x4B, 0x8D, 0x71, 0x6D, 0xDC, 0x8C, 0x5A, 0x4E,
+        0x09, 0x6A, 0x09, 0xD7, 0x8A, 0x51, 0xF2, 0x2C, 0x30, 0x44, 0x17, 0x78,
+        0x22, 0x78, 0xFA, 0x79, 0x67, 0xAF, 0xCD, 0xF9, 0x3B, 0xCA, 0x1E, 0x7E,
+        0xED, 0x2F, 0xCE, 0xCC, 0x32, 0x93, 0x12, 0xCB, 0x62, 0x69, 0xE2, 0x71,
+        0xD1, 0x0A, 0x80, 0xCD, 0x88, 0x21, 0x34, 0xBF, 0xE6, 0x2C, 0x2F, 0xF5,
+        0xA5, 0x36, 0x95, 0x6F, 0xBC, 0xCB, 0x1E, 0xFB, 0xE5, 0x25, 0x92, 0x7B,
+        0x2B, 0x9D, 0x14, 0x04, 0x21, 0x17, 0xC4, 0x50, 0x0C, 0xB0, 0x98, 0x1F,
+        0x05, 0x77, 0xAB, 0x92, 0x59, 0x85, 0x07, 0x2E, 0xA0, 0x28, 0x37, 0x13,
+        0xB7, 0x24, 0xFD, 0xA8, 0x67, 0x7B, 0x01, 0xCF, 0x87, 0xBF, 0xE8, 0x87,
+        0x3E, 0x50, 0xF0, 0x65, 0x4E, 0x85, 0x08, 0xCE, 0xFB, 0x90, 0x69, 0x54,
+        0xD3, 0x67, 0x01, 0x87, 0x65, 0xAD, 0xCF, 0x73, 0x57, 0x17, 0xD1, 0x1F,
+        0xA1, 0xA7, 0x6D, 0x92, 0xB6, 0x41, 0xF7, 0x34, 0x5C, 0x91, 0xBF, 0x50,
+        0x20, 0xF7, 0xE4, 0xBA, 0x82, 0x49, 0x7B, 0x69, 0x78, 0x5A, 0x50, 0x62,
+        0xE4, 0xEB, 0xA5, 0x6C, 0x85, 0x70, 0xEB, 0x46, 0xB7, 0x18, 0xE8, 0xF7,
+        0x11, 0xE8, 0x6A, 0x64, 0xCB, 0xE6, 0x2F, 0xFB, 0x8B, 0xB1, 0xEB, 0xDC,
+        0xAC, 0x26, 0x41, 0xB3, 0x65, 0x33, 0x5A, 0xE7, 0x61, 0x26, 0x9C, 0x7E,
+        0x37, 0x6B, 0xB5, 0x86, 0x7D, 0x14, 0x2F, 0xA8, 0xB1, 0x9D, 0xD7, 0x1D,
+        0xA0, 0xDD, 0x1B, 0x1A, 0xC4, 0xEC, 0x7D, 0x02, 0xCA, 0xE2, 0x32, 0xDB,
+        0xD5, 0xEA, 0x83, 0xB2, 0x5F, 0x92, 0x56, 0x87, 0x25, 0x42, 0x16, 0x62,
+        0xF6, 0x78, 0xEE, 0xD0, 0x0C, 0x3A, 0xB1, 0x18, 0x7D, 0xDC, 0x62, 0xA0,
+        0x43, 0x3A, 0xA5, 0xFE, 0xA5, 0x6D, 0x9B, 0x57, 0x12, 0x79, 0x40, 0x54,
+        0x92, 0x16, 0x13, 0x2D, 0x62, 0x66, 0x6E, 0x2E, 0x24, 0x33, 0x52, 0x0A,
+        0x80, 0xB5, 0x71, 0xBC, 0x10, 0x81, 0x99, 0xA5, 0x11, 0x46, 0xC2, 0x24,
+        0xD3, 0xC3, 0x57, 0x27, 0x7B, 0x2A, 0xB5, 0x70, 0xA7, 0xA2, 0xBF, 0x9B,
+        0xBA, 0x0A, 0xFA, 0xAC, 0x05, 0x07, 0x8F, 0x98, 0xC9, 0x89, 0xB2, 0x59,
+        0x29, 0x98, 0x32, 0x27, 0xCE, 0xEB, 0x23, 0x1B, 0x80, 0xA3, 0x38, 0x02,
+        0x65, 0x95, 0xB5, 0x6E, 0x33, 0x45, 0xFE, 0xDA, 0x39, 0x91, 0x8C, 0x00,
+        0x5F, 0xF3, 0x4C, 0xD1, 0xFF, 0xD2, 0x9D, 0xF8, 0x61, 0xAF, 0xDE, 0x04,
+        0xB1, 0x17, 0x5B, 0x14, 0xC9, 0x44, 0x10, 0x85, 0xCE, 0x79, 0x40, 0x5A,
+        0xBD, 0xF3, 0x2D, 0x2C, 0x90, 0x16, 0x22, 0x66, 0x19, 0xD5, 0xCD, 0x26,
+        0x44, 0x86, 0x3E, 0x26, 0x2E, 0xC8, 0xE9, 0xCD, 0xBD, 0xBF, 0x5B, 0x00,
+        0x0D, 0x86, 0x69, 0x19, 0x71, 0x5B, 0xB7, 0xA1, 0xF2, 0xEE, 0xB3, 0x43,
+        0xFE, 0x57, 0xF8, 0xBD, 0x17, 0x60, 0x3D, 0xF2, 0x47, 0xFF, 0x95, 0x7A,
+        0xAE, 0x22, 0xE7, 0xF0, 0xCB, 0x89, 0x44, 0x11, 0x9A, 0xB7, 0xC2, 0x5F,
+        0x80, 0xC2, 0x9D, 0x67, 0xA6, 0x2B, 0x1D, 0x24, 0x71, 0x3E, 0xFB, 0xED,
+        0x36, 0x71, 0xB0, 0xAC, 0xA3, 0x84, 0x1A, 0xD8, 0xD1, 0xF3, 0xD9, 0x9B,
+        0x5C, 0xE1, 0x5B, 0xD7, 0xD1, 0x9B, 0xC6, 0x1F, 0xBB, 0x7A, 0xEF, 0x03,
+        0x57, 0x1A, 0x6F, 0x88, 0xAF, 0xAB, 0xB8, 0x3B, 0x4E, 0xFD, 0x98, 0xA3,
+        0x0D, 0x1E, 0x6D, 0x13, 0x3A, 0xBE, 0x97, 0xFE, 0xC0, 0x53, 0xD5, 0x12,
+        0x9F, 0x4B, 0xAE, 0xA0, 0xFB, 0xD6, 0xC9, 0x85, 0x4B, 0xA8, 0xCE, 0x72,
+        0x3C, 0x54, 0x0B, 0xA7, 0x0B, 0x2B, 0xCB, 0x75, 0xAA, 0xE7, 0xB9, 0xBE,
+        0xA8, 0xBA, 0x7B, 0xD7, 0xA8, 0xFB, 0x81, 0xB5, 0x83, 0x1F, 0xE1, 0xB2,
+        0x21, 0x8D, 0x31, 0xC3, 0x39, 0x75, 0x1A, 0x37, 0x22, 0xA1, 0x75, 0x00,
+        0xA4, 0x07, 0x00, 0xB2, 0xB5, 0x0D, 0x35, 0x7F, 0xA0, 0xF2, 0x03, 0x4C,
+        0xD5, 0xAD, 0x7C, 0x74, 0x02, 0xBC, 0xE6, 0x5F, 0x25, 0x38, 0x36, 0x7B,
+        0x00, 0x1C, 0x3F, 0x4E, 0x2E, 0xFA, 0xCA, 0x7E, 0x4F, 0xBF, 0xC0, 0x4C,
+        0x62, 0x8F, 0xB7, 0x45, 0xDB, 0xE3, 0x48, 0xF1, 0x6D, 0xEB, 0x58, 0x67,
+        0xD6, 0x82, 0x14, 0xF8, 0x8F, 0xB1, 0x6B, 0x7C, 0x21, 0x0F, 0xC7, 0x5C,
+        0x9F, 0x42, 0x78, 0xC3, 0x58, 0xC2, 0xDE, 0x8D, 0x2C, 0x42, 0x9E, 0xCD,
+        0xDC, 0x8C, 0x60, 0x15, 0x6F, 0x65, 0x31, 0xBC, 0x5E, 0x62, 0x7D, 0x4A,
+        0xF4, 0x95, 0x46, 0x68, 0x47, 0xE7, 0xBA, 0x37, 0xDE, 0x24, 0x4C, 0x10,
+        0x62, 0x4C, 0xB6, 0xA3, 0x6B, 0xFD, 0x26, 0xF1, 0x58, 0xD2, 0xA1, 0x92,
+        0x1F, 0x06, 0x7F, 0xF9, 0x40, 0x1A, 0x6D, 0xC8, 0x37, 0xA6, 0xD6, 0xB8,
+        0x4E, 0x04, 0x98, 0x77, 0x57, 0x10, 0x63, 0xEC, 0x96, 0x47, 0x15, 0x23,
+        0x6A, 0x81, 0xA1, 0x91, 0xD7, 0x1E, 0xC5, 0xBA, 0x23, 0x01, 0x0B, 0x0F,
+        0x69, 0x6F, 0x99, 0x2B, 0x11, 0xB1, 0x41, 0x60, 0x0A, 0xE2, 0xED, 0xE3,
+        0x87, 0xCF, 0x41, 0x33, 0x46, 0xD9, 0xE5, 0x24, 0x20, 0x97, 0x91, 0xA8,
+        0x34, 0xDB, 0x4B, 0x01, 0x67, 0x53, 0x42, 0x34, 0xD6, 0xC4, 0xE0, 0x49,
+        0xCD, 0x06, 0xD5, 0x3A, 0x8B, 0x34, 0xF3, 0x49, 0xFC, 0x0E, 0x1A, 0xDC,
+        0xD3, 0x82, 0x8C, 0xBF, 0x9D, 0x72, 0xC0, 0xF4, 0x85, 0xAB, 0x8C, 0x6D,
+        0xF9, 0x1B, 0xFE, 0x5C, 0x7B, 0x0C, 0xA1, 0xF4, 0x96, 0x4B, 0x6C, 0xD8,
+        0xC4, 0x02, 0x43, 0x1B, 0xF2, 0x9A, 0xBE, 0xD4, 0xC6, 0xE3, 0x9C, 0x3E,
+        0xC1, 0x3C, 0x7A, 0xAD, 0xC9, 0xEA, 0x5F, 0x9F, 0x22, 0x04, 0xAE, 0x2D,
+        0x39, 0x0B, 0x7E, 0x0D, 0xC6, 0x96, 0xE3, 0x08, 0xD8, 0x3C, 0x5C, 0x14,
+        0x08, 0x36, 0x69, 0x63, 0x28, 0x01, 0x4A, 0x13, 0x62, 0x42, 0x34, 0x6E,
+        0x26, 0x29, 0x47, 0xF4, 0x69, 0x34, 0xC6, 0x6E, 0x6C, 0x15, 0xAD, 0xB3,
+        0xAC, 0xF9, 0x1B, 0x85, 0x97, 0x2A, 0x09, 0xC5, 0xD2, 0x55, 0xD2, 0x57,
+        0x6C, 0xDF, 0x56, 0xF4, 0x3E, 0x74, 0x09, 0x16, 0x92, 0x73, 0xA6, 0x73,
+        0xB4, 0xF8, 0x1E, 0x7A, 0x63, 0xC8, 0x82, 0x08, 0xBB, 0x2B, 0x7C, 0xE9,
+        0x2E, 0x42, 0xCF, 0x1B, 0x00, 0xAB, 0x87, 0xCF, 0x37, 0xA8, 0x78, 0xB5,
+        0x07, 0x94, 0xE7, 0xB9, 0x40, 0xE4, 0xEF, 0xBB, 0xE1, 0x4D, 0xBE, 0x4F,
+        0x1B, 0xDE, 0x31, 0x3D, 0x05, 0xF4, 0x6E, 0xA7, 0x7A, 0x6A, 0x63, 0x86,
+        0x0D, 0x5F, 0xAF, 0x9E, 0xDA, 0xEC, 0x9A, 0x6B, 0xAB, 0x0B, 0xF8, 0x6B,
+        0x7C, 0x6D, 0x1E, 0x00, 0xD2, 0xF6, 0xF2, 0xA3, 0x03, 0x5A, 0x9A, 0x6F,
+        0x3F, 0x6C, 0x35, 0xCD, 0x35, 0xC7, 0xE8, 0x49, 0x96, 0x24, 0x41, 0x21,
+        0x79, 0x43, 0xED, 0x21, 0x55, 0xC3, 0x76, 0x16, 0x0A, 0xCB, 0x4F, 0xE5,
+        0xAC, 0x0C, 0x4B, 0x7C, 0xB2, 0xAD, 0x6F, 0xC8, 0xDF, 0x74, 0xFF, 0x3A,
+        0x19, 0x4A, 0xA3, 0xD9, 0x95, 0xA6, 0x82, 0x1B, 0x1D, 0x4D, 0x88, 0x9F,
+        0x63, 0x9C, 0xE1, 0xA6, 0x3F, 0xA9, 0x12, 0xC6, 0x58, 0xF6, 0xE9, 0xD3,
+        0xD4, 0xC5, 0x76, 0x3D, 0x82, 0x3A, 0xD9, 0x70, 0xD1, 0x7A, 0xCB, 0xCA,
+        0xAA, 0x9D, 0x5A, 0xD9, 0xE9, 0x0D, 0x1B, 0xE3, 0xE9, 0x98, 0x8C, 0xD7,
+        0xCA, 0xC4, 0xE7, 0x85, 0x79, 0x43, 0x64, 0x11, 0x30, 0xA9, 0x14, 0x30,
+        0x29, 0x1F, 0xBA, 0xB7, 0x51, 0xA2, 0x23, 0x49, 0xE0, 0xBA, 0x6E, 0xC5,
+        0xAA, 0xFE, 0x63, 0x3F, 0x08, 0x6F, 0x6E, 0x2B, 0xDD, 0x05, 0xC5, 0xE8,
+        0x2F, 0xAC, 0xE8, 0x0E, 0xEA, 0x72, 0xDE, 0x52, 0x8D, 0xE4, 0x0D, 0x3B,
+        0x94, 0x58, 0xA7, 0xFD, 0x2A, 0xC6, 0x96, 0xCA, 0x43, 0x5F, 0xE9, 0x62,
+        0xBB, 0x61, 0xD4, 0x96, 0x94, 0x03, 0xA5, 0xB6, 0x0A, 0x76, 0x1C, 0xFB,
+        0xFE, 0xC8, 0x8C, 0xDC, 0x6B, 0xF2, 0x53, 0x40, 0x25, 0x9D, 0x99, 0xB8,
+        0x00, 0x88, 0xFE, 0xDE, 0xAC, 0x9F, 0xDD, 0xCC, 0xC0, 0xCA, 0xE9, 0x99,
+        0x8C, 0x9A, 0x72, 0xFD, 0x71, 0x1C, 0xC2, 0x3A, 0x77, 0x0B, 0x3D, 0xD7,
+        0xDC, 0x7E, 0x68, 0xFF, 0x15, 0xC2, 0x98, 0xBD, 0x9E, 0x97, 0xD1, 0x19,
+        0x0D, 0x39, 0xD9, 0xA1, 0x9A, 0x49, 0x33, 0xAE, 0xC7, 0xED, 0xCC, 0x09,
+        0x4A, 0x4D, 0x2F, 0x67, 0x21, 0x40, 0x9A, 0x0D, 0x7F, 0x15, 0xC9, 0x3D,
+        0x97, 0xF2, 0x2A, 0x55, 0x1D, 0x5D, 0xCD, 0x1A, 0x3E, 0xF2, 0xFD, 0x3C,
+        0x52, 0x57, 0x7F, 0x06, 0xFC, 0xF5, 0xC0, 0xAC, 0x7D, 0x5F, 0x8D, 0x27,
+        0x76, 0xB9, 0x0F, 0x68, 0xE0, 0xD3, 0x68, 0xFA, 0x5D, 0x21, 0x72, 0x42,
+        0x15, 0x1C, 0x0D, 0x16, 0xD1, 0x64, 0x63, 0x64, 0xF1, 0x2B, 0x85, 0x70,
+        0xCA, 0x0F, 0xAF, 0x1D, 0xCF, 0x45, 0xAD, 0x59, 0xF6, 0xB4, 0xBD, 0xDE,
+        0x89, 0xE1, 0x73, 0x61, 0xD4, 0x63, 0xAE, 0xF1, 0x01, 0x58, 0x6C, 0x0F,
+        0x96, 0x3D, 0x8F, 0xD8, 0x8E, 0x07, 0xCC, 0x2B, 0xD5, 0x1D, 0x38, 0x53,
+        0x73, 0x3C, 0xC6, 0x6F, 0x19, 0xDE, 0x9D, 0xE3, 0x05, 0x36, 0x28, 0xF6,
+        0x4B, 0xCE, 0xE0, 0x13, 0x59, 0x67, 0x32, 0xB2, 0xCE, 0x96, 0xD9, 0x22,
+        0x20, 0x3A, 0xAB, 0xE8, 0x4C, 0xE6, 0x97, 0x37, 0xA0, 0x62, 0x00, 0x5E,
+        0x46, 0x93, 0x5F, 0x2B, 0xA7, 0x67, 0xCB, 0x4D, 0x96, 0x86, 0x8C, 0xAB,
+        0xB1, 0x2C, 0xF0, 0x61, 0x5F, 0x02, 0xC1, 0xBE, 0xB9, 0xF6, 0x0D, 0x70,
+        0xA3, 0xBF, 0xB0, 0x26, 0x17, 0x1E, 0x00, 0x20, 0xA0, 0x55, 0xAB, 0x94,
+        0x3A, 0xC6, 0x75, 0x4B, 0x8D, 0x5A, 0xF7, 0xEB, 0x7B, 0x5B, 0x02, 0x7B,
+        0xC7, 0xCA, 0xC2, 0x83, 0x6E, 0x10, 0x80, 0xFE, 0x01, 0x6F, 0x43, 0xA7,
+        0x06, 0x38, 0xA5, 0x82, 0xA0, 0x68, 0xF0, 0xA1, 0x2B, 0xD9, 0xED, 0x52,
+        0xD6, 0x2F, 0x7D, 0xD5, 0xCA, 0x98, 0xB9, 0x27, 0x87, 0x8C, 0xBA, 0x5B,
+        0x06, 0x6D, 0xEB, 0x2B, 0xA6, 0x56, 0x33, 0xC0, 0x26, 0x71, 0x5E, 0xCB,
+        0xFA, 0x32, 0x40, 0x40, 0xA8, 0x1B, 0x6C, 0x06, 0x97, 0x39, 0x75, 0x45,
+        0xAE, 0xAE, 0x30, 0xE3, 0xC8, 0xEA, 0xDB, 0xC6, 0x4D, 0x79, 0x82, 0xA2,
+        0xE3, 0xB1, 0x14, 0x47, 0x5E, 0x61, 0xE3, 0x14, 0x8C, 0x8F, 0x58, 0x75,
+        0x6A, 0x70, 0xE8, 0x35, 0xBB, 0xDF, 0xD9, 0x66, 0x32, 0x84, 0x8D, 0x97,
+        0xA8, 0xC5, 0x73, 0x9B, 0x5F, 0xA3, 0x18, 0xF8, 0x83, 0x56, 0xEA, 0xE4,
+        0x5B, 0x91, 0x4A, 0xAC, 0x6C, 0x4C, 0x5B, 0x4E, 0xCE, 0x02, 0x89, 0x6A,
+        0x6E, 0x7F, 0xCF, 0x13, 0xB1, 0x59, 0xAB, 0x03, 0x5D, 0x53, 0x4F, 0x00,
+        0x36, 0xD5, 0x13, 0x37, 0xBD, 0x32, 0xAD, 0x76, 0x63, 0x58, 0x7B, 0x03,
+        0x3D, 0x41, 0xE4, 0x08, 0x3B, 0x8E, 0xD5, 0xC8, 0x6B, 0x8F, 0x6C, 0xB4,
+        0x3F, 0x68, 0x01, 0x46, 0x27, 0x35, 0x7E, 0xF5, 0x6C, 0x6B, 0xE6, 0xBA,
+        0x56, 0x52, 0x8F, 0x3A, 0xB6, 0x3B, 0x6B, 0x39, 0xEF, 0x54, 0x8B, 0x30,
+        0x3D, 0x08, 0xDC, 0x3F, 0xD1, 0xE3, 0x32, 0x35, 0x71, 0x8C, 0x2A, 0x50,
+        0xB0, 0x1F, 0x10, 0xF5, 0x04, 0xB8, 0x38, 0x7E, 0x48, 0x12, 0x7F, 0x1A,
+        0x6E, 0xB4, 0xE4, 0x46, 0x9C, 0xC9, 0xC7, 0x94, 0xBD, 0x23, 0xEA, 0xA8,
+        0xF5, 0x77, 0xA9, 0x96, 0x56, 0x34, 0x2B, 0xF8, 0xFA, 0x9A, 0x40, 0xCC,
+        0xC7, 0xE5, 0x65, 0x5D, 0xFE, 0xA3, 0x4D, 0x47, 0xC6, 0xFD, 0xF5, 0x87,
+        0x85, 0xED, 0x7E, 0x5C, 0xFA, 0xBB, 0xED, 0xF8, 0x2A, 0xE2, 0x91, 0x45,
+        0xB6, 0x88, 0xFF, 0xF9, 0x41, 0xD4, 0xEC, 0xC0, 0x1A, 0xFE, 0x52, 0xBA,
+        0xD9, 0xF8, 0x54, 0x47, 0x36, 0x16, 0xA3, 0x4D, 0x34, 0x61, 0x90, 0x56,
+        0xC6, 0x62, 0x52, 0xB6, 0x7F, 0xE7, 0xEF, 0xC3, 0xF7, 0xCE, 0xFF, 0xBA,
+        0xA2, 0x11, 0xF3, 0x48, 0xCA, 0x3E, 0x69, 0x5E, 0x8D, 0x25, 0x8C, 0x74,
+        0x62, 0x44, 0x88, 0x37, 0x49, 0x36, 0xD1, 0x89, 0xE9, 0x43, 0x02, 0xD6,
+        0x74, 0x4E, 0x81, 0x5F, 0x45, 0x36, 0x84, 0x04, 0xB1, 0xD9, 0xFB, 0x42,
+        0x7E, 0x04, 0xFF, 0x7D, 0x54, 0xB0, 0x3F, 0x7E, 0x0F, 0x38, 0x54, 0x0A,
+        0xB4, 0xA7, 0x96, 0x31, 0xDA, 0x30, 0xA0, 0x18, 0x48, 0x9F, 0xEE, 0x44,
+        0x2B, 0x56, 0xB7, 0x11, 0x37, 0x9B, 0xB8, 0x7C, 0xBE, 0xF5, 0x54, 0x83,
+        0x1D, 0x97, 0x5D, 0x9A, 0xC5, 0x94, 0xC1, 0xAB, 0xAE, 0xD8, 0x33, 0x3F,
+        0x1A, 0x23, 0xCD, 0x2F, 0x5D, 0x90, 0x80, 0x57, 0x46, 0xB8, 0x33, 0x65,
+        0x86, 0xFD, 0x5A, 0x39, 0x52, 0x0E, 0x24, 0xE7, 0x4D, 0xC8, 0x16, 0x46,
+        0xCE, 0xA9, 0x3F, 0xCD, 0xDB, 0x9C, 0xF5, 0x50, 0xDF, 0xCF, 0xF8, 0xF7,
+        0x86, 0xEA, 0xBA, 0x19, 0x63, 0x8E, 0x1A, 0xF8, 0x96, 0x48, 0xD6, 0x47,
+        0x3E, 0x9E, 0x3E, 0x67, 0x29, 0xE3, 0xEB, 0x2A, 0x92, 0xA7, 0x85, 0x58,
+        0x17, 0xB0, 0xEF, 0x65, 0x99, 0x11, 0x8F, 0x8A, 0xC9, 0x02, 0xD9, 0xCB,
+        0x86, 0xED, 0x85, 0xBE, 0xAF, 0x4F, 0x75, 0x6C, 0x11, 0x16, 0x6E, 0xD5,
+        0xF3, 0xDF, 0x9B, 0x21, 0x59, 0xAB, 0x7F, 0x6C, 0x49, 0xDC, 0x20, 0xDB,
+        0xCB, 0xF1, 0x56, 0x21, 0xB1, 0xD4, 0x25, 0xD2, 0x0A, 0x93, 0xD5, 0x47,
+        0x07, 0x6D, 0x01, 0xA4, 0x0E, 0xFE, 0xCA, 0xCB, 0x60, 0x6D, 0x64, 0x3F,
+        0x55, 0xCB, 0xC9, 0x68, 0x48, 0x3B, 0x30, 0xDA, 0xBE, 0xB1, 0xDA, 0x27,
+        0xEE, 0x40, 0xBD, 0xD3, 0x27, 0x9D, 0x0B, 0xB0, 0x93, 0x59, 0x41, 0x74,
+        0x66, 0x76, 0x02, 0xF6, 0xCB, 0xCE, 0xFA, 0xD7, 0x01, 0x6E, 0xF8, 0xBE,
+        0x3B, 0x0C, 0x48, 0x37, 0x61, 0xA4, 0x41, 0x12, 0x5E, 0x64, 0x67, 0x56,
+        0x84, 0x94, 0xA4, 0x75, 0x80, 0x76, 0x6C, 0xBA, 0xB0, 0x10, 0x92, 0xD3,
+        0x57, 0xE5, 0x8F, 0xA7, 0x37, 0x28, 0xEE, 0x52, 0xBC, 0xF3, 0xB5, 0x27,
+        0xB2, 0x19, 0xC9, 0x05, 0xEB, 0x8D, 0x7A, 0xE8, 0x1C, 0xCE, 0x3D, 0x7D,
+        0x9F, 0x25, 0x48, 0x33, 0x0C, 0xA2, 0x84, 0x67, 0x53, 0x4D, 0xC5, 0x2C,
+        0x45, 0x2A, 0x07, 0x3A, 0xC4, 0xE3, 0xAD, 0xEF, 0x5F, 0x54, 0xF2, 0xF1,
+        0x89, 0xE3, 0xE8, 0x13, 0x19, 0xC7, 0x2A, 0x17, 0xE6, 0xE5, 0x90, 0x53,
+        0xF3, 0xEB, 0xFD, 0x7B, 0x96, 0x26, 0x2C, 0x4A, 0x92, 0xD8, 0x61, 0x0B,
+        0xCC, 0x9D, 0x45, 0xDB, 0x67, 0xF6, 0x5C, 0x9A, 0xEB, 0xD4, 0x54, 0x4C,
+        0x65, 0x40, 0x34, 0xB9, 0xE2, 0x2D, 0x46, 0x21, 0xCC, 0x23, 0x6D, 0xAC,
+        0xDE, 0x11, 0x53, 0x1F, 0x5A, 0x74, 0xC5, 0x36, 0x3C, 0xF0, 0x37, 0xF0,
+        0xAC, 0x4B, 0xC9, 0x51, 0x4C, 0x29, 0x78, 0x88, 0x95, 0xC2, 0xB6, 0x0A,
+        0x43, 0xAB, 0x05, 0x0C, 0x9F, 0x5D, 0x3A, 0x0E, 0x59, 0xED, 0xB4, 0x1D,
+        0xD7, 0x72, 0xFE, 0x16, 0x0F, 0xCD, 0x48, 0xC3, 0x94, 0x1E, 0xD5, 0x18,
+        0xFF, 0x55, 0x1C, 0xB8, 0xDF, 0x6A, 0x9D, 0x30, 0x2A, 0x2C, 0x1D, 0x79,
+        0xA0, 0xE1, 0x3A, 0x5E, 0x20, 0xD7, 0x06, 0xB2, 0xC2, 0x86, 0xA6, 0x7F,
+        0x5B, 0xD4, 0xFF, 0xF1, 0x13, 0xE4, 0xF9, 0xDC, 0x0A, 0x89, 0xAB, 0xB1,
+        0x06, 0xB0, 0xAD, 0x00, 0x41, 0x04, 0x1C, 0x91, 0x94, 0xE2, 0x62, 0x91,
+        0x27, 0x47, 0xA9, 0xDE, 0x8A, 0x25, 0xA9, 0xC1, 0x82, 0xC6, 0x47, 0x08,
+        0xA8, 0x40, 0x16, 0xA2, 0x9A, 0x53, 0x51, 0x8A, 0xE4, 0xB3, 0x50, 0x8E,
+        0x24, 0xEC, 0x0C, 0x0C, 0x80, 0xC2, 0x3F, 0x7A, 0x10, 0xDF, 0x31, 0xE6,
+        0xB8, 0xD0, 0x29, 0x37, 0x7D, 0x25, 0x39, 0x72, 0x1A, 0xD9, 0x97, 0x61,
+        0x5A, 0x97, 0x77, 0x1E, 0x2B, 0xCA, 0x2E, 0xDB, 0xE2, 0x44, 0x19, 0x37,
+        0x8D, 0xD4, 0x2F, 0x0D, 0xDC, 0x48, 0xA2, 0xE3, 0x2C, 0x20, 0x2A, 0x8C,
+        0x36, 0x20, 0x0E, 0x43, 0xE5, 0xA7, 0x9B, 0xA4, 0x42, 0xA1, 0x5B, 0xF1,
+        0x7D, 0x8B, 0xC0, 0xAA, 0x14, 0xE9, 0x2B, 0x18, 0x2D, 0x01, 0x51, 0x09,
+        0x16, 0x53, 0x16, 0xF8, 0xAC, 0xD6, 0x56, 0x62, 0x64, 0x50, 0x4F, 0xCA,
+        0x9B, 0xC4, 0x51, 0x3B, 0x22, 0xBC, 0xDA, 0xE3, 0xCF, 0x3A, 0x3A, 0x62,
+        0x30, 0xD1, 0x04, 0x34, 0x60, 0x7D, 0xDE, 0xEC, 0x92, 0x6A, 0x41, 0xAE,
+        0xE3, 0x58, 0x2A, 0xD3, 0xE8, 0xE8, 0x8B, 0x96, 0x23, 0x45, 0xB0, 0x12,
+        0x74, 0x7C, 0xBC, 0x04, 0xA2, 0xCA, 0x1D, 0x95, 0xD4, 0xC0, 0xAE, 0xB9,
+        0xD5, 0x28, 0x49, 0x0E, 0x85, 0xD4, 0x4F, 0x94, 0x44, 0xF4, 0x06, 0x9C,
+        0xA8, 0xD6, 0xFF, 0xD0, 0x10, 0xC4, 0x24, 0xBE, 0xEF, 0xC0, 0x48, 0xDF,
+        0x4B, 0x1E, 0x17, 0xFB, 0xE4, 0x66, 0x12, 0x85, 0x57, 0x45, 0xCD, 0x70,
+        0xC6, 0x1D, 0x0A, 0x79, 0xA8, 0x1A, 0xEE, 0xA8, 0xB9, 0xBE, 0x92, 0x27,
+        0x0D, 0xBB, 0xBA, 0xAE, 0xBA, 0x6B, 0x9C, 0x08, 0xEA, 0x7D, 0x01, 0x37,
+        0x93, 0xE4, 0xB1, 0x8C, 0xD9, 0xAC, 0x7A, 0xF9, 0xFE, 0x92, 0x8C, 0x77,
+        0x9F, 0x51, 0xC0, 0xFA, 0x21, 0x72, 0x27, 0xF5, 0xB9, 0x7D, 0xC4, 0x28,
+        0x9E, 0x1D, 0xE6, 0xA1, 0x49, 0xA3, 0x76, 0x2B, 0x5A, 0x21, 0x20, 0x30,
+        0x6A, 0x0A, 0x31, 0x38, 0x2D, 0x7C, 0x3C, 0xF8, 0xE8, 0x43, 0x7E, 0x0D,
+        0xAC, 0xF6, 0x89, 0x21, 0x70, 0x54, 0x0B, 0xD2, 0xA2, 0xD8, 0x24, 0x7C,
+        0xA9, 0x56, 0x4F, 0x73, 0xCA, 0x52, 0x20, 0x3F, 0xA2, 0x4D, 0x1F, 0xA7,
+        0xE5, 0x14, 0xE1, 0xE9, 0x5A, 0x72, 0xC6, 0xA0, 0xD6, 0x07, 0xC2, 0x02,
+        0x10, 0x55, 0x31, 0xEB, 0x08, 0x95, 0x08, 0x69, 0x56, 0x3A, 0x23, 0xDE,
+        0xA9, 0x52, 0x43, 0xCC, 0xCB, 0x5C, 0xD5, 0x43, 0x8B, 0x07, 0xC8, 0xEF,
+        0x67, 0xDC, 0xE5, 0x49, 0xDD, 0x0A, 0xF6, 0x92, 0x3E, 0x17, 0x38, 0x1C,
+        0x38, 0xC2, 0x30, 0xBE, 0x63, 0xF2, 0x45, 0x63, 0x95, 0x09, 0x52, 0x16,
+        0x6B, 0xFC, 0xD1, 0xC7, 0x1B, 0xA6, 0x8A, 0x06, 0xA4, 0xFB, 0x0B, 0x8C,
+        0x3A, 0x85, 0x4A, 0xBC, 0x01, 0x13, 0x63, 0xA7, 0x74, 0xF4, 0x3B, 0x6C,
+        0xA1, 0xF9, 0xC9, 0x88, 0x24, 0xE6, 0xDE, 0x9A, 0xEE, 0xC9, 0xF2, 0xEF,
+        0xD8, 0x07, 0x95, 0x16, 0x9A, 0x91, 0x79, 0xC7, 0x87, 0x24, 0x22, 0xC4,
+        0xC8, 0x68, 0x4A, 0x21, 0x71, 0xBA, 0xA2, 0xBA, 0x8D, 0x31, 0x60, 0x4F,
+        0xF1, 0xF0, 0xA1, 0x34, 0x36, 0xA8, 0x20, 0x33, 0x10, 0x80, 0xE0, 0x5C,
+        0x8A, 0x3D, 0x53, 0x9F, 0x2B, 0xCF, 0x03, 0xCC, 0xD2, 0xA3, 0xA6, 0xA8,
+        0xAB, 0xE4, 0x28, 0x4D, 0xB1, 0x7E, 0x07, 0xF7, 0x52, 0x56, 0xA8, 0x14,
+        0xB8, 0x46, 0x99, 0xF5, 0x24, 0x17, 0x8D, 0x36, 0x08, 0x8C, 0xEB, 0xE3,
+        0x5C, 0x11, 0xA4, 0xA3, 0xEB, 0x30, 0xEF, 0xDA, 0xA6, 0xF0, 0xCD, 0x04,
+        0x4D, 0xDB, 0x29, 0x76, 0x91, 0x58, 0x2C, 0x86, 0xED, 0xD5, 0x10, 0x5D,
+        0xB7, 0x68, 0x9A, 0x80, 0xC6, 0x6E, 0xA1, 0x7C, 0xEE, 0x8E, 0x18, 0x70,
+        0xA7, 0x6A, 0x5C, 0xA9, 0x2A, 0x71, 0x4C, 0x31, 0xAD, 0x34, 0x9B, 0x07,
+        0xDB, 0x32, 0x3A, 0x4F, 0xB3, 0xB3, 0x41, 0xB5, 0x8E, 0xC1, 0x89, 0x5F,
+        0x86, 0xA3, 0xAC, 0x4E, 0x7E, 0x53, 0xE8, 0xB1, 0x25, 0x85, 0x56, 0x28,
+        0xB6, 0x71, 0x80, 0xA5, 0x7B, 0x09, 0x7A, 0x07, 0x69, 0x0F, 0xF5, 0x0C,
+        0x1C, 0xA9, 0x27, 0x47, 0x38, 0xD6, 0x5A, 0x0F, 0xF7, 0x2B, 0xC3, 0x82,
+        0x97, 0x48, 0x9F, 0xA6, 0xB3, 0x64, 0xE5, 0xD1, 0xB9, 0x4F, 0x70, 0x34,
+        0x95, 0x45, 0x22, 0xEE, 0x35, 0xFE, 0xFC, 0x4E, 0x31, 0x41, 0xF7, 0x5A,
+        0x43, 0x7A, 0x41, 0xF7, 0xE7, 0xEF, 0xF3, 0xC7, 0xD0, 0x52, 0x4A, 0x3B,
+        0x52, 0xE1, 0x36, 0x31, 0x3B, 0x33, 0x8E, 0x32, 0xCB, 0xB2, 0x46, 0x96,
+        0x12, 0xE1, 0x2B, 0x4C, 0x81, 0x48, 0x7D, 0x16, 0x93, 0x41, 0x5A, 0xA4,
+        0x90, 0xCC, 0x3E, 0x13, 0x6A, 0x25, 0xFB, 0xC2, 0xC5, 0x96, 0xA7, 0x62,
+        0xF9, 0x2A, 0x03, 0x13, 0x1A, 0x9C, 0xA5, 0xA5, 0x16, 0x2A, 0x02, 0x17,
+        0x7F, 0xC8, 0xD4, 0x65, 0x3E, 0xA5, 0xC5, 0x17, 0x18, 0x7A, 0x29, 0x36,
+        0xD7, 0x10, 0x6E, 0xC8, 0x2C, 0xE0, 0xC4, 0x85, 0x1A, 0x4D, 0x4B, 0xB4,
+        0x30, 0x75, 0x03, 0x42, 0x0B, 0x8A, 0x98, 0xC2, 0xB6, 0x30, 0xE8, 0x72,
+        0xD8, 0x4B, 0x07, 0x78, 0xAD, 0x25, 0x72, 0x41, 0x5F, 0x21, 0xBA, 0xE3,
+        0xAF, 0x5D, 0x09, 0xBE, 0x89, 0x0E, 0xA0, 0x35, 0xC0, 0xC4, 0x11, 0xC5,
+        0xFB, 0xC6, 0xE8, 0xDC, 0xB7, 0xB3, 0x53, 0x4D, 0xB2, 0x28, 0x25, 0x31,
+        0x9A, 0xE1, 0xC5, 0x71, 0x82, 0x21, 0x7D, 0x63, 0x23, 0x1B, 0x6E, 0x17,
+        0x30, 0x62, 0x03, 0xB7, 0x3A, 0xAE, 0x7D, 0xEB, 0xAC, 0x35, 0x7D, 0x73,
+        0x8D, 0x7F, 0x82, 0x54, 0x2F, 0xAA, 0x35, 0xCF, 0x7E, 0x26, 0xA0, 0xAB,
+        0x9B, 0x9F, 0x24, 0x7A, 0x58, 0xC7, 0xFE, 0xDE, 0x11, 0x9A, 0x98, 0xFA,
+        0x3E, 0x9C, 0x58, 0x4A, 0xCE, 0x42, 0x83, 0x91, 0x1B, 0xD0, 0x50, 0x6C,
+        0x1D, 0x58, 0xA7, 0xD1, 0xDB, 0x1B, 0x41, 0x17, 0xCC, 0xF2, 0x27, 0x0C,
+        0x3C, 0x6C, 0x5F, 0x8E, 0x50, 0x58, 0x7E, 0x68, 0x02, 0x1F, 0x48, 0xC5,
+        0x2C, 0x72, 0x3B, 0x30, 0xB7, 0x99, 0xCC, 0xC0, 0x33, 0x98, 0x48, 0xEB,
+        0x4B, 0x2D, 0x8D, 0x09, 0xDE, 0xFA, 0x6A, 0x7B, 0x4B, 0x36, 0x5D, 0xE6,
+        0x11, 0x21, 0x3C, 0x5E, 0x86, 0xDC, 0x88, 0xD4, 0x1B, 0x76, 0xA3, 0xE4,
+        0xB5, 0xB3, 0x59, 0x91, 0x9F, 0x0B, 0x3B, 0x54, 0x42, 0x28, 0x11, 0x62,
+        0x7E, 0x03, 0x14, 0xEB, 0xD6, 0x02, 0x7E, 0x77, 0xA0, 0x94, 0x69, 0x09,
+        0x92, 0x01, 0xA2, 0x1D, 0xB7, 0xCB, 0x2B, 0x6F, 0x9F, 0x48, 0x15, 0x8F,
+        0x57, 0x90, 0xDA, 0x60, 0xEE, 0x95, 0x95, 0xA2, 0xBB, 0xAB, 0xE8, 0x23,
+        0xF7, 0xA3, 0x9B, 0x78, 0x74, 0xBD, 0x6B, 0xF5, 0xF7, 0xF5, 0x27, 0x5E,
+        0xCF, 0xFC, 0x18, 0x6A, 0xAB, 0x47, 0xE4, 0x47, 0xD3, 0x14, 0x75, 0x03,
+        0x95, 0xBA, 0x73, 0x72, 0x9F, 0xF2, 0x0E, 0x5B, 0x45, 0x19, 0x76, 0x04,
+        0xB8, 0x4D, 0xB5, 0x91, 0x04, 0x04, 0xA7, 0x8F, 0x66, 0x56, 0xED, 0xC3,
+        0xEC, 0x28, 0x5C, 0x9B, 0xCB, 0x65, 0xAD, 0x7F, 0xA0, 0xE5, 0x5B, 0x6B,
+        0xA4, 0x0D, 0xE9, 0x9A, 0x31, 0x32, 0x81, 0x29, 0x19, 0x94, 0x93, 0x9A,
+        0x68, 0x02, 0xDF, 0x32, 0x65, 0x55, 0x08, 0x0E, 0x4E, 0x37, 0xA6, 0x98,
+        0xEC, 0x23, 0x8A, 0x23, 0xE1, 0x5C, 0x89, 0x3D, 0x3C, 0x12, 0x49, 0x5B,
+        0xCE, 0xAC, 0x95, 0x0A, 0x6E, 0x27, 0xFE, 0xDF, 0x7B, 0xD2, 0x4A, 0xF4,
+        0x21, 0xA8, 0x14, 0x42, 0x9F, 0xD0, 0x37, 0x15, 0xD3, 0xFC, 0x99, 0x39,
+        0x45, 0x4F, 0x34, 0xD9, 0x6E, 0x4E, 0xA8, 0x1A, 0x4E, 0x41, 0x01, 0x24,
+        0x34, 0xD5, 0x34, 0x64, 0xCE, 0x4A, 0xE1, 0x0D, 0xDD, 0xB1, 0xB8, 0xE1,
+        0xB2, 0xC1, 0x5B, 0xB2, 0xF8, 0x12, 0x71, 0x32, 0xAA, 0xED, 0x76, 0xCE,
+        0xB1, 0xAF, 0xAF, 0x6D, 0x91, 0x69, 0xF1, 0xBD, 0x2B, 0x23, 0x4B, 0x65,
+        0xCF, 0x28, 0xBF, 0xA8, 0xFD, 0x8E, 0xD6, 0x7A, 0x76, 0xC0, 0xD2, 0xA1,
+        0x1C, 0x92, 0x3B, 0xB2, 0x5E, 0xD6, 0x0F, 0x78, 0x31, 0x60, 0x00, 0x97,
+        0x8F, 0x93, 0x9C, 0x80, 0xA8, 0x55, 0xED, 0xDE, 0x9C, 0x01, 0x9E, 0xB5,
+        0x63, 0x1B, 0xC1, 0x7C, 0xC9, 0x52, 0x4C, 0x8F, 0x2C, 0x9F, 0xCE, 0xD1,
+        0x67, 0x6C, 0xB4, 0x2A, 0x11, 0xAC, 0x6D, 0xCE, 0xD6, 0x16, 0xB1, 0x91,
+        0x3B, 0x02, 0x6D, 0xCF, 0x84, 0x06, 0x10, 0xC6, 0xCA, 0x9D, 0x5F, 0x2C,
+        0x20, 0xA3, 0x13, 0x3D, 0x6D, 0x48, 0x8B, 0x7C, 0x2B, 0xAA, 0x95, 0xEC,
+        0xD6, 0x18, 0x2A, 0x9E, 0x66, 0xD1, 0xC7, 0x7A, 0x97, 0x70, 0xCE, 0x39,
+        0xA0, 0x2B, 0xDC, 0x75, 0x0F, 0xF8, 0xCE, 0x79, 0x31, 0x8F, 0x9B, 0xC5,
+        0x14, 0x69, 0x97, 0x16, 0xDC, 0xD4, 0x14, 0x7D, 0x86, 0x8D, 0xF6, 0xCA,
+        0xCD, 0x0D, 0xD4, 0x30, 0xF4, 0xB0, 0xD6, 0x7B, 0x15, 0xEC, 0xCE, 0x9F,
+        0xDB, 0x74, 0x11, 0x29, 0xDC, 0x35, 0x3C, 0x57, 0x9C, 0x64, 0x84, 0x16,
+        0x47, 0xDB, 0xA5, 0x90, 0x9F, 0xF1, 0x2C, 0x03, 0x0B, 0xA7, 0xEB, 0xEC,
+        0xC2, 0x36, 0xE4, 0xC0, 0x1D, 0x6A, 0x4A, 0xDE, 0xB1, 0x20, 0x41, 0x32,
+        0x1B, 0xD2, 0x1A, 0x61, 0xEC, 0x76, 0x35, 0x31, 0xA3, 0x8C, 0xFF, 0xDE,
+        0xA0, 0x4F, 0x1A, 0xFA, 0xEC, 0xFF, 0x1F, 0x52, 0x32, 0x60, 0xBF, 0x03,
+        0x49, 0x59, 0xE0, 0x75, 0x75, 0xB0, 0x01, 0x8C, 0xCC, 0x6C, 0x14, 0xEB,
+        0x9A, 0xD8, 0x56, 0x35, 0xDD, 0xB4, 0xE6, 0x50, 0xEE, 0x1B, 0xDB, 0x6D,
+        0x20, 0xA2, 0xBC, 0x74, 0x45, 0x95, 0x3E, 0x4D, 0xD4, 0xAB, 0x61, 0x7E,
+        0xE4, 0xB8, 0x32, 0x5D, 0x70, 0x69, 0x87, 0xDE, 0x3B, 0x7D, 0x22, 0xCC,
+        0x78, 0x12, 0x0D, 0x0A, 0xAA, 0xA9, 0xDE, 0x58, 0x22, 0xB6, 0x71, 0xCF,
+        0xBF, 0xB1, 0x03, 0xAA, 0xCF, 0x94, 0x3B, 0x5D, 0xE9, 0x28, 0xA0, 0xFA,
+        0xC6, 0xBC, 0x9F, 0x7A, 0x08, 0x4D, 0x46, 0x87, 0x1A, 0x53, 0x0F, 0x93,
+        0xEC, 0x08, 0x14, 0xE9, 0x60, 0x22, 0xA5, 0xDC, 0x87, 0xE7, 0xE7, 0x7D,
+        0xA2, 0x94, 0x3B, 0x9E, 0x99, 0x09, 0xD9, 0x61, 0x11, 0xCA, 0x4C, 0xCC,
+        0x1C, 0x0C, 0x4B, 0x09, 0x8D, 0xE2, 0x16, 0xE9, 0xF2, 0x1B, 0x92, 0x12,
+        0xEB, 0xD9, 0x6F, 0x80, 0xA7, 0xFB, 0x99, 0x6E, 0x6B, 0x53, 0x98, 0x01,
+        0x57, 0xE7, 0x40, 0x6E, 0xFB, 0x38, 0xD1, 0xB6, 0x3D, 0x8C, 0x82, 0x2D,
+        0xCC, 0xCF, 0xB4, 0x3B, 0x39, 0xBA, 0x12, 0x7C, 0x19, 0x56, 0x81, 0x54,
+        0x26, 0xB9, 0x0D, 0x9B, 0x60, 0x81, 0x50, 0x28, 0x85, 0x18, 0xAA, 0x15,
+        0xFB, 0x1D, 0xCE, 0x3C, 0xDF, 0x77, 0xA1, 0x2A, 0x5B, 0x95, 0xAA, 0x4D,
+        0x91, 0x00, 0x46, 0x09, 0xE3, 0xDE, 0x04, 0xF2, 0x09, 0x80, 0xD7, 0x4D,
+        0x0D, 0x83, 0xC3, 0x8D, 0xC7, 0x6D, 0x31, 0x57, 0xC2, 0x1E, 0xCC, 0xC9,
+        0xD6, 0x06, 0x59, 0x7E, 0x96, 0x91, 0xA1, 0xA1, 0x49, 0x04, 0xA0, 0x94,
+        0x64, 0x55, 0x34, 0x6B, 0x96, 0x17, 0x9B, 0xC3, 0xF3, 0x66, 0x8B, 0xF2,
+        0xC9, 0x4A, 0xA6, 0x3B, 0x61, 0xB3, 0x85, 0x66, 0x37, 0xAA, 0xAA, 0xE5,
+        0x15, 0x1E, 0x76, 0xBA, 0x57, 0xD8, 0xB6, 0x8C, 0x99, 0xA3, 0x2C, 0x99,
+        0x95, 0x21, 0x80, 0xD3, 0xC6, 0x7F, 0x57, 0xF9, 0xC8, 0x2A, 0x75, 0xA0,
+        0xE4, 0x3A, 0x18, 0xA4, 0x5E, 0x22, 0x05, 0xB7, 0xB3, 0x42, 0xC8, 0x24,
+        0xA5, 0x7B, 0x05, 0x26, 0x18, 0x60, 0x63, 0x4E, 0xA1, 0x7D, 0x09, 0xCF,
+        0x9E, 0xA7, 0x7D, 0xE8, 0x0D, 0x8A, 0x25, 0x65, 0xFC, 0xB8, 0x79, 0x3F,
+        0x5C, 0xB4, 0xAE, 0x1D, 0x9F, 0xEA, 0x3F, 0x7C, 0x7E, 0xBF, 0xA0, 0x49,
+        0x99, 0xFF, 0x06, 0xB3, 0xCA, 0xB2, 0x3B, 0x0B, 0x0F, 0xD6, 0xCB, 0xD9,
+        0x2F, 0x10, 0xAB, 0xB2, 0x3E, 0x42, 0x54, 0xFB, 0x0E, 0x1D, 0xDB, 0xF6,
+        0xF6, 0x22, 0x91, 0xD6, 0x05, 0x6E, 0x18, 0xB7, 0x87, 0x82, 0xB9, 0xE2,
+        0x3F, 0x0E, 0xA0, 0xB2, 0x07, 0x0A, 0xC2, 0x60, 0xD3, 0x28, 0xC4, 0x47,
+        0x9A, 0xA4, 0xF2, 0x30, 0xE7, 0xA0, 0xA2, 0xEB, 0x00, 0xC3, 0xB8, 0x9D,
+        0x16, 0x9D, 0x17, 0x9F, 0x55, 0xB4, 0x96, 0x77, 0x53, 0xF4, 0xB0, 0xD4,
+        0x0A, 0xB7, 0x55, 0xC0, 0x62, 0x09, 0x2B, 0xC5, 0x09, 0xF1, 0xB6, 0xB9,
+        0x4E, 0xEA, 0x6C, 0x77, 0x56, 0x24, 0xC3, 0x71, 0x32, 0x20, 0x2A, 0x9A,
+        0x61, 0xBB, 0x94, 0x05, 0x13, 0x17, 0x9D, 0xBE, 0x9E, 0xA8, 0x94, 0x12,
+        0xFC, 0x5F, 0x2A, 0x09, 0x8E, 0x72, 0x29, 0xF7, 0xE7, 0x65, 0xBC, 0x97,
+        0x19, 0x78, 0x66, 0xA4, 0xEA, 0xF4, 0xBD, 0x97, 0xDF, 0x71, 0x5B, 0xA1,
+        0x62, 0x94, 0xCD, 0x86, 0x96, 0x9C, 0xF9, 0x3B, 0xF7, 0x0D, 0xA1, 0x38,
+        0x0F, 0xE0, 0xE7, 0x25, 0x7F, 0xD8, 0x89, 0xA2, 0x8B, 0x7F, 0xBF, 0x24,
+        0x39, 0x6D, 0x6B, 0x59, 0xD9, 0x76, 0x0A, 0x36, 0xE0, 0x92, 0x8A, 0x71,
+        0xDB, 0x14, 0x62, 0x55, 0x53, 0xC3, 0x13, 0x92, 0x02, 0xFC, 0x81, 0x5D,
+        0xAA, 0xF2, 0x75, 0xD4, 0x6B, 0xE4, 0xA0, 0x71, 0xE5, 0x76, 0x93, 0x4A,
+        0xE0, 0x0F, 0x95, 0x11, 0x42, 0x61, 0x26, 0x39, 0xA4, 0x58, 0xA5, 0x1E,
+        0xFB, 0xBC, 0x94, 0xAC, 0x8C, 0xEE, 0xF8, 0xDC, 0xFF, 0x24, 0xE7, 0xDC,
+        0x57, 0x80, 0x7A, 0x0F, 0xAA, 0x7F, 0x43, 0x54, 0xB8, 0x91, 0x2E, 0xB6,
+        0x46, 0xE4, 0x89, 0x1D, 0xBE, 0x12, 0x99, 0xA0, 0x1A, 0x89, 0x42, 0xDD,
+        0x49, 0x2A, 0xF0, 0x79, 0x3D, 0xCF, 0xA9, 0xCA, 0x17, 0x09, 0x53, 0x96,
+        0xA6, 0x5D, 0x89, 0x6D, 0x7D, 0x30, 0x63, 0xE9, 0xA6, 0xEE, 0xB1, 0x35,
+        0xC0, 0x89, 0x06, 0xD8, 0x56, 0x85, 0x2B, 0xB9, 0x19, 0x83, 0xAF, 0x8C,
+        0xF0, 0x23, 0x93, 0x51, 0x82, 0xB9, 0x55, 0x68, 0x65, 0x7E, 0xE2, 0x94,
+        0x33, 0xE2, 0x59, 0xF9, 0x6A, 0xF9, 0x50, 0xD7, 0x6F, 0x86, 0x68, 0xB6,
+        0x3E, 0xDF, 0x45, 0xBE, 0x11, 0x18, 0x3B, 0xC4, 0xFA, 0xBF, 0x09, 0x62,
+        0xDE, 0x93, 0xBA, 0x53, 0x43, 0xE5, 0xB2, 0xF3, 0x48, 0x54, 0xF9, 0x1A,
+        0xD5, 0x01, 0xE5, 0x4A, 0x4E, 0x51, 0xE8, 0xD6, 0xBF, 0x7C, 0x9C, 0xFB,
+        0x4E, 0x55, 0xE9, 0xE2, 0xE8, 0xE9, 0x6D, 0x67, 0xB3, 0x1C, 0x83, 0x37,
+        0xCD, 0xA2, 0xDB, 0x23, 0x7E, 0x79, 0x7F, 0x89, 0x02, 0xB7, 0xB3, 0x32,
+        0x76, 0xC4, 0xE2, 0x21, 0xAC, 0x5C, 0x35, 0x79, 0x99, 0xBB, 0x30, 0x52,
+        0x8E, 0x25, 0xE9, 0xED, 0x32, 0x98, 0xD7, 0x30, 0xC0, 0xBF, 0x3D, 0x5C,
+        0x5B, 0xC2, 0xBB, 0x73, 0x53, 0x95, 0xB3, 0x91, 0x17, 0x16, 0x06, 0xF2,
+        0x73, 0x0B, 0x58, 0x38, 0xD2, 0x7F, 0x5E, 0x14, 0xC0, 0xAD, 0x49, 0xD4,
+        0x8E, 0xF5, 0xB3, 0xC2, 0xB6, 0x74, 0xD8, 0x27, 0x36, 0x92, 0x95, 0x63,
+        0x74, 0x48, 0xE3, 0xA9, 0x14, 0x12, 0x2C, 0x3C, 0xE4, 0xFA, 0xB1, 0x15,
+        0xDB, 0xEE, 0x46, 0x85, 0x3A, 0xB6, 0x23, 0x1D, 0x07, 0x60, 0xF1, 0x05,
+        0x29, 0xD8, 0x8E, 0x53, 0xF3, 0xB0, 0xC4, 0xA6, 0x12, 0xD5, 0x8E, 0x9E,
+        0xD6, 0xBB, 0x04, 0xCA, 0x16, 0x11, 0x9E, 0x15, 0x0E, 0x6B, 0xB3, 0xE2,
+        0xBE, 0x08, 0xCD, 0x5A, 0x56, 0xEB, 0xF9, 0xF0, 0x3C, 0x5F, 0x67, 0x6A,
+        0x34, 0xDD, 0xA7, 0xAE, 0xD6, 0xB2, 0xCD, 0x80, 0x42, 0x38, 0xEC, 0x5A,
+        0x9B, 0x4F, 0xB9, 0x98, 0x2F, 0x2C, 0xC3, 0x54, 0x23, 0x62, 0x75, 0xA4,
+        0xF0, 0xB1, 0x75, 0xB6, 0x85, 0x76, 0x32, 0x79, 0xCB, 0x3F, 0x25, 0xFE,
+        0x93, 0x7E, 0xCE, 0xF7, 0x27, 0x15, 0x0F, 0x78, 0x2D, 0xA5, 0x7C, 0x53,
+        0x72, 0x32, 0xD7, 0x9C, 0xA2, 0x65, 0xC2, 0x08, 0xE7, 0x86, 0x88, 0x6C,
+        0x47, 0xE6, 0x7A, 0x3C, 0xD9, 0x77, 0x02, 0x00, 0xB5, 0xC6, 0xCD, 0xBD,
+        0x84, 0x37, 0x0B, 0x03, 0xD8, 0xE1, 0xA0, 0x67, 0x41, 0x16, 0xC7, 0xB1,
+        0xFC, 0x6C, 0x5A, 0xEC, 0x8E, 0xFC, 0x29, 0xA7, 0xA3, 0x6D, 0x3F, 0xF5,
+        0xE3, 0x48, 0xD8, 0x17, 0xAE, 0x0C, 0x36, 0x81, 0xD5, 0xB4, 0x92, 0x81,
+        0xE4, 0x0A, 0x68, 0x55, 0x04, 0x6E, 0x6F, 0xDA, 0x96, 0x60, 0x35, 0x30,
+        0x8E, 0x48, 0x73, 0xCC, 0x8A, 0x5A, 0x6A, 0x56, 0x41, 0x86, 0x70, 0xC7,
+        0xD3, 0xD1, 0x86, 0x14, 0x00, 0xC6, 0x42, 0x80, 0xD9, 0xD3, 0x23, 0x6F,
+        0xAB, 0x0D, 0xC4, 0x90, 0x95, 0x24, 0xE0, 0x48, 0x7E, 0x9F, 0x0D, 0xDE,
+        0xCE, 0x84, 0xD4, 0xF3, 0xF0, 0x2C, 0x53, 0x87, 0xE6, 0x2A, 0x06, 0x14,
+        0xD4, 0x24, 0xDD, 0x05, 0xE8, 0x48, 0xBB, 0x60, 0x30, 0xD7, 0x02, 0x52,
+        0xB4, 0xA6, 0x30, 0x36, 0xCE, 0x1E, 0xC9, 0x52, 0x37, 0x9E, 0xD6, 0xF2,
+        0xEF, 0x92, 0x8B, 0xC1, 0x0D, 0x7F, 0x2F, 0xEB, 0xA6, 0xCD, 0xBD, 0xD8,
+        0xF7, 0x21, 0x28, 0x49, 0x89, 0xFF, 0x3D, 0x39, 0x1A, 0x42, 0x85, 0x59,
+        0xA6, 0x12, 0xE3, 0xB1, 0x8B, 0x01, 0x52, 0xF0, 0x9C, 0x34, 0xA5, 0xF1,
+        0x7F, 0x16, 0x37, 0x7D, 0x43, 0x25, 0xA3, 0x04, 0x2F, 0x77, 0xF8, 0xD9,
+        0xCF, 0xBD, 0x0E, 0x8A, 0x9C, 0x12, 0x6A, 0xF6, 0x62, 0xE4, 0x5D, 0xF0,
+        0xBE, 0x8C, 0x03, 0xCD, 0xE8, 0x4A, 0xDB, 0x23, 0x79, 0x0A, 0x13, 0x51,
+        0x8B, 0x0A, 0x87, 0xC1, 0xA5, 0xF3, 0x60, 0x65, 0x3B, 0x4F, 0xB0, 0x54,
+        0xD2, 0x27, 0xAC, 0xCE, 0x68, 0x00, 0x42, 0x4E, 0x50, 0x23, 0x4B, 0xD3,
+        0xD6, 0x67, 0x86, 0xFC, 0x65, 0x3F, 0x25, 0x3F, 0x14, 0x95, 0xE6, 0xE1,
+        0x20, 0xD4, 0xC8, 0x29, 0x8C, 0x2E, 0xE3, 0x52, 0xB1, 0x9A, 0x26, 0x59,
+        0x9B, 0xBE, 0x92, 0xEF, 0x14, 0x0F, 0xA6, 0x52, 0xCE, 0xD7, 0x49, 0xA8,
+        0xF9, 0x2D, 0x62, 0x1A, 0x0A, 0x4A, 0xF6, 0x3E, 0xA0, 0xB0, 0xAA, 0xB8,
+        0x82, 0x58, 0xE1, 0x61, 0x95, 0xC4, 0x79, 0x79, 0x48, 0x29, 0x8B, 0x05,
+        0xD4, 0x48, 0x94, 0xB2, 0x8D, 0xE0, 0xEE, 0x1C, 0x38, 0x3D, 0x40, 0x69,
+        0x62, 0x9A, 0xA1, 0xBB, 0x82, 0x9D, 0x8D, 0xCA, 0x80, 0x0F, 0x55, 0xCA,
+        0x8B, 0xCF, 0x7C, 0xA4, 0x94, 0xBB, 0xB4, 0x79, 0x44, 0x97, 0xDD, 0x90,
+        0xB6, 0xC4, 0x9E, 0xFB, 0x2F, 0x07, 0xDC, 0x5A, 0x8D, 0xA5, 0x50, 0x16,
+        0x65, 0x93, 0x26, 0x31, 0x7D, 0x5A, 0x8A, 0x52, 0xFF, 0xF6, 0x10, 0xA1,
+        0x8D, 0xFE, 0x11, 0x6F, 0x0F, 0x66, 0x8A, 0xE1, 0xAE, 0xF9, 0xB0, 0xAB,
+        0x80, 0xDE, 0x25, 0x7D, 0x06, 0x45, 0xD8, 0xA7, 0xF8, 0x7C, 0x26, 0x5A,
+        0x9C, 0xD2, 0x61, 0xA9, 0x16, 0x95, 0x6A, 0x6E, 0xBE, 0x8F, 0x7E, 0x36,
+        0xAF, 0x1D, 0x2A, 0x63, 0xBA, 0x14, 0x6E, 0x8A, 0xF6, 0x0E, 0xF8, 0x12,
+        0xE1, 0x38, 0xD0, 0x08, 0x10, 0x49, 0x4D, 0x9F, 0x7A, 0x0F, 0x01, 0x77,
+        0x0D, 0x8A, 0x67, 0x7D, 0xDE, 0xA6, 0xD7, 0xCA, 0x34, 0x45, 0x10, 0x54,
+        0x72, 0x6D, 0x40, 0xF8, 0xB0, 0xEF, 0x84, 0xFE, 0x48, 0xE3, 0x44, 0xE7,
+        0x72, 0x3C, 0x47, 0x76, 0xB7, 0x76, 0xF3, 0xB6, 0x02, 0x42, 0x64, 0x64,
+        0xD6, 0xE6, 0x04, 0x5F, 0x7A, 0x98, 0x75, 0x89, 0x05, 0x50, 0xA5, 0xB2,
+        0x8C, 0x3D, 0xD9, 0x3E, 0x67, 0x49, 0xAE, 0x5C, 0xA4, 0xB9, 0x6A, 0x7B,
+        0xEB, 0xF3, 0x16, 0x96, 0xB1, 0x38, 0x72, 0x66, 0xC4, 0xFD, 0xA6, 0x53,
+        0x49, 0x8E, 0xA4, 0xB2, 0x9C, 0x27, 0x2C, 0x37, 0xCD, 0x5D, 0x5C, 0x99,
+        0x91, 0x34, 0x34, 0xA6, 0x06, 0x7F, 0xAD, 0x58, 0xEE, 0x2B, 0xAD, 0xEE,
+        0x39, 0x68, 0xC4, 0x0B, 0xDC, 0xCA, 0xF8, 0x8E, 0x15, 0x3A, 0x7D, 0x1E,
+        0x33, 0xBC, 0xE8, 0xBB, 0x16, 0xBA, 0x34, 0xC2, 0x55, 0x5B, 0x3F, 0x2B,
+        0xD3, 0xF8, 0x63, 0xCF, 0x74, 0xF6, 0x17, 0xB1, 0xB0, 0xA5, 0xE8, 0xA9,
+        0xD8, 0xC8, 0x28, 0xA4, 0xC8, 0xB6, 0xA2, 0x66, 0xDC, 0x42, 0xE4, 0xB0,
+        0xF5, 0x4B, 0xDF, 0x37, 0xAC, 0x39, 0x58, 0x7D, 0x83, 0x17, 0xB4, 0xB5,
+        0xFE, 0x33, 0xC9, 0x97, 0xA9, 0xF6, 0xD0, 0x89, 0x0D, 0x1E, 0xEA, 0x09,
+        0x81, 0x19, 0xDB, 0x3D, 0x58, 0xA8, 0xB8, 0x57, 0xC8, 0x3E, 0x9F, 0xD4,
+        0x0F, 0x60, 0x9D, 0x11, 0x91, 0xC7, 0xE7, 0x41, 0x97, 0x6E, 0x01, 0x85,
+        0xF0, 0xC2, 0xE6, 0xDD, 0x66, 0xEB, 0x4B, 0xC6, 0x14, 0x5C, 0x23, 0xC6,
+        0x01, 0x5B, 0x33, 0x19, 0x8C, 0x55, 0x7C, 0x6F, 0x76, 0x0C, 0x32, 0x86,
+        0x2B, 0x18, 0x42, 0xB4, 0x94, 0x39, 0x62, 0x9B, 0xB5, 0x44, 0x7E, 0x1F,
+        0x9B, 0xE2, 0x28, 0xC0, 0x0F, 0x29, 0x7F, 0x42, 0xAB, 0x1E, 0xFD, 0x1D,
+        0xC4, 0x31, 0xD5, 0xA3, 0xC6, 0x55, 0x7B, 0xFB, 0x0C, 0x3E, 0xA5, 0xC4,
+        0xC3, 0x1B, 0x77, 0x51, 0x55, 0xF6, 0x51, 0x73, 0xCA, 0xA7, 0xBC, 0x33,
+        0x5B, 0xE6, 0x83, 0x40, 0xB5, 0x16, 0x3A, 0x75, 0x44, 0x23, 0x0E, 0x54,
+        0x6A, 0x67, 0x20, 0x54, 0x82, 0x27, 0x1A, 0xE4, 0xF1, 0x9C, 0x5B, 0x1E,
+        0x90, 0xA5, 0x94, 0x06, 0x4A, 0x40, 0x95, 0x66, 0xE3, 0xFA, 0xC8, 0x73,
+        0x78, 0xE2, 0xF6, 0x35, 0x4A, 0x8B, 0xAA, 0x16, 0x67, 0xE6, 0x88, 0x30,
+        0xA7, 0x27, 0xD9, 0xE9, 0x9D, 0x67, 0x9A, 0xF4, 0x27, 0x78, 0xC1, 0x58,
+        0xA2, 0x54, 0x6F, 0xD4, 0xCF, 0xD5, 0x8D, 0x78, 0xCD, 0x09, 0xEE, 0xF8,
+        0xC5, 0xF1, 0x63, 0x59, 0xAE, 0xDD, 0x8C, 0x17, 0xDD, 0xBF, 0xB2, 0xB6,
+        0x43, 0xB6, 0x9F, 0x71, 0x66, 0x3F, 0xDB, 0x48, 0xB7, 0x3C, 0x1F, 0x8D,
+        0x90, 0x03, 0xAF, 0xA8, 0x1C, 0x98, 0xB5, 0xBC, 0x09, 0xE3, 0xFC, 0x86,
+        0x59, 0x01, 0xF0, 0x23, 0x12, 0xE2, 0x11, 0x1E, 0x9C, 0xE7, 0xF9, 0xB8,
+        0xF6, 0x3E, 0x2A, 0xCF, 0x86, 0x50, 0x5C, 0x9C, 0x7B, 0xC7, 0xED, 0x8E,
+        0x5B, 0xF2, 0xC0, 0x65, 0x37, 0x1D, 0x31, 0xB0, 0xAC, 0x3D, 0x73, 0x50,
+        0xEE, 0xB1, 0xB9, 0x85, 0x95, 0xD1, 0xEB, 0x67, 0xB3, 0xC8, 0xCE, 0x7C,
+        0x2E, 0xFC, 0x97, 0x5D, 0xF0, 0x51, 0x74, 0xFE, 0x03, 0x66, 0x9F, 0x64,
+        0xEA, 0xAD, 0xF8, 0xA2, 0xCE, 0xD4, 0xEC, 0xA3, 0x0D, 0xFD, 0xD8, 0xFF,
+        0xFC, 0x79, 0x9F, 0xCB, 0xBA, 0xB2, 0x63, 0x57, 0x15, 0xE2, 0x6D, 0xD9,
+        0xEC, 0xBE, 0x7A, 0x9A, 0x59, 0xCC, 0x97, 0xF6, 0xB6, 0x28, 0x7F, 0x16,
+        0x1D, 0x24, 0xD6, 0x35, 0xED, 0x71, 0x7D, 0x68, 0x0C, 0x71, 0x7D, 0xCA,
+        0xAC, 0x1C, 0xED, 0xD9, 0xB5, 0xCD, 0xCD, 0x69, 0x6D, 0xEE, 0xEB, 0xEA,
+        0x01, 0x54, 0x89, 0x73, 0x14, 0x9E, 0xF6, 0x2F, 0x1C, 0x00, 0xEB, 0x84,
+        0x6F, 0x9F, 0x4F, 0xAB, 0x7F, 0xC3, 0x02, 0xF0, 0x70, 0x52, 0xBD, 0x7F,
+        0xAD, 0xCB, 0x83, 0xEF, 0xFD, 0x45, 0x44, 0x62, 0x82, 0xBF, 0xE4, 0x45,
+        0x9D, 0x3D, 0xE9, 0xFB, 0x99, 0x85, 0x5F, 0x7F, 0x4B, 0xD4, 0xC4, 0xCC,
+        0x9F, 0xB6, 0xB0, 0x0A, 0xFF, 0x6B, 0x7C, 0x7D, 0x01, 0x46, 0x0E, 0x56,
+        0xC5, 0xF0, 0xE0, 0xC3, 0x07, 0xAE, 0x1F, 0x17, 0xDC, 0xDF, 0x33, 0x60,
+        0xBF, 0xE3, 0xCD, 0xB3, 0xD7, 0xE6, 0xAF, 0xBD, 0xF6, 0x56, 0x67, 0xEF,
+        0xC6, 0x71, 0xB8, 0xF7, 0xED, 0x06, 0x30, 0x3D, 0xF6, 0xF9, 0x64, 0x09,
+        0x7E, 0x1A, 0x09, 0xF2, 0x7A, 0x53, 0xCF, 0xD1, 0xEC, 0xE7, 0xB7, 0x6A,
+        0xD7, 0xB9, 0x40, 0xD4, 0x63, 0x5C, 0x4F, 0xB5, 0x07, 0x39, 0xEE, 0xDD,
+        0x26, 0x1E, 0x4B, 0x0C, 0x37, 0xC2, 0x5D, 0xD7, 0xB9, 0xE5, 0x8F, 0x4B,
+        0x25, 0x4D, 0x07, 0xAF, 0xD8, 0x3A, 0x3E, 0xC8, 0x50, 0x6C, 0xAB, 0xDF,
+        0xE7, 0x6A, 0x3C, 0x97, 0xAF, 0x7C, 0xCE, 0xAF, 0xF8, 0xF9, 0x06, 0xF5,
+        0xC6, 0xAF, 0x95, 0xE7, 0xF8, 0xCA, 0x9F, 0xB3, 0xEC, 0x34, 0x58, 0x74,
+        0x9D, 0xEE, 0x55, 0x57, 0xF1, 0xE9, 0xA8, 0x58, 0xC9, 0x33, 0x28, 0xED,
+        0x6C, 0x37, 0x2B, 0x52, 0xB9, 0x47, 0x73, 0xC2, 0x87, 0x77, 0x1D, 0xD8,
+        0xC8, 0x29, 0x25, 0xAF, 0xC5, 0xEE, 0x27, 0xC7, 0xB5, 0xD7, 0x3B, 0x42,
+        0x47, 0x64, 0x06, 0x9D, 0x42, 0x7F, 0x56, 0x11, 0xA4, 0x02, 0x2F, 0xCE,
+        0xBD, 0xF5, 0x2C, 0x6E, 0x50, 0xD6, 0xCF, 0x83, 0x14, 0x9F, 0x08, 0xDE,
+        0x52, 0x6E, 0xA1, 0xCF, 0x2D, 0x63, 0xEB, 0x04, 0x69, 0x07, 0x19, 0xF6,
+        0x83, 0xC9, 0xC9, 0xA2, 0x6A, 0xFB, 0x46, 0x2B, 0xCA, 0xBC, 0xAC, 0xF4,
+        0xF7, 0x5D, 0x88, 0xC5, 0xF7, 0x54, 0xA2, 0x4A, 0xCD, 0x5A, 0xB9, 0x25,
+        0xA5, 0xE5, 0xEB, 0xD3, 0x88, 0x74, 0x6E, 0x69, 0x23, 0x5C, 0x7F, 0x40,
+        0x58, 0x6B, 0xAD, 0x4E, 0x02, 0xA6, 0xB5, 0x5E, 0x5C, 0x16, 0xED, 0xFF,
+        0x54, 0xCF, 0x05, 0xB5, 0x1B, 0x0B, 0x25, 0x65, 0x21, 0x1D, 0x23, 0x98,
+        0x75, 0x7A, 0xDE, 0xAF, 0xBE, 0x0B, 0xB4, 0x3A, 0x77, 0x7D, 0xC0, 0x3F,
+        0x45, 0x97, 0x20, 0xDF, 0xED, 0x9F, 0x6B, 0x87, 0x8C, 0xBD, 0x3B, 0x9E,
+        0x64, 0x40, 0x5F, 0xED, 0xE7, 0xF0, 0x7B, 0x01, 0x46, 0x27, 0x56, 0x47,
+        0xE4, 0xE7, 0x02, 0xD3, 0xB9, 0xC0, 0x89, 0x37, 0xB7, 0x40, 0xAA, 0xAC,
+        0x57, 0xAC, 0xD9, 0x0A, 0xFE, 0x89, 0x36, 0x08, 0xF3, 0x23, 0x55, 0x4A,
+        0xD4, 0x62, 0x76, 0xE1, 0x4C, 0xFC, 0x8D, 0x4A, 0x59, 0xC2, 0xF2, 0x5F,
+        0xB1, 0x91, 0x4D, 0xC2, 0xF7, 0xC1, 0x64, 0x66, 0xF5, 0xE2, 0x97, 0x22,
+        0xD2, 0x9C, 0xAC, 0xD5, 0x33, 0x53, 0xF7, 0xF2, 0x0B, 0x37, 0xB0, 0xFC,
+        0x99, 0x37, 0x2C, 0x27, 0xC5, 0x5F, 0xD9, 0xA3, 0xDA, 0xDA, 0xC6, 0xF1,
+        0xFE, 0xF5, 0x1F, 0xE0, 0x75, 0x13, 0xE3, 0xED, 0xB0, 0x60, 0xFC, 0xD7,
+        0x12, 0x34, 0xE4, 0x84, 0xFF, 0x0D, 0xF0, 0x28, 0xCC, 0xDD, 0x54, 0x8A,
+        0x82, 0xB4, 0x37, 0xBF, 0x68, 0xC5, 0xAB, 0x70, 0xBD, 0x55, 0x0B, 0x25,
+        0x91, 0x2C, 0x53, 0x54, 0x2C, 0xBA, 0xE0, 0x8B, 0x4A, 0x79, 0x2A, 0x9C,
+        0xED, 0x81, 0x43, 0x48, 0xB6, 0x63, 0xE6, 0xAF, 0x7E, 0x46, 0xB8, 0xE3,
+        0x53, 0x56, 0x84, 0xE0, 0xB9, 0xFD, 0xB7, 0xAF, 0xD7, 0x4F, 0x9A, 0xEE,
+        0x96, 0x02, 0xD7, 0x41, 0xFF, 0x78, 0x24, 0xC3, 0x02, 0x09, 0x5D, 0x9B,
+        0x4E, 0x07, 0x0B, 0x06, 0x6C, 0x57, 0x84, 0x75, 0x37, 0x32, 0x7E, 0x9E,
+        0x3C, 0xB3, 0x0C, 0x65, 0x98, 0xBD, 0xDF, 0xB8, 0xF9, 0x88, 0x69, 0x74,
+        0xBA, 0xDA, 0x63, 0x5E, 0x25, 0xB9, 0xCE, 0x44, 0x10, 0xC9, 0xC5, 0x74,
+        0xE0, 0x1D, 0xB5, 0x89, 0xD9, 0x91, 0x30, 0xC5, 0x7F, 0xBE, 0x37, 0xBA,
+        0xBB, 0x13, 0xE8, 0xE5, 0xB5, 0xBE, 0xA3, 0x99, 0x18, 0x0E, 0xE1, 0xE2,
+        0x27, 0xFC, 0xC5, 0x91, 0x89, 0x3E, 0x23, 0xFD, 0x58, 0x01, 0x53, 0x1D,
+        0x46, 0xE9, 0x14, 0xD2, 0xD3, 0x42, 0xAD, 0xF1, 0xB7, 0xB5, 0x40, 0xF5,
+        0x79, 0xA6, 0xF5, 0x75, 0x8F, 0x37, 0x37, 0xC9, 0x4B, 0x79, 0xDB, 0xDA,
+        0x0D, 0xDF, 0x65, 0x6B, 0xFB, 0x42, 0x91, 0x9E, 0xF4, 0x63, 0xB1, 0x97,
+        0x55, 0x9C, 0x56, 0x7D, 0xB1, 0x21, 0x5C, 0xA5, 0x78, 0xE0, 0x6D, 0x85,
+        0xF8, 0xF9, 0x20, 0xC6, 0xF4, 0x93, 0x71, 0x7B, 0x27, 0xC9, 0x66, 0x7D,
+        0x2B, 0x8B, 0xFC, 0x52, 0x42, 0x61, 0xA6, 0xE5, 0xF2, 0x0E, 0x99, 0xA6,
+        0x72, 0x26, 0x9C, 0x47, 0x61, 0xB8, 0xB4, 0x11, 0x2C, 0xE5, 0xC4, 0xF3,
+        0xE9, 0xF5, 0x89, 0x25, 0xC9, 0x39, 0xAC, 0x90, 0xAE, 0x40, 0x84, 0x36,
+        0x44, 0x52, 0x2E, 0x3F, 0x8A, 0x2C, 0xC2, 0x67, 0x98, 0x81, 0x7A, 0x66,
+        0xE3, 0xC0, 0xC2, 0x6C, 0x3F, 0x41, 0xF6, 0xDC, 0xE4, 0x71, 0x24, 0xFC,
+        0xAE, 0x6E, 0x7A, 0x9A, 0x9E, 0x49, 0xD0, 0x67, 0x14, 0xB9, 0x9E, 0x5B,
+        0x1B, 0x9B, 0x22, 0x75, 0xD7, 0x65, 0xE9, 0xF1, 0xCA, 0x85, 0x1D, 0x04,
+        0x9F, 0x57, 0xF6, 0xBD, 0x2C, 0xE6, 0x2C, 0x75, 0xDC, 0x94, 0x52, 0x4D,
+        0x55, 0xCE, 0xF3, 0xCC, 0xE2, 0xA5, 0xD2, 0x4E, 0xBA, 0xA4, 0xD3, 0x12,
+        0x6E, 0x4B, 0xF3, 0xC2, 0x7F, 0x48, 0x37, 0xBF, 0x52, 0xB3, 0x62, 0x55,
+        0xC6, 0x6D, 0x1A, 0xD1, 0x60, 0x69, 0xCF, 0xFB, 0xCA, 0x71, 0xBB, 0x7B,
+        0xE8, 0x51, 0x0B, 0x64, 0x74, 0x00, 0x29, 0xCF, 0xB6, 0x94, 0x6B, 0x5E,
+        0x69, 0xB7, 0xEC, 0x4F, 0x60, 0x52, 0x7C, 0x7A, 0x7E, 0x60, 0x67, 0x9D,
+        0xE4, 0xBB, 0x06, 0x59, 0x62, 0xDC, 0x5B, 0xF2, 0x04, 0x64, 0x67, 0x0E,
+        0x98, 0x7C, 0x8B, 0x32, 0x83, 0x8F, 0xFC, 0x4D, 0x49, 0x3A, 0xF5, 0x9A,
+        0x64, 0x16, 0x7D, 0x46, 0x7D, 0x4B, 0x01, 0x44, 0xA8, 0x83, 0xE1, 0xFF,
+        0x2F, 0x14, 0x90, 0xE2, 0xD2, 0xA9, 0x27, 0x75, 0x00, 0x03, 0xA5, 0x2F,
+        0x87, 0x24, 0xDC, 0x41, 0x2B, 0x29, 0x85, 0x6E, 0x88, 0x71, 0x5A, 0x5C,
+        0x7C, 0x07, 0xDF, 0x75, 0x09, 0x1F, 0xF6, 0xE9, 0xD9, 0xC4, 0xC1, 0x7A,
+        0x4C, 0x79, 0x39, 0x73, 0x66, 0x33, 0xC0, 0x5F, 0xBE, 0x7B, 0x4A, 0x75,
+        0xC1, 0x37, 0xEA, 0x52, 0xF2, 0x03, 0xF4, 0x31, 0xD7, 0xE2, 0x21, 0x43,
+        0x74, 0x36, 0x97, 0xA2, 0x62, 0x1A, 0x91, 0x9F, 0x23, 0x48, 0xBC, 0x66,
+        0x74, 0x4D, 0xBE, 0x24, 0x94, 0xF2, 0xE0, 0xCA, 0x1C, 0x7B, 0xF7, 0xC8,
+        0x40, 0xB9, 0x9B, 0x3B, 0x0B, 0xAA, 0x83, 0x74, 0x2C, 0x3A, 0x6B, 0x69,
+        0x72, 0xBA, 0x62, 0xDE, 0x5B, 0xED, 0x59, 0xF1, 0x70, 0x8C, 0xB2, 0xEB,
+        0x57, 0xD7, 0x62, 0xBD, 0x93, 0x39, 0xF4, 0xF9, 0x5F, 0xB9, 0x28, 0xB7,
+        0x13, 0x38, 0xB0, 0xBF, 0xAB, 0xE6, 0xA2, 0x79, 0x44, 0x9D, 0xB5, 0x9A,
+        0x7F, 0x56, 0xBC, 0xF1, 0xF8, 0xD6, 0x67, 0xC8, 0xBF, 0x72, 0xD9, 0x51,
+        0x0B, 0x3D, 0x1F, 0x93, 0x1A, 0x34, 0x7F, 0xAE, 0xC2, 0x89, 0x1F, 0x9D,
+        0xC9, 0x87, 0x2C, 0x41, 0xFD, 0xC9, 0xBF, 0x89, 0x85, 0xDF, 0x1A, 0xC5,
+        0xC7, 0xCD, 0xAF, 0xF2, 0x35, 0x37, 0x7E, 0x76, 0x9E, 0x6C, 0xA9, 0x68,
+        0xF9, 0xF3, 0x27, 0x58, 0x78, 0x35, 0xA4, 0xD7, 0xD5, 0xAE, 0x78, 0x66,
+        0xB6, 0x14, 0x67, 0x9C, 0xCF, 0xFF, 0x28, 0xCF, 0x49, 0x1A, 0x4E, 0xAB,
+        0x8C, 0xA4, 0x1F, 0xEE, 0x9B, 0x00, 0x5E, 0x40, 0x5B, 0xFC, 0x09, 0x39,
+        0x65, 0x61, 0x93, 0x2E, 0x09, 0x2F, 0x85, 0xDF, 0xA6, 0xA7, 0x61, 0x28,
+        0xC1, 0x7F, 0x78, 0x72, 0xA4, 0xF4, 0x70, 0x12, 0xA5, 0x32, 0xC9, 0x9C,
+        0xD2, 0x93, 0xDA, 0x86, 0xB4, 0x87, 0x17, 0x97, 0x0C, 0x57, 0x25, 0x4C,
+        0x63, 0x74, 0xB5, 0x4A, 0x5A, 0x19, 0x0F, 0xDD, 0x94, 0x97, 0xA4, 0xBA,
+        0x2B, 0xF8, 0xAD, 0x6C, 0x25, 0x1A, 0x4F, 0x8B, 0x5C, 0xB0, 0xF1, 0xD9,
+        0xDB, 0xE4, 0xA0, 0xA2, 0xF6, 0x9F, 0x1B, 0xE0, 0x5B, 0xC2, 0x0A, 0x40,
+        0xC7, 0xB4, 0x3B, 0x75, 0xEE, 0xD9, 0xF3, 0x35, 0x3D, 0xE9, 0xB0, 0xC3,
+        0x5B, 0xE2, 0x6A, 0x91, 0x78, 0x7F, 0x94, 0x4B, 0xC8, 0x9C, 0xA4, 0xB5,
+        0xE3, 0xB8, 0x29, 0xD7, 0xEB, 0x05, 0xFA, 0xDF, 0xCA, 0xEA, 0x76, 0xB9,
+        0xEF, 0xA2, 0x7B, 0x14, 0x31, 0x27, 0xCF, 0x7B, 0xDA, 0xB3, 0x58, 0xC9,
+        0x2A, 0xDA, 0xEA, 0x52, 0xF6, 0x3C, 0xEF, 0xB4, 0x3B, 0xC1, 0xE1, 0x55,
+        0x32, 0x02, 0xC3, 0xBA, 0x94, 0xFC, 0xF7, 0x1F, 0x4A, 0x64, 0xE9, 0xC0,
+        0xE2, 0xF7, 0xF2, 0x77, 0xF7, 0x39, 0x8B, 0x04, 0x91, 0xDF, 0x9E, 0xA5,
+        0x6F, 0x27, 0x15, 0xD9, 0x6F, 0x8E, 0x70, 0x31, 0x41, 0x2B, 0x63, 0x04,
+        0xCB, 0x00, 0x73, 0x04, 0x4D, 0xC9, 0xE6, 0x73, 0x04, 0x53, 0x4B, 0xF9,
+        0xBC, 0x8A, 0x7B, 0x74, 0x0D, 0xF6, 0x79, 0x83, 0x4E, 0xCE, 0x99, 0xF9,
+        0xDF, 0xD8, 0xCB, 0x84, 0x32, 0x00, 0xBC, 0x56, 0x90, 0x43, 0x1C, 0xE5,
+        0xD6, 0x04, 0x6C, 0xA5, 0xDE, 0x99, 0x4B, 0x70, 0xED, 0x3D, 0xB1, 0xA7,
+        0x69, 0x7B, 0xFA, 0x48, 0x6A, 0xA5, 0xF5, 0xEC, 0x39, 0x8F, 0x5E, 0xFB,
+        0x9F, 0x0B, 0xFB, 0xDA, 0xFE, 0x2E, 0x08, 0x2E, 0xFD, 0x0D, 0xC7, 0xB6,
+        0xBB, 0x29, 0xD9, 0xA3, 0x28, 0x29, 0xBE, 0x63, 0xD0, 0xF2, 0x87, 0xFA,
+        0x4C, 0x93, 0x9C, 0xFE, 0x07, 0x51, 0x43, 0x29, 0x7C, 0x7C, 0xB5, 0xC0,
+        0x92, 0x05, 0xF6, 0xBE, 0xC3, 0x93, 0xC9, 0x04
+};
@@ -6,7 +6,12 @@ struct GHclient {
     GHclient() {}
     GHclient(gyverhub::ConnectionType nfrom, const char* nid) {
         from = nfrom;
-        if (strlen(nid) <= 8) strcpy(id, nid);
+        // после ':' идут опции клиента (discover)
+        size_t len = strcspn(nid, ":");
+        if (len <= 8) {
+            memcpy(id, nid, len);
+            id[len] = '\0';
+        }
     }
 
     // тип соединения
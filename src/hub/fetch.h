@@ -2,6 +2,11 @@
 #include "macro.hpp"
 #include "utils/json.h"
 #include "utils/base64.h"
+#include "hub/source.h"
+#include "hub/gzip.h"
+
+// байт данных в чанке: кратно 3, чтобы base64 чанков склеивался без паддинга в середине
+#define GHI_FETCH_CHUNK (GHC_FETCH_CHUNK_SIZE / 3 * 3)
 
 namespace gyverhub {
     class FetchBuilder;
@@ -13,8 +18,12 @@ namespace gyverhub {
         uint32_t file_b_size, file_b_idx;
         bool file_b_pgm = 0;
         File file_d;
+        FetchSource* file_s = nullptr;
         String fetch_path;
-        FetchCallback fetch_cb;
+        FetchCallback fetch_cb = nullptr;
+#if GHC_GZIP_WINDOW
+        Gzip zip;
+#endif
         uint16_t dwn_chunk_count = 0;
         uint16_t dwn_chunk_amount = 0;
 
@@ -42,8 +51,18 @@ namespace gyverhub {
             file_b_pgm = true;
         }
 
+        // отправить данные источника (вызывать в обработчике onFetch)
+        void fetchSource(FetchSource* source) {
+            file_s = source;
+        }
+
         bool isActive() {
-            return file_d || file_b;
+            return file_d || file_b || file_s;
+        }
+
+        // все чанки отправлены
+        bool isDone() {
+            return dwn_chunk_count >= dwn_chunk_amount;
         }
 
         void setCallback(FetchCallback callback) {
@@ -53,43 +72,76 @@ namespace gyverhub {
         void close() {
             if (fetch_cb) fetch_cb(this, false);
             if (file_d) file_d.close();
+            if (file_s) file_s->close();
             file_b = nullptr;
+            file_s = nullptr;
             fetch_path.clear();
         }
 
-        bool open(const char *name) {
+        // gzip - клиент умеет распаковывать, текстовый файл с ФС отдаётся сжатым
+        bool open(const char *name, bool gzip = false) {
             fetch_path = name;
             file_b_idx = 0;
 
             if (fetch_cb) fetch_cb(this, true);
-            if (!isActive()) file_d = GHI_FS.open(name, "r");
-            if (!isActive()) return false;
+            if (!isActive()) {
+                file_d = GHI_FS.open(name, "r");
+#if GHC_GZIP_WINDOW
+                // размер сжатого нужен заранее (число чанков) - большой файл не сжимаем,
+                // чтобы холостой проход не держал loop. Несжимаемое - как есть
+                if (gzip && file_d && file_d.size() <= GHC_GZIP_FETCH_MAX && Gzip::worth(name, file_d.size()) && zip.begin(file_d)) {
+                    if (zip.size() < file_d.size()) {
+                        file_d = File();
+                        file_s = &zip;
+                    } else {
+                        zip.close();
+                        file_d = GHI_FS.open(name, "r");
+                    }
+                }
+#endif
+            }
+            return _start();
+        }
 
-            dwn_chunk_count = 0;
-            dwn_chunk_amount = ((file_b ? file_b_size : file_d.size()) + GHC_FETCH_CHUNK_SIZE - 1) / GHC_FETCH_CHUNK_SIZE;  // round up
-            return true;
+        // данные идут в gzip
+        bool isGzip() {
+#if GHC_GZIP_WINDOW
+            return file_s == &zip;
+#else
+            return false;
+#endif
+        }
+
+        // отправить источник без обработчика onFetch (ответ на query)
+        bool open(FetchSource* source) {
+            fetch_path.clear();
+            file_b_idx = 0;
+            file_s = source;
+            return _start();
         }
 
         void nextChunk(Json &answ) {
             answ.itemString(F("type"), F("fetch_next_chunk"));
             answ.itemInteger(F("chunk"), dwn_chunk_count);
             answ.itemInteger(F("amount"), dwn_chunk_amount);
-
             dwn_chunk_count++;
-            if (dwn_chunk_count < dwn_chunk_amount)
-                return;
-            
+
             answ += F("\"data\":\"");
             if (file_b) {
-                size_t len = min((size_t) file_b_size, (size_t) GHC_FETCH_CHUNK_SIZE);
+                size_t len = min((size_t) (file_b_size - file_b_idx), (size_t) GHI_FETCH_CHUNK);
                 size_t out_len;
                 char *b64 = gyverhub::base64Encode(file_b + file_b_idx, len, file_b_pgm, out_len);
+                file_b_idx += len;
                 answ.concat(b64, out_len);
                 free(b64);
             } else {
-                size_t len = min((size_t) file_d.available(), (size_t) GHC_FETCH_CHUNK_SIZE);
+                size_t len = file_s ? (file_b_size - file_b_idx) : file_d.available();
+                len = min(len, (size_t) GHI_FETCH_CHUNK);
                 uint8_t *data = (uint8_t *)malloc(len);
-                len = file_d.read(data, len);
+                if (!data) len = 0;
+                else if (file_s) len = file_s->read(data, len);
+                else len = file_d.read(data, len);
+                file_b_idx += len;
 
                 if (len) {
                     size_t out_len;
@@ -104,6 +156,18 @@ namespace gyverhub {
             answ += '\"';
         }
 
+    private:
+        bool _start() {
+            if (!isActive()) return false;
+            if (file_s) file_b_size = file_s->size();
+
+            dwn_chunk_count = 0;
+            dwn_chunk_amount = ((file_b || file_s ? file_b_size : file_d.size()) + GHI_FETCH_CHUNK - 1) / GHI_FETCH_CHUNK;  // round up
+            if (!dwn_chunk_amount) dwn_chunk_amount = 1;
+            return true;
+        }
+
+    public:
         void getData(File** file, const uint8_t** bytes, uint32_t* size, bool* pgm) {
             *file = &file_d;
             *bytes = file_b;
@@ -1,83 +1,369 @@
 #include "fs.h"
 
-void GH_showFiles(gyverhub::Json& answ, uint16_t* count, const String& path, GHI_UNUSED uint8_t levels) {
 #if GHC_FS != GHC_FS_NONE
-#ifdef ESP8266
+
+gyverhub::FsIndex& gyverhub::fsIndex() {
+    static FsIndex index;
+    return index;
+}
+
+void gyverhub::FsIndex::build() {
+    clear();
+    ready = true;
+    _scan("/", GHC_FS_MAX_DEPTH);
+}
+
+void gyverhub::FsIndex::clear() {
+    free(buf);
+    buf = nullptr;
+    len = cap = 0;
+    entries = 0;
+    ready = false;
+}
+
+void gyverhub::FsIndex::update(const char* path) {
+    if (!ready) return;
+    String p(path);
+    if (p.length() > 1 && p[p.length() - 1] == '/') p.remove(p.length() - 1);
+    if (!p.length() || p == "/") {
+        build();
+        return;
+    }
+
+    String dir(p);
+    dir += '/';
+    _erase(p.c_str(), p.length(), false);
+    _erase(dir.c_str(), dir.length(), true);
+
+    if (GHI_FS.exists(p.c_str())) {
+        File f = GHI_FS.open(p.c_str(), "r");
+        if (f && f.isDirectory()) {
+            f.close();
+            _set(dir.c_str(), dir.length(), 0);
+            _scan(dir, GHC_FS_MAX_DEPTH);
+        } else if (f) {
+            _set(p.c_str(), p.length(), f.size());
+        }
+    }
+    _parents(p.c_str(), p.length(), true);
+}
+
+void gyverhub::FsIndex::touch(const char* path, uint32_t size) {
+    if (!ready) return;
+    size_t plen = strlen(path);
+    _set(path, plen, size);
+    _parents(path, plen, false);
+}
+
+#ifdef ESP32
+#define GHI_FS_LOCK() portENTER_CRITICAL(&lock)
+#define GHI_FS_UNLOCK() portEXIT_CRITICAL(&lock)
+#else
+#define GHI_FS_LOCK()
+#define GHI_FS_UNLOCK()
+#endif
+
+void gyverhub::FsIndex::post(const char* path) {
+    // память берётся вне блокировки, под ней только указатели
+    size_t plen = strlen(path);
+    Pending* p = (Pending*)malloc(sizeof(Pending) + plen + 1);
+    if (p) memcpy(p + 1, path, plen + 1);
+    GHI_FS_LOCK();
+    if (p) {
+        p->next = pending;
+        pending = p;
+    } else {
+        lost = true;
+    }
+    GHI_FS_UNLOCK();
+}
+
+void gyverhub::FsIndex::apply() {
+    GHI_FS_LOCK();
+    Pending* p = pending;
+    bool rebuild = lost;
+    pending = nullptr;
+    lost = false;
+    GHI_FS_UNLOCK();
+
+    // порядок не важен: update() смотрит текущее состояние ФС
+    if (rebuild) clear();
+    while (p) {
+        Pending* next = p->next;
+        update((const char*)(p + 1));
+        free(p);
+        p = next;
+    }
+}
+
+// порядок записей a и b для сортировки sort
+static int _fs_cmp(const char* a, uint32_t sa, const char* b, uint32_t sb, char sort) {
+    switch (sort) {
+        case 'N':
+            return strcmp(b, a);
+        case 's':
+            if (sa != sb) return sa < sb ? -1 : 1;
+            break;
+        case 'S':
+            if (sa != sb) return sa > sb ? -1 : 1;
+            break;
+    }
+    return strcmp(a, b);
+}
+
+uint32_t gyverhub::FsIndex::write(Json& answ, const FsQuery& q, String& next) {
+    size_t dlen = strlen(q.dir);
+    uint32_t total = 0, skipped = 0;
+    bool more = false;
+
+    // курсор: путь, для сортировки по размеру - размер и путь ("1234/file.txt")
+    bool bySize = q.sort == 's' || q.sort == 'S';
+    const char* kpath = nullptr;
+    uint32_t ksize = 0;
+    if (q.cursor && *q.cursor) {
+        kpath = q.cursor;
+        if (bySize) {
+            while (*kpath >= '0' && *kpath <= '9') ksize = ksize * 10 + (*kpath++ - '0');
+        }
+    }
+
+    if (q.sort != 'n' && q.sort != 'N' && !bySize) return 0;
+
+    if (q.sort == 'n') {
+        // индекс уже отсортирован по пути - один проход
+        size_t last = 0;
+        uint16_t sent = 0;
+        for (size_t i = 0; i < len; i = _next(i)) {
+            if (!_match(i, q, dlen)) continue;
+            total++;
+            if (kpath && strcmp(buf + i + 4, kpath) <= 0) continue;
+            if (skipped < q.offset) {
+                skipped++;
+                continue;
+            }
+            if (!q.limit || sent < q.limit) {
+                _write(answ, i);
+                sent++;
+                last = i;
+            } else {
+                more = true;
+            }
+        }
+        if (more) next = buf + last + 4;
+        return total;
+    }
+
+    // остальные сортировки: offset пропускается выбором (O(n) на запись, лучше курсор),
+    // страница - за один проход, в top копятся limit + 1 первых записей после курсора
+    while (skipped < q.offset) {
+        size_t best = len;
+        for (size_t i = 0; i < len; i = _next(i)) {
+            if (!_match(i, q, dlen)) continue;
+            if (kpath && _fs_cmp(buf + i + 4, _size(i), kpath, ksize, q.sort) <= 0) continue;
+            if (best == len || _fs_cmp(buf + i + 4, _size(i), buf + best + 4, _size(best), q.sort) < 0) best = i;
+        }
+        if (best == len) break;
+        kpath = buf + best + 4;
+        ksize = _size(best);
+        skipped++;
+    }
+
+    uint16_t limit = q.limit ? q.limit : entries;
+    size_t* top = new size_t[limit + 1];
+    if (!top) return 0;
+    uint32_t n = 0;
+    for (size_t i = 0; i < len; i = _next(i)) {
+        if (!_match(i, q, dlen)) continue;
+        total++;
+        const char* path = buf + i + 4;
+        uint32_t size = _size(i);
+        if (kpath && _fs_cmp(path, size, kpath, ksize, q.sort) <= 0) continue;
+        if (n > limit && _fs_cmp(path, size, buf + top[n - 1] + 4, _size(top[n - 1]), q.sort) >= 0) continue;
+        uint32_t pos = (n > limit) ? limit : n++;
+        while (pos && _fs_cmp(path, size, buf + top[pos - 1] + 4, _size(top[pos - 1]), q.sort) < 0) {
+            top[pos] = top[pos - 1];
+            pos--;
+        }
+        top[pos] = i;
+    }
+    if (n > limit) {
+        more = true;
+        n = limit;
+    }
+    for (uint32_t k = 0; k < n; k++) _write(answ, top[k]);
+    if (more && n) {
+        size_t last = top[n - 1];
+        if (bySize) {
+            next = String(_size(last));
+            next += buf + last + 4;
+        } else {
+            next = buf + last + 4;
+        }
+    }
+    delete[] top;
+    return total;
+}
+
+bool gyverhub::FsIndex::glob(const char* pattern, const char* name) {
+    const char* star = nullptr;
+    const char* retry = nullptr;
+    while (*name) {
+        if (*pattern == '*') {
+            star = pattern++;
+            retry = name;
+        } else if (*pattern == '?' || *pattern == *name) {
+            pattern++;
+            name++;
+        } else if (star) {
+            // звёздочка забирает ещё один символ
+            pattern = star + 1;
+            name = ++retry;
+        } else {
+            return false;
+        }
+    }
+    while (*pattern == '*') pattern++;
+    return !*pattern;
+}
+
+bool gyverhub::FsIndex::_match(size_t i, const FsQuery& q, size_t dlen) {
+    const char* path = buf + i + 4;
+    if (strncmp(path, q.dir, dlen) || !path[dlen]) return false;
+    if (!q.glob || !*q.glob) return true;
+    const char* name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+    return *name && glob(q.glob, name);
+}
+
+void gyverhub::FsIndex::_write(Json& answ, size_t i) {
+    answ += '"';
+    answ.appendEscaped(buf + i + 4);
+    answ += F("\":");
+    answ.appendUnsigned(_size(i));
+    answ += ',';
+}
+
+// первая запись с путём >= path
+size_t gyverhub::FsIndex::_find(const char* path, size_t plen, bool& found) {
+    found = false;
+    for (size_t i = 0; i < len;) {
+        const char* p = buf + i + 4;
+        int cmp = strncmp(p, path, plen);
+        if (!cmp) {
+            found = !p[plen];
+            return i;
+        }
+        if (cmp > 0) return i;
+        i += 4 + strlen(p) + 1;
+    }
+    return len;
+}
+
+void gyverhub::FsIndex::_set(const char* path, size_t plen, uint32_t size) {
+    bool found;
+    size_t i = _find(path, plen, found);
+    if (!found) {
+        size_t need = 4 + plen + 1;
+        if (len + need > cap) {
+            size_t ncap = cap + cap / 2;
+            if (ncap < len + need) ncap = len + need + 64;
+            char* nbuf = (char*)realloc(buf, ncap);
+            if (!nbuf) return;
+            buf = nbuf;
+            cap = ncap;
+        }
+        memmove(buf + i + need, buf + i, len - i);
+        memcpy(buf + i + 4, path, plen);
+        buf[i + 4 + plen] = '\0';
+        len += need;
+        entries++;
+    }
+    memcpy(buf + i, &size, 4);
+}
+
+// запись path; subtree - и все записи с префиксом path (папка с '/' на конце)
+void gyverhub::FsIndex::_erase(const char* path, size_t plen, bool subtree) {
+    bool found;
+    size_t from = _find(path, plen, found);
+    size_t to = from;
+    while (to < len) {
+        const char* p = buf + to + 4;
+        size_t l = strlen(p);
+        if (subtree ? strncmp(p, path, plen) != 0 : (l != plen || strncmp(p, path, plen) != 0)) break;
+        to += 4 + l + 1;
+        entries--;
+    }
+    memmove(buf + from, buf + to, len - to);
+    len -= to - from;
+}
+
+// папки на пути: check - по ФС (удалённые убрать), иначе просто добавить
+void gyverhub::FsIndex::_parents(const char* path, size_t plen, bool check) {
 #if GHC_FS == GHC_FS_SPIFFS
     (void) path;
-    (void) levels;
+    (void) plen;
+    (void) check;
+#else
+    for (size_t i = plen - 1; i > 0; i--) {
+        if (path[i] != '/' || i == plen - 1) continue;
+        if (!check) {
+            bool found;
+            _find(path, i + 1, found);
+            if (found) return;  // выше тоже есть
+            _set(path, i + 1, 0);
+            continue;
+        }
+        String dir(path);
+        dir.remove(i);
+        if (GHI_FS.exists(dir.c_str())) _set(path, i + 1, 0);
+        else _erase(path, i + 1, true);
+    }
+#endif
+}
 
+void gyverhub::FsIndex::_scan(const String& path, GHI_UNUSED uint8_t levels) {
+#ifdef ESP8266
+#if GHC_FS == GHC_FS_SPIFFS
     Dir dir = GHI_FS.openDir("");
     while (dir.next()) {
-        answ.concat('"');
-        answ.appendEscaped(dir.fileName());
-        answ.concat(F("\":"));
-        answ.concat(dir.fileSize());
-        answ.concat(',');
-
-        if (count) {
-            *count += answ.length();
-            answ.clear();
-        }
+        const String& name = dir.fileName();
+        _set(name.c_str(), name.length(), dir.fileSize());
     }
 
 #else  // non-spiffs on ESP8266
 
     Dir dir = GHI_FS.openDir(path);
     while (dir.next()) {
-        answ.concat('"');
-
+        String p(path);
+        p.concat(dir.fileName());
         if (dir.isDirectory()) {
-            String p(path);
-            p.concat(dir.fileName());
             p.concat('/');
-
-            answ.concat(p);
-            answ.concat(F("\":0,"));
-
-            if (count) {
-                *count += answ.length();
-                answ.clear();
-            }
-
-            if (levels) 
-                GH_showFiles(answ, count, p, levels - 1);
-
+            _set(p.c_str(), p.length(), 0);
+            if (levels) _scan(p, levels - 1);
         } else {
-            answ.concat(path);
-            answ.concat(dir.fileName());
-            answ.concat(F("\":"));
-            answ.concat(dir.fileSize());
-            answ.concat(',');
-
-            if (count) {
-                *count += answ.length();
-                answ.clear();
-            }
+            _set(p.c_str(), p.length(), dir.fileSize());
         }
     }
 
 #endif
 #else  // ESP32
 
-    File root = GHI_FS.open(path.c_str());
+    String open(path);
+    if (open.length() > 1) open.remove(open.length() - 1);
+    File root = GHI_FS.open(open.c_str());
     if (!root || !root.isDirectory()) return;
     File file;
     while (file = root.openNextFile()) {
-        answ.concat('"');
-        answ.appendEscaped(file.path());
-        answ.concat(F("\":"));
-        answ.concat(file.size());
-        answ.concat(',');
-
-        if (count) {
-            *count += answ.length();
-            answ.clear();
+        String p(file.path());
+        if (file.isDirectory()) {
+            p.concat('/');
+            _set(p.c_str(), p.length(), 0);
+            if (levels) _scan(p, levels - 1);
+        } else {
+            _set(p.c_str(), p.length(), file.size());
         }
-
-        if (file.isDirectory() && levels)
-            GH_showFiles(answ, count, file.path(), levels - 1);
     }
 #endif
-#endif
 }
+
+#endif
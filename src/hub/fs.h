@@ -2,4 +2,107 @@
 #include "macro.hpp"
 #include "utils/json.h"
 
-void GH_showFiles(gyverhub::Json& answ, uint16_t* count = nullptr, const String& path = "/", GHI_UNUSED uint8_t levels = GHC_FS_MAX_DEPTH);
+namespace gyverhub {
+    // выборка списка файлов fsbr
+    struct FsQuery {
+        const char* dir = "/";          // папка, с вложенными
+        const char* glob = nullptr;     // маска имени файла (* и ?), папки при маске не выводятся
+        const char* cursor = nullptr;   // продолжить после записи (next прошлого ответа)
+        uint32_t offset = 0;            // пропустить записей
+        uint16_t limit = 0;             // записей на странице, 0 - все
+        char sort = 'n';                // n - путь, s - размер, N, S - по убыванию
+    };
+
+    // Индекс файловой системы в RAM: пути и размеры файлов, папки - путь с '/' на конце.
+    // Строится одним обходом ФС при первом запросе fsbr, дальше обновляется по изменениям,
+    // fsbr - один проход по памяти. Записи упакованы: uint32 размер, путь, '\0', по возрастанию пути
+    class FsIndex {
+    public:
+        ~FsIndex() {
+            while (pending) {
+                Pending* next = pending->next;
+                free(pending);
+                pending = next;
+            }
+            clear();
+        }
+
+        // обойти ФС (глубина GHC_FS_MAX_DEPTH)
+        void build();
+
+        // забыть всё, следующий fsbr обойдёт ФС заново
+        void clear();
+
+        bool built() {
+            return ready;
+        }
+
+        // путь изменился: файл, папка с содержимым или удалён. Родительские папки проверяются
+        void update(const char* path);
+
+        // файл дописан - новый размер без обращения к ФС
+        void touch(const char* path, uint32_t size);
+
+        // update() из другой задачи (загрузка в обработчике HTTP): путь ставится в очередь,
+        // индекс обновит apply() из tick(). Можно вызывать из любой задачи
+        void post(const char* path);
+
+        // обновить индекс по очереди post(), только из задачи loop
+        void apply();
+
+        // записи выборки q: "путь":размер, с запятой после каждой. Вернёт, сколько записей
+        // подходит всего, в next - курсор следующей страницы (пустой - страница последняя)
+        uint32_t write(Json& answ, const FsQuery& q, String& next);
+
+        // имя подходит под маску: * - любые символы, ? - один символ
+        static bool glob(const char* pattern, const char* name);
+
+        // записей
+        uint16_t count() {
+            return entries;
+        }
+
+        // длина всех записей в JSON, байт (без экранирования): "путь":размер, - на 9 байт
+        // длиннее записи в индексе при размере до 10 цифр
+        size_t jsonLength() {
+            return len + entries * 9;
+        }
+
+    private:
+        char* buf = nullptr;
+        size_t len = 0;
+        size_t cap = 0;
+        uint16_t entries = 0;
+        bool ready = false;
+
+        // очередь post(): путь лежит сразу за структурой
+        struct Pending {
+            Pending* next;
+        };
+        Pending* pending = nullptr;
+        bool lost = false;      // не хватило памяти на очередь - индекс строится заново
+#ifdef ESP32
+        portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+        size_t _next(size_t i) {
+            return i + 4 + strlen(buf + i + 4) + 1;
+        }
+        uint32_t _size(size_t i) {
+            uint32_t size;
+            memcpy(&size, buf + i, 4);
+            return size;
+        }
+
+        bool _match(size_t i, const FsQuery& q, size_t dlen);
+        void _write(Json& answ, size_t i);
+        size_t _find(const char* path, size_t plen, bool& found);
+        void _set(const char* path, size_t plen, uint32_t size);
+        void _erase(const char* path, size_t plen, bool subtree);
+        void _parents(const char* path, size_t plen, bool check);
+        void _scan(const String& path, uint8_t levels);
+    };
+
+    // общий индекс: GyverHub, запись логов и GHtsdb
+    FsIndex& fsIndex();
+}
@@ -0,0 +1,240 @@
+#include "gzip.h"
+#include "utils/crc32.h"
+#include "utils/mime.h"
+
+#if GHC_FS != GHC_FS_NONE && GHC_GZIP_WINDOW
+
+#define GHI_GZIP_HASH_BITS 10
+#define GHI_GZIP_HASH (1 << GHI_GZIP_HASH_BITS)
+#define GHI_GZIP_NONE 0xffff
+#define GHI_GZIP_MAX_MATCH 258
+// кандидатов с одним хешем, больше - медленнее и чуть лучше сжатие
+#define GHI_GZIP_CHAIN 8
+
+static_assert((GHC_GZIP_WINDOW & (GHC_GZIP_WINDOW - 1)) == 0 && GHC_GZIP_WINDOW >= 512 && GHC_GZIP_WINDOW <= 16384,
+              "GHC_GZIP_WINDOW: power of 2 in 512..16384");
+
+enum : uint8_t {
+    GHI_GZIP_HEAD,
+    GHI_GZIP_BODY,
+    GHI_GZIP_TAIL,
+    GHI_GZIP_DONE,
+};
+
+// ID, deflate, без флагов и времени, ОС неизвестна
+static const uint8_t _gz_head[10] PROGMEM = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+
+static const uint16_t _gz_lbase[29] PROGMEM = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                               35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t _gz_lext[29] PROGMEM = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                             3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t _gz_dbase[30] PROGMEM = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129,
+                                               193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+
+bool gyverhub::Gzip::begin(File& file) {
+    close();
+    win = (uint8_t*)malloc(GHC_GZIP_WINDOW * 2);
+    head = (uint16_t*)malloc(GHI_GZIP_HASH * sizeof(uint16_t));
+    prev = (uint16_t*)malloc(GHC_GZIP_WINDOW * sizeof(uint16_t));
+    if (!win || !head || !prev) {
+        close();
+        return false;
+    }
+    this->file = file;
+    zsize = 0;
+    _reset();
+    return true;
+}
+
+bool gyverhub::Gzip::worth(const char* path, uint32_t size) {
+    if (size < GHI_GZIP_MIN) return false;
+    bool gz;
+    PGM_P mime = getMimeByPath(path, strlen(path), &gz);
+    return !gz && isCompressible(mime);
+}
+
+uint32_t gyverhub::Gzip::size() {
+    if (!win) return 0;
+    if (!zsize) {
+        uint8_t buf[64];
+        size_t n;
+        while ((n = read(buf, sizeof(buf)))) zsize += n;
+        _reset();
+    }
+    return zsize;
+}
+
+size_t gyverhub::Gzip::read(uint8_t* buf, size_t len) {
+    if (!win) return 0;
+    size_t out = 0;
+    while (out < len) {
+        // сначала готовые байты из битового буфера
+        while (bits >= 8 && out < len) {
+            buf[out++] = bitbuf;
+            bitbuf >>= 8;
+            bits -= 8;
+        }
+        if (out >= len) break;
+
+        switch (stage) {
+            case GHI_GZIP_HEAD:
+                buf[out++] = pgm_read_byte(_gz_head + spos);
+                if (++spos == sizeof(_gz_head)) {
+                    stage = GHI_GZIP_BODY;
+                    spos = 0;
+                    _put(0b011, 3);  // последний блок, фиксированные коды
+                }
+                break;
+
+            case GHI_GZIP_BODY:
+                if (!_step()) {
+                    _sym(256);  // конец блока
+                    if (bits & 7) bits += 8 - (bits & 7);
+                    stage = GHI_GZIP_TAIL;
+                }
+                break;
+
+            case GHI_GZIP_TAIL:
+                buf[out++] = (spos < 4 ? crc : total) >> ((spos & 3) * 8);
+                if (++spos == 8) stage = GHI_GZIP_DONE;
+                break;
+
+            default:
+                return out;
+        }
+    }
+    return out;
+}
+
+void gyverhub::Gzip::close() {
+    free(win);
+    free(head);
+    free(prev);
+    win = nullptr;
+    head = nullptr;
+    prev = nullptr;
+    file.close();
+}
+
+void gyverhub::Gzip::_reset() {
+    file.seek(0);
+    memset(head, 0xff, GHI_GZIP_HASH * sizeof(uint16_t));
+    bitbuf = 0;
+    bits = 0;
+    crc = 0;
+    total = 0;
+    pos = look = 0;
+    stage = GHI_GZIP_HEAD;
+    spos = 0;
+    eof = false;
+}
+
+static inline uint16_t _gz_slide(uint16_t p) {
+    return (p != GHI_GZIP_NONE && p >= GHC_GZIP_WINDOW) ? p - GHC_GZIP_WINDOW : GHI_GZIP_NONE;
+}
+
+void gyverhub::Gzip::_fill() {
+    // окно истории ушло вперёд - сдвигаем на окно назад вместе с позициями в хешах
+    if (pos >= GHC_GZIP_WINDOW) {
+        memmove(win, win + GHC_GZIP_WINDOW, pos + look - GHC_GZIP_WINDOW);
+        pos -= GHC_GZIP_WINDOW;
+        for (uint16_t i = 0; i < GHI_GZIP_HASH; i++) head[i] = _gz_slide(head[i]);
+        for (uint16_t i = 0; i < GHC_GZIP_WINDOW; i++) prev[i] = _gz_slide(prev[i]);
+    }
+    uint16_t space = GHC_GZIP_WINDOW * 2 - pos - look;
+    size_t n = file.read(win + pos + look, space);
+    if (!n) {
+        eof = true;
+        return;
+    }
+    crc = crc32(win + pos + look, n, crc);
+    total += n;
+    look += n;
+}
+
+static inline uint16_t _gz_hash(const uint8_t* p) {
+    uint32_t v = (uint32_t)p[0] << 16 | p[1] << 8 | p[2];
+    return (uint32_t)(v * 2654435761u) >> (32 - GHI_GZIP_HASH_BITS);
+}
+
+void gyverhub::Gzip::_insert(uint16_t p) {
+    uint16_t h = _gz_hash(win + p);
+    prev[p & (GHC_GZIP_WINDOW - 1)] = head[h];
+    head[h] = p;
+}
+
+bool gyverhub::Gzip::_step() {
+    if (look < GHI_GZIP_MAX_MATCH && !eof) _fill();
+    if (!look) return false;
+
+    uint16_t best = 0, dist = 0;
+    if (look >= 3) {
+        uint16_t maxlen = look < GHI_GZIP_MAX_MATCH ? look : GHI_GZIP_MAX_MATCH;
+        uint16_t cand = head[_gz_hash(win + pos)];
+        // prev позиции старше окна уже перезаписан - такие кандидаты не смотрим
+        for (uint8_t depth = GHI_GZIP_CHAIN; depth && cand != GHI_GZIP_NONE && cand < pos && pos - cand < GHC_GZIP_WINDOW; depth--) {
+            const uint8_t* a = win + pos;
+            const uint8_t* b = win + cand;
+            if (b[best] == a[best]) {
+                uint16_t l = 0;
+                while (l < maxlen && a[l] == b[l]) l++;
+                if (l > best) {
+                    best = l;
+                    dist = pos - cand;
+                    if (l == maxlen) break;
+                }
+            }
+            cand = prev[cand & (GHC_GZIP_WINDOW - 1)];
+        }
+        _insert(pos);
+    }
+
+    if (best < 3) {
+        _sym(win[pos]);
+        pos++;
+        look--;
+        return true;
+    }
+
+    uint8_t i = 28;
+    while (pgm_read_word(_gz_lbase + i) > best) i--;
+    _sym(257 + i);
+    _put(best - pgm_read_word(_gz_lbase + i), pgm_read_byte(_gz_lext + i));
+
+    i = 29;
+    while (pgm_read_word(_gz_dbase + i) > dist) i--;
+    _code(i, 5);
+    _put(dist - pgm_read_word(_gz_dbase + i), i < 4 ? 0 : i / 2 - 1);
+
+    // позиции внутри совпадения тоже в хеш, иначе следующие совпадения теряются
+    for (uint16_t k = 1; k < best; k++) {
+        if (look - k >= 3) _insert(pos + k);
+    }
+    pos += best;
+    look -= best;
+    return true;
+}
+
+void gyverhub::Gzip::_put(uint32_t v, uint8_t n) {
+    bitbuf |= (uint64_t)v << bits;
+    bits += n;
+}
+
+// коды Хаффмана пишутся со старшего бита
+void gyverhub::Gzip::_code(uint16_t code, uint8_t n) {
+    uint16_t r = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        r = (r << 1) | (code & 1);
+        code >>= 1;
+    }
+    _put(r, n);
+}
+
+void gyverhub::Gzip::_sym(uint16_t s) {
+    if (s < 144) _code(0x30 + s, 8);
+    else if (s < 256) _code(0x190 + s - 144, 9);
+    else if (s < 280) _code(s - 256, 7);
+    else _code(0xc0 + s - 280, 8);
+}
+
+#endif
@@ -0,0 +1,62 @@
+#pragma once
+#include "macro.hpp"
+
+#if GHC_FS != GHC_FS_NONE && GHC_GZIP_WINDOW
+#include "hub/source.h"
+
+// файлы меньше - без сжатия, заголовок и таблицы съедят выигрыш
+#define GHI_GZIP_MIN 256
+
+namespace gyverhub {
+    // Сжатие файла в gzip на лету, по частям любого размера. LZ77 с окном GHC_GZIP_WINDOW байт
+    // и фиксированные коды Хаффмана (один блок deflate, как в uzlib). Память - около 5 окон,
+    // выделяется в begin() и освобождается в close()
+    class Gzip : public FetchSource {
+    public:
+        ~Gzip() {
+            close();
+        }
+
+        // начать сжатие файла с начала. false - нет памяти
+        bool begin(File& file);
+
+        // стоит ли сжимать: текстовый MIME, не .gz, не меньше GHI_GZIP_MIN байт
+        static bool worth(const char* path, uint32_t size);
+
+        // размер сжатых данных: файл сжимается вхолостую целиком, потом чтение с начала
+        uint32_t size() override;
+
+        size_t read(uint8_t* buf, size_t len) override;
+        void close() override;
+
+        bool active() {
+            return win;
+        }
+
+    private:
+        File file;
+        uint8_t* win = nullptr;    // 2 окна: история и входные данные
+        uint16_t* head = nullptr;  // последняя позиция с таким хешем 3 байт
+        uint16_t* prev = nullptr;  // предыдущая с тем же хешем, по позиции в окне
+        uint64_t bitbuf = 0;
+        uint32_t crc = 0;
+        uint32_t total = 0;        // байт прочитано из файла
+        uint32_t zsize = 0;
+        uint16_t pos = 0;
+        uint16_t look = 0;
+        uint8_t bits = 0;
+        uint8_t stage = 0;
+        uint8_t spos = 0;
+        bool eof = false;
+
+        void _reset();
+        void _fill();
+        bool _step();
+        void _insert(uint16_t p);
+        void _put(uint32_t v, uint8_t n);
+        void _code(uint16_t code, uint8_t n);
+        void _sym(uint16_t s);
+    };
+}
+
+#endif
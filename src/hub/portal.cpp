@@ -0,0 +1,26 @@
+#include "portal.h"
+
+// портал отдают только HTTP серверы ESP
+#if GHC_PORTAL == GHC_PORTAL_BUILTIN && GHI_ESP_BUILD
+#include "utils/http.h"
+
+using namespace gyverhub::portal;
+
+#if GHC_PORTAL_BROTLI
+#define GHI_PORTAL_ASSET(name, mime) {mime, {"gzip", name, name##_size, name##_etag, name##_head}, {"br", name##_br, name##_br_size, name##_br_etag, name##_br_head}}
+#else
+#define GHI_PORTAL_ASSET(name, mime) {mime, {"gzip", name, name##_size, name##_etag, name##_head}}
+#endif
+
+const Asset gyverhub::portal::index_asset = GHI_PORTAL_ASSET(index, "text/html");
+const Asset gyverhub::portal::script_asset = GHI_PORTAL_ASSET(script, "text/javascript");
+const Asset gyverhub::portal::style_asset = GHI_PORTAL_ASSET(style, "text/css");
+
+const Encoded &Asset::select(GHI_UNUSED const char *acceptEncoding) const {
+#if GHC_PORTAL_BROTLI
+    if (gyverhub::acceptsEncoding(acceptEncoding, "br")) return br;
+#endif
+    return gzip;
+}
+
+#endif
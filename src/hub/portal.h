@@ -1,13 +1,65 @@
 #pragma once 
 #include "macro.hpp"
 
+// CORS заголовки ответов HTTP сервера одной строкой, для готовых заголовков
+#define GHI_HTTP_CORS                               \
+    "Access-Control-Allow-Origin: *\r\n"            \
+    "Access-Control-Allow-Methods: *\r\n"           \
+    "Access-Control-Allow-Private-Network: true\r\n"
+
 namespace gyverhub::portal {
 #if GHC_PORTAL == GHC_PORTAL_BUILTIN
+    // сжатый файл портала: данные во flash и готовый заголовок ответа 200 (статус, тип,
+    // сжатие, длина, ETag, кеш, CORS), собранные build.py
+    struct Encoded {
+        const char *encoding;
+        const uint8_t *data;
+        size_t size;
+        const char *etag;
+        const char *head;
+    };
+
+    struct Asset {
+        const char *mime;
+        Encoded gzip;
+#if GHC_PORTAL_BROTLI
+        Encoded br;
+#endif
+
+        // вариант по заголовку Accept-Encoding (может быть nullptr): br, если клиент принимает, иначе gzip
+        const Encoded &select(const char *acceptEncoding) const;
+    };
+
+    extern const Asset index_asset;
+    extern const Asset script_asset;
+    extern const Asset style_asset;
+
     extern const uint8_t index[] PROGMEM;
     extern const size_t index_size;
+    extern const char index_etag[];  // CRC32 сжатого файла в кавычках
+    extern const char index_head[] PROGMEM;
     extern const uint8_t script[] PROGMEM;
     extern const size_t script_size;
+    extern const char script_etag[];
+    extern const char script_head[] PROGMEM;
     extern const uint8_t style[] PROGMEM;
     extern const size_t style_size;
+    extern const char style_etag[];
+    extern const char style_head[] PROGMEM;
+
+#if GHC_PORTAL_BROTLI
+    extern const uint8_t index_br[] PROGMEM;
+    extern const size_t index_br_size;
+    extern const char index_br_etag[];
+    extern const char index_br_head[] PROGMEM;
+    extern const uint8_t script_br[] PROGMEM;
+    extern const size_t script_br_size;
+    extern const char script_br_etag[];
+    extern const char script_br_head[] PROGMEM;
+    extern const uint8_t style_br[] PROGMEM;
+    extern const size_t style_br_size;
+    extern const char style_br_etag[];
+    extern const char style_br_head[] PROGMEM;
+#endif
 #endif
 }
@@ -0,0 +1,19 @@
+#pragma once
+#include "macro.hpp"
+
+namespace gyverhub {
+    // источник данных, читаемый по частям (ответ на запрос, сгенерированные данные)
+    class FetchSource {
+    public:
+        virtual ~FetchSource() = default;
+
+        // всего байт
+        virtual uint32_t size() = 0;
+
+        // прочитать следующие до len байт
+        virtual size_t read(uint8_t* buf, size_t len) = 0;
+
+        // отправка закончена или прервана
+        virtual void close() {}
+    };
+}
@@ -0,0 +1,304 @@
+#include "tsdb.h"
+#include "hub/fs.h"
+
+#if GHC_FS != GHC_FS_NONE
+
+// секунд в интервале уровня
+static const uint16_t _GH_ts_step[GHI_TS_TIERS] = {1, 60, 3600};
+
+GHtsdb* GHtsdb::list = nullptr;
+
+bool GHtsdb::begin(const char* dir, uint8_t series, uint8_t slots) {
+    end();
+    if (series < 1) series = 1;
+    if (series > GHI_TS_SERIES) series = GHI_TS_SERIES;
+    if (slots < 2) slots = 2;
+    this->dir = dir;
+    this->slots = slots;
+    nseries = series;
+    rec = 4 + nseries * 3 * sizeof(float);
+    perPage = GHC_TS_PAGE / rec;
+    if (!perPage) perPage = 1;
+    perSegment = GHC_TS_SEGMENT / rec;
+    if (perSegment < perPage) perSegment = perPage;
+
+    for (uint8_t k = 0; k < GHI_TS_TIERS; k++) {
+        Tier& t = tiers[k];
+        t.page = new uint8_t[perPage * rec];
+        t.first = new uint32_t[slots]();
+        t.count = new uint16_t[slots]();
+        t.acc = new float[nseries * 3];
+        if (!t.page || !t.first || !t.count || !t.acc) {
+            end();
+            return false;
+        }
+    }
+
+    GHI_FS.mkdir(dir);
+    for (uint8_t k = 0; k < GHI_TS_TIERS; k++) _load(k);
+    next = list;
+    list = this;
+    return true;
+}
+
+void GHtsdb::end() {
+    if (nseries) {
+        flush();
+        for (GHtsdb** p = &list; *p; p = &(*p)->next) {
+            if (*p == this) {
+                *p = next;
+                break;
+            }
+        }
+    }
+    for (uint8_t k = 0; k < GHI_TS_TIERS; k++) {
+        Tier& t = tiers[k];
+        t.file.close();
+        delete[] t.page;
+        delete[] t.first;
+        delete[] t.count;
+        delete[] t.acc;
+        t = Tier();
+    }
+    nseries = 0;
+    q_count = q_left = 0;
+}
+
+GHtsdb* GHtsdb::find(const char* dir) {
+    for (GHtsdb* p = list; p; p = p->next) {
+        if (!strcmp(p->dir, dir)) return p;
+    }
+    return nullptr;
+}
+
+void GHtsdb::add(uint32_t time, const float* v) {
+    if (!nseries) return;
+    // время назад - отсчёт отбрасывается
+    if (tiers[0].samples && time < tiers[0].bucket) return;
+
+    for (uint8_t k = 0; k < GHI_TS_TIERS; k++) {
+        Tier& t = tiers[k];
+        uint32_t bucket = time - time % _GH_ts_step[k];
+        if (t.samples && bucket != t.bucket) _emit(k);
+
+        if (!t.samples) {
+            t.bucket = bucket;
+            for (uint8_t s = 0; s < nseries; s++) {
+                t.acc[s * 3] = t.acc[s * 3 + 1] = t.acc[s * 3 + 2] = v[s];
+            }
+        } else {
+            for (uint8_t s = 0; s < nseries; s++) {
+                float* a = t.acc + s * 3;
+                if (v[s] < a[0]) a[0] = v[s];
+                if (v[s] > a[1]) a[1] = v[s];
+                a[2] += v[s];
+            }
+        }
+        t.samples++;
+    }
+}
+
+void GHtsdb::flush() {
+    for (uint8_t k = 0; k < GHI_TS_TIERS; k++) _write(k);
+}
+
+bool GHtsdb::query(uint32_t from, uint32_t to, uint32_t points) {
+    q_count = q_left = 0;
+    q_headPos = 0;
+    if (!nseries || from > to) return false;
+
+    // самый подробный уровень, где точек не больше points
+    uint8_t k = 0;
+    while (k < GHI_TS_TIERS - 1 && (to - from) / _GH_ts_step[k] + 1 > points) k++;
+    q_tier = k;
+
+    // слоты от старого к текущему, границы - по разреженному индексу и двоичному поиску в слоте
+    Tier& t = tiers[k];
+    bool started = false;
+    for (uint8_t j = 1; j <= slots; j++) {
+        uint8_t s = (t.cur + j) % slots;
+        uint32_t n = _records(k, s);
+        if (!n) continue;
+        if (t.first[s] > to) break;
+
+        uint32_t lo = 0;
+        if (!started) {
+            // слот целиком раньше from - следующий начинается не позже
+            uint8_t ns = (s + 1) % slots;
+            if (j < slots && _records(k, ns) && t.first[ns] <= from) continue;
+            lo = _search(k, s, from);
+            if (lo >= n) continue;
+        }
+        uint32_t hi = (to == 0xffffffff) ? n : _search(k, s, to + 1);
+        if (hi <= lo) break;
+
+        if (!started) {
+            q_slot = s;
+            q_pos = lo * rec;
+            started = true;
+        }
+        q_last = s;
+        q_end = hi * rec;
+        q_count += hi - lo;
+        if (hi < n) break;
+    }
+
+    q_left = q_count * rec;
+    uint16_t step = _GH_ts_step[k];
+    memcpy(q_head, &q_count, 4);
+    memcpy(q_head + 4, &step, 2);
+    q_head[6] = nseries;
+    q_head[7] = k;
+    return true;
+}
+
+uint32_t GHtsdb::size() {
+    return sizeof(q_head) + q_count * rec;
+}
+
+size_t GHtsdb::read(uint8_t* buf, size_t len) {
+    size_t out = 0;
+    while (out < len && q_headPos < sizeof(q_head)) buf[out++] = q_head[q_headPos++];
+
+    Tier& t = tiers[q_tier];
+    while (out < len && q_left) {
+        uint32_t end = (q_slot == q_last) ? q_end : _bytes(q_tier, q_slot, false);
+        if (q_pos >= end) {
+            // слот перезаписан во время чтения - дальше читать нечего
+            if (q_slot == q_last) break;
+            q_slot = (q_slot + 1) % slots;
+            q_pos = 0;
+            continue;
+        }
+
+        uint32_t n = end - q_pos;
+        if (n > len - out) n = len - out;
+        uint32_t inFile = _bytes(q_tier, q_slot, true);
+        if (q_pos < inFile) {
+            if (n > inFile - q_pos) n = inFile - q_pos;
+            char path[32];
+            _path(path, q_tier, q_slot);
+            File f = GHI_FS.open(path, "r");
+            if (!f || !f.seek(q_pos) || f.read(buf + out, n) != n) break;
+            f.close();
+        } else {
+            memcpy(buf + out, t.page + (q_pos - inFile), n);
+        }
+        q_pos += n;
+        out += n;
+        q_left -= n;
+    }
+    return out;
+}
+
+void GHtsdb::_path(char* buf, uint8_t tier, uint8_t slot) {
+    snprintf(buf, 32, "%s/%d.%d", dir, tier, slot);
+}
+
+void GHtsdb::_load(uint8_t tier) {
+    Tier& t = tiers[tier];
+    char path[32];
+    bool torn = false;
+    for (uint8_t s = 0; s < slots; s++) {
+        _path(path, tier, s);
+        if (!GHI_FS.exists(path)) continue;
+        File f = GHI_FS.open(path, "r");
+        if (!f) continue;
+        uint32_t size = f.size();
+        uint32_t n = size / rec;
+        if (n > perSegment) n = perSegment;
+        if (n && f.read((uint8_t*)&t.first[s], 4) == 4) t.count[s] = n;
+        f.close();
+
+        // текущий слот - с самой поздней первой записью
+        if (t.count[s] && (!t.count[t.cur] || t.first[s] > t.first[t.cur])) {
+            t.cur = s;
+            torn = size != n * rec;
+        }
+    }
+    // недописанная запись в конце - дописывать в следующий слот
+    if (torn) {
+        t.cur = (t.cur + 1) % slots;
+        t.count[t.cur] = 0;
+    }
+}
+
+void GHtsdb::_emit(uint8_t tier) {
+    Tier& t = tiers[tier];
+    // слот заполнен - переход на следующий, старые данные в нём больше не читаются
+    if (t.count[t.cur] + t.fill >= perSegment) {
+        t.file.close();
+        t.cur = (t.cur + 1) % slots;
+        t.count[t.cur] = 0;
+    }
+    if (!t.count[t.cur] && !t.fill) t.first[t.cur] = t.bucket;
+
+    uint8_t* p = t.page + t.fill * rec;
+    memcpy(p, &t.bucket, 4);
+    p += 4;
+    for (uint8_t s = 0; s < nseries; s++) {
+        float v[3] = {t.acc[s * 3], t.acc[s * 3 + 1], t.acc[s * 3 + 2] / t.samples};
+        memcpy(p, v, sizeof(v));
+        p += sizeof(v);
+    }
+    t.samples = 0;
+    t.fill++;
+    if (t.fill >= perPage || t.count[t.cur] + t.fill >= perSegment) _write(tier);
+}
+
+void GHtsdb::_write(uint8_t tier) {
+    Tier& t = tiers[tier];
+    if (!t.fill) return;
+    char path[32];
+    _path(path, tier, t.cur);
+    // новый слот - старое содержимое файла отбрасывается
+    if (!t.file) t.file = GHI_FS.open(path, t.count[t.cur] ? "a" : "w");
+    if (t.file) {
+        t.file.write(t.page, t.fill * rec);
+        t.file.flush();
+        t.count[t.cur] += t.fill;
+        gyverhub::fsIndex().touch(path, t.count[t.cur] * rec);
+    }
+    t.fill = 0;
+}
+
+uint32_t GHtsdb::_records(uint8_t tier, uint8_t slot) {
+    Tier& t = tiers[tier];
+    return t.count[slot] + (slot == t.cur ? t.fill : 0);
+}
+
+uint32_t GHtsdb::_bytes(uint8_t tier, uint8_t slot, bool file) {
+    Tier& t = tiers[tier];
+    return (file ? t.count[slot] : _records(tier, slot)) * rec;
+}
+
+uint32_t GHtsdb::_time(File& f, uint8_t tier, uint8_t slot, uint32_t i) {
+    Tier& t = tiers[tier];
+    uint32_t time = 0;
+    if (i < t.count[slot]) {
+        if (f && f.seek(i * rec)) f.read((uint8_t*)&time, 4);
+    } else {
+        memcpy(&time, t.page + (i - t.count[slot]) * rec, 4);
+    }
+    return time;
+}
+
+uint32_t GHtsdb::_search(uint8_t tier, uint8_t slot, uint32_t time) {
+    File f;
+    if (tiers[tier].count[slot]) {
+        char path[32];
+        _path(path, tier, slot);
+        f = GHI_FS.open(path, "r");
+    }
+    // первая запись со временем >= time
+    uint32_t lo = 0, hi = _records(tier, slot);
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (_time(f, tier, slot, mid) < time) lo = mid + 1;
+        else hi = mid;
+    }
+    f.close();
+    return lo;
+}
+
+#endif
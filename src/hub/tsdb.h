@@ -0,0 +1,111 @@
+#pragma once
+#include "macro.hpp"
+
+#if GHC_FS != GHC_FS_NONE
+#include "hub/fetch.h"
+
+// максимум значений в отсчёте
+#define GHI_TS_SERIES 8
+
+// уровни агрегации: 1 с, 1 мин, 1 ч
+#define GHI_TS_TIERS 3
+
+// Хранилище временных рядов на флеше. Отсчёты сворачиваются в уровни 1 с / 1 мин / 1 ч,
+// запись уровня - время начала интервала (uint32) и min, max, avg (float) каждого значения.
+// Уровень - кольцо из slots файлов dir/<уровень>.<слот> по GHC_TS_SEGMENT байт.
+// Записи копятся в RAM и пишутся страницами по GHC_TS_PAGE байт
+class GHtsdb : public gyverhub::FetchSource {
+   public:
+    ~GHtsdb() {
+        end();
+    }
+
+    // открыть хранилище в папке dir (строковая константа) на series значений в отсчёте.
+    // Имя папки - имя хранилища в команде query. false - не хватило памяти
+    bool begin(const char* dir = "/ts", uint8_t series = 1, uint8_t slots = 8);
+
+    // записать буферы и закрыть
+    void end();
+
+    // добавить отсчёт: время в секундах (не убывает) и значения
+    void add(uint32_t time, const float* v);
+    void add(uint32_t time, float* v) {
+        add(time, (const float*)v);
+    }
+    template <typename... V>
+    void add(uint32_t time, V... v) {
+        float buf[GHI_TS_SERIES] = {(float)v...};
+        add(time, (const float*)buf);
+    }
+
+    // записать недописанные страницы (перед сном, перезагрузкой)
+    void flush();
+
+    // подготовить чтение записей с временем в [from, to] из самого подробного уровня,
+    // где их не больше points (иначе из часового). Читать через read() или отправить fetch.
+    // Поток: заголовок 8 байт (uint32 записей, uint16 секунд в интервале, uint8 значений,
+    // uint8 уровень), затем записи. false - хранилище не открыто
+    bool query(uint32_t from, uint32_t to, uint32_t points);
+
+    // записей в ответе на последний query
+    uint32_t count() {
+        return q_count;
+    }
+
+    // размер записи, байт
+    uint16_t recordSize() {
+        return rec;
+    }
+
+    uint32_t size() override;
+    size_t read(uint8_t* buf, size_t len) override;
+
+    // открытое хранилище по имени папки
+    static GHtsdb* find(const char* dir);
+
+   private:
+    struct Tier {
+        File file;
+        uint8_t* page = nullptr;   // записи, ещё не записанные в файл
+        uint32_t* first = nullptr;  // время первой записи слота - разреженный индекс
+        uint16_t* count = nullptr;  // записей в файле слота
+        float* acc = nullptr;       // min, max, sum текущего интервала
+        uint32_t bucket = 0;
+        uint32_t samples = 0;
+        uint16_t fill = 0;
+        uint8_t cur = 0;
+    };
+
+    Tier tiers[GHI_TS_TIERS];
+    const char* dir = nullptr;
+    GHtsdb* next = nullptr;
+    uint16_t rec = 0;
+    uint16_t perPage = 0;
+    uint16_t perSegment = 0;
+    uint8_t nseries = 0;
+    uint8_t slots = 0;
+
+    // состояние чтения query
+    uint8_t q_head[8];
+    uint8_t q_headPos = 0;
+    uint8_t q_tier = 0;
+    uint8_t q_slot = 0;
+    uint8_t q_last = 0;
+    uint32_t q_pos = 0;
+    uint32_t q_end = 0;
+    uint32_t q_left = 0;
+    uint32_t q_count = 0;
+
+    static GHtsdb* list;
+
+    void _path(char* buf, uint8_t tier, uint8_t slot);
+    void _load(uint8_t tier);
+    void _emit(uint8_t tier);
+    void _write(uint8_t tier);
+    uint32_t _records(uint8_t tier, uint8_t slot);
+    uint32_t _bytes(uint8_t tier, uint8_t slot, bool file);
+    uint32_t _time(File& f, uint8_t tier, uint8_t slot, uint32_t i);
+    uint32_t _search(uint8_t tier, uint8_t slot, uint32_t time);
+};
+
+#endif
@@ -21,9 +21,14 @@ GHI_PGM(_GH_CMD17, "ota");
 GHI_PGM(_GH_CMD18, "ota_chunk");
 GHI_PGM(_GH_CMD19, "ota_url");
 GHI_PGM(_GH_CMD20, "read");
+GHI_PGM(_GH_CMD21, "page");
+GHI_PGM(_GH_CMD22, "rows");
+GHI_PGM(_GH_CMD23, "tail");
+GHI_PGM(_GH_CMD24, "plot");
+GHI_PGM(_GH_CMD25, "query");
 
-#define GH_CMD_LEN 20
-GHI_PGM_LIST(_GH_cmd_list, _GH_CMD0, _GH_CMD1, _GH_CMD2, _GH_CMD3, _GH_CMD4, _GH_CMD5, _GH_CMD6, _GH_CMD7, _GH_CMD8, _GH_CMD9, _GH_CMD10, _GH_CMD11, _GH_CMD12, _GH_CMD13, _GH_CMD14, _GH_CMD15, _GH_CMD16, _GH_CMD17, _GH_CMD18, _GH_CMD19, _GH_CMD20);
+#define GH_CMD_LEN 26
+GHI_PGM_LIST(_GH_cmd_list, _GH_CMD0, _GH_CMD1, _GH_CMD2, _GH_CMD3, _GH_CMD4, _GH_CMD5, _GH_CMD6, _GH_CMD7, _GH_CMD8, _GH_CMD9, _GH_CMD10, _GH_CMD11, _GH_CMD12, _GH_CMD13, _GH_CMD14, _GH_CMD15, _GH_CMD16, _GH_CMD17, _GH_CMD18, _GH_CMD19, _GH_CMD20, _GH_CMD21, _GH_CMD22, _GH_CMD23, _GH_CMD24, _GH_CMD25);
 
 gyverhub::Command gyverhub::parseCommand(const char* str) {
     for (int i = 0; i < GH_CMD_LEN; i++) {
@@ -40,6 +40,11 @@ namespace gyverhub {
         OTA_CHUNK,
         OTA_URL,
         READ,
+        PAGE,
+        ROWS,
+        TAIL,
+        PLOT,
+        QUERY,
 
         HTTP_FETCH = 0xF000,
         HTTP_UPLOAD,
@@ -0,0 +1,125 @@
+#include "upload.h"
+#include "hub/fs.h"
+#include "utils/files.h"
+#include "utils/crc32.h"
+
+#if GHC_FS != GHC_FS_NONE
+
+bool gyverhub::Upload::open(const char* path, const char* crc) {
+    abort();
+    check = crc && *crc;
+    if (check) {
+        char* end;
+        expect = strtoul(crc, &end, 16);
+        if (end - crc != 8 || *end) return false;
+    }
+
+    this->path = path;
+    mkdirRecursive(path);
+    file = GHI_FS.open(_temp().c_str(), "w");
+    if (!file) {
+        this->path = String();
+        return false;
+    }
+    error = false;
+    fill = 0;
+    this->crc = 0;
+    // нет памяти - пишем без буфера
+    if (GHC_UPLOAD_BUFFER) buf = (uint8_t*)malloc(GHC_UPLOAD_BUFFER);
+    return true;
+}
+
+bool gyverhub::Upload::write(const uint8_t* data, size_t len) {
+    if (!file || error) return false;
+    if (check) crc = crc32(data, len, crc);
+    if (!buf) {
+        error = file.write(data, len) != len;
+        return !error;
+    }
+
+#if GHC_UPLOAD_BUFFER
+    while (len) {
+        // буфер пуст и данных на целые страницы - мимо буфера, граница сохраняется
+        if (!fill && len >= GHC_UPLOAD_BUFFER) {
+            size_t n = len - len % GHC_UPLOAD_BUFFER;
+            if (file.write(data, n) != n) {
+                error = true;
+                return false;
+            }
+            data += n;
+            len -= n;
+            continue;
+        }
+        size_t n = GHC_UPLOAD_BUFFER - fill;
+        if (n > len) n = len;
+        memcpy(buf + fill, data, n);
+        fill += n;
+        data += n;
+        len -= n;
+        if (fill == GHC_UPLOAD_BUFFER && !flush()) return false;
+    }
+#endif
+    return true;
+}
+
+bool gyverhub::Upload::flush() {
+    if (!file || error) return false;
+    if (fill && file.write(buf, fill) != fill) error = true;
+    fill = 0;
+    return !error;
+}
+
+bool gyverhub::Upload::close() {
+    if (!file) return false;
+    if (!flush() || (check && crc != expect)) {
+        abort();
+        return false;
+    }
+    _close();
+
+    // LittleFS заменяет файл атомарно, SPIFFS - только если старого нет: он откладывается
+    // в path.old и возвращается, если переименовать не вышло
+    String temp = _temp();
+    bool ok = GHI_FS.rename(temp.c_str(), path.c_str());
+    if (!ok && GHI_FS.exists(path.c_str())) {
+        String old(path);
+        old += F(".old");
+        GHI_FS.remove(old.c_str());
+        if (GHI_FS.rename(path.c_str(), old.c_str())) {
+            ok = GHI_FS.rename(temp.c_str(), path.c_str());
+            if (ok) GHI_FS.remove(old.c_str());
+            else GHI_FS.rename(old.c_str(), path.c_str());
+        }
+    }
+    // close() бывает и в задаче HTTP сервера - индекс обновится в tick().
+    // Не вышло - старый файл на месте, path.part остаётся для повтора
+    fsIndex().post(path.c_str());
+    if (!ok) fsIndex().post(temp.c_str());
+    path = String();
+    return ok;
+}
+
+void gyverhub::Upload::abort() {
+    if (!file) return;
+    _close();
+    String temp = _temp();
+    GHI_FS.remove(temp.c_str());
+    // индекс мог успеть увидеть временный файл
+    fsIndex().post(temp.c_str());
+    path = String();
+}
+
+String gyverhub::Upload::_temp() {
+    String temp(path);
+    temp += F(".part");
+    return temp;
+}
+
+void gyverhub::Upload::_close() {
+    file.close();
+    free(buf);
+    buf = nullptr;
+    fill = 0;
+}
+
+#endif
@@ -0,0 +1,53 @@
+#pragma once
+#include "macro.hpp"
+
+#if GHC_FS != GHC_FS_NONE
+
+namespace gyverhub {
+    // Загружаемый файл. Пишется во временный path.part и заменяет path только целиком
+    // (переименованием) и с верным CRC32, прерванная загрузка старый файл не портит.
+    // Данные копятся в буфере GHC_UPLOAD_BUFFER байт и уходят в ФС целыми страницами
+    // с начала файла, мелкие куски (чанки по 200 байт, пакеты HTTP) не пишутся по одному
+    class Upload {
+    public:
+        ~Upload() {
+            abort();
+        }
+
+        // начать загрузку в path (папки на пути создаются), прошлая отменяется.
+        // crc - ожидаемый CRC32 файла, 8 hex-символов, nullptr или "" - не проверять
+        bool open(const char* path, const char* crc = nullptr);
+
+        // false - ошибка записи, файл стоит закрыть
+        bool write(const uint8_t* data, size_t len);
+
+        // записать буфер, дальнейшие записи уже не по границе страниц
+        bool flush();
+
+        // дописать буфер, проверить CRC и заменить файл. false - ошибка записи или CRC,
+        // файл не изменён. Если не удалось только заменить, загруженное остаётся в path.part
+        bool close();
+
+        // отменить загрузку, временный файл удаляется
+        void abort();
+
+        explicit operator bool() {
+            return (bool)file;
+        }
+
+    private:
+        File file;
+        String path;
+        uint8_t* buf = nullptr;
+        size_t fill = 0;
+        uint32_t crc = 0;
+        uint32_t expect = 0;
+        bool check = false;
+        bool error = false;
+
+        String _temp();
+        void _close();
+    };
+}
+
+#endif
@@ -12,7 +12,10 @@
 #include "hub/types.h"
 #include "hub/portal.h"
 #include "utils/mime.h"
+#include "hub/fs.h"
+#include "hub/upload.h"
 #include "utils/files.h"
+#include "utils/http.h"
 #include <ESPAsyncWebServer.h>
 
 #ifndef GH_NO_HTTP_OTA
@@ -72,24 +75,20 @@ class HubHTTP {
             "/upload", HTTP_POST, [this](AsyncWebServerRequest* request) { request->send(200, F("text/plain"), F("OK")); },
             [this](AsyncWebServerRequest* request, String filename, size_t index, uint8_t* data, size_t len, bool final) {
                 if (!index) {
-                    gyverhub::mkdirRecursive(filename.c_str());
-                    file = GHI_FS.open(filename, "w");
-                    if (!file) {
+                    AsyncWebParameter* crc = request->getParam("crc32");
+                    if (!file.open(filename.c_str(), crc ? crc->value().c_str() : nullptr)) {
                         AsyncWebServerResponse* resp = request->beginResponse(500, F("text/plain"), F("FAIL"));
                         request->send(resp);
                     }
                 }
-                if (len) {
-                    if (file) {
-                        size_t bytesWritten = file.write(data, len);
-                        if (bytesWritten != len) {
-                            AsyncWebServerResponse* resp = request->beginResponse(500, F("text/plain"), F("FAIL"));
-                            request->send(resp);
-                        }
-                    }
+                if (len && file && !file.write(data, len)) {
+                    file.abort();
+                    AsyncWebServerResponse* resp = request->beginResponse(500, F("text/plain"), F("FAIL"));
+                    request->send(resp);
                 }
-                if (final) {
-                    if (file) file.close();
+                if (final && file && !file.close()) {
+                    AsyncWebServerResponse* resp = request->beginResponse(500, F("text/plain"), F("FAIL"));
+                    request->send(resp);
                 }
             });
 #endif
@@ -166,22 +165,13 @@ class HubHTTP {
         });
 #elif GHC_PORTAL == GHC_PORTAL_BUILTIN
         server.on("/", HTTP_GET, [this](AsyncWebServerRequest* request) {
-            AsyncWebServerResponse* response = request->beginResponse_P(200, "text/html", gyverhub::portal::index, gyverhub::portal::index_size);
-            gzip_h(response);
-            cache_h(response);
-            request->send(response);
+            _portalBuiltin(request, gyverhub::portal::index_asset);
         });
         server.on("/script.js", HTTP_GET, [this](AsyncWebServerRequest* request) {
-            AsyncWebServerResponse* response = request->beginResponse_P(200, "text/javascript", gyverhub::portal::script, gyverhub::portal::script_size);
-            gzip_h(response);
-            cache_h(response);
-            request->send(response);
+            _portalBuiltin(request, gyverhub::portal::script_asset);
         });
         server.on("/style.css", HTTP_GET, [this](AsyncWebServerRequest* request) {
-            AsyncWebServerResponse* response = request->beginResponse_P(200, "text/css", gyverhub::portal::style, gyverhub::portal::style_size);
-            gzip_h(response);
-            cache_h(response);
-            request->send(response);
+            _portalBuiltin(request, gyverhub::portal::style_asset);
         });
 #endif
 
@@ -239,7 +229,25 @@ class HubHTTP {
     void cache_h(AsyncWebServerResponse* response) {
         response->addHeader(F("Cache-Control"), F(GHC_PORTAL_CACHE));
     }
-    File file;
+
+#if GHC_PORTAL == GHC_PORTAL_BUILTIN
+    // brotli или gzip по Accept-Encoding. ETag - CRC32 сжатого файла, посчитан при сборке
+    void _portalBuiltin(AsyncWebServerRequest* request, const gyverhub::portal::Asset& asset) {
+        const gyverhub::portal::Encoded& enc = asset.select(request->hasHeader("Accept-Encoding") ? request->header("Accept-Encoding").c_str() : nullptr);
+        AsyncWebServerResponse* response;
+        if (request->hasHeader("If-None-Match") && gyverhub::etagMatch(request->header("If-None-Match").c_str(), enc.etag)) {
+            response = request->beginResponse(304);
+        } else {
+            response = request->beginResponse_P(200, asset.mime, enc.data, enc.size);
+            response->addHeader(F("Content-Encoding"), enc.encoding);
+        }
+        response->addHeader(F("Vary"), F("Accept-Encoding"));
+        response->addHeader(F("ETag"), enc.etag);
+        cache_h(response);
+        request->send(response);
+    }
+#endif
+    gyverhub::Upload file;
 
 #if GHC_DNS_SERVER
     bool dnsEnabled = false;
@@ -10,9 +10,18 @@
 #include "hub/portal.h"
 #include "utils/mime.h"
 #include "utils/files.h"
+#include "utils/http.h"
+#include "hub/fs.h"
+#include "hub/upload.h"
+#include "hub/gzip.h"
+#include "impl/http/scratch.h"
 
 #include <esp_http_server.h>
+#if __has_include(<esp_idf_version.h>)
+#include <esp_idf_version.h>
+#endif
 #include <fcntl.h>
+#include <sys/stat.h>
 
 #ifndef GH_NO_OTA
 #include <Update.h>
@@ -32,12 +41,139 @@
 #define GH_HTTP_OTA "0"
 #endif
 
-#define SCRATCH_BUFSIZE 8192
+#define GHI_PORTAL_CHUNK 4096
+
+// httpd_req_async_handler_begin появился в IDF 5.2, раньше запросы обрабатываются по одному
+#if defined(ESP_IDF_VERSION) && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 0)
+#define GHI_HTTP_ASYNC 1
+#else
+#define GHI_HTTP_ASYNC 0
+#endif
+
+// стек задачи-обработчика: буфер в пуле, на стеке только заголовки и состояние файла
+#define GHI_HTTP_WORKER_STACK 4096
 
 class HubHTTP {
+public:
+    // буферы обработчиков: scratch.active(), scratch.peak(), scratch.misses() - отказов
+    gyverhub::HttpScratch scratch;
+
 private:
     httpd_handle_t server = NULL;
-    char buffer[SCRATCH_BUFSIZE];
+
+    // обработчик запроса с буфером GHC_HTTP_BUFFER_SIZE байт из scratch
+    typedef esp_err_t (*Work)(httpd_req_t *req, char *buf);
+
+    // запрос с буфером: сразу или в задаче-обработчике, если httpd умеет асинхронные запросы.
+    // Нет свободного буфера - 503, клиент повторит позже
+    esp_err_t dispatch(httpd_req_t *req, Work work, bool async = true) {
+        char *buf = scratch.take();
+        if (!buf) {
+            GHI_DEBUG_LOG("HTTP busy");
+            esp_err_t res = httpd_resp_set_status(req, "503 Service Unavailable");
+            if (res == ESP_OK) res = httpd_resp_set_hdr(req, "Retry-After", "1");
+            if (res == ESP_OK) res = httpd_resp_send(req, NULL, 0);
+            return res;
+        }
+#if GHI_HTTP_ASYNC
+        // копия запроса живёт до httpd_req_async_handler_complete, сервер тем временем принимает следующие
+        Job job = {nullptr, work, buf};
+        if (async && queue && httpd_req_async_handler_begin(req, &job.req) == ESP_OK) {
+            if (xQueueSend(queue, &job, 0) == pdTRUE) return ESP_OK;
+            httpd_req_async_handler_complete(job.req);
+        }
+#else
+        (void) async;
+#endif
+        esp_err_t res = work(req, buf);
+        scratch.give(buf);
+        return res;
+    }
+
+#if GHI_HTTP_ASYNC
+    struct Job {
+        httpd_req_t *req;   // nullptr - задаче завершиться
+        Work work;
+        char *buf;
+    };
+
+    // задач столько же, сколько буферов: взятый буфер - это место в очереди или занятая задача.
+    // Состояние хаба задачи не трогают: о загруженном файле узнаёт tick() через fsIndex().post()
+    QueueHandle_t queue = nullptr;
+
+    static void worker(void *arg) {
+        HubHTTP *self = (HubHTTP*) arg;
+        Job job;
+        while (xQueueReceive(self->queue, &job, portMAX_DELAY) == pdTRUE && job.req) {
+            job.work(job.req, job.buf);
+            httpd_req_async_handler_complete(job.req);
+            self->scratch.give(job.buf);
+        }
+        vTaskDelete(NULL);
+    }
+#endif
+
+    // httpd хранит указатели на значения заголовков до отправки ответа - буферы живут в обработчике
+    struct Validators {
+        char etag[GHI_ETAG_LEN];
+        char range[40];
+        uint32_t from;
+        uint32_t len;
+    };
+
+    static bool getHeader(httpd_req_t *req, const char *name, char *buf, size_t size) {
+        // длинный заголовок обрезается, начало всё равно проверим
+        esp_err_t res = httpd_req_get_hdr_value_str(req, name, buf, size);
+        return res == ESP_OK || res == ESP_ERR_HTTPD_RESULT_TRUNC;
+    }
+
+    // ETag, If-None-Match -> 304, Range -> 206/416. true - ответ уже отправлен, его результат в res.
+    // Иначе отдать v.len байт с v.from
+    static bool validate(httpd_req_t *req, Validators &v, uint32_t size, uint32_t mtime, bool gzip, esp_err_t &res) {
+        gyverhub::makeEtag(v.etag, size, mtime, gzip);
+        v.from = 0;
+        v.len = size;
+        res = httpd_resp_set_hdr(req, "ETag", v.etag);
+        if (res != ESP_OK) return true;
+
+        char hdr[96];
+        if (getHeader(req, "If-None-Match", hdr, sizeof(hdr)) && gyverhub::etagMatch(hdr, v.etag)) {
+            res = httpd_resp_set_status(req, "304 Not Modified");
+            if (res == ESP_OK) res = httpd_resp_send(req, NULL, 0);
+            return true;
+        }
+
+        // Range считается по исходным байтам, у сжатого на лету ответа его нет
+        if (gzip) return false;
+        res = httpd_resp_set_hdr(req, "Accept-Ranges", "bytes");
+        if (res != ESP_OK) return true;
+        if (!getHeader(req, "Range", hdr, sizeof(hdr))) return false;
+
+        // If-Range с другим ETag - файл изменился, отдаём целиком
+        char ifr[GHI_ETAG_LEN + 4];
+        if (getHeader(req, "If-Range", ifr, sizeof(ifr)) && strcmp(ifr, v.etag)) return false;
+
+        uint32_t to;
+        switch (gyverhub::parseRange(hdr, size, v.from, to)) {
+            case gyverhub::Range::Partial:
+                v.len = to - v.from + 1;
+                snprintf(v.range, sizeof(v.range), "bytes %lu-%lu/%lu", (unsigned long) v.from, (unsigned long) to, (unsigned long) size);
+                res = httpd_resp_set_status(req, "206 Partial Content");
+                if (res == ESP_OK) res = httpd_resp_set_hdr(req, "Content-Range", v.range);
+                return res != ESP_OK;
+
+            case gyverhub::Range::Invalid:
+                snprintf(v.range, sizeof(v.range), "bytes */%lu", (unsigned long) size);
+                res = httpd_resp_set_status(req, "416 Range Not Satisfiable");
+                if (res == ESP_OK) res = httpd_resp_set_hdr(req, "Content-Range", v.range);
+                if (res == ESP_OK) res = httpd_resp_send(req, NULL, 0);
+                return true;
+
+            default:
+                v.from = 0;
+                return false;
+        }
+    }
 
     static esp_err_t setCorsHeaders(httpd_req_t *req) {
         esp_err_t res = httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
@@ -60,32 +196,77 @@ private:
         return httpd_resp_sendstr(req, (const char *) req->user_ctx);
     }
 
+#if GHC_PORTAL == GHC_PORTAL_BUILTIN
+    // httpd_send может отправить не всё - досылаем частями прямо из flash
+    static esp_err_t sendRaw(httpd_req_t *req, const char *data, size_t len) {
+        while (len) {
+            int sent = httpd_send(req, data, len < GHI_PORTAL_CHUNK ? len : GHI_PORTAL_CHUNK);
+            if (sent == HTTPD_SOCK_ERR_TIMEOUT) continue;
+            if (sent <= 0) return ESP_FAIL;
+            data += sent;
+            len -= sent;
+        }
+        return ESP_OK;
+    }
+
     static esp_err_t handlerSendBinData(httpd_req_t *req) {
-        String *data = (String*) req->user_ctx;
-        
-        esp_err_t res = setCorsHeaders(req);
-        if (res != ESP_OK) return res;
+        const gyverhub::portal::Asset *asset = (const gyverhub::portal::Asset*) req->user_ctx;
 
-        res = httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-        if (res != ESP_OK) return res;
+        // brotli или gzip по Accept-Encoding
+        char hdr[96];
+        const gyverhub::portal::Encoded &enc = asset->select(getHeader(req, "Accept-Encoding", hdr, sizeof(hdr)) ? hdr : nullptr);
 
-        res = httpd_resp_set_hdr(req, "Cache-Control", GHC_PORTAL_CACHE);
-        if (res != ESP_OK) return res;
+        if (getHeader(req, "If-None-Match", hdr, sizeof(hdr)) && gyverhub::etagMatch(hdr, enc.etag)) {
+            esp_err_t res = setCorsHeaders(req);
+            if (res != ESP_OK) return res;
 
-        const char *p = strrchr(req->uri, '?');
-        size_t length = p ? p - req->uri : strlen(req->uri);
+            res = httpd_resp_set_hdr(req, "Cache-Control", GHC_PORTAL_CACHE);
+            if (res != ESP_OK) return res;
 
-        res = httpd_resp_set_type(req, gyverhub::getMimeByPath(req->uri, length));
-        if (res != ESP_OK) return res;
+            res = httpd_resp_set_hdr(req, "ETag", enc.etag);
+            if (res != ESP_OK) return res;
+
+            res = httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+            if (res != ESP_OK) return res;
 
-        return httpd_resp_send(req, data->c_str(), data->length());
+            res = httpd_resp_set_status(req, "304 Not Modified");
+            if (res != ESP_OK) return res;
+            return httpd_resp_send(req, NULL, 0);
+        }
+
+        // заголовок собран при сборке, в куче ничего не копируется
+        esp_err_t res = sendRaw(req, enc.head, strlen(enc.head));
+        if (res != ESP_OK) return res;
+        return sendRaw(req, (const char*) enc.data, enc.size);
     }
+#endif
+
+#if GHC_PORTAL == GHC_PORTAL_FS
+    struct PortalFile {
+        HubHTTP *self;
+        const char *path;
+    };
+    PortalFile portalFiles[3] = {
+        {this, "/hub/index.html.gz"},
+        {this, "/hub/script.js.gz"},
+        {this, "/hub/style.css.gz"},
+    };
 
     static esp_err_t handlerSendFile(httpd_req_t *req) {
-        const char *name = (const char*) req->user_ctx;
+        return ((PortalFile*) req->user_ctx)->self->dispatch(req, workSendFile);
+    }
+
+    static esp_err_t workSendFile(httpd_req_t *req, char *buf) {
+        const char *name = ((PortalFile*) req->user_ctx)->path;
 
         int fd = open(name, O_RDONLY);
         // File file = GHI_FS.open(name);
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st) != 0) {
+            if (fd >= 0) close(fd);
+            httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "File not found");
+            return ESP_FAIL;
+        }
 
         esp_err_t res = setCorsHeaders(req);
         if (res != ESP_OK) return res;
@@ -102,16 +283,23 @@ private:
             if (res != ESP_OK) return res;
         }
 
-        char *buf = (char*)malloc(SCRATCH_BUFSIZE);
+        Validators v;
+        if (validate(req, v, st.st_size, st.st_mtime, false, res)) {
+            close(fd);
+            return res;
+        }
+        if (v.from) lseek(fd, v.from, SEEK_SET);
+
         size_t chunksize;
         do {
-            chunksize = read(fd, buf, SCRATCH_BUFSIZE);
-            // chunksize = file.read((uint8_t*) buf, SCRATCH_BUFSIZE);
+            ssize_t n = v.len ? read(fd, buf, min(v.len, (uint32_t) GHC_HTTP_BUFFER_SIZE)) : 0;
+            chunksize = n > 0 ? n : 0;
+            // chunksize = file.read((uint8_t*) buf, GHC_HTTP_BUFFER_SIZE);
 
             if (chunksize > 0) {
+                v.len -= chunksize;
                 if (httpd_resp_send_chunk(req, buf, chunksize) != ESP_OK) {
                     close(fd);
-                    free(buf);
                     // file.close();
                     
                     httpd_resp_sendstr_chunk(req, NULL);
@@ -122,14 +310,24 @@ private:
         } while (chunksize != 0);
 
         close(fd);
-        free(buf);
         // file.close();
         return httpd_resp_send_chunk(req, NULL, 0);
     }
+#endif
+
+#if GHC_GZIP_WINDOW
+    static bool acceptsGzip(httpd_req_t *req) {
+        char buf[64];
+        // Range считается по исходным байтам, такой запрос не сжимаем
+        return getHeader(req, "Accept-Encoding", buf, sizeof(buf)) && gyverhub::acceptsEncoding(buf, "gzip") && !httpd_req_get_hdr_value_len(req, "Range");
+    }
+#endif
 
     static esp_err_t handlerDownload(httpd_req_t *req) {
-        HubHTTP *self = (HubHTTP*) req->user_ctx;
+        return ((HubHTTP*) req->user_ctx)->dispatch(req, workDownload);
+    }
 
+    static esp_err_t workDownload(httpd_req_t *req, char *buf) {
         File file = GHI_FS.open(req->uri);  // TODO: uri
         if (!file) {
             httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "File not found");
@@ -142,19 +340,47 @@ private:
         res = httpd_resp_set_type(req, gyverhub::getMimeByPath(file.path(), strlen(file.path())));
         if (res != ESP_OK) return res;
 
-        {
-            char buf[16];
-            sprintf(buf, "%d", file.size());
-            res = httpd_resp_set_hdr(req, "Content-Length", buf);
+        uint32_t size = file.size();
+        Validators v;
+#if GHC_GZIP_WINDOW
+        // текстовые файлы - сжатыми, если браузер принимает gzip
+        gyverhub::Gzip zip;
+        if (gyverhub::Gzip::worth(file.path(), size) && acceptsGzip(req)) zip.begin(file);
+        if (validate(req, v, size, file.getLastWrite(), zip.active(), res)) return res;
+
+        if (zip.active()) {
+            res = httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
             if (res != ESP_OK) return res;
+
+            size_t len;
+            while ((len = zip.read((uint8_t*) buf, GHC_HTTP_BUFFER_SIZE))) {
+                if (httpd_resp_send_chunk(req, buf, len) != ESP_OK) {
+                    httpd_resp_sendstr_chunk(req, NULL);
+                    httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to send file");
+                    return ESP_FAIL;
+                }
+            }
+            return httpd_resp_send_chunk(req, NULL, 0);
+        }
+#else
+        if (validate(req, v, size, file.getLastWrite(), false, res)) return res;
+#endif
+
+        char length[16];
+        sprintf(length, "%lu", (unsigned long) v.len);
+        res = httpd_resp_set_hdr(req, "Content-Length", length);
+        if (res != ESP_OK) return res;
+        if (v.from && !file.seek(v.from)) {
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to send file");
+            return ESP_FAIL;
         }
 
-        char *buf = self->buffer;
         size_t chunksize;
         do {
-            chunksize = file.read((uint8_t*) buf, SCRATCH_BUFSIZE);
+            chunksize = v.len ? file.read((uint8_t*) buf, min(v.len, (uint32_t) GHC_HTTP_BUFFER_SIZE)) : 0;
 
             if (chunksize > 0) {
+                v.len -= chunksize;
                 if (httpd_resp_send_chunk(req, buf, chunksize) != ESP_OK) {
                     file.close();
                     
@@ -170,8 +396,10 @@ private:
     }
 
     static esp_err_t handlerUpload(httpd_req_t *req) {
-        HubHTTP *self = (HubHTTP*) req->user_ctx;
+        return ((HubHTTP*) req->user_ctx)->dispatch(req, workUpload);
+    }
 
+    static esp_err_t workUpload(httpd_req_t *req, char *buf) {
         size_t buf_size = httpd_req_get_url_query_len(req) + 1;
         char *filename = (char*) malloc(buf_size);
         filename[buf_size-1] = '\0';
@@ -181,37 +409,35 @@ private:
             httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing query string");
             return res;
         }
-        Serial.println(filename);
+        GHI_DEBUG_LOG("HTTP upload %s", filename);
 
-        gyverhub::mkdirRecursive(filename);
-        File file = GHI_FS.open(filename, "w");
-        if (!file) {
+        // пакеты TCP - по ~1.4 КБ, в ФС уходят страницами через буфер Upload.
+        // close() и abort() только ставят путь в очередь индекса, применит его loop
+        gyverhub::Upload file;
+        if (!file.open(filename)) {
             free(filename);
             httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to create file");
             return ESP_FAIL;
         }
 
-        char *buf = self->buffer;
         int remaining = req->content_len;
         int received;
 
         while (remaining > 0) {
-            if ((received = httpd_req_recv(req, buf, min(remaining, SCRATCH_BUFSIZE))) <= 0) {
+            if ((received = httpd_req_recv(req, buf, min(remaining, GHC_HTTP_BUFFER_SIZE))) <= 0) {
                 if (received == HTTPD_SOCK_ERR_TIMEOUT) {
                     continue;
                 }
 
-                file.close();
-                GHI_FS.remove(filename);
+                file.abort();
                 free(filename);
 
                 httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to receive file");
                 return ESP_FAIL;
             }
 
-            if (received && (received != file.write((uint8_t*) buf, received))) {
-                file.close();
-                GHI_FS.remove(filename);
+            if (received && !file.write((uint8_t*) buf, received)) {
+                file.abort();
                 free(filename);
 
                 httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to write file to storage");
@@ -221,7 +447,12 @@ private:
             remaining -= received;
         }
 
-        file.close();
+        if (!file.close()) {
+            free(filename);
+
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to write file to storage");
+            return ESP_FAIL;
+        }
         free(filename);
         
         res = setCorsHeaders(req);
@@ -233,7 +464,12 @@ private:
         return httpd_resp_sendstr(req, "OK");
     }
 
+    // Update один на всю прошивку - обновление в задаче сервера, второе ждёт первое
     static esp_err_t handlerOta(httpd_req_t *req) {
+        return ((HubHTTP*) req->user_ctx)->dispatch(req, workOta, false);
+    }
+
+    static esp_err_t workOta(httpd_req_t *req, char *buf) {
         HubHTTP *self = (HubHTTP*) req->user_ctx;
 
         int ota_type = 0;
@@ -241,22 +477,22 @@ private:
 
         {
             size_t buf_size = httpd_req_get_url_query_len(req) + 1;
-            char *buf = (char*) malloc(buf_size);
-            buf[buf_size-1] = '\0';
-            esp_err_t res = httpd_req_get_url_query_str(req, buf, buf_size);
+            char *query = (char*) malloc(buf_size);
+            query[buf_size-1] = '\0';
+            esp_err_t res = httpd_req_get_url_query_str(req, query, buf_size);
             if (res != ESP_OK) {
-                free(buf);
+                free(query);
                 httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing query string");
                 return res;
             }
 
-            res = httpd_query_key_value(buf, "type", type, sizeof(type));
+            res = httpd_query_key_value(query, "type", type, sizeof(type));
             if (res != ESP_OK) {
-                free(buf);
+                free(query);
                 httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing type field");
                 return res;
             }
-            free(buf);
+            free(query);
         }
 
         if (strncmp(type, "flash", sizeof(type)) == 0) ota_type = 1;
@@ -287,12 +523,11 @@ private:
             Update.begin(ota_size, ota_type);
         }
 
-        char *buf = self->buffer;
         int remaining = req->content_len;
         int received;
 
         while (remaining > 0) {
-            if ((received = httpd_req_recv(req, buf, min(remaining, SCRATCH_BUFSIZE))) <= 0) {
+            if ((received = httpd_req_recv(req, buf, min(remaining, GHC_HTTP_BUFFER_SIZE))) <= 0) {
                 if (received == HTTPD_SOCK_ERR_TIMEOUT) {
                     continue;
                 }
@@ -351,6 +586,13 @@ protected:
             abort();
         }
 
+#if GHI_HTTP_ASYNC
+        queue = xQueueCreate(GHC_HTTP_BUFFERS, sizeof(Job));
+        for (uint8_t i = 0; i < GHC_HTTP_BUFFERS; i++) {
+            xTaskCreate(worker, "gh_http", GHI_HTTP_WORKER_STACK, this, config.task_priority, NULL);
+        }
+#endif
+
         GH__SETH(HTTP_GET, "/hub_discover_all", HubHTTP::handlerSendString, "OK");
         
 
@@ -374,14 +616,14 @@ protected:
 
 #if GHC_PORTAL == GHC_PORTAL_FS
         GH__SETH(HTTP_GET, "/favicon.svg", HubHTTP::handlerSendString, "");
-        GH__SETH(HTTP_GET, "/", HubHTTP::handlerSendFile, "/hub/index.html.gz");
-        GH__SETH(HTTP_GET, "/script.js", HubHTTP::handlerSendFile, "/hub/script.js.gz");
-        GH__SETH(HTTP_GET, "/style.css", HubHTTP::handlerSendFile, "/hub/style.css.gz");
+        GH__SETH(HTTP_GET, "/", HubHTTP::handlerSendFile, &portalFiles[0]);
+        GH__SETH(HTTP_GET, "/script.js", HubHTTP::handlerSendFile, &portalFiles[1]);
+        GH__SETH(HTTP_GET, "/style.css", HubHTTP::handlerSendFile, &portalFiles[2]);
 #elif GHC_PORTAL == GHC_PORTAL_BUILTIN
         GH__SETH(HTTP_GET, "/favicon.svg", HubHTTP::handlerSendString, "");
-        GH__SETH(HTTP_GET, "/", HubHTTP::handlerSendBinData, new String(gyverhub::portal::index, gyverhub::portal::index_size));
-        GH__SETH(HTTP_GET, "/script.js", HubHTTP::handlerSendBinData, new String(gyverhub::portal::script, gyverhub::portal::script_size));
-        GH__SETH(HTTP_GET, "/style.css", HubHTTP::handlerSendBinData, new String(gyverhub::portal::style, gyverhub::portal::style_size));
+        GH__SETH(HTTP_GET, "/", HubHTTP::handlerSendBinData, &gyverhub::portal::index_asset);
+        GH__SETH(HTTP_GET, "/script.js", HubHTTP::handlerSendBinData, &gyverhub::portal::script_asset);
+        GH__SETH(HTTP_GET, "/style.css", HubHTTP::handlerSendBinData, &gyverhub::portal::style_asset);
 #endif
 
 
@@ -393,6 +635,14 @@ protected:
     }
     
     void endHTTP() {
+#if GHI_HTTP_ASYNC
+        // задачи доделывают начатые запросы и завершаются
+        Job stop = {nullptr, nullptr, nullptr};
+        for (uint8_t i = 0; i < GHC_HTTP_BUFFERS; i++) xQueueSend(queue, &stop, portMAX_DELAY);
+        while (uxQueueMessagesWaiting(queue) || scratch.active()) vTaskDelay(1);
+        vQueueDelete(queue);
+        queue = nullptr;
+#endif
         httpd_stop(server);
         server = nullptr;
     }
@@ -0,0 +1,64 @@
+#pragma once
+#ifndef GHI_IMPL_SELECT
+# error Never include implementation-specific files directly, use "impl/impl_select.h"
+#endif
+#include "macro.hpp"
+
+static_assert(GHC_HTTP_BUFFERS >= 1 && GHC_HTTP_BUFFERS <= 16, "GHC_HTTP_BUFFERS: 1..16");
+
+namespace gyverhub {
+    // Буферы обработчиков нативного HTTP сервера. Запрос берёт буфер на всё время обработки,
+    // одновременно обрабатывается столько запросов с файлами, сколько буферов. Берутся
+    // из задачи сервера и отдаются из задач-обработчиков, поэтому под блокировкой
+    class HttpScratch {
+    public:
+        // свободный буфер GHC_HTTP_BUFFER_SIZE байт или nullptr, если все заняты
+        char *take() {
+            char *buf = nullptr;
+            portENTER_CRITICAL(&lock);
+            for (uint8_t i = 0; i < GHC_HTTP_BUFFERS; i++) {
+                if (used & (1 << i)) continue;
+                used |= 1 << i;
+                buf = bufs[i];
+                if (++busy > top) top = busy;
+                break;
+            }
+            if (!buf) missed++;
+            portEXIT_CRITICAL(&lock);
+            return buf;
+        }
+
+        void give(char *buf) {
+            uint8_t i = (buf - bufs[0]) / GHC_HTTP_BUFFER_SIZE;
+            portENTER_CRITICAL(&lock);
+            if (used & (1 << i)) {
+                used &= ~(1 << i);
+                busy--;
+            }
+            portEXIT_CRITICAL(&lock);
+        }
+
+        // занято сейчас
+        uint8_t active() {
+            return busy;
+        }
+
+        // занято одновременно за всё время
+        uint8_t peak() {
+            return top;
+        }
+
+        // запросов, получивших отказ: все буферы были заняты
+        uint32_t misses() {
+            return missed;
+        }
+
+    private:
+        char bufs[GHC_HTTP_BUFFERS][GHC_HTTP_BUFFER_SIZE];
+        uint16_t used = 0;
+        uint8_t busy = 0;
+        uint8_t top = 0;
+        uint32_t missed = 0;
+        portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    };
+}
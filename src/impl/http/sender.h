@@ -0,0 +1,284 @@
+#pragma once
+#ifndef GHI_IMPL_SELECT
+# error Never include implementation-specific files directly, use "impl/impl_select.h"
+#endif
+#include "macro.hpp"
+#include "hub/gzip.h"
+
+#ifdef ESP8266
+#include <ESP8266WiFi.h>
+#include <lwip/opt.h>
+#else
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#endif
+
+// байт за одну запись в сокет: сегмент TCP, в свободный буфер отправки влезает без ожидания
+#define GHI_HTTP_SEGMENT 1436
+
+namespace gyverhub {
+    // Отдача ответов HTTP в фоне. Сервер только принимает запрос, заголовок и тело досылаются
+    // из tick() порциями: не больше GHC_HTTP_TICK_BYTES байт и GHC_HTTP_TICK_MS мс за вызов на все
+    // отдачи (до GHC_HTTP_STREAMS) по очереди, в сокет пишется только то, что влезает без ожидания.
+    // Клиент, который не принимает данные GHC_HTTP_STALL_MS мс, отключается и считается в stalls()
+    class HttpSender {
+    public:
+        ~HttpSender() {
+            end();
+        }
+
+        // head - заголовок ответа целиком, тело - len байт файла с текущей позиции.
+        // wait или нет свободного слота - отправляется сразу, с ожиданием. Соединение
+        // закрывается по окончании, client можно отпускать
+#if GHC_FS != GHC_FS_NONE
+        void file(const WiFiClient &client, const String &head, File &f, uint32_t len, bool wait = false) {
+            Job &j = _start(client, head, wait);
+            j.file = f;
+            j.left = len;
+            _run(j);
+        }
+
+#if GHC_GZIP_WINDOW
+        // тело - сжатый файл (zip после begin(), удаляется по окончании), chunked
+        void gzip(const WiFiClient &client, const String &head, Gzip *zip, bool wait = false) {
+            Job &j = _start(client, head, wait);
+            j.zip = zip;
+            _run(j);
+        }
+#endif
+#endif
+
+        // тело - данные в RAM или PROGMEM, в фоне должны жить до конца отдачи
+        void bytes(const WiFiClient &client, const String &head, const uint8_t *data, uint32_t len, bool pgm, bool wait = false) {
+            Job &j = _start(client, head, wait);
+            j.data = data;
+            j.left = len;
+            j.pgm = pgm;
+            _run(j);
+        }
+
+        void tick() {
+            uint32_t start = millis();
+            uint32_t sent = 0;
+            bool progress = true;
+            // по сегменту каждой отдаче за круг, пока есть бюджет и кто-то может писать
+            while (progress && sent < GHC_HTTP_TICK_BYTES && millis() - start < GHC_HTTP_TICK_MS) {
+                progress = false;
+                for (Job &j : jobs) {
+                    if (!j.busy) continue;
+                    size_t n = _poll(j);
+                    if (n) {
+                        progress = true;
+                        sent += n;
+                    }
+                }
+            }
+        }
+
+        // идущих отдач
+        uint8_t active() {
+            uint8_t n = 0;
+            for (Job &j : jobs) n += j.busy;
+            return n;
+        }
+
+        // прервано из-за клиента, не принимавшего данные
+        uint32_t stalls() {
+            return stalled;
+        }
+
+        void end() {
+            for (Job &j : jobs) {
+                if (j.busy) _close(j, false);
+            }
+        }
+
+    private:
+        struct Job {
+            WiFiClient client;
+            String head;            // заголовок, отправлено headPos байт
+            uint16_t headPos = 0;
+#if GHC_FS != GHC_FS_NONE
+            File file;
+#if GHC_GZIP_WINDOW
+            Gzip *zip = nullptr;
+#endif
+#endif
+            const uint8_t *data = nullptr;
+            uint32_t left = 0;      // байт тела (кроме gzip)
+            uint32_t idle = 0;      // millis() последней записи
+            bool pgm = false;
+            bool done = false;      // тело отправлено, ждём ухода данных из буфера
+            bool busy = false;
+        };
+
+        Job jobs[GHC_HTTP_STREAMS];
+        Job now;                // отдача с ожиданием
+        uint8_t buf[GHI_HTTP_SEGMENT + 8];
+        uint32_t stalled = 0;
+
+        Job &_start(const WiFiClient &client, const String &head, bool wait) {
+            Job *j = &now;
+            if (!wait) {
+                for (Job &f : jobs) {
+                    if (!f.busy) {
+                        j = &f;
+                        break;
+                    }
+                }
+            }
+            j->client = client;
+#ifdef ESP8266
+            // без ожидания ACK после каждой записи
+            j->client.setSync(false);
+#endif
+            j->head = head;
+            j->headPos = 0;
+            j->data = nullptr;
+            j->left = 0;
+            j->pgm = false;
+            j->done = false;
+            j->idle = millis();
+            j->busy = true;
+            return *j;
+        }
+
+        // отдача с ожиданием - до конца здесь же, остальные - в tick()
+        void _run(Job &j) {
+            if (&j != &now) return;
+            while (j.busy) {
+                if (!_poll(j)) delay(1);
+            }
+        }
+
+        // шаг отдачи с учётом простоя
+        size_t _poll(Job &j) {
+            size_t n = _step(j);
+            if (n) {
+                j.idle = millis();
+            } else if (j.busy && millis() - j.idle > GHC_HTTP_STALL_MS) {
+                GHI_DEBUG_LOG("HTTP stall");
+                stalled++;
+                _close(j, false);
+            }
+            return n;
+        }
+
+        // graceful - данные уже ушли, иначе соединение сбрасывается сразу
+        void _close(Job &j, bool graceful = true) {
+#ifdef ESP8266
+            // stop() ждёт отправки буфера
+            if (!graceful) j.client.abort();
+#else
+            (void) graceful;
+#endif
+            j.client.stop();
+            j.client = WiFiClient();
+            j.head = String();
+#if GHC_FS != GHC_FS_NONE
+            j.file.close();
+#if GHC_GZIP_WINDOW
+            delete j.zip;
+            j.zip = nullptr;
+#endif
+#endif
+            j.busy = false;
+        }
+
+        // сколько можно записать в сокет без ожидания
+        size_t _writable(WiFiClient &client) {
+#ifdef ESP8266
+            size_t space = client.availableForWrite();
+            return space < GHI_HTTP_SEGMENT ? space : GHI_HTTP_SEGMENT;
+#else
+            // WiFiClient::write ждёт места в буфере, select с нулевым таймаутом - нет
+            int fd = client.fd();
+            if (fd < 0) return 0;
+            fd_set set;
+            FD_ZERO(&set);
+            FD_SET(fd, &set);
+            struct timeval tv = {0, 0};
+            return select(fd + 1, NULL, &set, NULL, &tv) > 0 ? GHI_HTTP_SEGMENT : 0;
+#endif
+        }
+
+        // записать следующую порцию. Вернёт, сколько байт ушло
+        size_t _step(Job &j) {
+            if (!j.client.connected()) {
+                _close(j);
+                return 0;
+            }
+
+            if (j.done) {
+#ifdef ESP8266
+                // stop() ждёт отправки буфера - закрываем, когда он уже пуст
+                if (j.client.availableForWrite() < TCP_SND_BUF) return 0;
+#endif
+                _close(j);
+                return 0;
+            }
+
+            size_t space = _writable(j.client);
+            if (!space) return 0;
+
+            size_t len = 0;
+            const uint8_t *out = buf;
+            if (j.headPos < j.head.length()) {
+                len = j.head.length() - j.headPos;
+                if (len > space) len = space;
+                out = (const uint8_t *) j.head.c_str() + j.headPos;
+                if (j.client.write(out, len) != len) {
+                    _close(j, false);
+                    return 0;
+                }
+                j.headPos += len;
+                if (j.headPos == j.head.length()) j.head = String();
+                return len;
+            }
+
+#if GHC_FS != GHC_FS_NONE && GHC_GZIP_WINDOW
+            if (j.zip) {
+                // чанк: длина в hex, данные, \r\n. Пустой - конец
+                if (space < 16) return 0;
+                size_t n = j.zip->read(buf + 5, space - 7);
+                buf[0] = "0123456789abcdef"[(n >> 8) & 15];
+                buf[1] = "0123456789abcdef"[(n >> 4) & 15];
+                buf[2] = "0123456789abcdef"[n & 15];
+                buf[3] = '\r';
+                buf[4] = '\n';
+                buf[5 + n] = '\r';
+                buf[6 + n] = '\n';
+                len = n + 7;
+                if (!n) j.done = true;
+            } else
+#endif
+            {
+                len = j.left < space ? j.left : space;
+                if (j.data) {
+                    if (j.pgm) memcpy_P(buf, j.data, len);
+                    else out = j.data;
+                    j.data += len;
+                }
+#if GHC_FS != GHC_FS_NONE
+                else if (len) {
+                    len = j.file.read(buf, len);
+                    if (!len) {
+                        // файл короче заявленного - ответ уже не исправить
+                        _close(j, false);
+                        return 0;
+                    }
+                }
+#endif
+                j.left -= len;
+                if (!j.left) j.done = true;
+                if (!len) return 0;
+            }
+
+            if (j.client.write(out, len) != len) {
+                _close(j, false);
+                return 0;
+            }
+            return len;
+        }
+    };
+}
@@ -19,7 +19,12 @@
 #include "hub/client.h"
 #include "utils/mime.h"
 #include "utils/files.h"
+#include "utils/http.h"
 #include "hub/portal.h"
+#include "hub/fs.h"
+#include "hub/upload.h"
+#include "hub/gzip.h"
+#include "impl/http/sender.h"
 
 #ifdef ESP8266
 #include <ESP8266WebServer.h>
@@ -38,9 +43,25 @@
 #include <DNSServer.h>
 #endif
 
+namespace gyverhub {
+    // WebServer, у которого можно забрать соединение. client() на ESP32 отдаёт копию, а сервер
+    // после обработчика держит свою, пока клиент не закроет (до 2 с), и новых не принимает
+    class HttpServer : public GH_SERVER_T {
+       public:
+        HttpServer(int port) : GH_SERVER_T(port) {}
+
+        // забыть текущее соединение, сокет остаётся у других копий клиента
+        void detach() {
+            _currentClient = decltype(_currentClient)();
+        }
+    };
+}
+
 class HubHTTP {
    public:
-    GH_SERVER_T server;
+    gyverhub::HttpServer server;
+    // отдача файлов в фоне: sender.active() - идущих, sender.stalls() - прерванных
+    gyverhub::HttpSender sender;
 
     HubHTTP() : server(GHC_HTTP_PORT) {}
 
@@ -94,7 +115,7 @@ class HubHTTP {
         });
 #endif
 
-// upload /hub/upload?path=...
+// upload /hub/upload?path=...[&crc32=...]
 #if !defined(GH_NO_HTTP_UPLOAD) && GHC_FS != GHC_FS_NONE
         server.on(
             "/hub/upload", HTTP_POST, [this]() { server.send(200); }, [this]() {
@@ -110,18 +131,19 @@ class HubHTTP {
                         return;
                     }
                     GHI_DEBUG_LOG("HTTP upload");
-                    gyverhub::mkdirRecursive(path.c_str());
-                    file = GHI_FS.open(path.c_str(), "w");
-                    if (!file) server.send(500);
+                    if (!file.open(path.c_str(), server.arg(F("crc32")).c_str())) server.send(500);
 
                 } else if (upload.status == UPLOAD_FILE_WRITE) {
-                    if (file) {
-                        size_t bytesWritten = file.write(upload.buf, upload.currentSize);
-                        if (bytesWritten != upload.currentSize) server.send(500);
+                    if (file && !file.write(upload.buf, upload.currentSize)) {
+                        file.abort();
+                        server.send(500);
                     }
 
                 } else if (upload.status == UPLOAD_FILE_END) {
-                    if (file) file.close();
+                    if (file && !file.close()) server.send(500);
+
+                } else if (upload.status == UPLOAD_FILE_ABORTED) {
+                    file.abort();
                 } });
 #endif
 
@@ -183,37 +205,23 @@ class HubHTTP {
 // portal
 #if GHC_PORTAL == GHC_PORTAL_FS
         server.on("/", [this]() {
-            File f = GHI_FS.open(F("/hub/index.html.gz"), "r");
-            if (f) server.streamFile(f, F("text/html"));
-            else server.send(404);
+            _portalFile(F("/hub/index.html.gz"), "text/html", false);
         });
         server.on("/script.js", [this]() {
-            cache_h();
-            File f = GHI_FS.open(F("/hub/script.js.gz"), "r");
-            if (f) server.streamFile(f, F("text/javascript"));
-            else server.send(404);
+            _portalFile(F("/hub/script.js.gz"), "text/javascript", true);
         });
         server.on("/style.css", [this]() {
-            cache_h();
-            File f = GHI_FS.open(F("/hub/style.css.gz"), "r");
-            if (f) server.streamFile(f, F("text/css"));
-            else server.send(404);
+            _portalFile(F("/hub/style.css.gz"), "text/css", true);
         });
 #elif GHC_PORTAL == GHC_PORTAL_BUILTIN
         server.on("/", [this]() {
-            gzip_h();
-            cache_h();
-            server.send_P(200, "text/html", (PGM_P)gyverhub::portal::index, gyverhub::portal::index_size);
+            _portalBuiltin(gyverhub::portal::index_asset);
         });
         server.on("/script.js", [this]() {
-            gzip_h();
-            cache_h();
-            server.send_P(200, "text/javascript", (PGM_P)gyverhub::portal::script, gyverhub::portal::script_size);
+            _portalBuiltin(gyverhub::portal::script_asset);
         });
         server.on("/style.css", [this]() {
-            gzip_h();
-            cache_h();
-            server.send_P(200, "text/css", (PGM_P)gyverhub::portal::style, gyverhub::portal::style_size);
+            _portalBuiltin(gyverhub::portal::style_asset);
         });
 #endif
 
@@ -224,11 +232,16 @@ class HubHTTP {
         }
 #endif
 
+        // сервер хранит только заголовки из списка
+        static const char *headers[] = {"Accept-Encoding", "If-None-Match", "Range", "If-Range"};
+        server.collectHeaders(headers, 4);
+
         server.begin(GHC_HTTP_PORT);
         server.enableCORS(true);
     }
 
     void endHTTP() {
+        sender.end();
         server.stop();
 #if GHC_DNS_SERVER
         if (dnsEnabled) dns.stop();
@@ -237,6 +250,7 @@ class HubHTTP {
 
     void tickHTTP() {
         server.handleClient();
+        sender.tick();
 #if GHC_DNS_SERVER
         if (dnsEnabled) dns.processNextRequest();
 #endif
@@ -275,33 +289,167 @@ class HubHTTP {
         bool pgm = 0;
         _fetchStartHook(path, &file_p, &bytes, &size, &pgm);
 
+        // данные и файл от пользователя освобождаются в _fetchEndHook - отдаём сразу
         if (bytes && size) {
-            server.setContentLength(size);
-            server.send(200, gyverhub::getMimeByPath(path.c_str(), path.length()), "");
-            if (pgm) server.sendContent_P((PGM_P)bytes, size);
-            else server.sendContent((const char *) bytes, size);
+            String head = _head(200, gyverhub::getMimeByPath(path.c_str(), path.length()), size, String());
+            sender.bytes(server.client(), head, bytes, size, pgm, true);
+            _detach();
             _fetchEndHook();
             return 1;
         }
 
         if (file_p && *file_p) {
-            server.streamFile(*file_p, gyverhub::getMimeByPath(path.c_str(), path.length()));
+            _streamFile(*file_p, path, gyverhub::getMimeByPath(path.c_str(), path.length()), false, true);
             _fetchEndHook();
             return 1;
         }
 
         File f = GHI_FS.open(path.c_str(), "r");
         if (f) {
-            server.streamFile(f, gyverhub::getMimeByPath(path.c_str(), path.length()));
+            _streamFile(f, path, gyverhub::getMimeByPath(path.c_str(), path.length()));
             return 1;
         }
 
         return 0;
     }
+
+#endif
+
+    // заголовок ответа code с телом len байт (CONTENT_LENGTH_UNKNOWN - chunked), extra - готовые строки
+    String _head(int code, PGM_P mime, uint32_t len, const String &extra) {
+        String head(code == 206 ? F("HTTP/1.1 206 Partial Content\r\n") : F("HTTP/1.1 200 OK\r\n"));
+        head += F("Content-Type: ");
+        head += FPSTR(mime);
+        if (len == (uint32_t) CONTENT_LENGTH_UNKNOWN) {
+            head += F("\r\nTransfer-Encoding: chunked\r\n");
+        } else {
+            head += F("\r\nContent-Length: ");
+            head += len;
+            head += F("\r\n");
+        }
+        head += extra;
+        head += F(GHI_HTTP_CORS "Connection: close\r\n\r\n");
+        return head;
+    }
+
+    // соединение теперь у sender, сервер его больше не держит и сразу принимает следующее
+    void _detach() {
+        server.detach();
+    }
+
+#if GHC_FS != GHC_FS_NONE
+    // ETag (размер и время изменения), If-None-Match -> 304, Range -> 206. Текстовые файлы
+    // без Range - сжатыми, если браузер принимает gzip, размер заранее неизвестен - chunked.
+    // Тело досылается в фоне из tick(), wait - сразу (файл f закроют после вызова)
+    void _streamFile(File &f, const String &path, PGM_P mime, bool cache = false, bool wait = false) {
+        uint32_t size = f.size();
+
+#if GHC_GZIP_WINDOW
+        // Range считается по исходным байтам, такой запрос не сжимаем
+        gyverhub::Gzip *zip = nullptr;
+        if (!server.hasHeader(F("Range")) && gyverhub::Gzip::worth(path.c_str(), size) && gyverhub::acceptsEncoding(server.header(F("Accept-Encoding")).c_str(), "gzip")) {
+            zip = new gyverhub::Gzip;
+            if (!zip->begin(f)) {
+                delete zip;
+                zip = nullptr;
+            }
+        }
+        bool compress = zip;
+#else
+        bool compress = false;
+#endif
+
+        char etag[GHI_ETAG_LEN];
+        gyverhub::makeEtag(etag, size, f.getLastWrite(), compress);
+        if (gyverhub::etagMatch(server.header(F("If-None-Match")).c_str(), etag)) {
+#if GHC_GZIP_WINDOW
+            delete zip;
+#endif
+            server.sendHeader(F("ETag"), etag);
+            if (cache) cache_h();
+            server.send(304);
+            return;
+        }
+
+        String extra(F("ETag: "));
+        extra += etag;
+        extra += F("\r\n");
+        if (cache) extra += F("Cache-Control: " GHC_PORTAL_CACHE "\r\n");
+
+#if GHC_GZIP_WINDOW
+        if (zip) {
+            extra += F("Content-Encoding: gzip\r\n");
+            String head = _head(200, mime, CONTENT_LENGTH_UNKNOWN, extra);
+            sender.gzip(server.client(), head, zip, wait);
+            _detach();
+            return;
+        }
+#endif
+
+        uint32_t from, to;
+        gyverhub::Range range = gyverhub::Range::Full;
+        // If-Range с другим ETag - файл изменился, докачка невозможна, отдаём целиком
+        if (!server.hasHeader(F("If-Range")) || server.header(F("If-Range")) == etag) {
+            range = gyverhub::parseRange(server.header(F("Range")).c_str(), size, from, to);
+        }
+
+        char cr[64];
+        if (range == gyverhub::Range::Invalid) {
+            snprintf(cr, sizeof(cr), "bytes */%lu", (unsigned long) size);
+            server.sendHeader(F("ETag"), etag);
+            server.sendHeader(F("Content-Range"), cr);
+            server.send(416);
+            return;
+        }
+
+        extra += F("Accept-Ranges: bytes\r\n");
+        // как streamFile сервера: .gz отдаётся сжатым
+        if (path.endsWith(F(".gz"))) extra += F("Content-Encoding: gzip\r\n");
+        uint32_t len = size;
+        if (range == gyverhub::Range::Partial) {
+            len = to - from + 1;
+            snprintf(cr, sizeof(cr), "Content-Range: bytes %lu-%lu/%lu\r\n", (unsigned long) from, (unsigned long) to, (unsigned long) size);
+            extra += cr;
+            if (!f.seek(from)) {
+                server.send(500);
+                return;
+            }
+        }
+        String head = _head(range == gyverhub::Range::Partial ? 206 : 200, mime, len, extra);
+        sender.file(server.client(), head, f, len, wait);
+        _detach();
+    }
+#endif
+
+#if GHC_PORTAL == GHC_PORTAL_FS
+    void _portalFile(const __FlashStringHelper *path, PGM_P mime, bool cache) {
+        File f = GHI_FS.open(path, "r");
+        if (f) _streamFile(f, String(path), mime, cache);
+        else server.send(404);
+    }
+#elif GHC_PORTAL == GHC_PORTAL_BUILTIN
+    // brotli или gzip по Accept-Encoding. ETag - CRC32 сжатого файла, посчитан при сборке,
+    // заголовок ответа готовый из build.py, тело досылается из flash в фоне
+    void _portalBuiltin(const gyverhub::portal::Asset &asset) {
+        const gyverhub::portal::Encoded &enc = asset.select(server.header(F("Accept-Encoding")).c_str());
+        if (gyverhub::etagMatch(server.header(F("If-None-Match")).c_str(), enc.etag)) {
+            server.sendHeader(F("Vary"), F("Accept-Encoding"));
+            server.sendHeader(F("ETag"), enc.etag);
+            cache_h();
+            server.send(304);
+            return;
+        }
+        // готовый заголовок кончается пустой строкой - Connection вставляется перед ней
+        String head(FPSTR(enc.head));
+        head.remove(head.length() - 2);
+        head += F("Connection: close\r\n\r\n");
+        sender.bytes(server.client(), head, enc.data, enc.size, true);
+        _detach();
+    }
 #endif
 
 #if GHC_FS != GHC_FS_NONE
-    File file;
+    gyverhub::Upload file;
     bool updating = false;
 #endif
 
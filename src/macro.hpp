@@ -161,6 +161,11 @@
 #define GHC_MQTT_IMPL GHC_IMPL
 #endif
 
+#if GHC_MQTT_IMPL == GHC_IMPL_NONE
+#undef GHC_MQTT_CBOR
+#define GHC_MQTT_CBOR 0
+#endif
+
 #ifndef GHC_HTTP_IMPL
 #define GHC_HTTP_IMPL GHC_IMPL
 #endif
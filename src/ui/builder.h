@@ -4,7 +4,9 @@
 #include "ui/button.h"
 #include "ui/color.h"
 #include "ui/log.h"
+#include "ui/plot.h"
 #include "ui/point.h"
+#include "ui/value.h"
 #include "utils/json.h"
 #include "hub/client.h"
 #include "ui/flags.h"
@@ -14,6 +16,18 @@ namespace gyverhub {
     typedef void (*BuildCallback)(Builder *builder);
     typedef void (*SendCallback)(const String &);
 
+    // строка row таблицы TableView в формате CSV (ячейки через запятую), без перевода строки
+    typedef void (*RowCallback)(uint16_t row, String &out);
+
+    // дописанное в Log/Plot (buildTail, buildPlot)
+    struct Tail {
+        uint32_t from = 0;
+        uint32_t seq = 0;
+        uint32_t min = 0;   // Plot: время самого старого отсчёта
+        bool reset = false; // from не совпал с запрошенным, клиент заменяет значение целиком
+        bool plot = false;  // значение - отсчёты Plot (JSON-массивы), а не текст
+    };
+
     // тип билда
     enum class BuildType {
         NONE,
@@ -22,28 +36,6 @@ namespace gyverhub {
         READ,  // read topic
         UI,  // ui
     };
-    
-    enum DataType {
-        GH_NULL,
-
-        GH_STR,
-        GH_CSTR,
-
-        GH_BOOL,
-        GH_INT8,
-        GH_UINT8,
-        GH_INT16,
-        GH_UINT16,
-        GH_INT32,
-        GH_UINT32,
-
-        GH_FLOAT,
-        GH_DOUBLE,
-
-        GH_COLOR,
-        GH_FLAGS,
-        GH_POS,
-    };
 
     class Builder {
     private:
@@ -52,20 +44,56 @@ namespace gyverhub {
         GHclient client {};
         BuildType buildType = BuildType::NONE;
         bool mustRefresh = false;
-        uint8_t menu = 0;
+        ParseStatus status = ParseStatus::OK;
+        uint8_t page = 0;  // открытая у клиента страница меню
         uint16_t tab_width = 0;
         uint16_t count = 0;
 
+        // страница текущего блока Page(), -1 - вне страниц
+        int16_t curPage = -1;
+        uint16_t outerCount = 0;
+
         // имя компонента
         const char* name = nullptr;
 
         // значение компонента
         const char* value = nullptr;
 
+        // номер компонента из имени вида _nN или _pP_N (0 - имя не задано)
+        uint16_t nameIdx = 0;
+
+        // страница P из имени вида _pP_N, -1 - компонент вне страниц
+        int16_t namePage = -1;
+
         size_t maxChunkSize = 0;
         size_t totalSize = 0;
 
-        Builder(BuildType buildType, const char* name = nullptr, const char* value = nullptr) : buildType(buildType), name(name), value(value) {};
+        // окно строк TableView/LogView: запрошенное (count 0 - по умолчанию) и итоговое
+        uint16_t winOffset = 0;
+        uint16_t winCount = 0;
+        uint16_t winTotal = 0;
+        bool win = false;  // окно запрошено и ещё не выдано: компонент без окна его не сбрасывает
+
+        // холст между BeginCanvas и EndCanvas
+        gyverhub::Canvas* canvas = nullptr;
+
+        // хвост Log/Plot: запрошенный seq в from (TAIL_SENT - после прошлой рассылки) и итоговый диапазон
+        bool tail = false;
+        Tail tailRes;
+
+        // Plot целиком, прорежённый до plotWidth точек
+        uint16_t plotWidth = 0;
+
+        Builder(BuildType buildType, const char* name = nullptr, const char* value = nullptr) : buildType(buildType), name(name), value(value) {
+            if (name && name[0] == '_' && name[1] == 'n') nameIdx = atoi(name + 2);
+            if (name && name[0] == '_' && name[1] == 'p') {
+                const char* idx = strchr(name + 2, '_');
+                if (idx) {
+                    namePage = atoi(name + 2);
+                    nameIdx = atoi(idx + 1);
+                }
+            }
+        };
 
         void _afterComponent() {
             if (buildType == BuildType::COUNT) {
@@ -80,17 +108,25 @@ namespace gyverhub {
     public:
 
         uint8_t currentMenu() {
-            return menu;
+            return page;
         }
 
         void refresh() {
             mustRefresh = true;
         }
 
-        static bool buildSet(BuildCallback cb, const char* name, const char* value, GHclient client){
+        // страница меню компонента по его имени (_pP_N), 0 - компонент вне страниц
+        static uint8_t pageOf(const char* name) {
+            Builder b{BuildType::NONE, name};
+            return b.namePage < 0 ? 0 : b.namePage;
+        }
+
+        // status - результат разбора значения (отклонено, приведено к диапазону)
+        static bool buildSet(BuildCallback cb, const char* name, const char* value, GHclient client, ParseStatus* status = nullptr) {
             Builder b{BuildType::ACTION, name, value};
             b.client = client;
             cb(&b);
+            if (status) *status = b.status;
             return b.mustRefresh;
         }
 
@@ -101,18 +137,57 @@ namespace gyverhub {
             return b.buildType == BuildType::NONE;
         }
 
-        static size_t buildCount(BuildCallback cb, GHclient client) {
+        // окно строк компонента name: offset - первая строка (будет сдвинута в допустимые пределы).
+        // false - компонента нет или он без окна (не TableView/LogView)
+        static bool buildWindow(BuildCallback cb, gyverhub::Json *answ, const char* name, uint16_t& offset, uint16_t count, uint16_t& total) {
+            Builder b{BuildType::READ, name};
+            b.sptr = answ;
+            b.winOffset = offset;
+            b.winCount = count ? count : 1;
+            b.win = true;
+            cb(&b);
+            offset = b.winOffset;
+            total = b.winTotal;
+            return b.buildType == BuildType::NONE && !b.win;
+        }
+
+        static constexpr uint32_t TAIL_SENT = 0xffffffff;
+
+        // хвост Log/Plot name после since: true - найден, в answ дописанное, иначе в answ обычное значение
+        static bool buildTail(BuildCallback cb, gyverhub::Json *answ, const char* name, uint32_t since, Tail& res) {
+            Builder b{BuildType::READ, name};
+            b.sptr = answ;
+            b.tail = true;
+            b.tailRes.from = since;
+            cb(&b);
+            res = b.tailRes;
+            return b.buildType == BuildType::NONE && !b.tail;
+        }
+
+        // все отсчёты Plot name, прорежённые до width точек
+        static bool buildPlot(BuildCallback cb, gyverhub::Json *answ, const char* name, uint16_t width, Tail& res) {
+            Builder b{BuildType::READ, name};
+            b.sptr = answ;
+            b.plotWidth = width;
+            cb(&b);
+            res = b.tailRes;
+            return b.buildType == BuildType::NONE && b.tailRes.plot;
+        }
+
+        static size_t buildCount(BuildCallback cb, GHclient client, uint8_t page = 0) {
             Builder b{BuildType::COUNT};
             b.client = client;
+            b.page = page;
             gyverhub::Json count;
             b.sptr = &count;
             cb(&b);
             return b.totalSize;
         }
 
-        static void buildUi(BuildCallback cb, gyverhub::Json *answ, GHclient client, size_t maxChunkSize = 0, SendCallback sendCallback = nullptr) {
+        static void buildUi(BuildCallback cb, gyverhub::Json *answ, GHclient client, size_t maxChunkSize = 0, SendCallback sendCallback = nullptr, uint8_t page = 0) {
             Builder b{BuildType::UI};
             b.client = client;
+            b.page = page;
             b.maxChunkSize = maxChunkSize;
             b.sendCallback = sendCallback;
             b.sptr = answ;
@@ -122,7 +197,7 @@ namespace gyverhub {
         // ========================= PRIVATE =========================
     private:
         bool autoNameEq() {
-            return name[0] == '_' && name[1] == 'n' && (uint16_t)atoi(name + 2) == count;
+            return nameIdx == count && namePage == curPage;
         }
         void _nameAuto() {
             count++;
@@ -135,22 +210,23 @@ namespace gyverhub {
             return false;
         }
 
-        void parse(void *var, DataType dtype);
-
-        bool _parse(void *var, DataType dtype) {
-            if (sptr && buildType == BuildType::ACTION && autoNameEq()) {
+        // false, если это не тот компонент или значение отклонено
+        bool _parse(Value var, const Range* range = nullptr) {
+            if (buildType == BuildType::ACTION && autoNameEq()) {
                 buildType = BuildType::NONE;
-                parse(var, dtype);
-                return true;
+                status = var.parse(value, range);
+                return status == ParseStatus::OK || status == ParseStatus::CLAMPED;
             }
             return false;
         }
         bool _isUI() {
-            return sptr && (buildType == BuildType::UI || buildType == BuildType::COUNT);
+            return sptr && (buildType == BuildType::UI || buildType == BuildType::COUNT) && (curPage < 0 || curPage == page);
         }
 
         // ================
-        void appendObject(void* val, DataType type);
+        void appendObject(Value var) {
+            var.append(*sptr);
+        }
 
         void _add(VSPTR str, bool fstr = true) {
             if (str) {
@@ -174,7 +250,7 @@ namespace gyverhub {
         void _tabw() {
             if (tab_width) {
                 _add(F(",\"tab_w\":"));
-                *sptr += tab_width;
+                sptr->appendUnsigned(tab_width);
             }
         }
 
@@ -189,8 +265,14 @@ namespace gyverhub {
             _quot();
         }
         void _name() {
-            _add(F(",\"name\":\"_n"));
-            *sptr += count;
+            if (curPage >= 0) {
+                _add(F(",\"name\":\"_p"));
+                sptr->appendUnsigned(curPage);
+                *sptr += '_';
+            } else {
+                _add(F(",\"name\":\"_n"));
+            }
+            sptr->appendUnsigned(count);
             _quot();
         }
         void _label(VSPTR label, bool fstr) {
@@ -212,33 +294,27 @@ namespace gyverhub {
         void _color(gyverhub::Color color) {
             if (color == Colors::UNSET) return;
             _add(F(",\"color\":"));
-            *sptr += color.toHex();
+            sptr->appendUnsigned(color.toHex());
         }
         void _size(int val) {
             _add(F(",\"size\":"));
-            *sptr += val;
+            sptr->appendInteger(val);
         }
 
         // ================
         void _minv(float val) {
             _add(F(",\"min\":"));
-            if (isnan(val)) *sptr += 0;
-            else *sptr += val;
+            sptr->appendFloat(val);
         }
 
         void _maxv(float val) {
             _add(F(",\"max\":"));
-            if (isnan(val)) *sptr += 0;
-            else *sptr += val;
+            sptr->appendFloat(val);
         }
 
         void _step(float val) {
             _add(F(",\"step\":"));
-            if (isnan(val)) *sptr += 0;
-            else {
-                if (val < 0.01) *sptr += String(val, 4);
-                else *sptr += val;
-            }
+            sptr->appendFloat(val);
         }
 
     public:
@@ -247,7 +323,7 @@ namespace gyverhub {
             if (_isUI()) {
                 tab_width = 100;
                 _add(F("{\"type\":\"row_b\",\"height\":"));
-                *sptr += height;
+                sptr->appendInteger(height);
                 _end();
             }
         }
@@ -272,11 +348,19 @@ namespace gyverhub {
 
         // ========================== DUMMY ===========================
         bool Dummy(void* var = nullptr, DataType type = GH_NULL) {
+            return _dummy(Value::fromType(var, type));
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Dummy(T* var) {
+            return _dummy(var);
+        }
+
+        bool _dummy(Value var) {
             _nameAuto();
             if (_checkName()) {
-                appendObject(var, type);
+                appendObject(var);
             }
-            return _parse(var, type);
+            return _parse(var);
         }
 
         // ========================== BUTTON ==========================
@@ -305,7 +389,7 @@ namespace gyverhub {
                 _tabw();
                 _end();
             }
-            return var && _parse(&var->value, GH_UINT8) && var->clicked();
+            return var && _parse(&var->value) && var->clicked();
         }
 
         // ========================== LABEL ==========================
@@ -328,7 +412,7 @@ namespace gyverhub {
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                sptr->appendEscaped(value.c_str(), 0);
+                sptr->appendEscaped(value.c_str());
             }
         }
 
@@ -348,6 +432,31 @@ namespace gyverhub {
             }
         }
 
+        // вычислить окно строк из total, window - размер окна по умолчанию, tail - по умолчанию конец
+        void _window(uint16_t total, uint16_t window, bool tail, uint16_t& offset, uint16_t& count) {
+            if (winCount) {
+                offset = winOffset;
+                count = winCount;
+            } else {
+                count = window;
+                offset = (tail && total > window) ? (total - window) : 0;
+            }
+            if (count > GHC_WINDOW_MAX) count = GHC_WINDOW_MAX;
+            if (count > total) count = total;
+            if (offset > total - count) offset = total - count;
+            winOffset = offset;
+            winTotal = total;
+            win = false;
+        }
+        void _windowInfo(uint16_t total, uint16_t offset, uint16_t window) {
+            _add(F(",\"total\":"));
+            sptr->appendUnsigned(total);
+            _add(F(",\"offset\":"));
+            sptr->appendUnsigned(offset);
+            _add(F(",\"window\":"));
+            sptr->appendUnsigned(window);
+        }
+
         // ========================== LOG ==========================
         void Log(GHlog* log, FSTR label = nullptr) {
             _log(true, log, label);
@@ -363,14 +472,122 @@ namespace gyverhub {
                 _name();
                 _value();
                 _quot();
-                log->read(sptr);
+                log->read(sptr, true);
+                _quot();
+                _add(F(",\"seq\":"));
+                sptr->appendUnsigned(log->seq());
+                _label(label, fstr);
+                _tabw();
+                _end();
+            } else if (_checkName()) {
+                if (tail) {
+                    tail = false;
+                    if (tailRes.from == TAIL_SENT) tailRes.reset = !log->readNew(sptr, tailRes.from);
+                    else tailRes.reset = !log->readSince(sptr, tailRes.from);
+                    tailRes.seq = log->seq();
+                } else {
+                    log->read(sptr, true);
+                }
+            }
+        }
+
+        // лог с окном: отправляются только window последних строк, остальные клиент запросит сам
+        void LogView(GHlog* log, FSTR label = nullptr, uint16_t window = 20) {
+            _logView(true, log, label, window);
+        }
+        void LogView(GHlog* log, CSREF label, uint16_t window = 20) {
+            _logView(false, log, label.c_str(), window);
+        }
+
+        void _logView(bool fstr, GHlog* log, VSPTR label, uint16_t window) {
+            _nameAuto();
+            bool ui = _isUI();
+            if (!ui && !_checkName()) return;
+
+            uint16_t offset, count;
+            uint16_t total = log->lines();
+            _window(total, window, true, offset, count);
+            if (ui) {
+                _begin(F("log"));
+                _name();
+                _value();
+                _quot();
+                log->readLines(sptr, offset, count);
                 _quot();
+                _windowInfo(total, offset, window);
+                _label(label, fstr);
+                _tabw();
+                _end();
+            } else {
+                log->readLines(sptr, offset, count);
+            }
+        }
+
+        // ========================== PLOT ==========================
+        // график из буфера plot: клиент запрашивает его прорежённым до своей ширины, дальше получает только новые отсчёты.
+        // names - имена серий через запятую
+        void Plot(gyverhub::PlotSource* plot, FSTR label = nullptr, FSTR names = nullptr) {
+            _plot(true, plot, label, names);
+        }
+        void Plot(gyverhub::PlotSource* plot, CSREF label, CSREF names = "") {
+            _plot(false, plot, label.c_str(), names.c_str());
+        }
+
+        void _plot(bool fstr, gyverhub::PlotSource* plot, VSPTR label, VSPTR names) {
+            _nameAuto();
+            if (_isUI()) {
+                _begin(F("plot"));
+                _name();
+                _add(F(",\"amount\":"));
+                sptr->appendUnsigned(plot->series());
+                if (names) {
+                    _add(F(",\"text\":"));
+                    _quot();
+                    sptr->appendEscaped(names, fstr);
+                    _quot();
+                }
                 _label(label, fstr);
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                log->read(sptr);
+                if (plotWidth || tail) {
+                    tail = false;
+                    _plotTail(plot);
+                } else if (plot->length()) {
+                    // последний отсчёт: время,значения...
+                    gyverhub::Json point;
+                    plot->write(&point, plot->length() - 1, plot->length());
+                    sptr->appendRaw(point.c_str() + 1, point.length() - 2);
+                }
+            }
+        }
+
+        void _plotTail(gyverhub::PlotSource* plot) {
+            uint32_t seq = plot->seq();
+            uint32_t len = plot->length();
+            uint32_t since = tailRes.from;
+            bool sent = since == TAIL_SENT;
+            if (plotWidth) plot->width = plotWidth;
+            if (sent) since = plot->sent;
+            uint16_t width = plot->width ? plot->width : GHC_PLOT_WIDTH;
+
+            tailRes.plot = true;
+            tailRes.seq = seq;
+            tailRes.min = len ? plot->time(0) : 0;
+            // новых больше, чем точек на графике, или часть уже затёрта - весь график заново
+            if (plotWidth || seq - since > len || seq - since > width) {
+                tailRes.from = seq - len;
+                tailRes.reset = true;
+                *sptr += '[';
+                plot->writeReduced(sptr, width);
+                *sptr += ']';
+            } else {
+                tailRes.from = since;
+                *sptr += '[';
+                plot->write(sptr, len - (seq - since), len);
+                *sptr += ']';
             }
+            if (sent) plot->sent = seq;
         }
 
         // ========================== DISPLAY ==========================
@@ -390,7 +607,7 @@ namespace gyverhub {
                 _label(label, fstr);
                 _color(color);
                 _add(F(",\"rows\":"));
-                *sptr += rows;
+                sptr->appendInteger(rows);
                 _size(size);
                 _tabw();
                 _end();
@@ -399,6 +616,53 @@ namespace gyverhub {
             }
         }
 
+        // таблица с окном: rows строк, строки берутся из cb по мере запроса клиентом
+        void TableView(uint16_t rows, RowCallback cb, FSTR align = nullptr, FSTR width = nullptr, FSTR label = nullptr, uint16_t window = 20) {
+            _tableView(true, rows, cb, align, width, label, window);
+        }
+        void TableView(uint16_t rows, RowCallback cb, CSREF align, CSREF width = "", CSREF label = "", uint16_t window = 20) {
+            _tableView(false, rows, cb, align.c_str(), width.c_str(), label.c_str(), window);
+        }
+
+        void _tableView(bool fstr, uint16_t rows, RowCallback cb, VSPTR align, VSPTR width, VSPTR label, uint16_t window) {
+            _nameAuto();
+            bool ui = _isUI();
+            if (!ui && !_checkName()) return;
+
+            uint16_t offset, count;
+            _window(rows, window, false, offset, count);
+            if (ui) {
+                _begin(F("table"));
+                _name();
+                _value();
+                _quot();
+                _rows(cb, offset, count);
+                _quot();
+                _windowInfo(rows, offset, window);
+                _add(F(",\"align\":\""));
+                _add(align, fstr);
+                _quot();
+                _add(F(",\"width\":\""));
+                _add(width, fstr);
+                _quot();
+                _label(label, fstr);
+                _tabw();
+                _end();
+            } else {
+                _rows(cb, offset, count);
+            }
+        }
+
+        void _rows(RowCallback cb, uint16_t offset, uint16_t count) {
+            String row;
+            for (uint16_t i = offset; i < offset + count; i++) {
+                row = "";
+                cb(i, row);
+                sptr->appendEscaped(row);
+                *sptr += F("\\n");
+            }
+        }
+
         // ========================= TABLE ==========================
         void Table(FSTR text = nullptr, FSTR align = nullptr, FSTR width = nullptr, FSTR label = nullptr) {
             _table(true, text, align, width, label);
@@ -467,28 +731,44 @@ namespace gyverhub {
 
         // ========================== INPUT ==========================
         bool Input(void* var = nullptr, DataType type = GH_NULL, FSTR label = nullptr, int maxv = 0, FSTR regex = nullptr, gyverhub::Color color = Colors::UNSET) {
-            return _input(true, F("input"), var, type, label, maxv, regex, color);
+            return _input(true, F("input"), Value::fromType(var, type), label, maxv, regex, color);
         }
         bool Input(void* var, DataType type, CSREF label, int maxv = 0, CSREF regex = "", gyverhub::Color color = Colors::UNSET) {
-            return _input(false, F("input"), var, type, label.c_str(), maxv, regex.c_str(), color);
+            return _input(false, F("input"), Value::fromType(var, type), label.c_str(), maxv, regex.c_str(), color);
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Input(T* var, FSTR label = nullptr, int maxv = 0, FSTR regex = nullptr, gyverhub::Color color = Colors::UNSET) {
+            return _input(true, F("input"), var, label, maxv, regex, color);
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Input(T* var, CSREF label, int maxv = 0, CSREF regex = "", gyverhub::Color color = Colors::UNSET) {
+            return _input(false, F("input"), var, label.c_str(), maxv, regex.c_str(), color);
         }
 
         // ========================== PASS ==========================
         bool Pass(void* var = nullptr, DataType type = GH_NULL, FSTR label = nullptr, int maxv = 0, gyverhub::Color color = Colors::UNSET) {
-            return _input(true, F("pass"), var, type, label, maxv, nullptr, color);
+            return _input(true, F("pass"), Value::fromType(var, type), label, maxv, nullptr, color);
         }
         bool Pass(void* var, DataType type, CSREF label, int maxv = 0, gyverhub::Color color = Colors::UNSET) {
-            return _input(false, F("pass"), var, type, label.c_str(), maxv, "", color);
+            return _input(false, F("pass"), Value::fromType(var, type), label.c_str(), maxv, "", color);
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Pass(T* var, FSTR label = nullptr, int maxv = 0, gyverhub::Color color = Colors::UNSET) {
+            return _input(true, F("pass"), var, label, maxv, nullptr, color);
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Pass(T* var, CSREF label, int maxv = 0, gyverhub::Color color = Colors::UNSET) {
+            return _input(false, F("pass"), var, label.c_str(), maxv, "", color);
         }
 
-        bool _input(bool fstr, FSTR tag, void* var, DataType type, VSPTR label, int maxv, VSPTR regex, gyverhub::Color color) {
+        bool _input(bool fstr, FSTR tag, Value var, VSPTR label, int maxv, VSPTR regex, gyverhub::Color color) {
             _nameAuto();
             if (_isUI()) {
                 _begin(tag);
                 _name();
                 _value();
                 _quot();
-                appendObject(var, type);
+                appendObject(var);
                 _quot();
                 _label(label, fstr);
                 if (maxv) _maxv((long)maxv);
@@ -499,34 +779,50 @@ namespace gyverhub {
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                appendObject(var, type);
+                appendObject(var);
             }
-            return _parse(var, type);
+            return _parse(var);
         }
 
         // ========================== SLIDER ==========================
         bool Slider(void* var = nullptr, DataType type = GH_NULL, FSTR label = nullptr, float minv = 0, float maxv = 100, float step = 1, gyverhub::Color color = Colors::UNSET) {
-            return _spinner(true, F("slider"), var, type, label, minv, maxv, step, color);
+            return _spinner(true, F("slider"), Value::fromType(var, type), label, minv, maxv, step, color);
         }
         bool Slider(void* var, DataType type, CSREF label, float minv = 0, float maxv = 100, float step = 1, gyverhub::Color color = Colors::UNSET) {
-            return _spinner(false, F("slider"), var, type, label.c_str(), minv, maxv, step, color);
+            return _spinner(false, F("slider"), Value::fromType(var, type), label.c_str(), minv, maxv, step, color);
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Slider(T* var, FSTR label = nullptr, float minv = 0, float maxv = 100, float step = 1, gyverhub::Color color = Colors::UNSET) {
+            return _spinner(true, F("slider"), var, label, minv, maxv, step, color);
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Slider(T* var, CSREF label, float minv = 0, float maxv = 100, float step = 1, gyverhub::Color color = Colors::UNSET) {
+            return _spinner(false, F("slider"), var, label.c_str(), minv, maxv, step, color);
         }
 
         // ========================== SPINNER ==========================
         bool Spinner(void* var = nullptr, DataType type = GH_NULL, FSTR label = nullptr, float minv = 0, float maxv = 100, float step = 1, gyverhub::Color color = Colors::UNSET) {
-            return _spinner(true, F("spinner"), var, type, label, minv, maxv, step, color);
+            return _spinner(true, F("spinner"), Value::fromType(var, type), label, minv, maxv, step, color);
         }
         bool Spinner(void* var, DataType type, CSREF label, float minv = 0, float maxv = 100, float step = 1, gyverhub::Color color = Colors::UNSET) {
-            return _spinner(false, F("spinner"), var, type, label.c_str(), minv, maxv, step, color);
+            return _spinner(false, F("spinner"), Value::fromType(var, type), label.c_str(), minv, maxv, step, color);
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Spinner(T* var, FSTR label = nullptr, float minv = 0, float maxv = 100, float step = 1, gyverhub::Color color = Colors::UNSET) {
+            return _spinner(true, F("spinner"), var, label, minv, maxv, step, color);
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Spinner(T* var, CSREF label, float minv = 0, float maxv = 100, float step = 1, gyverhub::Color color = Colors::UNSET) {
+            return _spinner(false, F("spinner"), var, label.c_str(), minv, maxv, step, color);
         }
 
-        bool _spinner(bool fstr, FSTR tag, void* var, DataType type, VSPTR label, float minv, float maxv, float step, gyverhub::Color color) {
+        bool _spinner(bool fstr, FSTR tag, Value var, VSPTR label, float minv, float maxv, float step, gyverhub::Color color) {
             _nameAuto();
             if (_isUI()) {
                 _begin(tag);
                 _name();
                 _value();
-                appendObject(var, type);
+                appendObject(var);
                 _label(label, fstr);
                 _minv(minv);
                 _maxv(maxv);
@@ -535,9 +831,10 @@ namespace gyverhub {
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                appendObject(var, type);
+                appendObject(var);
             }
-            return _parse(var, type);
+            Range range(minv, maxv, step);
+            return _parse(var, &range);
         }
 
         // ========================== GAUGE ===========================
@@ -554,8 +851,7 @@ namespace gyverhub {
                 _begin(F("gauge"));
                 _name();
                 _value();
-                if (isnan(value)) *sptr += 0;
-                else *sptr += value;
+                sptr->appendFixed(value, decimalsOf(step));
                 _text(text, fstr);
                 _label(label, fstr);
                 _minv(minv);
@@ -565,7 +861,7 @@ namespace gyverhub {
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                *sptr += value;
+                sptr->appendFixed(value, decimalsOf(step));
             }
         }
 
@@ -598,16 +894,16 @@ namespace gyverhub {
                 _begin(tag);
                 _name();
                 _value();
-                appendObject(var, GH_BOOL);
+                appendObject(var);
                 _label(label, fstr);
                 _color(color);
                 _text(text, fstr);
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                appendObject(var, GH_BOOL);
+                appendObject(var);
             }
-            return _parse(var, GH_BOOL);
+            return _parse(var);
         }
 
         // ========================== DATETIME ==========================
@@ -632,21 +928,22 @@ namespace gyverhub {
             return _date(false, F("datetime"), var, label.c_str(), color);
         }
 
-        bool _date(bool fstr, FSTR tag, void* var, VSPTR label, gyverhub::Color color) {
+        bool _date(bool fstr, FSTR tag, void* ptr, VSPTR label, gyverhub::Color color) {
+            Value var((uint32_t*) ptr);
             _nameAuto();
             if (_isUI()) {
                 _begin(tag);
                 _name();
                 _label(label, fstr);
                 _value();
-                appendObject(var, GH_UINT32);
+                appendObject(var);
                 _color(color);
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                appendObject(var, GH_UINT32);
+                appendObject(var);
             }
-            return _parse(var, GH_UINT32);
+            return _parse(var);
         }
 
         // ========================== SELECT ==========================
@@ -663,16 +960,16 @@ namespace gyverhub {
                 _begin(F("select"));
                 _name();
                 _value();
-                appendObject(var, GH_UINT8);
+                appendObject(var);
                 _text(text, fstr);
                 _label(label, fstr);
                 _color(color);
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                appendObject(var, GH_UINT8);
+                appendObject(var);
             }
-            return _parse(var, GH_UINT8);
+            return _parse(var);
         }
 
         // ========================== FLAGS ==========================
@@ -683,22 +980,22 @@ namespace gyverhub {
             return _flags(false, var, text.c_str(), label.c_str(), color);
         }
 
-        bool _flags(bool fstr, void* var, VSPTR text, VSPTR label, gyverhub::Color color) {
+        bool _flags(bool fstr, gyverhub::Flags* var, VSPTR text, VSPTR label, gyverhub::Color color) {
             _nameAuto();
             if (_isUI()) {
                 _begin(F("flags"));
                 _name();
                 _value();
-                appendObject(var, GH_FLAGS);
+                appendObject(var);
                 _text(text, fstr);
                 _label(label, fstr);
                 _color(color);
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                appendObject(var, GH_FLAGS);
+                appendObject(var);
             }
-            return _parse(var, GH_FLAGS);
+            return _parse(var);
         }
 
         // ========================== COLOR ==========================
@@ -715,14 +1012,14 @@ namespace gyverhub {
                 _begin(F("color"));
                 _name();
                 _value();
-                appendObject(var, GH_COLOR);
+                appendObject(var);
                 _label(label, fstr);
                 _tabw();
                 _end();
             } else if (_checkName()) {
-                appendObject(var, GH_COLOR);
+                appendObject(var);
             }
-            return _parse(var, GH_COLOR);
+            return _parse(var);
         }
 
         // ========================== LED ==========================
@@ -754,7 +1051,7 @@ namespace gyverhub {
             if (_isUI()) {
                 _begin(F("spacer"));
                 _add(F(",\"height\":"));
-                *sptr += height;
+                sptr->appendInteger(height);
                 _tabw();
                 _end();
             }
@@ -762,10 +1059,37 @@ namespace gyverhub {
 
         // ========================== MENU ==========================
         bool Menu(FSTR text) {
-            return _tabs(true, true, &menu, text, nullptr);
+            return _tabs(true, true, &page, text, nullptr);
         }
         bool Menu(CSREF text) {
-            return _tabs(false, true, &menu, text.c_str(), nullptr);
+            return _tabs(false, true, &page, text.c_str(), nullptr);
+        }
+
+        // ========================== PAGE ==========================
+        // Начать страницу меню num. Компоненты страницы нумеруются отдельно (_pP_N),
+        // в UI попадает только открытая у клиента страница, set/read - только страница из имени.
+        // true - страницу нужно собирать, иначе её компоненты можно пропустить
+        bool Page(uint8_t num) {
+            if (curPage < 0) outerCount = count;
+            curPage = num;
+            count = 0;
+            switch (buildType) {
+                case BuildType::UI:
+                case BuildType::COUNT:
+                    return num == page;
+                case BuildType::ACTION:
+                case BuildType::READ:
+                    return num == namePage;
+                default:
+                    return false;
+            }
+        }
+
+        // закончить страницы, дальше общие для всех страниц компоненты
+        void EndPage() {
+            if (curPage < 0) return;
+            curPage = -1;
+            count = outerCount;
         }
 
         // ========================== TABS ==========================
@@ -779,7 +1103,6 @@ namespace gyverhub {
         bool _tabs(bool fstr, bool menu, uint8_t* var, VSPTR text, VSPTR label) {
             _nameAuto();
             if (_isUI()) {
-                _begin(menu ? F("menu") : F("tabs"));
                 if (menu) {
                     _begin(F("menu"));
                     _add(F(",\"name\":\"_menu\""));
@@ -788,13 +1111,13 @@ namespace gyverhub {
                     _name();
                 }
                 _value();
-                *sptr += *var;
+                sptr->appendUnsigned(*var);
                 _text(text, fstr);
                 _label(label, fstr);
                 _tabw();
                 _end();
             }
-            bool act = _parse(var, GH_UINT8);
+            bool act = _parse(var);
             if (act) refresh();
             return act;
         }
@@ -822,20 +1145,32 @@ namespace gyverhub {
                 _begin(F("canvas"));
                 _name();
                 _add(F(",\"width\":"));
-                *sptr += width;
+                sptr->appendInteger(width);
                 _add(F(",\"height\":"));
-                *sptr += height;
+                sptr->appendInteger(height);
                 _label(label, fstr);
                 if (pos) _add(F(",\"active\":1"));
                 _value();
                 *sptr += '[';
-                if (begin && cv) cv->extBuffer(sptr);
-                else EndCanvas();
+                if (begin && cv) {
+                    cv->extBuffer(sptr);
+                    // новый клиент кэша слоёв не имеет
+                    cv->sendLayers(true);
+                    canvas = cv;
+                } else {
+                    EndCanvas();
+                }
             }
-            return _parse(pos, GH_POS);
+            return _parse(pos);
         }
 
         void EndCanvas() {
+            if (canvas) {
+                canvas->sendLayers(false);
+                // холст может жить дольше билдера (кэш слоёв) - вернуть ему свой буфер
+                canvas->extBuffer(&canvas->buf);
+                canvas = nullptr;
+            }
             if (_isUI()) {
                 *sptr += ']';
                 _tabw();
@@ -868,7 +1203,7 @@ namespace gyverhub {
             if (_isUI()) {
                 _begin(F("stream"));
                 _add(F(",\"port\":"));
-                *sptr += port;
+                sptr->appendUnsigned(port);
                 _tabw();
                 _end();
             }
@@ -908,7 +1243,7 @@ namespace gyverhub {
                 _tabw();
                 _end();
             }
-            bool act = _parse(pos, GH_POS);
+            bool act = _parse(pos);
             if (act && pos != nullptr) {
                 pos->x -= 255;
                 pos->y -= 255;
@@ -932,30 +1267,38 @@ namespace gyverhub {
                 _label(label, fstr);
                 _end();
             }
-            return _parse(var, GH_BOOL);
+            return _parse(var);
         }
 
         // ========================= PROMPT ========================
         bool Prompt(void* value = nullptr, DataType type = GH_NULL, FSTR label = nullptr) {
-            return _prompt(true, value, type, label);
+            return _prompt(true, Value::fromType(value, type), label);
         }
         bool Prompt(void* value, DataType type, CSREF label) {
-            return _prompt(false, value, type, label.c_str());
+            return _prompt(false, Value::fromType(value, type), label.c_str());
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Prompt(T* value, FSTR label = nullptr) {
+            return _prompt(true, value, label);
+        }
+        template <typename T, DataType = ValueTraits<T>::type>
+        bool Prompt(T* value, CSREF label) {
+            return _prompt(false, value, label.c_str());
         }
 
-        bool _prompt(bool fstr, void* value, DataType type, VSPTR label) {
+        bool _prompt(bool fstr, Value value, VSPTR label) {
             _nameAuto();
             if (_isUI()) {
                 _begin(F("prompt"));
                 _name();
                 _value();
                 _quot();
-                appendObject(value, type);
+                appendObject(value);
                 _quot();
                 _label(label, fstr);
                 _end();
             }
-            return _parse(value, type);
+            return _parse(value);
         }
     };
 }
@@ -0,0 +1,250 @@
+#include "canvas.h"
+#include "utils/base64.h"
+
+#if GHC_CANVAS_BINARY
+
+void gyverhub::Canvas::_str(const char* str) {
+    size_t len = strlen(str);
+    _uvar(len);
+    for (size_t i = 0; i < len; i++) _byte(str[i]);
+}
+
+void gyverhub::Canvas::_flushBinary() {
+    uint8_t n = binLen;
+    binLen = 0;
+    if (!ps || !n) return;
+    _token();
+    // \u0001 - метка бинарного токена, base64 её не содержит
+    ps->reserve(ps->length() + base64EncodedLength(n) + 10);
+    ps->appendRaw("\"\\u0001", 7);
+    char buf[4];
+    for (uint8_t i = 0; i < n; i += 3) {
+        uint32_t v = (uint32_t)bin[i] << 16;
+        if (i + 1 < n) v |= (uint32_t)bin[i + 1] << 8;
+        if (i + 2 < n) v |= bin[i + 2];
+        buf[0] = toBase64(v >> 18);
+        buf[1] = toBase64((v >> 12) & 0x3f);
+        buf[2] = (i + 1 < n) ? toBase64((v >> 6) & 0x3f) : '=';
+        buf[3] = (i + 2 < n) ? toBase64(v & 0x3f) : '=';
+        ps->appendRaw(buf, 4);
+    }
+    *ps += '"';
+}
+
+void gyverhub::Canvas::_binCommand(int cmd, int num, const char* text, va_list valist) {
+    _byte(cmd);
+    if (text) {
+        _str(text);
+        num--;
+    }
+    // drawImage и roundRect - с переменным числом аргументов
+    if (cmd == 30 || cmd == 31) _byte(num);
+    for (int i = 0; i < num; i++) {
+        if (cmd <= 2) _u32(va_arg(valist, uint32_t));
+        else _zz(va_arg(valist, int));
+    }
+}
+
+#endif
+
+// Прореживание: подряд идущие точки с одним x (столбец) заменяются на min и max по y
+// в порядке появления. emit(x, y) вызывается для каждой оставшейся точки, возвращается их число
+template <typename Get, typename Emit>
+static size_t _reduce(size_t n, Get get, bool reduce, Emit emit) {
+    int x, y;
+    if (!reduce) {
+        for (size_t i = 0; i < n; i++) {
+            get(i, x, y);
+            emit(x, y);
+        }
+        return n;
+    }
+
+    size_t count = 0;
+    int colX = 0, minY = 0, maxY = 0;
+    size_t minI = 0, maxI = 0;
+    auto column = [&]() {
+        if (minI == maxI) {
+            emit(colX, minY);
+            count++;
+        } else {
+            if (minI < maxI) emit(colX, minY), emit(colX, maxY);
+            else emit(colX, maxY), emit(colX, minY);
+            count += 2;
+        }
+    };
+    for (size_t i = 0; i < n; i++) {
+        get(i, x, y);
+        if (!i || x != colX) {
+            if (i) column();
+            colX = x;
+            minY = maxY = y;
+            minI = maxI = i;
+        } else if (y < minY) {
+            minY = y;
+            minI = i;
+        } else if (y > maxY) {
+            maxY = y;
+            maxI = i;
+        }
+    }
+    if (n) column();
+    return count;
+}
+
+template <typename Get>
+void gyverhub::Canvas::_points(CanvasOp op, size_t n, Get get, bool reduce) {
+    if (!ps || !n) return;
+#if GHC_CANVAS_BINARY
+    if (binary) {
+        // первый проход - количество точек после прореживания
+        size_t count = _reduce(n, get, reduce, [](int, int) {});
+        _byte((uint8_t)op);
+        _uvar(count);
+        bool start = true;
+        int px = 0, py = 0;
+        _reduce(n, get, reduce, [&](int x, int y) {
+            _zz(start ? x : (x - px));
+            _zz(start ? y : (y - py));
+            start = false;
+            px = x;
+            py = y;
+        });
+        if (op == CanvasOp::POLYLINE) _setLast(px, py);
+        return;
+    }
+#endif
+    bool start = true;
+    _reduce(n, get, reduce, [&](int x, int y) {
+        if (op == CanvasOp::POINTS) fillRect(x, y, 1, 1);
+        else if (start) moveTo(x, y);
+        else lineTo(x, y);
+        start = false;
+    });
+}
+
+void gyverhub::Canvas::polyline(const int16_t* xy, size_t n, bool reduce) {
+    _points(CanvasOp::POLYLINE, n, [xy](size_t i, int& x, int& y) {
+        x = xy[i * 2];
+        y = xy[i * 2 + 1];
+    }, reduce);
+}
+
+void gyverhub::Canvas::polyline(const int16_t* xs, const int16_t* ys, size_t n, bool reduce) {
+    _points(CanvasOp::POLYLINE, n, [xs, ys](size_t i, int& x, int& y) {
+        x = xs[i];
+        y = ys[i];
+    }, reduce);
+}
+
+void gyverhub::Canvas::points(const int16_t* xy, size_t n, bool reduce) {
+    _points(CanvasOp::POINTS, n, [xy](size_t i, int& x, int& y) {
+        x = xy[i * 2];
+        y = xy[i * 2 + 1];
+    }, reduce);
+}
+
+// округление без вызова floorf
+static inline int _round(float v) {
+    return (v >= 0) ? (int)(v + 0.5f) : -(int)(0.5f - v);
+}
+
+void gyverhub::Canvas::plot(const float* ys, size_t n, float x0, float dx, bool reduce) {
+    if (!ps || !n) return;
+    beginPath();
+    _points(CanvasOp::POLYLINE, n, [ys, x0, dx](size_t i, int& x, int& y) {
+        x = _round(x0 + i * dx);
+        y = _round(ys[i]);
+    }, reduce);
+    stroke();
+}
+
+// ======================= СЛОИ ========================
+
+// FNV-1a
+static uint32_t _hash(const char* p, size_t len) {
+    uint32_t h = 2166136261ul;
+    while (len--) {
+        h ^= (uint8_t)*p++;
+        h *= 16777619ul;
+    }
+    return h;
+}
+
+gyverhub::Canvas::Layer* gyverhub::Canvas::_findLayer(uint32_t name) {
+    for (uint8_t i = 0; i < GHC_CANVAS_LAYERS; i++) {
+        if (layers[i].name == name && layers[i].hash) return &layers[i];
+    }
+    return nullptr;
+}
+
+void gyverhub::Canvas::beginLayer(const char* name) {
+    if (!ps) return;
+    if (inLayer) endLayer();
+    flush();
+    layerStart = ps->length();
+    layerFirst = first;
+    layerName = _hash(name, strlen(name));
+    _service(GHI_CANVAS_LAYER);
+    ps->appendEscaped(name);
+    *ps += '"';
+    layerData = ps->length();
+    inLayer = true;
+}
+
+void gyverhub::Canvas::endLayer() {
+    if (!ps || !inLayer) return;
+    inLayer = false;
+    flush();
+    uint32_t hash = _hash(ps->c_str() + layerData, ps->length() - layerData);
+    if (!hash) hash = 1;  // 0 - пустая запись
+    Layer* l = _findLayer(layerName);
+
+    if (l && l->hash == hash && !layerFull) {
+        // клиент уже знает этот слой: токен начала превращается в ссылку, команды выбрасываются
+        size_t nameStart = layerStart + (layerFirst ? 0 : 1) + 8;
+        String name = ps->substring(nameStart, layerData - 1);
+        ps->remove(layerStart);
+        first = layerFirst;
+        _service(GHI_CANVAS_LAYER_DRAW);
+        ps->appendUnsigned(hash);
+        *ps += ':';
+        *ps += name;
+        *ps += '"';
+        return;
+    }
+
+    if (!l) {
+        l = &layers[layerNext];
+        layerNext = (layerNext + 1) % GHC_CANVAS_LAYERS;
+        l->name = layerName;
+    }
+    l->hash = hash;
+    _service(GHI_CANVAS_LAYER_END);
+    ps->appendUnsigned(hash);
+    *ps += '"';
+}
+
+bool gyverhub::Canvas::drawLayer(const char* name) {
+    if (!ps || layerFull) return false;
+    Layer* l = _findLayer(_hash(name, strlen(name)));
+    if (!l) return false;
+    if (inLayer) endLayer();
+    _service(GHI_CANVAS_LAYER_DRAW);
+    ps->appendUnsigned(l->hash);
+    *ps += ':';
+    ps->appendEscaped(name);
+    *ps += '"';
+    return true;
+}
+
+void gyverhub::Canvas::dirty(int x, int y, int w, int h) {
+    if (!ps) return;
+    _service(GHI_CANVAS_DIRTY);
+    int v[] = {x, y, w, h};
+    for (uint8_t i = 0; i < 4; i++) {
+        if (i) *ps += ',';
+        ps->appendInteger(v[i]);
+    }
+    *ps += '"';
+}
@@ -6,6 +6,15 @@
 // https://www.w3schools.com/tags/ref_canvas.asp
 // https://processing.org/reference/
 
+// размер куска бинарных команд, кратен 3 - base64 без паддинга
+#define GHI_CANVAS_CHUNK 192
+
+// служебные токены холста (слои, область перерисовки), \u0002 и буква
+#define GHI_CANVAS_LAYER 'L'
+#define GHI_CANVAS_LAYER_END 'E'
+#define GHI_CANVAS_LAYER_DRAW 'D'
+#define GHI_CANVAS_DIRTY 'R'
+
 namespace gyverhub {
     enum class EllipseMode {
         CENTER,
@@ -62,6 +71,13 @@ namespace gyverhub {
         XOR = 27
     };
 
+    // бинарные команды холста: номера 0-38 как в текстовом виде, дальше - только бинарные
+    enum class CanvasOp : uint8_t {
+        POLYLINE = 40,  // n, x0, y0, затем n-1 пар dx, dy
+        LINE_BY = 41,   // dx, dy от последней точки
+        POINTS = 42,    // как POLYLINE, точки 1x1
+    };
+
     class Canvas {
     private:
         Json* ps = nullptr;
@@ -73,13 +89,84 @@ namespace gyverhub {
         bool enableStroke = true;
         bool enableFill = true;
 
+        // Слои: хэш имени и содержимого последней отправки. Совпал - вместо содержимого
+        // уходит ссылка, клиент рисует слой из кэша
+        struct Layer {
+            uint32_t name;
+            uint32_t hash;
+        };
+        Layer layers[GHC_CANVAS_LAYERS] = {};
+        uint8_t layerNext = 0;
+        bool layerFull = false;
+        bool inLayer = false;
+        bool layerFirst = false;
+        uint32_t layerName = 0;
+        size_t layerStart = 0;  // начало токена слоя в буфере
+        size_t layerData = 0;   // начало содержимого слоя
+
+#if GHC_CANVAS_BINARY
+        // Бинарный поток: байт команды, аргументы - zigzag varint, цвет - 4 байта, float - 4 байта LE,
+        // строка - длина varint и байты. Копится в bin, в JSON уходит токенами "\u0001base64"
+        uint8_t bin[GHI_CANVAS_CHUNK];
+        uint8_t binLen = 0;
+        bool binary = true;
+        // последняя точка пути известна - lineTo кодируется смещением (клиент помнит её так же)
+        bool lastKnown = false;
+        int lastX = 0, lastY = 0;
+
+        void _byte(uint8_t b) {
+            if (binLen >= GHI_CANVAS_CHUNK) _flushBinary();
+            bin[binLen++] = b;
+        }
+        void _uvar(uint32_t v) {
+            while (v >= 0x80) {
+                _byte(v | 0x80);
+                v >>= 7;
+            }
+            _byte(v);
+        }
+        void _zz(int32_t v) {
+            _uvar(((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+        }
+        void _u32(uint32_t v) {
+            _byte(v >> 24);
+            _byte(v >> 16);
+            _byte(v >> 8);
+            _byte(v);
+        }
+        void _f32(float v) {
+            uint32_t bits;
+            memcpy(&bits, &v, sizeof(bits));
+            _byte(bits);
+            _byte(bits >> 8);
+            _byte(bits >> 16);
+            _byte(bits >> 24);
+        }
+        void _str(const char* str);
+        void _flushBinary();
+        void _binCommand(int cmd, int num, const char* text, va_list valist);
+#endif
+
+        void _token() {
+            if (first) first = false;
+            else *ps += ',';
+        }
+
         void command(int cmd, int num, const char *text, ...) {
             if (!ps) return;
 
-            if (first) first = false;
-            else *ps += ',';
+            va_list valist;
+            va_start(valist, num);
+#if GHC_CANVAS_BINARY
+            if (binary) {
+                _binCommand(cmd, num, text, valist);
+                va_end(valist);
+                return;
+            }
+#endif
+            _token();
             *ps += '"';
-            *ps += cmd;
+            ps->appendInteger(cmd);
 
             if (num > 0) {
                 *ps += ':';
@@ -92,18 +179,47 @@ namespace gyverhub {
                     if (num > 0) *ps += ',';
                 }
 
-                va_list valist;
-                va_start(valist, num);
                 for (int i = 0; i < num; i++) {
-                    *ps += va_arg(valist, int);
+                    // цвет RGBA не влезает в int
+                    if (cmd <= 2) ps->appendUnsigned(va_arg(valist, uint32_t));
+                    else ps->appendInteger(va_arg(valist, int));
                     if (i < num - 1) *ps += ',';
                 }
-                va_end(valist);
             }
+            va_end(valist);
             
             *ps += '"';
         }
 
+        // команда с аргументами float: ints целых, затем floats дробных, затем флаг (если flag >= 0)
+        void commandFloat(int cmd, int ints, const int* iv, int floats, const float* fv, int flag = -1) {
+            if (!ps) return;
+#if GHC_CANVAS_BINARY
+            if (binary) {
+                _byte(cmd);
+                for (int i = 0; i < ints; i++) _zz(iv[i]);
+                for (int i = 0; i < floats; i++) _f32(fv[i]);
+                if (flag >= 0) _byte(flag);
+                return;
+            }
+#endif
+            _token();
+            *ps += '"';
+            ps->appendInteger(cmd);
+            *ps += ':';
+            for (int i = 0; i < ints; i++) {
+                ps->appendInteger(iv[i]);
+                *ps += ',';
+            }
+            for (int i = 0; i < floats; i++) {
+                ps->appendFloat(fv[i]);
+                *ps += ',';
+            }
+            if (flag >= 0) ps->appendInteger(flag);
+            else ps->remove(ps->length() - 1);
+            *ps += '"';
+        }
+
         static inline uint32_t color(uint32_t hex, uint8_t a = 255) {
             return ((uint32_t)hex << 8) | a;
         }
@@ -123,33 +239,86 @@ namespace gyverhub {
 
         // подключить внешний буфер
         void extBuffer(Json* sptr) {
+            flush();
             ps = sptr;
         }
 
         // очистить буфер
         void clearBuffer() {
             first = true;
+#if GHC_CANVAS_BINARY
+            binLen = 0;
+            lastKnown = false;
+#endif
+            inLayer = false;
             if (ps) ps->clear();
         }
 
+        // дописать накопленные бинарные команды в буфер. Вызывается при отправке
+        void flush() {
+#if GHC_CANVAS_BINARY
+            if (binLen) _flushBinary();
+#endif
+        }
+
+        // бинарные команды (умолч. при GHC_CANVAS_BINARY) или текстовые
+        void setBinary(bool enable) {
+#if GHC_CANVAS_BINARY
+            flush();
+            binary = enable;
+#endif
+        }
+
         // добавить строку кода на js
         void custom(const String& s) {
             if (!ps) return;
-            if (first) first = false;
-            else *ps += ',';
+            flush();
+            _token();
             *ps += '"';
             ps->appendEscaped(s.c_str());
             *ps += '"';
         }
         void custom(FSTR s) {
             if (!ps) return;
-            if (first) first = false;
-            else *ps += ',';
+            flush();
+            _token();
             *ps += '"';
             ps->appendEscaped(s);
             *ps += '"';
         }
 
+        // ======================= СЛОИ ========================
+        // Начать слой: команды до endLayer() клиент запоминает под именем name.
+        // Если слой не изменился с прошлой отправки - вместо команд уходит ссылка на кэш
+        void beginLayer(const char* name);
+        void beginLayer(const String& name) {
+            beginLayer(name.c_str());
+        }
+
+        // закончить слой
+        void endLayer();
+
+        // нарисовать отправленный ранее слой из кэша клиента, не формируя его заново.
+        // false - слой ещё не отправлялся, его нужно нарисовать через beginLayer()
+        bool drawLayer(const char* name);
+        bool drawLayer(const String& name) {
+            return drawLayer(name.c_str());
+        }
+
+        // Перерисовать только область (x, y, w, h): клиент очищает её и ограничивает рисование ею
+        // до конца отправки. Вызывать первой командой обновления
+        void dirty(int x, int y, int w, int h);
+
+        // слои целиком, без ссылок на кэш клиента (при сборке интерфейса)
+        void sendLayers(bool full) {
+            layerFull = full;
+        }
+
+        // забыть отправленные слои - следующая отправка передаст их целиком
+        void resetLayers() {
+            memset(layers, 0, sizeof(layers));
+        }
+
         // =====================================================
         // =============== PROCESSING-LIKE API =================
         // =====================================================
@@ -241,6 +410,18 @@ namespace gyverhub {
             fillRect(x, y, 1, 1);
         }
 
+        // ломаная по n точкам xy = {x0, y0, x1, y1, ...}: moveTo в первую, lineTo в остальные (только путь).
+        // reduce - в каждом столбце x остаются только min и max по y (x должен идти по возрастанию)
+        void polyline(const int16_t* xy, size_t n, bool reduce = false);
+        void polyline(const int16_t* x, const int16_t* y, size_t n, bool reduce = false);
+
+        // n точек 1x1 цветом заливки, xy = {x0, y0, x1, y1, ...}
+        void points(const int16_t* xy, size_t n, bool reduce = false);
+
+        // график по точкам (x0 + i * dx, ys[i]) текущей обводкой. При dx < 1 в столбец попадает
+        // несколько отсчётов, reduce оставляет min и max - 10k отсчётов стоят как ширина холста
+        void plot(const float* ys, size_t n, float x0 = 0, float dx = 1, bool reduce = true);
+
         // четырёхугольник (координаты углов)
         void quadrangle(int x1, int y1, int x2, int y2, int x3, int y3, int x4, int y4) {
             beginPath();
@@ -446,19 +627,19 @@ namespace gyverhub {
 
         // прозрачность рисовки, 0.0-1.0
         void globalAlpha(float v) {
-            command(14, 1, nullptr, v);
+            commandFloat(14, 0, nullptr, 1, &v);
         }
 
         // масштабировать область рисования
         // https://www.w3schools.com/tags/canvas_scale.asp
         void scale(int sw, int sh) {
-            command(14, 2, nullptr, sw, sh);
+            command(15, 2, nullptr, sw, sh);
         }
 
         // вращать область рисования (в радианах)
         // https://www.w3schools.com/tags/canvas_rotate.asp
         void rotate(float v) {
-            command(16, 1, nullptr, v);
+            commandFloat(16, 0, nullptr, 1, &v);
         }
 
         // прямоугольник
@@ -484,11 +665,26 @@ namespace gyverhub {
         // переместить курсор
         void moveTo(int x, int y) {
             command(21, 2, nullptr, x, y);
+#if GHC_CANVAS_BINARY
+            _setLast(x, y);
+#endif
         }
 
         // нарисовать линию от курсора
         void lineTo(int x, int y) {
+#if GHC_CANVAS_BINARY
+            if (ps && binary && lastKnown) {
+                _byte((uint8_t)CanvasOp::LINE_BY);
+                _zz(x - lastX);
+                _zz(y - lastY);
+                _setLast(x, y);
+                return;
+            }
+#endif
             command(22, 2, nullptr, x, y);
+#if GHC_CANVAS_BINARY
+            _setLast(x, y);
+#endif
         }
 
         // провести кривую
@@ -518,7 +714,9 @@ namespace gyverhub {
         // провести дугу (радианы)
         // https://www.w3schools.com/tags/canvas_arc.asp
         void arc(int x, int y, int r, float sa = 0, float ea = TWO_PI, bool ccw = 0) {
-            command(27, 6, nullptr, x, y, r, sa, ea, ccw);  // TODO check
+            int iv[3] = {x, y, r};
+            float fv[2] = {sa, ea};
+            commandFloat(27, 3, iv, 2, fv, ccw);
         }
 
         // вывести закрашенный текст, опционально макс. длина
@@ -584,5 +782,30 @@ namespace gyverhub {
         void restore() {
             command(38, 0, nullptr);
         }
+
+    private:
+        template <typename Get>
+        void _points(CanvasOp op, size_t n, Get get, bool reduce);
+
+        // служебный токен "\u0002" + kind, без закрывающей кавычки
+        void _service(char kind) {
+            flush();
+#if GHC_CANVAS_BINARY
+            // смещения lineTo не переходят через границу слоя
+            lastKnown = false;
+#endif
+            _token();
+            ps->appendRaw("\"\\u0002", 7);
+            *ps += kind;
+        }
+        Layer* _findLayer(uint32_t name);
+
+#if GHC_CANVAS_BINARY
+        void _setLast(int x, int y) {
+            lastKnown = binary;
+            lastX = x;
+            lastY = y;
+        }
+#endif
     };
 }
@@ -0,0 +1,123 @@
+#include "layout.h"
+
+// FNV-1a
+#define GHI_FNV_OFFSET 2166136261ul
+#define GHI_FNV_PRIME 16777619ul
+
+static uint32_t _fnv(uint32_t hash, const char *p, const char *end) {
+    while (p < end) {
+        hash ^= (uint8_t) *p++;
+        hash *= GHI_FNV_PRIME;
+    }
+    return hash;
+}
+
+// p на открывающей кавычке, возвращает указатель за закрывающей
+static const char *_skipString(const char *p, const char *end) {
+    for (p++; p < end && *p != '\"'; p++) {
+        if (*p == '\\') p++;
+    }
+    return p < end ? p + 1 : end;
+}
+
+// конец значения: строки, числа, массива или объекта
+static const char *_skipValue(const char *p, const char *end) {
+    if (p < end && *p == '\"') return _skipString(p, end);
+    uint8_t depth = 0;
+    while (p < end) {
+        switch (*p) {
+            case '\"':
+                p = _skipString(p, end);
+                continue;
+            case '[':
+            case '{':
+                depth++;
+                break;
+            case ']':
+            case '}':
+                if (!depth) return p;
+                depth--;
+                break;
+            case ',':
+                if (!depth) return p;
+                break;
+        }
+        p++;
+    }
+    return p;
+}
+
+static bool _isKey(const char *str, const char *strEnd, const char *end, FSTR key) {
+    size_t len = strlen_P((PGM_P) key);
+    return strEnd < end && *strEnd == ':' && (size_t) (strEnd - str) == len + 2 && !memcmp_P(str + 1, (PGM_P) key, len);
+}
+
+static bool _isWindowKey(const char *str, const char *strEnd, const char *end) {
+    return _isKey(str, strEnd, end, F("total")) || _isKey(str, strEnd, end, F("offset")) || _isKey(str, strEnd, end, F("window"));
+}
+
+uint32_t gyverhub::layoutHash(const char *ui, size_t len, Json *values, Json *windows) {
+    const char *p = ui;
+    const char *end = ui + len;
+    const char *name = nullptr;  // имя текущего компонента, с кавычками
+    size_t nameLen = 0;
+    bool winOpen = false;  // в windows открыт объект текущего компонента
+    uint32_t hash = GHI_FNV_OFFSET;
+
+    while (p < end) {
+        if (*p != '\"') {
+            if (*p == '{' || *p == '}') {
+                if (*p == '{') name = nullptr;
+                if (winOpen) windows->concat("},", 2);
+                winOpen = false;
+            }
+            hash = _fnv(hash, p, p + 1);
+            p++;
+            continue;
+        }
+
+        const char *str = p;
+        p = _skipString(p, end);
+        hash = _fnv(hash, str, p);
+
+        if (_isKey(str, p, end, F("name"))) {
+            hash = _fnv(hash, p, p + 1);
+            name = ++p;
+            if (p < end && *p == '\"') {
+                p = _skipString(p, end);
+                nameLen = p - name;
+                hash = _fnv(hash, name, p);
+            } else {
+                name = nullptr;
+            }
+        } else if (_isKey(str, p, end, F("seq"))) {
+            // номер записи лога растёт вместе с текстом
+            p = _skipValue(p + 1, end);
+        } else if (_isWindowKey(str, p, end)) {
+            // окно строк сдвигается с каждой новой строкой лога или таблицы
+            p = _skipValue(p + 1, end);
+            if (windows && name) {
+                if (winOpen) {
+                    *windows += ',';
+                } else {
+                    windows->appendRaw(name, nameLen);
+                    windows->concat(":{", 2);
+                    winOpen = true;
+                }
+                windows->appendRaw(str, p - str);
+            }
+        } else if (_isKey(str, p, end, F("value"))) {
+            hash = _fnv(hash, p, p + 1);
+            const char *val = ++p;
+            p = _skipValue(p, end);
+            if (values && name && p > val) {
+                values->appendRaw(name, nameLen);
+                *values += ':';
+                values->appendRaw(val, p - val);
+                *values += ',';
+            }
+        }
+    }
+    if (winOpen) windows->concat("},", 2);
+    return hash;
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include "macro.hpp"
+#include "utils/json.h"
+
+namespace gyverhub {
+    /**
+     * Хеш разметки собранного UI: типы, имена, подписи и все остальные поля, кроме "value", "seq" (лог)
+     * и окна строк TableView/LogView ("total", "offset", "window").
+     * Не меняется, пока меняются только значения компонентов.
+     * values (если указан) дополняется парами "имя":значение без скобок, через запятую,
+     * windows - парами "имя":{"total":..,"offset":..,"window":..}
+     */
+    uint32_t layoutHash(const char *ui, size_t len, Json *values = nullptr, Json *windows = nullptr);
+}
@@ -0,0 +1,172 @@
+#include "log.h"
+#include "hub/fs.h"
+
+// буквы уровней для префикса строки
+static const char _levelChars[] = "VIWE";
+
+size_t GHlog::write(const uint8_t* data, size_t n) {
+    if (!buffer) return n;
+    const uint8_t* end = data + n;
+    while (data < end) {
+        // \r не храним, куски между ними копируем целиком
+        const uint8_t* cr = (const uint8_t*)memchr(data, '\r', end - data);
+        const uint8_t* to = cr ? cr : end;
+        _writeSpan(data, to - data);
+        data = cr ? (cr + 1) : end;
+    }
+    return n;
+}
+
+void GHlog::_writeSpan(const uint8_t* data, size_t n) {
+    _seq += n;
+    // в кольце останутся только последние size байт
+    if (n > size) {
+        data += n - size;
+        n = size;
+    }
+    len = (len + n > size) ? size : (len + n);
+    while (n) {
+        size_t part = (n < (size_t)(size - head)) ? n : (size - head);
+        memcpy(buffer + head, data, part);
+        head += part;
+        if (head >= size) head = 0;
+        data += part;
+        n -= part;
+    }
+}
+
+bool GHlog::beginLine(gyverhub::LogLevel level, FSTR channel) {
+    if (level < minLevel || level >= gyverhub::LogLevel::OFF) return false;
+    // префикс собирается целиком и пишется одним куском
+    char prefix[24] = {_levelChars[(uint8_t)level], ' '};
+    size_t n = 2;
+    if (channel) {
+        size_t clen = strlen_P((PGM_P)channel);
+        if (clen > sizeof(prefix) - 4) clen = sizeof(prefix) - 4;
+        memcpy_P(prefix + n, (PGM_P)channel, clen);
+        n += clen;
+        prefix[n++] = ':';
+        prefix[n++] = ' ';
+    }
+    write((const uint8_t*)prefix, n);
+    return true;
+}
+
+size_t GHlogChannel::write(const uint8_t* data, size_t n) {
+    const uint8_t* end = data + n;
+    while (data < end) {
+        if (lineStart) {
+            skip = cur < minLevel || !log->beginLine(cur, name);
+            lineStart = false;
+        }
+        const uint8_t* nl = (const uint8_t*)memchr(data, '\n', end - data);
+        const uint8_t* to = nl ? (nl + 1) : end;
+        if (!skip) log->write(data, to - data);
+        if (nl) lineStart = true;
+        data = to;
+    }
+    return n;
+}
+
+#if GHC_FS != GHC_FS_NONE
+
+GHlog* GHlog::list = nullptr;
+
+void GHlog::spill(const char* dir, uint32_t fileSize, uint8_t files) {
+    if (spillDir) {
+        flush();
+        spillFile.close();
+    } else {
+        next = list;
+        list = this;
+    }
+    spillDir = dir;
+    spillSize = fileSize;
+    spillFiles = files ? files : 1;
+    // лог до вызова spill() в файл не попадает
+    spilled = _seq;
+    syncTmr.reset();
+    GHI_FS.mkdir(dir);
+}
+
+void GHlog::_unlist() {
+    for (GHlog** p = &list; *p; p = &(*p)->next) {
+        if (*p == this) {
+            *p = next;
+            break;
+        }
+    }
+}
+
+void GHlog::tickAll() {
+    for (GHlog* p = list; p; p = p->next) p->tick();
+}
+
+void GHlog::tick() {
+    if (!spillDir || !buffer) return;
+    uint32_t pending = _seq - spilled;
+    if (pending >= GHC_LOG_BLOCK) _spill(pending - pending % GHC_LOG_BLOCK);
+    if (syncTmr.isTimedOut(GHC_LOG_SYNC_MS)) _sync();
+}
+
+void GHlog::flush() {
+    if (!spillDir || !buffer) return;
+    if (_seq != spilled) _spill(_seq - spilled);
+    _sync();
+}
+
+// дописанное - на флеш и в индекс ФС. Не на каждый блок: flush() LittleFS перезаписывает метаданные
+void GHlog::_sync() {
+    syncTmr.reset();
+    if (!spillFile) return;
+    spillFile.flush();
+    char path[32];
+    snprintf(path, sizeof(path), "%s/0.txt", spillDir);
+    gyverhub::fsIndex().touch(path, spillFile.size());
+}
+
+void GHlog::_spill(uint32_t n) {
+    // не успели записать - самое старое уже затёрто
+    if (_seq - spilled > len) {
+        uint32_t oldest = _seq - len;
+        lostBytes += oldest - spilled;
+        n -= oldest - spilled;
+        spilled = oldest;
+    }
+    if (!n) return;
+
+    if (!spillFile || spillFile.size() >= spillSize) _rotate();
+    if (!spillFile) return;
+
+    uint16_t pos = (_first() + (spilled - (_seq - len))) % size;
+    uint16_t part = (n < (uint32_t)(size - pos)) ? n : (size - pos);
+    spillFile.write((const uint8_t*)buffer + pos, part);
+    if (part < n) spillFile.write((const uint8_t*)buffer, n - part);
+    spilled += n;
+}
+
+void GHlog::_rotate() {
+    char from[32], to[32];
+    bool opened = (bool)spillFile;
+    spillFile.close();
+    // первое открытие дописывает в текущий файл, если он не переполнен
+    if (!opened) {
+        snprintf(to, sizeof(to), "%s/0.txt", spillDir);
+        spillFile = GHI_FS.open(to, "a");
+        if (spillFile && spillFile.size() < spillSize) return;
+        spillFile.close();
+    }
+    snprintf(to, sizeof(to), "%s/%d.txt", spillDir, spillFiles - 1);
+    GHI_FS.remove(to);
+    for (uint8_t i = spillFiles - 1; i > 0; i--) {
+        snprintf(from, sizeof(from), "%s/%d.txt", spillDir, i - 1);
+        snprintf(to, sizeof(to), "%s/%d.txt", spillDir, i);
+        GHI_FS.rename(from, to);
+    }
+    snprintf(to, sizeof(to), "%s/0.txt", spillDir);
+    spillFile = GHI_FS.open(to, "a");
+    syncTmr.reset();
+    gyverhub::fsIndex().update(spillDir);
+}
+
+#endif
@@ -1,5 +1,19 @@
 #pragma once
 #include <Print.h>
+#include "macro.hpp"
+#include "utils/json.h"
+#include "utils/timer.h"
+
+namespace gyverhub {
+    // уровень строки лога
+    enum class LogLevel : uint8_t {
+        VERBOSE,
+        INFO,
+        WARN,
+        ERROR,
+        OFF,
+    };
+}
 
 class GHlog : public Print {
    public:
@@ -16,6 +30,14 @@ class GHlog : public Print {
     }
 
     void end() {
+#if GHC_FS != GHC_FS_NONE
+        if (spillDir) {
+            flush();
+            spillFile.close();
+            spillDir = nullptr;
+            _unlist();
+        }
+#endif
         if (buffer) {
             delete[] buffer;
             buffer = nullptr;
@@ -29,36 +51,156 @@ class GHlog : public Print {
         return 1;
     }
 
-    // virtual size_t write(const uint8_t *buffer, size_t size) {
+    // запись куском: копируется в кольцо целиком, без побайтных вызовов
+    virtual size_t write(const uint8_t* data, size_t n);
+    using Print::write;
+
+    // строки ниже уровня отбрасываются (для записи через GHlogChannel)
+    void setLevel(gyverhub::LogLevel level) {
+        minLevel = level;
+    }
+    gyverhub::LogLevel getLevel() {
+        return minLevel;
+    }
+
+    // начать строку с префиксом "W канал: ". false - уровень ниже минимального, строку не писать
+    bool beginLine(gyverhub::LogLevel level, FSTR channel = nullptr);
+
+#if GHC_FS != GHC_FS_NONE
+    // сбрасывать лог в файлы dir/0.txt (текущий), dir/1.txt ... dir/(files-1).txt.
+    // Текущий файл больше fileSize - ротация. dir должен жить всё время работы (строковая константа)
+    void spill(const char* dir = "/log", uint32_t fileSize = 16384, uint8_t files = 4);
 
-    // }
+    // записать в файл накопленное целыми блоками по GHC_LOG_BLOCK. Вызывается из GyverHub::tick()
+    void tick();
+
+    // записать в файл всё накопленное и сбросить файл на флеш
+    void flush();
+
+    // tick() всех логов со spill()
+    static void tickAll();
+
+    // сколько байт затёрто в кольце до записи в файл
+    uint32_t lost() {
+        return lostBytes;
+    }
+#endif
 
     void clear() {
         len = head = 0;
         _write('\n');
+        sent = _seq;
     }
 
+    // прочитать с первой целой строки, esc - экранировать для JSON
+    void read(gyverhub::Json* s, bool esc = false) {
+        if (!buffer) return;
+        _readSpans(s, _start(), len, esc);
+    }
     void read(String* s, bool esc = false) {
+        gyverhub::Json json;
+        read(&json, esc);
+        *s += json;
+    }
+
+    // номер следующего записанного байта, растёт с каждым write() и не сбрасывается clear()
+    uint32_t seq() {
+        return _seq;
+    }
+
+    // дописанное после since (значение seq()) с экранированием для JSON, since станет номером первого байта.
+    // false - since уже затёрт или из будущего: прочитано всё с первой целой строки
+    bool readSince(gyverhub::Json* s, uint32_t& since) {
+        if (!buffer) {
+            since = _seq;
+            return false;
+        }
+        uint32_t oldest = _seq - len;
+        if (since >= oldest && since <= _seq) {
+            _readSpans(s, since - oldest, len, true);
+            return true;
+        }
+        uint16_t start = _start();
+        since = oldest + start;
+        _readSpans(s, start, len, true);
+        return false;
+    }
+
+    // дописанное после прошлого readNew() или clear()
+    bool readNew(gyverhub::Json* s, uint32_t& from) {
+        from = sent;
+        bool ok = readSince(s, from);
+        sent = _seq;
+        return ok;
+    }
+
+    // количество строк (последняя может быть недописанной)
+    uint16_t lines() {
+        if (!buffer) return 0;
+        uint16_t start = _start();
+        if (start >= len) return 0;
+        uint16_t n = 0;
+        for (uint16_t i = start; i < len; i++) {
+            if (_read(i) == '\n') n++;
+        }
+        if (_read(len - 1) != '\n') n++;
+        return n;
+    }
+
+    // строки с from по from + count - 1 с экранированием для JSON
+    void readLines(gyverhub::Json* s, uint16_t from, uint16_t count) {
         if (!buffer) return;
-        bool start = 0;
-        for (uint16_t i = 0; i < len; i++) {
-            char c = _read(i);
-            if (start) {
-                if (esc) {
-                    if (c == '\"') *s += '\\';
-                }
-                *s += c;
-            } else if (c == '\n') start = 1;
+        uint16_t i = _start();
+        for (; from && i < len; i++) {
+            if (_read(i) == '\n') from--;
+        }
+        uint16_t begin = i;
+        for (; count && i < len; i++) {
+            if (_read(i) == '\n') count--;
         }
+        _readSpans(s, begin, i, true);
     }
 
    private:
+    // индекс самого старого байта в buffer
+    uint16_t _first() {
+        return (len < size) ? 0 : head;
+    }
+
+    // начало первой целой строки
+    uint16_t _start() {
+        uint16_t first = _first();
+        uint16_t part = (len < size - first) ? len : (size - first);
+        const char* p = (const char*)memchr(buffer + first, '\n', part);
+        if (p) return p - (buffer + first) + 1;
+        p = (const char*)memchr(buffer, '\n', len - part);
+        if (p) return part + (p - buffer) + 1;
+        return len;
+    }
+
+    // кольцо лежит в памяти не больше чем двумя кусками
+    void _readSpans(gyverhub::Json* s, uint16_t from, uint16_t to, bool esc) {
+        if (from >= to) return;
+        uint16_t pos = (_first() + from) % size;
+        uint16_t n = to - from;
+        uint16_t part = (n < size - pos) ? n : (size - pos);
+        if (esc) {
+            s->appendEscaped(buffer + pos, part, '\"');
+            if (part < n) s->appendEscaped(buffer, n - part, '\"');
+        } else {
+            s->appendRaw(buffer + pos, part);
+            if (part < n) s->appendRaw(buffer, n - part);
+        }
+    }
+
     void _write(uint8_t n) {
         if (n == '\r') return;
         if (len < size) len++;
+        _seq++;
         buffer[head] = n;
         if (++head >= size) head = 0;
     }
+    void _writeSpan(const uint8_t* data, size_t n);
     char _read(uint16_t num) {
         return buffer[(len < size) ? num : ((head + num) % size)];
     }
@@ -67,4 +209,68 @@ class GHlog : public Print {
     uint16_t size = 0;
     uint16_t len = 0;
     uint16_t head = 0;
+    uint32_t _seq = 0;
+    uint32_t sent = 0;
+    gyverhub::LogLevel minLevel = gyverhub::LogLevel::VERBOSE;
+
+#if GHC_FS != GHC_FS_NONE
+    void _spill(uint32_t n);
+    void _rotate();
+    void _sync();
+    void _unlist();
+
+    File spillFile;
+    const char* spillDir = nullptr;
+    uint32_t spillSize = 0;
+    uint32_t spilled = 0;
+    uint32_t lostBytes = 0;
+    uint8_t spillFiles = 0;
+    gyverhub::Timer syncTmr;
+    GHlog* next = nullptr;
+
+    static GHlog* list;
+#endif
+};
+
+// канал лога: строки с префиксом уровня и имени канала, свой минимальный уровень
+class GHlogChannel : public Print {
+   public:
+    GHlogChannel(GHlog* log, FSTR name = nullptr, gyverhub::LogLevel level = gyverhub::LogLevel::VERBOSE) : log(log), name(name), minLevel(level) {}
+
+    // уровень следующих строк: ch.warn().println("...")
+    Print& verbose() {
+        return _level(gyverhub::LogLevel::VERBOSE);
+    }
+    Print& info() {
+        return _level(gyverhub::LogLevel::INFO);
+    }
+    Print& warn() {
+        return _level(gyverhub::LogLevel::WARN);
+    }
+    Print& error() {
+        return _level(gyverhub::LogLevel::ERROR);
+    }
+
+    void setLevel(gyverhub::LogLevel level) {
+        minLevel = level;
+    }
+
+    virtual size_t write(uint8_t n) {
+        return write(&n, 1);
+    }
+    virtual size_t write(const uint8_t* data, size_t n);
+    using Print::write;
+
+   private:
+    Print& _level(gyverhub::LogLevel level) {
+        cur = level;
+        return *this;
+    }
+
+    GHlog* log;
+    FSTR name;
+    gyverhub::LogLevel minLevel;
+    gyverhub::LogLevel cur = gyverhub::LogLevel::INFO;
+    bool lineStart = true;
+    bool skip = false;
 };
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include "plot.h"
+
+void gyverhub::PlotSource::_writePoint(Json* json, uint32_t i) const {
+    uint32_t idx = _index(i);
+    *json += '[';
+    json->appendUnsigned(times[idx]);
+    for (uint8_t s = 0; s < nseries; s++) {
+        *json += ',';
+        _writeValue(json, idx, s);
+    }
+    *json += ']';
+}
+
+void gyverhub::PlotSource::write(Json* json, uint32_t from, uint32_t to) const {
+    if (to > len) to = len;
+    if (from >= to) return;
+    json->reserve(json->length() + (to - from) * (12 + nseries * 8));
+    for (uint32_t i = from; i < to; i++) {
+        if (i != from) *json += ',';
+        _writePoint(json, i);
+    }
+}
+
+void gyverhub::PlotSource::writeReduced(Json* json, uint32_t width) const {
+    if (!len) return;
+    uint32_t n = (width < len) ? width : len;
+    json->reserve(json->length() + n * (12 + nseries * 8));
+    _lttb(width, json);
+}
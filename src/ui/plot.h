@@ -0,0 +1,224 @@
+#pragma once
+#include "macro.hpp"
+#include "utils/json.h"
+
+// максимум серий в одном графике
+#define GHI_PLOT_SERIES 8
+
+namespace gyverhub {
+    // Largest-Triangle-Three-Buckets: выбрать m точек из n, сохранив форму графика.
+    // x(i) - абсцисса, y(i, s) - значение серии s. Серий несколько - площади треугольников
+    // складываются, выбранный индекс общий для всех. emit(i) вызывается по возрастанию i
+    template <typename X, typename Y, typename Emit>
+    uint32_t lttb(uint32_t n, uint32_t m, uint8_t series, X x, Y y, Emit emit) {
+        if (m >= n || m < 3) {
+            for (uint32_t i = 0; i < n; i++) emit(i);
+            return n;
+        }
+        if (series > GHI_PLOT_SERIES) series = GHI_PLOT_SERIES;
+        float every = (float)(n - 2) / (m - 2);
+        float ay[GHI_PLOT_SERIES], cy[GHI_PLOT_SERIES];
+        uint32_t a = 0;
+        emit(0);
+
+        for (uint32_t i = 0; i < m - 2; i++) {
+            // текущая корзина [from, to), следующая [to, next)
+            uint32_t from = (uint32_t)(i * every) + 1;
+            uint32_t to = (uint32_t)((i + 1) * every) + 1;
+            uint32_t next = (uint32_t)((i + 2) * every) + 1;
+            if (next > n) next = n;
+            if (to > next) to = next;
+
+            // вершина C - среднее следующей корзины
+            float cx = 0;
+            for (uint8_t s = 0; s < series; s++) cy[s] = 0;
+            for (uint32_t j = to; j < next; j++) {
+                cx += x(j);
+                for (uint8_t s = 0; s < series; s++) cy[s] += y(j, s);
+            }
+            uint32_t cnt = next - to;
+            if (cnt) {
+                cx /= cnt;
+                for (uint8_t s = 0; s < series; s++) cy[s] /= cnt;
+            }
+
+            // вершина A - выбранная в прошлой корзине
+            float ax = x(a);
+            for (uint8_t s = 0; s < series; s++) ay[s] = y(a, s);
+
+            float best = -1;
+            uint32_t pick = from;
+            for (uint32_t j = from; j < to; j++) {
+                float bx = x(j);
+                float area = 0;
+                for (uint8_t s = 0; s < series; s++) {
+                    float v = (ax - cx) * (y(j, s) - ay[s]) - (ax - bx) * (cy[s] - ay[s]);
+                    area += v < 0 ? -v : v;
+                }
+                if (area > best) {
+                    best = area;
+                    pick = j;
+                }
+            }
+            emit(pick);
+            a = pick;
+        }
+        emit(n - 1);
+        return m;
+    }
+
+    // Кольцевой буфер отсчётов графика: время и значения серий. Для Builder::Plot
+    class PlotSource {
+    public:
+        virtual ~PlotSource() = default;
+
+        // отсчётов в буфере
+        uint32_t length() const {
+            return len;
+        }
+
+        // серий в отсчёте
+        uint8_t series() const {
+            return nseries;
+        }
+
+        // всего добавлено отсчётов (номер следующего)
+        uint32_t seq() const {
+            return _seq;
+        }
+
+        // время отсчёта i, 0 - самый старый
+        uint32_t time(uint32_t i) const {
+            return times[_index(i)];
+        }
+
+        // значение серии s отсчёта i
+        virtual float value(uint32_t i, uint8_t s) const = 0;
+
+        // отсчёты [from, to) массивами [время,значения...] через запятую
+        void write(Json* json, uint32_t from, uint32_t to) const;
+
+        // все отсчёты, прорежённые LTTB до width точек
+        void writeReduced(Json* json, uint32_t width) const;
+
+        // отправлено до этого номера (Builder, при рассылке sendUpdate)
+        uint32_t sent = 0;
+
+        // ширина графика у клиента из последнего запроса, точек
+        uint16_t width = 0;
+
+    protected:
+        uint32_t* times = nullptr;
+        uint32_t cap = 0;
+        uint32_t head = 0;
+        uint32_t len = 0;
+        uint32_t _seq = 0;
+        uint8_t nseries = 1;
+
+        uint32_t _index(uint32_t i) const {
+            uint32_t j = head + cap - len + i;
+            return j >= cap ? j - cap : j;
+        }
+
+        virtual void _writeValue(Json* json, uint32_t idx, uint8_t s) const = 0;
+        virtual uint32_t _lttb(uint32_t width, Json* json) const = 0;
+        void _writePoint(Json* json, uint32_t i) const;
+    };
+}
+
+// Буфер графика на capacity отсчётов со значениями типа T (float, int16_t...)
+template <typename T>
+class GHplotT : public gyverhub::PlotSource {
+   public:
+    ~GHplotT() {
+        end();
+    }
+
+    // выделить буфер: capacity отсчётов по series значений
+    void begin(uint32_t capacity, uint8_t series = 1) {
+        end();
+        if (series < 1) series = 1;
+        if (series > GHI_PLOT_SERIES) series = GHI_PLOT_SERIES;
+        cap = capacity;
+        nseries = series;
+        times = new uint32_t[cap];
+        values = new T[cap * nseries];
+        clear();
+    }
+
+    void end() {
+        delete[] times;
+        delete[] values;
+        times = nullptr;
+        values = nullptr;
+        cap = len = head = 0;
+    }
+
+    // добавить отсчёт: время и значения серий (недостающие - 0)
+    void add(uint32_t time, const T* v) {
+        if (!cap) return;
+        times[head] = time;
+        memcpy(values + head * nseries, v, nseries * sizeof(T));
+        if (++head >= cap) head = 0;
+        if (len < cap) len++;
+        _seq++;
+    }
+    void add(uint32_t time, T* v) {
+        add(time, (const T*)v);
+    }
+    template <typename... V>
+    void add(uint32_t time, V... v) {
+        T buf[GHI_PLOT_SERIES] = {(T)v...};
+        add(time, (const T*)buf);
+    }
+
+    // очистить. Клиент получит график заново
+    void clear() {
+        head = len = 0;
+        sent = _seq;
+    }
+
+    // значение типа T
+    T get(uint32_t i, uint8_t s = 0) const {
+        return values[_index(i) * nseries + s];
+    }
+
+    float value(uint32_t i, uint8_t s) const override {
+        return get(i, s);
+    }
+
+   private:
+    T* values = nullptr;
+
+    void _writeValue(gyverhub::Json* json, uint32_t idx, uint8_t s) const override {
+        _append(json, values[idx * nseries + s]);
+    }
+
+    // без виртуальных вызовов на каждую точку
+    uint32_t _lttb(uint32_t width, gyverhub::Json* json) const override {
+        uint32_t t0 = len ? times[_index(0)] : 0;
+        bool first = true;
+        return gyverhub::lttb(
+            len, width, nseries,
+            [&](uint32_t i) { return (float)(times[_index(i)] - t0); },
+            [&](uint32_t i, uint8_t s) { return (float)values[_index(i) * nseries + s]; },
+            [&](uint32_t i) {
+                if (first) first = false;
+                else *json += ',';
+                _writePoint(json, i);
+            });
+    }
+
+    static void _append(gyverhub::Json* json, float v) {
+        json->appendFloat(v);
+    }
+    static void _append(gyverhub::Json* json, double v) {
+        json->appendFloat(v);
+    }
+    template <typename I>
+    static void _append(gyverhub::Json* json, I v) {
+        json->appendInteger(v);
+    }
+};
+
+typedef GHplotT<float> GHplot;
@@ -0,0 +1,56 @@
+#include "value.h"
+
+gyverhub::Value gyverhub::Value::fromType(void* var, DataType type) {
+    switch (type) {
+        case GH_STR:
+            return Value((String*) var);
+        case GH_CSTR:
+            return Value((char*) var);
+
+        case GH_BOOL:
+            return Value((bool*) var);
+        case GH_INT8:
+            return Value((int8_t*) var);
+        case GH_UINT8:
+            return Value((uint8_t*) var);
+        case GH_INT16:
+            return Value((int16_t*) var);
+        case GH_UINT16:
+            return Value((uint16_t*) var);
+        case GH_INT32:
+            return Value((int32_t*) var);
+        case GH_UINT32:
+            return Value((uint32_t*) var);
+
+        case GH_FLOAT:
+            return Value((float*) var);
+        case GH_DOUBLE:
+            return Value((double*) var);
+
+        case GH_COLOR:
+            return Value((gyverhub::Color*) var);
+        case GH_FLAGS:
+            return Value((gyverhub::Flags*) var);
+        case GH_POS:
+            return Value((gyverhub::Point*) var);
+
+        case GH_NULL:
+            break;
+    }
+    return Value();
+}
+
+bool gyverhub::Range::apply(double& value) const {
+    double v = value;
+    if (step > 0 && !isnan(minv)) {
+        double snapped = minv + round((v - minv) / step) * step;
+        // погрешность дробного шага (0.1) не считаем изменением
+        if (fabs(snapped - v) > step * 0.001) v = snapped;
+    }
+    if (v < minv) v = minv;
+    if (v > maxv) v = maxv;
+
+    if (v == value) return false;
+    value = v;
+    return true;
+}
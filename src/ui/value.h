@@ -0,0 +1,302 @@
+#pragma once
+#include "macro.hpp"
+#include "ui/color.h"
+#include "ui/flags.h"
+#include "ui/point.h"
+#include "utils/json.h"
+
+namespace gyverhub {
+    enum DataType {
+        GH_NULL,
+
+        GH_STR,
+        GH_CSTR,
+
+        GH_BOOL,
+        GH_INT8,
+        GH_UINT8,
+        GH_INT16,
+        GH_UINT16,
+        GH_INT32,
+        GH_UINT32,
+
+        GH_FLOAT,
+        GH_DOUBLE,
+
+        GH_COLOR,
+        GH_FLAGS,
+        GH_POS,
+    };
+
+    // Допустимые значения компонента (slider, spinner)
+    struct Range {
+        float minv = NAN;
+        float maxv = NAN;
+        float step = 0;
+
+        Range(float minv, float maxv, float step) : minv(minv), maxv(maxv), step(step) {}
+
+        // привести к шагу и границам, вернёт true если значение изменилось.
+        // Считается в double: целые 32 бит не теряют точность
+        bool apply(double& value) const;
+    };
+
+    /**
+     * Форматирование и парсинг значения переменной компонента.
+     * Специализации содержат:
+     * - type - соответствующий DataType
+     * - append(Json&, const T&) - вывести значение в ответ
+     * - parse(const char*, T&, const Range*) - записать в переменную значение от клиента,
+     *   при ошибке переменная не меняется
+     */
+    template <typename T>
+    struct ValueTraits;
+
+    template <typename T, bool isSigned>
+    struct IntegerTraits {
+        static constexpr DataType type = sizeof(T) == 1 ? (isSigned ? GH_INT8 : GH_UINT8)
+                                       : sizeof(T) == 2 ? (isSigned ? GH_INT16 : GH_UINT16)
+                                                        : (isSigned ? GH_INT32 : GH_UINT32);
+
+        static void append(Json& answ, const T& var) {
+            if (isSigned) answ.appendInteger((int32_t) var);
+            else answ.appendUnsigned((uint32_t) var);
+        }
+
+        static ParseStatus parse(const char* str, T& var, const Range* range) {
+            // целое без диапазона записывается как есть
+            double d;
+            ParseStatus res;
+            if (isSigned) {
+                int32_t i;
+                res = parseInteger(str, i);
+                if (res == ParseStatus::OK && !range) {
+                    if ((int32_t) (T) i != i) return ParseStatus::OUT_OF_RANGE;
+                    var = (T) i;
+                    return res;
+                }
+                d = i;
+            } else {
+                uint32_t u;
+                res = parseUnsigned(str, u);
+                if (res == ParseStatus::OK && !range) {
+                    if ((uint32_t) (T) u != u) return ParseStatus::OUT_OF_RANGE;
+                    var = (T) u;
+                    return res;
+                }
+                d = u;
+            }
+            // дробное (целый слайдер с шагом 0.5) округляется после шага и границ
+            if (res == ParseStatus::INVALID) res = parseDouble(str, d);
+            if (res != ParseStatus::OK) return res;
+            if (round(d) < _min() || round(d) > _max()) return ParseStatus::OUT_OF_RANGE;
+
+            double v = d;
+            if (range) range->apply(v);
+            v = round(v);
+            if (v < _min()) v = _min();
+            if (v > _max()) v = _max();
+            var = (T) v;
+            return v == d ? ParseStatus::OK : ParseStatus::CLAMPED;
+        }
+
+        static double _min() {
+            return isSigned ? -ldexp(1, sizeof(T) * 8 - 1) : 0;
+        }
+        static double _max() {
+            return ldexp(1, sizeof(T) * 8 - isSigned) - 1;
+        }
+    };
+
+    template <> struct ValueTraits<signed char> : IntegerTraits<signed char, true> {};
+    template <> struct ValueTraits<unsigned char> : IntegerTraits<unsigned char, false> {};
+    template <> struct ValueTraits<short> : IntegerTraits<short, true> {};
+    template <> struct ValueTraits<unsigned short> : IntegerTraits<unsigned short, false> {};
+    template <> struct ValueTraits<int> : IntegerTraits<int, true> {};
+    template <> struct ValueTraits<unsigned int> : IntegerTraits<unsigned int, false> {};
+    template <> struct ValueTraits<long> : IntegerTraits<long, true> {};
+    template <> struct ValueTraits<unsigned long> : IntegerTraits<unsigned long, false> {};
+
+    template <>
+    struct ValueTraits<bool> {
+        static constexpr DataType type = GH_BOOL;
+
+        static void append(Json& answ, const bool& var) {
+            answ += var ? '1' : '0';
+        }
+
+        static ParseStatus parse(const char* str, bool& var, const Range*) {
+            if ((str[0] != '0' && str[0] != '1') || str[1]) return ParseStatus::INVALID;
+            var = (str[0] == '1');
+            return ParseStatus::OK;
+        }
+    };
+
+    template <>
+    struct ValueTraits<float> {
+        static constexpr DataType type = GH_FLOAT;
+
+        static void append(Json& answ, const float& var) {
+            answ.appendFloat(var);
+        }
+
+        static ParseStatus parse(const char* str, float& var, const Range* range) {
+            float v;
+            ParseStatus res = parseFloat(str, v);
+            if (res != ParseStatus::OK) return res;
+            double d = v;
+            if (range && range->apply(d)) {
+                v = d;
+                res = ParseStatus::CLAMPED;
+            }
+            var = v;
+            return res;
+        }
+    };
+
+    template <>
+    struct ValueTraits<double> {
+        static constexpr DataType type = GH_DOUBLE;
+
+        static void append(Json& answ, const double& var) {
+            answ.appendDouble(var);
+        }
+
+        static ParseStatus parse(const char* str, double& var, const Range* range) {
+            double v;
+            ParseStatus res = parseDouble(str, v);
+            if (res != ParseStatus::OK) return res;
+            if (range && range->apply(v)) res = ParseStatus::CLAMPED;
+            var = v;
+            return res;
+        }
+    };
+
+    template <>
+    struct ValueTraits<String> {
+        static constexpr DataType type = GH_STR;
+
+        static void append(Json& answ, const String& var) {
+            answ.appendEscaped(var.c_str());
+        }
+
+        static ParseStatus parse(const char* str, String& var, const Range*) {
+            var = str;
+            return ParseStatus::OK;
+        }
+    };
+
+    // char* - строка, буфер должен вмещать значение от клиента
+    template <>
+    struct ValueTraits<char> {
+        static constexpr DataType type = GH_CSTR;
+
+        static void append(Json& answ, const char& var) {
+            answ.appendEscaped(&var);
+        }
+
+        static ParseStatus parse(const char* str, char& var, const Range*) {
+            strcpy(&var, str);
+            return ParseStatus::OK;
+        }
+    };
+
+    template <>
+    struct ValueTraits<Color> {
+        static constexpr DataType type = GH_COLOR;
+
+        static void append(Json& answ, const Color& var) {
+            answ.appendUnsigned(var.toHex());
+        }
+
+        static ParseStatus parse(const char* str, Color& var, const Range*) {
+            uint32_t hex;
+            ParseStatus res = parseUnsigned(str, hex);
+            if (res == ParseStatus::OK) var = Color::fromHex(hex);
+            return res;
+        }
+    };
+
+    template <>
+    struct ValueTraits<Flags> {
+        static constexpr DataType type = GH_FLAGS;
+
+        static void append(Json& answ, const Flags& var) {
+            char* str = const_cast<Flags&>(var).toString();
+            if (!str) return;
+            answ += str;
+            free(str);
+        }
+
+        static ParseStatus parse(const char* str, Flags& var, const Range*) {
+            var.set(str);
+            return ParseStatus::OK;
+        }
+    };
+
+    template <>
+    struct ValueTraits<Point> {
+        static constexpr DataType type = GH_POS;
+
+        static void append(Json& answ, const Point& var) {
+            answ.appendUnsigned(((uint32_t) (uint16_t) var.x << 16) | (uint16_t) var.y);
+        }
+
+        static ParseStatus parse(const char* str, Point& var, const Range*) {
+            uint32_t xy;
+            ParseStatus res = parseUnsigned(str, xy);
+            if (res == ParseStatus::OK) var = Point(xy >> 16, xy & 0xffff, true);
+            return res;
+        }
+    };
+
+    /**
+     * Ссылка на переменную компонента.
+     * Форматтер и парсер выбираются при компиляции по типу переменной,
+     * Value::fromType() - совместимость со старым API (void* + DataType).
+     */
+    class Value {
+    private:
+        typedef void (*AppendFn)(Json& answ, const void* var);
+        typedef ParseStatus (*ParseFn)(const char* str, void* var, const Range* range);
+
+        void* var = nullptr;
+        AppendFn appendFn = nullptr;
+        ParseFn parseFn = nullptr;
+
+        template <typename T>
+        static void _append(Json& answ, const void* var) {
+            ValueTraits<T>::append(answ, *static_cast<const T*>(var));
+        }
+
+        template <typename T>
+        static ParseStatus _parse(const char* str, void* var, const Range* range) {
+            return ValueTraits<T>::parse(str, *static_cast<T*>(var), range);
+        }
+
+    public:
+        constexpr Value() = default;
+        constexpr Value(const Value&) = default;
+
+        template <typename T, DataType = ValueTraits<T>::type>
+        constexpr Value(T* var) : var(var), appendFn(_append<T>), parseFn(_parse<T>) {}
+
+        static Value fromType(void* var, DataType type);
+
+        bool isNull() const {
+            return var == nullptr || appendFn == nullptr;
+        }
+
+        void append(Json& answ) const {
+            if (isNull()) answ += '0';
+            else appendFn(answ, var);
+        }
+
+        // range - ограничения компонента для числовых переменных, может быть nullptr
+        ParseStatus parse(const char* str, const Range* range = nullptr) const {
+            if (isNull()) return ParseStatus::OK;
+            if (!str) return ParseStatus::INVALID;
+            return parseFn(str, var, range);
+        }
+    };
+}
@@ -48,7 +48,7 @@ uint8_t *gyverhub::base64Decode(const char *data, size_t len, size_t &out_len) {
     
 
     int val = 0, valb = -8, idx = 0;
-    for (uint16_t i = 0; i < len && data[i] != '='; i++) {
+    for (size_t i = 0; i < len && data[i] != '='; i++) {
         uint8_t b = fromBase64(data[i]);
         val = (val << 6) + b;
         valb += 6;
@@ -76,6 +76,7 @@ char *gyverhub::base64Encode(const uint8_t *data, size_t len, bool pgm, size_t &
         while (valb >= 0) {
             char c = toBase64((val >> valb) & 0x3F);
             res[out_i++] = c;
+            valb -= 6;
         }
     }
 
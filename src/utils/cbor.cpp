@@ -0,0 +1,353 @@
+#include "cbor.h"
+#include "utils/number.h"
+#include "utils/base64.h"
+
+// Словарь ключей, номер ключа - его индекс. Только дописывать в конец!
+// Каждый ключ с байтом длины впереди. Копия в веб-клиенте: cbor_keys в web/src/include/parser.js
+GHI_PGM(_cborKeys,
+    "\x02" "id" "\x04" "type" "\x04" "name" "\x05" "value" "\x05" "label" "\x04" "text" "\x05" "color" "\x03" "min"
+    "\x03" "max" "\x04" "step" "\x05" "tab_w" "\x04" "size" "\x06" "height" "\x05" "width" "\x04" "rows" "\x05" "regex"
+    "\x08" "controls" "\x07" "updates" "\x04" "data" "\x04" "icon" "\x07" "version" "\x03" "PIN" "\x07" "max_upl" "\x05" "ota_t"
+    "\x07" "modules" "\x02" "fs" "\x04" "used" "\x05" "total" "\x05" "chunk" "\x06" "amount" "\x06" "active" "\x05" "align"
+    "\x04" "auto" "\x03" "exp" "\x04" "port" "\x04" "info" "\x03" "net" "\x06" "memory" "\x06" "system" "\x04" "path"
+    "\x06" "upload" "\x08" "download" "\x03" "ota"
+    "\x06" "values" "\x04" "hash" "\x04" "page"
+    "\x06" "offset" "\x06" "window"
+    "\x03" "seq" "\x04" "from" "\x05" "reset");
+
+// вложенность JSON, глубже - отказ
+#define GHI_CBOR_MAX_DEPTH 16
+
+static int _keyIndex(const char *key, size_t len) {
+    PGM_P p = _cborKeys;
+    for (int i = 0;; i++) {
+        uint8_t klen = pgm_read_byte(p);
+        if (!klen) break;
+        if (klen == len && !memcmp_P(key, p + 1, len)) return i;
+        p += klen + 1;
+    }
+    return -1;
+}
+
+void gyverhub::Cbor::_head(uint8_t major, uint64_t value) {
+    uint8_t buf[9];
+    uint8_t len;
+    major <<= 5;
+    if (value < 24) {
+        buf[0] = major | value;
+        len = 1;
+    } else if (value <= 0xff) {
+        buf[0] = major | 24;
+        buf[1] = value;
+        len = 2;
+    } else if (value <= 0xffff) {
+        buf[0] = major | 25;
+        len = 3;
+    } else if (value <= 0xfffffffful) {
+        buf[0] = major | 26;
+        len = 5;
+    } else {
+        buf[0] = major | 27;
+        len = 9;
+    }
+    // big endian
+    if (len > 2) {
+        for (uint8_t i = len - 1; i > 0; i--) {
+            buf[i] = value & 0xff;
+            value >>= 8;
+        }
+    }
+    this->concat((const char *) buf, len);
+}
+
+void gyverhub::Cbor::appendFloat(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint8_t buf[5] = {0xfa, (uint8_t) (bits >> 24), (uint8_t) (bits >> 16), (uint8_t) (bits >> 8), (uint8_t) bits};
+    this->concat((const char *) buf, 5);
+}
+
+void gyverhub::Cbor::appendDouble(double value) {
+    if (sizeof(double) == sizeof(float)) {
+        appendFloat(value);
+        return;
+    }
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint8_t buf[9];
+    buf[0] = 0xfb;
+    for (uint8_t i = 8; i > 0; i--) {
+        buf[i] = bits & 0xff;
+        bits >>= 8;
+    }
+    this->concat((const char *) buf, 9);
+}
+
+void gyverhub::Cbor::appendString(const char *str, size_t len) {
+    _head(3, len);
+    this->concat(str, len);
+}
+
+void gyverhub::Cbor::key(const char *key, size_t len) {
+    int idx = _keyIndex(key, len);
+    if (idx >= 0) _head(0, idx);
+    else appendString(key, len);
+}
+
+// ================ JSON -> CBOR ================
+
+static void _skipSpace(const char *&p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) p++;
+}
+
+static int8_t _hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool _readHex4(const char *p, const char *end, uint16_t &out) {
+    if (end - p < 4) return false;
+    out = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        int8_t h = _hexValue(p[i]);
+        if (h < 0) return false;
+        out = (out << 4) | h;
+    }
+    return true;
+}
+
+static uint8_t _utf8(uint32_t cp, char *buf) {
+    if (cp < 0x80) {
+        buf[0] = cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        buf[0] = 0xc0 | (cp >> 6);
+        buf[1] = 0x80 | (cp & 0x3f);
+        return 2;
+    }
+    if (cp < 0x10000) {
+        buf[0] = 0xe0 | (cp >> 12);
+        buf[1] = 0x80 | ((cp >> 6) & 0x3f);
+        buf[2] = 0x80 | (cp & 0x3f);
+        return 3;
+    }
+    buf[0] = 0xf0 | (cp >> 18);
+    buf[1] = 0x80 | ((cp >> 12) & 0x3f);
+    buf[2] = 0x80 | ((cp >> 6) & 0x3f);
+    buf[3] = 0x80 | (cp & 0x3f);
+    return 4;
+}
+
+// p указывает на открывающую кавычку
+bool gyverhub::Cbor::_parseString(const char *&p, const char *end, bool isKey) {
+    const char *start = ++p;
+    const char *q = start;
+    while (q < end && *q != '\"') {
+        if (*q == '\\') q++;
+        q++;
+    }
+    if (q >= end) return false;
+
+    // без экранирования - копируем как есть
+    if (!memchr(start, '\\', q - start)) {
+        if (isKey) key(start, q - start);
+        else appendString(start, q - start);
+        p = q + 1;
+        return true;
+    }
+
+    // раскодированная строка не длиннее исходной
+    char *str = (char *) malloc(q - start);
+    if (!str) return false;
+    size_t len = 0;
+    for (const char *s = start; s < q; s++) {
+        if (*s != '\\') {
+            str[len++] = *s;
+            continue;
+        }
+        s++;
+        switch (*s) {
+            case 'b': str[len++] = '\b'; break;
+            case 'f': str[len++] = '\f'; break;
+            case 'n': str[len++] = '\n'; break;
+            case 'r': str[len++] = '\r'; break;
+            case 't': str[len++] = '\t'; break;
+            case 'u': {
+                uint16_t u;
+                if (!_readHex4(s + 1, q, u)) {
+                    free(str);
+                    return false;
+                }
+                s += 4;
+                uint32_t cp = u;
+                // суррогатная пара
+                if (u >= 0xd800 && u < 0xdc00 && q - s > 6 && s[1] == '\\' && s[2] == 'u') {
+                    uint16_t lo;
+                    if (_readHex4(s + 3, q, lo) && lo >= 0xdc00 && lo < 0xe000) {
+                        cp = 0x10000 + (((uint32_t) u - 0xd800) << 10) + (lo - 0xdc00);
+                        s += 6;
+                    }
+                }
+                // одиночный суррогат не кодируется в UTF-8 - заменяем на U+FFFD, как TextDecoder
+                if (cp >= 0xd800 && cp < 0xe000) cp = 0xfffd;
+                len += _utf8(cp, str + len);
+                break;
+            }
+            default:  // " \ / и всё остальное как есть
+                str[len++] = *s;
+        }
+    }
+
+    if (isKey) key(str, len);
+    else if (len && str[0] == '\x01') _appendBinary(str + 1, len - 1);
+    else appendString(str, len);
+    free(str);
+    p = q + 1;
+    return true;
+}
+
+// "\u0001base64" (бинарные команды холста) - байтовой строкой
+void gyverhub::Cbor::_appendBinary(const char *b64, size_t len) {
+    size_t n;
+    uint8_t *data = base64Decode(b64, len, n);
+    if (!data) {
+        appendString(b64 - 1, len + 1);
+        return;
+    }
+    _head(2, n);
+    this->concat((const char *) data, n);
+    free(data);
+}
+
+bool gyverhub::Cbor::_parseValue(const char *&p, const char *end, uint8_t depth) {
+    _skipSpace(p, end);
+    if (p >= end) return false;
+
+    switch (*p) {
+        case '{':
+        case '[': {
+            if (depth >= GHI_CBOR_MAX_DEPTH) return false;
+            bool isMap = *p == '{';
+            char close = isMap ? '}' : ']';
+            if (isMap) beginMap();
+            else beginArray();
+            p++;
+
+            while (true) {
+                _skipSpace(p, end);
+                if (p >= end) return false;
+                if (*p == close) break;
+
+                if (isMap) {
+                    if (*p != '\"' || !_parseString(p, end, true)) return false;
+                    _skipSpace(p, end);
+                    if (p >= end || *p != ':') return false;
+                    p++;
+                }
+                if (!_parseValue(p, end, depth + 1)) return false;
+
+                // запятая перед закрывающей скобкой допускается
+                _skipSpace(p, end);
+                if (p < end && *p == ',') p++;
+                else if (p >= end || *p != close) return false;
+            }
+            p++;
+            endContainer();
+            return true;
+        }
+
+        case '\"':
+            return _parseString(p, end, false);
+
+        case 't':
+            if (end - p < 4 || memcmp(p, "true", 4)) return false;
+            p += 4;
+            appendBool(true);
+            return true;
+
+        case 'f':
+            if (end - p < 5 || memcmp(p, "false", 5)) return false;
+            p += 5;
+            appendBool(false);
+            return true;
+
+        case 'n':
+            if (end - p < 4 || memcmp(p, "null", 4)) return false;
+            p += 4;
+            appendNull();
+            return true;
+    }
+
+    // число
+    size_t len = 0;
+    bool isFloat = false;
+    while (p + len < end) {
+        char c = p[len];
+        if (c == '.' || c == 'e' || c == 'E') isFloat = true;
+        else if (!(c == '-' || c == '+' || (c >= '0' && c <= '9'))) break;
+        len++;
+    }
+    if (!len) return false;
+
+    // длиннее любого числа, которое помещается в double - строкой, как есть
+    char buf[GHI_NUM_BUF + 8];
+    if (len >= sizeof(buf)) {
+        appendString(p, len);
+        p += len;
+        return true;
+    }
+    memcpy(buf, p, len);
+    buf[len] = 0;
+    p += len;
+
+    if (!isFloat && _appendInteger(buf)) return true;
+    return _appendReal(buf);
+}
+
+// целое без знака до 2^64-1, со знаком до -2^64. false - не целое или не помещается
+bool gyverhub::Cbor::_appendInteger(const char *str) {
+    bool neg = str[0] == '-';
+    const char *d = neg ? str + 1 : str;
+    if (!*d) return false;
+    uint64_t v = 0;
+    for (; *d; d++) {
+        if (*d < '0' || *d > '9') return false;
+        uint8_t digit = *d - '0';
+        if (v > (UINT64_MAX - digit) / 10) return false;
+        v = v * 10 + digit;
+    }
+    if (neg && v) _head(1, v - 1);
+    else _head(0, v);
+    return true;
+}
+
+// float32, если клиент получит из него то же число (кратчайшая запись float32, как в
+// веб-клиенте), иначе float64. Не помещается в double - строкой
+bool gyverhub::Cbor::_appendReal(const char *str) {
+    // strtod, а не parseDouble: нужно то же число, что у JSON.parse на клиенте
+    char *e;
+    double d = strtod(str, &e);
+    if (e == str || *e) return false;
+    if (isinf(d)) {
+        appendString(str, strlen(str));
+        return true;
+    }
+
+    char buf[GHI_NUM_BUF + 1];
+    buf[formatFloat(buf, (float) d)] = 0;
+    if (strtod(buf, nullptr) == d) appendFloat(d);
+    else appendDouble(d);
+    return true;
+}
+
+bool gyverhub::Cbor::fromJson(const char *json, size_t len) {
+    const char *p = json;
+    const char *end = json + len;
+    reserve(length() + len / 2);
+    if (!_parseValue(p, end, 0)) return false;
+    _skipSpace(p, end);
+    return p == end;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "macro.hpp"
+
+namespace gyverhub {
+    /**
+     * CBOR (RFC 8949). Ключи из словаря (cbor.cpp, совпадает с веб-клиентом)
+     * кодируются номером, остальные - строкой. Объекты и массивы - неопределённой длины.
+     * Целые вне 64 бит и дробные, теряющие точность во float32, - float64, числа вне double - строкой.
+     * Строки "\u0001base64" (бинарные команды холста) становятся байтовыми строками.
+     * Данные бинарные, длину брать из length()
+     */
+    class Cbor : public String {
+    private:
+        void _head(uint8_t major, uint64_t value);
+        bool _parseValue(const char *&p, const char *end, uint8_t depth);
+        bool _parseString(const char *&p, const char *end, bool isKey);
+        void _appendBinary(const char *b64, size_t len);
+        bool _appendInteger(const char *str);
+        bool _appendReal(const char *str);
+
+    public:
+        void beginMap() {
+            this->concat((char) 0xbf);
+        }
+
+        void beginArray() {
+            this->concat((char) 0x9f);
+        }
+
+        // конец объекта или массива
+        void endContainer() {
+            this->concat((char) 0xff);
+        }
+
+        void appendBool(bool value) {
+            this->concat((char) (value ? 0xf5 : 0xf4));
+        }
+
+        void appendNull() {
+            this->concat((char) 0xf6);
+        }
+
+        void appendUnsigned(uint64_t value) {
+            _head(0, value);
+        }
+
+        void appendInteger(int64_t value) {
+            if (value < 0) _head(1, (uint64_t) (-(value + 1)));
+            else _head(0, value);
+        }
+
+        void appendFloat(float value);
+        void appendDouble(double value);
+        void appendString(const char *str, size_t len);
+
+        // ключ объекта: номер из словаря или строка
+        void key(const char *key, size_t len);
+        void key(FSTR key) {
+            this->key((const char *)key, strlen_P((const char *)key));
+        }
+
+        // перекодировать готовый JSON, false - JSON не разобран (содержимое не определено)
+        bool fromJson(const char *json, size_t len);
+    };
+}
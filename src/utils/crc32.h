@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace gyverhub {
+    // CRC-32 (IEEE 802.3, как в zlib и PNG) по частям: crc = crc32(data, len, crc), начальное 0
+    uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0);
+}
@@ -0,0 +1,96 @@
+#include "http.h"
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+void gyverhub::makeEtag(char *buf, uint32_t size, uint32_t mtime, bool gzip) {
+    snprintf(buf, GHI_ETAG_LEN, gzip ? "\"%lx-%lx-gz\"" : "\"%lx-%lx\"", (unsigned long) size, (unsigned long) mtime);
+}
+
+bool gyverhub::etagMatch(const char *header, const char *etag) {
+    if (!header) return false;
+    size_t len = strlen(etag);
+    while (*header) {
+        while (*header == ' ' || *header == ',') header++;
+        if (*header == '*') return true;
+        // If-None-Match сравнивается слабо: W/"x" == "x"
+        if (header[0] == 'W' && header[1] == '/') header += 2;
+        if (!strncmp(header, etag, len) && (!header[len] || header[len] == ',' || header[len] == ' ')) return true;
+        while (*header && *header != ',') header++;
+    }
+    return false;
+}
+
+// после имени в Accept-Encoding: false, если q=0 (явный отказ)
+static bool _http_q(const char *p) {
+    while (*p == ' ') p++;
+    if (*p != ';') return true;
+    p++;
+    while (*p == ' ') p++;
+    if ((*p != 'q' && *p != 'Q') || p[1] != '=') return true;
+    p += 2;
+    if (*p != '0') return true;
+    if (p[1] != '.') return false;
+    for (p += 2; *p >= '0' && *p <= '9'; p++) {
+        if (*p != '0') return true;
+    }
+    return false;
+}
+
+bool gyverhub::acceptsEncoding(const char *header, const char *enc) {
+    if (!header) return false;
+    size_t len = strlen(enc);
+    bool star = false;
+    while (*header) {
+        while (*header == ' ' || *header == ',') header++;
+        const char *end = header;
+        while (*end && *end != ',' && *end != ';' && *end != ' ') end++;
+        size_t tlen = end - header;
+        // явное имя важнее *
+        if (tlen == len && !strncasecmp(header, enc, len)) return _http_q(end);
+        if (tlen == 1 && *header == '*') star = _http_q(end);
+        header = end;
+        while (*header && *header != ',') header++;
+    }
+    return star;
+}
+
+// число без знака, false - цифр нет или переполнение
+static bool _http_num(const char *&p, uint32_t &v) {
+    if (*p < '0' || *p > '9') return false;
+    v = 0;
+    while (*p >= '0' && *p <= '9') {
+        if (v > (UINT32_MAX - 9) / 10) return false;
+        v = v * 10 + (*p++ - '0');
+    }
+    return true;
+}
+
+gyverhub::Range gyverhub::parseRange(const char *header, uint32_t size, uint32_t &from, uint32_t &to) {
+    if (!header || strncmp(header, "bytes=", 6)) return Range::Full;
+    const char *p = header + 6;
+    while (*p == ' ') p++;
+
+    if (*p == '-') {
+        // последние n байт
+        uint32_t n;
+        p++;
+        if (!_http_num(p, n)) return Range::Full;
+        if (*p) return Range::Full;
+        if (!n || !size) return Range::Invalid;
+        from = n < size ? size - n : 0;
+        to = size - 1;
+        return Range::Partial;
+    }
+
+    if (!_http_num(p, from) || *p++ != '-') return Range::Full;
+    if (*p) {
+        if (!_http_num(p, to) || to < from) return Range::Full;
+    } else {
+        to = UINT32_MAX;
+    }
+    if (*p) return Range::Full;  // несколько диапазонов - целиком
+    if (from >= size) return Range::Invalid;
+    if (to >= size) to = size - 1;
+    return Range::Partial;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// "размер-время-gz" в hex с кавычками и '\0'
+#define GHI_ETAG_LEN 24
+
+namespace gyverhub {
+    enum class Range : uint8_t {
+        Full,       // заголовка нет, он не разобран или диапазонов несколько - отдать файл целиком
+        Partial,    // отдать байты from..to включительно (206)
+        Invalid,    // диапазон за концом файла (416)
+    };
+
+    /**
+     * ETag файла по размеру и времени изменения: "1a2b-64f1c3d0"
+     * @param buf Буфер не меньше GHI_ETAG_LEN
+     * @param gzip Ответ сжат - у сжатого представления свой ETag
+     */
+    void makeEtag(char *buf, uint32_t size, uint32_t mtime, bool gzip = false);
+
+    /**
+     * Есть ли etag в заголовке If-None-Match (список через запятую, W/ или *)
+     */
+    bool etagMatch(const char *header, const char *etag);
+
+    /**
+     * Принимает ли клиент сжатие enc по заголовку Accept-Encoding ("gzip, br;q=0.5", q=0 - нет)
+     * @param header Значение заголовка, может быть nullptr
+     */
+    bool acceptsEncoding(const char *header, const char *enc);
+
+    /**
+     * Разобрать заголовок Range: bytes=from-to, bytes=from-, bytes=-suffix
+     * @param header Значение заголовка, может быть nullptr
+     * @param size Размер файла
+     */
+    Range parseRange(const char *header, uint32_t size, uint32_t &from, uint32_t &to);
+}
@@ -1,12 +1,134 @@
 #include "json.h"
 
-#ifndef strchr_P
-#ifdef ESP32
-#define strchr_P(a, b) strchr((a),(b))
-#else
-#define strchr_P(a, b) memchr_P((a),(b), strlen_P((a)))
-#endif
-#endif
+// Экранирование по RFC 8259: ", \ и управляющие символы < 0x20, плюс sym.
+// Строка проверяется словами по sizeof(size_t) байт (SWAR), чистые куски копируются целиком.
+// Строки с '\0' в конце проверяются за один проход без strlen: '\0' < 0x20 и сам останавливает поиск
+
+typedef size_t ghi_word_t;
+typedef size_t __attribute__((may_alias)) ghi_word_alias_t;
+
+static constexpr ghi_word_t _ones = (ghi_word_t) ~(ghi_word_t) 0 / 255;  // 0x0101...
+static constexpr ghi_word_t _highs = _ones * 0x80;                     // 0x8080...
+
+// есть ли в слове байт меньше n (n <= 128)
+static inline bool _hasLess(ghi_word_t w, uint8_t n) {
+    return (w - _ones * n) & ~w & _highs;
+}
+
+// есть ли в слове нулевой байт
+static inline bool _hasZero(ghi_word_t w) {
+    return (w - _ones) & ~w & _highs;
+}
+
+static inline bool _needsEscape(char c, char sym) {
+    return (uint8_t) c < 0x20 || c == '\"' || c == '\\' || c == sym;
+}
+
+// есть ли в слове символ для экранирования. sym обычно совпадает с кавычкой - тогда extra = false
+static inline bool _wordNeedsEscape(ghi_word_t w, bool extra, ghi_word_t symMask) {
+    if (_hasLess(w, 0x20) | _hasZero(w ^ (_ones * '\"')) | _hasZero(w ^ (_ones * '\\'))) return true;
+    return extra && _hasZero(w ^ symMask);
+}
+
+// индекс первого символа для экранирования начиная с i, или len
+static size_t _findEscape(const char *str, size_t i, size_t len, char sym) {
+    while (i < len && ((uintptr_t) (str + i) % sizeof(ghi_word_t))) {
+        if (_needsEscape(str[i], sym)) return i;
+        i++;
+    }
+
+    bool extra = sym != '\"' && (uint8_t) sym >= 0x20;
+    ghi_word_t symMask = _ones * (uint8_t) sym;
+    for (; i + sizeof(ghi_word_t) <= len; i += sizeof(ghi_word_t)) {
+        ghi_word_t w;
+        memcpy(&w, __builtin_assume_aligned(str + i, sizeof(ghi_word_t)), sizeof(w));
+        if (_wordNeedsEscape(w, extra, symMask)) break;
+    }
+
+    for (; i < len; i++) {
+        if (_needsEscape(str[i], sym)) return i;
+    }
+    return len;
+}
+
+// длина начала строки до '\0' или первого символа для экранирования.
+// Слово с '\0' читается целиком, как в strlen из libc: выровненное слово не выходит за страницу
+__attribute__((no_sanitize_address))
+static size_t _cleanPrefix(const char *str, char sym) {
+    const char *p = str;
+    for (; (uintptr_t) p % sizeof(ghi_word_t); p++) {
+        if (!*p || _needsEscape(*p, sym)) return p - str;
+    }
+
+    bool extra = sym != '\"' && (uint8_t) sym >= 0x20;
+    ghi_word_t symMask = _ones * (uint8_t) sym;
+    for (;; p += sizeof(ghi_word_t)) {
+        ghi_word_t w = *(const ghi_word_alias_t *) p;
+        if (_wordNeedsEscape(w, extra, symMask)) break;
+    }
+
+    while (*p && !_needsEscape(*p, sym)) p++;
+    return p - str;
+}
+
+static uint8_t _escapeSeq(char c, char *buf) {
+    buf[0] = '\\';
+    switch (c) {
+        case '\b': buf[1] = 'b'; return 2;
+        case '\f': buf[1] = 'f'; return 2;
+        case '\n': buf[1] = 'n'; return 2;
+        case '\r': buf[1] = 'r'; return 2;
+        case '\t': buf[1] = 't'; return 2;
+    }
+    if ((uint8_t) c >= 0x20) {
+        buf[1] = c;
+        return 2;
+    }
+    static const char hex[] = "0123456789abcdef";
+    memcpy(buf + 1, "u00", 3);
+    buf[4] = hex[(uint8_t) c >> 4];
+    buf[5] = hex[c & 0xf];
+    return 6;
+}
+
+void gyverhub::Json::_escape(const char *str, size_t len, char sym) {
+    size_t i = _findEscape(str, 0, len, sym);
+    if (i == len) concat(str, len);
+    else _escapeFrom(str, i, len, sym);
+}
+
+// str до '\0': чистая строка (частый случай - подписи, имена) копируется сразу после одного прохода
+void gyverhub::Json::_escapeStr(const char *str, char sym) {
+    size_t i = _cleanPrefix(str, sym);
+    if (!str[i]) concat(str, i);
+    else _escapeFrom(str, i, i + strlen(str + i), sym);
+}
+
+// следующий символ для экранирования после j. В строке, где они уже встретились,
+// чистые куски обычно короткие - слова только добавили бы выравнивание на каждый кусок
+static inline size_t _nextEscape(const char *str, size_t j, size_t len, char sym) {
+    while (++j < len && !_needsEscape(str[j], sym));
+    return j;
+}
+
+// i - первый символ для экранирования
+void gyverhub::Json::_escapeFrom(const char *str, size_t i, size_t len, char sym) {
+    // точный размер вместо худшего случая (x6) - на МК память дороже второго прохода
+    char seq[6];
+    size_t extra = 0;
+    for (size_t j = i; j < len; j = _nextEscape(str, j, len, sym)) {
+        extra += _escapeSeq(str[j], seq) - 1;
+    }
+    reserve(length() + len + extra);
+
+    size_t start = 0;
+    for (size_t j = i; j < len; j = _nextEscape(str, j, len, sym)) {
+        concat(str + start, j - start);
+        concat(seq, _escapeSeq(str[j], seq));
+        start = j + 1;
+    }
+    concat(str + start, len - start);
+}
 
 void gyverhub::Json::appendEscaped(const void *str, bool fstr, char sym) {
     if (fstr) appendEscaped((FSTR) str, sym);
@@ -15,49 +137,30 @@ void gyverhub::Json::appendEscaped(const void *str, bool fstr, char sym) {
 
 void gyverhub::Json::appendEscaped(const String &str, char sym) {
     if (!str) return;
-
-    if (str.indexOf(sym) == -1) {
-        concat(str);
-        return;
-    }
-    
-    uint16_t len = str.length();
-    for (uint16_t i = 0; i < len; i++) {
-        char c = str[i];
-        if (c == sym) concat('\\');
-        concat(c);
-    }
+    _escape(str.c_str(), str.length(), sym);
 }
 
 void gyverhub::Json::appendEscaped(const char *str, char sym) {
     if (!str) return;
-
-    if (strchr(str, sym) == 0) {
-        concat(str);
-        return;
-    }
-    
-    uint16_t len = strlen(str);
-    for (uint16_t i = 0; i < len; i++) {
-        char c = str[i];
-        if (c == sym) concat('\\');
-        concat(c);
-    }
+    _escapeStr(str, sym);
 }
 
 void gyverhub::Json::appendEscaped(FSTR fstr, char sym) {
     const char *str = (const char *)fstr;
     if (!str) return;
 
-    if (strchr_P(str, sym) == 0) {
-        concat(fstr);
-        return;
-    }
-
-    uint16_t len = strlen_P(str);
-    for (uint16_t i = 0; i < len; i++) {
-        char c = pgm_read_byte(str + i);
-        if (c == sym) concat('\\');
-        concat(c);
+#ifdef ESP32
+    // PROGMEM отображён в адресное пространство, читается как обычная память
+    _escapeStr(str, sym);
+#else
+    size_t len = strlen_P(str);
+    // копируем кусками в стек, экранирование побайтное - границы кусков не важны
+    reserve(length() + len);
+    char buf[32];
+    for (size_t i = 0; i < len; i += sizeof(buf)) {
+        size_t n = min(sizeof(buf), len - i);
+        memcpy_P(buf, str + i, n);
+        _escape(buf, n, sym);
     }
+#endif
 }
@@ -1,13 +1,23 @@
 #pragma once
 #include "macro.hpp"
+#include "utils/number.h"
 
 namespace gyverhub {
     class Json : public String {
+    private:
+        void _escape(const char *str, size_t len, char sym);
+        void _escapeStr(const char *str, char sym);
+        void _escapeFrom(const char *str, size_t i, size_t len, char sym);
+
     public:
+        // строка с экранированием для JSON, sym - дополнительный экранируемый символ
         void appendEscaped(const char *str, char sym = '\"');
         void appendEscaped(FSTR str, char sym = '\"');
         void appendEscaped(const void *str, bool fstr, char sym = '\"');
         void appendEscaped(const String &str, char sym = '\"');
+        void appendEscaped(const char *str, size_t len, char sym) {
+            _escape(str, len, sym);
+        }
 
         void begin() {
             this->concat(F("\n{"));
@@ -21,6 +31,11 @@ namespace gyverhub {
             } else this->concat(F("}\n"));
         }
 
+        // готовый фрагмент JSON как есть
+        void appendRaw(const char *data, size_t len) {
+            this->concat(data, len);
+        }
+
         void appendStringRaw(FSTR data) {
             this->concat("\"", 1);
             this->concat(data);
@@ -86,13 +101,36 @@ namespace gyverhub {
             if (!last) this->concat(",", 1);
         }
 
+        // числа пишутся через стековый буфер одним concat, без временных String
+        void appendInteger(int32_t value) {
+            char buf[GHI_NUM_BUF];
+            this->concat(buf, formatInteger(buf, value));
+        }
+
+        void appendUnsigned(uint32_t value) {
+            char buf[GHI_NUM_BUF];
+            this->concat(buf, formatUnsigned(buf, value));
+        }
+
+        void appendFloat(float value) {
+            char buf[GHI_NUM_BUF];
+            this->concat(buf, formatFloat(buf, value));
+        }
+
+        void appendDouble(double value) {
+            char buf[GHI_NUM_BUF];
+            this->concat(buf, formatDouble(buf, value));
+        }
+
+        void appendFixed(float value, uint8_t decimals) {
+            char buf[GHI_NUM_BUF];
+            this->concat(buf, formatFixed(buf, value, decimals));
+        }
+
         void itemInteger(FSTR key, uint64_t value) {
             this->key(key);
-#if GHI_ESP_BUILD
-            this->concat(value);
-#else
-            this->concat((unsigned long) value);
-#endif
+            char buf[GHI_NUM_BUF];
+            this->concat(buf, formatUnsigned(buf, value));
             this->concat(",", 1);
         }
 
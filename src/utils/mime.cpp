@@ -110,3 +110,11 @@ PGM_P gyverhub::getMimeByPath(const char *path, size_t length, bool *isGzip) {
 
     return mime;
 }
+
+bool gyverhub::isCompressible(PGM_P mime) {
+    // ext_* - расширение и тип одной строкой, сравнение по указателю.
+    // defaultMime - неизвестное расширение, может быть что угодно
+    if (mime == defaultMime) return false;
+    return !strncmp_P("text/", mime, 5) || mime == ext_js + 2 || mime == ext_json + 4 ||
+           mime == ext_xml + 3 || mime == ext_svg + 3;
+}
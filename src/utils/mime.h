@@ -20,4 +20,10 @@ namespace gyverhub {
      * @returns MIME тип файла (например, text/plain)
      */
     PGM_P getMimeByPath(const char *path, size_t length, bool *isGzip = nullptr);
+
+    /**
+     * Сжимается ли такой тип (текст, JSON, JS, XML, SVG)
+     * @param mime MIME тип из getMimeByExt/getMimeByPath
+     */
+    bool isCompressible(PGM_P mime);
 }
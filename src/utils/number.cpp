@@ -0,0 +1,544 @@
+#include "number.h"
+#include <Arduino.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static const char _digitPairs[] PROGMEM =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const uint32_t _pow10[] PROGMEM = {
+    1ul, 10ul, 100ul, 1000ul, 10000ul, 100000ul, 1000000ul, 10000000ul, 100000000ul, 1000000000ul
+};
+
+static uint8_t _countDigits(uint32_t value) {
+    uint8_t n = 1;
+    while (n < 10 && value >= pgm_read_dword(_pow10 + n)) n++;
+    return n;
+}
+
+// пишет ровно len цифр value справа налево, по две за шаг
+static void _writeDigits(char *buf, uint32_t value, uint8_t len) {
+    char *p = buf + len;
+    while (value >= 100) {
+        uint8_t i = (value % 100) * 2;
+        value /= 100;
+        *--p = pgm_read_byte(_digitPairs + i + 1);
+        *--p = pgm_read_byte(_digitPairs + i);
+    }
+    if (value >= 10) {
+        uint8_t i = value * 2;
+        *--p = pgm_read_byte(_digitPairs + i + 1);
+        *--p = pgm_read_byte(_digitPairs + i);
+    } else {
+        *--p = '0' + value;
+    }
+    while (p > buf) *--p = '0';
+}
+
+size_t gyverhub::formatUnsigned(char *buf, uint32_t value) {
+    uint8_t len = _countDigits(value);
+    _writeDigits(buf, value, len);
+    return len;
+}
+
+size_t gyverhub::formatUnsigned(char *buf, uint64_t value) {
+    if (value <= 0xfffffffful) return formatUnsigned(buf, (uint32_t) value);
+
+    // старшая часть рекурсивно, младшие 9 цифр с ведущими нулями
+    uint64_t hi = value / 1000000000ul;
+    size_t len = formatUnsigned(buf, hi);
+    _writeDigits(buf + len, (uint32_t) (value - hi * 1000000000ul), 9);
+    return len + 9;
+}
+
+size_t gyverhub::formatInteger(char *buf, int32_t value) {
+    if (value >= 0) return formatUnsigned(buf, (uint32_t) value);
+    buf[0] = '-';
+    return formatUnsigned(buf + 1, (uint32_t) 0 - (uint32_t) value) + 1;
+}
+
+// ================ float -> кратчайшая запись ================
+// алгоритм Ryu (Ulf Adams, 2018) для 32-битного float
+
+#define GHI_FLOAT_MANTISSA_BITS 23
+#define GHI_FLOAT_BIAS 127
+#define GHI_FLOAT_POW5_INV_BITCOUNT 59
+#define GHI_FLOAT_POW5_BITCOUNT 61
+
+static const uint64_t _pow5InvSplit[31] PROGMEM = {
+    576460752303423489ull, 461168601842738791ull, 368934881474191033ull,
+    295147905179352826ull, 472236648286964522ull, 377789318629571618ull,
+    302231454903657294ull, 483570327845851670ull, 386856262276681336ull,
+    309485009821345069ull, 495176015714152110ull, 396140812571321688ull,
+    316912650057057351ull, 507060240091291761ull, 405648192073033409ull,
+    324518553658426727ull, 519229685853482763ull, 415383748682786211ull,
+    332306998946228969ull, 531691198313966350ull, 425352958651173080ull,
+    340282366920938464ull, 544451787073501542ull, 435561429658801234ull,
+    348449143727040987ull, 557518629963265579ull, 446014903970612463ull,
+    356811923176489971ull, 570899077082383953ull, 456719261665907162ull,
+    365375409332725730ull,
+};
+
+static const uint64_t _pow5Split[47] PROGMEM = {
+    1152921504606846976ull, 1441151880758558720ull, 1801439850948198400ull,
+    2251799813685248000ull, 1407374883553280000ull, 1759218604441600000ull,
+    2199023255552000000ull, 1374389534720000000ull, 1717986918400000000ull,
+    2147483648000000000ull, 1342177280000000000ull, 1677721600000000000ull,
+    2097152000000000000ull, 1310720000000000000ull, 1638400000000000000ull,
+    2048000000000000000ull, 1280000000000000000ull, 1600000000000000000ull,
+    2000000000000000000ull, 1250000000000000000ull, 1562500000000000000ull,
+    1953125000000000000ull, 1220703125000000000ull, 1525878906250000000ull,
+    1907348632812500000ull, 1192092895507812500ull, 1490116119384765625ull,
+    1862645149230957031ull, 1164153218269348144ull, 1455191522836685180ull,
+    1818989403545856475ull, 2273736754432320594ull, 1421085471520200371ull,
+    1776356839400250464ull, 2220446049250313080ull, 1387778780781445675ull,
+    1734723475976807094ull, 2168404344971008868ull, 1355252715606880542ull,
+    1694065894508600678ull, 2117582368135750847ull, 1323488980084844279ull,
+    1654361225106055349ull, 2067951531382569187ull, 1292469707114105741ull,
+    1615587133892632177ull, 2019483917365790221ull,
+};
+
+static uint64_t _readSplit(const uint64_t *table, uint32_t i) {
+    uint64_t v;
+    memcpy_P(&v, table + i, sizeof(v));
+    return v;
+}
+
+// ceil(log2(5^e)), 1 при e == 0
+static int32_t _pow5bits(int32_t e) {
+    return (int32_t) (((uint32_t) e * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e))
+static uint32_t _log10Pow2(int32_t e) {
+    return ((uint32_t) e * 78913) >> 18;
+}
+
+// floor(log10(5^e))
+static uint32_t _log10Pow5(int32_t e) {
+    return ((uint32_t) e * 732923) >> 20;
+}
+
+static bool _multipleOfPow5(uint32_t value, uint32_t p) {
+    uint32_t count = 0;
+    while (value % 5 == 0) {
+        value /= 5;
+        count++;
+    }
+    return count >= p;
+}
+
+static bool _multipleOfPow2(uint32_t value, uint32_t p) {
+    return (value & ((1ul << p) - 1)) == 0;
+}
+
+static uint32_t _mulShift(uint32_t m, uint64_t factor, int32_t shift) {
+    uint64_t lo = (uint64_t) m * (uint32_t) factor;
+    uint64_t hi = (uint64_t) m * (uint32_t) (factor >> 32);
+    return (uint32_t) (((lo >> 32) + hi) >> (shift - 32));
+}
+
+// value = digits * 10^exp, без нулей в конце digits. Только для конечных value != 0
+static void _shortest(float value, uint32_t &digits, int32_t &exp) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t ieeeMantissa = bits & ((1ul << GHI_FLOAT_MANTISSA_BITS) - 1);
+    uint32_t ieeeExponent = (bits >> GHI_FLOAT_MANTISSA_BITS) & 0xff;
+
+    int32_t e2;
+    uint32_t m2;
+    if (ieeeExponent == 0) {
+        e2 = 1 - GHI_FLOAT_BIAS - GHI_FLOAT_MANTISSA_BITS - 2;
+        m2 = ieeeMantissa;
+    } else {
+        e2 = (int32_t) ieeeExponent - GHI_FLOAT_BIAS - GHI_FLOAT_MANTISSA_BITS - 2;
+        m2 = (1ul << GHI_FLOAT_MANTISSA_BITS) | ieeeMantissa;
+    }
+    bool acceptBounds = (m2 & 1) == 0;
+
+    // границы интервала, все числа внутри которого читаются обратно как value
+    uint32_t mv = 4 * m2;
+    uint32_t mp = 4 * m2 + 2;
+    uint32_t mmShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+    uint32_t mm = 4 * m2 - 1 - mmShift;
+
+    uint32_t vr, vp, vm;
+    int32_t e10;
+    bool vmIsTrailingZeros = false, vrIsTrailingZeros = false;
+    uint8_t lastRemovedDigit = 0;
+
+    if (e2 >= 0) {
+        uint32_t q = _log10Pow2(e2);
+        e10 = (int32_t) q;
+        int32_t k = GHI_FLOAT_POW5_INV_BITCOUNT + _pow5bits((int32_t) q) - 1;
+        int32_t i = -e2 + (int32_t) q + k;
+        uint64_t split = _readSplit(_pow5InvSplit, q);
+        vr = _mulShift(mv, split, i);
+        vp = _mulShift(mp, split, i);
+        vm = _mulShift(mm, split, i);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            int32_t l = GHI_FLOAT_POW5_INV_BITCOUNT + _pow5bits((int32_t) (q - 1)) - 1;
+            lastRemovedDigit = _mulShift(mv, _readSplit(_pow5InvSplit, q - 1), -e2 + (int32_t) q - 1 + l) % 10;
+        }
+        if (q <= 9) {
+            if (mv % 5 == 0) vrIsTrailingZeros = _multipleOfPow5(mv, q);
+            else if (acceptBounds) vmIsTrailingZeros = _multipleOfPow5(mm, q);
+            else vp -= _multipleOfPow5(mp, q);
+        }
+    } else {
+        uint32_t q = _log10Pow5(-e2);
+        e10 = (int32_t) q + e2;
+        int32_t i = -e2 - (int32_t) q;
+        int32_t k = _pow5bits(i) - GHI_FLOAT_POW5_BITCOUNT;
+        int32_t j = (int32_t) q - k;
+        uint64_t split = _readSplit(_pow5Split, i);
+        vr = _mulShift(mv, split, j);
+        vp = _mulShift(mp, split, j);
+        vm = _mulShift(mm, split, j);
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            j = (int32_t) q - 1 - (_pow5bits(i + 1) - GHI_FLOAT_POW5_BITCOUNT);
+            lastRemovedDigit = _mulShift(mv, _readSplit(_pow5Split, i + 1), j) % 10;
+        }
+        if (q <= 1) {
+            vrIsTrailingZeros = true;
+            if (acceptBounds) vmIsTrailingZeros = mmShift == 1;
+            else --vp;
+        } else if (q < 31) {
+            vrIsTrailingZeros = _multipleOfPow2(mv, q - 1);
+        }
+    }
+
+    // отбрасываем цифры, пока в интервале остаётся больше одного кандидата
+    int32_t removed = 0;
+    if (vmIsTrailingZeros || vrIsTrailingZeros) {
+        while (vp / 10 > vm / 10) {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vmIsTrailingZeros) {
+            while (vm % 10 == 0) {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = vr % 10;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) lastRemovedDigit = 4;
+        digits = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+    } else {
+        while (vp / 10 > vm / 10) {
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        digits = vr + (vr == vm || lastRemovedDigit >= 5);
+    }
+    exp = e10 + removed;
+
+    while (digits % 10 == 0) {
+        digits /= 10;
+        exp++;
+    }
+}
+
+// цифры d (len штук) с точкой в позиции point относительно первой цифры
+static char *_layout(char *p, const char *d, int32_t len, int32_t point) {
+    // как Number.toString в JS: экспонента только для очень больших и маленьких чисел
+    if (point > 0 && point <= 21) {
+        if (point >= len) {
+            memcpy(p, d, len);
+            p += len;
+            for (int32_t i = len; i < point; i++) *p++ = '0';
+        } else {
+            memcpy(p, d, point);
+            p += point;
+            *p++ = '.';
+            memcpy(p, d + point, len - point);
+            p += len - point;
+        }
+    } else if (point <= 0 && point > -6) {
+        *p++ = '0';
+        *p++ = '.';
+        for (int32_t i = point; i < 0; i++) *p++ = '0';
+        memcpy(p, d, len);
+        p += len;
+    } else {
+        *p++ = d[0];
+        if (len > 1) {
+            *p++ = '.';
+            memcpy(p, d + 1, len - 1);
+            p += len - 1;
+        }
+        *p++ = 'e';
+        int32_t e = point - 1;
+        if (e < 0) {
+            *p++ = '-';
+            e = -e;
+        } else {
+            *p++ = '+';
+        }
+        p += gyverhub::formatUnsigned(p, (uint32_t) e);
+    }
+    return p;
+}
+
+size_t gyverhub::formatFloat(char *buf, float value) {
+    // NaN и бесконечность не представимы в JSON
+    if (!isfinite(value) || value == 0) {
+        buf[0] = '0';
+        return 1;
+    }
+
+    char *p = buf;
+    if (value < 0) *p++ = '-';
+
+    uint32_t digits;
+    int32_t exp;
+    _shortest(value, digits, exp);
+
+    char d[10];
+    int32_t len = formatUnsigned(d, digits);
+    return _layout(p, d, len, len + exp) - buf;
+}
+
+size_t gyverhub::formatDouble(char *buf, double value) {
+    if (sizeof(double) == sizeof(float)) return formatFloat(buf, value);  // AVR
+    if (!isfinite(value) || value == 0) {
+        buf[0] = '0';
+        return 1;
+    }
+
+    // 15 значащих цифр читаются обратно в то же double почти всегда, иначе 16 или 17.
+    // Если читается запись короче, она получается из 15 цифр отбрасыванием нулей.
+    // У денормализованных точность ниже и короткую запись ищем с одной цифры
+    double mag = fabs(value);
+    char tmp[32];
+    for (uint8_t prec = mag < DBL_MIN ? 1 : 15; prec <= 17; prec++) {
+        snprintf(tmp, sizeof(tmp), "%.*e", prec - 1, mag);
+        if (prec == 17 || strtod(tmp, nullptr) == mag) break;
+    }
+
+    // tmp: d.dddde[+-]xx
+    char d[17];
+    int32_t len = 0;
+    const char *s = tmp;
+    for (; *s && *s != 'e'; s++) {
+        if (*s != '.') d[len++] = *s;
+    }
+    int32_t exp = atoi(s + 1);
+    while (len > 1 && d[len - 1] == '0') len--;
+
+    char *p = buf;
+    if (value < 0) *p++ = '-';
+    return _layout(p, d, len, exp + 1) - buf;
+}
+
+size_t gyverhub::formatFixed(char *buf, float value, uint8_t decimals) {
+    if (!isfinite(value)) {
+        buf[0] = '0';
+        return 1;
+    }
+    if (decimals > 9) decimals = 9;
+
+    uint32_t div = pgm_read_dword(_pow10 + decimals);
+    double scaled = fabs((double) value) * div + 0.5;
+    if (scaled >= 4294967295.0) return formatFloat(buf, value);  // не влезает в uint32_t
+
+    uint32_t n = (uint32_t) scaled;
+    char *p = buf;
+    if (value < 0 && n) *p++ = '-';
+    p += formatUnsigned(p, n / div);
+    if (decimals) {
+        *p++ = '.';
+        _writeDigits(p, n % div, decimals);
+        p += decimals;
+    }
+    return p - buf;
+}
+
+uint8_t gyverhub::decimalsOf(float step) {
+    if (!isfinite(step) || step == 0) return 0;
+
+    uint32_t digits;
+    int32_t exp;
+    _shortest(step, digits, exp);
+    if (exp >= 0) return 0;
+    return exp < -9 ? 9 : -exp;
+}
+
+// ================ разбор ================
+
+static bool _isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// str должна целиком состоять из цифр, не пустая
+static gyverhub::ParseStatus _parseDigits(const char *str, uint32_t limit, uint32_t &value) {
+    if (!str || !_isDigit(*str)) return gyverhub::ParseStatus::INVALID;
+
+    uint32_t v = 0;
+    bool overflow = false;
+    for (; _isDigit(*str); str++) {
+        uint8_t d = *str - '0';
+        if (v > (limit - d) / 10) overflow = true;
+        else v = v * 10 + d;
+    }
+    if (*str) return gyverhub::ParseStatus::INVALID;
+    if (overflow) return gyverhub::ParseStatus::OUT_OF_RANGE;
+    value = v;
+    return gyverhub::ParseStatus::OK;
+}
+
+gyverhub::ParseStatus gyverhub::parseUnsigned(const char *str, uint32_t &value) {
+    return _parseDigits(str, 0xfffffffful, value);
+}
+
+gyverhub::ParseStatus gyverhub::parseInteger(const char *str, int32_t &value) {
+    bool neg = str && *str == '-';
+    uint32_t v;
+    ParseStatus res = _parseDigits(neg ? str + 1 : str, neg ? 0x80000000ul : 0x7ffffffful, v);
+    if (res == ParseStatus::OK) value = neg ? (int32_t) ((uint32_t) 0 - v) : (int32_t) v;
+    return res;
+}
+
+// Десятичная запись -> neg, mant * 10^exp. Значащие цифры сверх maxDigits отбрасываются,
+// если среди них есть ненулевые - exact = false
+template <typename M>
+static bool _scanDecimal(const char *str, uint8_t maxDigits, bool &neg, M &mant, int32_t &exp, bool &exact) {
+    if (!str) return false;
+    neg = *str == '-';
+    if (neg) str++;
+
+    mant = 0;
+    exp = 0;
+    exact = true;
+    uint8_t digits = 0;
+    bool any = false;
+
+    for (; _isDigit(*str); str++) {
+        any = true;
+        if (digits < maxDigits) {
+            mant = mant * 10 + (*str - '0');
+            if (mant) digits++;
+        } else {
+            exp++;
+            if (*str != '0') exact = false;
+        }
+    }
+    if (*str == '.') {
+        str++;
+        for (; _isDigit(*str); str++) {
+            any = true;
+            if (digits < maxDigits) {
+                mant = mant * 10 + (*str - '0');
+                if (mant) digits++;
+                exp--;
+            } else if (*str != '0') {
+                exact = false;
+            }
+        }
+    }
+    if (!any) return false;
+
+    if (*str == 'e' || *str == 'E') {
+        str++;
+        bool eneg = *str == '-';
+        if (eneg || *str == '+') str++;
+        if (!_isDigit(*str)) return false;
+        int32_t e = 0;
+        for (; _isDigit(*str); str++) {
+            if (e < 10000) e = e * 10 + (*str - '0');
+        }
+        exp += eneg ? -e : e;
+    }
+    return *str == 0;
+}
+
+// точно представимые в float степени 10
+static const float _pow10f[] PROGMEM = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+// точно представимые в double степени 10
+static const double _pow10d[] PROGMEM = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Быстрый путь (Clinger): мантисса и степень 10 точны в типе, одно умножение или деление
+// округляется правильно. Остальное разбирает strtod/strtof из libc - дольше, но тоже
+// с правильным округлением, чтобы записанное formatFloat/formatDouble читалось обратно в то же число
+
+gyverhub::ParseStatus gyverhub::parseFloat(const char *str, float &value) {
+    bool neg, exact;
+    uint32_t mant;
+    int32_t exp;
+    if (!_scanDecimal(str, 9, neg, mant, exp, exact)) return ParseStatus::INVALID;
+
+    float v;
+    if (exact && mant <= (1ul << 24) && exp >= -10 && exp <= 10) {
+        // без программного double (на ESP32 FPU только одинарной точности)
+        float p;
+        memcpy_P(&p, _pow10f + (exp < 0 ? -exp : exp), sizeof(p));
+        v = exp < 0 ? mant / p : mant * p;
+        if (neg) v = -v;
+    } else {
+#ifdef __AVR__
+        v = strtod(str, nullptr);
+#else
+        v = strtof(str, nullptr);
+#endif
+    }
+    if (isinf(v)) return ParseStatus::OUT_OF_RANGE;
+
+    value = v;
+    return ParseStatus::OK;
+}
+
+gyverhub::ParseStatus gyverhub::parseDouble(const char *str, double &value) {
+    if (sizeof(double) == sizeof(float)) {  // AVR
+        float f;
+        ParseStatus res = parseFloat(str, f);
+        if (res == ParseStatus::OK) value = f;
+        return res;
+    }
+
+    bool neg, exact;
+    uint64_t mant;
+    int32_t exp;
+    if (!_scanDecimal(str, 19, neg, mant, exp, exact)) return ParseStatus::INVALID;
+
+    double v;
+    if (exact && mant <= (1ull << 53) && exp >= -22 && exp <= 22) {
+        double p;
+        memcpy_P(&p, _pow10d + (exp < 0 ? -exp : exp), sizeof(p));
+        v = exp < 0 ? mant / p : mant * p;
+        if (neg) v = -v;
+    } else {
+        v = strtod(str, nullptr);
+    }
+    if (isinf(v)) return ParseStatus::OUT_OF_RANGE;
+
+    value = v;
+    return ParseStatus::OK;
+}
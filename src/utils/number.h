@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// размер буфера, достаточный для любого числа из этого модуля
+#define GHI_NUM_BUF 26
+
+namespace gyverhub {
+    enum class ParseStatus : uint8_t {
+        OK,
+        CLAMPED,  // значение приведено к допустимому диапазону компонента
+        INVALID,  // не число или лишние символы после числа
+        OUT_OF_RANGE,  // не помещается в тип переменной
+    };
+
+    // Все функции пишут число в buf без '\0' и возвращают длину
+
+    size_t formatUnsigned(char *buf, uint32_t value);
+    size_t formatUnsigned(char *buf, uint64_t value);
+    size_t formatInteger(char *buf, int32_t value);
+
+    // Кратчайшая запись, из которой читается то же самое float (как Number.toString в JS)
+    size_t formatFloat(char *buf, float value);
+
+    // То же для double: кратчайшая из 15-17 значащих цифр (на AVR double == float)
+    size_t formatDouble(char *buf, double value);
+
+    // Фиксированное число знаков после точки (не больше 9)
+    size_t formatFixed(char *buf, float value, uint8_t decimals);
+
+    // Количество знаков после точки в кратчайшей записи шага: 0.5 -> 1, 0.01 -> 2, 5 -> 0
+    uint8_t decimalsOf(float step);
+
+    // Разбор всей строки целиком, без пробелов и '+'. При ошибке value не меняется
+
+    ParseStatus parseUnsigned(const char *str, uint32_t &value);
+    ParseStatus parseInteger(const char *str, int32_t &value);
+
+    // Десятичная запись с необязательной экспонентой: -12.5, .5, 1e-3
+    ParseStatus parseFloat(const char *str, float &value);
+    ParseStatus parseDouble(const char *str, double &value);
+}
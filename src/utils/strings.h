@@ -17,7 +17,8 @@ namespace gyverhub {
                 char* div = (char*)memchr(url, '/', len);
                 str[i] = url;
                 size++;
-                if (div == nullptr || i >= SIZE)
+                // последняя часть - остаток строки целиком (путь файла в NAME)
+                if (div == nullptr || i + 1 >= SIZE)
                     break;
                 
                 size_t divlen = div - url;  // div >= url, see memchr logic
@@ -0,0 +1,274 @@
+#pragma once
+// минимальное ядро Arduino для тестов на ПК (pio test -e native)
+// только то, что использует библиотека при сборке без ESP
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <type_traits>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+template <class T>
+inline T *_pgm_word(T *const *p) { return *p; }
+inline uint16_t _pgm_word(const void *p) { return *(const uint16_t *)p; }
+#define pgm_read_word(p) _pgm_word(p)
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p) (*(void *const *)(p))
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define memcmp_P memcmp
+#define memcpy_P memcpy
+#define memchr_P memchr
+#define strchr_P strchr
+
+#define TWO_PI 6.283185307179586476925286766559
+#define HEX 16
+#define DEC 10
+
+template <class A, class B>
+auto min(A a, B b) -> typename std::common_type<A, B>::type { return a < b ? a : b; }
+template <class A, class B>
+auto max(A a, B b) -> typename std::common_type<A, B>::type { return a > b ? a : b; }
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline unsigned long micros() {
+    static auto t0 = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count();
+}
+inline unsigned long millis() { return micros() / 1000; }
+inline void delay(unsigned long) {}
+inline void yield() {}
+
+inline char *ultoa(unsigned long v, char *b, int r) {
+    sprintf(b, r == 16 ? "%lx" : "%lu", v);
+    return b;
+}
+inline char *ltoa(long v, char *b, int) {
+    sprintf(b, "%ld", v);
+    return b;
+}
+inline char *itoa(int v, char *b, int) {
+    sprintf(b, "%d", v);
+    return b;
+}
+
+class String {
+   public:
+    String() {}
+    String(const char *c) {
+        if (c) _app(c, strlen(c));
+    }
+    String(const char *c, size_t n) { _app(c, n); }
+    String(const uint8_t *c, size_t n) { _app((const char *)c, n); }
+    String(const __FlashStringHelper *c) : String((const char *)c) {}
+    String(const String &o) { _app(o.buffer, o.len); }
+    String(String &&o) { _move(o); }
+    explicit String(char c) { _app(&c, 1); }
+    explicit String(int v) { concat(v); }
+    explicit String(unsigned v) { concat(v); }
+    explicit String(long v) { concat(v); }
+    explicit String(unsigned long v) { concat(v); }
+    explicit String(double v, unsigned char d = 2) {
+        char b[64];
+        snprintf(b, sizeof(b), "%.*f", d, v);
+        concat(b);
+    }
+    ~String() {
+        if (buffer != sso) free(buffer);
+    }
+
+    String &operator=(const String &o) {
+        if (this != &o) {
+            len = 0;
+            _app(o.buffer, o.len);
+        }
+        return *this;
+    }
+    String &operator=(String &&o) {
+        if (this != &o) _move(o);
+        return *this;
+    }
+    String &operator=(const char *c) {
+        clear();
+        if (c) _app(c, strlen(c));
+        return *this;
+    }
+
+    unsigned length() const { return len; }
+    const char *c_str() const { return buffer; }
+    char *begin() { return buffer; }
+    bool reserve(unsigned n) { return _grow(n); }
+    void clear() {
+        len = 0;
+        buffer[0] = 0;
+    }
+
+    char charAt(unsigned i) const { return buffer[i]; }
+    void setCharAt(unsigned i, char c) {
+        if (i < len) buffer[i] = c;
+    }
+    char operator[](unsigned i) const { return buffer[i]; }
+    char &operator[](unsigned i) { return buffer[i]; }
+
+    int indexOf(char c, unsigned from = 0) const {
+        const char *p = from < len ? strchr(buffer + from, c) : nullptr;
+        return p ? int(p - buffer) : -1;
+    }
+    int indexOf(const String &s, unsigned from = 0) const {
+        const char *p = from < len ? strstr(buffer + from, s.buffer) : nullptr;
+        return p ? int(p - buffer) : -1;
+    }
+    int lastIndexOf(char c) const {
+        const char *p = strrchr(buffer, c);
+        return p ? int(p - buffer) : -1;
+    }
+    bool startsWith(const String &s) const { return len >= s.len && !memcmp(buffer, s.buffer, s.len); }
+    bool endsWith(const String &s) const { return len >= s.len && !memcmp(buffer + len - s.len, s.buffer, s.len); }
+    String substring(unsigned from, unsigned to = ~0u) const {
+        if (to > len) to = len;
+        if (from > to) from = to;
+        return String(buffer + from, to - from);
+    }
+    void remove(unsigned i, unsigned n = ~0u) {
+        if (i >= len) return;
+        if (n > len - i) n = len - i;
+        memmove(buffer + i, buffer + i + n, len - i - n + 1);
+        len -= n;
+    }
+    int toInt() const { return atoi(buffer); }
+
+    explicit operator bool() const { return true; }
+    bool operator==(const String &o) const { return len == o.len && !memcmp(buffer, o.buffer, len); }
+    bool operator==(const char *o) const { return !strcmp(buffer, o); }
+    bool operator!=(const String &o) const { return !(*this == o); }
+
+    bool concat(const String &o) { return _app(o.buffer, o.len); }
+    bool concat(const char *c) { return c && _app(c, strlen(c)); }
+    bool concat(const char *c, unsigned n) { return _app(c, n); }
+    bool concat(const uint8_t *c, unsigned n) { return _app((const char *)c, n); }
+    bool concat(const __FlashStringHelper *c) { return concat((const char *)c); }
+    bool concat(char c) { return _app(&c, 1); }
+    bool concat(unsigned char v) { return _num("%u", (unsigned)v); }
+    bool concat(int v) { return _num("%d", v); }
+    bool concat(unsigned v) { return _num("%u", v); }
+    bool concat(long v) { return _num("%ld", v); }
+    bool concat(unsigned long v) { return _num("%lu", v); }
+    bool concat(long long v) { return _num("%lld", v); }
+    bool concat(unsigned long long v) { return _num("%llu", v); }
+    bool concat(double v) { return _num("%.2f", v); }
+    template <class T>
+    String &operator+=(T v) {
+        concat(v);
+        return *this;
+    }
+
+   protected:
+    char sso[12] = {0};
+    char *buffer = sso;
+    unsigned capacity = sizeof(sso) - 1;
+    unsigned len = 0;
+
+    bool _grow(unsigned n) {
+        if (n <= capacity) return true;
+        char *b = (char *)(buffer == sso ? malloc(n + 1) : realloc(buffer, n + 1));
+        if (!b) return false;
+        if (buffer == sso) memcpy(b, sso, len + 1);
+        buffer = b;
+        capacity = n;
+        return true;
+    }
+    bool _app(const char *c, unsigned n) {
+        if (!_grow(len + n)) return false;
+        memmove(buffer + len, c, n);
+        len += n;
+        buffer[len] = 0;
+        return true;
+    }
+    void _move(String &o) {
+        if (o.buffer == o.sso) {
+            len = 0;
+            _app(o.buffer, o.len);
+            return;
+        }
+        if (buffer != sso) free(buffer);
+        buffer = o.buffer;
+        capacity = o.capacity;
+        len = o.len;
+        o.buffer = o.sso;
+        o.capacity = sizeof(o.sso) - 1;
+        o.clear();
+    }
+    template <class T>
+    bool _num(const char *fmt, T v) {
+        char b[64];
+        snprintf(b, sizeof(b), fmt, v);
+        return concat(b);
+    }
+};
+
+class Print {
+   public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t *b, size_t n) {
+        size_t r = 0;
+        while (n--) r += write(*b++);
+        return r;
+    }
+    size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+    size_t print(const __FlashStringHelper *s) { return write((const char *)s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned v) { return print(String(v)); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(double v, int d = 2) { return print(String(v, d)); }
+
+    size_t println() { return write((uint8_t)'\n'); }
+    template <class T>
+    size_t println(T v) { return print(v) + println(); }
+
+    int printf(const char *fmt, ...) {
+        char b[256];
+        va_list a;
+        va_start(a, fmt);
+        int r = vsnprintf(b, sizeof(b), fmt, a);
+        va_end(a);
+        write(b);
+        return r;
+    }
+};
+
+class Stream : public Print {
+   public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    String readStringUntil(char) { return String(); }
+};
+
+class HardwareSerial : public Stream {
+   public:
+    void begin(long) {}
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    using Print::write;
+    int available() override { return 0; }
+    int read() override { return -1; }
+};
+
+inline HardwareSerial Serial;
@@ -0,0 +1,4 @@
+#pragma once
+// сигнатура МК для ID устройства: на ПК нули
+
+#define boot_signature_byte_get(addr) ((uint8_t)0)
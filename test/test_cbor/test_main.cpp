@@ -0,0 +1,102 @@
+// перекодирование JSON -> CBOR (utils/cbor.h): числа и строки
+#include <Arduino.h>
+#include <unity.h>
+#include <GyverHub.h>
+
+// CBOR одного значения в hex
+static String _cbor(const char *json) {
+    gyverhub::Cbor cbor;
+    TEST_ASSERT_TRUE(cbor.fromJson(json, strlen(json)));
+    String hex;
+    for (size_t i = 0; i < cbor.length(); i++) {
+        uint8_t b = cbor[i];
+        hex += "0123456789abcdef"[b >> 4];
+        hex += "0123456789abcdef"[b & 0xf];
+    }
+    return hex;
+}
+
+void test_integer_range() {
+    TEST_ASSERT_EQUAL_STRING("17", _cbor("23").c_str());
+    TEST_ASSERT_EQUAL_STRING("3863", _cbor("-100").c_str());
+    TEST_ASSERT_EQUAL_STRING("00", _cbor("-0").c_str());
+    TEST_ASSERT_EQUAL_STRING("1bffffffffffffffff", _cbor("18446744073709551615").c_str());
+    TEST_ASSERT_EQUAL_STRING("3b8000000000000000", _cbor("-9223372036854775809").c_str());
+    TEST_ASSERT_EQUAL_STRING("3bfffffffffffffffe", _cbor("-18446744073709551615").c_str());
+}
+
+// не помещается в 64 бита - float64
+void test_integer_overflow() {
+    if (sizeof(double) == sizeof(float)) TEST_IGNORE_MESSAGE("double == float");
+    TEST_ASSERT_EQUAL_STRING("fb43f0000000000000", _cbor("18446744073709551616").c_str());
+    TEST_ASSERT_EQUAL_STRING("fbc3f0000000000000", _cbor("-18446744073709551616").c_str());
+}
+
+void test_float32() {
+    TEST_ASSERT_EQUAL_STRING("fa3dcccccd", _cbor("0.1").c_str());
+    TEST_ASSERT_EQUAL_STRING("fac0200000", _cbor("-2.5").c_str());
+    TEST_ASSERT_EQUAL_STRING("fa4b800000", _cbor("1.6777216e7").c_str());
+}
+
+// float32 теряет точность - float64
+void test_float64() {
+    if (sizeof(double) == sizeof(float)) TEST_IGNORE_MESSAGE("double == float");
+    TEST_ASSERT_EQUAL_STRING("fb3fd3333333333334", _cbor("0.30000000000000004").c_str());
+    TEST_ASSERT_EQUAL_STRING("fb4170000010000000", _cbor("16777217.0").c_str());
+    TEST_ASSERT_EQUAL_STRING("fb7fefffffffffffff", _cbor("1.7976931348623157e308").c_str());
+}
+
+// вне double - строкой, как в JSON
+void test_number_text() {
+    TEST_ASSERT_EQUAL_STRING("653165393939", _cbor("1e999").c_str());
+    String num, hex("7828");
+    for (int i = 0; i < 40; i++) {
+        num += '1';
+        hex += "31";
+    }
+    TEST_ASSERT_EQUAL_STRING(hex.c_str(), _cbor(num.c_str()).c_str());
+}
+
+void test_number_in_map() {
+    TEST_ASSERT_EQUAL_STRING("bf03fa3dcccccd182b9f1bffffffffffffffff20ffff",
+                             _cbor("{\"value\":0.1,\"values\":[18446744073709551615,-1]}").c_str());
+}
+
+// \u-последовательности в UTF-8, одиночные суррогаты - U+FFFD
+void test_string_surrogates() {
+    TEST_ASSERT_EQUAL_STRING("64f09f9880", _cbor("\"\\ud83d\\ude00\"").c_str());
+    TEST_ASSERT_EQUAL_STRING("63efbfbd", _cbor("\"\\ud83d\"").c_str());
+    TEST_ASSERT_EQUAL_STRING("6561efbfbd62", _cbor("\"a\\ude00b\"").c_str());
+    TEST_ASSERT_EQUAL_STRING("64efbfbd78", _cbor("\"\\ud83dx\"").c_str());
+    TEST_ASSERT_EQUAL_STRING("64efbfbd41", _cbor("\"\\ud83d\\u0041\"").c_str());
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void setup() {
+    delay(2000);
+    UNITY_BEGIN();
+    RUN_TEST(test_integer_range);
+    RUN_TEST(test_integer_overflow);
+    RUN_TEST(test_float32);
+    RUN_TEST(test_float64);
+    RUN_TEST(test_number_text);
+    RUN_TEST(test_number_in_map);
+    RUN_TEST(test_string_surrogates);
+    UNITY_END();
+}
+
+void loop() {
+}
+
+#ifndef ARDUINO
+// pio test -e native
+int main() {
+    setup();
+    return 0;
+}
+#endif
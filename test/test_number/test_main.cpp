@@ -0,0 +1,144 @@
+// форматирование чисел (utils/number.h, ValueTraits)
+#include <Arduino.h>
+#include <unity.h>
+#include <GyverHub.h>
+
+static String _format(double value) {
+    char buf[GHI_NUM_BUF + 1];
+    size_t len = gyverhub::formatDouble(buf, value);
+    TEST_ASSERT_TRUE(len <= GHI_NUM_BUF);
+    buf[len] = '\0';
+    return String(buf);
+}
+
+void test_double_shortest() {
+    TEST_ASSERT_EQUAL_STRING("0", _format(0).c_str());
+    TEST_ASSERT_EQUAL_STRING("0.1", _format(0.1).c_str());
+    TEST_ASSERT_EQUAL_STRING("-2.5", _format(-2.5).c_str());
+    TEST_ASSERT_EQUAL_STRING("1e+300", _format(1e300).c_str());
+    TEST_ASSERT_EQUAL_STRING("0.30000000000000004", _format(0.1 + 0.2).c_str());
+}
+
+// числа, которые float не представляет
+void test_double_beyond_float() {
+    if (sizeof(double) == sizeof(float)) TEST_IGNORE_MESSAGE("double == float");
+    TEST_ASSERT_EQUAL_STRING("16777217", _format(16777217.0).c_str());
+    TEST_ASSERT_EQUAL_STRING("123456789.123", _format(123456789.123).c_str());
+    TEST_ASSERT_EQUAL_STRING("-0.0000012345678901234567", _format(-1.2345678901234567e-6).c_str());
+    TEST_ASSERT_EQUAL_STRING("1.7976931348623157e+308", _format(1.7976931348623157e308).c_str());
+}
+
+// денормализованные: точность ниже 15 цифр
+void test_double_subnormal() {
+    if (sizeof(double) == sizeof(float)) TEST_IGNORE_MESSAGE("double == float");
+    TEST_ASSERT_EQUAL_STRING("5e-324", _format(5e-324).c_str());
+    TEST_ASSERT_EQUAL_STRING("-1e-323", _format(-1e-323).c_str());
+    TEST_ASSERT_EQUAL_STRING("1.23e-320", _format(1.23e-320).c_str());
+    TEST_ASSERT_EQUAL_STRING("2.225073858507201e-308", _format(2.225073858507201e-308).c_str());
+    TEST_ASSERT_EQUAL_STRING("2.2250738585072014e-308", _format(2.2250738585072014e-308).c_str());
+}
+
+void test_float_subnormal() {
+    char buf[GHI_NUM_BUF + 1];
+    buf[gyverhub::formatFloat(buf, 1e-45f)] = '\0';
+    TEST_ASSERT_EQUAL_STRING("1e-45", buf);
+    buf[gyverhub::formatFloat(buf, -1.1754942e-38f)] = '\0';
+    TEST_ASSERT_EQUAL_STRING("-1.1754942e-38", buf);
+}
+
+// format -> parse должно вернуть то же число до бита
+static uint64_t _seed = 88172645463325252ull;
+static uint64_t _random() {
+    _seed ^= _seed << 13;
+    _seed ^= _seed >> 7;
+    _seed ^= _seed << 17;
+    return _seed;
+}
+
+static void _roundtrip(double v) {
+    char buf[GHI_NUM_BUF + 1];
+    buf[gyverhub::formatDouble(buf, v)] = '\0';
+    double back = 0;
+    TEST_ASSERT_TRUE(gyverhub::parseDouble(buf, back) == gyverhub::ParseStatus::OK);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&v, &back, sizeof(v), buf);
+}
+
+static void _roundtrip(float v) {
+    char buf[GHI_NUM_BUF + 1];
+    buf[gyverhub::formatFloat(buf, v)] = '\0';
+    float back = 0;
+    TEST_ASSERT_TRUE(gyverhub::parseFloat(buf, back) == gyverhub::ParseStatus::OK);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&v, &back, sizeof(v), buf);
+}
+
+void test_double_roundtrip() {
+    if (sizeof(double) == sizeof(float)) TEST_IGNORE_MESSAGE("double == float");
+    static const double fixed[] = {
+        -247762.47309469618, 1.5e-7, 0.1, 0.30000000000000004, 123456789.123,
+        9007199254740993.0, 1e23, 5e-324, 2.2250738585072014e-308, 1.7976931348623157e308,
+    };
+    for (double v : fixed) _roundtrip(v);
+
+    for (uint16_t i = 0; i < 5000; i++) {
+        uint64_t bits = _random();
+        double v;
+        memcpy(&v, &bits, sizeof(v));
+        if (isfinite(v) && v != 0) _roundtrip(v);
+    }
+    for (uint16_t i = 0; i < 5000; i++) {
+        // в пределах +-1e6 - типичные значения компонентов
+        double v = (double) (int64_t) _random() / 9.223372036854775807e12;
+        if (v != 0) _roundtrip(v);
+    }
+}
+
+void test_float_roundtrip() {
+    float f = 0;
+    TEST_ASSERT_TRUE(gyverhub::parseFloat("1.0000000596046448", f) == gyverhub::ParseStatus::OK);
+    TEST_ASSERT_EQUAL_FLOAT(1.00000012f, f);
+
+    for (uint16_t i = 0; i < 5000; i++) {
+        uint32_t bits = _random();
+        float v;
+        memcpy(&v, &bits, sizeof(v));
+        if (isfinite(v) && v != 0) _roundtrip(v);
+    }
+}
+
+void test_double_value() {
+    if (sizeof(double) == sizeof(float)) TEST_IGNORE_MESSAGE("double == float");
+    double v = 123456789.125;
+    gyverhub::Json answ;
+    gyverhub::ValueTraits<double>::append(answ, v);
+    TEST_ASSERT_EQUAL_STRING("123456789.125", answ.c_str());
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void setup() {
+    delay(2000);
+    UNITY_BEGIN();
+    RUN_TEST(test_double_shortest);
+    RUN_TEST(test_double_beyond_float);
+    RUN_TEST(test_double_subnormal);
+    RUN_TEST(test_float_subnormal);
+    RUN_TEST(test_double_roundtrip);
+    RUN_TEST(test_float_roundtrip);
+    RUN_TEST(test_double_value);
+    UNITY_END();
+}
+
+void loop() {
+}
+
+#ifndef ARDUINO
+// pio test -e native
+int main() {
+    setup();
+    return 0;
+}
+#endif
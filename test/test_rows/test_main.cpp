@@ -0,0 +1,123 @@
+// окно строк (команда rows): TableView/LogView и компоненты без окна. Ответ focus только со значениями
+#include <Arduino.h>
+#include <unity.h>
+#include <GyverHub.h>
+
+GyverHub hub("PRE", "rows", "", 0xabcd);
+String answer;
+String text("plain");
+uint16_t rows = 10;
+
+void row(uint16_t i, String& s) {
+    s = "r";
+    s += i;
+}
+
+void build(gyverhub::Builder* b) {
+    b->Label(text);            // _n1
+    b->TableView(rows, row);   // _n2
+}
+
+void onManual(const String& s, bool broadcast) {
+    answer += s;
+}
+
+static void _rows(const char* name, const char* value) {
+    String url("PRE/abcd/cl/rows/");
+    url += name;
+    answer = "";
+    hub.parse((char*) url.c_str(), value, gyverhub::ConnectionType::MANUAL);
+}
+
+static void _focus(const char* cached) {
+    char url[] = "PRE/abcd/cl/focus";
+    answer = "";
+    hub.parse(url, cached, gyverhub::ConnectionType::MANUAL);
+}
+
+// хеш из ответа focus
+static String _hash() {
+    int h = answer.indexOf("\"hash\":");
+    TEST_ASSERT_TRUE(h >= 0);
+    return answer.substring(h + 7, answer.indexOf(',', h));
+}
+
+void test_rows_window() {
+    _rows("_n2", "3,2");
+    TEST_ASSERT_TRUE(answer.indexOf("\"type\":\"rows\"") >= 0);
+    TEST_ASSERT_TRUE(answer.indexOf("r3\\nr4\\n") >= 0);
+    TEST_ASSERT_TRUE(answer.indexOf("\"offset\":3") >= 0);
+    TEST_ASSERT_TRUE(answer.indexOf("\"total\":10") >= 0);
+}
+
+// компонент без окна - как неизвестное имя
+void test_rows_plain() {
+    _rows("_n1", "0,5");
+    TEST_ASSERT_TRUE(answer.indexOf("\"type\":\"ERR\"") >= 0);
+    TEST_ASSERT_TRUE(answer.indexOf("Not found") >= 0);
+    TEST_ASSERT_TRUE(answer.indexOf("plain") < 0);
+}
+
+void test_rows_unknown() {
+    _rows("_n9", "0,5");
+    TEST_ASSERT_TRUE(answer.indexOf("\"type\":\"ERR\"") >= 0);
+    TEST_ASSERT_TRUE(answer.indexOf("Not found") >= 0);
+}
+
+// разметка та же - приходят только значения, одним ответом
+void test_values_answer() {
+    _focus("");
+    TEST_ASSERT_TRUE(answer.indexOf("\"controls\"") >= 0);
+    String hash = _hash();
+
+    text = "changed";
+    _focus(hash.c_str());
+    text = "plain";
+    TEST_ASSERT_TRUE(answer.indexOf("\"controls\"") < 0);
+    TEST_ASSERT_TRUE(answer.indexOf("\"values\":{\"_n1\":\"changed\"") >= 0);
+    TEST_ASSERT_EQUAL_STRING(hash.c_str(), _hash().c_str());
+}
+
+// новая строка таблицы не меняет хеш разметки, окно приходит вместе со значениями
+void test_values_window() {
+    _focus("");
+    String hash = _hash();
+
+    rows = 11;
+    _focus(hash.c_str());
+    rows = 10;
+    TEST_ASSERT_TRUE(answer.indexOf("\"controls\"") < 0);
+    TEST_ASSERT_TRUE(answer.indexOf("r10\\n") >= 0);
+    TEST_ASSERT_TRUE(answer.indexOf("\"windows\":{\"_n2\":{\"total\":11,\"offset\":0,\"window\":20}}") >= 0);
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void setup() {
+    delay(2000);
+    hub.onBuild(build);
+    hub.onManual(onManual);
+    hub.begin();
+    UNITY_BEGIN();
+    RUN_TEST(test_rows_window);
+    RUN_TEST(test_rows_plain);
+    RUN_TEST(test_rows_unknown);
+    RUN_TEST(test_values_answer);
+    RUN_TEST(test_values_window);
+    UNITY_END();
+}
+
+void loop() {
+}
+
+#ifndef ARDUINO
+// pio test -e native
+int main() {
+    setup();
+    return 0;
+}
+#endif
@@ -0,0 +1,102 @@
+// разбор значений от клиента (ValueTraits::parse) с диапазоном компонента
+#include <Arduino.h>
+#include <unity.h>
+#include <GyverHub.h>
+
+using gyverhub::ParseStatus;
+using gyverhub::Range;
+using gyverhub::ValueTraits;
+
+// целый слайдер с дробным шагом: дробное значение принимается и округляется
+void test_int_fractional_step() {
+    Range range(0, 100, 0.5);
+    int16_t v = 0;
+    TEST_ASSERT_TRUE(ValueTraits<int16_t>::parse("12.5", v, &range) == ParseStatus::CLAMPED);
+    TEST_ASSERT_EQUAL(13, v);
+    TEST_ASSERT_TRUE(ValueTraits<int16_t>::parse("12.2", v, &range) == ParseStatus::CLAMPED);
+    TEST_ASSERT_EQUAL(12, v);
+    TEST_ASSERT_TRUE(ValueTraits<int16_t>::parse("40", v, &range) == ParseStatus::OK);
+    TEST_ASSERT_EQUAL(40, v);
+    TEST_ASSERT_TRUE(ValueTraits<int16_t>::parse("150.5", v, &range) == ParseStatus::CLAMPED);
+    TEST_ASSERT_EQUAL(100, v);
+}
+
+// целые больше 2^24 не теряют точность при проверке диапазона
+void test_int_above_float() {
+    Range range(0, 4294967040.0f, 1);
+    uint32_t u = 0;
+    TEST_ASSERT_TRUE(ValueTraits<uint32_t>::parse("4000000001", u, &range) == ParseStatus::OK);
+    TEST_ASSERT_EQUAL_UINT32(4000000001ul, u);
+
+    // шаг 2 от 1: нечётные на шаге, float их не представляет
+    Range odd(1, 4e9, 2);
+    TEST_ASSERT_TRUE(ValueTraits<uint32_t>::parse("16777219", u, &odd) == ParseStatus::OK);
+    TEST_ASSERT_EQUAL_UINT32(16777219ul, u);
+    TEST_ASSERT_TRUE(ValueTraits<uint32_t>::parse("16777220", u, &odd) == ParseStatus::CLAMPED);
+    TEST_ASSERT_EQUAL_UINT32(16777221ul, u);
+
+    // граница, которую float представляет точно
+    Range top(0, 20000000, 1);
+    TEST_ASSERT_TRUE(ValueTraits<uint32_t>::parse("20000003", u, &top) == ParseStatus::CLAMPED);
+    TEST_ASSERT_EQUAL_UINT32(20000000ul, u);
+
+    Range srange(-2e9, 2e9, 1);
+    int32_t i = 0;
+    TEST_ASSERT_TRUE(ValueTraits<int32_t>::parse("16777217", i, &srange) == ParseStatus::OK);
+    TEST_ASSERT_EQUAL_INT32(16777217, i);
+    TEST_ASSERT_TRUE(ValueTraits<int32_t>::parse("-1999999999", i, &srange) == ParseStatus::OK);
+    TEST_ASSERT_EQUAL_INT32(-1999999999, i);
+
+    // граница float 2^31 не переполняет int32
+    Range wide(-3e9, 3e9, 0);
+    TEST_ASSERT_TRUE(ValueTraits<int32_t>::parse("2147483647", i, &wide) == ParseStatus::OK);
+    TEST_ASSERT_EQUAL_INT32(2147483647, i);
+}
+
+void test_int_errors() {
+    uint8_t v = 7;
+    TEST_ASSERT_TRUE(ValueTraits<uint8_t>::parse("300", v, nullptr) == ParseStatus::OUT_OF_RANGE);
+    TEST_ASSERT_TRUE(ValueTraits<uint8_t>::parse("-1", v, nullptr) == ParseStatus::OUT_OF_RANGE);
+    TEST_ASSERT_TRUE(ValueTraits<uint8_t>::parse("abc", v, nullptr) == ParseStatus::INVALID);
+    TEST_ASSERT_EQUAL(7, v);
+
+    int8_t s = 0;
+    TEST_ASSERT_TRUE(ValueTraits<int8_t>::parse("-5.5", s, nullptr) == ParseStatus::CLAMPED);
+    TEST_ASSERT_EQUAL(-6, s);
+}
+
+void test_float_step() {
+    Range range(0, 1, 0.1);
+    float f = 0;
+    TEST_ASSERT_TRUE(ValueTraits<float>::parse("0.3", f, &range) == ParseStatus::OK);
+    TEST_ASSERT_EQUAL_FLOAT(0.3f, f);
+    TEST_ASSERT_TRUE(ValueTraits<float>::parse("0.34", f, &range) == ParseStatus::CLAMPED);
+    TEST_ASSERT_EQUAL_FLOAT(0.3f, f);
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void setup() {
+    delay(2000);
+    UNITY_BEGIN();
+    RUN_TEST(test_int_fractional_step);
+    RUN_TEST(test_int_above_float);
+    RUN_TEST(test_int_errors);
+    RUN_TEST(test_float_step);
+    UNITY_END();
+}
+
+void loop() {
+}
+
+#ifndef ARDUINO
+// pio test -e native
+int main() {
+    setup();
+    return 0;
+}
+#endif
@@ -1,7 +1,7 @@
 # GyverHub Web Builder
 
-version = '0.50b'
-notes = 'Fix MQTT OTA'
+version = '0.54b'
+notes = 'Upload CRC32 check on devices that support it'
 
 js_files = [
     'src/include/GyverHub.js',
@@ -55,11 +55,13 @@ inc_min = '''
 from rcssmin import cssmin  # pip install rcssmin
 from rjsmin import jsmin    # pip install rjsmin
 import gzip
+import brotli             # pip install brotli
 import shutil
 import os
 import re
 import base64
 import datetime
+import zlib
 
 ##############################################################
 
@@ -271,6 +273,18 @@ with open('esp/index.html', "r+") as f:
 
 with open('esp/index.html', 'rb') as f_in, gzip.open('esp/index.html.gz', 'wb') as f_out: f_out.writelines(f_in)
 
+# brotli: на ~12% меньше gzip, отдаётся если клиент прислал br в Accept-Encoding
+for file in ['esp/script.js', 'esp/style.css', 'esp/index.html']:
+    with open(file, 'rb') as f_in, open(file + '.br', 'wb') as f_out:
+        f_out.write(brotli.compress(f_in.read(), mode=brotli.MODE_TEXT, quality=11))
+
+# gzip и brotli должны раскрываться в одно и то же
+for file in ['esp/script.js', 'esp/style.css', 'esp/index.html']:
+    with open(file, 'rb') as f, open(file + '.gz', 'rb') as f_gz, open(file + '.br', 'rb') as f_br:
+        data = f.read()
+        if gzip.decompress(f_gz.read()) != data or brotli.decompress(f_br.read()) != data:
+            raise SystemExit(file + ': gzip/brotli mismatch')
+
 os.remove("esp/script.js")
 os.remove("esp/style.css")
 os.remove("esp/index.html")
@@ -288,14 +302,28 @@ HEADER_TEMPLATE = """\
 #include "hub/portal.h"
 
 const size_t gyverhub::portal::{name}_size = {size};
+const char gyverhub::portal::{name}_etag[] = "\\"{etag:08x}\\"";
+const char gyverhub::portal::{name}_head[] PROGMEM =
+        "HTTP/1.1 200 OK\\r\\n"
+        "Content-Type: {mime}\\r\\n"
+        "Content-Encoding: {encoding}\\r\\n"
+        "Content-Length: {size}\\r\\n"
+        "Vary: Accept-Encoding\\r\\n"
+        "ETag: \\"{etag:08x}\\"\\r\\n"
+        "Cache-Control: " GHC_PORTAL_CACHE "\\r\\n"
+        GHI_HTTP_CORS
+        "\\r\\n";
 const uint8_t gyverhub::portal::{name}[] PROGMEM = {{
 """
 
 
-def file_to_h(src, dest, name):
+def file_to_h(src, dest, name, mime, encoding):
+    with open(src, "rb") as f:
+        etag = zlib.crc32(f.read())
+
     with open(dest, "w") as of:
         of.write(HEADER_TEMPLATE.format(name=name, date=datetime.datetime.now(),
-                                        version=version, size=os.path.getsize(src)))
+                                        version=version, size=os.path.getsize(src), etag=etag, mime=mime, encoding=encoding))
 
         with open(src, "rb") as f:
             data = []
@@ -315,6 +343,9 @@ def file_to_h(src, dest, name):
 
         of.write("};\n")
 
-file_to_h('esp/index.html.gz', '../src/esp_inc/index.cpp', 'index')
-file_to_h('esp/style.css.gz', '../src/esp_inc/style.cpp', 'style')
-file_to_h('esp/script.js.gz', '../src/esp_inc/script.cpp', 'script')
+file_to_h('esp/index.html.gz', '../src/esp_inc/index.cpp', 'index', 'text/html', 'gzip')
+file_to_h('esp/style.css.gz', '../src/esp_inc/style.cpp', 'style', 'text/css', 'gzip')
+file_to_h('esp/script.js.gz', '../src/esp_inc/script.cpp', 'script', 'text/javascript', 'gzip')
+file_to_h('esp/index.html.br', '../src/esp_inc/index_br.cpp', 'index_br', 'text/html', 'br')
+file_to_h('esp/style.css.br', '../src/esp_inc/style_br.cpp', 'style_br', 'text/css', 'br')
+file_to_h('esp/script.js.br', '../src/esp_inc/script_br.cpp', 'script_br', 'text/javascript', 'br')
@@ -39,6 +39,16 @@ function post(cmd, name = '', value = '') {
     set_tout = setTimeout(() => { set_tout = prev_set = null; }, tout_prd);
   }
   let id = focused;
+  if (cmd == 'focus') {
+    // открыта страница меню - запрашиваем её
+    let page = devices_t[id].page;
+    if (page) {
+      cmd = 'page';
+      name = page;
+    }
+    // разметка уже есть - устройство может прислать только значения
+    if (!value && devices_t[id].ui_cache[page]) value = devices_t[id].ui_cache[page].hash;
+  }
   cmd = cmd.toString();
   name = name.toString();
   value = value.toString();
@@ -133,7 +143,7 @@ function reset_ping() {
     if (refresh_ui) {
       refresh_ui = false;
       if (screen == 'info') post('info');
-      else if (screen == 'fsbr') post('fsbr');
+      else if (screen == 'fsbr') requestFsbr();
       else post('focus');
     } else {
       post('ping');
@@ -218,21 +228,32 @@ function mq_start() {
 
   mq_client.on('message', function (topic, text) {
     topic = topic.toString();
+    let packet = null;
+    if (isCbor(text)) {
+      try {
+        packet = decodeCbor(text);
+      } catch (e) {
+        log('Wrong packet (CBOR)');
+        return;
+      }
+    }
     text = text.toString();
     for (pref of mq_pref_list) {
       // prefix/hub
       if (topic == (pref + '/hub')) {
-        parseDevice('broadcast', text, Conn.MQTT);
+        parseDevice('broadcast', packet ? packet : text, Conn.MQTT);
 
         // prefix/hub/hubid/id
       } else if (topic.startsWith(pref + '/hub/' + hub.cfg.client_id + '/')) {
         let id = topic.split('/').slice(-1);
         if (!(id in devices) || !(id in devices_t)) {
-          parseDevice(id, text, Conn.MQTT);
+          parseDevice(id, packet ? packet : text, Conn.MQTT);
           return;
         }
 
-        parsePacket(id, text, Conn.MQTT);
+        // CBOR приходит целиком, буфер не нужен
+        if (packet) parseDevice(id, packet, Conn.MQTT);
+        else parsePacket(id, text, Conn.MQTT);
 
         // prefix/hub/id/get/name
       } else if (topic.startsWith(pref + '/hub/') && topic.includes('/get/')) {
@@ -256,10 +277,14 @@ function mq_send(topic, msg = '') {
 function mq_state() {
   return (mq_client && mq_client.connected);
 }
+// id клиента для discover, с опцией формата для устройств, умеющих CBOR
+function mq_client_id(id) {
+  return hub.cfg.client_id + ((id in devices_t && devices_t[id].cbor) ? ':cbor' : '');
+}
 function mq_discover() {
   if (!mq_state()) mq_discover_flag = true;
   else for (let id in devices) {
-    mq_send(devices[id].prefix + '/' + id, hub.cfg.client_id);
+    mq_send(devices[id].prefix + '/' + id, mq_client_id(id));
   }
   log('MQTT discover');
 }
@@ -8,6 +8,10 @@ let pressId = null;
 let dup_names = [];
 let gauges = {};
 let canvases = {};
+let canvas_layers = {};
+let windows = {};
+let logs = {};
+let plots = {};
 let pickers = {};
 let joys = {};
 let prompts = {};
@@ -174,7 +178,13 @@ function menuClick(num) {
   menu_show(0);
   menuDeact();
   if (screen != 'device') show_screen('device');
-  set_h('_menu', num);
+  if (devices_t[focused].paged) {
+    // страницы собираются по запросу
+    devices_t[focused].page = num;
+    post('focus');
+  } else {
+    set_h('_menu', num);
+  }
 }
 function menuDeact() {
   let els = document.getElementById('menu_user').children;
@@ -657,7 +667,76 @@ function drawCanvas(canvas) {
   const cmd_list = ['fillStyle', 'strokeStyle', 'shadowColor', 'shadowBlur', 'shadowOffsetX', 'shadowOffsetY', 'lineWidth', 'miterLimit', 'font', 'textAlign', 'textBaseline', 'lineCap', 'lineJoin', 'globalCompositeOperation', 'globalAlpha', 'scale', 'rotate', 'rect', 'fillRect', 'strokeRect', 'clearRect', 'moveTo', 'lineTo', 'quadraticCurveTo', 'bezierCurveTo', 'translate', 'arcTo', 'arc', 'fillText', 'strokeText', 'drawImage', 'roundRect', 'fill', 'stroke', 'beginPath', 'closePath', 'clip', 'save', 'restore'];
   const const_list = ['butt', 'round', 'square', 'square', 'bevel', 'miter', 'start', 'end', 'center', 'left', 'right', 'alphabetic', 'top', 'hanging', 'middle', 'ideographic', 'bottom', 'source-over', 'source-atop', 'source-in', 'source-out', 'destination-over', 'destination-atop', 'destination-in', 'destination-out', 'lighter', 'copy', 'xor', 'top', 'bottom', 'middle', 'alphabetic'];
 
-  for (d of canvas.value) {
+  // бинарные токены подряд - один поток, последняя точка пути общая на весь холст.
+  // Рисуются из того же eval, чтобы порядок и переменные из custom() сохранились
+  let bin = [];
+  let bins = [];
+  let last = { x: 0, y: 0 };
+  function flushBin() {
+    if (!bin.length) return;
+    bins.push(concatBytes(bin));
+    ev_str += `drawBinary(cx,bins[${bins.length - 1}],cv_map,scale(),last);`;
+    bin = [];
+  }
+
+  // слои: записываются между L и E, по ссылке D рисуются из кэша. R - область перерисовки
+  let layers = canvas_layers[canvas.name] || (canvas_layers[canvas.name] = {});
+  let rec = null;
+  let clip = false;
+  let missing = false;
+  function service(d) {
+    let arg = d.slice(2);
+    switch (d[1]) {
+      case 'L':
+        rec = { name: arg, tokens: [] };
+        break;
+      case 'E':
+        if (!rec) break;
+        rec.tokens.pop();
+        layers[rec.name] = { hash: arg, tokens: rec.tokens };
+        rec = null;
+        break;
+      case 'D': {
+        let div = arg.indexOf(':');
+        let layer = layers[arg.slice(div + 1)];
+        if (layer && layer.hash == arg.slice(0, div)) layer.tokens.forEach(token);
+        else missing = true;
+        break;
+      }
+      case 'R': {
+        flushBin();
+        let r = arg.split(',').map((v, i) => `cv_map(${v},${i % 2})`).join(',');
+        if (clip) ev_str += 'cx.restore();';
+        ev_str += `cx.save();cx.beginPath();cx.rect(${r});cx.clip();cx.clearRect(${r});cx.beginPath();`;
+        clip = true;
+        break;
+      }
+    }
+  }
+
+  canvas.value.forEach(token);
+  flushBin();
+  if (clip) ev_str += 'cx.restore();';
+  eval(ev_str);
+  canvas.value = null;
+  // слоя нет в кэше (пропущено обновление) - запросить интерфейс заново, там слои целиком
+  if (missing) post('focus');
+
+  function token(d) {
+    if (rec) rec.tokens.push(d);
+    if (d instanceof Uint8Array) {
+      bin.push(d);
+      return;
+    }
+    switch (d.charCodeAt(0)) {
+      case 1:
+        bin.push(Uint8Array.from(atob(d.slice(1)), c => c.charCodeAt(0)));
+        return;
+      case 2:
+        service(d);
+        return;
+    }
+    flushBin();
     let div = d.indexOf(':');
     let cmd = parseInt(d, 10);
 
@@ -713,8 +792,115 @@ function drawCanvas(canvas) {
       ev_str += d + ';';
     }
   }
-  eval(ev_str);
-  canvas.value = null;
+}
+function concatBytes(list) {
+  if (list.length == 1) return list[0];
+  let res = new Uint8Array(list.reduce((n, b) => n + b.length, 0));
+  let pos = 0;
+  for (let b of list) res.set(b, pos), pos += b.length;
+  return res;
+}
+// бинарные команды холста: байт команды, аргументы zigzag varint (см. Canvas на устройстве)
+function drawBinary(cx, bytes, map, sc, last) {
+  const cmd_list = ['fillStyle', 'strokeStyle', 'shadowColor', 'shadowBlur', 'shadowOffsetX', 'shadowOffsetY', 'lineWidth', 'miterLimit', 'font', 'textAlign', 'textBaseline', 'lineCap', 'lineJoin', 'globalCompositeOperation', 'globalAlpha', 'scale', 'rotate', 'rect', 'fillRect', 'strokeRect', 'clearRect', 'moveTo', 'lineTo', 'quadraticCurveTo', 'bezierCurveTo', 'translate', 'arcTo', 'arc', 'fillText', 'strokeText', 'drawImage', 'roundRect', 'fill', 'stroke', 'beginPath', 'closePath', 'clip', 'save', 'restore'];
+  const const_list = ['butt', 'round', 'square', 'square', 'bevel', 'miter', 'start', 'end', 'center', 'left', 'right', 'alphabetic', 'top', 'hanging', 'middle', 'ideographic', 'bottom', 'source-over', 'source-atop', 'source-in', 'source-out', 'destination-over', 'destination-atop', 'destination-in', 'destination-out', 'lighter', 'copy', 'xor'];
+  const argc = [0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 2, 0, 4, 4, 4, 4, 2, 2, 4, 6, 2, 5];
+  const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+  const utf8 = new TextDecoder();
+  let pos = 0;
+
+  function uv() {
+    let v = 0, mul = 1, b;
+    do {
+      b = bytes[pos++];
+      v += (b & 0x7f) * mul;
+      mul *= 128;
+    } while (b & 0x80);
+    return v;
+  }
+  function zz() {
+    let v = uv();
+    return (v % 2) ? -(v + 1) / 2 : v / 2;
+  }
+  function f32() {
+    pos += 4;
+    return view.getFloat32(pos - 4, true);
+  }
+  function str() {
+    let n = uv();
+    pos += n;
+    return utf8.decode(bytes.subarray(pos - n, pos));
+  }
+  // координаты: чётные - x, нечётные - y
+  function xy(n) {
+    let a = [];
+    for (let i = 0; i < n; i++) a.push(map(zz(), i % 2));
+    return a;
+  }
+  function point(x, y) {
+    last.x = x, last.y = y;
+  }
+
+  while (pos < bytes.length) {
+    let cmd = bytes[pos++];
+    let name = cmd_list[cmd];
+    if (cmd <= 2) {
+      pos += 4;
+      cx[name] = intToColA(view.getUint32(pos - 4));
+    } else if (cmd <= 7) cx[name] = zz() * sc;
+    else if (cmd == 8) cx[name] = str();
+    else if (cmd <= 13) cx[name] = const_list[zz()];
+    else if (cmd == 14) cx[name] = f32();
+    else if (cmd == 15) cx.scale(zz(), zz());
+    else if (cmd == 16) cx.rotate(f32());
+    else if (cmd <= 20 || (cmd >= 23 && cmd <= 26)) cx[name](...xy(argc[cmd]));
+    else if (cmd <= 22) {
+      let x = zz(), y = zz();
+      point(x, y);
+      cx[name](map(x, 0), map(y, 1));
+    } else if (cmd == 27) {
+      let a = xy(3);
+      cx.arc(a[0], a[1], a[2], f32(), f32(), !!bytes[pos++]);
+    } else if (cmd <= 29) {
+      let text = str();
+      let a = xy(2);
+      let w = zz();
+      if (w) cx[name](text, a[0], a[1], w * sc);
+      else cx[name](text, a[0], a[1]);
+    } else if (cmd == 30) {
+      let img = new Image();
+      img.src = str();
+      let a = xy(uv());
+      img.onload = () => cx.drawImage(img, ...a);
+    } else if (cmd == 31) {
+      let n = uv();
+      let a = xy(4);
+      let r = [];
+      for (let i = 4; i < n; i++) r.push(zz() * sc);
+      cx.roundRect(...a, r.length == 1 ? r[0] : r);
+    } else if (cmd <= 38) cx[name]();
+    else if (cmd == 40) {
+      let n = uv();
+      let x = zz(), y = zz();
+      cx.moveTo(map(x, 0), map(y, 1));
+      for (let i = 1; i < n; i++) {
+        x += zz(), y += zz();
+        cx.lineTo(map(x, 0), map(y, 1));
+      }
+      point(x, y);
+    } else if (cmd == 42) {
+      let n = uv();
+      let x = 0, y = 0;
+      for (let i = 0; i < n; i++) {
+        x += zz(), y += zz();
+        cx.fillRect(map(x, 0), map(y, 1), map(1, 0), map(1, 1));
+      }
+    } else if (cmd == 41) {
+      let x = last.x + zz(), y = last.y + zz();
+      point(x, y);
+      cx.lineTo(map(x, 0), map(y, 1));
+    } else break;
+  }
 }
 function clickCanvas(id, e) {
   if (!(id in canvases)) return;
@@ -826,6 +1012,110 @@ function showGauges() {
   });
 }
 
+// plot
+function addPlot(ctrl) {
+  if (checkDup(ctrl)) return;
+  checkWidget(ctrl);
+  endButtons();
+  if (wid_row_id) {
+    let inner = `
+    <canvas class="plot_t" id="#${ctrl.name}"></canvas>
+    `;
+    addWidget(ctrl.tab_w, ctrl.name, ctrl.wlabel, inner);
+  } else {
+    EL('controls').innerHTML += `
+    <div class="cv_block cv_block_back">
+      <canvas class="plot_t" id="#${ctrl.name}"></canvas>
+    </div>
+    `;
+  }
+  plots[ctrl.name] = { name: ctrl.name, amount: ctrl.amount, names: ctrl.text ? ctrl.text.split(',') : [], points: [], seq: undefined };
+}
+// отсчёты прорежены устройством до ширины графика, дальше приходят только новые
+function requestPlot(p) {
+  let cv = EL('#' + p.name);
+  if (cv && cv.parentNode.clientWidth) post('plot', p.name, Math.round(cv.parentNode.clientWidth));
+}
+function showPlots() {
+  Object.values(plots).forEach(p => {
+    if (p.seq === undefined) requestPlot(p);
+    drawPlot(p);
+  });
+}
+function applyPlot(name, value, from, seq, reset, min) {
+  let p = plots[name];
+  if (!p) return;
+  if (reset) p.points = value;
+  else if (p.seq !== undefined && from <= p.seq && seq >= p.seq) p.points = p.points.concat(value.slice(p.seq - from));
+  else if (p.seq !== undefined && seq <= p.seq) return;
+  else {
+    requestPlot(p);
+    return;
+  }
+  p.seq = seq;
+  let cut = 0;
+  while (cut < p.points.length && p.points[cut][0] < min) cut++;
+  if (cut) p.points = p.points.slice(cut);
+  drawPlot(p);
+}
+function drawPlot(p) {
+  let cv = EL('#' + p.name);
+  if (!cv || !cv.parentNode.clientWidth) return;
+  let v = themes[cfg.theme];
+  let rw = cv.parentNode.clientWidth;
+  let rh = Math.floor(rw * 0.5);
+  cv.style.width = rw + 'px';
+  cv.style.height = rh + 'px';
+  cv.width = Math.floor(rw * ratio());
+  cv.height = Math.floor(rh * ratio());
+  let cx = cv.getContext("2d");
+  cx.clearRect(0, 0, cv.width, cv.height);
+
+  let pts = p.points;
+  if (!pts.length) return;
+  let t0 = pts[0][0], t1 = pts[pts.length - 1][0];
+  let lo = Infinity, hi = -Infinity;
+  for (let pt of pts) for (let i = 1; i < pt.length; i++) lo = Math.min(lo, pt[i]), hi = Math.max(hi, pt[i]);
+  if (hi == lo) hi += 1, lo -= 1;
+
+  let font = cfg.font;
+  /*NON-ESP*/
+  font = 'PTSans Narrow';
+  /*/NON-ESP*/
+  let fs = 10 * ratio();
+  cx.font = fs + 'px ' + font;
+  let pad = fs * 0.5;
+  let left = Math.max(cx.measureText(formatToStep(hi, 0.01)).width, cx.measureText(formatToStep(lo, 0.01)).width) + pad * 2;
+  let top = pad + fs, bottom = cv.height - pad;
+  let w = cv.width - left - pad, h = bottom - top;
+  let mx = t => left + (t1 == t0 ? w : (t - t0) * w / (t1 - t0));
+  let my = y => bottom - (y - lo) * h / (hi - lo);
+
+  cx.fillStyle = theme_cols[v][3];
+  cx.textAlign = 'right';
+  cx.fillText(formatToStep(hi, 0.01), left - pad, top + fs * 0.35);
+  cx.fillText(formatToStep(lo, 0.01), left - pad, bottom);
+  cx.strokeStyle = theme_cols[v][5];
+  cx.lineWidth = 1;
+  cx.strokeRect(left, top, w, h);
+
+  let cols = [colors[cfg.maincolor]].concat(Object.values(colors).filter(c => c != colors[cfg.maincolor]));
+  cx.lineWidth = ratio() * 1.5;
+  cx.textAlign = 'left';
+  let lx = left + pad;
+  for (let s = 1; s < pts[0].length; s++) {
+    cx.strokeStyle = cx.fillStyle = intToCol(cols[(s - 1) % cols.length]);
+    cx.beginPath();
+    pts.forEach((pt, i) => i ? cx.lineTo(mx(pt[0]), my(pt[s])) : cx.moveTo(mx(pt[0]), my(pt[s])));
+    cx.stroke();
+    let label = p.names[s - 1];
+    if (label) {
+      cx.fillText(label, lx, pad + fs * 0.8);
+      lx += cx.measureText(label).width + pad * 2;
+    }
+  }
+}
+
 // joystick
 function addJoy(ctrl) {
   if (checkDup(ctrl)) return;
@@ -990,16 +1280,20 @@ function addLog(ctrl) {
   if (checkDup(ctrl)) return;
   checkWidget(ctrl);
   endButtons();
-  if (ctrl.text.endsWith('\n')) ctrl.text = ctrl.text.slice(0, -1);
+  let text = ctrl.value.endsWith('\n') ? ctrl.value.slice(0, -1) : ctrl.value;
+  let pager = (ctrl.total != undefined) ? addWindow(ctrl) : '';
+  if (ctrl.total == undefined) logs[ctrl.name] = { seq: ctrl.seq, text: ctrl.value, max: Math.max(ctrl.value.length * 2, 4096) };
   if (wid_row_id) {
     let inner = `
-    <textarea id="#${ctrl.name}" title='${ctrl.name}' class="cfg_inp c_log text_t" readonly>${ctrl.text}</textarea>
+    <textarea id="#${ctrl.name}" title='${ctrl.name}' class="cfg_inp c_log text_t" readonly>${text}</textarea>
+    ${pager}
     `;
     addWidget(ctrl.tab_w, ctrl.name, ctrl.wlabel, inner);
   } else {
     EL('controls').innerHTML += `
     <div class="control">
-      <textarea id="#${ctrl.name}" title='${ctrl.name}' class="cfg_inp c_log text_t" readonly>${ctrl.text}</textarea>
+      <textarea id="#${ctrl.name}" title='${ctrl.name}' class="cfg_inp c_log text_t" readonly>${text}</textarea>
+      ${pager}
     </div>
   `;
   }
@@ -1074,9 +1368,24 @@ function addTable(ctrl) {
   if (checkDup(ctrl)) return;
   checkWidget(ctrl);
   endButtons();
-  let table = parseCSV(ctrl.value);
-  let aligns = ctrl.align.split(',');
-  let widths = ctrl.width.split(',');
+  let inner = tableHTML(ctrl.value, ctrl.align, ctrl.width);
+  if (ctrl.total != undefined) inner = `<div id="#${ctrl.name}">${inner}</div>${addWindow(ctrl)}`;
+
+  if (wid_row_id) {
+    addWidget(ctrl.tab_w, ctrl.name, ctrl.wlabel, inner);
+  } else {
+    EL('controls').innerHTML += `
+    <div class="control control_nob">
+      ${inner}
+    </div>
+    `;
+  }
+}
+
+function tableHTML(value, align, width) {
+  let table = parseCSV(value);
+  let aligns = align.split(',');
+  let widths = width.split(',');
   let inner = '<table class="c_table">';
   for (let row of table) {
     inner += '<tr>';
@@ -1086,16 +1395,70 @@ function addTable(ctrl) {
     inner += '</tr>';
   }
   inner += '</table>';
+  return inner;
+}
 
-  if (wid_row_id) {
-    addWidget(ctrl.tab_w, ctrl.name, ctrl.wlabel, inner);
+// ================ WINDOW =================
+// окно строк TableView/LogView: остальные строки запрашиваются командой rows
+function addWindow(ctrl) {
+  windows[ctrl.name] = { type: ctrl.type, offset: ctrl.offset, window: ctrl.window, total: ctrl.total, align: ctrl.align, width: ctrl.width };
+  return `<div class="c_pager">
+    <button class="c_btn btn_mini" onclick="rows_h('${ctrl.name}',-1)">&lt;</button>
+    <span id="pager#${ctrl.name}">${pagerText(ctrl.name)}</span>
+    <button class="c_btn btn_mini" onclick="rows_h('${ctrl.name}',1)">&gt;</button>
+  </div>`;
+}
+function pagerText(name) {
+  let w = windows[name];
+  if (!w.total) return '0 / 0';
+  return `${w.offset + 1}-${Math.min(w.offset + w.window, w.total)} / ${w.total}`;
+}
+function rows_h(name, dir) {
+  let w = windows[name];
+  post('rows', name, Math.max(0, w.offset + dir * w.window) + ',' + w.window);
+}
+// обновление: лог в конце следит за новыми строками, иначе перечитываем то же окно
+function updateWindow(name) {
+  let w = windows[name];
+  let offset = (w.type == 'log' && w.offset + w.window >= w.total) ? 0xffff : w.offset;
+  post('rows', name, offset + ',' + w.window);
+}
+function applyRows(name, value, offset, total) {
+  let w = windows[name];
+  if (!w) return;
+  w.offset = offset;
+  w.total = total;
+  let el = EL('#' + name);
+  if (!el) return;
+  if (w.type == 'log') {
+    el.innerHTML = value.endsWith('\n') ? value.slice(0, -1) : value;
+    el.scrollTop = el.scrollHeight;
   } else {
-    EL('controls').innerHTML += `
-    <div class="control control_nob">
-      ${inner}
-    </div>
-    `;
+    el.innerHTML = tableHTML(value, w.align, w.width);
+  }
+  EL('pager#' + name).innerHTML = pagerText(name);
+}
+
+// ================ LOG TAIL =================
+// Log: устройство присылает только дописанное (from..seq), при пропуске запрашиваем командой tail
+function applyTail(name, value, from, seq, reset) {
+  let log = logs[name];
+  let el = EL('#' + name);
+  if (!log || !el) return;
+  if (reset) log.text = value;
+  else if (log.seq === from) log.text += value;
+  else if (log.seq !== undefined && seq <= log.seq) return;
+  else {
+    post('tail', name, (log.seq === undefined) ? 0xffffffff : log.seq);
+    return;
+  }
+  log.seq = seq;
+  if (log.text.length > log.max) {
+    let cut = log.text.indexOf('\n', log.text.length - log.max);
+    log.text = log.text.slice((cut < 0) ? (log.text.length - log.max) : (cut + 1));
   }
+  el.textContent = log.text.endsWith('\n') ? log.text.slice(0, -1) : log.text;
+  el.scrollTop = el.scrollHeight;
 }
 
 // ================ WIDGET =================
@@ -1192,7 +1555,7 @@ function nextFile() {
     EL('wlabel' + files[0].id).innerHTML = ' [fetch...]';
   } else {
     fetch_path = files[0].path;
-    post('fetch', fetch_path);
+    post('fetch', fetch_path, fetchEncoding());
   }
 }
 
@@ -1202,10 +1565,10 @@ function downloadFile() {
   xhr.responseType = 'blob';
   xhr.open('GET', 'http://' + devices[focused].ip + ':' + http_port + files[0].path);
   xhr.onprogress = function (e) {
-    processFile(Math.round(e.loaded * 100 / e.total));
+    if (e.lengthComputable) processFile(Math.round(e.loaded * 100 / e.total));
   };
   xhr.onloadend = function (e) {
-    if (e.loaded && e.loaded == e.total) {
+    if (xhr.status == 200) {
       processFile(100);
       var reader = new FileReader();
       reader.readAsDataURL(xhr.response);
@@ -1,5 +1,7 @@
 // =============== VARS ==============
 let fs_arr = [];
+let fs_all = {};
+let fs_next = null;
 let fetching = null;
 let fetch_name;
 let fetch_index;
@@ -7,6 +9,7 @@ let fetch_file = '';
 let fetch_path = '';
 let fetch_tout;
 let fetch_to_file = false;
+let fetch_gzip = false;
 let edit_idx = 0;
 
 let uploading = null;
@@ -59,9 +62,25 @@ function reset_ota_tout() {
 }
 
 // ============ FS BROWSER ============
+function requestFsbr() {
+  // устройство с fsbr_limit отдаёт список страницами, остальные - целиком
+  fs_next = null;
+  if (devices[focused].fsbr_limit) post('fsbr', '/', 'n,0');
+  else post('fsbr');
+}
 function showFsbr(device) {
+  // список приходит страницами, следующая - по курсору next. Первая страница (с самой папкой)
+  // начинает список заново, в том числе ответ на delete и rename посреди листания
+  if (!fs_next || '/' in device.fs) fs_all = {};
+  Object.assign(fs_all, device.fs);
+  if (device.next) {
+    fs_next = device.next;
+    post('fsbr', '/', 'n,' + device.next);
+    return;
+  }
+  fs_next = null;
   fs_arr = [];
-  for (let path in device.fs) fs_arr.push(path);
+  for (let path in fs_all) fs_arr.push(path);
   fs_arr = sortPaths(fs_arr, '/');
 
   let inner = '';
@@ -70,7 +89,7 @@ function showFsbr(device) {
       inner += `<div class="fs_file fs_folder drop_area" onclick="file_upload_path.value='${fs_arr[i]}'/*;file_upload_btn.click()*/" ondrop="file_upload_path.value='${fs_arr[i]}';uploadFile(event.dataTransfer.files[0],'${fs_arr[i]}')">${fs_arr[i]}</div>`;
     } else {
       let none = "style='display:none'";
-      inner += `<div class="fs_file" onclick="openFSctrl(${i})">${fs_arr[i]}<div class="fs_weight">${(device.fs[fs_arr[i]] / 1000).toFixed(2)} kB</div></div>
+      inner += `<div class="fs_file" onclick="openFSctrl(${i})">${fs_arr[i]}<div class="fs_weight">${(fs_all[fs_arr[i]] / 1000).toFixed(2)} kB</div></div>
       <div id="fs#${i}" class="fs_controls">
         <button ${readModule(Modules.RENAME) ? '' : none} title="Rename" class="icon cfg_btn_tab" onclick="renameFile(${i})"></button>
         <button ${readModule(Modules.DELETE) ? '' : none} title="Delete" class="icon cfg_btn_tab" onclick="deleteFile(${i})"></button>
@@ -128,7 +147,7 @@ function fetchFile(i) {
   fetch_name = fetch_path.split('/').pop();
   fetch_to_file = false;
   if (devices_t[focused].conn == Conn.WS && devices_t[focused].http_cfg.download && fetch_path.startsWith(devices_t[focused].http_cfg.path)) fetchHTTP(fetch_path, fetch_name, fetch_index)
-  else post('fetch', fetch_path);
+  else post('fetch', fetch_path, fetchEncoding());
 }
 function openFile(src) {
   let w = window.open();
@@ -139,7 +158,7 @@ function format_h() {
   if (confirm('Format filesystem?')) post('format');
 }
 function updatefs_h() {
-  post('fsbr');
+  requestFsbr();
 }
 
 function editFile(data, idx) {
@@ -176,10 +195,11 @@ function fetchHTTP(path, name, index) {
   xhr.open('GET', 'http://' + devices[focused].ip + ':' + http_port + path);
 
   xhr.onprogress = function (e) {
-    EL('process#' + index).innerHTML = Math.round(e.loaded * 100 / e.total) + '%';
+    if (e.lengthComputable) EL('process#' + index).innerHTML = Math.round(e.loaded * 100 / e.total) + '%';
   };
   xhr.onloadend = function (e) {
-    if (e.loaded && e.loaded == e.total) {
+    // сжатый ответ идёт без Content-Length, total неизвестен
+    if (xhr.status == 200) {
       EL('process#' + index).innerHTML = '100%';
       var reader = new FileReader();
       reader.readAsDataURL(xhr.response);
@@ -194,6 +214,22 @@ function fetchHTTP(path, name, index) {
   xhr.send();
 }
 
+// устройство сжимает текстовые файлы, если браузер умеет распаковать
+function fetchEncoding() {
+  return ('DecompressionStream' in window) ? 'gzip' : '';
+}
+function gunzipB64(data, cb) {
+  let bin = Uint8Array.from(atob(data), (m) => m.charCodeAt(0));
+  let stream = new Blob([bin]).stream().pipeThrough(new DecompressionStream('gzip'));
+  new Response(stream).blob().then((blob) => {
+    let reader = new FileReader();
+    reader.readAsDataURL(blob);
+    reader.onloadend = function () {
+      cb(this.result.split('base64,')[1] || '');
+    }
+  }).catch(() => cb(null));
+}
+
 function fetchEnd(name, index, data) {
   if (!fetching) return;
   EL('download#' + index).style.display = 'inline-block';
@@ -236,7 +272,7 @@ function uploadFile(file, path) {
       }
       xhr.onload = function () {
         setLabelTout('file_upload_btn', 'Done', 'Upload');
-        post('fsbr');
+        requestFsbr();
       }
       xhr.onerror = function () {
         setLabelTout('file_upload_btn', 'Error!', 'Upload');
@@ -247,12 +283,28 @@ function uploadFile(file, path) {
       upload_bytes = [];
       for (b of buffer) upload_bytes.push(b);
       upload_size = upload_bytes.length;
-      post('upload', path);
+      // устройство сверит CRC32 на последнем чанке и только тогда заменит файл
+      if (devices[focused].digest == 'crc32') post('upload', path, crc32(buffer).toString(16).padStart(8, '0'));
+      else post('upload', path);
     }
     clearFiles();
   }
 
 }
+let crc32_table = null;
+function crc32(bytes) {
+  if (!crc32_table) {
+    crc32_table = new Uint32Array(256);
+    for (let n = 0; n < 256; n++) {
+      let c = n;
+      for (let k = 0; k < 8; k++) c = (c & 1) ? (0xEDB88320 ^ (c >>> 1)) : (c >>> 1);
+      crc32_table[n] = c;
+    }
+  }
+  let crc = 0xFFFFFFFF;
+  for (let b of bytes) crc = crc32_table[(crc ^ b) & 0xFF] ^ (crc >>> 8);
+  return (crc ^ 0xFFFFFFFF) >>> 0;
+}
 function uploadNextChunk() {
   let i = 0;
   let data = '';
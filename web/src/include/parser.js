@@ -26,6 +26,10 @@ function applyUpdate(name, value) {
     pickers[name].setColor(intToCol(value));
     return;
   }
+  if (name in windows) {
+    updateWindow(name);
+    return;
+  }
 
   let el = EL('#' + name);
   if (!el) return;
@@ -76,6 +80,8 @@ function updateDevice(mem, dev) {
   mem.max_upl = dev.max_upl;
   mem.modules = dev.modules;
   mem.ota_t = dev.ota_t;
+  mem.fsbr_limit = dev.fsbr_limit;
+  mem.digest = dev.digest;
   save_devices();
 }
 function compareDevice(mem, dev) {
@@ -86,17 +92,23 @@ function compareDevice(mem, dev) {
     mem.version != dev.version ||
     mem.max_upl != dev.max_upl ||
     mem.modules != dev.modules ||
-    mem.ota_t != dev.ota_t;
+    mem.ota_t != dev.ota_t ||
+    mem.fsbr_limit != dev.fsbr_limit ||
+    mem.digest != dev.digest;
 }
 function parseDevice(fromID, text, conn, ip = 'unset') {
   let device;
-  text = text.trim().replaceAll(/([^\\])\\([^\"\\nrt])/ig, "$1\\\\$2").replaceAll(/\t/ig, "\\t").replaceAll(/\n/ig, "\\n").replaceAll(/\r/ig, "\\r");
-
-  try {
-    device = JSON.parse(text);
-  } catch (e) {
-    log('Wrong packet (JSON):' + text);
-    return;
+  if (typeof text != 'string') {
+    device = text;  // уже разобран (CBOR)
+  } else {
+    text = text.trim().replaceAll(/([^\\])\\([^\"\\\/bfnrtu])/ig, "$1\\\\$2").replaceAll(/\t/ig, "\\t").replaceAll(/\n/ig, "\\n").replaceAll(/\r/ig, "\\r");
+
+    try {
+      device = JSON.parse(text);
+    } catch (e) {
+      log('Wrong packet (JSON):' + text);
+      return;
+    }
   }
 
   let id = device.id;
@@ -174,7 +186,7 @@ function parseDevice(fromID, text, conn, ip = 'unset') {
 
       if (!(id in devices_t)) {
         devices_t[id] = {
-          conn: Conn.NONE, ws: null, controls: null, granted: false,
+          conn: Conn.NONE, ws: null, controls: null, ui_cache: {}, page: 0, paged: false, granted: false,
           buffer: { WS: '', MQTT: '', Serial: '', BT: '' },
           port: null,
           http_cfg: { upd: 0, upload: 0, download: 0, ota: 0, path: '/fs/' }
@@ -184,6 +196,14 @@ function parseDevice(fromID, text, conn, ip = 'unset') {
       EL(`device#${id}`).className = "device";
       EL(`${ConnNames[conn]}#${id}`).style.display = 'unset';
       if (conn < devices_t[id].conn) devices_t[id].conn = conn;
+
+      /*NON-ESP*/
+      // устройство умеет CBOR - просим его повторным discover
+      if (conn == Conn.MQTT && device.cbor && !devices_t[id].cbor) {
+        devices_t[id].cbor = true;
+        mq_send(devices[id].prefix + '/' + id, mq_client_id(id));
+      }
+      /*/NON-ESP*/
       break;
 
     case 'print':
@@ -197,17 +217,60 @@ function parseDevice(fromID, text, conn, ip = 'unset') {
       for (let name in device.updates) applyUpdate(name, device.updates[name]);
       break;
 
-    case 'ui':
+    case 'ui': {
       if (id != focused) return;
+      let page = device.page ? device.page : 0;
+      devices_t[id].paged = (device.page != undefined);
+      if (devices_t[id].paged && page != devices_t[id].page) {
+        // устройство прислало другую страницу меню (refresh после set) - запрашиваем свою
+        post('focus');
+        return;
+      }
+      if (!device.controls) {
+        // разметка не изменилась, пришли только значения
+        let cache = devices_t[id].ui_cache[page];
+        if (!cache || cache.hash != device.hash) {
+          delete devices_t[id].ui_cache[page];
+          post('focus');
+          return;
+        }
+        device.controls = JSON.parse(JSON.stringify(cache.controls));
+        for (let ctrl of device.controls) {
+          if (ctrl.name in device.values) ctrl.value = device.values[ctrl.name];
+          // окно строк TableView/LogView сдвигается вместе со значением
+          if (device.windows && ctrl.name in device.windows) Object.assign(ctrl, device.windows[ctrl.name]);
+          // seq лога в кеше устарел, при первом tail клиент запросит текст заново
+          if (ctrl.type == 'log') delete ctrl.seq;
+        }
+      } else {
+        if (device.hash != undefined) devices_t[id].ui_cache[page] = { hash: device.hash, controls: JSON.parse(JSON.stringify(device.controls)) };
+        else delete devices_t[id].ui_cache[page];
+      }
       devices_t[id].controls = device.controls;
       showControls(device.controls, false, conn, devices[focused].ip);
       break;
+    }
 
     case 'info':
       if (id != focused) return;
       showInfo(device);
       break;
 
+    case 'rows':
+      if (id != focused) return;
+      applyRows(device.name, device.value, device.offset, device.total);
+      break;
+
+    case 'tail':
+      if (id != focused) return;
+      applyTail(device.name, device.value, device.from, device.seq, device.reset);
+      break;
+
+    case 'plot':
+      if (id != focused) return;
+      applyPlot(device.name, device.value, device.from, device.seq, device.reset, device.min);
+      break;
+
     case 'push':
       if (!(id in devices)) return;
       let date = (new Date).getTime();
@@ -233,6 +296,7 @@ function parseDevice(fromID, text, conn, ip = 'unset') {
 
       fetching = focused;
       fetch_file = '';
+      fetch_gzip = !!device.gzip;
       post('fetch_chunk', fetch_path);
       reset_fetch_tout();
       break;
@@ -242,8 +306,17 @@ function parseDevice(fromID, text, conn, ip = 'unset') {
 
       fetch_file += device.data;
       if (device.chunk == device.amount - 1) {
-        if (fetch_to_file) downloadFileEnd(fetch_file);
-        else fetchEnd(fetch_name, fetch_index, fetch_file);
+        let end = (data) => {
+          if (data === null) {
+            if (fetch_to_file) errorFile();
+            else EL('process#' + fetch_index).innerHTML = 'Error';
+            showPopupError('Error fetch ' + fetch_path);
+            stopFS();
+          } else if (fetch_to_file) downloadFileEnd(data);
+          else fetchEnd(fetch_name, fetch_index, data);
+        }
+        if (fetch_gzip) gunzipB64(fetch_file, end);
+        else end(fetch_file);
       } else {
         let perc = Math.round(device.chunk / device.amount * 100);
         if (fetch_to_file) processFile(perc);
@@ -286,7 +359,7 @@ function parseDevice(fromID, text, conn, ip = 'unset') {
       showPopup('Upload Done!');
       stopFS();
       setLabelTout('file_upload_btn', 'Done!', 'Upload');
-      post('fsbr');
+      requestFsbr();
       break;
 
     // ============= OTA =============
@@ -331,7 +404,11 @@ function showControls(controls, from_buffer = false, conn = Conn.NONE, ip = 'uns
   if (!controls) return;
   oninp_buffer = {};
   gauges = {};
+  windows = {};
+  logs = {};
+  plots = {};
   canvases = {};
+  canvas_layers = {};
   pickers = {};
   joys = {};
   prompts = {};
@@ -380,6 +457,7 @@ function showControls(controls, from_buffer = false, conn = Conn.NONE, ip = 'uns
       case 'row_e': case 'widget_e': endWidgets(); break;
       case 'canvas': addCanvas(ctrl); break;
       case 'gauge': addGauge(ctrl); break;
+      case 'plot': addPlot(ctrl); break;
       case 'image': addImage(ctrl); break;
       case 'stream': addStream(ctrl, conn, ip); break;
       case 'dpad': case 'joy': addJoy(ctrl); break;
@@ -406,6 +484,7 @@ async function renderElms(from_buffer) {
     await waitAnimationFrame();
     let end = 1;
     for (let i in gauges) if (EL('#' + i) == null) end = 0;
+    for (let i in plots) if (EL('#' + i) == null) end = 0;
     for (let i in canvases) if (EL('#' + i) == null) end = 0;
     for (let i in joys) if (EL('#' + i) == null) end = 0;
     for (let i in pickers) if (EL('#' + i) == null) end = 0;
@@ -414,6 +493,7 @@ async function renderElms(from_buffer) {
       if (dup_names.length) showPopupError('Duplicated names: ' + dup_names);
       showCanvases();
       showGauges();
+      showPlots();
       showPickers();
       showJoys();
       EL('controls').style.visibility = 'visible';
@@ -463,4 +543,100 @@ function showInfo(device) {
 function setLabelTout(el, text1, text2) {
   EL(el).innerHTML = text1;
   setTimeout(() => EL(el).innerHTML = text2, 3000);
-}
\ No newline at end of file
+}
+
+// =============== CBOR ================
+// словарь ключей, совпадает с _cborKeys в src/utils/cbor.cpp
+const cbor_keys = [
+  'id', 'type', 'name', 'value', 'label', 'text', 'color', 'min',
+  'max', 'step', 'tab_w', 'size', 'height', 'width', 'rows', 'regex',
+  'controls', 'updates', 'data', 'icon', 'version', 'PIN', 'max_upl', 'ota_t',
+  'modules', 'fs', 'used', 'total', 'chunk', 'amount', 'active', 'align',
+  'auto', 'exp', 'port', 'info', 'net', 'memory', 'system', 'path',
+  'upload', 'download', 'ota',
+  'values', 'hash', 'page',
+  'offset', 'window',
+  'seq', 'from', 'reset'
+];
+
+function isCbor(bytes) {
+  return bytes.length && bytes[0] == 0xbf;  // объект неопределённой длины
+}
+
+function decodeCbor(bytes) {
+  const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+  const utf8 = new TextDecoder();
+  let pos = 0;
+  const BREAK = {};
+
+  function length(info) {
+    if (info < 24) return info;
+    let v;
+    switch (info) {
+      case 24: v = view.getUint8(pos); pos += 1; return v;
+      case 25: v = view.getUint16(pos); pos += 2; return v;
+      case 26: v = view.getUint32(pos); pos += 4; return v;
+      case 27: v = view.getUint32(pos) * 0x100000000 + view.getUint32(pos + 4); pos += 8; return v;
+    }
+    throw new Error('CBOR length');
+  }
+
+  // кратчайшая запись float32, как на устройстве
+  function float32(f) {
+    for (let p = 1; p < 9; p++) {
+      let s = +f.toPrecision(p);
+      if (Math.fround(s) == f) return s;
+    }
+    return f;
+  }
+
+  function item() {
+    let ib = view.getUint8(pos++);
+    let major = ib >> 5, info = ib & 0x1f;
+    if (ib == 0xff) return BREAK;
+    switch (major) {
+      case 0: return length(info);
+      case 1: return -1 - length(info);
+      case 2: {
+        // бинарные команды холста
+        let len = length(info);
+        pos += len;
+        return bytes.slice(pos - len, pos);
+      }
+      case 3: {
+        let len = length(info);
+        let str = utf8.decode(bytes.subarray(pos, pos + len));
+        pos += len;
+        return str;
+      }
+      case 4: {
+        let arr = [];
+        if (info == 31) for (let v; (v = item()) !== BREAK;) arr.push(v);
+        else for (let n = length(info); n; n--) arr.push(item());
+        return arr;
+      }
+      case 5: {
+        let obj = {};
+        let n = info == 31 ? Infinity : length(info);
+        for (; n; n--) {
+          let k = item();
+          if (k === BREAK) break;
+          if (typeof k == 'number') k = cbor_keys[k];
+          obj[k] = item();
+        }
+        return obj;
+      }
+      case 7:
+        switch (info) {
+          case 20: return false;
+          case 21: return true;
+          case 22: return null;
+          case 26: pos += 4; return float32(view.getFloat32(pos - 4));
+          case 27: pos += 8; return view.getFloat64(pos - 8);
+        }
+    }
+    throw new Error('CBOR type ' + ib);
+  }
+
+  return item();
+}
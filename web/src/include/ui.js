@@ -334,7 +334,7 @@ function projects_h() {
 function refresh_h() {
   if (screen == 'device') post('focus');
   else if (screen == 'info') post('info');
-  else if (screen == 'fsbr') post('fsbr');
+  else if (screen == 'fsbr') requestFsbr();
   else discover();
 }
 function back_h() {
@@ -402,7 +402,7 @@ function fsbr_h() {
   menuDeact();
   menu_show(0);
   if (readModule(Modules.FSBR)) {
-    post('fsbr');
+    requestFsbr();
     EL('fsbr_inner').innerHTML = waiter();
   }
   EL('fs_browser').style.display = readModule(Modules.FSBR) ? 'block' : 'none';
@@ -431,6 +431,7 @@ function open_device(id) {
   checkUpdates(id);
   /*/NON-ESP*/
   focused = id;
+  devices_t[id].page = 0;
 
   switch (devices_t[id].conn) {
     case Conn.SERIAL:
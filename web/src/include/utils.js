@@ -145,6 +145,7 @@ function ratio() {
 }
 function resize_h() {
   showGauges();
+  Object.values(plots).forEach(drawPlot);
 }
 function waitAnimationFrame() {
   return new Promise(res => {